@@ -3,6 +3,7 @@
  * @brief  Archive class implementation.
  * @author zer0
  * @date   2019-02-25
+ * @date   2026-10-19 (Add the options of the writer)
  */
 
 #include <libtbag/archive/Archive.hpp>
@@ -340,6 +341,15 @@ ArchiveWriter::~ArchiveWriter()
     prefix("ArchiveWriter::~ArchiveWriter()", CODE);
 }
 
+Err ArchiveWriter::setOptions(std::string const & options)
+{
+    if (_open) {
+        return E_ILLSTATE;
+    }
+    auto const CODE = _archive_write_set_options(_archive, options.c_str());
+    return prefix("ArchiveWriter::setOptions()", CODE);
+}
+
 Err ArchiveWriter::openFile(std::string const & path)
 {
     if (_open) {
@@ -750,10 +760,28 @@ std::size_t compressArchive(std::string const & output_filename,
                             std::vector<std::string> const & input_filenames,
                             std::string const & format,
                             CompressType compress)
+{
+    return compressArchive(output_filename, input_filenames, format, compress, std::string());
+}
+
+std::size_t compressArchive(std::string const & output_filename,
+                            std::vector<std::string> const & input_filenames,
+                            std::string const & format,
+                            CompressType compress,
+                            std::string const & options)
 {
     std::size_t success_count = 0;
     try {
-        FileArchiveWriter writer(output_filename, format, compress);
+        FileArchiveWriter writer(format, compress);
+        if (!options.empty()) {
+            auto const CODE = writer.setOptions(options);
+            if (isFailure(CODE)) {
+                return 0;
+            }
+        }
+        if (isFailure(writer.openFile(output_filename))) {
+            return 0;
+        }
         for (auto & file : input_filenames) {
             if (isSuccess(writer.writeFromFile(file))) {
                 ++success_count;
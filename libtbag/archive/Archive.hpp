@@ -3,6 +3,7 @@
  * @brief  Archive class prototype.
  * @author zer0
  * @date   2019-02-25
+ * @date   2026-10-19 (Add the options of the writer)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_ARCHIVE_HPP__
@@ -153,6 +154,18 @@ public:
                   CompressType compress = CompressType::CT_NONE);
     virtual ~ArchiveWriter();
 
+public:
+    /**
+     * Set the options of the format and the filters.
+     *
+     * @param[in] options
+     *      Comma separated options of the libarchive. (e.g. "compression-level=9", "zip:compression=store")
+     *
+     * @warning
+     *  It must be called before the open.
+     */
+    Err setOptions(std::string const & options);
+
 public:
     Err openFile(std::string const & path);
     Err openMemory(char * buffer, std::size_t size, std::size_t * used);
@@ -274,6 +287,16 @@ TBAG_API std::size_t compressArchive(std::string const & output_filename,
                                      std::string const & format,
                                      CompressType compress = CompressType::CT_NONE);
 
+/**
+ * @param[in] options
+ *      Options of the ArchiveWriter::setOptions().
+ */
+TBAG_API std::size_t compressArchive(std::string const & output_filename,
+                                     std::vector<std::string> const & input_filenames,
+                                     std::string const & format,
+                                     CompressType compress,
+                                     std::string const & options);
+
 TBAG_API std::string getCompressFormatFromOutputFileName(std::string const & output_filename);
 
 TBAG_API std::size_t compressArchive(std::string const & output_filename,
@@ -0,0 +1,508 @@
+/**
+ * @file   ParallelZip.cpp
+ * @brief  ParallelZip class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Return the errors of the blocks and decide the ZIP64 by the compressed size)
+ */
+
+#include <libtbag/archive/ParallelZip.hpp>
+#include <libtbag/filesystem/Path.hpp>
+#include <libtbag/filesystem/File.hpp>
+#include <libtbag/thread/ThreadPool.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include <zlib.h>
+#include <zip.h>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace archive {
+
+/** Window size of the deflate. The tail of the previous block is the dictionary of the next block. */
+TBAG_CONSTEXPR static std::size_t const DEFLATE_DICTIONARY_SIZE = 32 * 1024;
+TBAG_CONSTEXPR static int const DEFLATE_RAW_WINDOW_BITS = -15;
+TBAG_CONSTEXPR static int const DEFLATE_MEM_LEVEL = 8;
+
+/** Sizes at or above this value need the ZIP64 extra field. */
+TBAG_CONSTEXPR static uint64_t const ZIP64_THRESHOLD = 0xFFFFFFFFu;
+
+/** Size of the local file header without the name and the ZIP64 extra field. */
+TBAG_CONSTEXPR static uint64_t const LOCAL_HEADER_SIZE = 30;
+TBAG_CONSTEXPR static uint64_t const LOCAL_ZIP64_EXTRA_SIZE = 20;
+
+/** Overhead of each block: the deflateBound() of the raw stream and the empty stored block of the flush. */
+TBAG_CONSTEXPR static uint64_t const DEFLATE_BLOCK_OVERHEAD = 16;
+
+/**
+ * The incompressible data grows by the deflate,
+ * so the bound of the compressed size is compared as well as the size.
+ */
+static bool isZip64Size(uint64_t size, std::size_t block_size) TBAG_NOEXCEPT
+{
+    auto const BLOCKS = (block_size != 0 ? size / block_size : 0) + 1;
+    auto const BOUND = size + (size >> 12) + (size >> 14) + (size >> 25) + BLOCKS * DEFLATE_BLOCK_OVERHEAD;
+    return size >= ZIP64_THRESHOLD || BOUND >= ZIP64_THRESHOLD;
+}
+
+/**
+ * ParallelZipWriter::Impl class implementation.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct ParallelZipWriter::Impl : private Noncopyable
+{
+    using Buffer     = libtbag::util::Buffer;
+    using ThreadPool = libtbag::thread::ThreadPool;
+
+    struct Block
+    {
+        /** Entry information. Only the first block of the entry has it. */
+        std::string name;
+        std::time_t time = 0;
+        bool zip64 = false;
+
+        bool first = false;
+        bool last  = false;
+
+        Buffer input;
+        std::size_t input_size = 0;
+        Buffer dictionary;
+
+        Buffer output;
+        std::size_t output_size = 0;
+        uLong crc = 0;
+
+        Err code = E_SUCCESS;
+        bool done = false;
+    };
+
+    using SharedBlock = std::shared_ptr<Block>;
+
+    Params const PARAMS;
+    std::size_t const THREAD_COUNT;
+    std::size_t const MAX_BLOCKS;
+
+    zipFile zip = nullptr;
+    std::unique_ptr<ThreadPool> pool;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<SharedBlock> blocks;
+
+    /** State of the entry being written. */
+    uint64_t write_size = 0;
+    uLong write_crc = 0;
+
+    /** Offset of the next local file header in the archive. */
+    uint64_t write_offset = 0;
+
+    std::size_t entry_count = 0;
+    Err first_error = E_SUCCESS;
+
+    Impl(Params const & params)
+            : PARAMS(params),
+              THREAD_COUNT(params.thread_count != 0 ? params.thread_count
+                                                    : std::max(1u, std::thread::hardware_concurrency())),
+              MAX_BLOCKS(params.max_blocks != 0 ? params.max_blocks : THREAD_COUNT * 4)
+    {
+        // EMPTY.
+    }
+
+    ~Impl()
+    {
+        close();
+    }
+
+    void setError(Err code)
+    {
+        if (isFailure(code) && isSuccess(first_error)) {
+            first_error = code;
+        }
+    }
+
+    Err open(std::string const & path)
+    {
+        if (zip != nullptr) {
+            return E_ALREADY;
+        }
+        zip = zipOpen64(path.c_str(), APPEND_STATUS_CREATE);
+        if (zip == nullptr) {
+            return E_OPEN;
+        }
+        pool = std::make_unique<ThreadPool>(THREAD_COUNT, true, false);
+        write_offset = 0;
+        entry_count = 0;
+        first_error = E_SUCCESS;
+        return E_SUCCESS;
+    }
+
+    Err close()
+    {
+        if (zip == nullptr) {
+            return E_ILLSTATE;
+        }
+        while (!blocks.empty()) {
+            writeFront();
+        }
+        pool->exit();
+        pool->join(false);
+        pool.reset();
+
+        if (zipClose(zip, nullptr) != ZIP_OK) {
+            setError(E_CLOSE);
+        }
+        zip = nullptr;
+        return first_error;
+    }
+
+    static void compress(Block & block, int level)
+    {
+        block.crc = crc32(0L, Z_NULL, 0);
+        block.crc = crc32(block.crc, (Bytef const *)block.input.data(), static_cast<uInt>(block.input_size));
+
+        z_stream stream;
+        ::memset(&stream, 0x00, sizeof(stream));
+        if (deflateInit2(&stream, level, Z_DEFLATED, DEFLATE_RAW_WINDOW_BITS,
+                         DEFLATE_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+            block.code = E_INIT;
+            return;
+        }
+        if (!block.dictionary.empty()) {
+            deflateSetDictionary(&stream, (Bytef const *)block.dictionary.data(),
+                                 static_cast<uInt>(block.dictionary.size()));
+        }
+
+        // The last block ends the deflate stream,
+        // and the others end with the empty stored block to align to the byte boundary.
+        int const FLUSH = block.last ? Z_FINISH : Z_SYNC_FLUSH;
+        block.output.resize(deflateBound(&stream, static_cast<uLong>(block.input_size)) + 16);
+        stream.next_in  = (Bytef *)block.input.data();
+        stream.avail_in = static_cast<uInt>(block.input_size);
+
+        std::size_t produced = 0;
+        while (true) {
+            stream.next_out  = (Bytef *)(block.output.data() + produced);
+            stream.avail_out = static_cast<uInt>(block.output.size() - produced);
+            auto const RESULT = ::deflate(&stream, FLUSH);
+            produced = block.output.size() - stream.avail_out;
+
+            if (RESULT == Z_STREAM_END) {
+                break;
+            }
+            if (RESULT != Z_OK && RESULT != Z_BUF_ERROR) {
+                block.code = E_ENCODE;
+                break;
+            }
+            if (!block.last && stream.avail_out != 0) {
+                break; // The flush is complete.
+            }
+            block.output.resize(block.output.size() * 2);
+        }
+        deflateEnd(&stream);
+
+        block.output_size = produced;
+        // The input is no longer needed.
+        Buffer().swap(block.input);
+        Buffer().swap(block.dictionary);
+    }
+
+    /**
+     * @return
+     *  The first error of the blocks written to make the room.
+     */
+    Err submit(SharedBlock const & block)
+    {
+        Err result = E_SUCCESS;
+        while (blocks.size() >= MAX_BLOCKS) {
+            auto const CODE = writeFront();
+            if (isFailure(CODE) && isSuccess(result)) {
+                result = CODE;
+            }
+        }
+        blocks.push_back(block);
+
+        auto const LEVEL = PARAMS.level;
+        pool->push([this, block, LEVEL](){
+            // The writer waits for the done, so it is set even if the compression throws.
+            try {
+                compress(*block, LEVEL);
+            } catch (std::bad_alloc const &) {
+                block->code = E_BADALLOC;
+            } catch (...) {
+                block->code = E_UNKEXCP;
+            }
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                block->done = true;
+            }
+            condition.notify_all();
+        });
+        return result;
+    }
+
+    /**
+     * @return
+     *  The error of the compression or the writing of the block.
+     */
+    Err writeFront()
+    {
+        assert(!blocks.empty());
+        SharedBlock block;
+        {
+            std::unique_lock<std::mutex> guard(mutex);
+            condition.wait(guard, [&](){ return blocks.front()->done; });
+            block = blocks.front();
+            blocks.pop_front();
+        }
+        Err result = block->code;
+
+        if (block->first) {
+            // The local file header beyond the 4GB also needs the ZIP64.
+            bool const ZIP64 = block->zip64 || write_offset >= ZIP64_THRESHOLD;
+            zip_fileinfo info;
+            ::memset(&info, 0x00, sizeof(info));
+            std::time_t time = (block->time != 0 ? block->time : ::time(nullptr));
+            struct tm * tdata = localtime(&time);
+            if (tdata != nullptr) {
+                info.tmz_date.tm_sec  = (uInt)tdata->tm_sec;
+                info.tmz_date.tm_min  = (uInt)tdata->tm_min;
+                info.tmz_date.tm_hour = (uInt)tdata->tm_hour;
+                info.tmz_date.tm_mday = (uInt)tdata->tm_mday;
+                info.tmz_date.tm_mon  = (uInt)tdata->tm_mon;
+                info.tmz_date.tm_year = (uInt)tdata->tm_year;
+            }
+            // The raw mode writes the compressed data as it is.
+            if (zipOpenNewFileInZip2_64(zip, block->name.c_str(), &info, nullptr, 0, nullptr, 0, nullptr,
+                                        Z_DEFLATED, PARAMS.level, 1, ZIP64 ? 1 : 0) != ZIP_OK) {
+                result = E_WRERR;
+            }
+            write_offset += LOCAL_HEADER_SIZE + block->name.size() + (ZIP64 ? LOCAL_ZIP64_EXTRA_SIZE : 0);
+            write_size = 0;
+            write_crc = crc32(0L, Z_NULL, 0);
+        }
+
+        if (isSuccess(block->code) && block->output_size > 0) {
+            if (zipWriteInFileInZip(zip, block->output.data(), static_cast<unsigned>(block->output_size)) != ZIP_OK) {
+                result = E_WRERR;
+            }
+            write_offset += block->output_size;
+        }
+        write_crc = crc32_combine(write_crc, block->crc, static_cast<z_off_t>(block->input_size));
+        write_size += block->input_size;
+
+        if (block->last) {
+            if (zipCloseFileInZipRaw64(zip, write_size, write_crc) != ZIP_OK) {
+                result = E_WRERR;
+            }
+        }
+        setError(result);
+        return result;
+    }
+
+    Err readBlock(Reader const & reader, SharedBlock & block)
+    {
+        block = std::make_shared<Block>();
+        block->input.resize(PARAMS.block_size);
+        while (block->input_size < block->input.size()) {
+            auto const SIZE = reader(block->input.data() + block->input_size,
+                                     block->input.size() - block->input_size);
+            if (SIZE < 0) {
+                return E_RDERR;
+            } else if (SIZE == 0) {
+                break;
+            }
+            block->input_size += static_cast<std::size_t>(SIZE);
+        }
+        return E_SUCCESS;
+    }
+
+    Err addEntry(std::string const & name, std::time_t time, bool zip64, Reader const & reader)
+    {
+        if (zip == nullptr) {
+            return E_ILLSTATE;
+        }
+        if (name.empty() || PARAMS.block_size == 0) {
+            return E_ILLARGS;
+        }
+
+        SharedBlock current;
+        auto code = readBlock(reader, current);
+        if (isFailure(code)) {
+            setError(code);
+            return code;
+        }
+        current->name = name;
+        current->time = time;
+        current->zip64 = zip64;
+        current->first = true;
+        ++entry_count;
+
+        // The blocks of the entry are submitted after the error, so the entry is closed.
+        Err result = E_SUCCESS;
+        auto const submitBlock = [&](SharedBlock const & block){
+            auto const SUBMIT_CODE = submit(block);
+            if (isFailure(SUBMIT_CODE) && isSuccess(result)) {
+                result = SUBMIT_CODE;
+            }
+        };
+
+        while (true) {
+            SharedBlock next;
+            code = readBlock(reader, next);
+            if (isFailure(code)) {
+                // Close the entry with the data read so far.
+                setError(code);
+                current->last = true;
+                submitBlock(current);
+                return code;
+            }
+
+            current->last = (next->input_size == 0);
+            if (!current->last) {
+                auto const TAIL = std::min(DEFLATE_DICTIONARY_SIZE, current->input_size);
+                auto const * end = current->input.data() + current->input_size;
+                next->dictionary.assign(end - TAIL, end);
+            }
+            submitBlock(current);
+            if (current->last) {
+                break;
+            }
+            current = next;
+        }
+        return result;
+    }
+};
+
+// ---------------------------------
+// ParallelZipWriter implementation.
+// ---------------------------------
+
+ParallelZipWriter::ParallelZipWriter() : ParallelZipWriter(Params())
+{
+    // EMPTY.
+}
+
+ParallelZipWriter::ParallelZipWriter(Params const & params)
+        : _impl(std::make_unique<Impl>(params))
+{
+    assert(static_cast<bool>(_impl));
+}
+
+ParallelZipWriter::~ParallelZipWriter()
+{
+    // EMPTY.
+}
+
+bool ParallelZipWriter::isOpen() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->zip != nullptr;
+}
+
+std::size_t ParallelZipWriter::getEntryCount() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->entry_count;
+}
+
+Err ParallelZipWriter::open(std::string const & path)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->open(path);
+}
+
+Err ParallelZipWriter::close()
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->close();
+}
+
+Err ParallelZipWriter::addFile(std::string const & path, std::string const & name)
+{
+    assert(static_cast<bool>(_impl));
+    using namespace libtbag::filesystem;
+    File file;
+    auto const CODE = file.open(path, File::Flags().clear().rdonly());
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    auto const STATE = file.getState();
+    auto const ENTRY_NAME = name.empty() ? Path(path).getName() : name;
+    return _impl->addEntry(ENTRY_NAME, static_cast<std::time_t>(STATE.mtim.sec),
+                           isZip64Size(STATE.size, _impl->PARAMS.block_size),
+                           [&file](char * buffer, std::size_t size) -> int64_t {
+                               return file.read(buffer, size);
+                           });
+}
+
+Err ParallelZipWriter::addMemory(std::string const & name, char const * data, std::size_t size, std::time_t time)
+{
+    assert(static_cast<bool>(_impl));
+    if (data == nullptr && size != 0) {
+        return E_ILLARGS;
+    }
+    std::size_t offset = 0;
+    return _impl->addEntry(name, time, isZip64Size(size, _impl->PARAMS.block_size),
+                           [&](char * buffer, std::size_t buffer_size) -> int64_t {
+                               auto const COPY_SIZE = std::min(buffer_size, size - offset);
+                               if (COPY_SIZE > 0) {
+                                   ::memcpy(buffer, data + offset, COPY_SIZE);
+                                   offset += COPY_SIZE;
+                               }
+                               return static_cast<int64_t>(COPY_SIZE);
+                           });
+}
+
+Err ParallelZipWriter::addStream(std::string const & name, Reader const & reader, std::time_t time)
+{
+    assert(static_cast<bool>(_impl));
+    if (!reader) {
+        return E_ILLARGS;
+    }
+    // The size is unknown, so the ZIP64 extra field is always written.
+    return _impl->addEntry(name, time, true, reader);
+}
+
+// ------------------------
+// Miscellaneous utilities.
+// ------------------------
+
+Err compressZipParallel(std::string const & output_path,
+                        std::vector<std::string> const & files,
+                        std::vector<std::string> const & names,
+                        ParallelZipWriter::Params const & params)
+{
+    ParallelZipWriter writer(params);
+    auto code = writer.open(output_path);
+    if (isFailure(code)) {
+        return code;
+    }
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        code = writer.addFile(files[i], (i < names.size() ? names[i] : std::string()));
+        if (isFailure(code)) {
+            writer.close();
+            return code;
+        }
+    }
+    return writer.close();
+}
+
+} // namespace archive
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
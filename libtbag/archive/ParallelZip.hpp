@@ -0,0 +1,155 @@
+/**
+ * @file   ParallelZip.hpp
+ * @brief  ParallelZip class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Return the errors of the blocks)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_PARALLELZIP_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_PARALLELZIP_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Unit.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace archive {
+
+/**
+ * ParallelZipWriter class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Write the zip archive with the deflate blocks compressed on the thread pool. @n
+ *  Each entry is read by the block_size and the blocks are compressed independently (like the pigz),
+ *  with the last 32KB of the previous block as the dictionary. @n
+ *  The compressed blocks are written in order, so the output is the ordinary zip archive. @n
+ *  The blocks of the next entries are compressed while the previous entry is written,
+ *  so the many small entries are also compressed in parallel. @n
+ *  At most max_blocks blocks are kept in the memory, so the entries need not fit in the memory. @n
+ *  The error of a block is returned by the method which writes the block, and by the close().
+ *
+ * @warning
+ *  The methods are not thread-safe. Call them from one thread.
+ */
+class TBAG_API ParallelZipWriter : private Noncopyable
+{
+public:
+    struct Impl;
+    friend struct Impl;
+
+public:
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+    /**
+     * Read the next data of the stream.
+     *
+     * @return
+     *  The number of bytes read. 0 is the end of the stream, and a negative value is the error.
+     */
+    using Reader = std::function<int64_t(char * buffer, std::size_t size)>;
+
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_BLOCK_SIZE = 128 * libtbag::KILO_BYTE_TO_BYTE;
+    TBAG_CONSTEXPR static int const DEFAULT_LEVEL = -1;
+
+    struct Params
+    {
+        /** Number of the compression threads. If 0, the hardware concurrency is used. */
+        std::size_t thread_count = 0;
+
+        /** Uncompressed size of the block. */
+        std::size_t block_size = DEFAULT_BLOCK_SIZE;
+
+        /** Maximum number of the blocks in memory. If 0, four times the thread_count is used. */
+        std::size_t max_blocks = 0;
+
+        /** Compression level of the zlib. (-1: default, 0: store ~ 9: best) */
+        int level = DEFAULT_LEVEL;
+    };
+
+private:
+    UniqueImpl _impl;
+
+public:
+    ParallelZipWriter();
+    ParallelZipWriter(Params const & params);
+    ~ParallelZipWriter();
+
+public:
+    bool isOpen() const;
+
+    /** Number of the entries written or queued. */
+    std::size_t getEntryCount() const;
+
+public:
+    Err open(std::string const & path);
+
+    /**
+     * Wait for the queued blocks and write the central directory.
+     *
+     * @return
+     *  The first error of the entries, if any.
+     */
+    Err close();
+
+public:
+    /**
+     * Add the file. The file is read by the blocks.
+     *
+     * @param[in] path
+     *      Source file path.
+     * @param[in] name
+     *      Name of the entry. If empty, the filename of the path is used.
+     */
+    Err addFile(std::string const & path, std::string const & name = std::string());
+
+    /** The data is copied to the blocks, so it may be released after the call. */
+    Err addMemory(std::string const & name, char const * data, std::size_t size, std::time_t time = 0);
+
+    /** The reader is called until it returns 0 (or the error) before this method returns. */
+    Err addStream(std::string const & name, Reader const & reader, std::time_t time = 0);
+};
+
+/**
+ * Compress the files to the zip archive in parallel.
+ *
+ * @param[in] output_path
+ *      Output zip file path.
+ * @param[in] files
+ *      Source file paths.
+ * @param[in] names
+ *      Names of the entries. If it is shorter than the files, the filenames are used for the rest.
+ */
+TBAG_API Err compressZipParallel(std::string const & output_path,
+                                 std::vector<std::string> const & files,
+                                 std::vector<std::string> const & names = std::vector<std::string>(),
+                                 ParallelZipWriter::Params const & params = ParallelZipWriter::Params());
+
+} // namespace archive
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_PARALLELZIP_HPP__
+
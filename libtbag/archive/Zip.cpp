@@ -3,6 +3,8 @@
  * @brief  Zip class implementation.
  * @author zer0
  * @date   2016-11-17
+ * @date   2026-10-19 (Decode into the fixed size buffer)
+ * @date   2026-10-19 (Add the reusable Inflater)
  */
 
 #include <libtbag/archive/Zip.hpp>
@@ -186,6 +188,91 @@ Err decode(char const * input, std::size_t size, util::Buffer & output)
     return coding<CodingDirection::CD_DECODE>(input, size, output, INFLATE_WINDOW_BITS);
 }
 
+Err decode(char const * input, std::size_t size, char * output, std::size_t capacity, std::size_t * output_size)
+{
+    return Inflater().decode(input, size, output, capacity, output_size);
+}
+
+/**
+ * Inflater::Impl class implementation.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct Inflater::Impl : private Noncopyable
+{
+    z_stream stream;
+    bool initialized = false;
+
+    Impl()
+    {
+        stream.zalloc = Z_NULL;
+        stream.zfree  = Z_NULL;
+        stream.opaque = Z_NULL;
+        stream.next_in = Z_NULL;
+        stream.avail_in = 0;
+    }
+
+    ~Impl()
+    {
+        if (initialized) {
+            ::inflateEnd(&stream);
+        }
+    }
+
+    Err reset()
+    {
+        if (initialized) {
+            return _zlib_error_to_tbag_error(::inflateReset(&stream));
+        }
+        auto const result = inflateInit2(&stream, INFLATE_WINDOW_BITS);
+        if (result != Z_OK) {
+            return _zlib_error_to_tbag_error(result);
+        }
+        initialized = true;
+        return E_SUCCESS;
+    }
+};
+
+Inflater::Inflater() : _impl(std::make_unique<Impl>())
+{
+    assert(static_cast<bool>(_impl));
+}
+
+Inflater::~Inflater()
+{
+    // EMPTY.
+}
+
+Err Inflater::decode(char const * input, std::size_t size, char * output, std::size_t capacity, std::size_t * output_size)
+{
+    assert(static_cast<bool>(_impl));
+    auto const code = _impl->reset();
+    if (isFailure(code)) {
+        return code;
+    }
+
+    auto & stream = _impl->stream;
+    stream.next_in   = (Bytef*)input;
+    stream.avail_in  = static_cast<uInt>(size);
+    stream.next_out  = (Bytef*)output;
+    stream.avail_out = static_cast<uInt>(capacity);
+
+    auto const result = ::inflate(&stream, Z_FINISH);
+    assert(result != Z_STREAM_ERROR);  // state not clobbered.
+
+    if (output_size != nullptr) {
+        *output_size = static_cast<std::size_t>(stream.total_out);
+    }
+
+    if (result == Z_STREAM_END) {
+        return E_SUCCESS;
+    } else if (result == Z_BUF_ERROR && stream.avail_out == 0) {
+        return E_SMALLBUF;
+    }
+    return _zlib_error_to_tbag_error(result);
+}
+
 Err zip(std::vector<std::string> const & files,
         std::string const & output_path,
         std::vector<std::string> const & names,
@@ -3,6 +3,8 @@
  * @brief  Zip class prototype.
  * @author zer0
  * @date   2016-11-17
+ * @date   2026-10-19 (Decode into the fixed size buffer)
+ * @date   2026-10-19 (Add the reusable Inflater)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_ZIP_HPP__
@@ -16,9 +18,11 @@
 #include <libtbag/config.h>
 #include <libtbag/predef.hpp>
 #include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
 #include <libtbag/util/BufferInfo.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -45,6 +49,53 @@ TBAG_API Err encode(char const * input, std::size_t size, util::Buffer & output,
                     CompressionMethod method = CompressionMethod::CM_ZLIB);
 TBAG_API Err decode(char const * input, std::size_t size, util::Buffer & output);
 
+/**
+ * Decode into the fixed size buffer without the intermediate buffers.
+ *
+ * @return
+ *  E_SMALLBUF if the decoded data is larger than the capacity.
+ */
+TBAG_API Err decode(char const * input, std::size_t size, char * output, std::size_t capacity,
+                    std::size_t * output_size = nullptr);
+
+/**
+ * Inflater class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The zlib or gzip decoder which keeps the inflate stream. @n
+ *  The stream is reset for the next data, so the states and the window are not allocated again.
+ *
+ * @warning
+ *  This class is not thread-safe. Use one per thread.
+ */
+class TBAG_API Inflater : private Noncopyable
+{
+public:
+    struct Impl;
+    friend struct Impl;
+
+public:
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+private:
+    UniqueImpl _impl;
+
+public:
+    Inflater();
+    ~Inflater();
+
+public:
+    /**
+     * @return
+     *  E_SMALLBUF if the decoded data is larger than the capacity.
+     */
+    Err decode(char const * input, std::size_t size, char * output, std::size_t capacity,
+               std::size_t * output_size = nullptr);
+};
+
 TBAG_API Err zip(std::vector<std::string> const & files,
                  std::string const & output_path,
                  std::vector<std::string> const & names = std::vector<std::string>(),
@@ -0,0 +1,491 @@
+/**
+ * @file   ZipIndexReader.cpp
+ * @brief  ZipIndexReader class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Reject the forged sizes of the entries)
+ */
+
+#include <libtbag/archive/ZipIndexReader.hpp>
+#include <libtbag/filesystem/File.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#include <zlib.h>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace archive {
+
+TBAG_CONSTEXPR static uint32_t const LOCAL_HEADER_SIGNATURE   = 0x04034b50;
+TBAG_CONSTEXPR static uint32_t const CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+TBAG_CONSTEXPR static uint32_t const END_OF_CENTRAL_SIGNATURE = 0x06054b50;
+TBAG_CONSTEXPR static uint32_t const ZIP64_END_OF_CENTRAL_SIGNATURE = 0x06064b50;
+TBAG_CONSTEXPR static uint32_t const ZIP64_LOCATOR_SIGNATURE  = 0x07064b50;
+TBAG_CONSTEXPR static uint16_t const ZIP64_EXTRA_ID = 0x0001;
+
+TBAG_CONSTEXPR static std::size_t const LOCAL_HEADER_SIZE   = 30;
+TBAG_CONSTEXPR static std::size_t const CENTRAL_HEADER_SIZE = 46;
+TBAG_CONSTEXPR static std::size_t const END_OF_CENTRAL_SIZE = 22;
+TBAG_CONSTEXPR static std::size_t const ZIP64_END_OF_CENTRAL_SIZE = 56;
+TBAG_CONSTEXPR static std::size_t const ZIP64_LOCATOR_SIZE  = 20;
+TBAG_CONSTEXPR static std::size_t const MAX_COMMENT_SIZE    = 0xFFFF;
+
+/** The avail_in/avail_out of the zlib are 32bit. */
+TBAG_CONSTEXPR static std::size_t const MAX_ZLIB_SLICE = 1024 * 1024 * 1024;
+
+// The zip format is little-endian.
+
+static inline uint16_t readU16(char const * p) TBAG_NOEXCEPT
+{
+    auto const * u = reinterpret_cast<uint8_t const *>(p);
+    return static_cast<uint16_t>(u[0] | (u[1] << 8));
+}
+
+static inline uint32_t readU32(char const * p) TBAG_NOEXCEPT
+{
+    auto const * u = reinterpret_cast<uint8_t const *>(p);
+    return static_cast<uint32_t>(u[0]) | (static_cast<uint32_t>(u[1]) << 8) |
+           (static_cast<uint32_t>(u[2]) << 16) | (static_cast<uint32_t>(u[3]) << 24);
+}
+
+static inline uint64_t readU64(char const * p) TBAG_NOEXCEPT
+{
+    return static_cast<uint64_t>(readU32(p)) | (static_cast<uint64_t>(readU32(p + 4)) << 32);
+}
+
+std::time_t ZipIndexReader::Entry::getTime() const
+{
+    tm time;
+    ::memset(&time, 0x00, sizeof(time));
+    time.tm_year  = ((dos_date >> 9) & 0x7F) + 80;
+    time.tm_mon   = ((dos_date >> 5) & 0x0F) - 1;
+    time.tm_mday  = (dos_date & 0x1F);
+    time.tm_hour  = (dos_time >> 11) & 0x1F;
+    time.tm_min   = (dos_time >> 5) & 0x3F;
+    time.tm_sec   = (dos_time & 0x1F) * 2;
+    time.tm_isdst = -1;
+    return ::mktime(&time);
+}
+
+ZipIndexReader::ZipIndexReader() : _max_extract_size(0)
+{
+    // EMPTY.
+}
+
+ZipIndexReader::ZipIndexReader(std::string const & path) : _max_extract_size(0)
+{
+    auto const code = open(path);
+    if (isFailure(code)) {
+        throw ErrException(code);
+    }
+}
+
+ZipIndexReader::~ZipIndexReader()
+{
+    close();
+}
+
+Err ZipIndexReader::open(std::string const & path)
+{
+    close();
+    auto code = _file.open(path, MappedFile::Mode::READ_ONLY);
+    if (isFailure(code)) {
+        return code;
+    }
+    code = parseCentralDirectory();
+    if (isFailure(code)) {
+        close();
+        return code;
+    }
+    // The entries are accessed in any order.
+    _file.advise(MappedFile::Advice::RANDOM);
+    return E_SUCCESS;
+}
+
+void ZipIndexReader::close()
+{
+    _file.close();
+    _entries.clear();
+    _names.clear();
+}
+
+Err ZipIndexReader::parseCentralDirectory()
+{
+    auto const * begin = _file.data();
+    auto const SIZE = _file.size();
+    if (SIZE < END_OF_CENTRAL_SIZE) {
+        return E_PARSING;
+    }
+
+    // Find the end of central directory record backward. It is followed by the comment.
+    std::size_t end_pos = SIZE - END_OF_CENTRAL_SIZE;
+    std::size_t const SEARCH_END = (end_pos > MAX_COMMENT_SIZE ? end_pos - MAX_COMMENT_SIZE : 0);
+    while (readU32(begin + end_pos) != END_OF_CENTRAL_SIGNATURE) {
+        if (end_pos == SEARCH_END) {
+            return E_PARSING;
+        }
+        --end_pos;
+    }
+
+    auto const * end_record = begin + end_pos;
+    uint64_t entry_count = readU16(end_record + 10);
+    uint64_t central_size = readU32(end_record + 12);
+    uint64_t central_offset = readU32(end_record + 16);
+
+    if (entry_count == 0xFFFF || central_size == 0xFFFFFFFF || central_offset == 0xFFFFFFFF) {
+        // The ZIP64 locator is placed just before the end of central directory record.
+        if (end_pos < ZIP64_LOCATOR_SIZE) {
+            return E_PARSING;
+        }
+        auto const * locator = end_record - ZIP64_LOCATOR_SIZE;
+        if (readU32(locator) != ZIP64_LOCATOR_SIGNATURE) {
+            return E_PARSING;
+        }
+        auto const ZIP64_END_POS = readU64(locator + 8);
+        if (ZIP64_END_POS > SIZE - ZIP64_END_OF_CENTRAL_SIZE) {
+            return E_PARSING;
+        }
+        auto const * zip64_end = begin + ZIP64_END_POS;
+        if (readU32(zip64_end) != ZIP64_END_OF_CENTRAL_SIGNATURE) {
+            return E_PARSING;
+        }
+        entry_count = readU64(zip64_end + 32);
+        central_size = readU64(zip64_end + 40);
+        central_offset = readU64(zip64_end + 48);
+    }
+
+    if (central_offset > SIZE || central_size > SIZE - central_offset) {
+        return E_PARSING;
+    }
+    // Each entry takes the header at least, so the broken count does not reserve the huge memory.
+    if (entry_count > central_size / CENTRAL_HEADER_SIZE) {
+        return E_PARSING;
+    }
+
+    _entries.reserve(static_cast<std::size_t>(entry_count));
+    _names.reserve(static_cast<std::size_t>(entry_count));
+
+    auto const * cursor = begin + central_offset;
+    auto const * central_end = cursor + central_size;
+
+    for (uint64_t i = 0; i < entry_count; ++i) {
+        if (central_end - cursor < static_cast<std::ptrdiff_t>(CENTRAL_HEADER_SIZE)) {
+            return E_PARSING;
+        }
+        if (readU32(cursor) != CENTRAL_HEADER_SIGNATURE) {
+            return E_PARSING;
+        }
+
+        Entry entry;
+        entry.flags    = readU16(cursor +  8);
+        entry.method   = readU16(cursor + 10);
+        entry.dos_time = readU16(cursor + 12);
+        entry.dos_date = readU16(cursor + 14);
+        entry.crc      = readU32(cursor + 16);
+        entry.compressed_size     = readU32(cursor + 20);
+        entry.size                = readU32(cursor + 24);
+        entry.local_header_offset = readU32(cursor + 42);
+
+        auto const NAME_SIZE    = readU16(cursor + 28);
+        auto const EXTRA_SIZE   = readU16(cursor + 30);
+        auto const COMMENT_SIZE = readU16(cursor + 32);
+        auto const RECORD_SIZE  = CENTRAL_HEADER_SIZE + NAME_SIZE + EXTRA_SIZE + COMMENT_SIZE;
+        if (central_end - cursor < static_cast<std::ptrdiff_t>(RECORD_SIZE)) {
+            return E_PARSING;
+        }
+        entry.name.assign(cursor + CENTRAL_HEADER_SIZE, NAME_SIZE);
+
+        // The ZIP64 extra field has only the values which are 0xFFFFFFFF in the header, in this order.
+        auto const * extra = cursor + CENTRAL_HEADER_SIZE + NAME_SIZE;
+        auto const * extra_end = extra + EXTRA_SIZE;
+        while (extra_end - extra >= 4) {
+            auto const ID = readU16(extra);
+            auto const DATA_SIZE = readU16(extra + 2);
+            auto const * data = extra + 4;
+            if (extra_end - data < DATA_SIZE) {
+                break;
+            }
+            if (ID == ZIP64_EXTRA_ID) {
+                auto const * data_end = data + DATA_SIZE;
+                if (entry.size == 0xFFFFFFFF && data_end - data >= 8) {
+                    entry.size = readU64(data);
+                    data += 8;
+                }
+                if (entry.compressed_size == 0xFFFFFFFF && data_end - data >= 8) {
+                    entry.compressed_size = readU64(data);
+                    data += 8;
+                }
+                if (entry.local_header_offset == 0xFFFFFFFF && data_end - data >= 8) {
+                    entry.local_header_offset = readU64(data);
+                }
+                break;
+            }
+            extra = data + DATA_SIZE;
+        }
+
+        // The first entry wins, like the most of the extractors.
+        _names.emplace(entry.name, _entries.size());
+        _entries.push_back(std::move(entry));
+        cursor += RECORD_SIZE;
+    }
+    return E_SUCCESS;
+}
+
+int64_t ZipIndexReader::find(std::string const & name) const
+{
+    auto const itr = _names.find(name);
+    if (itr == _names.end()) {
+        return -1;
+    }
+    return static_cast<int64_t>(itr->second);
+}
+
+Err ZipIndexReader::getData(Entry const & entry, char const ** data) const
+{
+    auto const SIZE = static_cast<uint64_t>(_file.size());
+    if (entry.local_header_offset > SIZE || SIZE - entry.local_header_offset < LOCAL_HEADER_SIZE) {
+        return E_PARSING;
+    }
+    auto const * header = _file.data() + entry.local_header_offset;
+    if (readU32(header) != LOCAL_HEADER_SIGNATURE) {
+        return E_PARSING;
+    }
+    // The name and extra field of the local header may differ from the central directory.
+    auto const DATA_OFFSET = entry.local_header_offset + LOCAL_HEADER_SIZE + readU16(header + 26) + readU16(header + 28);
+    if (DATA_OFFSET > SIZE || SIZE - DATA_OFFSET < entry.compressed_size) {
+        return E_PARSING;
+    }
+    *data = _file.data() + DATA_OFFSET;
+    return E_SUCCESS;
+}
+
+/**
+ * Decode the entry to the output buffer or to the writer by the chunks.
+ *
+ * @remarks
+ *  If the writer is nullptr, the output must be large enough for the entry.
+ */
+static Err decodeEntry(ZipIndexReader::Entry const & entry, char const * input,
+                       char * output, ZipIndexReader::Writer const * writer, std::size_t chunk_size)
+{
+    uLong crc = crc32(0L, Z_NULL, 0);
+    uint64_t produced = 0;
+
+    if (entry.method == ZipIndexReader::METHOD_STORE) {
+        if (entry.compressed_size != entry.size) {
+            return E_DECODE;
+        }
+        while (produced < entry.size) {
+            auto const SLICE = static_cast<std::size_t>(std::min<uint64_t>(entry.size - produced,
+                                                                           writer ? chunk_size : MAX_ZLIB_SLICE));
+            crc = crc32(crc, (Bytef const *)(input + produced), static_cast<uInt>(SLICE));
+            if (writer) {
+                // The data is passed from the mapping without the copy.
+                if (!(*writer)(input + produced, SLICE)) {
+                    return E_ECANCELED;
+                }
+            } else {
+                ::memcpy(output + produced, input + produced, SLICE);
+            }
+            produced += SLICE;
+        }
+        return crc == entry.crc ? E_SUCCESS : E_DECODE;
+    }
+
+    assert(entry.method == ZipIndexReader::METHOD_DEFLATE);
+    z_stream stream;
+    ::memset(&stream, 0x00, sizeof(stream));
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        return E_INIT;
+    }
+
+    libtbag::util::Buffer chunk;
+    if (writer) {
+        chunk.resize(chunk_size);
+    }
+    // If the output is full before the end of the stream, the rest goes here to detect the wrong size.
+    char overflow[64];
+
+    uint64_t consumed = 0;
+    Err code = E_SUCCESS;
+    int result = Z_OK;
+
+    while (result != Z_STREAM_END) {
+        if (stream.avail_in == 0 && consumed < entry.compressed_size) {
+            auto const SLICE = std::min<uint64_t>(entry.compressed_size - consumed, MAX_ZLIB_SLICE);
+            stream.next_in  = (Bytef *)(input + consumed);
+            stream.avail_in = static_cast<uInt>(SLICE);
+            consumed += SLICE;
+        }
+
+        char * out;
+        std::size_t out_size;
+        if (writer) {
+            out = chunk.data();
+            out_size = chunk.size();
+        } else if (produced < entry.size) {
+            out = output + produced;
+            out_size = static_cast<std::size_t>(std::min<uint64_t>(entry.size - produced, MAX_ZLIB_SLICE));
+        } else {
+            out = overflow;
+            out_size = sizeof(overflow);
+        }
+        stream.next_out  = (Bytef *)out;
+        stream.avail_out = static_cast<uInt>(out_size);
+
+        result = ::inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_STREAM_END) {
+            code = E_DECODE; // Broken or truncated data.
+            break;
+        }
+
+        auto const WRITTEN = out_size - stream.avail_out;
+        if (WRITTEN == 0) {
+            continue;
+        }
+        if (out == overflow || produced + WRITTEN > entry.size) {
+            code = E_DECODE;
+            break;
+        }
+        crc = crc32(crc, (Bytef const *)out, static_cast<uInt>(WRITTEN));
+        produced += WRITTEN;
+        if (writer && !(*writer)(out, WRITTEN)) {
+            code = E_ECANCELED;
+            break;
+        }
+    }
+    inflateEnd(&stream);
+
+    if (isFailure(code)) {
+        return code;
+    }
+    if (produced != entry.size || crc != entry.crc) {
+        return E_DECODE;
+    }
+    return E_SUCCESS;
+}
+
+Err ZipIndexReader::extract(std::size_t index, Writer const & writer, std::size_t chunk_size) const
+{
+    if (!isOpen()) {
+        return E_ILLSTATE;
+    }
+    if (index >= _entries.size()) {
+        return E_OORANGE;
+    }
+    if (!writer || chunk_size == 0) {
+        return E_ILLARGS;
+    }
+
+    auto const & entry = _entries[index];
+    if (entry.isEncrypted() || (entry.method != METHOD_STORE && entry.method != METHOD_DEFLATE)) {
+        return E_EOPNOTSUPP;
+    }
+    char const * data = nullptr;
+    auto const code = getData(entry, &data);
+    if (isFailure(code)) {
+        return code;
+    }
+    return decodeEntry(entry, data, nullptr, &writer, chunk_size);
+}
+
+Err ZipIndexReader::extract(std::size_t index, char * buffer, std::size_t size) const
+{
+    if (!isOpen()) {
+        return E_ILLSTATE;
+    }
+    if (index >= _entries.size()) {
+        return E_OORANGE;
+    }
+
+    auto const & entry = _entries[index];
+    if (entry.isEncrypted() || (entry.method != METHOD_STORE && entry.method != METHOD_DEFLATE)) {
+        return E_EOPNOTSUPP;
+    }
+    if (size < entry.size) {
+        return E_SMALLBUF;
+    }
+    if (buffer == nullptr && entry.size != 0) {
+        return E_ILLARGS;
+    }
+    char const * data = nullptr;
+    auto const code = getData(entry, &data);
+    if (isFailure(code)) {
+        return code;
+    }
+    return decodeEntry(entry, data, buffer, nullptr, 0);
+}
+
+bool ZipIndexReader::isValidSize(Entry const & entry) TBAG_NOEXCEPT
+{
+    if (entry.method == METHOD_STORE) {
+        return entry.size == entry.compressed_size;
+    }
+    if (entry.compressed_size > std::numeric_limits<uint64_t>::max() / MAX_DEFLATE_RATIO) {
+        return true;
+    }
+    return entry.size <= entry.compressed_size * MAX_DEFLATE_RATIO;
+}
+
+Err ZipIndexReader::extract(std::size_t index, Buffer & output) const
+{
+    if (index >= _entries.size()) {
+        return isOpen() ? E_OORANGE : E_ILLSTATE;
+    }
+
+    // The size of the central directory is not trusted before the allocation.
+    auto const & entry = _entries[index];
+    if ((entry.method == METHOD_STORE || entry.method == METHOD_DEFLATE) && !isValidSize(entry)) {
+        return E_DECODE;
+    }
+    auto const SIZE = entry.size;
+    if (_max_extract_size != 0 && SIZE > _max_extract_size) {
+        return E_OORANGE;
+    }
+    if (SIZE > static_cast<uint64_t>(std::numeric_limits<std::size_t>::max())) {
+        return E_OORANGE;
+    }
+    output.resize(static_cast<std::size_t>(SIZE));
+    return extract(index, output.data(), output.size());
+}
+
+Err ZipIndexReader::extract(std::string const & name, Buffer & output) const
+{
+    auto const INDEX = find(name);
+    if (INDEX < 0) {
+        return E_NFOUND;
+    }
+    return extract(static_cast<std::size_t>(INDEX), output);
+}
+
+Err ZipIndexReader::extractToFile(std::size_t index, std::string const & path) const
+{
+    using namespace libtbag::filesystem;
+    File file;
+    auto const code = file.open(path, File::Flags().clear().wronly().creat().trunc());
+    if (isFailure(code)) {
+        return code;
+    }
+    bool write_error = false;
+    auto const result = extract(index, [&](char const * data, std::size_t size) -> bool {
+        if (file.write(data, size) != static_cast<int>(size)) {
+            write_error = true;
+            return false;
+        }
+        return true;
+    });
+    return write_error ? E_WRERR : result;
+}
+
+} // namespace archive
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,190 @@
+/**
+ * @file   ZipIndexReader.hpp
+ * @brief  ZipIndexReader class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Reject the forged sizes of the entries)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_ZIPINDEXREADER_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_ZIPINDEXREADER_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace archive {
+
+/**
+ * ZipIndexReader class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Random access reader of the zip archive. @n
+ *  The archive is mapped to the memory and the central directory is parsed once in the open(). @n
+ *  The entries are extracted one by one on demand, without the scan of the archive. @n
+ *  The ZIP64 archives are supported, and the methods are the store and the deflate.
+ *
+ * @warning
+ *  The extract methods are const and the index is not changed after the open(),
+ *  so they can be called from the several threads at the same time.
+ *  The open() and close() must not be called while the other threads are extracting.
+ */
+class TBAG_API ZipIndexReader : private Noncopyable
+{
+public:
+    using MappedFile = libtbag::filesystem::MappedFile;
+    using Buffer     = libtbag::util::Buffer;
+
+    TBAG_CONSTEXPR static uint16_t const METHOD_STORE   = 0;
+    TBAG_CONSTEXPR static uint16_t const METHOD_DEFLATE = 8;
+
+    struct Entry
+    {
+        std::string name;
+
+        uint16_t flags  = 0;
+        uint16_t method = 0;
+        uint16_t dos_time = 0;
+        uint16_t dos_date = 0;
+        uint32_t crc = 0;
+
+        uint64_t compressed_size = 0;
+        uint64_t size = 0;
+        uint64_t local_header_offset = 0;
+
+        inline bool isDirectory() const TBAG_NOEXCEPT
+        { return !name.empty() && name.back() == '/'; }
+
+        inline bool isEncrypted() const TBAG_NOEXCEPT
+        { return (flags & 0x0001) != 0; }
+
+        /** Modification time of the MS-DOS date and time, in the local time. */
+        std::time_t getTime() const;
+    };
+
+    using Entries = std::vector<Entry>;
+
+    /**
+     * Receive the extracted data.
+     *
+     * @return
+     *  If false, the extraction is stopped with E_ECANCELED.
+     */
+    using Writer = std::function<bool(char const * data, std::size_t size)>;
+
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    /** The deflate can't compress more than this ratio. */
+    TBAG_CONSTEXPR static uint64_t const MAX_DEFLATE_RATIO = 1032;
+
+private:
+    MappedFile _file;
+    Entries _entries;
+    std::unordered_map<std::string, std::size_t> _names;
+
+    /** Maximum size of the entry extracted to the Buffer. (If 0, no limit) */
+    uint64_t _max_extract_size;
+
+public:
+    ZipIndexReader();
+    ZipIndexReader(std::string const & path);
+    ~ZipIndexReader();
+
+public:
+    inline bool isOpen() const TBAG_NOEXCEPT
+    { return _file.isOpen(); }
+
+    inline std::size_t size() const TBAG_NOEXCEPT
+    { return _entries.size(); }
+
+    inline Entries const & entries() const TBAG_NOEXCEPT
+    { return _entries; }
+
+    inline Entry const & at(std::size_t index) const
+    { return _entries.at(index); }
+
+public:
+    inline uint64_t getMaxExtractSize() const TBAG_NOEXCEPT
+    { return _max_extract_size; }
+
+    /** Set it before the other threads extract. */
+    inline void setMaxExtractSize(uint64_t size) TBAG_NOEXCEPT
+    { _max_extract_size = size; }
+
+public:
+    /** Map the archive and parse the central directory. */
+    Err open(std::string const & path);
+    void close();
+
+public:
+    /**
+     * @return
+     *  Index of the entry, or -1 if not found.
+     */
+    int64_t find(std::string const & name) const;
+
+public:
+    /**
+     * Extract the entry to the writer by the chunks.
+     *
+     * @return
+     *  E_DECODE if the data is broken or the CRC is not matched.
+     */
+    Err extract(std::size_t index, Writer const & writer, std::size_t chunk_size = DEFAULT_CHUNK_SIZE) const;
+
+    /**
+     * Extract the entry to the buffer of the caller.
+     *
+     * @return
+     *  E_SMALLBUF if the size is less than the size of the entry.
+     */
+    Err extract(std::size_t index, char * buffer, std::size_t size) const;
+
+    /**
+     * Extract the entry to the buffer which is resized to the size of the entry.
+     *
+     * @return
+     *  E_DECODE if the size is larger than the compressed size allows. (See MAX_DEFLATE_RATIO) @n
+     *  E_OORANGE if the size is larger than the max extract size.
+     */
+    Err extract(std::size_t index, Buffer & output) const;
+    Err extract(std::string const & name, Buffer & output) const;
+
+    Err extractToFile(std::size_t index, std::string const & path) const;
+
+private:
+    Err getData(Entry const & entry, char const ** data) const;
+    static bool isValidSize(Entry const & entry) TBAG_NOEXCEPT;
+    Err parseCentralDirectory();
+};
+
+} // namespace archive
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_ARCHIVE_ZIPINDEXREADER_HPP__
+
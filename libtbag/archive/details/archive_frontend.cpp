@@ -117,6 +117,11 @@ int _archive_write_set_filter_option(void * a, char const * m, char const * o, c
     return archive_write_set_filter_option(cast_archive(a), m, o, v);
 }
 
+int _archive_write_set_options(void * a, char const * opts)
+{
+    return archive_write_set_options(cast_archive(a), opts);
+}
+
 int _archive_write_set_format_by_name(void * a, char const * name)
 {
     return archive_write_set_format_by_name(cast_archive(a), name);
@@ -51,6 +51,7 @@ int    _archive_write_header                 (void * a, void * e);
 size_t _archive_write_data                   (void * a, void const * buffer, size_t size);
 int    _archive_write_finish_entry           (void * a);
 int    _archive_write_set_filter_option      (void * a, char const * m, char const * o, char const * v);
+int    _archive_write_set_options            (void * a, char const * opts);
 int    _archive_write_set_format_by_name     (void * a, char const * name);
 int    _archive_write_set_bytes_in_last_block(void * a, int bytes_in_last_block);
 int    _archive_write_open_filename          (void * a, char const * filename);
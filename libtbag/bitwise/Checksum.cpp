@@ -3,11 +3,22 @@
  * @brief  Checksum class implementation.
  * @author zer0
  * @date   2018-12-13
+ * @date   2026-10-19 (Add CRC32C)
  */
 
 #include <libtbag/bitwise/Checksum.hpp>
 #include <libtbag/log/Log.hpp>
 
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# include <nmmintrin.h>
+# define TBAG_CHECKSUM_X86_CRC32C
+#elif defined(__ARM_FEATURE_CRC32)
+# include <arm_acle.h>
+# define TBAG_CHECKSUM_ARM_CRC32C
+#endif
+
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
 // -------------------
@@ -23,6 +34,112 @@ uint8_t calcXorChecksum(uint8_t * data, std::size_t size) TBAG_NOEXCEPT
     return sum;
 }
 
+/** Reversed polynomial of CRC-32C. */
+TBAG_CONSTEXPR static uint32_t const CRC32C_POLYNOMIAL = 0x82F63B78u;
+
+struct Crc32cTables
+{
+    uint32_t values[8][256];
+
+    Crc32cTables() TBAG_NOEXCEPT
+    {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1) ? ((crc >> 1) ^ CRC32C_POLYNOMIAL) : (crc >> 1);
+            }
+            values[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i) {
+            for (int t = 1; t < 8; ++t) {
+                values[t][i] = (values[t-1][i] >> 8) ^ values[0][values[t-1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+static uint32_t calcCrc32cSoftware(uint8_t const * data, std::size_t size, uint32_t crc) TBAG_NOEXCEPT
+{
+    static Crc32cTables const TABLES;
+    auto const & t = TABLES.values;
+
+    // Slicing-by-8. The words are read as little-endian.
+    for (; size >= 8; size -= 8, data += 8) {
+        uint32_t const LO = crc ^ (static_cast<uint32_t>(data[0])       |
+                                   static_cast<uint32_t>(data[1]) <<  8 |
+                                   static_cast<uint32_t>(data[2]) << 16 |
+                                   static_cast<uint32_t>(data[3]) << 24);
+        crc = t[7][LO & 0xFF] ^ t[6][(LO >> 8) & 0xFF] ^ t[5][(LO >> 16) & 0xFF] ^ t[4][LO >> 24] ^
+              t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+    }
+    for (; size > 0; --size, ++data) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xFF];
+    }
+    return crc;
+}
+
+#if defined(TBAG_CHECKSUM_X86_CRC32C)
+__attribute__((target("sse4.2")))
+static uint32_t calcCrc32cHardware(uint8_t const * data, std::size_t size, uint32_t crc) TBAG_NOEXCEPT
+{
+# if defined(__x86_64__)
+    uint64_t crc64 = crc;
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+        uint64_t word;
+        ::memcpy(&word, data, sizeof(uint64_t));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<uint32_t>(crc64);
+# endif
+    for (; size >= sizeof(uint32_t); size -= sizeof(uint32_t), data += sizeof(uint32_t)) {
+        uint32_t word;
+        ::memcpy(&word, data, sizeof(uint32_t));
+        crc = _mm_crc32_u32(crc, word);
+    }
+    for (; size > 0; --size, ++data) {
+        crc = _mm_crc32_u8(crc, *data);
+    }
+    return crc;
+}
+#elif defined(TBAG_CHECKSUM_ARM_CRC32C)
+static uint32_t calcCrc32cHardware(uint8_t const * data, std::size_t size, uint32_t crc) TBAG_NOEXCEPT
+{
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+        uint64_t word;
+        ::memcpy(&word, data, sizeof(uint64_t));
+        crc = __crc32cd(crc, word);
+    }
+    for (; size > 0; --size, ++data) {
+        crc = __crc32cb(crc, *data);
+    }
+    return crc;
+}
+#endif
+
+bool isHardwareCrc32c() TBAG_NOEXCEPT
+{
+#if defined(TBAG_CHECKSUM_X86_CRC32C)
+    static bool const SUPPORTED = __builtin_cpu_supports("sse4.2");
+    return SUPPORTED;
+#elif defined(TBAG_CHECKSUM_ARM_CRC32C)
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t calcCrc32c(void const * data, std::size_t size, uint32_t crc) TBAG_NOEXCEPT
+{
+    auto const * bytes = static_cast<uint8_t const *>(data);
+    crc = ~crc;
+#if defined(TBAG_CHECKSUM_X86_CRC32C) || defined(TBAG_CHECKSUM_ARM_CRC32C)
+    if (isHardwareCrc32c()) {
+        return ~calcCrc32cHardware(bytes, size, crc);
+    }
+#endif
+    return ~calcCrc32cSoftware(bytes, size, crc);
+}
+
 } // namespace bitwise
 
 // --------------------
@@ -3,6 +3,7 @@
  * @brief  Checksum class prototype.
  * @author zer0
  * @date   2018-12-13
+ * @date   2026-10-19 (Add CRC32C)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_BITWISE_CHECKSUM_HPP__
@@ -27,6 +28,21 @@ namespace bitwise {
 
 TBAG_API uint8_t calcXorChecksum(uint8_t * data, std::size_t size) TBAG_NOEXCEPT;
 
+/**
+ * CRC-32C (Castagnoli) checksum.
+ *
+ * @param[in] crc
+ *  The checksum of the previous data, so the checksum can be calculated incrementally.
+ *
+ * @remarks
+ *  The SSE4.2 or ARMv8 CRC instructions are used if the CPU supports them,
+ *  otherwise the slicing-by-8 tables are used.
+ */
+TBAG_API uint32_t calcCrc32c(void const * data, std::size_t size, uint32_t crc = 0) TBAG_NOEXCEPT;
+
+/** The CRC instructions are used by calcCrc32c(). */
+TBAG_API bool isHardwareCrc32c() TBAG_NOEXCEPT;
+
 } // namespace bitwise
 
 // --------------------
@@ -3,9 +3,12 @@
  * @brief  Box class implementation.
  * @author zer0
  * @date   2019-05-16
+ * @date   2026-10-19 (Decode the packet file)
+ * @date   2026-10-19 (Fast JSON encoder/decoder)
  */
 
 #include <libtbag/box/Box.hpp>
+#include <libtbag/box/details/box_json.hpp>
 #include <libtbag/log/Log.hpp>
 #include <libtbag/Noncopyable.hpp>
 #include <libtbag/string/StringUtils.hpp>
@@ -360,6 +363,20 @@ Err Box::decode(Buffer const & buffer, std::size_t * computed_size)
     return decode(buffer.data(), buffer.size(), computed_size);
 }
 
+Err Box::decodeFile(std::string const & path, Parser const & parser, std::size_t * computed_size)
+{
+    if (!exists()) {
+        return E_EXPIRED;
+    }
+    return parser.parseFile(path, _base.get(), computed_size);
+}
+
+Err Box::decodeFile(std::string const & path, std::size_t * computed_size)
+{
+    Parser parser;
+    return decodeFile(path, parser, computed_size);
+}
+
 Err Box::encodeToJson(Builder & builder, std::string & json) const
 {
     auto const code = encode(builder);
@@ -372,8 +389,10 @@ Err Box::encodeToJson(Builder & builder, std::string & json) const
 
 Err Box::encodeToJson(std::string & json) const
 {
-    Builder builder;
-    return encodeToJson(builder, json);
+    if (!exists()) {
+        return E_EXPIRED;
+    }
+    return box_encode_json(_base.get(), json);
 }
 
 Err Box::decodeFromJson(char const * json, std::size_t size, Parser const & parser)
@@ -386,8 +405,10 @@ Err Box::decodeFromJson(char const * json, std::size_t size, Parser const & pars
 
 Err Box::decodeFromJson(char const * json, std::size_t size)
 {
-    Parser parser;
-    return decodeFromJson(json, size, parser);
+    if (!exists()) {
+        return E_EXPIRED;
+    }
+    return box_decode_json(json, size, _base.get());
 }
 
 Err Box::decodeFromJson(std::string const & json)
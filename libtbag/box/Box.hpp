@@ -3,6 +3,8 @@
  * @brief  Box class prototype.
  * @author zer0
  * @date   2019-05-16
+ * @date   2026-10-19 (Fill the random values of the CPU box by the bulk generator)
+ * @date   2026-10-19 (Decode the packet file)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_BOX_BOX_HPP__
@@ -24,6 +26,7 @@
 #include <libtbag/box/BoxPacket.hpp>
 #include <libtbag/box/BoxTraits.hpp>
 #include <libtbag/dom/json/JsonUtils.hpp>
+#include <libtbag/random/Random.hpp>
 
 #include <cstddef>
 #include <cstdlib>
@@ -705,6 +708,10 @@ public:
     Err decode(void const * buffer, std::size_t size, std::size_t * computed_size = nullptr);
     Err decode(Buffer const & buffer, std::size_t * computed_size = nullptr);
 
+    /** Decode the packet file without copying it. (memory mapped) */
+    Err decodeFile(std::string const & path, Parser const & parser, std::size_t * computed_size = nullptr);
+    Err decodeFile(std::string const & path, std::size_t * computed_size = nullptr);
+
 public:
     Err encodeToJson(Builder & builder, std::string & json) const;
     Err encodeToJson(std::string & json) const;
@@ -939,17 +946,60 @@ public:
               typename EngineT = std::mt19937>
     Err rand(T start, T end, bdev src_device, ui64 const * src_ext)
     {
-        return rand(RangeT(start, end), EngineT(DeviceT()()), src_device, src_ext);
+        // Seeded from the engine of the thread, instead of constructing the std::random_device for each call.
+        // The DeviceT is not used, and is kept for the compatibility of the template parameters.
+        auto const SEED = libtbag::random::getThreadEngine()();
+        return rand(RangeT(start, end), EngineT(static_cast<typename EngineT::result_type>(SEED)), src_device, src_ext);
     }
 
     template <typename T>
     Err rand(T start, T end)
     {
+        if (exists() && _rand_cpu(start, end)) {
+            return E_SUCCESS;
+        }
         auto const src_device = device();
         ui64 const src_ext[TBAG_BOX_EXT_SIZE] = { ext0(), ext1(), ext2(), ext3() };
         return rand(start, end, src_device, src_ext);
     }
 
+    /** Fill the normal distribution. */
+    template <typename T>
+    Err randn(T mean, T stddev)
+    {
+        static_assert(std::is_floating_point<T>::value, "T is not a floating point type.");
+        if (!exists()) {
+            return E_EXPIRED;
+        }
+        if (is_device_cpu() && is_btype_equals<T>(type())) {
+            libtbag::random::fillNormal(data<T>(), size(), mean, stddev);
+            return E_SUCCESS;
+        }
+        return rand(std::normal_distribution<T>(mean, stddev),
+                    libtbag::random::Engine(libtbag::random::getThreadEngine()()));
+    }
+
+private:
+    /** Fill the memory of the same type directly. */
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool>::type
+    _rand_cpu(T start, T end)
+    {
+        if (!is_device_cpu() || !is_btype_equals<T>(type())) {
+            return false;
+        }
+        // Same range as the std::uniform_int_distribution and std::uniform_real_distribution.
+        libtbag::random::fillUniform(data<T>(), size(), start, end);
+        return true;
+    }
+
+    template <typename T>
+    typename std::enable_if<!std::is_arithmetic<T>::value || std::is_same<T, bool>::value, bool>::type
+    _rand_cpu(T, T)
+    {
+        return false;
+    }
+
 public:
     template <typename T, typename ... Args>
     static Box rand(T start, T end, btype type, bdev src_device, ui64 const * src_ext, Args ... args)
@@ -983,6 +1033,19 @@ public:
         return box;
     }
 
+    template <typename T, typename ... Args>
+    static Box randn(T mean, T stddev, Args ... args)
+    {
+        auto box = array<T>(std::forward<Args>(args) ...);
+        if (!box) {
+            return Box(nullptr);
+        }
+        if (isFailure(box.randn(mean, stddev))) {
+            return Box(nullptr);
+        }
+        return box;
+    }
+
 private:
     using BoxCompareMethod = Err (box_data::*)(box_data const *, box_data *) const;
     ErrBox comp(Box const & box, BoxCompareMethod m) const;
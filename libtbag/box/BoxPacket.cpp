@@ -5,6 +5,7 @@
  * @date   2018-10-24
  * @date   2018-11-07 (Rename: BoxPacket -> BoxPacket)
  * @date   2019-05-19 (Move: libtbag::proto::BoxPacket -> libtbag::box::BoxPacket)
+ * @date   2026-10-19 (Parse the packet file from the memory mapping)
  */
 
 #include <libtbag/config.h>
@@ -51,6 +52,7 @@ TBAG_POP_MACRO(max);
 #include <libtbag/log/Log.hpp>
 #include <libtbag/debug/Assert.hpp>
 #include <libtbag/string/StringUtils.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
 
 #include <cassert>
 #include <algorithm>
@@ -607,6 +609,16 @@ Err BoxPacketParser::parseJson(std::string const & json_text, box_data * box) co
     return _impl->parseJson(json_text, box).first;
 }
 
+Err BoxPacketParser::parseFile(std::string const & path, box_data * box, std::size_t * computed_size) const
+{
+    libtbag::filesystem::MappedFile file;
+    auto const code = libtbag::filesystem::readFile(path, file);
+    if (isFailure(code)) {
+        return code;
+    }
+    return parse(file.data(), file.size(), box, computed_size);
+}
+
 // ---------
 // BoxPacket
 // ---------
@@ -5,6 +5,7 @@
  * @date   2018-10-24
  * @date   2018-11-07 (Rename: BoxPacket -> BoxPacket)
  * @date   2019-05-19 (Move: libtbag::proto::BoxPacket -> libtbag::box::BoxPacket)
+ * @date   2026-10-19 (Parse the packet file from the memory mapping)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_BOX_BOXPACKET_HPP__
@@ -133,6 +134,9 @@ public:
 public:
     Err parse(void const * buffer, std::size_t size, box_data * box, std::size_t * computed_size) const;
     Err parseJson(std::string const & json_text, box_data * box) const;
+
+    /** Parse the memory mapped packet file. */
+    Err parseFile(std::string const & path, box_data * box, std::size_t * computed_size = nullptr) const;
 };
 
 /**
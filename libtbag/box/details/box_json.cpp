@@ -0,0 +1,669 @@
+/**
+ * @file   box_json.cpp
+ * @brief  box_json class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Keep the non-finite numbers and decode to the box directly)
+ */
+
+#include <libtbag/box/details/box_json.hpp>
+#include <libtbag/debug/Assert.hpp>
+#include <libtbag/dom/json/JsonWriter.hpp>
+#include <libtbag/dom/json/details/JsonTokenizer.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace box     {
+namespace details {
+
+using JsonWriter = libtbag::dom::json::JsonWriter;
+using JsonNumber = libtbag::dom::json::details::JsonNumber;
+
+struct box_json_type_name
+{
+    btype type;
+    char const * name;
+};
+
+/** Names of the AnyArr union of the box.fbs */
+static box_json_type_name const BOX_JSON_TYPE_NAMES[] = {
+        { BT_BOOL      , "BoolArr"       },
+        { BT_INT8      , "ByteArr"       },
+        { BT_INT16     , "ShortArr"      },
+        { BT_INT32     , "IntArr"        },
+        { BT_INT64     , "LongArr"       },
+        { BT_UINT8     , "UbyteArr"      },
+        { BT_UINT16    , "UshortArr"     },
+        { BT_UINT32    , "UintArr"       },
+        { BT_UINT64    , "UlongArr"      },
+        { BT_FLOAT32   , "FloatArr"      },
+        { BT_FLOAT64   , "DoubleArr"     },
+        { BT_COMPLEX64 , "Complex64Arr"  },
+        { BT_COMPLEX128, "Complex128Arr" },
+};
+
+static char const * const BOX_JSON_EXT_KEYS[TBAG_BOX_EXT_SIZE] = { "ext0", "ext1", "ext2", "ext3" };
+
+static char const * box_json_get_type_name(btype type) TBAG_NOEXCEPT
+{
+    for (auto const & item : BOX_JSON_TYPE_NAMES) {
+        if (item.type == type) {
+            return item.name;
+        }
+    }
+    return nullptr;
+}
+
+static btype box_json_get_type(char const * name, std::size_t size) TBAG_NOEXCEPT
+{
+    for (auto const & item : BOX_JSON_TYPE_NAMES) {
+        if (::strlen(item.name) == size && ::memcmp(item.name, name, size) == 0) {
+            return item.type;
+        }
+    }
+    return BT_NONE;
+}
+
+template <typename T>
+static void box_json_write_arr(JsonWriter & writer, void const * data, ui32 size)
+{
+    auto const * begin = static_cast<T const *>(data);
+    writer.array(begin, begin + size);
+}
+
+template <typename T>
+static void box_json_write_complex_arr(JsonWriter & writer, void const * data, ui32 size)
+{
+    auto const * begin = static_cast<std::complex<T> const *>(data);
+    writer.startArray();
+    for (ui32 i = 0; i < size; ++i) {
+        writer.startObject();
+        writer.key("real", 4).value(begin[i].real());
+        writer.key("imag", 4).value(begin[i].imag());
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+Err box_encode_json(box_data const * box, std::string & json)
+{
+    if (box == nullptr) {
+        return E_EXPIRED;
+    }
+    if (box->device != BD_CPU) {
+        return E_DEVICE;
+    }
+
+    // Most elements take less than 8 bytes of the text.
+    JsonWriter writer(64 + (box->size * 8) + (box->rank * 4) + (box->info_size * 4));
+    // Same as the flatbuffers, so the NaN and Inf are kept.
+    writer.setNonFinite();
+    writer.startObject();
+
+    for (auto i = 0; i < TBAG_BOX_EXT_SIZE; ++i) {
+        // The ext fields are 'long' in the schema, and the default values are omitted.
+        if (box->ext[i] != 0) {
+            writer.key(BOX_JSON_EXT_KEYS[i], 4).value(static_cast<si64>(box->ext[i]));
+        }
+    }
+
+    // The dims is written before the data, so the decoder writes the elements to the box directly.
+    if (box->dims != nullptr && box->rank >= 1) {
+        writer.key("dims", 4).array(box->dims, box->dims + box->rank);
+    }
+
+    auto const * type_name = box_json_get_type_name(box->type);
+    if (type_name != nullptr && box->data != nullptr && box->size >= 1) {
+        writer.key("data_type", 9).value(type_name);
+        writer.key("data", 4).startObject().key("arr", 3);
+        // clang-format off
+        switch (box->type) {
+        case BT_BOOL      : box_json_write_arr<bool>(writer, box->data, box->size); break;
+        case BT_INT8      : box_json_write_arr<si8 >(writer, box->data, box->size); break;
+        case BT_INT16     : box_json_write_arr<si16>(writer, box->data, box->size); break;
+        case BT_INT32     : box_json_write_arr<si32>(writer, box->data, box->size); break;
+        case BT_INT64     : box_json_write_arr<si64>(writer, box->data, box->size); break;
+        case BT_UINT8     : box_json_write_arr<ui8 >(writer, box->data, box->size); break;
+        case BT_UINT16    : box_json_write_arr<ui16>(writer, box->data, box->size); break;
+        case BT_UINT32    : box_json_write_arr<ui32>(writer, box->data, box->size); break;
+        case BT_UINT64    : box_json_write_arr<ui64>(writer, box->data, box->size); break;
+        case BT_FLOAT32   : box_json_write_arr<fp32>(writer, box->data, box->size); break;
+        case BT_FLOAT64   : box_json_write_arr<fp64>(writer, box->data, box->size); break;
+        case BT_COMPLEX64 : box_json_write_complex_arr<fp32>(writer, box->data, box->size); break;
+        case BT_COMPLEX128: box_json_write_complex_arr<fp64>(writer, box->data, box->size); break;
+        default:
+            TBAG_INACCESSIBLE_BLOCK_ASSERT();
+        }
+        // clang-format on
+        writer.endObject();
+    }
+
+    if (box->info != nullptr && box->info_size >= 1) {
+        writer.key("info", 4).array(box->info, box->info + box->info_size);
+    }
+
+    writer.endObject();
+    json = writer.release();
+    return E_SUCCESS;
+}
+
+/**
+ * Decode the tokens of the box JSON.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  If the <code>data_type</code> and <code>dims</code> are read before the <code>arr</code>,
+ *  the box is resized and the elements are written to the box directly. @n
+ *  If only the type is known, the elements are written to the buffer and copied at the end. @n
+ *  Otherwise, the position of the elements are kept until the type is known. @n
+ *  The <code>nan</code>, <code>inf</code> and <code>-inf</code> tokens are accepted for the floating-point types.
+ */
+struct box_json_decoder
+{
+    enum class state
+    {
+        ROOT_BEGIN,
+        ROOT_KEY,
+        ROOT_VALUE,
+        DATA_KEY,
+        DATA_VALUE,
+        ARR,
+        COMPLEX_KEY,
+        COMPLEX_VALUE,
+        DIMS,
+        INFO,
+        DONE,
+    };
+
+    enum class field
+    {
+        NONE,
+        EXT,
+        DATA_TYPE,
+        DATA,
+        DIMS,
+        INFO,
+    };
+
+    enum class token : ui8
+    {
+        NUMBER,
+        INTEGER,
+        NON_FINITE,
+        TRUE_VALUE,
+        FALSE_VALUE,
+    };
+
+    /** Element which is read before the type. */
+    struct pending_element
+    {
+        ui32 index;
+        token kind;
+        char const * begin;
+        char const * end;
+    };
+
+    box_data * box = nullptr;
+
+    /** If true, the elements are written to the box. */
+    bool direct = false;
+
+    /** Number of the scalars of the box. The complex element has two scalars. */
+    std::size_t direct_capacity = 0;
+
+    state current = state::ROOT_BEGIN;
+    field current_field = field::NONE;
+    std::size_t ext_index = 0;
+
+    /** Index of the complex part. (0: real, 1: imag) */
+    ui32 complex_part = 0;
+
+    btype type = BT_NONE;
+    ui32 type_byte = 0;
+    ui32 element_count = 0;
+    bool exists_data = false;
+
+    ui64 ext[TBAG_BOX_EXT_SIZE] = {0,};
+    std::vector<ui8> data;
+    std::vector<pending_element> pending;
+    std::vector<ui32> dims;
+    std::vector<ui8> info;
+
+    std::string key_buffer;
+    Err code = E_SUCCESS;
+
+    explicit box_json_decoder(box_data * b) : box(b)
+    { /* EMPTY. */ }
+
+    bool fail(Err c = E_PARSING)
+    {
+        code = c;
+        return false;
+    }
+
+    static bool isFloatingPoint(btype t) TBAG_NOEXCEPT
+    {
+        return t == BT_FLOAT32 || t == BT_FLOAT64 || t == BT_COMPLEX64 || t == BT_COMPLEX128;
+    }
+
+    ui32 getTotalDims() const TBAG_NOEXCEPT
+    {
+        ui32 total = 0;
+        for (auto const dim : dims) {
+            total += dim;
+        }
+        return total;
+    }
+
+    /** Resize the box before the elements, if the type and dims are known. */
+    bool prepareDirect()
+    {
+        if (direct || type == BT_NONE || getTotalDims() == 0 || element_count != 0 || !data.empty()) {
+            return true;
+        }
+        auto const RESIZE_CODE = box->resize_dims(type, BD_CPU, ext, static_cast<ui32>(dims.size()), dims.data());
+        if (isFailure(RESIZE_CODE)) {
+            return fail(RESIZE_CODE);
+        }
+        direct = true;
+        direct_capacity = static_cast<std::size_t>(box->size);
+        if (type == BT_COMPLEX64 || type == BT_COMPLEX128) {
+            direct_capacity *= 2;
+        }
+        return true;
+    }
+
+    bool setType(btype t)
+    {
+        type = t;
+        type_byte = box_get_type_byte(t);
+        assert(type_byte >= 1);
+        for (auto const & element : pending) {
+            if (!store(element.index, element.kind, element.begin, element.end)) {
+                return false;
+            }
+        }
+        pending.clear();
+        return true;
+    }
+
+    template <typename T>
+    static T toValue(token kind, char const * begin, char const * end)
+    {
+        switch (kind) {
+        case token::TRUE_VALUE:  return static_cast<T>(1);
+        case token::FALSE_VALUE: return static_cast<T>(0);
+        default: break;
+        }
+        auto const NUMBER = libtbag::dom::json::details::decodeJsonNumber(begin, end, kind == token::INTEGER);
+        switch (NUMBER.type) {
+        case JsonNumber::Type::INT64:  return static_cast<T>(NUMBER.i);
+        case JsonNumber::Type::UINT64: return static_cast<T>(NUMBER.u);
+        default:                       return static_cast<T>(NUMBER.d);
+        }
+    }
+
+    static bool isUnsigned(token kind, char const * begin, char const * end, ui64 max)
+    {
+        if (kind != token::INTEGER) {
+            return false;
+        }
+        auto const NUMBER = libtbag::dom::json::details::decodeJsonNumber(begin, end, true);
+        switch (NUMBER.type) {
+        case JsonNumber::Type::INT64:  return NUMBER.i >= 0 && static_cast<ui64>(NUMBER.i) <= max;
+        case JsonNumber::Type::UINT64: return NUMBER.u <= max;
+        default:                       return false;
+        }
+    }
+
+    template <typename T>
+    void write(ui32 index, T value)
+    {
+        if (direct) {
+            // The elements out of the dims are ignored.
+            if (index < direct_capacity) {
+                static_cast<T*>(box->data)[index] = value;
+            }
+            return;
+        }
+        auto const OFFSET = static_cast<std::size_t>(index) * sizeof(T);
+        if (data.size() < OFFSET + sizeof(T)) {
+            data.resize(OFFSET + sizeof(T));
+        }
+        ::memcpy(data.data() + OFFSET, &value, sizeof(T));
+    }
+
+    /**
+     * @param[in] index
+     *      Index of the scalar. The complex element has two scalars.
+     */
+    bool store(ui32 index, token kind, char const * begin, char const * end)
+    {
+        if (type == BT_NONE) {
+            pending.push_back(pending_element{index, kind, begin, end});
+            return true;
+        }
+        if (kind == token::NON_FINITE && !isFloatingPoint(type)) {
+            return fail();
+        }
+        // clang-format off
+        switch (type) {
+        case BT_BOOL      : write(index, toValue<bool>(kind, begin, end)); break;
+        case BT_INT8      : write(index, toValue<si8 >(kind, begin, end)); break;
+        case BT_INT16     : write(index, toValue<si16>(kind, begin, end)); break;
+        case BT_INT32     : write(index, toValue<si32>(kind, begin, end)); break;
+        case BT_INT64     : write(index, toValue<si64>(kind, begin, end)); break;
+        case BT_UINT8     : write(index, toValue<ui8 >(kind, begin, end)); break;
+        case BT_UINT16    : write(index, toValue<ui16>(kind, begin, end)); break;
+        case BT_UINT32    : write(index, toValue<ui32>(kind, begin, end)); break;
+        case BT_UINT64    : write(index, toValue<ui64>(kind, begin, end)); break;
+        case BT_FLOAT32   : write(index, toValue<fp32>(kind, begin, end)); break;
+        case BT_FLOAT64   : write(index, toValue<fp64>(kind, begin, end)); break;
+        case BT_COMPLEX64 : write(index, toValue<fp32>(kind, begin, end)); break;
+        case BT_COMPLEX128: write(index, toValue<fp64>(kind, begin, end)); break;
+        default:
+            return fail(E_ENOMSG);
+        }
+        // clang-format on
+        return true;
+    }
+
+    bool onScalar(token kind, char const * begin, char const * end)
+    {
+        switch (current) {
+        case state::ROOT_VALUE:
+            if (current_field != field::EXT || (kind != token::NUMBER && kind != token::INTEGER)) {
+                return fail();
+            }
+            // The ext fields are 'long', so the negative values are kept in two's complement.
+            ext[ext_index] = toValue<ui64>(kind, begin, end);
+            current = state::ROOT_KEY;
+            return true;
+        case state::ARR:
+            if (type == BT_COMPLEX64 || type == BT_COMPLEX128) {
+                return fail();
+            }
+            return store(element_count++, kind, begin, end);
+        case state::COMPLEX_VALUE:
+            current = state::COMPLEX_KEY;
+            if (kind == token::TRUE_VALUE || kind == token::FALSE_VALUE) {
+                return fail();
+            }
+            return store(element_count * 2 + complex_part, kind, begin, end);
+        case state::DIMS:
+            if (!isUnsigned(kind, begin, end, std::numeric_limits<ui32>::max())) {
+                return fail();
+            }
+            dims.push_back(toValue<ui32>(kind, begin, end));
+            return true;
+        case state::INFO:
+            if (!isUnsigned(kind, begin, end, std::numeric_limits<ui8>::max())) {
+                return fail();
+            }
+            info.push_back(toValue<ui8>(kind, begin, end));
+            return true;
+        default:
+            return fail();
+        }
+    }
+
+    bool onNull()
+    {
+        if (current != state::ROOT_VALUE) {
+            return fail();
+        }
+        current = state::ROOT_KEY;
+        return true;
+    }
+
+    bool onBool(bool value)
+    {
+        return onScalar(value ? token::TRUE_VALUE : token::FALSE_VALUE, nullptr, nullptr);
+    }
+
+    bool onNumber(char const * begin, char const * end, bool integer)
+    {
+        if (integer) {
+            return onScalar(token::INTEGER, begin, end);
+        }
+        // The numbers end with the digit, but the 'nan' and 'inf' do not.
+        assert(begin != end);
+        auto const LAST = *(end - 1);
+        return onScalar((LAST == 'n' || LAST == 'f') ? token::NON_FINITE : token::NUMBER, begin, end);
+    }
+
+    static bool equals(char const * text, std::size_t size, char const * expected, std::size_t expected_size)
+    {
+        return size == expected_size && ::memcmp(text, expected, size) == 0;
+    }
+
+    bool onKey(char const * text, std::size_t size)
+    {
+        switch (current) {
+        case state::ROOT_KEY:
+            current = state::ROOT_VALUE;
+            if (size == 4 && ::memcmp(text, "ext", 3) == 0 && '0' <= text[3] && text[3] <= '3') {
+                current_field = field::EXT;
+                ext_index = static_cast<std::size_t>(text[3] - '0');
+            } else if (equals(text, size, "data_type", 9)) {
+                current_field = field::DATA_TYPE;
+            } else if (equals(text, size, "data", 4)) {
+                current_field = field::DATA;
+            } else if (equals(text, size, "dims", 4)) {
+                current_field = field::DIMS;
+            } else if (equals(text, size, "info", 4)) {
+                current_field = field::INFO;
+            } else {
+                return fail();
+            }
+            return true;
+        case state::DATA_KEY:
+            if (!equals(text, size, "arr", 3)) {
+                return fail();
+            }
+            current = state::DATA_VALUE;
+            return true;
+        case state::COMPLEX_KEY:
+            if (equals(text, size, "real", 4)) {
+                complex_part = 0;
+            } else if (equals(text, size, "imag", 4)) {
+                complex_part = 1;
+            } else {
+                return fail();
+            }
+            current = state::COMPLEX_VALUE;
+            return true;
+        default:
+            return fail();
+        }
+    }
+
+    bool onString(char const * begin, char const * end, bool escaped, bool key)
+    {
+        char const * text = begin;
+        auto size = static_cast<std::size_t>(end - begin);
+        if (escaped) {
+            if (!libtbag::dom::json::details::decodeJsonString(begin, end, key_buffer)) {
+                return fail();
+            }
+            text = key_buffer.data();
+            size = key_buffer.size();
+        }
+        if (key) {
+            return onKey(text, size);
+        }
+        if (current != state::ROOT_VALUE || current_field != field::DATA_TYPE) {
+            return fail();
+        }
+        current = state::ROOT_KEY;
+        if (equals(text, size, "NONE", 4)) {
+            return true;
+        }
+        auto const TYPE = box_json_get_type(text, size);
+        if (TYPE == BT_NONE) {
+            return fail(E_ENOMSG);
+        }
+        return setType(TYPE);
+    }
+
+    bool onStartObject()
+    {
+        switch (current) {
+        case state::ROOT_BEGIN:
+            current = state::ROOT_KEY;
+            return true;
+        case state::ROOT_VALUE:
+            if (current_field != field::DATA) {
+                return fail();
+            }
+            exists_data = true;
+            current = state::DATA_KEY;
+            return true;
+        case state::ARR:
+            if (type != BT_NONE && type != BT_COMPLEX64 && type != BT_COMPLEX128) {
+                return fail();
+            }
+            current = state::COMPLEX_KEY;
+            return true;
+        default:
+            return fail();
+        }
+    }
+
+    bool onEndObject(std::size_t UNUSED_PARAM(member_count))
+    {
+        switch (current) {
+        case state::ROOT_KEY:
+            current = state::DONE;
+            return true;
+        case state::DATA_KEY:
+            current = state::ROOT_KEY;
+            return true;
+        case state::COMPLEX_KEY:
+            ++element_count;
+            current = state::ARR;
+            return true;
+        default:
+            return fail();
+        }
+    }
+
+    bool onStartArray()
+    {
+        if (current == state::DATA_VALUE) {
+            current = state::ARR;
+            return prepareDirect();
+        }
+        if (current != state::ROOT_VALUE) {
+            return fail();
+        }
+        if (current_field == field::DIMS) {
+            if (direct) {
+                // The box is already resized with the previous dims.
+                return fail();
+            }
+            current = state::DIMS;
+        } else if (current_field == field::INFO) {
+            current = state::INFO;
+        } else {
+            return fail();
+        }
+        return true;
+    }
+
+    bool onEndArray(std::size_t UNUSED_PARAM(element_count))
+    {
+        switch (current) {
+        case state::ARR:
+            current = state::DATA_KEY;
+            return true;
+        case state::DIMS:
+        case state::INFO:
+            current = state::ROOT_KEY;
+            return true;
+        default:
+            return fail();
+        }
+    }
+};
+
+Err box_decode_json(char const * json, std::size_t size, box_data * box)
+{
+    if (box == nullptr) {
+        return E_EXPIRED;
+    }
+    if (json == nullptr && size != 0) {
+        return E_ILLARGS;
+    }
+
+    box_json_decoder decoder(box);
+    libtbag::dom::json::details::JsonTokenizer<box_json_decoder> tokenizer(
+            decoder, json, json + size, libtbag::dom::json::details::JSON_DEFAULT_MAX_DEPTH, true);
+    auto code = tokenizer.run();
+    if (code == E_ECANCELED) {
+        code = decoder.code;
+    }
+    if (isFailure(code)) {
+        return code;
+    }
+    if (decoder.exists_data && decoder.type == BT_NONE && decoder.element_count >= 1) {
+        // The elements without the type.
+        return E_PARSING;
+    }
+
+    if (decoder.direct) {
+        // The ext may be read after the elements.
+        for (auto i = 0; i < TBAG_BOX_EXT_SIZE; ++i) {
+            box->ext[i] = decoder.ext[i];
+        }
+    } else if (decoder.getTotalDims() >= 1 && decoder.type != BT_NONE) {
+        auto const RANK = static_cast<ui32>(decoder.dims.size());
+        code = box->resize_dims(decoder.type, BD_CPU, decoder.ext, RANK, decoder.dims.data());
+        if (isFailure(code)) {
+            return code;
+        }
+        if (decoder.exists_data) {
+            auto const COPY_BYTE = std::min<std::size_t>(decoder.data.size(), box->size * decoder.type_byte);
+            if (COPY_BYTE >= 1) {
+                ::memcpy(box->data, decoder.data.data(), COPY_BYTE);
+            }
+        } else {
+            box->size = 0;
+        }
+    } else {
+        box->type = BT_NONE;
+        box->device = BD_CPU;
+        box->ext[0] = decoder.ext[0];
+        box->ext[1] = decoder.ext[1];
+        box->ext[2] = decoder.ext[2];
+        box->ext[3] = decoder.ext[3];
+        box->rank = 0;
+        box->size = 0;
+    }
+
+    if (!decoder.info.empty()) {
+        box->checked_assign_info_buffer(decoder.info.data(), static_cast<ui32>(decoder.info.size()));
+    } else {
+        box->info_size = 0;
+    }
+    return E_SUCCESS;
+}
+
+} // namespace details
+} // namespace box
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,57 @@
+/**
+ * @file   box_json.hpp
+ * @brief  box_json class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_BOX_DETAILS_BOX_JSON_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_BOX_DETAILS_BOX_JSON_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/box/details/box_api.hpp>
+
+#include <string>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace box     {
+namespace details {
+
+/**
+ * Write the box to the JSON text, without the flatbuffers builder.
+ *
+ * @remarks
+ *  The text has the same fields as the JSON of the BoxPacketBuilder. (e.g. <code>data_type</code>)
+ *  The floating-point numbers are written as the shortest text which is read back to the same value.
+ */
+TBAG_API Err box_encode_json(box_data const * box, std::string & json);
+
+/**
+ * Read the JSON text of the box, without the flatbuffers parser.
+ *
+ * @remarks
+ *  The elements of the <code>arr</code> are decoded to the buffer of the type while the text is scanned,
+ *  so the document of the text is not built. @n
+ *  The fields can be placed in any order.
+ */
+TBAG_API Err box_decode_json(char const * json, std::size_t size, box_data * box);
+
+} // namespace details
+} // namespace box
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_BOX_DETAILS_BOX_JSON_HPP__
+
@@ -0,0 +1,101 @@
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_CONFIG_EX_H__
+#define __INCLUDE_LIBTBAG__LIBTBAG_CONFIG_EX_H__
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+/* Define to 1 if you have the <netinet/in.h> header file. */
+#define TBAG_HAVE_NETINET_IN_H
+
+/* Define to 1 if you have the <arpa/inet.h> header file. */
+#define TBAG_HAVE_ARPA_INET_H
+
+/* Define to 1 if you have the <sys/syscall.h> header file. */
+#define TBAG_HAVE_SYS_SYSCALL_H
+
+/* Define to 1 if you have the <sys/sysctl.h> header file. */
+/* #undef TBAG_HAVE_SYS_SYSCTL_H */
+
+/* Define to 1 if you have the <sys/statvfs.h> header file. */
+#define TBAG_HAVE_SYS_STATVFS_H
+
+/* Define to 1 if you have the <sys/mman.h> header file. */
+#define TBAG_HAVE_SYS_MMAN_H
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define TBAG_HAVE_SYS_TYPES_H
+
+/* Define to 1 if you have the <syscall.h> header file. */
+#define TBAG_HAVE_SYSCALL_H
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define TBAG_HAVE_UNISTD_H
+
+/* Define to 1 if you have the <dlfcn.h> header file. */
+#define TBAG_HAVE_DLFCN_H
+
+/* Define to 1 if you have the <execinfo.h> header file. */
+#define TBAG_HAVE_EXECINFO_H
+
+/* Define to 1 if you have the <unwind.h> header file. */
+#define TBAG_HAVE_UNWIND_H
+
+/* Define to 1 if you have the <libunwind.h> header file. */
+/* #undef TBAG_HAVE_LIBUNWIND_H */
+
+/* Define to 1 if you have the <windows.h> header file. */
+/* #undef TBAG_HAVE_WINDOWS_H */
+
+/* Define to 1 if you have the <dbgeng.h> header file. */
+/* #undef TBAG_HAVE_DBGENG_H */
+
+/* Define to 1 if you have the <intrin.h> header file. */
+/* #undef TBAG_HAVE_INTRIN_H */
+
+/* Define to 1 if you have the <cpuid.h> header file. */
+#define TBAG_HAVE_CPUID_H
+
+/* Define to 1 if you have the <endian.h> header file. */
+#define TBAG_HAVE_ENDIAN_H
+
+/* COM library initialized successfully. */
+/* #undef TBAG_HAVE_COINITIALIZEEX_FUNC */
+
+/* Define to 1 if you have the 'preadv' method. */
+/* #undef TBAG_HAVE_PREADV_FUNC */
+
+/* Define to 1 if you have the 'readv' method. */
+/* #undef TBAG_HAVE_READV_FUNC */
+
+/* Thread library */
+/* #undef TBAG_USE_SPROC */
+/* #undef TBAG_USE_WIN32_THREADS */
+#define TBAG_USE_PTHREADS
+/* #undef TBAG_USE_HP_PTHREADS */
+
+/* [SIMDPP] Instruction flags. */
+#define TBAG_SIMDPP_RUNNABLE_ARCH_X86_SSE2
+#define TBAG_SIMDPP_RUNNABLE_ARCH_X86_SSE3
+#define TBAG_SIMDPP_RUNNABLE_ARCH_X86_SSSE3
+#define TBAG_SIMDPP_RUNNABLE_ARCH_X86_SSE4_1
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_POPCNT_INSN */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_AVX */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_AVX2 */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_FMA3 */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_FMA4 */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_AVX512F */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_AVX512BW */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_AVX512DQ */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_AVX512VL */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_X86_XOP */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_ARM_NEON */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_ARM_NEON_FLT_SP */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_ARM64_NEON */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_MIPS_MSA */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_POWER_ALTIVEC */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_POWER_VSX_206 */
+/* #undef TBAG_SIMDPP_RUNNABLE_ARCH_POWER_VSX_207 */
+
+#endif /* __INCLUDE_LIBTBAG__LIBTBAG_CONFIG_EX_H__ */
+
@@ -0,0 +1,54 @@
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_CONFIG_H__
+#define __INCLUDE_LIBTBAG__LIBTBAG_CONFIG_H__
+
+#define LIBTBAG_TITLE_NAME        libtbag
+#define LIBTBAG_TITLE_NAME_UPPER  LIBTBAG
+
+#define LIBTBAG_VERSION_MAJOR  1
+#define LIBTBAG_VERSION_MINOR  1
+#define LIBTBAG_VERSION_PATCH  2
+#define LIBTBAG_VERSION_TWEAK  "2026-10-19_070011"
+
+#define LIBTBAG_VERSION_PACKET_MAJOR  0
+#define LIBTBAG_VERSION_PACKET_MINOR  0
+#define LIBTBAG_VERSION_RELEASE       0
+
+#ifndef NAMESPACE_LIBTBAG
+#define NAMESPACE_LIBTBAG LIBTBAG_TITLE_NAME
+# if defined(__cplusplus)
+#  define NAMESPACE_LIBTBAG_OPEN   namespace NAMESPACE_LIBTBAG {
+#  define NAMESPACE_LIBTBAG_CLOSE  }
+#  define USING_NAMESPACE_LIBTBAG  using namespace NAMESPACE_LIBTBAG;
+# else /* __cplusplus */
+#  define NAMESPACE_LIBTBAG_OPEN
+#  define NAMESPACE_LIBTBAG_CLOSE
+#  define USING_NAMESPACE_LIBTBAG
+# endif /* __cplusplus */
+#endif
+
+#if defined(__cplusplus)
+NAMESPACE_LIBTBAG_OPEN
+NAMESPACE_LIBTBAG_CLOSE
+#endif /* __cplusplus */
+
+#ifndef __TO_STRING_IMP
+#define __TO_STRING_IMP(m) #m
+#endif
+
+#ifndef __TO_STRING
+#define __TO_STRING(x) __TO_STRING_IMP(x)
+#endif
+
+#define LIBTBAG_VERSION_STRING \
+        __TO_STRING(LIBTBAG_VERSION_MAJOR) "." \
+        __TO_STRING(LIBTBAG_VERSION_MINOR) "." \
+        __TO_STRING(LIBTBAG_VERSION_PATCH)
+
+#define LIBTBAG_TITLE_STRING  __TO_STRING(LIBTBAG_TITLE_NAME)
+#define LIBTBAG_TITLE_PREFIX  "[" LIBTBAG_TITLE_STRING "]"
+
+#define LIBTBAG_MAIN_TITLE \
+        LIBTBAG_TITLE_STRING " v" LIBTBAG_VERSION_STRING
+
+#endif /* __INCLUDE_LIBTBAG__LIBTBAG_CONFIG_H__ */
@@ -3,18 +3,25 @@
  * @brief  Base64 class implementation.
  * @author zer0
  * @date   2017-12-07
+ * @date   2026-10-19 (Replace the OpenSSL BIO chain with the table-driven & SIMD codec)
  */
 
 #include <libtbag/crypto/Base64.hpp>
 #include <libtbag/log/Log.hpp>
 
-#include <cstdlib>
+#include <cassert>
 #include <cstring>
-#include <vector>
 
-#include <openssl/bio.h>
-#include <openssl/evp.h>
-#include <openssl/buffer.h>
+#if defined(__AVX2__)
+# include <immintrin.h>
+#endif
+#if defined(__SSSE3__)
+# include <tmmintrin.h>
+#endif
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+# include <arm_neon.h>
+# define TBAG_BASE64_NEON
+#endif
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -22,61 +29,462 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace crypto {
 
-std::size_t getDecodeLength(std::string const & base64)
+TBAG_CONSTEXPR static std::uint8_t const BASE64_INVALID_VALUE = 0xFF;
+
+TBAG_CONSTEXPR static char const BASE64_STANDARD_ALPHABET[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+TBAG_CONSTEXPR static char const BASE64_URL_SAFE_ALPHABET[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+struct Base64DecodeTable
+{
+    std::uint8_t values[256];
+
+    explicit Base64DecodeTable(char const * alphabet) TBAG_NOEXCEPT
+    {
+        ::memset(values, BASE64_INVALID_VALUE, sizeof(values));
+        for (std::uint8_t i = 0; i < 64; ++i) {
+            values[static_cast<std::uint8_t>(alphabet[i])] = i;
+        }
+    }
+};
+
+static char const * getAlphabet(bool url_safe) TBAG_NOEXCEPT
+{
+    return url_safe ? BASE64_URL_SAFE_ALPHABET : BASE64_STANDARD_ALPHABET;
+}
+
+static std::uint8_t const * getDecodeTable(bool url_safe) TBAG_NOEXCEPT
+{
+    static Base64DecodeTable const STANDARD_TABLE(BASE64_STANDARD_ALPHABET);
+    static Base64DecodeTable const URL_SAFE_TABLE(BASE64_URL_SAFE_ALPHABET);
+    return url_safe ? URL_SAFE_TABLE.values : STANDARD_TABLE.values;
+}
+
+static bool isBase64Whitespace(char c) TBAG_NOEXCEPT
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// ---------------
+// SIMD kernels.
+// ---------------
+
+#if defined(__SSSE3__)
+/** 12 bytes -> 16 indices of the alphabet. */
+static inline __m128i encodeReshuffle128(__m128i input) TBAG_NOEXCEPT
+{
+    input = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i const T0 = _mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00));
+    __m128i const T1 = _mm_mulhi_epu16(T0, _mm_set1_epi32(0x04000040));
+    __m128i const T2 = _mm_and_si128(input, _mm_set1_epi32(0x003F03F0));
+    __m128i const T3 = _mm_mullo_epi16(T2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(T1, T3);
+}
+
+/** Indices of the alphabet -> characters. */
+static inline __m128i encodeTranslate128(__m128i indices, bool url_safe) TBAG_NOEXCEPT
+{
+    __m128i const LUT = url_safe ?
+            _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 0, 0) :
+            _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m128i lut_index = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    lut_index = _mm_sub_epi8(lut_index, _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(LUT, lut_index));
+}
+
+/**
+ * 16 characters -> 16 values.
+ *
+ * @return
+ *  false if an invalid character is found.
+ */
+static inline bool decodeTranslate128(__m128i & input, bool url_safe) TBAG_NOEXCEPT
+{
+    // The bits of lut_hi are the classes of the high nibble,
+    // and the bits of lut_lo are the classes in which the low nibble is invalid.
+    __m128i const LUT_LO = url_safe ?
+            _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                          0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x1B) :
+            _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                          0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    __m128i const LUT_HI = url_safe ?
+            _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x20, 0x04, 0x08,
+                          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10) :
+            _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    // The index 1 is the last character of the alphabet.
+    __m128i const LUT_ROLL = url_safe ?
+            _mm_setr_epi8(0, -32, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0) :
+            _mm_setr_epi8(0,  16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m128i const LAST_CHAR = _mm_set1_epi8(url_safe ? '_' : '/');
+    __m128i const MASK_0F = _mm_set1_epi8(0x0F);
+
+    __m128i const HI_NIBBLES = _mm_and_si128(_mm_srli_epi32(input, 4), MASK_0F);
+    __m128i const LO_NIBBLES = _mm_and_si128(input, MASK_0F);
+    __m128i const HI = _mm_shuffle_epi8(LUT_HI, HI_NIBBLES);
+    __m128i const LO = _mm_shuffle_epi8(LUT_LO, LO_NIBBLES);
+    __m128i const VALID = _mm_cmpeq_epi8(_mm_and_si128(LO, HI), _mm_setzero_si128());
+    if (_mm_movemask_epi8(VALID) != 0xFFFF) {
+        return false;
+    }
+
+    __m128i const IS_LAST = _mm_cmpeq_epi8(input, LAST_CHAR);
+    __m128i const ROLL_INDEX = _mm_or_si128(_mm_and_si128(IS_LAST, _mm_set1_epi8(1)),
+                                            _mm_andnot_si128(IS_LAST, HI_NIBBLES));
+    input = _mm_add_epi8(input, _mm_shuffle_epi8(LUT_ROLL, ROLL_INDEX));
+    return true;
+}
+
+/** 16 values -> 12 bytes in the low 12 bytes. */
+static inline __m128i decodeReshuffle128(__m128i values) TBAG_NOEXCEPT
+{
+    __m128i const MERGE_AB_AND_BC = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i const MERGED = _mm_madd_epi16(MERGE_AB_AND_BC, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(MERGED, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+#endif // defined(__SSSE3__)
+
+#if defined(__AVX2__)
+static inline __m256i encodeReshuffle256(__m256i input) TBAG_NOEXCEPT
+{
+    input = _mm256_shuffle_epi8(input, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                                        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m256i const T0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00));
+    __m256i const T1 = _mm256_mulhi_epu16(T0, _mm256_set1_epi32(0x04000040));
+    __m256i const T2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0));
+    __m256i const T3 = _mm256_mullo_epi16(T2, _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(T1, T3);
+}
+
+static inline __m256i encodeTranslate256(__m256i indices, bool url_safe) TBAG_NOEXCEPT
+{
+    __m256i const LUT = url_safe ?
+            _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 0, 0,
+                             65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 0, 0) :
+            _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+                             65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    __m256i lut_index = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    lut_index = _mm256_sub_epi8(lut_index, _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)));
+    return _mm256_add_epi8(indices, _mm256_shuffle_epi8(LUT, lut_index));
+}
+
+static inline bool decodeTranslate256(__m256i & input, bool url_safe) TBAG_NOEXCEPT
+{
+    __m256i const LUT_LO = url_safe ?
+            _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                             0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x1B,
+                             0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                             0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x1B) :
+            _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                             0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                             0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                             0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    __m256i const LUT_HI = url_safe ?
+            _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x20, 0x04, 0x08,
+                             0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                             0x10, 0x10, 0x01, 0x02, 0x04, 0x20, 0x04, 0x08,
+                             0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10) :
+            _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                             0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                             0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                             0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    __m256i const LUT_ROLL = url_safe ?
+            _mm256_setr_epi8(0, -32, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                             0, -32, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0) :
+            _mm256_setr_epi8(0,  16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                             0,  16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    __m256i const LAST_CHAR = _mm256_set1_epi8(url_safe ? '_' : '/');
+    __m256i const MASK_0F = _mm256_set1_epi8(0x0F);
+
+    __m256i const HI_NIBBLES = _mm256_and_si256(_mm256_srli_epi32(input, 4), MASK_0F);
+    __m256i const LO_NIBBLES = _mm256_and_si256(input, MASK_0F);
+    __m256i const HI = _mm256_shuffle_epi8(LUT_HI, HI_NIBBLES);
+    __m256i const LO = _mm256_shuffle_epi8(LUT_LO, LO_NIBBLES);
+    if (!_mm256_testz_si256(LO, HI)) {
+        return false;
+    }
+
+    __m256i const IS_LAST = _mm256_cmpeq_epi8(input, LAST_CHAR);
+    __m256i const ROLL_INDEX = _mm256_blendv_epi8(HI_NIBBLES, _mm256_set1_epi8(1), IS_LAST);
+    input = _mm256_add_epi8(input, _mm256_shuffle_epi8(LUT_ROLL, ROLL_INDEX));
+    return true;
+}
+
+/** 32 values -> 24 bytes in the low 24 bytes. */
+static inline __m256i decodeReshuffle256(__m256i values) TBAG_NOEXCEPT
 {
-    char const BASE64_PADDING_CHAR = '=';
+    __m256i const MERGE_AB_AND_BC = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    __m256i merged = _mm256_madd_epi16(MERGE_AB_AND_BC, _mm256_set1_epi32(0x00011000));
+    merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+}
+#endif // defined(__AVX2__)
+
+/**
+ * Encodes the blocks of 3 bytes.
+ *
+ * @return
+ *  Number of the consumed bytes. (Multiple of 3)
+ */
+static std::size_t encodeBlocks(std::uint8_t const * src, std::size_t size, char * dest, bool url_safe) TBAG_NOEXCEPT
+{
+    std::size_t i = 0;
+    auto * out = reinterpret_cast<std::uint8_t *>(dest);
+
+#if defined(__AVX2__)
+    // The second lane reads 16 bytes from the offset 12.
+    for (; i + 28 <= size; i += 24, out += 32) {
+        __m128i const LO = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        __m128i const HI = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i + 12));
+        __m256i const INPUT = _mm256_inserti128_si256(_mm256_castsi128_si256(LO), HI, 1);
+        __m256i const OUTPUT = encodeTranslate256(encodeReshuffle256(INPUT), url_safe);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), OUTPUT);
+    }
+#endif
+
+#if defined(__SSSE3__)
+    for (; i + 16 <= size; i += 12, out += 16) {
+        __m128i const INPUT = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        __m128i const OUTPUT = encodeTranslate128(encodeReshuffle128(INPUT), url_safe);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), OUTPUT);
+    }
+#elif defined(TBAG_BASE64_NEON)
+    uint8x16x4_t TABLE;
+    for (int t = 0; t < 4; ++t) {
+        TABLE.val[t] = vld1q_u8(reinterpret_cast<std::uint8_t const *>(getAlphabet(url_safe)) + (t * 16));
+    }
+    uint8x16_t const MASK_3F = vdupq_n_u8(0x3F);
+    for (; i + 48 <= size; i += 48, out += 64) {
+        uint8x16x3_t const INPUT = vld3q_u8(src + i);
+        uint8x16x4_t indices;
+        indices.val[0] = vshrq_n_u8(INPUT.val[0], 2);
+        indices.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(INPUT.val[0], 4), vshrq_n_u8(INPUT.val[1], 4)), MASK_3F);
+        indices.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(INPUT.val[1], 2), vshrq_n_u8(INPUT.val[2], 6)), MASK_3F);
+        indices.val[3] = vandq_u8(INPUT.val[2], MASK_3F);
+        uint8x16x4_t output;
+        for (int t = 0; t < 4; ++t) {
+            output.val[t] = vqtbl4q_u8(TABLE, indices.val[t]);
+        }
+        vst4q_u8(out, output);
+    }
+#endif
 
-    if (base64.size() < 2) {
+    char const * alphabet = getAlphabet(url_safe);
+    for (; i + 3 <= size; i += 3, out += 4) {
+        std::uint32_t const VALUE = (static_cast<std::uint32_t>(src[i]) << 16) |
+                                    (static_cast<std::uint32_t>(src[i+1]) << 8) |
+                                    (static_cast<std::uint32_t>(src[i+2]));
+        out[0] = alphabet[(VALUE >> 18) & 0x3F];
+        out[1] = alphabet[(VALUE >> 12) & 0x3F];
+        out[2] = alphabet[(VALUE >>  6) & 0x3F];
+        out[3] = alphabet[(VALUE      ) & 0x3F];
+    }
+    return i;
+}
+
+/** Encodes the last 1 or 2 bytes. */
+static std::size_t encodeTail(std::uint8_t const * src, std::size_t size, char * dest,
+                              bool url_safe, bool padding) TBAG_NOEXCEPT
+{
+    assert(size < 3);
+    if (size == 0) {
         return 0;
     }
 
-    std::size_t length = base64.size();
-    std::size_t padding = 0;
+    char const * alphabet = getAlphabet(url_safe);
+    std::uint32_t value = static_cast<std::uint32_t>(src[0]) << 16;
+    if (size == 2) {
+        value |= static_cast<std::uint32_t>(src[1]) << 8;
+    }
+
+    std::size_t written = 0;
+    dest[written++] = alphabet[(value >> 18) & 0x3F];
+    dest[written++] = alphabet[(value >> 12) & 0x3F];
+    if (size == 2) {
+        dest[written++] = alphabet[(value >> 6) & 0x3F];
+    } else if (padding) {
+        dest[written++] = BASE64_PADDING_CHAR;
+    }
+    if (padding) {
+        dest[written++] = BASE64_PADDING_CHAR;
+    }
+    return written;
+}
+
+/**
+ * Decodes the blocks of 4 valid characters.
+ * Stops at the first block with a whitespace, a padding or an invalid character.
+ *
+ * @return
+ *  Number of the consumed characters. (Multiple of 4)
+ *
+ * @warning
+ *  The SIMD kernels write up to 8 bytes beyond the decoded bytes,
+ *  which is inside the output buffer of (size * 3 / 4) bytes.
+ */
+static std::size_t decodeBlocks(char const * src, std::size_t size, std::uint8_t * dest, bool url_safe) TBAG_NOEXCEPT
+{
+    std::size_t i = 0;
+    auto const * in = reinterpret_cast<std::uint8_t const *>(src);
 
-    char const LAST1 = base64[length - 1];
-    char const LAST2 = base64[length - 2];
+#if defined(__AVX2__)
+    for (; i + 48 <= size; i += 32, dest += 24) {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i));
+        if (!decodeTranslate256(values, url_safe)) {
+            break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest), decodeReshuffle256(values));
+    }
+#endif
 
-    if (LAST1 == BASE64_PADDING_CHAR && LAST2 == BASE64_PADDING_CHAR) {
-        padding = 2;
-    } else if (LAST1 == BASE64_PADDING_CHAR) {
-        padding = 1;
+#if defined(__SSSE3__)
+    for (; i + 24 <= size; i += 16, dest += 12) {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+        if (!decodeTranslate128(values, url_safe)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), decodeReshuffle128(values));
+    }
+#elif defined(TBAG_BASE64_NEON)
+    // The values of 0xFF are invalid. The characters of 0x80 or more are out of the tables.
+    uint8x16x4_t TABLE_LO;
+    uint8x16x4_t TABLE_HI;
+    for (int t = 0; t < 4; ++t) {
+        TABLE_LO.val[t] = vld1q_u8(getDecodeTable(url_safe) + (t * 16));
+        TABLE_HI.val[t] = vld1q_u8(getDecodeTable(url_safe) + (t * 16) + 64);
     }
+    uint8x16_t const OFFSET_40 = vdupq_n_u8(0x40);
+    for (; i + 64 <= size; i += 64, dest += 48) {
+        uint8x16x4_t values = vld4q_u8(in + i);
+        uint8x16_t error = vdupq_n_u8(0);
+        for (int t = 0; t < 4; ++t) {
+            uint8x16_t const CHARS = values.val[t];
+            values.val[t] = vqtbx4q_u8(vqtbl4q_u8(TABLE_LO, CHARS), TABLE_HI, vsubq_u8(CHARS, OFFSET_40));
+            error = vorrq_u8(error, vorrq_u8(values.val[t], CHARS));
+        }
+        if (vmaxvq_u8(error) & 0x80) {
+            break;
+        }
+        uint8x16x3_t output;
+        output.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+        output.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+        output.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+        vst3q_u8(dest, output);
+    }
+#endif
 
-    return ((length * 3) / 4) - padding;
+    std::uint8_t const * table = getDecodeTable(url_safe);
+    for (; i + 4 <= size; i += 4, dest += 3) {
+        std::uint32_t const A = table[in[i  ]];
+        std::uint32_t const B = table[in[i+1]];
+        std::uint32_t const C = table[in[i+2]];
+        std::uint32_t const D = table[in[i+3]];
+        if ((A | B | C | D) & 0x80) {
+            break;
+        }
+        std::uint32_t const VALUE = (A << 18) | (B << 12) | (C << 6) | D;
+        dest[0] = static_cast<std::uint8_t>(VALUE >> 16);
+        dest[1] = static_cast<std::uint8_t>(VALUE >>  8);
+        dest[2] = static_cast<std::uint8_t>(VALUE      );
+    }
+    return i;
 }
 
-bool encodeBase64(std::string const & input, std::string & output)
+// ------------------
+// Length functions.
+// ------------------
+
+std::size_t getEncodeLength(std::size_t size, bool padding) TBAG_NOEXCEPT
 {
-    return encodeBase64(util::Buffer(input.begin(), input.end()), output);
+    if (padding) {
+        return ((size + 2) / 3) * 4;
+    }
+    return (size / 3) * 4 + ((size % 3) == 0 ? 0 : (size % 3) + 1);
 }
 
-bool decodeBase64(std::string const & input, std::string & output)
+std::size_t getDecodeLength(char const * base64, std::size_t size) TBAG_NOEXCEPT
 {
-    util::Buffer buffer;
-    bool const RESULT = decodeBase64(input, buffer);
-    output.assign(buffer.begin(), buffer.end());
-    return RESULT;
+    if (base64 == nullptr) {
+        return 0;
+    }
+    for (int i = 0; i < 2 && size > 0 && base64[size - 1] == BASE64_PADDING_CHAR; ++i) {
+        --size;
+    }
+    return (size * 3) / 4;
 }
 
-bool encodeBase64(char const * input, std::size_t size, std::string & output)
+std::size_t getDecodeLength(std::string const & base64)
 {
-    BIO * b64 = BIO_new(BIO_f_base64());
-    BIO * bmem = BIO_new(BIO_s_mem());
-    BIO_push(b64, bmem);
+    return getDecodeLength(base64.data(), base64.size());
+}
 
-    BIO_set_flags(b64, BIO_FLAGS_BASE64_NO_NL); // Ignore newlines - write everything in one line
-    int const WSIZE = BIO_write(b64, input, size);
-    BIO_flush(b64);
+// ------------------
+// One-shot functions.
+// ------------------
 
-    BUF_MEM * bptr = nullptr;
-    BIO_get_mem_ptr(b64, &bptr);
+std::size_t encodeBase64(char const * input, std::size_t size, char * output,
+                         bool url_safe, bool padding) TBAG_NOEXCEPT
+{
+    if (input == nullptr || size == 0) {
+        return 0;
+    }
+    assert(output != nullptr);
 
-    output.clear();
-    output.assign(bptr->data, bptr->data + bptr->length);
-    auto const BLENGTH = bptr->length;
+    auto const * src = reinterpret_cast<std::uint8_t const *>(input);
+    auto const CONSUMED = encodeBlocks(src, size, output, url_safe);
+    auto const WRITTEN = (CONSUMED / 3) * 4;
+    return WRITTEN + encodeTail(src + CONSUMED, size - CONSUMED, output + WRITTEN, url_safe, padding);
+}
+
+Err decodeBase64(char const * input, std::size_t size, char * output, std::size_t * output_size,
+                 bool url_safe) TBAG_NOEXCEPT
+{
+    if (output_size != nullptr) {
+        *output_size = 0;
+    }
+    if (input == nullptr || size == 0) {
+        return E_SUCCESS;
+    }
+    assert(output != nullptr);
 
-    BIO_free_all(b64);
-    return WSIZE == size && /* CHECK THIS CONDITION */ BLENGTH >= size;
+    Base64Decoder decoder(url_safe);
+    std::size_t update_size = 0;
+    auto const UPDATE_CODE = decoder.update(input, size, output, &update_size);
+    if (isFailure(UPDATE_CODE)) {
+        return UPDATE_CODE;
+    }
+    std::size_t finish_size = 0;
+    auto const FINISH_CODE = decoder.finish(output + update_size, &finish_size);
+    if (isFailure(FINISH_CODE)) {
+        return FINISH_CODE;
+    }
+    if (output_size != nullptr) {
+        *output_size = update_size + finish_size;
+    }
+    return E_SUCCESS;
+}
+
+bool encodeBase64(std::string const & input, std::string & output)
+{
+    return encodeBase64(input.data(), input.size(), output);
+}
+
+bool decodeBase64(std::string const & input, std::string & output)
+{
+    output.resize(getDecodeLength(input));
+    std::size_t output_size = 0;
+    auto const CODE = decodeBase64(input.data(), input.size(), &output[0], &output_size);
+    output.resize(output_size);
+    return isSuccess(CODE);
+}
+
+bool encodeBase64(char const * input, std::size_t size, std::string & output)
+{
+    output.resize(getEncodeLength(size));
+    output.resize(encodeBase64(input, size, &output[0]));
+    return true;
 }
 
 bool encodeBase64(util::Buffer const & input, std::string & output)
@@ -84,26 +492,248 @@ bool encodeBase64(util::Buffer const & input, std::string & output)
     return encodeBase64(input.data(), input.size(), output);
 }
 
+bool decodeBase64(char const * input, std::size_t size, util::Buffer & output)
+{
+    output.resize(getDecodeLength(input, size));
+    std::size_t output_size = 0;
+    auto const CODE = decodeBase64(input, size, output.data(), &output_size);
+    output.resize(output_size);
+    return isSuccess(CODE);
+}
+
 bool decodeBase64(std::string const & input, util::Buffer & output)
 {
-    std::size_t length = getDecodeLength(input);
+    return decodeBase64(input.data(), input.size(), output);
+}
+
+bool encodeBase64Url(char const * input, std::size_t size, std::string & output, bool padding)
+{
+    output.resize(getEncodeLength(size, padding));
+    output.resize(encodeBase64(input, size, &output[0], true, padding));
+    return true;
+}
+
+bool decodeBase64Url(char const * input, std::size_t size, util::Buffer & output)
+{
+    output.resize(getDecodeLength(input, size));
+    std::size_t output_size = 0;
+    auto const CODE = decodeBase64(input, size, output.data(), &output_size, true);
+    output.resize(output_size);
+    return isSuccess(CODE);
+}
+
+bool decodeBase64Url(std::string const & input, util::Buffer & output)
+{
+    return decodeBase64Url(input.data(), input.size(), output);
+}
 
-    std::vector<char> buffer;
-    buffer.resize(length);
+// ----------------------------
+// Base64Encoder implementation.
+// ----------------------------
 
-    BIO * b64 = BIO_new(BIO_f_base64());
-    BIO * bmem = BIO_new_mem_buf((void*)input.data(), input.size());
-    BIO_push(b64, bmem);
+Base64Encoder::Base64Encoder(bool url_safe, bool padding) TBAG_NOEXCEPT
+        : _url_safe(url_safe), _padding(padding), _tail(), _tail_size(0)
+{
+    // EMPTY.
+}
 
-    BIO_set_flags(b64, BIO_FLAGS_BASE64_NO_NL);
-    int const RSIZE = BIO_read(b64, buffer.data(), length);
-    BIO_flush(b64);
+Base64Encoder::~Base64Encoder()
+{
+    // EMPTY.
+}
 
-    output.clear();
-    output.assign(buffer.begin(), buffer.end());
+std::size_t Base64Encoder::getUpdateLength(std::size_t size) const TBAG_NOEXCEPT
+{
+    return ((_tail_size + size) / 3) * 4;
+}
 
-    BIO_free_all(b64);
-    return length == RSIZE;
+std::size_t Base64Encoder::update(char const * input, std::size_t size, char * output) TBAG_NOEXCEPT
+{
+    if (input == nullptr || size == 0) {
+        return 0;
+    }
+
+    std::size_t written = 0;
+    if (_tail_size > 0) {
+        while (_tail_size < 3 && size > 0) {
+            _tail[_tail_size++] = *input++;
+            --size;
+        }
+        if (_tail_size < 3) {
+            return 0;
+        }
+        written += encodeBlocks(reinterpret_cast<std::uint8_t const *>(_tail), 3, output, _url_safe) / 3 * 4;
+        _tail_size = 0;
+    }
+
+    auto const CONSUMED = encodeBlocks(reinterpret_cast<std::uint8_t const *>(input), size,
+                                       output + written, _url_safe);
+    written += (CONSUMED / 3) * 4;
+
+    _tail_size = size - CONSUMED;
+    assert(_tail_size < 3);
+    ::memcpy(_tail, input + CONSUMED, _tail_size);
+    return written;
+}
+
+std::size_t Base64Encoder::finish(char * output) TBAG_NOEXCEPT
+{
+    auto const WRITTEN = encodeTail(reinterpret_cast<std::uint8_t const *>(_tail), _tail_size,
+                                    output, _url_safe, _padding);
+    _tail_size = 0;
+    return WRITTEN;
+}
+
+void Base64Encoder::update(char const * input, std::size_t size, std::string & output)
+{
+    auto const PREV_SIZE = output.size();
+    output.resize(PREV_SIZE + getUpdateLength(size));
+    output.resize(PREV_SIZE + update(input, size, &output[0] + PREV_SIZE));
+}
+
+void Base64Encoder::finish(std::string & output)
+{
+    char buffer[4];
+    output.append(buffer, finish(buffer));
+}
+
+void Base64Encoder::reset() TBAG_NOEXCEPT
+{
+    _tail_size = 0;
+}
+
+// ----------------------------
+// Base64Decoder implementation.
+// ----------------------------
+
+Base64Decoder::Base64Decoder(bool url_safe) TBAG_NOEXCEPT
+        : _url_safe(url_safe), _quad(), _quad_size(0), _finished(false)
+{
+    // EMPTY.
+}
+
+Base64Decoder::~Base64Decoder()
+{
+    // EMPTY.
+}
+
+std::size_t Base64Decoder::getUpdateLength(std::size_t size) const TBAG_NOEXCEPT
+{
+    // A padding character flushes the partial block.
+    return ((_quad_size + size) * 3) / 4;
+}
+
+Err Base64Decoder::update(char const * input, std::size_t size, char * output, std::size_t * output_size) TBAG_NOEXCEPT
+{
+    std::size_t written = 0;
+    Err code = E_SUCCESS;
+
+    std::uint8_t const * table = getDecodeTable(_url_safe);
+    auto * out = reinterpret_cast<std::uint8_t *>(output);
+
+    std::size_t i = 0;
+    while (i < size) {
+        if (_quad_size == 0 && !_finished) {
+            // Fast path of the canonical blocks.
+            auto const CONSUMED = decodeBlocks(input + i, size - i, out + written, _url_safe);
+            i += CONSUMED;
+            written += (CONSUMED / 4) * 3;
+            if (i >= size) {
+                break;
+            }
+        }
+
+        auto const CHAR = input[i++];
+        auto const VALUE = table[static_cast<std::uint8_t>(CHAR)];
+        if (VALUE != BASE64_INVALID_VALUE) {
+            if (_finished) {
+                code = E_PARSING; // Data after the padding.
+                break;
+            }
+            _quad[_quad_size++] = VALUE;
+            if (_quad_size == 4) {
+                std::uint32_t const BLOCK = (static_cast<std::uint32_t>(_quad[0]) << 18) |
+                                            (static_cast<std::uint32_t>(_quad[1]) << 12) |
+                                            (static_cast<std::uint32_t>(_quad[2]) <<  6) |
+                                            (static_cast<std::uint32_t>(_quad[3])      );
+                out[written++] = static_cast<std::uint8_t>(BLOCK >> 16);
+                out[written++] = static_cast<std::uint8_t>(BLOCK >>  8);
+                out[written++] = static_cast<std::uint8_t>(BLOCK      );
+                _quad_size = 0;
+            }
+        } else if (CHAR == BASE64_PADDING_CHAR) {
+            if (!_finished) {
+                if (_quad_size < 2) {
+                    code = E_PARSING;
+                    break;
+                }
+                std::size_t flush_size = 0;
+                finish(output + written, &flush_size);
+                written += flush_size;
+                _finished = true;
+            }
+        } else if (!isBase64Whitespace(CHAR)) {
+            code = E_PARSING;
+            break;
+        }
+    }
+
+    if (output_size != nullptr) {
+        *output_size = written;
+    }
+    return code;
+}
+
+Err Base64Decoder::finish(char * output, std::size_t * output_size) TBAG_NOEXCEPT
+{
+    if (output_size != nullptr) {
+        *output_size = 0;
+    }
+    if (_quad_size == 0) {
+        return E_SUCCESS;
+    }
+    if (_quad_size == 1) {
+        _quad_size = 0;
+        return E_PARSING;
+    }
+
+    std::uint32_t const BLOCK = (static_cast<std::uint32_t>(_quad[0]) << 18) |
+                                (static_cast<std::uint32_t>(_quad[1]) << 12) |
+                                (_quad_size == 3 ? (static_cast<std::uint32_t>(_quad[2]) << 6) : 0);
+    output[0] = static_cast<char>(BLOCK >> 16);
+    if (_quad_size == 3) {
+        output[1] = static_cast<char>(BLOCK >> 8);
+    }
+    if (output_size != nullptr) {
+        *output_size = _quad_size - 1;
+    }
+    _quad_size = 0;
+    return E_SUCCESS;
+}
+
+Err Base64Decoder::update(char const * input, std::size_t size, util::Buffer & output)
+{
+    auto const PREV_SIZE = output.size();
+    output.resize(PREV_SIZE + getUpdateLength(size));
+    std::size_t written = 0;
+    auto const CODE = update(input, size, output.data() + PREV_SIZE, &written);
+    output.resize(PREV_SIZE + written);
+    return CODE;
+}
+
+Err Base64Decoder::finish(util::Buffer & output)
+{
+    char buffer[2];
+    std::size_t written = 0;
+    auto const CODE = finish(buffer, &written);
+    output.insert(output.end(), buffer, buffer + written);
+    return CODE;
+}
+
+void Base64Decoder::reset() TBAG_NOEXCEPT
+{
+    _quad_size = 0;
+    _finished = false;
 }
 
 } // namespace crypto
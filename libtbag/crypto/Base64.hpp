@@ -3,6 +3,7 @@
  * @brief  Base64 class prototype.
  * @author zer0
  * @date   2017-12-07
+ * @date   2026-10-19 (Replace the OpenSSL BIO chain with the table-driven & SIMD codec)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_BASE64_HPP__
@@ -15,6 +16,7 @@
 
 #include <libtbag/config.h>
 #include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
 #include <libtbag/util/BufferInfo.hpp>
 
 #include <cstdint>
@@ -27,16 +29,159 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace crypto {
 
-/** Calculates the length of a decoded string. */
+TBAG_CONSTEXPR char const BASE64_PADDING_CHAR = '=';
+
+/**
+ * Calculates the length of an encoded string.
+ */
+TBAG_API std::size_t getEncodeLength(std::size_t size, bool padding = true) TBAG_NOEXCEPT;
+
+/**
+ * Calculates the length of a decoded string.
+ *
+ * @remarks
+ *  Exact for the canonical input, otherwise (e.g. whitespaces) the upper bound.
+ */
+TBAG_API std::size_t getDecodeLength(char const * base64, std::size_t size) TBAG_NOEXCEPT;
 TBAG_API std::size_t getDecodeLength(std::string const & base64);
 
+/**
+ * Encode to the output buffer.
+ *
+ * @param[in] input
+ *  Input bytes.
+ * @param[in] size
+ *  Size of the input bytes.
+ * @param[out] output
+ *  Output buffer of getEncodeLength() bytes at least.
+ * @param[in] url_safe
+ *  Use the URL and filename safe alphabet. (RFC 4648, Section 5)
+ * @param[in] padding
+ *  Append the padding characters.
+ *
+ * @return
+ *  Number of the written characters.
+ */
+TBAG_API std::size_t encodeBase64(char const * input, std::size_t size, char * output,
+                                  bool url_safe = false, bool padding = true) TBAG_NOEXCEPT;
+
+/**
+ * Decode to the output buffer.
+ *
+ * @param[in] input
+ *  Base64 characters. Whitespaces are ignored and the padding is optional.
+ * @param[in] size
+ *  Size of the characters.
+ * @param[out] output
+ *  Output buffer of getDecodeLength() bytes at least.
+ * @param[out] output_size
+ *  Number of the written bytes.
+ * @param[in] url_safe
+ *  Use the URL and filename safe alphabet. (RFC 4648, Section 5)
+ *
+ * @return
+ *  E_PARSING if an invalid character is found.
+ */
+TBAG_API Err decodeBase64(char const * input, std::size_t size, char * output, std::size_t * output_size,
+                          bool url_safe = false) TBAG_NOEXCEPT;
+
 TBAG_API bool encodeBase64(std::string const & input, std::string & output);
 TBAG_API bool decodeBase64(std::string const & input, std::string & output);
 
 TBAG_API bool encodeBase64(char const * input, std::size_t size, std::string & output);
 TBAG_API bool encodeBase64(util::Buffer const & input, std::string & output);
+TBAG_API bool decodeBase64(char const * input, std::size_t size, util::Buffer & output);
 TBAG_API bool decodeBase64(std::string const & input, util::Buffer & output);
 
+TBAG_API bool encodeBase64Url(char const * input, std::size_t size, std::string & output, bool padding = false);
+TBAG_API bool decodeBase64Url(char const * input, std::size_t size, util::Buffer & output);
+TBAG_API bool decodeBase64Url(std::string const & input, util::Buffer & output);
+
+/**
+ * Base64Encoder class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Incremental encoder. The output is equal to the output of the one-shot encoder.
+ */
+class TBAG_API Base64Encoder
+{
+private:
+    bool _url_safe;
+    bool _padding;
+
+private:
+    char _tail[3];
+    std::size_t _tail_size;
+
+public:
+    Base64Encoder(bool url_safe = false, bool padding = true) TBAG_NOEXCEPT;
+    ~Base64Encoder();
+
+public:
+    /** Maximum number of the characters of update(). */
+    std::size_t getUpdateLength(std::size_t size) const TBAG_NOEXCEPT;
+
+    /** Returns the number of the written characters. */
+    std::size_t update(char const * input, std::size_t size, char * output) TBAG_NOEXCEPT;
+
+    /** Writes 4 characters at most. */
+    std::size_t finish(char * output) TBAG_NOEXCEPT;
+
+public:
+    /** Appends to the output. */
+    void update(char const * input, std::size_t size, std::string & output);
+    void finish(std::string & output);
+
+public:
+    void reset() TBAG_NOEXCEPT;
+};
+
+/**
+ * Base64Decoder class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Incremental decoder. The chunks can be split at any character.
+ */
+class TBAG_API Base64Decoder
+{
+private:
+    bool _url_safe;
+
+private:
+    std::uint8_t _quad[4];
+    std::size_t _quad_size;
+
+    /** The padding was found. */
+    bool _finished;
+
+public:
+    Base64Decoder(bool url_safe = false) TBAG_NOEXCEPT;
+    ~Base64Decoder();
+
+public:
+    /** Maximum number of the bytes of update(). */
+    std::size_t getUpdateLength(std::size_t size) const TBAG_NOEXCEPT;
+
+    Err update(char const * input, std::size_t size, char * output, std::size_t * output_size) TBAG_NOEXCEPT;
+
+    /** Flushes the unpadded tail. Writes 2 bytes at most. */
+    Err finish(char * output, std::size_t * output_size) TBAG_NOEXCEPT;
+
+public:
+    /** Appends to the output. */
+    Err update(char const * input, std::size_t size, util::Buffer & output);
+    Err finish(util::Buffer & output);
+
+public:
+    void reset() TBAG_NOEXCEPT;
+};
+
 } // namespace crypto
 
 // --------------------
@@ -0,0 +1,276 @@
+/**
+ * @file   Blake3.cpp
+ * @brief  Blake3 class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/crypto/Blake3.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace crypto {
+
+TBAG_CONSTEXPR static uint32_t const BLAKE3_CHUNK_START = 1 << 0;
+TBAG_CONSTEXPR static uint32_t const BLAKE3_CHUNK_END   = 1 << 1;
+TBAG_CONSTEXPR static uint32_t const BLAKE3_PARENT      = 1 << 2;
+TBAG_CONSTEXPR static uint32_t const BLAKE3_ROOT        = 1 << 3;
+
+static Blake3::ChainingValue const BLAKE3_IV = {
+        0x6A09E667u, 0xBB67AE85u, 0x3C6EF372u, 0xA54FF53Au,
+        0x510E527Fu, 0x9B05688Cu, 0x1F83D9ABu, 0x5BE0CD19u,
+};
+
+TBAG_CONSTEXPR static uint8_t const BLAKE3_MSG_SCHEDULE[7][16] = {
+        { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+        { 2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8},
+        { 3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1},
+        {10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6},
+        {12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4},
+        { 9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7},
+        {11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13},
+};
+
+static inline uint32_t rotr32(uint32_t x, int n) TBAG_NOEXCEPT
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+static inline uint32_t loadLe32(uint8_t const * p) TBAG_NOEXCEPT
+{
+    return static_cast<uint32_t>(p[0])       | static_cast<uint32_t>(p[1]) <<  8 |
+           static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+
+static inline void storeLe32(uint8_t * p, uint32_t x) TBAG_NOEXCEPT
+{
+    p[0] = static_cast<uint8_t>(x);
+    p[1] = static_cast<uint8_t>(x >>  8);
+    p[2] = static_cast<uint8_t>(x >> 16);
+    p[3] = static_cast<uint8_t>(x >> 24);
+}
+
+static inline void g(uint32_t * s, int a, int b, int c, int d, uint32_t mx, uint32_t my) TBAG_NOEXCEPT
+{
+    s[a] = s[a] + s[b] + mx;
+    s[d] = rotr32(s[d] ^ s[a], 16);
+    s[c] = s[c] + s[d];
+    s[b] = rotr32(s[b] ^ s[c], 12);
+    s[a] = s[a] + s[b] + my;
+    s[d] = rotr32(s[d] ^ s[a], 8);
+    s[c] = s[c] + s[d];
+    s[b] = rotr32(s[b] ^ s[c], 7);
+}
+
+static void compress(Blake3::ChainingValue const & cv, uint32_t const * block_words,
+                     uint64_t counter, uint32_t block_len, uint32_t flags, uint32_t * out) TBAG_NOEXCEPT
+{
+    uint32_t s[16] = {
+            cv[0], cv[1], cv[2], cv[3], cv[4], cv[5], cv[6], cv[7],
+            BLAKE3_IV[0], BLAKE3_IV[1], BLAKE3_IV[2], BLAKE3_IV[3],
+            static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), block_len, flags,
+    };
+    for (auto const & schedule : BLAKE3_MSG_SCHEDULE) {
+        auto const * m = schedule;
+        g(s, 0, 4,  8, 12, block_words[m[ 0]], block_words[m[ 1]]);
+        g(s, 1, 5,  9, 13, block_words[m[ 2]], block_words[m[ 3]]);
+        g(s, 2, 6, 10, 14, block_words[m[ 4]], block_words[m[ 5]]);
+        g(s, 3, 7, 11, 15, block_words[m[ 6]], block_words[m[ 7]]);
+        g(s, 0, 5, 10, 15, block_words[m[ 8]], block_words[m[ 9]]);
+        g(s, 1, 6, 11, 12, block_words[m[10]], block_words[m[11]]);
+        g(s, 2, 7,  8, 13, block_words[m[12]], block_words[m[13]]);
+        g(s, 3, 4,  9, 14, block_words[m[14]], block_words[m[15]]);
+    }
+    for (int i = 0; i < 8; ++i) {
+        out[i] = s[i] ^ s[i + 8];
+        out[i + 8] = s[i + 8] ^ cv[i];
+    }
+}
+
+static void loadBlockWords(uint8_t const * block, uint32_t * words) TBAG_NOEXCEPT
+{
+    for (int i = 0; i < 16; ++i) {
+        words[i] = loadLe32(block + i * 4);
+    }
+}
+
+static Blake3::Output getParentOutput(Blake3::ChainingValue const & left,
+                                      Blake3::ChainingValue const & right) TBAG_NOEXCEPT
+{
+    Blake3::Output output;
+    output.input_cv = BLAKE3_IV;
+    std::copy(left.begin(), left.end(), output.block_words);
+    std::copy(right.begin(), right.end(), output.block_words + 8);
+    output.counter = 0;
+    output.block_len = Blake3::BLOCK_LEN;
+    output.flags = BLAKE3_PARENT;
+    return output;
+}
+
+// ---------------------
+// Output implementation.
+// ---------------------
+
+Blake3::ChainingValue Blake3::Output::getChainingValue() const TBAG_NOEXCEPT
+{
+    uint32_t out[16];
+    compress(input_cv, block_words, counter, block_len, flags, out);
+    ChainingValue cv;
+    std::copy(out, out + 8, cv.begin());
+    return cv;
+}
+
+void Blake3::Output::getRootBytes(uint8_t * output, std::size_t size) const TBAG_NOEXCEPT
+{
+    uint64_t output_block_counter = 0;
+    while (size > 0) {
+        uint32_t words[16];
+        compress(input_cv, block_words, output_block_counter, block_len, flags | BLAKE3_ROOT, words);
+        for (int i = 0; i < 16 && size > 0; ++i) {
+            uint8_t bytes[4];
+            storeLe32(bytes, words[i]);
+            auto const COPY_SIZE = std::min<std::size_t>(4, size);
+            ::memcpy(output, bytes, COPY_SIZE);
+            output += COPY_SIZE;
+            size -= COPY_SIZE;
+        }
+        ++output_block_counter;
+    }
+}
+
+// ---------------------
+// Blake3 implementation.
+// ---------------------
+
+Blake3::Blake3(uint64_t chunk_counter) TBAG_NOEXCEPT
+        : _base_counter(chunk_counter), _cv_stack_len(0)
+{
+    resetChunk(chunk_counter);
+}
+
+Blake3::~Blake3()
+{
+    // EMPTY.
+}
+
+void Blake3::resetChunk(uint64_t chunk_counter) TBAG_NOEXCEPT
+{
+    _chunk_cv = BLAKE3_IV;
+    _chunk_counter = chunk_counter;
+    ::memset(_block, 0x00, sizeof(_block));
+    _block_len = 0;
+    _blocks_compressed = 0;
+}
+
+std::size_t Blake3::getChunkLength() const TBAG_NOEXCEPT
+{
+    return BLOCK_LEN * _blocks_compressed + _block_len;
+}
+
+Blake3::Output Blake3::getChunkOutput() const TBAG_NOEXCEPT
+{
+    Output output;
+    output.input_cv = _chunk_cv;
+    loadBlockWords(_block, output.block_words);
+    output.counter = _chunk_counter;
+    output.block_len = static_cast<uint32_t>(_block_len);
+    output.flags = BLAKE3_CHUNK_END | (_blocks_compressed == 0 ? BLAKE3_CHUNK_START : 0);
+    return output;
+}
+
+void Blake3::pushChunkChainingValue(ChainingValue cv, uint64_t total_chunks) TBAG_NOEXCEPT
+{
+    // Each trailing zero bit of the number of chunks is a completed subtree.
+    while ((total_chunks & 1) == 0) {
+        assert(_cv_stack_len > 0);
+        cv = getParentOutput(_cv_stack[--_cv_stack_len], cv).getChainingValue();
+        total_chunks >>= 1;
+    }
+    assert(_cv_stack_len < MAX_DEPTH);
+    _cv_stack[_cv_stack_len++] = cv;
+}
+
+void Blake3::update(void const * data, std::size_t size) TBAG_NOEXCEPT
+{
+    auto const * input = static_cast<uint8_t const *>(data);
+    while (size > 0) {
+        // The last chunk is finalized by final() with the CHUNK_END flag.
+        if (getChunkLength() == CHUNK_LEN) {
+            auto const TOTAL_CHUNKS = _chunk_counter + 1;
+            pushChunkChainingValue(getChunkOutput().getChainingValue(), TOTAL_CHUNKS - _base_counter);
+            resetChunk(TOTAL_CHUNKS);
+        }
+
+        if (_block_len == BLOCK_LEN) {
+            uint32_t words[16];
+            uint32_t out[16];
+            loadBlockWords(_block, words);
+            compress(_chunk_cv, words, _chunk_counter, BLOCK_LEN,
+                     (_blocks_compressed == 0 ? BLAKE3_CHUNK_START : 0), out);
+            std::copy(out, out + 8, _chunk_cv.begin());
+            ++_blocks_compressed;
+            ::memset(_block, 0x00, sizeof(_block));
+            _block_len = 0;
+        }
+
+        auto const TAKE = std::min(BLOCK_LEN - _block_len, size);
+        ::memcpy(_block + _block_len, input, TAKE);
+        _block_len += TAKE;
+        input += TAKE;
+        size -= TAKE;
+    }
+}
+
+Blake3::Output Blake3::getOutput() const TBAG_NOEXCEPT
+{
+    auto output = getChunkOutput();
+    for (auto i = _cv_stack_len; i > 0; --i) {
+        output = getParentOutput(_cv_stack[i - 1], output.getChainingValue());
+    }
+    return output;
+}
+
+void Blake3::final(uint8_t * output, std::size_t size) const TBAG_NOEXCEPT
+{
+    getOutput().getRootBytes(output, size);
+}
+
+void Blake3::reset() TBAG_NOEXCEPT
+{
+    _cv_stack_len = 0;
+    resetChunk(_base_counter);
+}
+
+void Blake3::mergeSubtrees(ChainingValue const * cvs, std::size_t size, Output const & last,
+                           uint8_t * output, std::size_t output_size) TBAG_NOEXCEPT
+{
+    // Same as the chunks of the update(), but the leaves are the subtrees.
+    ChainingValue stack[MAX_DEPTH];
+    std::size_t stack_len = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        auto cv = cvs[i];
+        for (auto total = static_cast<uint64_t>(i + 1); (total & 1) == 0; total >>= 1) {
+            cv = getParentOutput(stack[--stack_len], cv).getChainingValue();
+        }
+        stack[stack_len++] = cv;
+    }
+
+    auto root = last;
+    for (auto i = stack_len; i > 0; --i) {
+        root = getParentOutput(stack[i - 1], root.getChainingValue());
+    }
+    root.getRootBytes(output, output_size);
+}
+
+} // namespace crypto
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
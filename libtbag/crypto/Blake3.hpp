@@ -0,0 +1,129 @@
+/**
+ * @file   Blake3.hpp
+ * @brief  Blake3 class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_BLAKE3_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_BLAKE3_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+
+#include <cstdint>
+#include <array>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace crypto {
+
+/**
+ * Blake3 class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Incremental BLAKE3 hash. (Default hash mode) @n
+ *  The input is split into the chunks of 1KB, which are the leaves of a binary tree, @n
+ *  so the subtrees of a large input can be hashed in parallel. (See mergeSubtrees())
+ */
+class TBAG_API Blake3
+{
+public:
+    TBAG_CONSTEXPR static std::size_t const OUT_LEN = 32;
+    TBAG_CONSTEXPR static std::size_t const BLOCK_LEN = 64;
+    TBAG_CONSTEXPR static std::size_t const CHUNK_LEN = 1024;
+
+    /** Maximum depth of the tree. (2^54 * CHUNK_LEN = 2^64) */
+    TBAG_CONSTEXPR static std::size_t const MAX_DEPTH = 54;
+
+public:
+    using ChainingValue = std::array<uint32_t, 8>;
+
+    /** The node before the finalization. */
+    struct Output
+    {
+        ChainingValue input_cv;
+        uint32_t block_words[16];
+        uint64_t counter;
+        uint32_t block_len;
+        uint32_t flags;
+
+        ChainingValue getChainingValue() const TBAG_NOEXCEPT;
+
+        /** Write the root hash. */
+        void getRootBytes(uint8_t * output, std::size_t size) const TBAG_NOEXCEPT;
+    };
+
+private:
+    /** Chaining value of the current chunk. */
+    ChainingValue _chunk_cv;
+    uint64_t _chunk_counter;
+    uint8_t _block[BLOCK_LEN];
+    std::size_t _block_len;
+    std::size_t _blocks_compressed;
+
+private:
+    uint64_t _base_counter;
+    ChainingValue _cv_stack[MAX_DEPTH];
+    std::size_t _cv_stack_len;
+
+public:
+    /**
+     * @param[in] chunk_counter
+     *  The first chunk of a subtree. The subtree must be aligned by its size.
+     */
+    Blake3(uint64_t chunk_counter = 0) TBAG_NOEXCEPT;
+    ~Blake3();
+
+private:
+    void resetChunk(uint64_t chunk_counter) TBAG_NOEXCEPT;
+    std::size_t getChunkLength() const TBAG_NOEXCEPT;
+    Output getChunkOutput() const TBAG_NOEXCEPT;
+    void pushChunkChainingValue(ChainingValue cv, uint64_t total_chunks) TBAG_NOEXCEPT;
+
+public:
+    void update(void const * data, std::size_t size) TBAG_NOEXCEPT;
+
+    /** Output of the (sub)tree. */
+    Output getOutput() const TBAG_NOEXCEPT;
+
+    /** Write the root hash. The hasher is not changed. */
+    void final(uint8_t * output, std::size_t size = OUT_LEN) const TBAG_NOEXCEPT;
+
+    void reset() TBAG_NOEXCEPT;
+
+public:
+    /**
+     * Merge the subtrees into the root hash.
+     *
+     * @param[in] cvs
+     *  Chaining values of the subtrees of the same power-of-two number of chunks.
+     * @param[in] size
+     *  Number of the chaining values.
+     * @param[in] last
+     *  Output of the last subtree, which is not larger than the others.
+     * @param[out] output
+     *  Root hash.
+     */
+    static void mergeSubtrees(ChainingValue const * cvs, std::size_t size, Output const & last,
+                              uint8_t * output, std::size_t output_size = OUT_LEN) TBAG_NOEXCEPT;
+};
+
+} // namespace crypto
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_BLAKE3_HPP__
+
@@ -0,0 +1,446 @@
+/**
+ * @file   Hasher.cpp
+ * @brief  Hasher class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/crypto/Hasher.hpp>
+#include <libtbag/crypto/Blake3.hpp>
+#include <libtbag/crypto/XxHash3.hpp>
+#include <libtbag/bitwise/Checksum.hpp>
+#include <libtbag/filesystem/File.hpp>
+#include <libtbag/string/StringUtils.hpp>
+#include <libtbag/log/Log.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <openssl/evp.h>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace crypto {
+
+/** Size of the read buffer of the file hash. */
+TBAG_CONSTEXPR static std::size_t const FILE_HASH_BUFFER_SIZE = 1024 * 1024;
+
+/** Number of the BLAKE3 chunks hashed by a thread at once. (4MByte) */
+TBAG_CONSTEXPR static uint64_t const FILE_HASH_SUBTREE_CHUNKS = 4096;
+
+char const * getHashName(HashType type) TBAG_NOEXCEPT
+{
+    // clang-format off
+    switch (type) {
+    case HashType::HT_MD5:     return "md5";
+    case HashType::HT_SHA1:    return "sha1";
+    case HashType::HT_SHA256:  return "sha256";
+    case HashType::HT_SHA512:  return "sha512";
+    case HashType::HT_BLAKE3:  return "blake3";
+    case HashType::HT_XXH3_64: return "xxh3";
+    case HashType::HT_CRC32C:  return "crc32c";
+    default:                   return "none";
+    }
+    // clang-format on
+}
+
+HashType getHashType(std::string const & name)
+{
+    auto const lower = libtbag::string::lower(name);
+    // clang-format off
+    if (lower == "md5"   ) return HashType::HT_MD5;
+    if (lower == "sha1"  ) return HashType::HT_SHA1;
+    if (lower == "sha256") return HashType::HT_SHA256;
+    if (lower == "sha512") return HashType::HT_SHA512;
+    if (lower == "blake3") return HashType::HT_BLAKE3;
+    if (lower == "xxh3"  ) return HashType::HT_XXH3_64;
+    if (lower == "crc32c") return HashType::HT_CRC32C;
+    // clang-format on
+    return HashType::HT_NONE;
+}
+
+std::size_t getDigestSize(HashType type) TBAG_NOEXCEPT
+{
+    // clang-format off
+    switch (type) {
+    case HashType::HT_MD5:     return 16;
+    case HashType::HT_SHA1:    return 20;
+    case HashType::HT_SHA256:  return 32;
+    case HashType::HT_SHA512:  return 64;
+    case HashType::HT_BLAKE3:  return Blake3::OUT_LEN;
+    case HashType::HT_XXH3_64: return sizeof(uint64_t);
+    case HashType::HT_CRC32C:  return sizeof(uint32_t);
+    default:                   return 0;
+    }
+    // clang-format on
+}
+
+static EVP_MD const * getEvpMd(HashType type) TBAG_NOEXCEPT
+{
+    // clang-format off
+    switch (type) {
+    case HashType::HT_MD5:    return EVP_md5();
+    case HashType::HT_SHA1:   return EVP_sha1();
+    case HashType::HT_SHA256: return EVP_sha256();
+    case HashType::HT_SHA512: return EVP_sha512();
+    default:                  return nullptr;
+    }
+    // clang-format on
+}
+
+static void writeBigEndian(uint64_t value, std::size_t size, uint8_t * output) TBAG_NOEXCEPT
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        output[i] = static_cast<uint8_t>(value >> (8 * (size - 1 - i)));
+    }
+}
+
+/**
+ * Hasher::Impl class implementation.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct Hasher::Impl : private Noncopyable
+{
+    HashType const TYPE;
+
+    EVP_MD_CTX * evp = nullptr;
+    std::unique_ptr<Blake3> blake3;
+    std::unique_ptr<XxHash3> xxh3;
+    uint32_t crc32c = 0;
+
+    Impl(HashType type) : TYPE(type)
+    {
+        switch (TYPE) {
+        case HashType::HT_MD5:
+        case HashType::HT_SHA1:
+        case HashType::HT_SHA256:
+        case HashType::HT_SHA512:
+            evp = EVP_MD_CTX_new();
+            if (evp == nullptr) {
+                throw std::bad_alloc();
+            }
+            break;
+        case HashType::HT_BLAKE3:
+            blake3 = std::make_unique<Blake3>();
+            break;
+        case HashType::HT_XXH3_64:
+            xxh3 = std::make_unique<XxHash3>();
+            break;
+        default:
+            break;
+        }
+    }
+
+    ~Impl()
+    {
+        if (evp != nullptr) {
+            EVP_MD_CTX_free(evp);
+        }
+    }
+
+    Err reset()
+    {
+        switch (TYPE) {
+        case HashType::HT_MD5:
+        case HashType::HT_SHA1:
+        case HashType::HT_SHA256:
+        case HashType::HT_SHA512:
+            if (EVP_DigestInit_ex(evp, getEvpMd(TYPE), nullptr) != 1) {
+                return E_CRYPTO;
+            }
+            return E_SUCCESS;
+        case HashType::HT_BLAKE3:
+            blake3->reset();
+            return E_SUCCESS;
+        case HashType::HT_XXH3_64:
+            xxh3->reset();
+            return E_SUCCESS;
+        case HashType::HT_CRC32C:
+            crc32c = 0;
+            return E_SUCCESS;
+        default:
+            return E_ILLARGS;
+        }
+    }
+
+    Err update(void const * data, std::size_t size)
+    {
+        switch (TYPE) {
+        case HashType::HT_MD5:
+        case HashType::HT_SHA1:
+        case HashType::HT_SHA256:
+        case HashType::HT_SHA512:
+            if (EVP_DigestUpdate(evp, data, size) != 1) {
+                return E_CRYPTO;
+            }
+            return E_SUCCESS;
+        case HashType::HT_BLAKE3:
+            blake3->update(data, size);
+            return E_SUCCESS;
+        case HashType::HT_XXH3_64:
+            xxh3->update(data, size);
+            return E_SUCCESS;
+        case HashType::HT_CRC32C:
+            crc32c = bitwise::calcCrc32c(data, size, crc32c);
+            return E_SUCCESS;
+        default:
+            return E_ILLARGS;
+        }
+    }
+
+    Err final(Digest & digest)
+    {
+        digest.resize(getDigestSize(TYPE));
+        switch (TYPE) {
+        case HashType::HT_MD5:
+        case HashType::HT_SHA1:
+        case HashType::HT_SHA256:
+        case HashType::HT_SHA512:
+            if (EVP_DigestFinal_ex(evp, digest.data(), nullptr) != 1) {
+                return E_CRYPTO;
+            }
+            return E_SUCCESS;
+        case HashType::HT_BLAKE3:
+            blake3->final(digest.data(), digest.size());
+            return E_SUCCESS;
+        case HashType::HT_XXH3_64:
+            writeBigEndian(xxh3->digest(), digest.size(), digest.data());
+            return E_SUCCESS;
+        case HashType::HT_CRC32C:
+            writeBigEndian(crc32c, digest.size(), digest.data());
+            return E_SUCCESS;
+        default:
+            return E_ILLARGS;
+        }
+    }
+};
+
+// ---------------------
+// Hasher implementation.
+// ---------------------
+
+Hasher::Hasher(HashType type) : _type(type)
+{
+    if (getDigestSize(type) == 0) {
+        return;
+    }
+    _impl = std::make_unique<Impl>(type);
+    auto const code = _impl->reset();
+    if (isFailure(code)) {
+        tDLogE("Hasher::Hasher() Initialize {} error: {}", getHashName(type), getErrName(code));
+        _impl.reset();
+    }
+}
+
+Hasher::~Hasher()
+{
+    // EMPTY.
+}
+
+Err Hasher::update(void const * data, std::size_t size)
+{
+    if (!_impl) {
+        return E_NREADY;
+    }
+    return _impl->update(data, size);
+}
+
+Err Hasher::update(std::string const & data)
+{
+    return update(data.data(), data.size());
+}
+
+Err Hasher::final(Digest & digest)
+{
+    if (!_impl) {
+        return E_NREADY;
+    }
+    return _impl->final(digest);
+}
+
+std::string Hasher::finalHex()
+{
+    Digest digest;
+    if (isFailure(final(digest))) {
+        return std::string();
+    }
+    std::string result(digest.size() * 2, '\0');
+    string::encodeHexString(digest.data(), digest.size(), &result[0], false);
+    return result;
+}
+
+Err Hasher::reset()
+{
+    if (!_impl) {
+        return E_NREADY;
+    }
+    return _impl->reset();
+}
+
+Err getHash(HashType type, void const * data, std::size_t size, Hasher::Digest & digest)
+{
+    Hasher hasher(type);
+    auto const code = hasher.update(data, size);
+    if (isFailure(code)) {
+        return code;
+    }
+    return hasher.final(digest);
+}
+
+std::string getHashHex(HashType type, void const * data, std::size_t size)
+{
+    Hasher hasher(type);
+    if (isFailure(hasher.update(data, size))) {
+        return std::string();
+    }
+    return hasher.finalHex();
+}
+
+std::string getHashHex(HashType type, std::string const & data)
+{
+    return getHashHex(type, data.data(), data.size());
+}
+
+/**
+ * Read the range of the file to the callback.
+ */
+template <typename Predicated>
+static Err readFileRange(filesystem::File & file, uint64_t offset, uint64_t size,
+                         std::vector<char> & buffer, Predicated predicated)
+{
+    while (size > 0) {
+        auto const READ_SIZE = static_cast<std::size_t>(std::min<uint64_t>(size, buffer.size()));
+        auto const RESULT = file.read(buffer.data(), READ_SIZE, static_cast<int64_t>(offset));
+        if (RESULT <= 0) {
+            return E_RDERR;
+        }
+        predicated(buffer.data(), static_cast<std::size_t>(RESULT));
+        offset += static_cast<uint64_t>(RESULT);
+        size -= static_cast<uint64_t>(RESULT);
+    }
+    return E_SUCCESS;
+}
+
+static Err getFileHashSequentially(HashType type, filesystem::File & file, uint64_t size, Hasher::Digest & digest)
+{
+    Hasher hasher(type);
+    if (!hasher.isReady()) {
+        return E_ILLARGS;
+    }
+    std::vector<char> buffer(static_cast<std::size_t>(std::min<uint64_t>(FILE_HASH_BUFFER_SIZE, std::max<uint64_t>(size, 1))));
+    auto const code = readFileRange(file, 0, size, buffer, [&](char const * data, std::size_t read_size){
+        hasher.update(data, read_size);
+    });
+    if (isFailure(code)) {
+        return code;
+    }
+    return hasher.final(digest);
+}
+
+/**
+ * The subtrees of FILE_HASH_SUBTREE_CHUNKS are hashed by the threads,
+ * and merged into the root of the BLAKE3 tree.
+ */
+static Err getFileBlake3Parallel(std::string const & path, uint64_t size,
+                                 std::size_t thread_count, Hasher::Digest & digest)
+{
+    auto const SUBTREE_SIZE = FILE_HASH_SUBTREE_CHUNKS * Blake3::CHUNK_LEN;
+    auto const SUBTREES = static_cast<std::size_t>((size + SUBTREE_SIZE - 1) / SUBTREE_SIZE);
+    assert(SUBTREES >= 2);
+
+    std::vector<Blake3::ChainingValue> cvs(SUBTREES - 1);
+    Blake3::Output last;
+    std::atomic_size_t next(0);
+    std::atomic<Err> error(E_SUCCESS);
+
+    auto const worker = [&](){
+        filesystem::File file;
+        auto const open_code = file.open(path, filesystem::File::Flags().clear().rdonly());
+        if (isFailure(open_code)) {
+            error = open_code;
+            return;
+        }
+        std::vector<char> buffer(FILE_HASH_BUFFER_SIZE);
+        std::size_t index;
+        while ((index = next++) < SUBTREES && error == E_SUCCESS) {
+            auto const OFFSET = index * SUBTREE_SIZE;
+            Blake3 blake3(index * FILE_HASH_SUBTREE_CHUNKS);
+            auto const code = readFileRange(file, OFFSET, std::min(SUBTREE_SIZE, size - OFFSET), buffer,
+                                            [&](char const * data, std::size_t read_size){
+                blake3.update(data, read_size);
+            });
+            if (isFailure(code)) {
+                error = code;
+                return;
+            }
+            if (index + 1 == SUBTREES) {
+                last = blake3.getOutput();
+            } else {
+                cvs[index] = blake3.getOutput().getChainingValue();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < std::min(thread_count, SUBTREES); ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto & thread : threads) {
+        thread.join();
+    }
+
+    if (isFailure(error)) {
+        return error;
+    }
+    digest.resize(Blake3::OUT_LEN);
+    Blake3::mergeSubtrees(cvs.data(), cvs.size(), last, digest.data(), digest.size());
+    return E_SUCCESS;
+}
+
+Err getFileHash(HashType type, std::string const & path, Hasher::Digest & digest, std::size_t thread_count)
+{
+    filesystem::File file;
+    auto const code = file.open(path, filesystem::File::Flags().clear().rdonly());
+    if (isFailure(code)) {
+        return code;
+    }
+    auto const SIZE = file.getState().size;
+
+    if (thread_count == 0) {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    auto const SUBTREE_SIZE = FILE_HASH_SUBTREE_CHUNKS * Blake3::CHUNK_LEN;
+    if (type == HashType::HT_BLAKE3 && thread_count >= 2 && SIZE > SUBTREE_SIZE) {
+        file.close();
+        return getFileBlake3Parallel(path, SIZE, thread_count, digest);
+    }
+    return getFileHashSequentially(type, file, SIZE, digest);
+}
+
+std::string getFileHashHex(HashType type, std::string const & path, std::size_t thread_count)
+{
+    Hasher::Digest digest;
+    auto const code = getFileHash(type, path, digest, thread_count);
+    if (isFailure(code)) {
+        tDLogE("getFileHashHex() Hash {} error: {}", path, getErrName(code));
+        return std::string();
+    }
+    std::string result(digest.size() * 2, '\0');
+    string::encodeHexString(digest.data(), digest.size(), &result[0], false);
+    return result;
+}
+
+} // namespace crypto
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,120 @@
+/**
+ * @file   Hasher.hpp
+ * @brief  Hasher class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_HASHER_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_HASHER_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace crypto {
+
+enum class HashType
+{
+    HT_NONE = 0,
+    HT_MD5,
+    HT_SHA1,
+    HT_SHA256,
+    HT_SHA512,
+    HT_BLAKE3,
+    HT_XXH3_64,
+    HT_CRC32C,
+};
+
+TBAG_API char const * getHashName(HashType type) TBAG_NOEXCEPT;
+TBAG_API HashType getHashType(std::string const & name);
+
+/** Size of the digest in bytes. */
+TBAG_API std::size_t getDigestSize(HashType type) TBAG_NOEXCEPT;
+
+/**
+ * Hasher class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Incremental hash of the all HashType. @n
+ *  The integer digests (XXH3_64, CRC32C) are written in the big-endian (canonical) order.
+ */
+class TBAG_API Hasher : private Noncopyable
+{
+public:
+    using Digest = std::vector<uint8_t>;
+
+public:
+    struct Impl;
+    friend struct Impl;
+
+public:
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+private:
+    HashType _type;
+    UniqueImpl _impl;
+
+public:
+    Hasher(HashType type);
+    ~Hasher();
+
+public:
+    inline HashType type() const TBAG_NOEXCEPT
+    { return _type; }
+
+    inline bool isReady() const TBAG_NOEXCEPT
+    { return static_cast<bool>(_impl); }
+
+public:
+    Err update(void const * data, std::size_t size);
+    Err update(std::string const & data);
+
+    /** Call reset() before the next update(). */
+    Err final(Digest & digest);
+    std::string finalHex();
+
+    Err reset();
+};
+
+TBAG_API Err getHash(HashType type, void const * data, std::size_t size, Hasher::Digest & digest);
+TBAG_API std::string getHashHex(HashType type, void const * data, std::size_t size);
+TBAG_API std::string getHashHex(HashType type, std::string const & data);
+
+/**
+ * Hash the file without loading the whole file.
+ *
+ * @param[in] thread_count
+ *  Number of the threads of BLAKE3. If 0, the number of the CPUs is used. @n
+ *  The other types are always hashed sequentially.
+ */
+TBAG_API Err getFileHash(HashType type, std::string const & path, Hasher::Digest & digest,
+                         std::size_t thread_count = 0);
+TBAG_API std::string getFileHashHex(HashType type, std::string const & path, std::size_t thread_count = 0);
+
+} // namespace crypto
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_HASHER_HPP__
+
@@ -3,9 +3,11 @@
  * @brief  Md5 class implementation.
  * @author zer0
  * @date   2017-12-07
+ * @date   2026-10-19 (Stream the file of getMd5FromFile())
  */
 
 #include <libtbag/crypto/Md5.hpp>
+#include <libtbag/crypto/Hasher.hpp>
 #include <libtbag/string/StringUtils.hpp>
 #include <libtbag/filesystem/File.hpp>
 #include <libtbag/log/Log.hpp>
@@ -101,13 +103,16 @@ std::string getMd5(std::string const & input)
 
 std::string getMd5FromFile(std::string const & file_path)
 {
-    util::Buffer buffer;
-    Err const READ_CODE = filesystem::readFile(file_path, buffer);
-    if (isFailure(READ_CODE)) {
-        tDLogE("getMd5FromFile() Read file {} error: {}", getErrName(READ_CODE), file_path);
+    // Read by the fixed size buffer, instead of loading the whole file.
+    Hasher::Digest digest;
+    Err const HASH_CODE = getFileHash(HashType::HT_MD5, file_path, digest);
+    if (isFailure(HASH_CODE)) {
+        tDLogE("getMd5FromFile() Hash file {} error: {}", file_path, getErrName(HASH_CODE));
         return std::string();
     }
-    return getMd5(buffer);
+    std::string result(digest.size() * 2, '\0');
+    string::encodeHexString(digest.data(), digest.size(), &result[0], false);
+    return result;
 }
 
 } // namespace crypto
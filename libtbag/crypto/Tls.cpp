@@ -6,6 +6,7 @@
  * @date   2018-12-25 (Change namespace: libtbag::network::http::tls -> libtbag::http)
  * @date   2019-01-13 (Change namespace: libtbag::http -> libtbag::crypto)
  * @date   2019-01-20 (Rename: TlsReader -> Tls)
+ * @date   2026-10-19 (Verify the certificate & host name of the server)
  */
 
 #include <libtbag/crypto/Tls.hpp>
@@ -16,8 +17,11 @@
 #include <openssl/ssl.h>
 #include <openssl/conf.h>
 #include <openssl/engine.h>
+#include <openssl/x509v3.h>
 
 #include <cassert>
+#include <cstring>
+#include <algorithm>
 #include <string>
 
 // -------------------
@@ -368,6 +372,11 @@ struct Tls::Impl : private Noncopyable
         return BIO_pending(read_bio);
     }
 
+    inline int pendingSsl() const
+    {
+        return SSL_pending(ssl.get());
+    }
+
     Err readFromWriteBuffer(std::vector<char> & result)
     {
         int const PENDING = pendingWriteBio();
@@ -482,13 +491,215 @@ struct Tls::Impl : private Noncopyable
     /** Read & decode from pending data. */
     Err decode(std::vector<char> & result)
     {
-        int const PENDING_SIZE = pendingReadBio();
+        // A record larger than the previous read buffer remains in the SSL object.
+        int const PENDING_SIZE = std::max(pendingReadBio(), pendingSsl());
         if (PENDING_SIZE <= 0) {
             return E_SSLEREAD;
         }
         assert(PENDING_SIZE > 0);
         return read(result, static_cast<std::size_t>(PENDING_SIZE));
     }
+
+    /**
+     * @remarks
+     *  <pre>
+     *   BIO(read) -> SSL_read() -> Caller's buffer.
+     *  </pre>
+     */
+    Err readSpan(char * buffer, std::size_t size, std::size_t * read_size)
+    {
+        assert(static_cast<bool>(ssl));
+        int const READ_RESULT = SSL_read(ssl.get(), buffer, static_cast<int>(size));
+        if (READ_RESULT <= 0) {
+            if (read_size != nullptr) {
+                *read_size = 0;
+            }
+            switch (SSL_get_error(ssl.get(), READ_RESULT)) {
+            case SSL_ERROR_WANT_READ:   return E_SSLWREAD;
+            case SSL_ERROR_ZERO_RETURN: return E_EOF;
+            default:                    return E_SSL;
+            }
+        }
+        if (read_size != nullptr) {
+            *read_size = static_cast<std::size_t>(READ_RESULT);
+        }
+        return E_SUCCESS;
+    }
+
+    Err writeSpan(char const * data, std::size_t size)
+    {
+        assert(static_cast<bool>(ssl));
+        if (size == 0) {
+            return E_SUCCESS;
+        }
+        // The memory BIO never blocks, so the whole buffer is written at once.
+        int const WRITE_RESULT = SSL_write(ssl.get(), data, static_cast<int>(size));
+        if (WRITE_RESULT <= 0) {
+            tDLogE("Tls::Impl::writeSpan() OpenSSL SSL_write() error: reason({})",
+                   SSL_get_error(ssl.get(), WRITE_RESULT));
+            return E_SSL;
+        }
+        assert(static_cast<std::size_t>(WRITE_RESULT) == size);
+        return E_SUCCESS;
+    }
+
+    /** Plain bytes of the record being coalesced. */
+    std::vector<char> staging;
+
+    Err writeSpans(libtbag::util::binf const * infos, std::size_t size)
+    {
+        std::size_t const RECORD = Tls::MAX_RECORD_SIZE;
+        std::size_t staged = 0;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            char const * cursor = infos[i].buffer;
+            std::size_t remain = infos[i].size;
+
+            while (remain > 0) {
+                if (staged == 0 && remain >= RECORD) {
+                    // Whole records are encrypted from the caller's buffer.
+                    auto const DIRECT = remain - (remain % RECORD);
+                    auto const CODE = writeSpan(cursor, DIRECT);
+                    if (isFailure(CODE)) {
+                        return CODE;
+                    }
+                    cursor += DIRECT;
+                    remain -= DIRECT;
+                    continue;
+                }
+
+                if (staging.size() < RECORD) {
+                    staging.resize(RECORD);
+                }
+                auto const COPY = (std::min)(remain, RECORD - staged);
+                memcpy(staging.data() + staged, cursor, COPY);
+                staged += COPY;
+                cursor += COPY;
+                remain -= COPY;
+
+                if (staged == RECORD) {
+                    auto const CODE = writeSpan(staging.data(), staged);
+                    if (isFailure(CODE)) {
+                        return CODE;
+                    }
+                    staged = 0;
+                }
+            }
+        }
+        return writeSpan(staging.data(), staged);
+    }
+
+    std::size_t drainSpan(char * buffer, std::size_t size)
+    {
+        int const PENDING = pendingWriteBio();
+        if (PENDING <= 0 || size == 0) {
+            return 0;
+        }
+        auto const READ_SIZE = (std::min)(static_cast<std::size_t>(PENDING), size);
+        int const BIO_READ_RESULT = BIO_read(write_bio, buffer, static_cast<int>(READ_SIZE));
+        return BIO_READ_RESULT > 0 ? static_cast<std::size_t>(BIO_READ_RESULT) : 0;
+    }
+
+    std::size_t drainAll(std::vector<char> & buffer)
+    {
+        int const PENDING = pendingWriteBio();
+        if (PENDING <= 0) {
+            return 0;
+        }
+        auto const OFFSET = buffer.size();
+        buffer.resize(OFFSET + static_cast<std::size_t>(PENDING));
+        auto const READ_SIZE = drainSpan(buffer.data() + OFFSET, static_cast<std::size_t>(PENDING));
+        buffer.resize(OFFSET + READ_SIZE);
+        return READ_SIZE;
+    }
+
+    TlsSession getSession() const
+    {
+        assert(static_cast<bool>(ssl));
+        TlsSession result;
+        SSL_SESSION * session = SSL_get1_session(ssl.get());
+        if (session != nullptr) {
+            result._session.reset(session, [](void * s){
+                SSL_SESSION_free(static_cast<SSL_SESSION*>(s));
+            });
+        }
+        return result;
+    }
+
+    bool setSession(TlsSession const & session)
+    {
+        assert(static_cast<bool>(ssl));
+        if (!session.exists()) {
+            return false;
+        }
+        return SSL_set_session(ssl.get(), static_cast<SSL_SESSION*>(session._session.get())) == 1;
+    }
+
+    bool isSessionReused() const
+    {
+        assert(static_cast<bool>(ssl));
+        return SSL_session_reused(ssl.get()) == 1;
+    }
+
+    bool setVerifyPeer(std::string const & ca_file)
+    {
+        assert(static_cast<bool>(context));
+        // The well-known CA bundles of the systems.
+        // (The default path of the LibreSSL depends on the install prefix)
+        static char const * const SYSTEM_CA_FILES[] = {
+                "/etc/ssl/certs/ca-certificates.crt", // Debian, Ubuntu, Arch
+                "/etc/pki/tls/certs/ca-bundle.crt",   // Fedora, RHEL
+                "/etc/ssl/ca-bundle.pem",             // OpenSUSE
+                "/etc/ssl/cert.pem",                  // Alpine, macOS, OpenBSD
+        };
+
+        SSL_CTX_set_verify(context.get(), SSL_VERIFY_PEER, nullptr);
+        SSL_CTX_set_default_verify_paths(context.get());
+        for (auto const * path : SYSTEM_CA_FILES) {
+            if (SSL_CTX_load_verify_locations(context.get(), path, nullptr) == 1) {
+                break;
+            }
+        }
+        ERR_clear_error();
+
+        if (!ca_file.empty() && SSL_CTX_load_verify_locations(context.get(), ca_file.c_str(), nullptr) != 1) {
+            tDLogE("Tls::Impl::setVerifyPeer() Load CA file error: {}", ca_file);
+            ERR_clear_error();
+            return false;
+        }
+        return true;
+    }
+
+    bool setHostName(std::string const & host)
+    {
+        assert(static_cast<bool>(ssl));
+        // The IP address is not sent as the SNI. (RFC 6066)
+        if (X509_VERIFY_PARAM_set1_ip_asc(SSL_get0_param(ssl.get()), host.c_str()) == 1) {
+            return true;
+        }
+        if (SSL_set_tlsext_host_name(ssl.get(), host.c_str()) != 1) {
+            return false;
+        }
+        return SSL_set1_host(ssl.get(), host.c_str()) == 1;
+    }
+
+    std::string getVerifyError() const
+    {
+        assert(static_cast<bool>(ssl));
+        return X509_verify_cert_error_string(SSL_get_verify_result(ssl.get()));
+    }
+
+    bool enableSessionCache(std::size_t cache_size, long timeout_seconds)
+    {
+        assert(static_cast<bool>(context));
+        static unsigned char const SESSION_ID_CONTEXT[] = "libtbag";
+
+        SSL_CTX_set_session_cache_mode(context.get(), SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(context.get(), static_cast<long>(cache_size));
+        SSL_CTX_set_timeout(context.get(), timeout_seconds);
+        SSL_CTX_clear_options(context.get(), SSL_OP_NO_TICKET);
+        return SSL_CTX_set_session_id_context(context.get(), SESSION_ID_CONTEXT, sizeof(SESSION_ID_CONTEXT) - 1) == 1;
+    }
 };
 
 // ------------------
@@ -583,6 +794,12 @@ int Tls::pendingOfDecodeBufferSize() const
     return _impl->pendingReadBio();
 }
 
+int Tls::pendingOfDecodedSize() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->pendingSsl();
+}
+
 std::vector<char> Tls::encode(void const * data, std::size_t size, Err * code)
 {
     assert(static_cast<bool>(_impl));
@@ -616,6 +833,78 @@ std::vector<char> Tls::decode(Err * code)
     return result;
 }
 
+Err Tls::read(char * buffer, std::size_t size, std::size_t * read_size)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->readSpan(buffer, size, read_size);
+}
+
+Err Tls::write(char const * data, std::size_t size)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->writeSpan(data, size);
+}
+
+Err Tls::write(libtbag::util::binf const * infos, std::size_t size)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->writeSpans(infos, size);
+}
+
+std::size_t Tls::drain(char * buffer, std::size_t size)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->drainSpan(buffer, size);
+}
+
+std::size_t Tls::drain(std::vector<char> & buffer)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->drainAll(buffer);
+}
+
+TlsSession Tls::getSession() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->getSession();
+}
+
+bool Tls::setSession(TlsSession const & session)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->setSession(session);
+}
+
+bool Tls::setVerifyPeer(std::string const & ca_file)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->setVerifyPeer(ca_file);
+}
+
+bool Tls::setHostName(std::string const & host)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->setHostName(host);
+}
+
+std::string Tls::getVerifyError() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->getVerifyError();
+}
+
+bool Tls::isSessionReused() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->isSessionReused();
+}
+
+bool Tls::enableSessionCache(std::size_t cache_size, long timeout_seconds)
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->enableSessionCache(cache_size, timeout_seconds);
+}
+
 // ------------------------
 // TlsReader implementation
 // ------------------------
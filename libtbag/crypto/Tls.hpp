@@ -6,6 +6,7 @@
  * @date   2018-12-25 (Change namespace: libtbag::network::http::tls -> libtbag::http)
  * @date   2019-01-13 (Change namespace: libtbag::http -> libtbag::crypto)
  * @date   2019-01-20 (Rename: TlsReader -> Tls)
+ * @date   2026-10-19 (Verify the certificate & host name of the server)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_TLSREADER_HPP__
@@ -22,6 +23,7 @@
 #include <libtbag/Noncopyable.hpp>
 #include <libtbag/crypto/X509.hpp>
 #include <libtbag/uvpp/UvCommon.hpp>
+#include <libtbag/util/BufferInfo.hpp>
 
 #include <memory>
 #include <vector>
@@ -33,6 +35,39 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace crypto {
 
+/**
+ * Negotiated session of a client connection.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Set it to the next connection of the same server to resume the session (See Tls::setSession()). @n
+ *  The abbreviated handshake skips the key exchange and the certificate verification.
+ */
+class TBAG_API TlsSession
+{
+    friend class Tls;
+
+private:
+    /** SSL_SESSION of the OpenSSL. */
+    std::shared_ptr<void> _session;
+
+public:
+    TlsSession() { /* EMPTY. */ }
+    ~TlsSession() { /* EMPTY. */ }
+
+public:
+    inline bool exists() const TBAG_NOEXCEPT
+    { return static_cast<bool>(_session); }
+
+    inline operator bool() const TBAG_NOEXCEPT
+    { return exists(); }
+
+    inline void reset()
+    { _session.reset(); }
+};
+
 /**
  * Tls class prototype.
  *
@@ -109,12 +144,92 @@ public:
     int pendingOfEncodeBufferSize() const;
     int pendingOfDecodeBufferSize() const;
 
+    /** Size of the decrypted bytes buffered in the SSL object. (Not yet returned by decode()) */
+    int pendingOfDecodedSize() const;
+
 public:
     std::vector<char> encode(void const * data, std::size_t size, Err * code);
     std::vector<char> decode(void const * data, std::size_t size, Err * code);
 
     /** Read & decode from pending data. */
     std::vector<char> decode(Err * code);
+
+public:
+    TBAG_CONSTEXPR static std::size_t const MAX_RECORD_SIZE = 16 * 1024;
+
+    /**
+     * Decrypt the pending records into the caller's buffer.
+     *
+     * @return
+     *  If more encrypted bytes are required, E_SSLWREAD is returned.
+     */
+    Err read(char * buffer, std::size_t size, std::size_t * read_size);
+
+    /**
+     * Encrypt the plain bytes.
+     *
+     * @remarks
+     *  The records are kept in the write buffer until drained. (See drain())
+     */
+    Err write(char const * data, std::size_t size);
+
+    /**
+     * Encrypt the buffers as full-size records.
+     *
+     * @remarks
+     *  Small buffers are coalesced up to the MAX_RECORD_SIZE, @n
+     *  so the record overhead (header, MAC and padding) is paid once per record.
+     */
+    Err write(libtbag::util::binf const * infos, std::size_t size);
+
+    /** Move the encrypted bytes into the caller's buffer. */
+    std::size_t drain(char * buffer, std::size_t size);
+
+    /** Append all encrypted bytes to the buffer. */
+    std::size_t drain(std::vector<char> & buffer);
+
+public:
+    /** Session of the finished handshake. (Client-side) */
+    TlsSession getSession() const;
+
+    /** Resume the session. Call it before the connect(). (Client-side) */
+    bool setSession(TlsSession const & session);
+
+    /** The last handshake resumed a session. */
+    bool isSessionReused() const;
+
+public:
+    /**
+     * Verify the certificate of the server. (Client-side context)
+     *
+     * @remarks
+     *  The default CA paths and the CA bundle of the system are loaded. @n
+     *  The nodes created after this call inherit the verification. (See reference_ssl_context)
+     *
+     * @param[in] ca_file
+     *      Additional PEM file of the trusted certificates. (Optional)
+     */
+    bool setVerifyPeer(std::string const & ca_file = std::string());
+
+    /**
+     * Send the SNI and verify the host name of the certificate. Call it before the connect(). (Client-side)
+     *
+     * @remarks
+     *  If the host is an IP address, the SNI is not sent and the IP address is verified.
+     */
+    bool setHostName(std::string const & host);
+
+    /** Reason of the last certificate verification. */
+    std::string getVerifyError() const;
+
+    /**
+     * Enable the server-side session cache and the session tickets.
+     *
+     * @remarks
+     *  The cache belongs to the SSL context, @n
+     *  so it is shared by all nodes of the context. (See reference_ssl_context)
+     */
+    bool enableSessionCache(std::size_t cache_size = 1024, long timeout_seconds = 300);
 };
 
 enum class TlsState
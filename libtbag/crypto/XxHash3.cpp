@@ -0,0 +1,492 @@
+/**
+ * @file   XxHash3.cpp
+ * @brief  XxHash3 class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/crypto/XxHash3.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__AVX2__)
+# include <immintrin.h>
+# define TBAG_XXHASH3_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+# include <emmintrin.h>
+# define TBAG_XXHASH3_SSE2
+#endif
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace crypto {
+
+TBAG_CONSTEXPR static uint32_t const XXH_PRIME32_1 = 0x9E3779B1u;
+TBAG_CONSTEXPR static uint32_t const XXH_PRIME32_2 = 0x85EBCA77u;
+TBAG_CONSTEXPR static uint32_t const XXH_PRIME32_3 = 0xC2B2AE3Du;
+TBAG_CONSTEXPR static uint64_t const XXH_PRIME64_1 = 0x9E3779B185EBCA87ull;
+TBAG_CONSTEXPR static uint64_t const XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4Full;
+TBAG_CONSTEXPR static uint64_t const XXH_PRIME64_3 = 0x165667B19E3779F9ull;
+TBAG_CONSTEXPR static uint64_t const XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ull;
+TBAG_CONSTEXPR static uint64_t const XXH_PRIME64_5 = 0x27D4EB2F165667C5ull;
+TBAG_CONSTEXPR static uint64_t const XXH_PRIME_MX1 = 0x165667919E3779F9ull;
+TBAG_CONSTEXPR static uint64_t const XXH_PRIME_MX2 = 0x9FB21C651E98DF25ull;
+
+/** Bytes of the secret consumed by each stripe. */
+TBAG_CONSTEXPR static std::size_t const XXH_SECRET_CONSUME_RATE = 8;
+TBAG_CONSTEXPR static std::size_t const XXH_SECRET_SIZE_MIN = 136;
+TBAG_CONSTEXPR static std::size_t const XXH_SECRET_LASTACC_START = 7;
+TBAG_CONSTEXPR static std::size_t const XXH_SECRET_MERGEACCS_START = 11;
+TBAG_CONSTEXPR static std::size_t const XXH_MIDSIZE_STARTOFFSET = 3;
+TBAG_CONSTEXPR static std::size_t const XXH_MIDSIZE_LASTOFFSET = 17;
+
+TBAG_CONSTEXPR static std::size_t const XXH_SECRET_LIMIT = XxHash3::SECRET_SIZE - XxHash3::STRIPE_LEN;
+TBAG_CONSTEXPR static std::size_t const XXH_STRIPES_PER_BLOCK = XXH_SECRET_LIMIT / XXH_SECRET_CONSUME_RATE;
+
+/** Pseudorandom secret taken directly from FARSH. */
+static uint8_t const XXH3_SECRET[XxHash3::SECRET_SIZE] = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+        0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+        0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+        0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+        0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+        0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+        0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+        0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+        0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static inline uint32_t readLe32(uint8_t const * p) TBAG_NOEXCEPT
+{
+    return static_cast<uint32_t>(p[0])       | static_cast<uint32_t>(p[1]) <<  8 |
+           static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+
+static inline uint64_t readLe64(uint8_t const * p) TBAG_NOEXCEPT
+{
+    return static_cast<uint64_t>(readLe32(p)) | static_cast<uint64_t>(readLe32(p + 4)) << 32;
+}
+
+static inline void writeLe64(uint8_t * p, uint64_t x) TBAG_NOEXCEPT
+{
+    for (int i = 0; i < 8; ++i) {
+        p[i] = static_cast<uint8_t>(x >> (8 * i));
+    }
+}
+
+static inline uint32_t swap32(uint32_t x) TBAG_NOEXCEPT
+{
+    return (x << 24) | ((x << 8) & 0x00FF0000u) | ((x >> 8) & 0x0000FF00u) | (x >> 24);
+}
+
+static inline uint64_t swap64(uint64_t x) TBAG_NOEXCEPT
+{
+    return static_cast<uint64_t>(swap32(static_cast<uint32_t>(x))) << 32 | swap32(static_cast<uint32_t>(x >> 32));
+}
+
+static inline uint64_t rotl64(uint64_t x, int n) TBAG_NOEXCEPT
+{
+    return (x << n) | (x >> (64 - n));
+}
+
+static inline uint64_t mul128Fold64(uint64_t lhs, uint64_t rhs) TBAG_NOEXCEPT
+{
+#if defined(__SIZEOF_INT128__)
+    auto const PRODUCT = static_cast<unsigned __int128>(lhs) * rhs;
+    return static_cast<uint64_t>(PRODUCT) ^ static_cast<uint64_t>(PRODUCT >> 64);
+#else
+    uint64_t const LO_LO = (lhs & 0xFFFFFFFFu) * (rhs & 0xFFFFFFFFu);
+    uint64_t const HI_LO = (lhs >> 32)         * (rhs & 0xFFFFFFFFu);
+    uint64_t const LO_HI = (lhs & 0xFFFFFFFFu) * (rhs >> 32);
+    uint64_t const HI_HI = (lhs >> 32)         * (rhs >> 32);
+    uint64_t const CROSS = (LO_LO >> 32) + (HI_LO & 0xFFFFFFFFu) + LO_HI;
+    uint64_t const UPPER = (HI_LO >> 32) + (CROSS >> 32) + HI_HI;
+    uint64_t const LOWER = (CROSS << 32) | (LO_LO & 0xFFFFFFFFu);
+    return LOWER ^ UPPER;
+#endif
+}
+
+static inline uint64_t xxh64Avalanche(uint64_t h) TBAG_NOEXCEPT
+{
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t xxh3Avalanche(uint64_t h) TBAG_NOEXCEPT
+{
+    h ^= h >> 37;
+    h *= XXH_PRIME_MX1;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline uint64_t xxh3Rrmxmx(uint64_t h, uint64_t len) TBAG_NOEXCEPT
+{
+    h ^= rotl64(h, 49) ^ rotl64(h, 24);
+    h *= XXH_PRIME_MX2;
+    h ^= (h >> 35) + len;
+    h *= XXH_PRIME_MX2;
+    return h ^ (h >> 28);
+}
+
+static inline uint64_t mix16B(uint8_t const * input, uint8_t const * secret, uint64_t seed) TBAG_NOEXCEPT
+{
+    return mul128Fold64(readLe64(input)     ^ (readLe64(secret)     + seed),
+                        readLe64(input + 8) ^ (readLe64(secret + 8) - seed));
+}
+
+// ------------------
+// Short inputs.
+// ------------------
+
+static uint64_t hashLen0To16(uint8_t const * input, std::size_t len, uint8_t const * secret, uint64_t seed) TBAG_NOEXCEPT
+{
+    if (len > 8) {
+        uint64_t const BITFLIP1 = (readLe64(secret + 24) ^ readLe64(secret + 32)) + seed;
+        uint64_t const BITFLIP2 = (readLe64(secret + 40) ^ readLe64(secret + 48)) - seed;
+        uint64_t const INPUT_LO = readLe64(input) ^ BITFLIP1;
+        uint64_t const INPUT_HI = readLe64(input + len - 8) ^ BITFLIP2;
+        uint64_t const ACC = len + swap64(INPUT_LO) + INPUT_HI + mul128Fold64(INPUT_LO, INPUT_HI);
+        return xxh3Avalanche(ACC);
+    }
+    if (len >= 4) {
+        seed ^= static_cast<uint64_t>(swap32(static_cast<uint32_t>(seed))) << 32;
+        uint32_t const INPUT1 = readLe32(input);
+        uint32_t const INPUT2 = readLe32(input + len - 4);
+        uint64_t const BITFLIP = (readLe64(secret + 8) ^ readLe64(secret + 16)) - seed;
+        uint64_t const INPUT64 = INPUT2 + (static_cast<uint64_t>(INPUT1) << 32);
+        return xxh3Rrmxmx(INPUT64 ^ BITFLIP, len);
+    }
+    if (len > 0) {
+        uint32_t const COMBINED = (static_cast<uint32_t>(input[0]) << 16) |
+                                  (static_cast<uint32_t>(input[len >> 1]) << 24) |
+                                  (static_cast<uint32_t>(input[len - 1])) |
+                                  (static_cast<uint32_t>(len) << 8);
+        uint64_t const BITFLIP = (readLe32(secret) ^ readLe32(secret + 4)) + seed;
+        return xxh64Avalanche(static_cast<uint64_t>(COMBINED) ^ BITFLIP);
+    }
+    return xxh64Avalanche(seed ^ (readLe64(secret + 56) ^ readLe64(secret + 64)));
+}
+
+static uint64_t hashLen17To128(uint8_t const * input, std::size_t len, uint8_t const * secret, uint64_t seed) TBAG_NOEXCEPT
+{
+    uint64_t acc = len * XXH_PRIME64_1;
+    if (len > 32) {
+        if (len > 64) {
+            if (len > 96) {
+                acc += mix16B(input + 48, secret + 96, seed);
+                acc += mix16B(input + len - 64, secret + 112, seed);
+            }
+            acc += mix16B(input + 32, secret + 64, seed);
+            acc += mix16B(input + len - 48, secret + 80, seed);
+        }
+        acc += mix16B(input + 16, secret + 32, seed);
+        acc += mix16B(input + len - 32, secret + 48, seed);
+    }
+    acc += mix16B(input, secret, seed);
+    acc += mix16B(input + len - 16, secret + 16, seed);
+    return xxh3Avalanche(acc);
+}
+
+static uint64_t hashLen129To240(uint8_t const * input, std::size_t len, uint8_t const * secret, uint64_t seed) TBAG_NOEXCEPT
+{
+    uint64_t acc = len * XXH_PRIME64_1;
+    std::size_t const ROUNDS = len / 16;
+    for (std::size_t i = 0; i < 8; ++i) {
+        acc += mix16B(input + 16 * i, secret + 16 * i, seed);
+    }
+    uint64_t acc_end = mix16B(input + len - 16, secret + XXH_SECRET_SIZE_MIN - XXH_MIDSIZE_LASTOFFSET, seed);
+    acc = xxh3Avalanche(acc);
+    for (std::size_t i = 8; i < ROUNDS; ++i) {
+        acc_end += mix16B(input + 16 * i, secret + 16 * (i - 8) + XXH_MIDSIZE_STARTOFFSET, seed);
+    }
+    return xxh3Avalanche(acc + acc_end);
+}
+
+static uint64_t hashShort(uint8_t const * input, std::size_t len, uint64_t seed) TBAG_NOEXCEPT
+{
+    assert(len <= XxHash3::MIDSIZE_MAX);
+    if (len <= 16) {
+        return hashLen0To16(input, len, XXH3_SECRET, seed);
+    } else if (len <= 128) {
+        return hashLen17To128(input, len, XXH3_SECRET, seed);
+    }
+    return hashLen129To240(input, len, XXH3_SECRET, seed);
+}
+
+// ------------------
+// Long inputs.
+// ------------------
+
+static void accumulate512(uint64_t * acc, uint8_t const * input, uint8_t const * secret) TBAG_NOEXCEPT
+{
+#if defined(TBAG_XXHASH3_AVX2)
+    for (int i = 0; i < 2; ++i) {
+        auto * a = reinterpret_cast<__m256i*>(acc) + i;
+        __m256i const DATA = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input) + i);
+        __m256i const KEY  = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(secret) + i);
+        __m256i const DATA_KEY = _mm256_xor_si256(DATA, KEY);
+        __m256i const PRODUCT  = _mm256_mul_epu32(DATA_KEY, _mm256_srli_epi64(DATA_KEY, 32));
+        __m256i const SUM = _mm256_add_epi64(_mm256_loadu_si256(a), _mm256_shuffle_epi32(DATA, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm256_storeu_si256(a, _mm256_add_epi64(PRODUCT, SUM));
+    }
+#elif defined(TBAG_XXHASH3_SSE2)
+    for (int i = 0; i < 4; ++i) {
+        auto * a = reinterpret_cast<__m128i*>(acc) + i;
+        __m128i const DATA = _mm_loadu_si128(reinterpret_cast<__m128i const *>(input) + i);
+        __m128i const KEY  = _mm_loadu_si128(reinterpret_cast<__m128i const *>(secret) + i);
+        __m128i const DATA_KEY = _mm_xor_si128(DATA, KEY);
+        __m128i const PRODUCT  = _mm_mul_epu32(DATA_KEY, _mm_shuffle_epi32(DATA_KEY, _MM_SHUFFLE(0, 3, 0, 1)));
+        __m128i const SUM = _mm_add_epi64(_mm_loadu_si128(a), _mm_shuffle_epi32(DATA, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_si128(a, _mm_add_epi64(PRODUCT, SUM));
+    }
+#else
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+        uint64_t const DATA = readLe64(input + lane * 8);
+        uint64_t const DATA_KEY = DATA ^ readLe64(secret + lane * 8);
+        acc[lane ^ 1] += DATA; // Swap adjacent lanes.
+        acc[lane] += (DATA_KEY & 0xFFFFFFFFu) * (DATA_KEY >> 32);
+    }
+#endif
+}
+
+static void scrambleAcc(uint64_t * acc, uint8_t const * secret) TBAG_NOEXCEPT
+{
+#if defined(TBAG_XXHASH3_AVX2)
+    __m256i const PRIME32 = _mm256_set1_epi32(static_cast<int>(XXH_PRIME32_1));
+    for (int i = 0; i < 2; ++i) {
+        auto * a = reinterpret_cast<__m256i*>(acc) + i;
+        __m256i const ACC = _mm256_loadu_si256(a);
+        __m256i const KEY = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(secret) + i);
+        __m256i const DATA_KEY = _mm256_xor_si256(_mm256_xor_si256(ACC, _mm256_srli_epi64(ACC, 47)), KEY);
+        __m256i const PROD_LO = _mm256_mul_epu32(DATA_KEY, PRIME32);
+        __m256i const PROD_HI = _mm256_mul_epu32(_mm256_srli_epi64(DATA_KEY, 32), PRIME32);
+        _mm256_storeu_si256(a, _mm256_add_epi64(PROD_LO, _mm256_slli_epi64(PROD_HI, 32)));
+    }
+#elif defined(TBAG_XXHASH3_SSE2)
+    __m128i const PRIME32 = _mm_set1_epi32(static_cast<int>(XXH_PRIME32_1));
+    for (int i = 0; i < 4; ++i) {
+        auto * a = reinterpret_cast<__m128i*>(acc) + i;
+        __m128i const ACC = _mm_loadu_si128(a);
+        __m128i const KEY = _mm_loadu_si128(reinterpret_cast<__m128i const *>(secret) + i);
+        __m128i const DATA_KEY = _mm_xor_si128(_mm_xor_si128(ACC, _mm_srli_epi64(ACC, 47)), KEY);
+        __m128i const PROD_LO = _mm_mul_epu32(DATA_KEY, PRIME32);
+        __m128i const PROD_HI = _mm_mul_epu32(_mm_shuffle_epi32(DATA_KEY, _MM_SHUFFLE(0, 3, 0, 1)), PRIME32);
+        _mm_storeu_si128(a, _mm_add_epi64(PROD_LO, _mm_slli_epi64(PROD_HI, 32)));
+    }
+#else
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+        uint64_t value = acc[lane];
+        value ^= value >> 47;
+        value ^= readLe64(secret + lane * 8);
+        value *= XXH_PRIME32_1;
+        acc[lane] = value;
+    }
+#endif
+}
+
+static inline void accumulate(uint64_t * acc, uint8_t const * input, uint8_t const * secret,
+                              std::size_t stripes) TBAG_NOEXCEPT
+{
+    for (std::size_t n = 0; n < stripes; ++n) {
+        accumulate512(acc, input + n * XxHash3::STRIPE_LEN, secret + n * XXH_SECRET_CONSUME_RATE);
+    }
+}
+
+static inline void initAcc(uint64_t * acc) TBAG_NOEXCEPT
+{
+    acc[0] = XXH_PRIME32_3;
+    acc[1] = XXH_PRIME64_1;
+    acc[2] = XXH_PRIME64_2;
+    acc[3] = XXH_PRIME64_3;
+    acc[4] = XXH_PRIME64_4;
+    acc[5] = XXH_PRIME32_2;
+    acc[6] = XXH_PRIME64_5;
+    acc[7] = XXH_PRIME32_1;
+}
+
+static void initCustomSecret(uint8_t * secret, uint64_t seed) TBAG_NOEXCEPT
+{
+    for (std::size_t i = 0; i < XxHash3::SECRET_SIZE / 16; ++i) {
+        writeLe64(secret + 16 * i,     readLe64(XXH3_SECRET + 16 * i)     + seed);
+        writeLe64(secret + 16 * i + 8, readLe64(XXH3_SECRET + 16 * i + 8) - seed);
+    }
+}
+
+static uint64_t mergeAccs(uint64_t const * acc, uint8_t const * secret, uint64_t start) TBAG_NOEXCEPT
+{
+    uint64_t result = start;
+    for (std::size_t i = 0; i < 4; ++i) {
+        result += mul128Fold64(acc[2 * i] ^ readLe64(secret + 16 * i), acc[2 * i + 1] ^ readLe64(secret + 16 * i + 8));
+    }
+    return xxh3Avalanche(result);
+}
+
+static uint64_t hashLong(uint8_t const * input, std::size_t len, uint8_t const * secret) TBAG_NOEXCEPT
+{
+    uint64_t acc[8];
+    initAcc(acc);
+
+    std::size_t const BLOCK_LEN = XxHash3::STRIPE_LEN * XXH_STRIPES_PER_BLOCK;
+    std::size_t const BLOCKS = (len - 1) / BLOCK_LEN;
+    for (std::size_t n = 0; n < BLOCKS; ++n) {
+        accumulate(acc, input + n * BLOCK_LEN, secret, XXH_STRIPES_PER_BLOCK);
+        scrambleAcc(acc, secret + XXH_SECRET_LIMIT);
+    }
+
+    std::size_t const STRIPES = ((len - 1) - (BLOCK_LEN * BLOCKS)) / XxHash3::STRIPE_LEN;
+    accumulate(acc, input + BLOCKS * BLOCK_LEN, secret, STRIPES);
+    accumulate512(acc, input + len - XxHash3::STRIPE_LEN, secret + XXH_SECRET_LIMIT - XXH_SECRET_LASTACC_START);
+    return mergeAccs(acc, secret + XXH_SECRET_MERGEACCS_START, len * XXH_PRIME64_1);
+}
+
+// ----------------------
+// XxHash3 implementation.
+// ----------------------
+
+XxHash3::XxHash3(uint64_t seed) TBAG_NOEXCEPT : _seed(seed)
+{
+    if (seed == 0) {
+        ::memcpy(_secret, XXH3_SECRET, sizeof(_secret));
+    } else {
+        initCustomSecret(_secret, seed);
+    }
+    reset();
+}
+
+XxHash3::~XxHash3()
+{
+    // EMPTY.
+}
+
+void XxHash3::consumeStripes(uint8_t const * input, std::size_t stripes) TBAG_NOEXCEPT
+{
+    while (stripes > 0) {
+        auto const COUNT = std::min(stripes, XXH_STRIPES_PER_BLOCK - _stripes_so_far);
+        accumulate(_acc, input, _secret + _stripes_so_far * XXH_SECRET_CONSUME_RATE, COUNT);
+        _stripes_so_far += COUNT;
+        input += COUNT * STRIPE_LEN;
+        stripes -= COUNT;
+        if (_stripes_so_far == XXH_STRIPES_PER_BLOCK) {
+            scrambleAcc(_acc, _secret + XXH_SECRET_LIMIT);
+            _stripes_so_far = 0;
+        }
+    }
+}
+
+void XxHash3::update(void const * data, std::size_t size) TBAG_NOEXCEPT
+{
+    if (size == 0) {
+        return;
+    }
+
+    auto const * input = static_cast<uint8_t const *>(data);
+    auto const * end = input + size;
+    _total += size;
+
+    if (size <= BUFFER_SIZE - _buffer_size) {
+        ::memcpy(_buffer + _buffer_size, input, size);
+        _buffer_size += size;
+        return;
+    }
+
+    // The last stripe is always kept in the buffer for the digest().
+    if (_buffer_size > 0) {
+        auto const LOAD_SIZE = BUFFER_SIZE - _buffer_size;
+        ::memcpy(_buffer + _buffer_size, input, LOAD_SIZE);
+        input += LOAD_SIZE;
+        consumeStripes(_buffer, BUFFER_SIZE / STRIPE_LEN);
+        _buffer_size = 0;
+    }
+
+    assert(input < end);
+    if (static_cast<std::size_t>(end - input) > BUFFER_SIZE) {
+        auto const STRIPES = static_cast<std::size_t>(end - 1 - input) / STRIPE_LEN;
+        consumeStripes(input, STRIPES);
+        input += STRIPES * STRIPE_LEN;
+        ::memcpy(_buffer + BUFFER_SIZE - STRIPE_LEN, input - STRIPE_LEN, STRIPE_LEN);
+    }
+
+    _buffer_size = static_cast<std::size_t>(end - input);
+    ::memcpy(_buffer, input, _buffer_size);
+}
+
+uint64_t XxHash3::digest() const TBAG_NOEXCEPT
+{
+    if (_total <= MIDSIZE_MAX) {
+        return hashShort(_buffer, static_cast<std::size_t>(_total), _seed);
+    }
+
+    uint64_t acc[8];
+    ::memcpy(acc, _acc, sizeof(acc));
+
+    uint8_t last_stripe[STRIPE_LEN];
+    uint8_t const * last_stripe_ptr;
+
+    if (_buffer_size >= STRIPE_LEN) {
+        // Same as the consumeStripes(), without the modification of the state.
+        auto stripes = (_buffer_size - 1) / STRIPE_LEN;
+        auto stripes_so_far = _stripes_so_far;
+        uint8_t const * input = _buffer;
+        while (stripes > 0) {
+            auto const COUNT = std::min(stripes, XXH_STRIPES_PER_BLOCK - stripes_so_far);
+            accumulate(acc, input, _secret + stripes_so_far * XXH_SECRET_CONSUME_RATE, COUNT);
+            stripes_so_far += COUNT;
+            input += COUNT * STRIPE_LEN;
+            stripes -= COUNT;
+            if (stripes_so_far == XXH_STRIPES_PER_BLOCK) {
+                scrambleAcc(acc, _secret + XXH_SECRET_LIMIT);
+                stripes_so_far = 0;
+            }
+        }
+        last_stripe_ptr = _buffer + _buffer_size - STRIPE_LEN;
+    } else {
+        auto const CATCHUP_SIZE = STRIPE_LEN - _buffer_size;
+        ::memcpy(last_stripe, _buffer + BUFFER_SIZE - CATCHUP_SIZE, CATCHUP_SIZE);
+        ::memcpy(last_stripe + CATCHUP_SIZE, _buffer, _buffer_size);
+        last_stripe_ptr = last_stripe;
+    }
+
+    accumulate512(acc, last_stripe_ptr, _secret + XXH_SECRET_LIMIT - XXH_SECRET_LASTACC_START);
+    return mergeAccs(acc, _secret + XXH_SECRET_MERGEACCS_START, _total * XXH_PRIME64_1);
+}
+
+void XxHash3::reset() TBAG_NOEXCEPT
+{
+    initAcc(_acc);
+    _buffer_size = 0;
+    _stripes_so_far = 0;
+    _total = 0;
+}
+
+uint64_t XxHash3::hash(void const * data, std::size_t size, uint64_t seed) TBAG_NOEXCEPT
+{
+    auto const * input = static_cast<uint8_t const *>(data);
+    if (size <= MIDSIZE_MAX) {
+        return hashShort(input, size, seed);
+    }
+    if (seed == 0) {
+        return hashLong(input, size, XXH3_SECRET);
+    }
+    uint8_t secret[SECRET_SIZE];
+    initCustomSecret(secret, seed);
+    return hashLong(input, size, secret);
+}
+
+} // namespace crypto
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
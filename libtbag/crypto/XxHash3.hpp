@@ -0,0 +1,84 @@
+/**
+ * @file   XxHash3.hpp
+ * @brief  XxHash3 class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_XXHASH3_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_XXHASH3_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+
+#include <cstdint>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace crypto {
+
+/**
+ * XxHash3 class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Non-cryptographic 64bit hash. (XXH3_64bits of the xxHash library) @n
+ *  The output is equal to the XXH3_64bits_withSeed() of the reference implementation.
+ */
+class TBAG_API XxHash3
+{
+public:
+    TBAG_CONSTEXPR static std::size_t const STRIPE_LEN = 64;
+    TBAG_CONSTEXPR static std::size_t const SECRET_SIZE = 192;
+    TBAG_CONSTEXPR static std::size_t const BUFFER_SIZE = 256;
+
+    /** The inputs of this size or less are hashed without the accumulators. */
+    TBAG_CONSTEXPR static std::size_t const MIDSIZE_MAX = 240;
+
+private:
+    uint64_t _seed;
+    uint8_t  _secret[SECRET_SIZE];
+
+private:
+    uint64_t _acc[8];
+    uint8_t  _buffer[BUFFER_SIZE];
+    std::size_t _buffer_size;
+    std::size_t _stripes_so_far;
+    uint64_t _total;
+
+public:
+    XxHash3(uint64_t seed = 0) TBAG_NOEXCEPT;
+    ~XxHash3();
+
+private:
+    void consumeStripes(uint8_t const * input, std::size_t stripes) TBAG_NOEXCEPT;
+
+public:
+    void update(void const * data, std::size_t size) TBAG_NOEXCEPT;
+
+    /** The hasher is not changed. */
+    uint64_t digest() const TBAG_NOEXCEPT;
+
+    void reset() TBAG_NOEXCEPT;
+
+public:
+    static uint64_t hash(void const * data, std::size_t size, uint64_t seed = 0) TBAG_NOEXCEPT;
+};
+
+} // namespace crypto
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_CRYPTO_XXHASH3_HPP__
+
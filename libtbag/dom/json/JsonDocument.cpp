@@ -0,0 +1,380 @@
+/**
+ * @file   JsonDocument.cpp
+ * @brief  JsonDocument class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/dom/json/JsonDocument.hpp>
+
+#include <cassert>
+#include <limits>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom  {
+namespace json {
+
+using Node = JsonDocument::Node;
+using Type = JsonDocument::Type;
+
+/**
+ * Record the tokens of the JsonTokenizer to the nodes.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct JsonTapeBuilder
+{
+    char const * text;
+    std::vector<Node> & nodes;
+
+    /** Indices of the open containers. */
+    std::vector<uint32_t> containers;
+
+    /** Set if the nodes exceed the index type. */
+    bool overflow = false;
+
+    JsonTapeBuilder(char const * t, std::vector<Node> & n) : text(t), nodes(n)
+    { /* EMPTY. */ }
+
+    bool push(Type type, uint8_t flags, char const * begin = nullptr, char const * end = nullptr)
+    {
+        if (nodes.size() >= static_cast<std::size_t>(std::numeric_limits<uint32_t>::max() - 1)) {
+            overflow = true;
+            return false;
+        }
+        Node node;
+        node.type   = type;
+        node.flags  = flags;
+        node.count  = 0;
+        node.next   = static_cast<uint32_t>(nodes.size() + 1);
+        node.offset = (begin != nullptr ? static_cast<std::size_t>(begin - text) : 0);
+        node.length = (begin != nullptr ? static_cast<std::size_t>(end - begin) : 0);
+        nodes.push_back(node);
+        return true;
+    }
+
+    bool close(std::size_t count)
+    {
+        assert(!containers.empty());
+        auto & node = nodes[containers.back()];
+        containers.pop_back();
+        node.count = static_cast<uint32_t>(count);
+        node.next = static_cast<uint32_t>(nodes.size());
+        return true;
+    }
+
+    bool onNull()
+    { return push(Type::NULL_VALUE, 0); }
+
+    bool onBool(bool value)
+    { return push(Type::BOOL, value ? Node::FLAG_TRUE : 0); }
+
+    bool onNumber(char const * begin, char const * end, bool integer)
+    { return push(Type::NUMBER, integer ? Node::FLAG_INTEGER : 0, begin, end); }
+
+    bool onString(char const * begin, char const * end, bool escaped, bool key)
+    { return push(Type::STRING, escaped ? Node::FLAG_ESCAPED : 0, begin, end); }
+
+    bool onStartObject()
+    {
+        containers.push_back(static_cast<uint32_t>(nodes.size()));
+        return push(Type::OBJECT, 0);
+    }
+
+    bool onEndObject(std::size_t member_count)
+    { return close(member_count); }
+
+    bool onStartArray()
+    {
+        containers.push_back(static_cast<uint32_t>(nodes.size()));
+        return push(Type::ARRAY, 0);
+    }
+
+    bool onEndArray(std::size_t element_count)
+    { return close(element_count); }
+};
+
+// -----------------------------------
+// JsonDocument::Value implementation.
+// -----------------------------------
+
+JsonDocument::Value::Value() TBAG_NOEXCEPT
+        : _doc(nullptr), _index(0), _end(0), _member(false)
+{
+    // EMPTY.
+}
+
+JsonDocument::Value::Value(JsonDocument const * doc, uint32_t index, uint32_t end, bool member) TBAG_NOEXCEPT
+        : _doc(doc), _index(index), _end(end), _member(member)
+{
+    // EMPTY.
+}
+
+Node const & JsonDocument::Value::node() const TBAG_NOEXCEPT
+{
+    assert(valid());
+    return _doc->_nodes[_index];
+}
+
+Type JsonDocument::Value::type() const TBAG_NOEXCEPT
+{
+    return valid() ? node().type : Type::NONE;
+}
+
+bool JsonDocument::Value::isIntegral() const TBAG_NOEXCEPT
+{
+    return isNumber() && (node().flags & Node::FLAG_INTEGER) != 0;
+}
+
+std::size_t JsonDocument::Value::size() const TBAG_NOEXCEPT
+{
+    auto const TYPE = type();
+    if (TYPE == Type::ARRAY || TYPE == Type::OBJECT) {
+        return node().count;
+    }
+    return 0;
+}
+
+JsonDocument::Value JsonDocument::Value::first() const TBAG_NOEXCEPT
+{
+    auto const TYPE = type();
+    if ((TYPE != Type::ARRAY && TYPE != Type::OBJECT) || node().count == 0) {
+        return Value();
+    }
+    // The value of the member follows the key.
+    auto const OBJECT = (TYPE == Type::OBJECT);
+    return Value(_doc, _index + (OBJECT ? 2 : 1), node().next, OBJECT);
+}
+
+JsonDocument::Value JsonDocument::Value::next() const TBAG_NOEXCEPT
+{
+    if (!valid()) {
+        return Value();
+    }
+    auto const NEXT = node().next;
+    if (NEXT >= _end) {
+        return Value();
+    }
+    return Value(_doc, NEXT + (_member ? 1 : 0), _end, _member);
+}
+
+std::string JsonDocument::Value::key() const
+{
+    if (!valid() || !_member) {
+        return std::string();
+    }
+    return Value(_doc, _index - 1, _end, false).asString();
+}
+
+JsonDocument::Value JsonDocument::Value::at(std::size_t index) const
+{
+    auto child = first();
+    for (std::size_t i = 0; i < index && child.valid(); ++i) {
+        child = child.next();
+    }
+    return child;
+}
+
+bool JsonDocument::Value::equalsKey(uint32_t key_index, char const * key, std::size_t key_size) const
+{
+    auto const & KEY_NODE = _doc->_nodes[key_index];
+    auto const * text = _doc->_text + KEY_NODE.offset;
+    if ((KEY_NODE.flags & Node::FLAG_ESCAPED) == 0) {
+        return KEY_NODE.length == key_size && ::memcmp(text, key, key_size) == 0;
+    }
+    std::string decoded;
+    if (!details::decodeJsonString(text, text + KEY_NODE.length, decoded)) {
+        return false;
+    }
+    return decoded.size() == key_size && ::memcmp(decoded.data(), key, key_size) == 0;
+}
+
+JsonDocument::Value JsonDocument::Value::get(char const * key, std::size_t key_size) const
+{
+    if (!isObject()) {
+        return Value();
+    }
+    for (auto child = first(); child.valid(); child = child.next()) {
+        if (equalsKey(child._index - 1, key, key_size)) {
+            return child;
+        }
+    }
+    return Value();
+}
+
+JsonDocument::Value JsonDocument::Value::get(std::string const & key) const
+{
+    return get(key.data(), key.size());
+}
+
+bool JsonDocument::Value::asBool(bool def) const TBAG_NOEXCEPT
+{
+    if (!isBool()) {
+        return def;
+    }
+    return (node().flags & Node::FLAG_TRUE) != 0;
+}
+
+int JsonDocument::Value::asInt(int def) const TBAG_NOEXCEPT
+{
+    if (!isNumber()) {
+        return def;
+    }
+    auto const VALUE = asInt64();
+    if (VALUE > std::numeric_limits<int>::max()) {
+        return std::numeric_limits<int>::max();
+    } else if (VALUE < std::numeric_limits<int>::min()) {
+        return std::numeric_limits<int>::min();
+    }
+    return static_cast<int>(VALUE);
+}
+
+int64_t JsonDocument::Value::asInt64(int64_t def) const TBAG_NOEXCEPT
+{
+    if (!isNumber()) {
+        return def;
+    }
+    auto const & NODE = node();
+    auto const * text = _doc->_text + NODE.offset;
+    return details::decodeJsonNumber(text, text + NODE.length, (NODE.flags & Node::FLAG_INTEGER) != 0).toInt64();
+}
+
+uint64_t JsonDocument::Value::asUInt64(uint64_t def) const TBAG_NOEXCEPT
+{
+    if (!isNumber()) {
+        return def;
+    }
+    auto const & NODE = node();
+    auto const * text = _doc->_text + NODE.offset;
+    return details::decodeJsonNumber(text, text + NODE.length, (NODE.flags & Node::FLAG_INTEGER) != 0).toUInt64();
+}
+
+double JsonDocument::Value::asDouble(double def) const TBAG_NOEXCEPT
+{
+    if (!isNumber()) {
+        return def;
+    }
+    auto const & NODE = node();
+    auto const * text = _doc->_text + NODE.offset;
+    return details::decodeJsonNumber(text, text + NODE.length, (NODE.flags & Node::FLAG_INTEGER) != 0).toDouble();
+}
+
+std::string JsonDocument::Value::asString(std::string const & def) const
+{
+    std::string result;
+    if (getString(result)) {
+        return result;
+    }
+    return def;
+}
+
+bool JsonDocument::Value::getString(std::string & output) const
+{
+    if (!isString()) {
+        return false;
+    }
+    auto const & NODE = node();
+    auto const * text = _doc->_text + NODE.offset;
+    if ((NODE.flags & Node::FLAG_ESCAPED) == 0) {
+        output.assign(text, NODE.length);
+        return true;
+    }
+    return details::decodeJsonString(text, text + NODE.length, output);
+}
+
+bool JsonDocument::Value::getRaw(char const ** text, std::size_t * size) const TBAG_NOEXCEPT
+{
+    if (!isNumber() && !isString()) {
+        return false;
+    }
+    auto const & NODE = node();
+    if (text != nullptr) {
+        *text = _doc->_text + NODE.offset;
+    }
+    if (size != nullptr) {
+        *size = NODE.length;
+    }
+    return true;
+}
+
+// ----------------------------
+// JsonDocument implementation.
+// ----------------------------
+
+JsonDocument::JsonDocument() : _text(nullptr), _size(0)
+{
+    // EMPTY.
+}
+
+JsonDocument::~JsonDocument()
+{
+    // EMPTY.
+}
+
+Err JsonDocument::parse(char const * json, std::size_t size, bool copy,
+                        std::size_t * error_offset, std::size_t max_depth)
+{
+    clear();
+    if (json == nullptr && size != 0) {
+        return E_ILLARGS;
+    }
+    if (copy) {
+        _storage.assign(json, size);
+        _text = _storage.data();
+    } else {
+        _text = json;
+    }
+    _size = size;
+
+    // Most JSON texts take more than 8 bytes per value.
+    if (_nodes.capacity() < size / 8) {
+        _nodes.reserve(size / 8);
+    }
+
+    JsonTapeBuilder builder(_text, _nodes);
+    details::JsonTokenizer<JsonTapeBuilder> tokenizer(builder, _text, _text + _size, max_depth);
+    auto code = tokenizer.run();
+    if (code == E_ECANCELED && builder.overflow) {
+        code = E_OORANGE;
+    }
+    if (isFailure(code)) {
+        if (error_offset != nullptr) {
+            *error_offset = tokenizer.offset();
+        }
+        clear();
+    }
+    return code;
+}
+
+Err JsonDocument::parse(std::string const & json, bool copy, std::size_t * error_offset)
+{
+    return parse(json.data(), json.size(), copy, error_offset);
+}
+
+void JsonDocument::clear()
+{
+    _storage.clear();
+    _text = nullptr;
+    _size = 0;
+    _nodes.clear();
+}
+
+JsonDocument::Value JsonDocument::root() const TBAG_NOEXCEPT
+{
+    if (_nodes.empty()) {
+        return Value();
+    }
+    return Value(this, 0, static_cast<uint32_t>(_nodes.size()), false);
+}
+
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
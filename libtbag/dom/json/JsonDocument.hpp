@@ -0,0 +1,240 @@
+/**
+ * @file   JsonDocument.hpp
+ * @brief  JsonDocument class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONDOCUMENT_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONDOCUMENT_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/dom/json/details/JsonTokenizer.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom  {
+namespace json {
+
+/**
+ * JsonDocument class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The lazy DOM of the JSON text. @n
+ *  The parse() validates the text and records the nodes to one array (the tape),
+ *  which keeps only the type and the position of the value in the text. @n
+ *  The numbers and strings are decoded when they are accessed,
+ *  and the strings without the escape sequence are read from the text without the copy. @n
+ *  The nodes of the container are placed after it, and each node knows the end of its subtree,
+ *  so the siblings are skipped without walking the children. @n
+ *  The arrays are reused by the next parse(), so the document can be reused without the allocation.
+ *
+ * @warning
+ *  If the text is not copied, it must be valid until the document is cleared.
+ */
+class TBAG_API JsonDocument : private Noncopyable
+{
+public:
+    enum class Type : uint8_t
+    {
+        NONE,
+        NULL_VALUE,
+        BOOL,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT,
+    };
+
+    struct Node
+    {
+        TBAG_CONSTEXPR static uint8_t const FLAG_TRUE    = 0x01;
+        TBAG_CONSTEXPR static uint8_t const FLAG_INTEGER = 0x02;
+        TBAG_CONSTEXPR static uint8_t const FLAG_ESCAPED = 0x04;
+
+        Type type;
+        uint8_t flags;
+
+        /** Number of the elements or members of the container. */
+        uint32_t count;
+
+        /** Index of the node after the subtree. */
+        uint32_t next;
+
+        /** Position of the number or the contents of the string. */
+        std::size_t offset;
+        std::size_t length;
+    };
+
+    /**
+     * Value class prototype.
+     *
+     * @author zer0
+     * @date   2026-10-19
+     *
+     * @remarks
+     *  The light handle of the node. It is valid until the document is changed.
+     */
+    class TBAG_API Value
+    {
+    private:
+        JsonDocument const * _doc;
+        uint32_t _index;
+
+        /** End of the parent container, to stop the iteration. */
+        uint32_t _end;
+
+        /** Whether the parent is the object. (The key is placed just before the value) */
+        bool _member;
+
+    public:
+        Value() TBAG_NOEXCEPT;
+        Value(JsonDocument const * doc, uint32_t index, uint32_t end, bool member) TBAG_NOEXCEPT;
+
+    public:
+        inline bool valid() const TBAG_NOEXCEPT
+        { return _doc != nullptr && _index < _end; }
+
+        inline operator bool() const TBAG_NOEXCEPT
+        { return valid(); }
+
+        Type type() const TBAG_NOEXCEPT;
+
+        // clang-format off
+        inline bool isNull  () const TBAG_NOEXCEPT { return type() == Type::NULL_VALUE; }
+        inline bool isBool  () const TBAG_NOEXCEPT { return type() == Type::BOOL;       }
+        inline bool isNumber() const TBAG_NOEXCEPT { return type() == Type::NUMBER;     }
+        inline bool isString() const TBAG_NOEXCEPT { return type() == Type::STRING;     }
+        inline bool isArray () const TBAG_NOEXCEPT { return type() == Type::ARRAY;      }
+        inline bool isObject() const TBAG_NOEXCEPT { return type() == Type::OBJECT;     }
+        // clang-format on
+
+        /** Whether the number has neither the fraction nor the exponent. */
+        bool isIntegral() const TBAG_NOEXCEPT;
+
+        /** Number of the elements or members. */
+        std::size_t size() const TBAG_NOEXCEPT;
+
+    public:
+        /** Element of the array, or the value of the member by the order. */
+        Value at(std::size_t index) const;
+
+        /** Member of the object. If not found, the invalid value. */
+        Value get(char const * key, std::size_t key_size) const;
+        Value get(std::string const & key) const;
+
+        inline Value operator[](std::size_t index) const
+        { return at(index); }
+        inline Value operator[](int index) const
+        { return at(static_cast<std::size_t>(index)); }
+        inline Value operator[](char const * key) const
+        { return get(key, ::strlen(key)); }
+        inline Value operator[](std::string const & key) const
+        { return get(key); }
+
+        inline bool has(std::string const & key) const
+        { return get(key).valid(); }
+
+    public:
+        /** First child. */
+        Value first() const TBAG_NOEXCEPT;
+
+        /** Next sibling. */
+        Value next() const TBAG_NOEXCEPT;
+
+        /** Key of the member. */
+        std::string key() const;
+
+    public:
+        bool asBool(bool def = false) const TBAG_NOEXCEPT;
+        int asInt(int def = 0) const TBAG_NOEXCEPT;
+        int64_t asInt64(int64_t def = 0) const TBAG_NOEXCEPT;
+        uint64_t asUInt64(uint64_t def = 0) const TBAG_NOEXCEPT;
+        double asDouble(double def = 0) const TBAG_NOEXCEPT;
+        std::string asString(std::string const & def = std::string()) const;
+
+        /** Decode the string to the buffer of the caller, which can be reused. */
+        bool getString(std::string & output) const;
+
+        /**
+         * The text of the number, or the contents of the string (still escaped) without the copy.
+         */
+        bool getRaw(char const ** text, std::size_t * size) const TBAG_NOEXCEPT;
+
+    private:
+        Node const & node() const TBAG_NOEXCEPT;
+        bool equalsKey(uint32_t key_index, char const * key, std::size_t key_size) const;
+    };
+
+private:
+    std::string _storage;
+    char const * _text;
+    std::size_t _size;
+    std::vector<Node> _nodes;
+
+public:
+    JsonDocument();
+    ~JsonDocument();
+
+public:
+    inline std::size_t getNodeCount() const TBAG_NOEXCEPT
+    { return _nodes.size(); }
+
+    inline Node const & getNode(std::size_t index) const
+    { return _nodes.at(index); }
+
+    inline char const * getText() const TBAG_NOEXCEPT
+    { return _text; }
+
+    inline bool empty() const TBAG_NOEXCEPT
+    { return _nodes.empty(); }
+
+public:
+    /**
+     * Parse the JSON text.
+     *
+     * @param[in] copy
+     *      If false, the document refers to the text of the caller.
+     *
+     * @return
+     *  E_PARSING if the text is invalid, E_OORANGE if the depth exceeds the max_depth.
+     */
+    Err parse(char const * json, std::size_t size, bool copy = true, std::size_t * error_offset = nullptr,
+              std::size_t max_depth = details::JSON_DEFAULT_MAX_DEPTH);
+    Err parse(std::string const & json, bool copy = true, std::size_t * error_offset = nullptr);
+
+    /** Clear the nodes. The memory is kept for the next parse(). */
+    void clear();
+
+public:
+    /** Root value. If not parsed, the invalid value. */
+    Value root() const TBAG_NOEXCEPT;
+};
+
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONDOCUMENT_HPP__
+
@@ -0,0 +1,109 @@
+/**
+ * @file   JsonSax.cpp
+ * @brief  JsonSax class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/dom/json/JsonSax.hpp>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom  {
+namespace json {
+
+/**
+ * Decode the raw tokens of the JsonTokenizer for the JsonSaxHandler.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct JsonSaxAdapter
+{
+    JsonSaxHandler & handler;
+
+    /** The escaped strings are decoded here, so the buffer is reused. */
+    std::string buffer;
+
+    /** Set if the escape sequence is invalid. */
+    bool broken_string = false;
+
+    JsonSaxAdapter(JsonSaxHandler & h) : handler(h)
+    { /* EMPTY. */ }
+
+    bool onNull()
+    { return handler.onNull(); }
+
+    bool onBool(bool value)
+    { return handler.onBool(value); }
+
+    bool onNumber(char const * begin, char const * end, bool integer)
+    {
+        auto const NUMBER = details::decodeJsonNumber(begin, end, integer);
+        switch (NUMBER.type) {
+        case details::JsonNumber::Type::INT64:  return handler.onInt64(NUMBER.i);
+        case details::JsonNumber::Type::UINT64: return handler.onUInt64(NUMBER.u);
+        default:                                return handler.onDouble(NUMBER.d);
+        }
+    }
+
+    bool onString(char const * begin, char const * end, bool escaped, bool key)
+    {
+        char const * text = begin;
+        std::size_t size = static_cast<std::size_t>(end - begin);
+        if (escaped) {
+            if (!details::decodeJsonString(begin, end, buffer)) {
+                broken_string = true;
+                return false;
+            }
+            text = buffer.data();
+            size = buffer.size();
+        }
+        return key ? handler.onKey(text, size) : handler.onString(text, size);
+    }
+
+    bool onStartObject()
+    { return handler.onStartObject(); }
+
+    bool onEndObject(std::size_t member_count)
+    { return handler.onEndObject(member_count); }
+
+    bool onStartArray()
+    { return handler.onStartArray(); }
+
+    bool onEndArray(std::size_t element_count)
+    { return handler.onEndArray(element_count); }
+};
+
+Err parseJsonSax(char const * json, std::size_t size, JsonSaxHandler & handler,
+                 std::size_t * error_offset, std::size_t max_depth)
+{
+    if (json == nullptr && size != 0) {
+        return E_ILLARGS;
+    }
+    JsonSaxAdapter adapter(handler);
+    details::JsonTokenizer<JsonSaxAdapter> tokenizer(adapter, json, json + size, max_depth);
+    auto code = tokenizer.run();
+    if (code == E_ECANCELED && adapter.broken_string) {
+        code = E_PARSING;
+    }
+    if (isFailure(code) && error_offset != nullptr) {
+        *error_offset = tokenizer.offset();
+    }
+    return code;
+}
+
+Err parseJsonSax(std::string const & json, JsonSaxHandler & handler, std::size_t * error_offset)
+{
+    return parseJsonSax(json.data(), json.size(), handler, error_offset);
+}
+
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,101 @@
+/**
+ * @file   JsonSax.hpp
+ * @brief  JsonSax class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONSAX_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONSAX_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/dom/json/details/JsonTokenizer.hpp>
+
+#include <cstdint>
+#include <string>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom  {
+namespace json {
+
+/**
+ * JsonSaxHandler class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Receive the events of the parseJsonSax(). If the method returns false, the parsing is stopped. @n
+ *  The string and key are valid only during the call.
+ */
+class TBAG_API JsonSaxHandler
+{
+public:
+    JsonSaxHandler() { /* EMPTY. */ }
+    virtual ~JsonSaxHandler() { /* EMPTY. */ }
+
+public:
+    virtual bool onNull() { return true; }
+    virtual bool onBool(bool value) { return true; }
+
+    /** The integer in the range of the int64_t. */
+    virtual bool onInt64(int64_t value) { return true; }
+
+    /** The integer larger than the maximum of the int64_t. */
+    virtual bool onUInt64(uint64_t value) { return true; }
+
+    /** The number with the fraction or the exponent, or out of the range of the integers. */
+    virtual bool onDouble(double value) { return true; }
+
+    virtual bool onString(char const * text, std::size_t size) { return true; }
+    virtual bool onKey(char const * text, std::size_t size) { return true; }
+
+    virtual bool onStartObject() { return true; }
+    virtual bool onEndObject(std::size_t member_count) { return true; }
+    virtual bool onStartArray() { return true; }
+    virtual bool onEndArray(std::size_t element_count) { return true; }
+};
+
+/**
+ * Parse the JSON text without building the document.
+ *
+ * @param[in] json
+ *      JSON text. It need not be null-terminated.
+ * @param[in] size
+ *      Size of the JSON text.
+ * @param[in] handler
+ *      Event handler.
+ * @param[out] error_offset
+ *      Offset of the error.
+ * @param[in] max_depth
+ *      Maximum depth of the nested containers.
+ *
+ * @return
+ *  E_PARSING if the text is invalid, E_OORANGE if the depth exceeds the max_depth,
+ *  and E_ECANCELED if the handler stops.
+ */
+TBAG_API Err parseJsonSax(char const * json, std::size_t size, JsonSaxHandler & handler,
+                          std::size_t * error_offset = nullptr,
+                          std::size_t max_depth = details::JSON_DEFAULT_MAX_DEPTH);
+TBAG_API Err parseJsonSax(std::string const & json, JsonSaxHandler & handler,
+                          std::size_t * error_offset = nullptr);
+
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONSAX_HPP__
+
@@ -3,10 +3,14 @@
  * @brief  JsonUtils class implementation.
  * @author zer0
  * @date   2018-12-12
+ * @date   2026-10-19 (Parse the buffer & the mapped file)
  */
 
 #include <libtbag/dom/json/JsonUtils.hpp>
 #include <libtbag/string/StringUtils.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
+
+#include <memory>
 #include <type_traits>
 
 // -------------------
@@ -17,12 +21,30 @@ namespace dom  {
 namespace json {
 
 bool parse(std::string const & json, Json::Value & result, std::string * error_message)
+{
+    auto const * json_text = json.c_str();
+    return parse(json_text, json_text + json.size(), result, error_message);
+}
+
+bool parse(char const * begin, char const * end, Json::Value & result, std::string * error_message)
 {
     Json::CharReaderBuilder builder;
     builder["collectComments"] = false;
-    auto * reader = builder.newCharReader();
-    auto * json_text = json.c_str();
-    return reader->parse(json_text, json_text + json.size(), &result, error_message);
+    std::unique_ptr<Json::CharReader> const reader(builder.newCharReader());
+    return reader->parse(begin, end, &result, error_message);
+}
+
+bool parseFile(std::string const & path, Json::Value & result, std::string * error_message)
+{
+    libtbag::filesystem::MappedFile file;
+    auto const code = libtbag::filesystem::readFile(path, file);
+    if (isFailure(code)) {
+        if (error_message != nullptr) {
+            *error_message = getErrName(code);
+        }
+        return false;
+    }
+    return parse(file.begin(), file.end(), result, error_message);
 }
 
 bool testJsonText(std::string const & json)
@@ -3,6 +3,7 @@
  * @brief  JsonUtils class prototype.
  * @author zer0
  * @date   2018-12-12
+ * @date   2026-10-19 (Parse the buffer & the mapped file)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONUTILS_HPP__
@@ -33,6 +34,10 @@ namespace dom  {
 namespace json {
 
 TBAG_API bool parse(std::string const & json, Json::Value & result, std::string * error_message = nullptr);
+TBAG_API bool parse(char const * begin, char const * end, Json::Value & result, std::string * error_message = nullptr);
+
+/** Parse the memory mapped file without the intermediate copy. */
+TBAG_API bool parseFile(std::string const & path, Json::Value & result, std::string * error_message = nullptr);
 TBAG_API bool testJsonText(std::string const & json);
 TBAG_API Json::Value getJsonValue(std::string const & json);
 
@@ -0,0 +1,333 @@
+/**
+ * @file   JsonWriter.cpp
+ * @brief  JsonWriter class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Write the numbers independent of the locale)
+ * @date   2026-10-19 (Write the non-finite tokens of the flatbuffers)
+ */
+
+#include <libtbag/dom/json/JsonWriter.hpp>
+#include <libtbag/dom/json/details/JsonTokenizer.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom  {
+namespace json {
+
+JsonWriter::JsonWriter(std::size_t capacity) : _after_key(false), _non_finite(false)
+{
+    if (capacity > 0) {
+        _buffer.reserve(capacity);
+    }
+}
+
+JsonWriter::~JsonWriter()
+{
+    // EMPTY.
+}
+
+std::string JsonWriter::release()
+{
+    std::string result;
+    result.swap(_buffer);
+    _has_element.clear();
+    _after_key = false;
+    return result;
+}
+
+void JsonWriter::clear()
+{
+    _buffer.clear();
+    _has_element.clear();
+    _after_key = false;
+}
+
+void JsonWriter::reserve(std::size_t capacity)
+{
+    _buffer.reserve(capacity);
+}
+
+void JsonWriter::prefix()
+{
+    if (_after_key) {
+        _after_key = false;
+        return;
+    }
+    if (!_has_element.empty()) {
+        if (_has_element.back()) {
+            _buffer.push_back(',');
+        } else {
+            _has_element.back() = true;
+        }
+    }
+}
+
+JsonWriter & JsonWriter::startObject()
+{
+    prefix();
+    _buffer.push_back('{');
+    _has_element.push_back(false);
+    return *this;
+}
+
+JsonWriter & JsonWriter::endObject()
+{
+    assert(!_has_element.empty());
+    _has_element.pop_back();
+    _buffer.push_back('}');
+    return *this;
+}
+
+JsonWriter & JsonWriter::startArray()
+{
+    prefix();
+    _buffer.push_back('[');
+    _has_element.push_back(false);
+    return *this;
+}
+
+JsonWriter & JsonWriter::endArray()
+{
+    assert(!_has_element.empty());
+    _has_element.pop_back();
+    _buffer.push_back(']');
+    return *this;
+}
+
+JsonWriter & JsonWriter::key(char const * text, std::size_t size)
+{
+    prefix();
+    writeString(text, size);
+    _buffer.push_back(':');
+    _after_key = true;
+    return *this;
+}
+
+JsonWriter & JsonWriter::key(std::string const & text)
+{
+    return key(text.data(), text.size());
+}
+
+JsonWriter & JsonWriter::key(char const * text)
+{
+    return key(text, ::strlen(text));
+}
+
+JsonWriter & JsonWriter::null()
+{
+    prefix();
+    _buffer.append("null", 4);
+    return *this;
+}
+
+JsonWriter & JsonWriter::value(bool val)
+{
+    prefix();
+    if (val) {
+        _buffer.append("true", 4);
+    } else {
+        _buffer.append("false", 5);
+    }
+    return *this;
+}
+
+void JsonWriter::writeInteger(uint64_t val, bool negative)
+{
+    char digits[24];
+    char * cursor = digits + sizeof(digits);
+    do {
+        *--cursor = static_cast<char>('0' + (val % 10));
+        val /= 10;
+    } while (val != 0);
+    if (negative) {
+        *--cursor = '-';
+    }
+    _buffer.append(cursor, digits + sizeof(digits));
+}
+
+// clang-format off
+JsonWriter & JsonWriter::value(int                val) { return value(static_cast<long long>(val)); }
+JsonWriter & JsonWriter::value(unsigned           val) { return value(static_cast<unsigned long long>(val)); }
+JsonWriter & JsonWriter::value(long               val) { return value(static_cast<long long>(val)); }
+JsonWriter & JsonWriter::value(unsigned long      val) { return value(static_cast<unsigned long long>(val)); }
+// clang-format on
+
+JsonWriter & JsonWriter::value(long long val)
+{
+    prefix();
+    if (val < 0) {
+        // The negation of the minimum is out of the range, so it is computed in the unsigned.
+        writeInteger(static_cast<uint64_t>(0) - static_cast<uint64_t>(val), true);
+    } else {
+        writeInteger(static_cast<uint64_t>(val), false);
+    }
+    return *this;
+}
+
+JsonWriter & JsonWriter::value(unsigned long long val)
+{
+    prefix();
+    writeInteger(static_cast<uint64_t>(val), false);
+    return *this;
+}
+
+/**
+ * Replace the decimal point of the locale. (e.g. <code>1,5</code> of the LC_NUMERIC)
+ * The <code>%g</code> does not write the thousands separators.
+ */
+static void fixNumericLocale(char * begin, char * end)
+{
+    for (; begin != end; ++begin) {
+        if (*begin == ',') {
+            *begin = '.';
+        }
+    }
+}
+
+/**
+ * Write the shortest text of the precision from the min_precision to the max_precision,
+ * which is read back to the same value.
+ */
+template <typename T>
+static int writeShortest(char * buffer, std::size_t size, T val, int min_precision, int max_precision)
+{
+    int length = 0;
+    for (int precision = min_precision; precision <= max_precision; ++precision) {
+        length = ::snprintf(buffer, size, "%.*g", precision, static_cast<double>(val));
+        if (static_cast<T>(std::strtod(buffer, nullptr)) == val) {
+            break;
+        }
+    }
+    fixNumericLocale(buffer, buffer + length);
+
+    // Keep the type of the number, so it is not read as the integer.
+    bool integral = true;
+    for (int i = 0; i < length; ++i) {
+        if (buffer[i] == '.' || buffer[i] == 'e') {
+            integral = false;
+            break;
+        }
+    }
+    if (integral && length + 2 < static_cast<int>(size)) {
+        buffer[length++] = '.';
+        buffer[length++] = '0';
+        buffer[length] = '\0';
+    }
+    return length;
+}
+
+void JsonWriter::writeNonFinite(double val)
+{
+    assert(!std::isfinite(val));
+    if (!_non_finite) {
+        null();
+        return;
+    }
+    prefix();
+    if (std::isnan(val)) {
+        _buffer.append("nan", 3);
+    } else if (val < 0) {
+        _buffer.append("-inf", 4);
+    } else {
+        _buffer.append("inf", 3);
+    }
+}
+
+JsonWriter & JsonWriter::value(float val)
+{
+    if (!std::isfinite(val)) {
+        writeNonFinite(val);
+        return *this;
+    }
+    prefix();
+    char buffer[32];
+    auto const LENGTH = writeShortest<float>(buffer, sizeof(buffer), val, 6, 9);
+    _buffer.append(buffer, static_cast<std::size_t>(LENGTH));
+    return *this;
+}
+
+JsonWriter & JsonWriter::value(double val)
+{
+    if (!std::isfinite(val)) {
+        writeNonFinite(val);
+        return *this;
+    }
+    prefix();
+    char buffer[32];
+    auto const LENGTH = writeShortest<double>(buffer, sizeof(buffer), val, 15, 17);
+    _buffer.append(buffer, static_cast<std::size_t>(LENGTH));
+    return *this;
+}
+
+void JsonWriter::writeString(char const * text, std::size_t size)
+{
+    static char const * const HEX = "0123456789abcdef";
+
+    _buffer.push_back('"');
+    auto const * cursor = text;
+    auto const * end = text + size;
+    while (cursor != end) {
+        auto const * special = details::findJsonStringSpecial(cursor, end);
+        _buffer.append(cursor, special);
+        if (special == end) {
+            break;
+        }
+        auto const C = static_cast<unsigned char>(*special);
+        switch (C) {
+        case '"':  _buffer.append("\\\"", 2); break;
+        case '\\': _buffer.append("\\\\", 2); break;
+        case '\b': _buffer.append("\\b", 2);  break;
+        case '\f': _buffer.append("\\f", 2);  break;
+        case '\n': _buffer.append("\\n", 2);  break;
+        case '\r': _buffer.append("\\r", 2);  break;
+        case '\t': _buffer.append("\\t", 2);  break;
+        default:
+            char escape[6] = {'\\', 'u', '0', '0', HEX[C >> 4], HEX[C & 0x0F]};
+            _buffer.append(escape, sizeof(escape));
+            break;
+        }
+        cursor = special + 1;
+    }
+    _buffer.push_back('"');
+}
+
+JsonWriter & JsonWriter::value(char const * text, std::size_t size)
+{
+    prefix();
+    writeString(text, size);
+    return *this;
+}
+
+JsonWriter & JsonWriter::value(std::string const & text)
+{
+    return value(text.data(), text.size());
+}
+
+JsonWriter & JsonWriter::value(char const * text)
+{
+    return value(text, ::strlen(text));
+}
+
+JsonWriter & JsonWriter::raw(char const * json, std::size_t size)
+{
+    prefix();
+    _buffer.append(json, size);
+    return *this;
+}
+
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,154 @@
+/**
+ * @file   JsonWriter.hpp
+ * @brief  JsonWriter class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Write the non-finite tokens of the flatbuffers)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONWRITER_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONWRITER_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom  {
+namespace json {
+
+/**
+ * JsonWriter class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Write the compact JSON text to the buffer, without building the document. @n
+ *  The commas and colons are inserted by the writer. @n
+ *  The buffer is reused after the clear(), so the repeated writes do not allocate. @n
+ *  The non-finite numbers are written as the null, because the JSON has no representation of them. @n
+ *  If the setNonFinite() is set, they are written as the <code>nan</code>, <code>inf</code> and <code>-inf</code>
+ *  like the flatbuffers, which the JsonTokenizer reads with the non_finite option.
+ *
+ * @warning
+ *  The writer does not check the structure. (e.g. the value without the key in the object)
+ */
+class TBAG_API JsonWriter : private Noncopyable
+{
+private:
+    std::string _buffer;
+
+    /** Whether the container of each depth has the element. */
+    std::vector<bool> _has_element;
+
+    /** Set after the key, so the value is written without the comma. */
+    bool _after_key;
+
+    /** Write the non-finite numbers as the tokens instead of the null. */
+    bool _non_finite;
+
+public:
+    JsonWriter(std::size_t capacity = 0);
+    ~JsonWriter();
+
+public:
+    inline std::string const & str() const TBAG_NOEXCEPT
+    { return _buffer; }
+
+    inline char const * data() const TBAG_NOEXCEPT
+    { return _buffer.data(); }
+
+    inline std::size_t size() const TBAG_NOEXCEPT
+    { return _buffer.size(); }
+
+    inline std::size_t depth() const TBAG_NOEXCEPT
+    { return _has_element.size(); }
+
+    inline bool isNonFinite() const TBAG_NOEXCEPT
+    { return _non_finite; }
+
+    inline void setNonFinite(bool enable = true) TBAG_NOEXCEPT
+    { _non_finite = enable; }
+
+    /** Move the text out. The buffer is empty after the call. */
+    std::string release();
+
+    /** Clear the text. The memory is kept. */
+    void clear();
+
+    void reserve(std::size_t capacity);
+
+public:
+    JsonWriter & startObject();
+    JsonWriter & endObject();
+    JsonWriter & startArray();
+    JsonWriter & endArray();
+
+    JsonWriter & key(char const * text, std::size_t size);
+    JsonWriter & key(std::string const & text);
+    JsonWriter & key(char const * text);
+
+public:
+    JsonWriter & null();
+    JsonWriter & value(bool val);
+    JsonWriter & value(int val);
+    JsonWriter & value(unsigned val);
+    JsonWriter & value(long val);
+    JsonWriter & value(unsigned long val);
+    JsonWriter & value(long long val);
+    JsonWriter & value(unsigned long long val);
+
+    /** The shortest text which is read back to the same float. */
+    JsonWriter & value(float val);
+
+    /** The shortest text which is read back to the same double. */
+    JsonWriter & value(double val);
+
+    JsonWriter & value(char const * text, std::size_t size);
+    JsonWriter & value(std::string const & text);
+    JsonWriter & value(char const * text);
+
+    /** Write the JSON text as it is. */
+    JsonWriter & raw(char const * json, std::size_t size);
+
+public:
+    template <typename Iterator>
+    JsonWriter & array(Iterator begin, Iterator end)
+    {
+        startArray();
+        for (; begin != end; ++begin) {
+            value(*begin);
+        }
+        return endArray();
+    }
+
+private:
+    void prefix();
+    void writeNonFinite(double val);
+    void writeInteger(uint64_t val, bool negative);
+    void writeString(char const * text, std::size_t size);
+};
+
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_JSONWRITER_HPP__
+
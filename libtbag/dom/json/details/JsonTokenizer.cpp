@@ -0,0 +1,343 @@
+/**
+ * @file   JsonTokenizer.cpp
+ * @brief  JsonTokenizer class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Read the numbers independent of the locale)
+ * @date   2026-10-19 (Accept the non-finite tokens of the flatbuffers)
+ */
+
+#include <libtbag/dom/json/details/JsonTokenizer.hpp>
+
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom     {
+namespace json    {
+namespace details {
+
+/** The powers of ten which are exact in the double. */
+static double const EXACT_POWERS_OF_TEN[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+TBAG_CONSTEXPR static int const MAX_EXACT_POWER = 22;
+TBAG_CONSTEXPR static uint64_t const MAX_EXACT_MANTISSA = (static_cast<uint64_t>(1) << 53);
+TBAG_CONSTEXPR static int const MAX_MANTISSA_DIGITS = 19;
+
+int64_t JsonNumber::toInt64() const TBAG_NOEXCEPT
+{
+    switch (type) {
+    case Type::INT64:
+        return i;
+    case Type::UINT64:
+        return std::numeric_limits<int64_t>::max();
+    default:
+        if (d >= static_cast<double>(std::numeric_limits<int64_t>::max())) {
+            return std::numeric_limits<int64_t>::max();
+        } else if (d <= static_cast<double>(std::numeric_limits<int64_t>::min())) {
+            return std::numeric_limits<int64_t>::min();
+        }
+        return static_cast<int64_t>(d);
+    }
+}
+
+uint64_t JsonNumber::toUInt64() const TBAG_NOEXCEPT
+{
+    switch (type) {
+    case Type::INT64:
+        return i < 0 ? 0 : static_cast<uint64_t>(i);
+    case Type::UINT64:
+        return u;
+    default:
+        if (d >= static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+            return std::numeric_limits<uint64_t>::max();
+        } else if (d <= 0) {
+            return 0;
+        }
+        return static_cast<uint64_t>(d);
+    }
+}
+
+double JsonNumber::toDouble() const TBAG_NOEXCEPT
+{
+    switch (type) {
+    case Type::INT64:  return static_cast<double>(i);
+    case Type::UINT64: return static_cast<double>(u);
+    default:           return d;
+    }
+}
+
+/**
+ * The std::strtod() reads the decimal point of the LC_NUMERIC,
+ * so the '.' of the JSON is replaced with it. (e.g. <code>1,5</code>)
+ */
+static void fixNumericLocaleInput(char * begin, char * end)
+{
+    auto const * lc = std::localeconv();
+    if (lc == nullptr || lc->decimal_point == nullptr) {
+        return;
+    }
+    auto const DECIMAL_POINT = lc->decimal_point[0];
+    if (DECIMAL_POINT != '\0' && DECIMAL_POINT != '.') {
+        std::replace(begin, end, '.', DECIMAL_POINT);
+    }
+}
+
+static double parseDoubleSlow(char const * begin, char const * end)
+{
+    auto const SIZE = static_cast<std::size_t>(end - begin);
+    char buffer[64];
+    if (SIZE < sizeof(buffer)) {
+        ::memcpy(buffer, begin, SIZE);
+        buffer[SIZE] = '\0';
+        fixNumericLocaleInput(buffer, buffer + SIZE);
+        return std::strtod(buffer, nullptr);
+    }
+    std::string text(begin, end);
+    fixNumericLocaleInput(&text[0], &text[0] + text.size());
+    return std::strtod(text.c_str(), nullptr);
+}
+
+JsonNumber decodeJsonNumber(char const * begin, char const * end, bool integer)
+{
+    JsonNumber result;
+    auto const * cursor = begin;
+    bool const NEGATIVE = (cursor != end && *cursor == '-');
+    if (NEGATIVE) {
+        ++cursor;
+    }
+
+    if (integer) {
+        uint64_t value = 0;
+        bool overflow = false;
+        for (; cursor != end; ++cursor) {
+            auto const DIGIT = static_cast<uint64_t>(*cursor - '0');
+            if (value > (std::numeric_limits<uint64_t>::max() - DIGIT) / 10) {
+                overflow = true;
+                break;
+            }
+            value = value * 10 + DIGIT;
+        }
+
+        if (!overflow) {
+            auto const INT64_LIMIT = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+            if (NEGATIVE) {
+                if (value <= INT64_LIMIT + 1) {
+                    result.type = JsonNumber::Type::INT64;
+                    result.i = (value == INT64_LIMIT + 1) ? std::numeric_limits<int64_t>::min()
+                                                          : -static_cast<int64_t>(value);
+                    result.d = -static_cast<double>(value);
+                    return result;
+                }
+            } else if (value <= INT64_LIMIT) {
+                result.type = JsonNumber::Type::INT64;
+                result.i = static_cast<int64_t>(value);
+                result.u = value;
+                result.d = static_cast<double>(value);
+                return result;
+            } else {
+                result.type = JsonNumber::Type::UINT64;
+                result.u = value;
+                result.d = static_cast<double>(value);
+                return result;
+            }
+        }
+        result.type = JsonNumber::Type::DOUBLE;
+        result.d = parseDoubleSlow(begin, end);
+        return result;
+    }
+
+    if (cursor != end && (*cursor == 'n' || *cursor == 'i')) {
+        result.type = JsonNumber::Type::DOUBLE;
+        if (*cursor == 'n') {
+            result.d = std::numeric_limits<double>::quiet_NaN();
+        } else {
+            result.d = NEGATIVE ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+        }
+        return result;
+    }
+
+    // The fast path of the Clinger:
+    // If the mantissa and the power of ten are exact in the double, one operation gives the correct rounding.
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool exact = true;
+
+    for (; cursor != end && '0' <= *cursor && *cursor <= '9'; ++cursor) {
+        if (mantissa == 0 && *cursor == '0') {
+            continue;
+        }
+        if (digits < MAX_MANTISSA_DIGITS) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*cursor - '0');
+            ++digits;
+        } else {
+            exact = false;
+        }
+    }
+    if (cursor != end && *cursor == '.') {
+        ++cursor;
+        for (; cursor != end && '0' <= *cursor && *cursor <= '9'; ++cursor) {
+            if (mantissa == 0 && *cursor == '0') {
+                --exponent;
+                continue;
+            }
+            if (digits < MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*cursor - '0');
+                ++digits;
+                --exponent;
+            } else {
+                exact = false;
+            }
+        }
+    }
+    if (cursor != end && (*cursor == 'e' || *cursor == 'E')) {
+        ++cursor;
+        bool const NEGATIVE_EXPONENT = (cursor != end && *cursor == '-');
+        if (cursor != end && (*cursor == '-' || *cursor == '+')) {
+            ++cursor;
+        }
+        int explicit_exponent = 0;
+        for (; cursor != end; ++cursor) {
+            if (explicit_exponent < 100000) {
+                explicit_exponent = explicit_exponent * 10 + (*cursor - '0');
+            }
+        }
+        exponent += (NEGATIVE_EXPONENT ? -explicit_exponent : explicit_exponent);
+    }
+
+    result.type = JsonNumber::Type::DOUBLE;
+    if (mantissa == 0) {
+        result.d = NEGATIVE ? -0.0 : 0.0;
+    } else if (exact && mantissa <= MAX_EXACT_MANTISSA &&
+               -MAX_EXACT_POWER <= COMPARE_AND(exponent) <= MAX_EXACT_POWER) {
+        auto const VALUE = static_cast<double>(mantissa);
+        result.d = exponent < 0 ? VALUE / EXACT_POWERS_OF_TEN[-exponent] : VALUE * EXACT_POWERS_OF_TEN[exponent];
+        if (NEGATIVE) {
+            result.d = -result.d;
+        }
+    } else {
+        result.d = parseDoubleSlow(begin, end);
+    }
+    return result;
+}
+
+static int getHexValue(char c) TBAG_NOEXCEPT
+{
+    if ('0' <= c && c <= '9') {
+        return c - '0';
+    } else if ('a' <= c && c <= 'f') {
+        return c - 'a' + 10;
+    } else if ('A' <= c && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+static bool readCodeUnit(char const * cursor, char const * end, unsigned & unit) TBAG_NOEXCEPT
+{
+    if (end - cursor < 4) {
+        return false;
+    }
+    unit = 0;
+    for (int i = 0; i < 4; ++i) {
+        auto const VALUE = getHexValue(cursor[i]);
+        if (VALUE < 0) {
+            return false;
+        }
+        unit = (unit << 4) | static_cast<unsigned>(VALUE);
+    }
+    return true;
+}
+
+static void appendUtf8(unsigned code_point, std::string & output)
+{
+    if (code_point < 0x80) {
+        output.push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+        output.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+        output.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+        output.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+bool decodeJsonString(char const * begin, char const * end, std::string & output)
+{
+    output.clear();
+    output.reserve(static_cast<std::size_t>(end - begin));
+
+    auto const * cursor = begin;
+    while (cursor != end) {
+        auto const * escape = static_cast<char const *>(::memchr(cursor, '\\', static_cast<std::size_t>(end - cursor)));
+        if (escape == nullptr) {
+            output.append(cursor, end);
+            break;
+        }
+        output.append(cursor, escape);
+        cursor = escape + 1;
+        if (cursor == end) {
+            return false;
+        }
+
+        switch (*cursor++) {
+        case '"':  output.push_back('"');  break;
+        case '\\': output.push_back('\\'); break;
+        case '/':  output.push_back('/');  break;
+        case 'b':  output.push_back('\b'); break;
+        case 'f':  output.push_back('\f'); break;
+        case 'n':  output.push_back('\n'); break;
+        case 'r':  output.push_back('\r'); break;
+        case 't':  output.push_back('\t'); break;
+        case 'u': {
+            unsigned unit;
+            if (!readCodeUnit(cursor, end, unit)) {
+                return false;
+            }
+            cursor += 4;
+            if (0xD800 <= unit && unit <= 0xDBFF) {
+                // The high surrogate must be followed by the low surrogate.
+                unsigned low;
+                if (end - cursor < 6 || cursor[0] != '\\' || cursor[1] != 'u' ||
+                    !readCodeUnit(cursor + 2, end, low) || low < 0xDC00 || 0xDFFF < low) {
+                    return false;
+                }
+                cursor += 6;
+                unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+            } else if (0xDC00 <= unit && unit <= 0xDFFF) {
+                return false;
+            }
+            appendUtf8(unit, output);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace details
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,474 @@
+/**
+ * @file   JsonTokenizer.hpp
+ * @brief  JsonTokenizer class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Accept the non-finite tokens of the flatbuffers)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_DETAILS_JSONTOKENIZER_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_DETAILS_JSONTOKENIZER_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define TBAG_JSON_TOKENIZER_SSE2
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# endif
+#endif
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom     {
+namespace json    {
+namespace details {
+
+TBAG_CONSTEXPR std::size_t const JSON_DEFAULT_MAX_DEPTH = 512;
+
+#if defined(TBAG_JSON_TOKENIZER_SSE2)
+inline unsigned getFirstBitIndex(unsigned mask) TBAG_NOEXCEPT
+{
+    assert(mask != 0);
+# if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+# else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+# endif
+}
+#endif
+
+inline bool isJsonWhitespace(char c) TBAG_NOEXCEPT
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/** Skip the whitespaces. The long runs (the indentation) are skipped by 16 bytes. */
+inline char const * skipJsonWhitespace(char const * cursor, char const * end) TBAG_NOEXCEPT
+{
+    if (cursor == end || !isJsonWhitespace(*cursor)) {
+        return cursor;
+    }
+#if defined(TBAG_JSON_TOKENIZER_SSE2)
+    __m128i const SPACE = _mm_set1_epi8(' ');
+    __m128i const LF    = _mm_set1_epi8('\n');
+    __m128i const CR    = _mm_set1_epi8('\r');
+    __m128i const TAB   = _mm_set1_epi8('\t');
+    while (end - cursor >= 16) {
+        __m128i const DATA = _mm_loadu_si128(reinterpret_cast<__m128i const *>(cursor));
+        __m128i const IS_SPACE = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(DATA, SPACE), _mm_cmpeq_epi8(DATA, LF)),
+                                              _mm_or_si128(_mm_cmpeq_epi8(DATA, CR), _mm_cmpeq_epi8(DATA, TAB)));
+        auto const MASK = static_cast<unsigned>(_mm_movemask_epi8(IS_SPACE)) ^ 0xFFFFu;
+        if (MASK != 0) {
+            return cursor + getFirstBitIndex(MASK);
+        }
+        cursor += 16;
+    }
+#endif
+    while (cursor != end && isJsonWhitespace(*cursor)) {
+        ++cursor;
+    }
+    return cursor;
+}
+
+/** Find the first quotation mark, backslash or control character. */
+inline char const * findJsonStringSpecial(char const * cursor, char const * end) TBAG_NOEXCEPT
+{
+#if defined(TBAG_JSON_TOKENIZER_SSE2)
+    __m128i const QUOTE     = _mm_set1_epi8('"');
+    __m128i const BACKSLASH = _mm_set1_epi8('\\');
+    __m128i const CONTROL   = _mm_set1_epi8(0x1F);
+    while (end - cursor >= 16) {
+        __m128i const DATA = _mm_loadu_si128(reinterpret_cast<__m128i const *>(cursor));
+        // The unsigned (DATA <= 0x1F) is (max(DATA, 0x1F) == 0x1F).
+        __m128i const IS_CONTROL = _mm_cmpeq_epi8(_mm_max_epu8(DATA, CONTROL), CONTROL);
+        __m128i const IS_SPECIAL = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(DATA, QUOTE),
+                                                             _mm_cmpeq_epi8(DATA, BACKSLASH)), IS_CONTROL);
+        auto const MASK = static_cast<unsigned>(_mm_movemask_epi8(IS_SPECIAL));
+        if (MASK != 0) {
+            return cursor + getFirstBitIndex(MASK);
+        }
+        cursor += 16;
+    }
+#endif
+    for (; cursor != end; ++cursor) {
+        auto const C = static_cast<unsigned char>(*cursor);
+        if (C == '"' || C == '\\' || C < 0x20) {
+            break;
+        }
+    }
+    return cursor;
+}
+
+/**
+ * Decoded number of the JSON.
+ *
+ * @remarks
+ *  The integer in the range of the int64_t is INT64,
+ *  the larger positive integer is UINT64 and the others are DOUBLE.
+ */
+struct JsonNumber
+{
+    enum class Type
+    {
+        INT64,
+        UINT64,
+        DOUBLE,
+    };
+
+    Type type = Type::INT64;
+    int64_t  i = 0;
+    uint64_t u = 0;
+    double   d = 0;
+
+    int64_t toInt64() const TBAG_NOEXCEPT;
+    uint64_t toUInt64() const TBAG_NOEXCEPT;
+    double toDouble() const TBAG_NOEXCEPT;
+};
+
+/**
+ * The text must be validated by the JsonTokenizer.
+ * The <code>nan</code>, <code>inf</code> and <code>-inf</code> tokens are read as the DOUBLE.
+ */
+TBAG_API JsonNumber decodeJsonNumber(char const * begin, char const * end, bool integer);
+
+/**
+ * Unescape the contents of the string. (without the quotation marks)
+ *
+ * @return
+ *  false if the escape sequence is invalid.
+ */
+TBAG_API bool decodeJsonString(char const * begin, char const * end, std::string & output);
+
+/**
+ * JsonTokenizer class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Validate the JSON text (RFC 8259) and report the raw tokens to the handler. @n
+ *  The strings and numbers are not decoded, so the handler decides when to decode them. @n
+ *  The containers are tracked by the explicit stack, so the deep nesting does not overflow the call stack. @n
+ *  The handler requires the following methods, and each of them returns false to stop:
+ *  - bool onNull();
+ *  - bool onBool(bool value);
+ *  - bool onNumber(char const * begin, char const * end, bool integer);
+ *  - bool onString(char const * begin, char const * end, bool escaped, bool key);
+ *  - bool onStartObject();
+ *  - bool onEndObject(std::size_t member_count);
+ *  - bool onStartArray();
+ *  - bool onEndArray(std::size_t element_count);
+ *
+ *  If the non_finite is set, the <code>nan</code>, <code>inf</code> and <code>-inf</code> tokens
+ *  (which the flatbuffers writes) are reported by the onNumber(). It is not the standard JSON.
+ */
+template <typename HandlerT>
+class JsonTokenizer
+{
+public:
+    using Handler = HandlerT;
+
+private:
+    struct Frame
+    {
+        bool object;
+        std::size_t count;
+    };
+
+    enum class State
+    {
+        VALUE,
+        KEY,
+        AFTER_VALUE,
+    };
+
+private:
+    Handler & _handler;
+    char const * const BEGIN;
+    char const * const END;
+    char const * _cursor;
+    std::size_t const MAX_DEPTH;
+    bool const NON_FINITE;
+    std::vector<Frame> _stack;
+
+public:
+    JsonTokenizer(Handler & handler, char const * begin, char const * end,
+                  std::size_t max_depth = JSON_DEFAULT_MAX_DEPTH, bool non_finite = false)
+            : _handler(handler), BEGIN(begin), END(end), _cursor(begin),
+              MAX_DEPTH(max_depth), NON_FINITE(non_finite)
+    { /* EMPTY. */ }
+
+public:
+    /** Offset of the error, or the end of the parsing. */
+    inline std::size_t offset() const TBAG_NOEXCEPT
+    { return static_cast<std::size_t>(_cursor - BEGIN); }
+
+public:
+    /**
+     * @return
+     *  E_PARSING if the text is invalid, E_OORANGE if the depth exceeds the max_depth,
+     *  and E_ECANCELED if the handler stops.
+     */
+    Err run()
+    {
+        auto state = State::VALUE;
+        while (true) {
+            _cursor = skipJsonWhitespace(_cursor, END);
+            if (state == State::AFTER_VALUE && _stack.empty()) {
+                // Only the whitespaces may follow the root value.
+                return _cursor == END ? E_SUCCESS : E_PARSING;
+            }
+            if (_cursor == END) {
+                return E_PARSING;
+            }
+
+            if (state == State::KEY) {
+                if (*_cursor != '"') {
+                    return E_PARSING;
+                }
+                auto const CODE = string(true);
+                if (isFailure(CODE)) {
+                    return CODE;
+                }
+                _cursor = skipJsonWhitespace(_cursor, END);
+                if (_cursor == END || *_cursor != ':') {
+                    return E_PARSING;
+                }
+                ++_cursor;
+                state = State::VALUE;
+                continue;
+            }
+
+            if (state == State::AFTER_VALUE) {
+                auto & frame = _stack.back();
+                ++frame.count;
+                if (*_cursor == ',') {
+                    ++_cursor;
+                    state = frame.object ? State::KEY : State::VALUE;
+                    continue;
+                }
+                if (*_cursor != (frame.object ? '}' : ']')) {
+                    return E_PARSING;
+                }
+                ++_cursor;
+                auto const COUNT = frame.count;
+                auto const OBJECT = frame.object;
+                _stack.pop_back();
+                if (!(OBJECT ? _handler.onEndObject(COUNT) : _handler.onEndArray(COUNT))) {
+                    return E_ECANCELED;
+                }
+                continue;
+            }
+
+            assert(state == State::VALUE);
+            Err code = E_SUCCESS;
+            switch (*_cursor) {
+            case '{':
+            case '[':
+                code = open(*_cursor == '{', state);
+                if (isFailure(code)) {
+                    return code;
+                }
+                continue;
+            case '"':
+                code = string(false);
+                break;
+            case 't':
+                code = literal("true", 4) ? (_handler.onBool(true) ? E_SUCCESS : E_ECANCELED) : E_PARSING;
+                break;
+            case 'f':
+                code = literal("false", 5) ? (_handler.onBool(false) ? E_SUCCESS : E_ECANCELED) : E_PARSING;
+                break;
+            case 'n':
+                if (NON_FINITE && literal("nan", 3)) {
+                    code = _handler.onNumber(_cursor - 3, _cursor, false) ? E_SUCCESS : E_ECANCELED;
+                    break;
+                }
+                code = literal("null", 4) ? (_handler.onNull() ? E_SUCCESS : E_ECANCELED) : E_PARSING;
+                break;
+            default:
+                code = number();
+                break;
+            }
+            if (isFailure(code)) {
+                return code;
+            }
+            state = State::AFTER_VALUE;
+        }
+    }
+
+private:
+    Err open(bool object, State & state)
+    {
+        if (_stack.size() >= MAX_DEPTH) {
+            return E_OORANGE;
+        }
+        if (!(object ? _handler.onStartObject() : _handler.onStartArray())) {
+            return E_ECANCELED;
+        }
+        ++_cursor;
+        auto const * next = skipJsonWhitespace(_cursor, END);
+        if (next != END && *next == (object ? '}' : ']')) {
+            _cursor = next + 1;
+            if (!(object ? _handler.onEndObject(0) : _handler.onEndArray(0))) {
+                return E_ECANCELED;
+            }
+            state = State::AFTER_VALUE;
+            return E_SUCCESS;
+        }
+        _stack.push_back(Frame{object, 0});
+        state = object ? State::KEY : State::VALUE;
+        return E_SUCCESS;
+    }
+
+    bool literal(char const * text, std::size_t size)
+    {
+        if (static_cast<std::size_t>(END - _cursor) < size) {
+            return false;
+        }
+        for (std::size_t i = 0; i < size; ++i) {
+            if (_cursor[i] != text[i]) {
+                return false;
+            }
+        }
+        _cursor += size;
+        return true;
+    }
+
+    Err string(bool key)
+    {
+        assert(*_cursor == '"');
+        auto const * begin = ++_cursor;
+        bool escaped = false;
+        while (true) {
+            _cursor = findJsonStringSpecial(_cursor, END);
+            if (_cursor == END) {
+                return E_PARSING;
+            }
+            auto const C = *_cursor;
+            if (C == '"') {
+                break;
+            }
+            if (C != '\\') {
+                return E_PARSING; // The control characters must be escaped.
+            }
+            escaped = true;
+            if (END - _cursor < 2) {
+                _cursor = END;
+                return E_PARSING;
+            }
+            switch (_cursor[1]) {
+            case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                _cursor += 2;
+                break;
+            case 'u':
+                if (END - _cursor < 6 || !isHex(_cursor[2]) || !isHex(_cursor[3]) ||
+                    !isHex(_cursor[4]) || !isHex(_cursor[5])) {
+                    return E_PARSING;
+                }
+                _cursor += 6;
+                break;
+            default:
+                return E_PARSING;
+            }
+        }
+        auto const * end = _cursor++;
+        if (!_handler.onString(begin, end, escaped, key)) {
+            return E_ECANCELED;
+        }
+        return E_SUCCESS;
+    }
+
+    static inline bool isDigit(char c) TBAG_NOEXCEPT
+    { return '0' <= c && c <= '9'; }
+
+    static inline bool isHex(char c) TBAG_NOEXCEPT
+    { return isDigit(c) || ('a' <= c && c <= 'f') || ('A' <= c && c <= 'F'); }
+
+    Err number()
+    {
+        auto const * begin = _cursor;
+        auto const * cursor = _cursor;
+        if (cursor != END && *cursor == '-') {
+            ++cursor;
+        }
+        if (NON_FINITE && cursor != END && *cursor == 'i') {
+            _cursor = cursor;
+            if (!literal("inf", 3)) {
+                return E_PARSING;
+            }
+            return _handler.onNumber(begin, _cursor, false) ? E_SUCCESS : E_ECANCELED;
+        }
+        if (cursor == END || !isDigit(*cursor)) {
+            return E_PARSING;
+        }
+        if (*cursor == '0') {
+            ++cursor;
+        } else {
+            while (cursor != END && isDigit(*cursor)) {
+                ++cursor;
+            }
+        }
+
+        bool integer = true;
+        if (cursor != END && *cursor == '.') {
+            integer = false;
+            ++cursor;
+            if (cursor == END || !isDigit(*cursor)) {
+                _cursor = cursor;
+                return E_PARSING;
+            }
+            while (cursor != END && isDigit(*cursor)) {
+                ++cursor;
+            }
+        }
+        if (cursor != END && (*cursor == 'e' || *cursor == 'E')) {
+            integer = false;
+            ++cursor;
+            if (cursor != END && (*cursor == '+' || *cursor == '-')) {
+                ++cursor;
+            }
+            if (cursor == END || !isDigit(*cursor)) {
+                _cursor = cursor;
+                return E_PARSING;
+            }
+            while (cursor != END && isDigit(*cursor)) {
+                ++cursor;
+            }
+        }
+        _cursor = cursor;
+        if (!_handler.onNumber(begin, cursor, integer)) {
+            return E_ECANCELED;
+        }
+        return E_SUCCESS;
+    }
+};
+
+} // namespace details
+} // namespace json
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_DOM_JSON_DETAILS_JSONTOKENIZER_HPP__
+
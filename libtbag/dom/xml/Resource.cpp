@@ -3,6 +3,7 @@
  * @brief  Resource class implementation.
  * @author zer0
  * @date   2016-07-06
+ * @date   2026-10-19 (Read the XML file from the memory mapping)
  */
 
 #include <libtbag/dom/xml/Resource.hpp>
@@ -107,7 +108,7 @@ bool Resource::readFromXmlString(std::string const & xml)
 bool Resource::readFromXmlFile(std::string const & path)
 {
     Document doc;
-    if (doc.LoadFile(path.c_str()) != tinyxml2::XML_SUCCESS) {
+    if (isFailure(readDocumentFromXmlFile(doc, path))) {
         return false;
     }
     return readFromXmlDocument(doc);
@@ -254,12 +255,16 @@ Resource Resource::createFromXmlFile(std::string const & path, std::string const
         return Resource();
     }
 
-    std::string xml_string;
-    if (isFailure(libtbag::filesystem::readFile(path, xml_string))) {
+    Resource res(root, tag, attr);
+    Document doc;
+    auto const code = readDocumentFromXmlFile(doc, path);
+    if (code == E_PARSING) {
+        return res;
+    } else if (isFailure(code)) {
         return Resource();
     }
-
-    return createFromXmlString(xml_string, root, tag, attr);
+    res.readFromXmlDocument(doc);
+    return res;
 }
 
 } // namespace xml
@@ -3,6 +3,7 @@
  * @brief  XmlHelper class implementation.
  * @author zer0
  * @date   2017-06-02
+ * @date   2026-10-19 (Add the buffer & file readers)
  */
 
 #include <libtbag/dom/xml/XmlHelper.hpp>
@@ -234,6 +235,16 @@ Err XmlHelper::readFromXmlText(Document & doc, std::string const & xml)
     return libtbag::dom::xml::readDocumentFromXmlText(doc, xml);
 }
 
+Err XmlHelper::readFromXmlText(Document & doc, char const * xml, std::size_t size)
+{
+    return libtbag::dom::xml::readDocumentFromXmlText(doc, xml, size);
+}
+
+Err XmlHelper::readFromXmlFile(Document & doc, std::string const & path)
+{
+    return libtbag::dom::xml::readDocumentFromXmlFile(doc, path);
+}
+
 Err XmlHelper::writeDocumentToXmlText(Document const & doc, std::string & xml, bool compact, int depth)
 {
     return libtbag::dom::xml::writeDocumentToXmlText(doc, xml, compact, depth);
@@ -3,6 +3,7 @@
  * @brief  XmlHelper class prototype.
  * @author zer0
  * @date   2017-06-02
+ * @date   2026-10-19 (Add the buffer & file readers)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_XML_XMLHELPER_HPP__
@@ -125,6 +126,8 @@ struct TBAG_API XmlHelper
     }
 
     static Err readFromXmlText(Document & doc, std::string const & xml);
+    static Err readFromXmlText(Document & doc, char const * xml, std::size_t size);
+    static Err readFromXmlFile(Document & doc, std::string const & path);
     static Err writeDocumentToXmlText(Document const & doc, std::string & xml, bool compact = false, int depth = 0);
     static Err writeElementToXmlText(Element const & elem, std::string & xml, bool compact = false, int depth = 0);
     static Err writeElementToXmlElement(Element const & elem, Element & output);
@@ -0,0 +1,546 @@
+/**
+ * @file   XmlReader.cpp
+ * @brief  XmlReader class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/dom/xml/XmlReader.hpp>
+#include <libtbag/dom/xml/tinyxml2/tinyxml2.h>
+
+#include <cassert>
+#include <cstdlib>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom {
+namespace xml {
+
+TBAG_CONSTEXPR static std::size_t const MAX_ATTRIBUTE_NUMBER_SIZE = 63;
+
+static inline bool __is_xml_space(char c) TBAG_NOEXCEPT
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static inline bool __is_name_end(char c) TBAG_NOEXCEPT
+{
+    return __is_xml_space(c) || c == '/' || c == '>' || c == '=';
+}
+
+static inline char const * __skip_space(char const * cursor, char const * end) TBAG_NOEXCEPT
+{
+    while (cursor < end && __is_xml_space(*cursor)) {
+        ++cursor;
+    }
+    return cursor;
+}
+
+static inline bool __is_space_only(char const * begin, char const * end) TBAG_NOEXCEPT
+{
+    return __skip_space(begin, end) == end;
+}
+
+static inline bool __starts_with(char const * cursor, char const * end, char const * prefix, std::size_t size) TBAG_NOEXCEPT
+{
+    return static_cast<std::size_t>(end - cursor) >= size && ::memcmp(cursor, prefix, size) == 0;
+}
+
+/** Find the text, and return the end of the text if not found. */
+static char const * __find(char const * cursor, char const * end, char const * text, std::size_t size) TBAG_NOEXCEPT
+{
+    while (cursor < end) {
+        auto const * found = static_cast<char const *>(::memchr(cursor, text[0], end - cursor));
+        if (found == nullptr) {
+            break;
+        }
+        if (__starts_with(found, end, text, size)) {
+            return found;
+        }
+        cursor = found + 1;
+    }
+    return end;
+}
+
+static void __append_utf8(unsigned long code, std::string & output)
+{
+    if (code < 0x80) {
+        output.push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+        output.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        output.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        output.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        output.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else {
+        output.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        output.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+XmlReader::XmlReader()
+{
+    reset(nullptr, 0);
+}
+
+XmlReader::XmlReader(char const * xml, std::size_t size)
+{
+    reset(xml, size);
+}
+
+XmlReader::XmlReader(std::string const & xml)
+{
+    reset(xml.data(), xml.size());
+}
+
+XmlReader::~XmlReader()
+{
+    // EMPTY.
+}
+
+void XmlReader::reset(char const * xml, std::size_t size)
+{
+    _begin = xml;
+    _end = xml + size;
+    _cursor = xml;
+    _token = Token::NONE;
+    _error = E_SUCCESS;
+    _name = View();
+    _text = View();
+    _text_escaped = false;
+    _element_begin = nullptr;
+    _pending_end = false;
+    _root_found = false;
+    _attributes.clear();
+    _elements.clear();
+
+    // The terminators are included, if the size is from the printer of the tinyxml2.
+    while (_end > _begin && *(_end - 1) == '\0') {
+        --_end;
+    }
+
+    // Skip the UTF-8 BOM.
+    if (__starts_with(_cursor, _end, "\xEF\xBB\xBF", 3)) {
+        _cursor += 3;
+    }
+}
+
+XmlReader::Token XmlReader::fail(Err code)
+{
+    _error = code;
+    _token = Token::FAILURE;
+    return _token;
+}
+
+XmlReader::Token XmlReader::next()
+{
+    if (_token == Token::FAILURE || _token == Token::END_DOCUMENT) {
+        return _token;
+    }
+
+    if (_pending_end) {
+        assert(!_elements.empty());
+        _pending_end = false;
+        _elements.pop_back();
+        _attributes.clear();
+        _token = Token::END_ELEMENT;
+        return _token;
+    }
+
+    while (_cursor < _end) {
+        if (*_cursor != '<') {
+            auto const * lt = static_cast<char const *>(::memchr(_cursor, '<', _end - _cursor));
+            if (lt == nullptr) {
+                lt = _end;
+            }
+            auto const * text_begin = _cursor;
+            _cursor = lt;
+            if (__is_space_only(text_begin, lt)) {
+                continue;
+            }
+            if (_elements.empty()) {
+                return fail(E_PARSING); // Text outside the root element.
+            }
+            _text = View(text_begin, static_cast<std::size_t>(lt - text_begin));
+            _text_escaped = (::memchr(text_begin, '&', _text.size) != nullptr);
+            _attributes.clear();
+            _token = Token::TEXT;
+            return _token;
+        }
+
+        if (__starts_with(_cursor, _end, "<![CDATA[", 9)) {
+            if (_elements.empty()) {
+                return fail(E_PARSING);
+            }
+            auto const * data_begin = _cursor + 9;
+            auto const * data_end = __find(data_begin, _end, "]]>", 3);
+            if (data_end == _end) {
+                return fail(E_PARSING);
+            }
+            _cursor = data_end + 3;
+            _text = View(data_begin, static_cast<std::size_t>(data_end - data_begin));
+            _text_escaped = false;
+            _attributes.clear();
+            _token = Token::TEXT;
+            return _token;
+        }
+
+        if (_cursor + 1 < _end && (_cursor[1] == '?' || _cursor[1] == '!')) {
+            if (!skipMarkup()) {
+                return fail(E_PARSING);
+            }
+            continue;
+        }
+
+        if (_cursor + 1 < _end && _cursor[1] == '/') {
+            return readEndElement();
+        }
+        return readStartElement();
+    }
+
+    if (!_elements.empty() || !_root_found) {
+        return fail(E_PARSING);
+    }
+    _attributes.clear();
+    _token = Token::END_DOCUMENT;
+    return _token;
+}
+
+bool XmlReader::skipMarkup()
+{
+    char const * end;
+    if (_cursor[1] == '?') {
+        end = __find(_cursor + 2, _end, "?>", 2);
+        if (end == _end) {
+            return false;
+        }
+        _cursor = end + 2;
+        return true;
+    }
+
+    if (__starts_with(_cursor, _end, "<!--", 4)) {
+        end = __find(_cursor + 4, _end, "-->", 3);
+        if (end == _end) {
+            return false;
+        }
+        _cursor = end + 3;
+        return true;
+    }
+
+    // <!DOCTYPE ...> and the other declarations. The internal subset is skipped.
+    int brackets = 0;
+    for (auto const * cursor = _cursor + 2; cursor < _end; ++cursor) {
+        if (*cursor == '[') {
+            ++brackets;
+        } else if (*cursor == ']') {
+            --brackets;
+        } else if (*cursor == '>' && brackets <= 0) {
+            _cursor = cursor + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+XmlReader::Token XmlReader::readStartElement()
+{
+    if (_elements.empty() && _root_found) {
+        return fail(E_PARSING); // Multiple root elements.
+    }
+
+    auto const * element_begin = _cursor;
+    auto const * cursor = _cursor + 1;
+    auto const * name_begin = cursor;
+    while (cursor < _end && !__is_name_end(*cursor)) {
+        ++cursor;
+    }
+    if (cursor == name_begin || cursor >= _end) {
+        return fail(E_PARSING);
+    }
+
+    _attributes.clear();
+    _name = View(name_begin, static_cast<std::size_t>(cursor - name_begin));
+
+    while (true) {
+        cursor = __skip_space(cursor, _end);
+        if (cursor >= _end) {
+            return fail(E_PARSING);
+        }
+        if (*cursor == '>') {
+            ++cursor;
+            break;
+        }
+        if (*cursor == '/') {
+            if (cursor + 1 >= _end || cursor[1] != '>') {
+                return fail(E_PARSING);
+            }
+            cursor += 2;
+            _pending_end = true;
+            break;
+        }
+
+        auto const * key_begin = cursor;
+        while (cursor < _end && !__is_name_end(*cursor)) {
+            ++cursor;
+        }
+        if (cursor == key_begin) {
+            return fail(E_PARSING);
+        }
+        auto const * key_end = cursor;
+
+        cursor = __skip_space(cursor, _end);
+        if (cursor >= _end || *cursor != '=') {
+            return fail(E_PARSING);
+        }
+        cursor = __skip_space(cursor + 1, _end);
+        if (cursor >= _end || (*cursor != '"' && *cursor != '\'')) {
+            return fail(E_PARSING);
+        }
+
+        auto const quote = *cursor;
+        auto const * value_begin = cursor + 1;
+        auto const * value_end = static_cast<char const *>(::memchr(value_begin, quote, _end - value_begin));
+        if (value_end == nullptr) {
+            return fail(E_PARSING);
+        }
+
+        Attribute attribute;
+        attribute.name = View(key_begin, static_cast<std::size_t>(key_end - key_begin));
+        attribute.value = View(value_begin, static_cast<std::size_t>(value_end - value_begin));
+        attribute.escaped = (::memchr(value_begin, '&', attribute.value.size) != nullptr);
+        _attributes.push_back(attribute);
+
+        cursor = value_end + 1;
+        if (cursor < _end && !__is_xml_space(*cursor) && *cursor != '/' && *cursor != '>') {
+            return fail(E_PARSING);
+        }
+    }
+
+    _cursor = cursor;
+    _element_begin = element_begin;
+    _elements.push_back(_name);
+    _root_found = true;
+    _token = Token::START_ELEMENT;
+    return _token;
+}
+
+XmlReader::Token XmlReader::readEndElement()
+{
+    auto const * cursor = _cursor + 2;
+    auto const * name_begin = cursor;
+    while (cursor < _end && !__is_name_end(*cursor)) {
+        ++cursor;
+    }
+    View const name(name_begin, static_cast<std::size_t>(cursor - name_begin));
+
+    cursor = __skip_space(cursor, _end);
+    if (cursor >= _end || *cursor != '>') {
+        return fail(E_PARSING);
+    }
+    if (_elements.empty() || !_elements.back().equals(name.data, name.size)) {
+        return fail(E_PARSING); // Mismatched end element.
+    }
+
+    _cursor = cursor + 1;
+    _elements.pop_back();
+    _attributes.clear();
+    _name = name;
+    _token = Token::END_ELEMENT;
+    return _token;
+}
+
+XmlReader::Attribute const * XmlReader::findAttribute(char const * name) const TBAG_NOEXCEPT
+{
+    auto const size = ::strlen(name);
+    for (auto const & attribute : _attributes) {
+        if (attribute.name.equals(name, size)) {
+            return &attribute;
+        }
+    }
+    return nullptr;
+}
+
+Err XmlReader::optAttr(char const * key, std::string & result, std::string const & default_value) const
+{
+    auto const * attribute = findAttribute(key);
+    if (attribute == nullptr) {
+        result = default_value;
+        return E_QUERY;
+    }
+    if (attribute->escaped) {
+        result.clear();
+        if (!decodeText(attribute->value, result)) {
+            result = default_value;
+            return E_QUERY;
+        }
+    } else {
+        result.assign(attribute->value.data, attribute->value.size);
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * The numbers are converted with the tinyxml2 rules,
+ * so the results are the same as the XmlHelper::optAttr().
+ */
+template <typename T, typename Converter>
+static Err __opt_number_attr(XmlReader const & reader, char const * key, T & result,
+                             T default_value, Converter converter)
+{
+    auto const * attribute = reader.findAttribute(key);
+    if (attribute == nullptr || attribute->value.size > MAX_ATTRIBUTE_NUMBER_SIZE) {
+        result = default_value;
+        return E_QUERY;
+    }
+
+    char buffer[MAX_ATTRIBUTE_NUMBER_SIZE + 1];
+    ::memcpy(buffer, attribute->value.data, attribute->value.size);
+    buffer[attribute->value.size] = '\0';
+
+    if (!converter(buffer, &result)) {
+        result = default_value;
+        return E_QUERY;
+    }
+    return E_SUCCESS;
+}
+
+// clang-format off
+Err XmlReader::optAttr(char const * key, bool & result, bool default_value) const
+{ return __opt_number_attr(*this, key, result, default_value, &tinyxml2::XMLUtil::ToBool); }
+Err XmlReader::optAttr(char const * key, int & result, int default_value) const
+{ return __opt_number_attr(*this, key, result, default_value, &tinyxml2::XMLUtil::ToInt); }
+Err XmlReader::optAttr(char const * key, unsigned int & result, unsigned int default_value) const
+{ return __opt_number_attr(*this, key, result, default_value, &tinyxml2::XMLUtil::ToUnsigned); }
+Err XmlReader::optAttr(char const * key, std::int64_t & result, std::int64_t default_value) const
+{ return __opt_number_attr(*this, key, result, default_value, &tinyxml2::XMLUtil::ToInt64); }
+Err XmlReader::optAttr(char const * key, float & result, float default_value) const
+{ return __opt_number_attr(*this, key, result, default_value, &tinyxml2::XMLUtil::ToFloat); }
+Err XmlReader::optAttr(char const * key, double & result, double default_value) const
+{ return __opt_number_attr(*this, key, result, default_value, &tinyxml2::XMLUtil::ToDouble); }
+// clang-format on
+
+Err XmlReader::skipElement(View * source)
+{
+    if (_token != Token::START_ELEMENT) {
+        return E_ILLSTATE;
+    }
+
+    auto const * element_begin = _element_begin;
+    auto const element_depth = depth() - 1;
+    while (true) {
+        auto const token = next();
+        if (token == Token::FAILURE) {
+            return _error;
+        }
+        if (token == Token::END_ELEMENT && depth() == element_depth) {
+            break;
+        }
+        assert(token != Token::END_DOCUMENT);
+    }
+
+    if (source != nullptr) {
+        *source = View(element_begin, static_cast<std::size_t>(_cursor - element_begin));
+    }
+    return E_SUCCESS;
+}
+
+Err XmlReader::readElementText(std::string & output)
+{
+    if (_token != Token::START_ELEMENT) {
+        return E_ILLSTATE;
+    }
+
+    output.clear();
+    auto const text_depth = depth();
+    while (true) {
+        auto const token = next();
+        if (token == Token::FAILURE) {
+            return _error;
+        }
+        if (token == Token::END_ELEMENT && depth() == text_depth - 1) {
+            break;
+        }
+        if (token == Token::TEXT && depth() == text_depth) {
+            if (_text_escaped) {
+                if (!decodeText(_text, output)) {
+                    return E_PARSING;
+                }
+            } else {
+                output.append(_text.data, _text.size);
+            }
+        }
+    }
+    return E_SUCCESS;
+}
+
+bool XmlReader::decodeText(char const * text, std::size_t size, std::string & output)
+{
+    auto const * cursor = text;
+    auto const * end = text + size;
+    output.reserve(output.size() + size);
+
+    while (cursor < end) {
+        auto const * amp = static_cast<char const *>(::memchr(cursor, '&', end - cursor));
+        if (amp == nullptr) {
+            output.append(cursor, end);
+            break;
+        }
+        output.append(cursor, amp);
+
+        auto const * semicolon = static_cast<char const *>(::memchr(amp, ';', end - amp));
+        if (semicolon == nullptr) {
+            return false;
+        }
+
+        auto const * entity = amp + 1;
+        auto const entity_size = static_cast<std::size_t>(semicolon - entity);
+        if (entity_size >= 2 && entity[0] == '#') {
+            char * number_end = nullptr;
+            unsigned long code;
+            if (entity[1] == 'x' || entity[1] == 'X') {
+                code = std::strtoul(entity + 2, &number_end, 16);
+                if (entity_size == 2) {
+                    return false;
+                }
+            } else {
+                code = std::strtoul(entity + 1, &number_end, 10);
+            }
+            if (number_end != semicolon || code == 0 || code > 0x10FFFF) {
+                return false;
+            }
+            __append_utf8(code, output);
+        } else if (entity_size == 2 && ::memcmp(entity, "lt", 2) == 0) {
+            output.push_back('<');
+        } else if (entity_size == 2 && ::memcmp(entity, "gt", 2) == 0) {
+            output.push_back('>');
+        } else if (entity_size == 3 && ::memcmp(entity, "amp", 3) == 0) {
+            output.push_back('&');
+        } else if (entity_size == 4 && ::memcmp(entity, "quot", 4) == 0) {
+            output.push_back('"');
+        } else if (entity_size == 4 && ::memcmp(entity, "apos", 4) == 0) {
+            output.push_back('\'');
+        } else {
+            return false;
+        }
+        cursor = semicolon + 1;
+    }
+    return true;
+}
+
+bool XmlReader::decodeText(View const & text, std::string & output)
+{
+    return decodeText(text.data, text.size, output);
+}
+
+} // namespace xml
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,236 @@
+/**
+ * @file   XmlReader.hpp
+ * @brief  XmlReader class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_XML_XMLREADER_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_DOM_XML_XMLREADER_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/Err.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace dom {
+namespace xml {
+
+/**
+ * XmlReader class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The pull reader of the XML text. @n
+ *  The next() moves to the next element or text, and the names, attributes and texts
+ *  are the views of the text without the copy. @n
+ *  The arrays of the attributes and the open elements are reused,
+ *  so the reader does not allocate after the first few elements. @n
+ *  The declarations, comments and processing instructions are skipped,
+ *  and the texts which have only the whitespaces are not reported.
+ *
+ * @warning
+ *  The text must be valid while the reader is used. @n
+ *  The null characters at the end of the text are ignored. @n
+ *  The DTD is not supported. (The entities of the DOCTYPE are not expanded)
+ */
+class TBAG_API XmlReader : private Noncopyable
+{
+public:
+    enum class Token
+    {
+        NONE,
+        START_ELEMENT,
+        END_ELEMENT,
+        TEXT,
+        END_DOCUMENT,
+        FAILURE,
+    };
+
+    /**
+     * The range of the text.
+     */
+    struct View
+    {
+        char const * data = nullptr;
+        std::size_t size = 0;
+
+        View() { /* EMPTY. */ }
+        View(char const * d, std::size_t s) : data(d), size(s) { /* EMPTY. */ }
+
+        inline bool empty() const TBAG_NOEXCEPT
+        { return size == 0; }
+
+        inline std::string toString() const
+        { return std::string(data, size); }
+
+        inline bool equals(char const * text, std::size_t text_size) const TBAG_NOEXCEPT
+        { return size == text_size && ::memcmp(data, text, size) == 0; }
+
+        inline bool operator ==(char const * text) const TBAG_NOEXCEPT
+        { return equals(text, ::strlen(text)); }
+        inline bool operator !=(char const * text) const TBAG_NOEXCEPT
+        { return !(*this == text); }
+    };
+
+    struct Attribute
+    {
+        View name;
+        View value;
+
+        /** Whether the value has the entity references. */
+        bool escaped = false;
+    };
+
+    using Attributes = std::vector<Attribute>;
+
+private:
+    char const * _begin;
+    char const * _end;
+    char const * _cursor;
+
+    Token _token;
+    Err _error;
+
+    /** Name of the current element. */
+    View _name;
+
+    /** Contents of the current text. */
+    View _text;
+    bool _text_escaped;
+
+    /** Position of the '<' of the current start element. */
+    char const * _element_begin;
+
+    /** Set by the empty element (e.g. <code>&lt;tag/&gt;</code>), and the next token is the end element. */
+    bool _pending_end;
+    bool _root_found;
+
+    Attributes _attributes;
+    std::vector<View> _elements;
+
+public:
+    XmlReader();
+    XmlReader(char const * xml, std::size_t size);
+    XmlReader(std::string const & xml);
+    ~XmlReader();
+
+public:
+    /** Start the new text. The memory of the arrays is kept. */
+    void reset(char const * xml, std::size_t size);
+
+    /**
+     * Move to the next token.
+     *
+     * @return
+     *  FAILURE if the text is invalid, and the getError() returns the reason.
+     */
+    Token next();
+
+public:
+    inline Token token() const TBAG_NOEXCEPT
+    { return _token; }
+
+    inline Err getError() const TBAG_NOEXCEPT
+    { return _error; }
+
+    /** Position of the cursor from the start of the text. */
+    inline std::size_t offset() const TBAG_NOEXCEPT
+    { return static_cast<std::size_t>(_cursor - _begin); }
+
+    /** Number of the open elements. The current start element is included. */
+    inline std::size_t depth() const TBAG_NOEXCEPT
+    { return _elements.size(); }
+
+    /** Name of the start element or the end element. */
+    inline View name() const TBAG_NOEXCEPT
+    { return _name; }
+
+    /** Raw contents of the text. The CDATA section is not escaped. */
+    inline View text() const TBAG_NOEXCEPT
+    { return _text; }
+
+    inline bool isTextEscaped() const TBAG_NOEXCEPT
+    { return _text_escaped; }
+
+    inline bool isEmptyElement() const TBAG_NOEXCEPT
+    { return _token == Token::START_ELEMENT && _pending_end; }
+
+    /** Attributes of the current start element. */
+    inline Attributes const & attributes() const TBAG_NOEXCEPT
+    { return _attributes; }
+
+public:
+    Attribute const * findAttribute(char const * name) const TBAG_NOEXCEPT;
+
+    inline bool existsAttribute(char const * name) const TBAG_NOEXCEPT
+    { return findAttribute(name) != nullptr; }
+
+    /**
+     * Read the attribute of the current start element.
+     * If not found or not converted, the default value is assigned.
+     *
+     * @return
+     *  E_QUERY if not found or not converted.
+     */
+    Err optAttr(char const * key, std::string & result, std::string const & default_value = std::string()) const;
+    Err optAttr(char const * key, bool & result, bool default_value = false) const;
+    Err optAttr(char const * key, int & result, int default_value = 0) const;
+    Err optAttr(char const * key, unsigned int & result, unsigned int default_value = 0) const;
+    Err optAttr(char const * key, std::int64_t & result, std::int64_t default_value = 0) const;
+    Err optAttr(char const * key, float & result, float default_value = 0.0) const;
+    Err optAttr(char const * key, double & result, double default_value = 0.0) const;
+
+public:
+    /**
+     * Skip the current start element with its children.
+     * The cursor is moved to the end element.
+     *
+     * @param[out] source
+     *      The whole text of the element. (from the start tag to the end tag)
+     */
+    Err skipElement(View * source = nullptr);
+
+    /**
+     * Read the texts of the current start element, without the texts of the children.
+     * The cursor is moved to the end element.
+     */
+    Err readElementText(std::string & output);
+
+public:
+    /** Replace the entity references. (e.g. <code>&amp;amp;</code>) */
+    static bool decodeText(char const * text, std::size_t size, std::string & output);
+    static bool decodeText(View const & text, std::string & output);
+
+private:
+    Token fail(Err code = E_PARSING);
+    Token readStartElement();
+    Token readEndElement();
+    bool skipMarkup();
+};
+
+} // namespace xml
+} // namespace dom
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_DOM_XML_XMLREADER_HPP__
+
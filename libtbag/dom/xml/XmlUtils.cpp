@@ -3,9 +3,11 @@
  * @brief  XmlUtils class implementation.
  * @author zer0
  * @date   2019-08-05
+ * @date   2026-10-19 (Read the document from the buffer & the mapped file)
  */
 
 #include <libtbag/dom/xml/XmlUtils.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
 
 #include <cassert>
 #include <functional>
@@ -250,6 +252,24 @@ Err readDocumentFromXmlText(Document & doc, std::string const & xml)
     return E_PARSING;
 }
 
+Err readDocumentFromXmlText(Document & doc, char const * xml, std::size_t size)
+{
+    if (doc.Parse(xml, size) == tinyxml2::XML_SUCCESS) {
+        return E_SUCCESS;
+    }
+    return E_PARSING;
+}
+
+Err readDocumentFromXmlFile(Document & doc, std::string const & path)
+{
+    libtbag::filesystem::MappedFile file;
+    auto const code = libtbag::filesystem::readFile(path, file);
+    if (isFailure(code)) {
+        return code;
+    }
+    return readDocumentFromXmlText(doc, file.data(), file.size());
+}
+
 Err writeDocumentToXmlText(Document const & doc, std::string & xml, bool compact, int depth)
 {
     tinyxml2::XMLPrinter printer(nullptr, compact, depth);
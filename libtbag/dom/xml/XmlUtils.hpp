@@ -3,6 +3,7 @@
  * @brief  XmlUtils class prototype.
  * @author zer0
  * @date   2019-08-05
+ * @date   2026-10-19 (Read the document from the buffer & the mapped file)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_DOM_XML_XMLUTILS_HPP__
@@ -18,6 +19,7 @@
 #include <libtbag/Err.hpp>
 #include <libtbag/dom/xml/tinyxml2/tinyxml2.h>
 
+#include <cstddef>
 #include <string>
 
 // -------------------
@@ -82,6 +84,15 @@ TBAG_API Node * insertElement(Document & doc, Node * node);
 TBAG_API Node * insertElement(Element & element, Node * node);
 
 TBAG_API Err readDocumentFromXmlText(Document & doc, std::string const & xml);
+TBAG_API Err readDocumentFromXmlText(Document & doc, char const * xml, std::size_t size);
+
+/**
+ * Read the document from the memory mapped file.
+ *
+ * @remarks
+ *  The tinyxml2 parses in its own buffer, so the intermediate std::string copy is skipped.
+ */
+TBAG_API Err readDocumentFromXmlFile(Document & doc, std::string const & path);
 TBAG_API Err writeDocumentToXmlText(Document const & doc, std::string & xml, bool compact = false, int depth = 0);
 TBAG_API Err writeElementToXmlText(Element const & elem, std::string & xml, bool compact = false, int depth = 0);
 TBAG_API Err writeElementToXmlElement(Element const & elem, Element & output);
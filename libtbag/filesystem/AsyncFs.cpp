@@ -0,0 +1,917 @@
+/**
+ * @file   AsyncFs.cpp
+ * @brief  AsyncFs class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Fail the requests which the io_uring does not submit)
+ */
+
+#include <libtbag/filesystem/AsyncFs.hpp>
+#include <libtbag/filesystem/details/UvFs-inl.hpp>
+#include <libtbag/log/Log.hpp>
+#include <libtbag/uvpp/Loop.hpp>
+#include <libtbag/uvpp/Poll.hpp>
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <unordered_set>
+
+#include <uv.h>
+
+#if defined(TBAG_PLATFORM_LINUX) && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#  include <linux/io_uring.h>
+#  include <sys/eventfd.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#  if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#   define TBAG_ASYNC_FS_IO_URING
+#  endif
+# endif
+#endif
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace filesystem {
+
+#if defined(TBAG_ASYNC_FS_IO_URING)
+/**
+ * Minimal io_uring of the raw system calls. (The liburing is not required)
+ *
+ * @remarks
+ *  The ring is accessed only from the loop thread. @n
+ *  The completion is signaled through the registered eventfd.
+ */
+struct AsyncFsRing : private Noncopyable
+{
+    /** Upper bound of the submission queue entries. */
+    TBAG_CONSTEXPR static unsigned const MAX_ENTRIES = 4096;
+
+    int fd = -1;
+    int event_fd = -1;
+
+    void * sq_ptr = nullptr;
+    void * cq_ptr = nullptr;
+    std::size_t sq_size = 0;
+    std::size_t cq_size = 0;
+
+    io_uring_sqe * sqes = nullptr;
+    std::size_t sqes_size = 0;
+
+    unsigned * sq_head  = nullptr;
+    unsigned * sq_tail  = nullptr;
+    unsigned * sq_array = nullptr;
+    unsigned   sq_mask  = 0;
+    unsigned   sq_entries = 0;
+
+    unsigned * cq_head = nullptr;
+    unsigned * cq_tail = nullptr;
+    unsigned   cq_mask = 0;
+    unsigned   cq_entries = 0;
+    io_uring_cqe * cqes = nullptr;
+
+    /** Entries pushed but not submitted to the kernel. */
+    unsigned queued = 0;
+
+    ~AsyncFsRing()
+    {
+        destroy();
+    }
+
+    bool init(unsigned entries)
+    {
+        io_uring_params params;
+        ::memset(&params, 0, sizeof(params));
+        fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) {
+            return false;
+        }
+
+        sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+
+        sq_ptr = ::mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        cq_ptr = ::mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        void * sqes_ptr = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sq_ptr == MAP_FAILED || cq_ptr == MAP_FAILED || sqes_ptr == MAP_FAILED) {
+            sq_ptr = (sq_ptr == MAP_FAILED ? nullptr : sq_ptr);
+            cq_ptr = (cq_ptr == MAP_FAILED ? nullptr : cq_ptr);
+            sqes = (sqes_ptr == MAP_FAILED ? nullptr : static_cast<io_uring_sqe*>(sqes_ptr));
+            destroy();
+            return false;
+        }
+        sqes = static_cast<io_uring_sqe*>(sqes_ptr);
+
+        auto * sq = static_cast<char*>(sq_ptr);
+        sq_head  = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sq_mask  = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_entries = params.sq_entries;
+
+        auto * cq = static_cast<char*>(cq_ptr);
+        cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cq_entries = params.cq_entries;
+        cqes    = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (event_fd < 0 || ::syscall(__NR_io_uring_register, fd, IORING_REGISTER_EVENTFD, &event_fd, 1) != 0) {
+            destroy();
+            return false;
+        }
+        return true;
+    }
+
+    void destroy()
+    {
+        if (sqes != nullptr) {
+            ::munmap(sqes, sqes_size);
+            sqes = nullptr;
+        }
+        if (cq_ptr != nullptr) {
+            ::munmap(cq_ptr, cq_size);
+            cq_ptr = nullptr;
+        }
+        if (sq_ptr != nullptr) {
+            ::munmap(sq_ptr, sq_size);
+            sq_ptr = nullptr;
+        }
+        if (event_fd >= 0) {
+            ::close(event_fd);
+            event_fd = -1;
+        }
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    bool registerBuffers(std::vector<iovec> const & iovecs)
+    {
+        return ::syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS,
+                         iovecs.data(), static_cast<unsigned>(iovecs.size())) == 0;
+    }
+
+    /** @return nullptr if the submission queue is full. */
+    io_uring_sqe * next()
+    {
+        unsigned const TAIL = *sq_tail;
+        if (TAIL - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE) >= sq_entries) {
+            return nullptr;
+        }
+        unsigned const INDEX = TAIL & sq_mask;
+        sq_array[INDEX] = INDEX;
+        ::memset(&sqes[INDEX], 0, sizeof(io_uring_sqe));
+        return &sqes[INDEX];
+    }
+
+    void push()
+    {
+        __atomic_store_n(sq_tail, *sq_tail + 1, __ATOMIC_RELEASE);
+        ++queued;
+    }
+
+    /** @return The number of the submitted entries or the negative errno. */
+    int submit()
+    {
+        if (queued == 0) {
+            return 0;
+        }
+        auto const RESULT = ::syscall(__NR_io_uring_enter, fd, queued, 0, 0, nullptr, 0);
+        if (RESULT < 0) {
+            return -errno;
+        }
+        queued -= static_cast<unsigned>(RESULT);
+        return static_cast<int>(RESULT);
+    }
+
+    /** Take back the entries which are not submitted, so the kernel never reads them. */
+    template <typename Predicate>
+    void drop(Predicate predicate)
+    {
+        unsigned tail = *sq_tail;
+        for (; queued > 0; --queued) {
+            --tail;
+            predicate(sqes[sq_array[tail & sq_mask]].user_data);
+        }
+        __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+    }
+
+    void wait(unsigned count)
+    {
+        ::syscall(__NR_io_uring_enter, fd, queued, count, IORING_ENTER_GETEVENTS, nullptr, 0);
+        queued = 0;
+    }
+
+    void clearEvent()
+    {
+        uint64_t value;
+        // EAGAIN if the counter is already cleared.
+        if (::read(event_fd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+            tDLogW("AsyncFsRing::clearEvent() Read error: {}", errno);
+        }
+    }
+
+    template <typename Predicate>
+    void reap(Predicate predicate)
+    {
+        unsigned head = *cq_head;
+        while (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+            auto const & CQE = cqes[head & cq_mask];
+            auto const USER_DATA = CQE.user_data;
+            auto const RESULT = CQE.res;
+            // Release the slot before the predicate, because it may submit the next request.
+            __atomic_store_n(cq_head, ++head, __ATOMIC_RELEASE);
+            predicate(USER_DATA, RESULT);
+        }
+    }
+};
+
+/** Watch the eventfd of the ring in the loop. */
+struct AsyncFsRingPoll : public libtbag::uvpp::Poll
+{
+    AsyncFs::Impl * impl;
+
+    AsyncFsRingPoll(libtbag::uvpp::Loop & loop, int fd, AsyncFs::Impl * i)
+            : Poll(loop, init_file(fd)), impl(i)
+    { /* EMPTY. */ }
+
+    virtual ~AsyncFsRingPoll()
+    { /* EMPTY. */ }
+
+    virtual void onPoll(Err status, EventType events) override;
+};
+#endif // defined(TBAG_ASYNC_FS_IO_URING)
+
+/**
+ * AsyncFs::Impl class implementation.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct AsyncFs::Impl : private Noncopyable
+{
+    using Buffers = std::vector<char>;
+    using SharedBuffers = std::shared_ptr<Buffers>;
+
+    enum class OpType
+    {
+        OPEN, CLOSE, READ, WRITE, FSYNC, FDATASYNC, STAT, FSTAT, SCANDIR,
+    };
+
+    struct Op
+    {
+        OpType type;
+        Impl * owner;
+
+        uv_fs_t req;
+
+        std::string path;
+        int flags = 0;
+        int mode = 0;
+        ufile file = 0;
+        int64_t offset = 0;
+
+        std::vector<uv_buf_t> bufs;
+
+        /** Index of the registered buffer, or -1. */
+        int buffer_index = -1;
+
+        /** Keep the registered buffers until the request of the thread pool completes. */
+        SharedBuffers buffers;
+
+        IoCallback    io_callback;
+        StateCallback state_callback;
+        ScanCallback  scan_callback;
+
+        FileState state;
+        std::vector<std::string> names;
+
+        Op(OpType t, Impl * o) : type(t), owner(o)
+        {
+            ::memset(&req, 0, sizeof(req));
+            ::memset(&state, 0, sizeof(state));
+        }
+    };
+
+    Loop & loop;
+    Params params;
+    Backend backend;
+
+    std::size_t in_flight;
+    std::deque<Op*> pending;
+    std::unordered_set<Op*> pool_ops;
+
+    SharedBuffers buffers;
+
+#if defined(TBAG_ASYNC_FS_IO_URING)
+    std::unique_ptr<AsyncFsRing> ring;
+    std::shared_ptr<AsyncFsRingPoll> poll;
+    std::size_t ring_in_flight = 0;
+    bool buffers_registered = false;
+    bool polling = false;
+    bool reaping = false;
+#endif
+
+    Impl(Loop & l, Params const & p) : loop(l), params(p), backend(Backend::THREAD_POOL), in_flight(0)
+    {
+        if (params.max_in_flight == 0) {
+            params.max_in_flight = 1;
+        }
+        if (params.buffer_count > 0 && params.buffer_size > 0) {
+            buffers = std::make_shared<Buffers>(params.buffer_count * params.buffer_size);
+        } else {
+            params.buffer_count = 0;
+            params.buffer_size = 0;
+        }
+        if (params.backend == Backend::IO_URING) {
+            initRing();
+        }
+    }
+
+    ~Impl()
+    {
+        for (auto * op : pending) {
+            delete op;
+        }
+        pending.clear();
+
+        // The callbacks of the thread pool are called later, so detach the requests.
+        for (auto * op : pool_ops) {
+            op->owner = nullptr;
+            ::uv_cancel(reinterpret_cast<uv_req_t*>(&op->req));
+        }
+        pool_ops.clear();
+
+#if defined(TBAG_ASYNC_FS_IO_URING)
+        if (ring) {
+            // The kernel may still access the buffers, so wait for the requests.
+            while (ring_in_flight > 0) {
+                ring->wait(1);
+                ring->reap([&](uint64_t user_data, int result){
+                    UNUSED_PARAM(result);
+                    delete reinterpret_cast<Op*>(user_data);
+                    --ring_in_flight;
+                });
+            }
+            if (poll) {
+                poll->impl = nullptr;
+                if (!poll->isClosing()) {
+                    poll->close();
+                }
+                poll.reset();
+            }
+            ring.reset();
+        }
+#endif
+    }
+
+    void initRing()
+    {
+#if defined(TBAG_ASYNC_FS_IO_URING)
+        auto const ENTRIES = static_cast<unsigned>(std::min<std::size_t>(params.max_in_flight, AsyncFsRing::MAX_ENTRIES));
+        std::unique_ptr<AsyncFsRing> new_ring(new AsyncFsRing());
+        if (!new_ring->init(ENTRIES)) {
+            tDLogW("AsyncFs::Impl::initRing() The io_uring is not available, use the thread pool.");
+            return;
+        }
+
+        if (buffers) {
+            std::vector<iovec> iovecs(params.buffer_count);
+            for (std::size_t i = 0; i < params.buffer_count; ++i) {
+                iovecs[i].iov_base = buffers->data() + i * params.buffer_size;
+                iovecs[i].iov_len  = params.buffer_size;
+            }
+            buffers_registered = new_ring->registerBuffers(iovecs);
+            if (!buffers_registered) {
+                tDLogW("AsyncFs::Impl::initRing() Failed to register the buffers.");
+            }
+        }
+
+        try {
+            poll = loop.newInternalHandle<AsyncFsRingPoll>(true, loop, new_ring->event_fd, this);
+        } catch (...) {
+            poll.reset();
+        }
+        if (!poll) {
+            tDLogE("AsyncFs::Impl::initRing() Failed to create the poll handle.");
+            return;
+        }
+
+        // More requests than the completion queue would overflow it.
+        params.max_in_flight = std::min<std::size_t>(params.max_in_flight, new_ring->cq_entries);
+        ring = std::move(new_ring);
+        backend = Backend::IO_URING;
+#endif
+    }
+
+    char * getBuffer(std::size_t index) const
+    {
+        if (!buffers || index >= params.buffer_count) {
+            return nullptr;
+        }
+        return buffers->data() + index * params.buffer_size;
+    }
+
+    Op * newIo(OpType type, ufile file, binf const * infos, std::size_t infos_size,
+               int64_t offset, IoCallback const & callback)
+    {
+        auto * op = new Op(type, this);
+        op->file = file;
+        op->offset = offset;
+        op->bufs.resize(infos_size);
+        for (std::size_t i = 0; i < infos_size; ++i) {
+            op->bufs[i].base = infos[i].buffer;
+            op->bufs[i].len  = infos[i].size;
+        }
+        op->io_callback = callback;
+        return op;
+    }
+
+    Err submit(Op * op)
+    {
+        if (in_flight < params.max_in_flight) {
+            auto const CODE = start(op);
+            if (isFailure(CODE)) {
+                delete op;
+            }
+            return CODE;
+        }
+        if (params.max_pending != 0 && pending.size() >= params.max_pending) {
+            delete op;
+            return E_EBUSY;
+        }
+        pending.push_back(op);
+        return E_SUCCESS;
+    }
+
+    Err start(Op * op)
+    {
+#if defined(TBAG_ASYNC_FS_IO_URING)
+        if (ring && startRing(op)) {
+            ++in_flight;
+            return E_SUCCESS;
+        }
+#endif
+        auto const CODE = startPool(op);
+        if (isSuccess(CODE)) {
+            pool_ops.insert(op);
+            ++in_flight;
+        }
+        return CODE;
+    }
+
+#if defined(TBAG_ASYNC_FS_IO_URING)
+    bool startRing(Op * op)
+    {
+        switch (op->type) {
+        case OpType::READ:
+        case OpType::WRITE:
+            if (op->offset < 0) {
+                return false; // The current position requires the Linux 5.6.
+            }
+            break;
+        case OpType::FSYNC:
+        case OpType::FDATASYNC:
+            break;
+        default:
+            return false;
+        }
+
+        auto * sqe = ring->next();
+        if (sqe == nullptr) {
+            return false;
+        }
+
+        bool const IS_READ = (op->type == OpType::READ);
+        switch (op->type) {
+        case OpType::READ:
+        case OpType::WRITE:
+            if (op->buffer_index >= 0 && buffers_registered) {
+                sqe->opcode = (IS_READ ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED);
+                sqe->addr = reinterpret_cast<uint64_t>(op->bufs[0].base);
+                sqe->len = static_cast<uint32_t>(op->bufs[0].len);
+                sqe->buf_index = static_cast<uint16_t>(op->buffer_index);
+            } else {
+                // The uv_buf_t of the unix is compatible with the iovec.
+                sqe->opcode = (IS_READ ? IORING_OP_READV : IORING_OP_WRITEV);
+                sqe->addr = reinterpret_cast<uint64_t>(op->bufs.data());
+                sqe->len = static_cast<uint32_t>(op->bufs.size());
+            }
+            sqe->off = static_cast<uint64_t>(op->offset);
+            break;
+        case OpType::FDATASYNC:
+            sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+            sqe->opcode = IORING_OP_FSYNC;
+            break;
+        default:
+            sqe->opcode = IORING_OP_FSYNC;
+            break;
+        }
+        sqe->fd = op->file;
+        sqe->user_data = reinterpret_cast<uint64_t>(op);
+        ring->push();
+        ++ring_in_flight;
+
+        // The completions submit the next requests at once.
+        if (!reaping && !flushRing(op)) {
+            // The thread pool runs it instead.
+            return false;
+        }
+
+        if (!polling) {
+            poll->start(uvpp::Poll::EVENT_READABLE);
+            polling = true;
+        }
+        return true;
+    }
+
+    /**
+     * Submit the queued entries. If the kernel refuses them, they are taken back and failed.
+     *
+     * @return
+     *  false if the current request is taken back. It is not failed, and the caller keeps it.
+     */
+    bool flushRing(Op * current)
+    {
+        auto const RESULT = ring->submit();
+        if (RESULT >= 0) {
+            return true;
+        }
+        tDLogE("AsyncFs::Impl::flushRing() Submit error: {}", RESULT);
+
+        bool dropped_current = false;
+        std::vector<Op*> dropped;
+        ring->drop([&](uint64_t user_data){
+            auto * op = reinterpret_cast<Op*>(user_data);
+            assert(ring_in_flight > 0);
+            --ring_in_flight;
+            if (op == current) {
+                dropped_current = true;
+            } else {
+                dropped.push_back(op);
+            }
+        });
+
+        auto const CODE = convertUvErrorToErr(RESULT);
+        for (auto * op : dropped) {
+            complete(op, CODE, RESULT);
+        }
+        return !dropped_current;
+    }
+
+    void onRingEvent()
+    {
+        ring->clearEvent();
+        reaping = true;
+        ring->reap([&](uint64_t user_data, int result){
+            --ring_in_flight;
+            auto * op = reinterpret_cast<Op*>(user_data);
+            complete(op, (result < 0 ? convertUvErrorToErr(result) : E_SUCCESS), result);
+        });
+        reaping = false;
+        flushRing(nullptr);
+
+        // The active poll keeps the loop alive.
+        if (ring_in_flight == 0 && polling) {
+            poll->stop();
+            polling = false;
+        }
+    }
+#endif
+
+    static void onPoolCallback(uv_fs_t * req)
+    {
+        auto * op = static_cast<Op*>(req->data);
+        assert(op != nullptr);
+        if (op->owner == nullptr) {
+            ::uv_fs_req_cleanup(req);
+            delete op;
+            return;
+        }
+        op->owner->onPoolComplete(op);
+    }
+
+    Err startPool(Op * op)
+    {
+        auto * native_loop = loop.cast<uv_loop_t>();
+        auto * req = &op->req;
+        req->data = op;
+
+        int code;
+        switch (op->type) {
+        case OpType::OPEN:
+            code = ::uv_fs_open(native_loop, req, op->path.c_str(), op->flags, op->mode, &onPoolCallback);
+            break;
+        case OpType::CLOSE:
+            code = ::uv_fs_close(native_loop, req, op->file, &onPoolCallback);
+            break;
+        case OpType::READ:
+            code = ::uv_fs_read(native_loop, req, op->file, op->bufs.data(),
+                                static_cast<unsigned>(op->bufs.size()), op->offset, &onPoolCallback);
+            break;
+        case OpType::WRITE:
+            code = ::uv_fs_write(native_loop, req, op->file, op->bufs.data(),
+                                 static_cast<unsigned>(op->bufs.size()), op->offset, &onPoolCallback);
+            break;
+        case OpType::FSYNC:
+            code = ::uv_fs_fsync(native_loop, req, op->file, &onPoolCallback);
+            break;
+        case OpType::FDATASYNC:
+            code = ::uv_fs_fdatasync(native_loop, req, op->file, &onPoolCallback);
+            break;
+        case OpType::STAT:
+            code = ::uv_fs_stat(native_loop, req, op->path.c_str(), &onPoolCallback);
+            break;
+        case OpType::FSTAT:
+            code = ::uv_fs_fstat(native_loop, req, op->file, &onPoolCallback);
+            break;
+        case OpType::SCANDIR:
+            code = ::uv_fs_scandir(native_loop, req, op->path.c_str(), 0, &onPoolCallback);
+            break;
+        default:
+            return E_ILLARGS;
+        }
+
+        if (code < 0) {
+            ::uv_fs_req_cleanup(req);
+            return convertUvErrorToErr(code);
+        }
+        return E_SUCCESS;
+    }
+
+    void onPoolComplete(Op * op)
+    {
+        pool_ops.erase(op);
+
+        auto const RESULT = static_cast<int64_t>(op->req.result);
+        auto const CODE = (RESULT < 0 ? convertUvErrorToErr(static_cast<int>(RESULT)) : E_SUCCESS);
+        if (isSuccess(CODE)) {
+            if (op->type == OpType::STAT || op->type == OpType::FSTAT) {
+                op->state = details::toFileState(op->req.statbuf);
+            } else if (op->type == OpType::SCANDIR) {
+                uv_dirent_t dirent;
+                while (::uv_fs_scandir_next(&op->req, &dirent) != UV_EOF) {
+                    op->names.emplace_back(dirent.name);
+                }
+            }
+        }
+        ::uv_fs_req_cleanup(&op->req);
+        complete(op, CODE, RESULT);
+    }
+
+    void complete(Op * op, Err code, int64_t result)
+    {
+        assert(in_flight > 0);
+        --in_flight;
+        std::unique_ptr<Op> guard(op);
+        dispatchPending();
+        invoke(*op, code, result);
+    }
+
+    void dispatchPending()
+    {
+        while (!pending.empty() && in_flight < params.max_in_flight) {
+            std::unique_ptr<Op> op(pending.front());
+            pending.pop_front();
+            auto const CODE = start(op.get());
+            if (isSuccess(CODE)) {
+                op.release();
+            } else {
+                invoke(*op, CODE, 0);
+            }
+        }
+    }
+
+    static void invoke(Op & op, Err code, int64_t result)
+    {
+        switch (op.type) {
+        case OpType::STAT:
+        case OpType::FSTAT:
+            if (op.state_callback) {
+                op.state_callback(code, op.state);
+            }
+            break;
+        case OpType::SCANDIR:
+            if (op.scan_callback) {
+                op.scan_callback(code, op.names);
+            }
+            break;
+        default:
+            if (op.io_callback) {
+                op.io_callback(code, result);
+            }
+            break;
+        }
+    }
+
+    std::size_t cancelPending()
+    {
+        std::deque<Op*> canceled;
+        canceled.swap(pending);
+        for (auto * op : canceled) {
+            std::unique_ptr<Op> guard(op);
+            invoke(*op, E_ECANCELED, 0);
+        }
+        return canceled.size();
+    }
+};
+
+#if defined(TBAG_ASYNC_FS_IO_URING)
+void AsyncFsRingPoll::onPoll(Err status, EventType events)
+{
+    UNUSED_PARAM(status);
+    UNUSED_PARAM(events);
+    if (impl != nullptr) {
+        impl->onRingEvent();
+    }
+}
+#endif
+
+// ------------------------
+// AsyncFs implementation.
+// ------------------------
+
+using OpType = AsyncFs::Impl::OpType;
+using Op = AsyncFs::Impl::Op;
+
+AsyncFs::AsyncFs(Loop & loop) : AsyncFs(loop, Params())
+{
+    // EMPTY.
+}
+
+AsyncFs::AsyncFs(Loop & loop, Params const & params) : _impl(std::make_unique<Impl>(loop, params))
+{
+    assert(static_cast<bool>(_impl));
+}
+
+AsyncFs::~AsyncFs()
+{
+    // EMPTY.
+}
+
+AsyncFs::Backend AsyncFs::getBackend() const
+{
+    return _impl->backend;
+}
+
+std::size_t AsyncFs::getInFlight() const
+{
+    return _impl->in_flight;
+}
+
+std::size_t AsyncFs::getPending() const
+{
+    return _impl->pending.size();
+}
+
+std::size_t AsyncFs::getMaxInFlight() const
+{
+    return _impl->params.max_in_flight;
+}
+
+std::size_t AsyncFs::getBufferCount() const
+{
+    return _impl->params.buffer_count;
+}
+
+std::size_t AsyncFs::getBufferSize() const
+{
+    return _impl->params.buffer_size;
+}
+
+char * AsyncFs::getBuffer(std::size_t index)
+{
+    return _impl->getBuffer(index);
+}
+
+Err AsyncFs::open(std::string const & path, int flags, int mode, IoCallback const & callback)
+{
+    auto * op = new Op(OpType::OPEN, _impl.get());
+    op->path = path;
+    op->flags = flags;
+    op->mode = mode;
+    op->io_callback = callback;
+    return _impl->submit(op);
+}
+
+Err AsyncFs::close(ufile file, IoCallback const & callback)
+{
+    auto * op = new Op(OpType::CLOSE, _impl.get());
+    op->file = file;
+    op->io_callback = callback;
+    return _impl->submit(op);
+}
+
+Err AsyncFs::read(ufile file, char * buffer, std::size_t size, int64_t offset, IoCallback const & callback)
+{
+    binf const info(buffer, size);
+    return read(file, &info, 1U, offset, callback);
+}
+
+Err AsyncFs::read(ufile file, binf const * infos, std::size_t infos_size, int64_t offset, IoCallback const & callback)
+{
+    if (infos == nullptr || infos_size == 0) {
+        return E_ILLARGS;
+    }
+    return _impl->submit(_impl->newIo(OpType::READ, file, infos, infos_size, offset, callback));
+}
+
+Err AsyncFs::write(ufile file, char const * buffer, std::size_t size, int64_t offset, IoCallback const & callback)
+{
+    binf const info(const_cast<char*>(buffer), size);
+    return write(file, &info, 1U, offset, callback);
+}
+
+Err AsyncFs::write(ufile file, binf const * infos, std::size_t infos_size, int64_t offset, IoCallback const & callback)
+{
+    if (infos == nullptr || infos_size == 0) {
+        return E_ILLARGS;
+    }
+    return _impl->submit(_impl->newIo(OpType::WRITE, file, infos, infos_size, offset, callback));
+}
+
+static Err __submit_buffer_request(AsyncFs::Impl & impl, OpType type, AsyncFs::ufile file, std::size_t index,
+                                   std::size_t size, int64_t offset, AsyncFs::IoCallback const & callback)
+{
+    auto * buffer = impl.getBuffer(index);
+    if (buffer == nullptr || size > impl.params.buffer_size) {
+        return E_OORANGE;
+    }
+    AsyncFs::binf const info(buffer, size);
+    auto * op = impl.newIo(type, file, &info, 1U, offset, callback);
+    op->buffer_index = static_cast<int>(index);
+    op->buffers = impl.buffers;
+    return impl.submit(op);
+}
+
+Err AsyncFs::readBuffer(ufile file, std::size_t index, std::size_t size, int64_t offset, IoCallback const & callback)
+{
+    return __submit_buffer_request(*_impl, OpType::READ, file, index, size, offset, callback);
+}
+
+Err AsyncFs::writeBuffer(ufile file, std::size_t index, std::size_t size, int64_t offset, IoCallback const & callback)
+{
+    return __submit_buffer_request(*_impl, OpType::WRITE, file, index, size, offset, callback);
+}
+
+Err AsyncFs::fsync(ufile file, IoCallback const & callback)
+{
+    auto * op = new Op(OpType::FSYNC, _impl.get());
+    op->file = file;
+    op->io_callback = callback;
+    return _impl->submit(op);
+}
+
+Err AsyncFs::fdatasync(ufile file, IoCallback const & callback)
+{
+    auto * op = new Op(OpType::FDATASYNC, _impl.get());
+    op->file = file;
+    op->io_callback = callback;
+    return _impl->submit(op);
+}
+
+Err AsyncFs::stat(std::string const & path, StateCallback const & callback)
+{
+    auto * op = new Op(OpType::STAT, _impl.get());
+    op->path = path;
+    op->state_callback = callback;
+    return _impl->submit(op);
+}
+
+Err AsyncFs::fstat(ufile file, StateCallback const & callback)
+{
+    auto * op = new Op(OpType::FSTAT, _impl.get());
+    op->file = file;
+    op->state_callback = callback;
+    return _impl->submit(op);
+}
+
+Err AsyncFs::scandir(std::string const & path, ScanCallback const & callback)
+{
+    auto * op = new Op(OpType::SCANDIR, _impl.get());
+    op->path = path;
+    op->scan_callback = callback;
+    return _impl->submit(op);
+}
+
+std::size_t AsyncFs::cancelPending()
+{
+    return _impl->cancelPending();
+}
+
+} // namespace filesystem
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,175 @@
+/**
+ * @file   AsyncFs.hpp
+ * @brief  AsyncFs class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Clamp the max_in_flight of the io_uring)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_ASYNCFS_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_ASYNCFS_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/filesystem/details/FsTypes.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace uvpp { class Loop; }
+
+namespace filesystem {
+
+/**
+ * AsyncFs class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Asynchronous file I/O bound to the uvpp::Loop. @n
+ *  The callbacks are called from the loop thread. @n
+ *  The requests are submitted to the backend up to the max_in_flight. @n
+ *  The others wait in the pending queue and are submitted as the requests complete.
+ *  - THREAD_POOL: The uv_fs_* requests of the libuv thread pool.
+ *  - IO_URING: The io_uring of the Linux. The read/write/fsync requests are submitted to the ring,
+ *              and the others (open, close, stat, scandir) use the thread pool.
+ *              If the ring is not available, the THREAD_POOL is used.
+ *
+ * @warning
+ *  All methods must be called from the loop thread. @n
+ *  The buffers must be valid until the callback is called. @n
+ *  When the object is destroyed, the pending requests are discarded without the callback.
+ */
+class TBAG_API AsyncFs : private Noncopyable
+{
+public:
+    struct Impl;
+    friend struct Impl;
+
+public:
+    using UniqueImpl = std::unique_ptr<Impl>;
+    using Loop       = libtbag::uvpp::Loop;
+
+    using ufile     = details::ufile;
+    using binf      = details::binf;
+    using FileState = details::FileState;
+
+    enum class Backend
+    {
+        THREAD_POOL,
+        IO_URING,
+    };
+
+    struct Params
+    {
+        /** Preferred backend. */
+        Backend backend = Backend::THREAD_POOL;
+
+        /**
+         * Maximum number of the requests submitted to the backend.
+         * The io_uring clamps it to the size of the completion queue.
+         */
+        std::size_t max_in_flight = 64;
+
+        /** Maximum number of the pending requests. If 0, it is unlimited. */
+        std::size_t max_pending = 0;
+
+        /**
+         * Number and size of the registered buffers.
+         *
+         * @remarks
+         *  The io_uring pins the buffers once, so the readBuffer()/writeBuffer() skip the page mapping.
+         */
+        std::size_t buffer_count = 0;
+        std::size_t buffer_size  = 0;
+    };
+
+    /** The result is the number of bytes of the read/write, or the file of the open. */
+    using IoCallback    = std::function<void(Err code, int64_t result)>;
+    using StateCallback = std::function<void(Err code, FileState const & state)>;
+    using ScanCallback  = std::function<void(Err code, std::vector<std::string> const & names)>;
+
+private:
+    UniqueImpl _impl;
+
+public:
+    AsyncFs(Loop & loop);
+    AsyncFs(Loop & loop, Params const & params);
+    ~AsyncFs();
+
+public:
+    /** The backend in use. */
+    Backend getBackend() const;
+
+    std::size_t getInFlight() const;
+    std::size_t getPending() const;
+    std::size_t getMaxInFlight() const;
+
+    std::size_t getBufferCount() const;
+    std::size_t getBufferSize() const;
+    char * getBuffer(std::size_t index);
+
+public:
+    /**
+     * @return
+     *  E_EBUSY if the pending queue is full. @n
+     *  Otherwise the error of the submission. The callback is called only if it returns E_SUCCESS.
+     */
+    Err open(std::string const & path, int flags, int mode, IoCallback const & callback);
+    Err close(ufile file, IoCallback const & callback);
+
+    /** If the offset is negative, the current position of the file is used. */
+    Err read(ufile file, char * buffer, std::size_t size, int64_t offset, IoCallback const & callback);
+    Err read(ufile file, binf const * infos, std::size_t infos_size, int64_t offset, IoCallback const & callback);
+
+    Err write(ufile file, char const * buffer, std::size_t size, int64_t offset, IoCallback const & callback);
+    Err write(ufile file, binf const * infos, std::size_t infos_size, int64_t offset, IoCallback const & callback);
+
+    /** Read to the registered buffer. */
+    Err readBuffer(ufile file, std::size_t index, std::size_t size, int64_t offset, IoCallback const & callback);
+
+    /** Write from the registered buffer. */
+    Err writeBuffer(ufile file, std::size_t index, std::size_t size, int64_t offset, IoCallback const & callback);
+
+    Err fsync(ufile file, IoCallback const & callback);
+    Err fdatasync(ufile file, IoCallback const & callback);
+
+    Err stat(std::string const & path, StateCallback const & callback);
+    Err fstat(ufile file, StateCallback const & callback);
+
+    /** The names do not contain the '.' and '..'. */
+    Err scandir(std::string const & path, ScanCallback const & callback);
+
+public:
+    /**
+     * Cancel the pending requests.
+     *
+     * @return
+     *  Number of the canceled requests. Their callbacks are called with E_ECANCELED.
+     */
+    std::size_t cancelPending();
+};
+
+} // namespace filesystem
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_ASYNCFS_HPP__
+
@@ -3,11 +3,31 @@
  * @brief  File class implementation.
  * @author zer0
  * @date   2017-03-16
+ * @date   2026-10-19 (Add the kernel-accelerated copyFile and copyTree)
  */
 
 #include <libtbag/filesystem/File.hpp>
 #include <libtbag/filesystem/details/FsCommon.hpp>
 #include <libtbag/filesystem/Path.hpp>
+#include <libtbag/thread/ThreadPool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <uv.h>
+
+#if defined(TBAG_PLATFORM_LINUX)
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# if !defined(FICLONE)
+#  define FICLONE _IOW(0x94, 9, int)
+# endif
+# define TBAG_FILE_KERNEL_COPY
+#endif
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -222,14 +242,275 @@ Err writeFile(std::string const & path, util::Buffer const & content)
     return impl::writeFromBuffer(path, content);
 }
 
-Err copyFile(std::string const & source_path, std::string const & destination_path)
+// -------------
+namespace impl {
+// -------------
+
+/** Size of the single request to the kernel. It is the unit of the progress. */
+TBAG_CONSTEXPR static uint64_t const KERNEL_COPY_CHUNK_SIZE = 64 * MEGA_BYTE_TO_BYTE;
+TBAG_CONSTEXPR static std::size_t const BUFFER_COPY_CHUNK_SIZE = 1 * MEGA_BYTE_TO_BYTE;
+
+/** Shared state of the copy operation. */
+struct CopyContext
 {
-    libtbag::util::Buffer buffer;
-    auto const CODE = readFile(source_path, buffer);
+    using Clock = std::chrono::steady_clock;
+
+    CopyProgressCallback callback;
+    Clock::time_point begin;
+
+    uint64_t    total_size  = 0;
+    std::size_t total_files = 0;
+
+    std::atomic<uint64_t>    total_copied;
+    std::atomic<std::size_t> copied_files;
+
+    std::mutex mutex;
+
+    CopyContext(CopyProgressCallback const & cb) : callback(cb), begin(Clock::now()),
+                                                   total_copied(0), copied_files(0)
+    { /* EMPTY. */ }
+
+    void report(std::string const & path, uint64_t file_copied, uint64_t file_size)
+    {
+        // Load the totals in the lock, so the callback sees the monotonic values.
+        std::lock_guard<std::mutex> guard(mutex);
+        CopyProgress progress;
+        progress.path = path;
+        progress.file_copied = file_copied;
+        progress.file_size = file_size;
+        progress.total_copied = total_copied.load();
+        progress.total_size = total_size;
+        progress.copied_files = copied_files.load();
+        progress.total_files = total_files;
+
+        using namespace std::chrono;
+        auto const SECONDS = duration_cast<duration<double>>(Clock::now() - begin).count();
+        progress.bytes_per_second = (SECONDS > 0 ? progress.total_copied / SECONDS : 0);
+        callback(progress);
+    }
+};
+
+template <typename AdvanceFunc>
+static Err copyContent(File::ufile source, File::ufile destination, uint64_t size, AdvanceFunc advance)
+{
+    uint64_t offset = 0;
+
+#if defined(TBAG_FILE_KERNEL_COPY)
+    // The reflink shares the extents of the source. It fails on the most of the filesystems.
+    if (size > 0 && ::ioctl(destination, FICLONE, source) == 0) {
+        advance(size);
+        return E_SUCCESS;
+    }
+
+# if defined(__NR_copy_file_range)
+    // The destination offset is not specified, so the file position is updated
+    // and the following fallbacks continue from it.
+    while (offset < size) {
+        auto in_offset = static_cast<loff_t>(offset);
+        auto const CHUNK = static_cast<std::size_t>(std::min(KERNEL_COPY_CHUNK_SIZE, size - offset));
+        auto const COPIED = ::syscall(__NR_copy_file_range, source, &in_offset, destination, nullptr, CHUNK, 0u);
+        if (COPIED <= 0) {
+            break; // ENOSYS, EXDEV (Before Linux 5.3), EINVAL, or the source was truncated.
+        }
+        offset += static_cast<uint64_t>(COPIED);
+        advance(static_cast<uint64_t>(COPIED));
+    }
+# endif
+#endif
+
+    while (offset < size) {
+        auto const CHUNK = static_cast<std::size_t>(std::min(KERNEL_COPY_CHUNK_SIZE, size - offset));
+        uv_fs_t req = {0,};
+        auto const COPIED = uv_fs_sendfile(nullptr, &req, destination, source,
+                                           static_cast<int64_t>(offset), CHUNK, nullptr);
+        uv_fs_req_cleanup(&req);
+        if (COPIED <= 0) {
+            break;
+        }
+        offset += static_cast<uint64_t>(COPIED);
+        advance(static_cast<uint64_t>(COPIED));
+    }
+
+    if (offset < size) {
+        std::vector<char> buffer(static_cast<std::size_t>(std::min<uint64_t>(BUFFER_COPY_CHUNK_SIZE, size - offset)));
+        while (offset < size) {
+            auto const CHUNK = static_cast<std::size_t>(std::min<uint64_t>(buffer.size(), size - offset));
+            auto const READ_SIZE = details::read(source, buffer.data(), CHUNK, static_cast<int64_t>(offset));
+            if (READ_SIZE < 0) {
+                return convertUvErrorToErr(READ_SIZE);
+            } else if (READ_SIZE == 0) {
+                break; // The source was truncated.
+            }
+            auto const WRITE_SIZE = details::write(destination, buffer.data(), static_cast<std::size_t>(READ_SIZE),
+                                                   static_cast<int64_t>(offset));
+            if (WRITE_SIZE != READ_SIZE) {
+                return E_WRERR;
+            }
+            offset += static_cast<uint64_t>(READ_SIZE);
+            advance(static_cast<uint64_t>(READ_SIZE));
+        }
+    }
+    return E_SUCCESS;
+}
+
+static Err copyFile(std::string const & source_path, std::string const & destination_path, CopyContext * context)
+{
+    auto const SOURCE = details::open(source_path, File::Flags().clear().rdonly().flags, 0);
+    if (SOURCE < 0) {
+        return convertUvErrorToErr(SOURCE);
+    }
+
+    File::FileState source_state = {0};
+    if (!details::getStateWithFile(SOURCE, &source_state)) {
+        details::close(SOURCE);
+        return E_GET;
+    }
+
+    // The truncation of the same file loses the content.
+    File::FileState destination_state = {0};
+    if (details::getState(destination_path, &destination_state) &&
+        destination_state.dev == source_state.dev && destination_state.ino == source_state.ino) {
+        details::close(SOURCE);
+        return E_SUCCESS;
+    }
+
+    auto const MODE = static_cast<int>(source_state.mode & 0777);
+    auto const DESTINATION = details::open(destination_path, File::Flags().clear().creat().trunc().wronly().flags, MODE);
+    if (DESTINATION < 0) {
+        details::close(SOURCE);
+        return convertUvErrorToErr(DESTINATION);
+    }
+
+    auto const SIZE = source_state.size;
+    uint64_t file_copied = 0;
+    bool completed = false;
+    auto const CODE = copyContent(SOURCE, DESTINATION, SIZE, [&](uint64_t copied){
+        file_copied += copied;
+        if (context != nullptr) {
+            context->total_copied += copied;
+            if (file_copied >= SIZE) {
+                ++(context->copied_files);
+                completed = true;
+            }
+            if (context->callback) {
+                context->report(source_path, file_copied, SIZE);
+            }
+        }
+    });
+
+    details::close(SOURCE);
+    bool const CLOSED = details::close(DESTINATION);
     if (isFailure(CODE)) {
         return CODE;
     }
-    return writeFile(destination_path, buffer);
+    if (!CLOSED) {
+        return E_WRERR;
+    }
+    if (context != nullptr && !completed) {
+        ++(context->copied_files); // Empty or truncated file.
+        if (context->callback) {
+            context->report(source_path, file_copied, SIZE);
+        }
+    }
+    return E_SUCCESS;
+}
+
+// ----------------
+} // namespace impl
+// ----------------
+
+Err copyFile(std::string const & source_path, std::string const & destination_path)
+{
+    return impl::copyFile(source_path, destination_path, nullptr);
+}
+
+Err copyFile(std::string const & source_path, std::string const & destination_path,
+             CopyProgressCallback const & callback)
+{
+    if (!callback) {
+        return impl::copyFile(source_path, destination_path, nullptr);
+    }
+    impl::CopyContext context(callback);
+    context.total_size = Path(source_path).getState().size;
+    context.total_files = 1;
+    return impl::copyFile(source_path, destination_path, &context);
+}
+
+Err copyTree(std::string const & source_dir, std::string const & destination_dir,
+             std::size_t thread_count, CopyProgressCallback const & callback)
+{
+    Path const SOURCE_DIR(source_dir);
+    Path const DESTINATION_DIR(destination_dir);
+    if (!SOURCE_DIR.isDirectory()) {
+        return E_ILLARGS;
+    }
+    if (!DESTINATION_DIR.isDirectory() && !DESTINATION_DIR.createDir()) {
+        return E_CREATE;
+    }
+
+    // The parents are shorter than the children.
+    auto dirs = SOURCE_DIR.scanRecurrentNameOnly(Path::DIRENT_DIR);
+    std::sort(dirs.begin(), dirs.end(), [](std::string const & a, std::string const & b){
+        return a.size() < b.size();
+    });
+    for (auto const & dir : dirs) {
+        auto const PATH = DESTINATION_DIR / dir;
+        if (!PATH.isDirectory() && !PATH.createDir()) {
+            return E_CREATE;
+        }
+    }
+
+    struct Entry
+    {
+        std::string name;
+        uint64_t size;
+    };
+
+    impl::CopyContext context(callback);
+    std::vector<Entry> files;
+    for (auto const & name : SOURCE_DIR.scanRecurrentNameOnly(Path::DIRENT_FILE | Path::DIRENT_LINK)) {
+        auto const PATH = SOURCE_DIR / name;
+        if (PATH.isRegularFile()) {
+            auto const SIZE = PATH.getState().size;
+            files.push_back(Entry{name, SIZE});
+            context.total_size += SIZE;
+        }
+    }
+    context.total_files = files.size();
+    std::sort(files.begin(), files.end(), [](Entry const & a, Entry const & b){
+        return a.size > b.size;
+    });
+
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    thread_count = std::max<std::size_t>(1u, std::min(thread_count, files.size()));
+
+    std::mutex error_mutex;
+    Err first_error = E_SUCCESS;
+    std::atomic_bool failed(false);
+
+    {
+        libtbag::thread::ThreadPool pool(thread_count);
+        for (auto const & file : files) {
+            pool.push([&, file](){
+                if (failed) {
+                    return;
+                }
+                auto const CODE = impl::copyFile(SOURCE_DIR / file.name, DESTINATION_DIR / file.name, &context);
+                if (isFailure(CODE)) {
+                    std::lock_guard<std::mutex> guard(error_mutex);
+                    if (!failed) {
+                        first_error = CODE;
+                        failed = true;
+                    }
+                }
+            });
+        }
+        pool.exit();
+        pool.join();
+    }
+    return first_error;
 }
 
 } // namespace filesystem
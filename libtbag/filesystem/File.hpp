@@ -3,6 +3,7 @@
  * @brief  File class prototype.
  * @author zer0
  * @date   2017-03-16
+ * @date   2026-10-19 (Add the kernel-accelerated copyFile and copyTree)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_FILE_HPP__
@@ -22,6 +23,7 @@
 #include <libtbag/util/BufferInfo.hpp>
 
 #include <cstdint>
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -104,7 +106,67 @@ TBAG_API Err writeFile(std::string const & path, char const * buffer, std::size_
 TBAG_API Err writeFile(std::string const & path, std::string const & content);
 TBAG_API Err writeFile(std::string const & path, util::Buffer const & content);
 
+/**
+ * Progress of the copyFile() and copyTree().
+ *
+ * @remarks
+ *  The totals count all files of the operation.
+ */
+struct CopyProgress
+{
+    std::string path;           ///< Source path of the current file.
+    uint64_t file_copied;       ///< Copied bytes of the current file.
+    uint64_t file_size;         ///< Size of the current file.
+    uint64_t total_copied;      ///< Copied bytes of all files.
+    uint64_t total_size;        ///< Size of all files.
+    std::size_t copied_files;   ///< Number of completed files.
+    std::size_t total_files;    ///< Number of all files.
+    double bytes_per_second;    ///< Average throughput from the beginning.
+};
+
+/**
+ * Called after each chunk of the copy.
+ *
+ * @warning
+ *  The copyTree() calls it from the worker threads, but never concurrently.
+ */
+using CopyProgressCallback = std::function<void(CopyProgress const &)>;
+
+/**
+ * Copy the file without the user space buffer if possible.
+ *
+ * @remarks
+ *  The methods are tried in the following order:
+ *  - Linux: FICLONE reflink (Btrfs, XFS, ...) which shares the extents.
+ *  - Linux: copy_file_range() in the kernel.
+ *  - sendfile() of the libuv. (It emulates the missing system call)
+ *  - read()/write() with the fixed size buffer.
+ *  The destination is truncated and gets the permissions of the source.
+ */
 TBAG_API Err copyFile(std::string const & source_path, std::string const & destination_path);
+TBAG_API Err copyFile(std::string const & source_path, std::string const & destination_path,
+                      CopyProgressCallback const & callback);
+
+/**
+ * Copy the directory tree with the thread pool.
+ *
+ * @param[in] source_dir
+ *      Source directory.
+ * @param[in] destination_dir
+ *      Destination directory. It is created if it does not exist.
+ * @param[in] thread_count
+ *      Number of the copy threads. If 0, the number of the hardware threads is used.
+ * @param[in] callback
+ *      Progress callback.
+ *
+ * @return
+ *  The first error of the files. The remaining files are skipped after the error.
+ *
+ * @remarks
+ *  The largest files are started first to balance the threads.
+ */
+TBAG_API Err copyTree(std::string const & source_dir, std::string const & destination_dir,
+                      std::size_t thread_count = 0, CopyProgressCallback const & callback = nullptr);
 
 } // namespace filesystem
 
@@ -0,0 +1,332 @@
+/**
+ * @file   MappedFile.cpp
+ * @brief  MappedFile class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/filesystem/MappedFile.hpp>
+#include <libtbag/filesystem/details/FsCommon.hpp>
+#include <libtbag/config-ex.h>
+
+#include <cassert>
+#include <utility>
+
+#if defined(TBAG_PLATFORM_WINDOWS)
+# include <Windows.h>
+# include <uv.h>
+#elif defined(TBAG_HAVE_SYS_MMAN_H)
+# include <sys/mman.h>
+# if defined(TBAG_HAVE_UNISTD_H)
+#  include <unistd.h>
+# endif
+# define TBAG_MAPPED_FILE_POSIX
+#endif
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace filesystem {
+
+/** The offset of the mapping must be a multiple of this value. */
+static uint64_t getMapGranularity()
+{
+#if defined(TBAG_PLATFORM_WINDOWS)
+    SYSTEM_INFO info = {0,};
+    GetSystemInfo(&info);
+    return static_cast<uint64_t>(info.dwAllocationGranularity);
+#elif defined(TBAG_MAPPED_FILE_POSIX)
+    return static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 4096u;
+#endif
+}
+
+MappedFile::MappedFile()
+        : _file(0), _mode(Mode::READ_ONLY), _file_size(0),
+          _base(nullptr), _base_size(0), _mapping(nullptr),
+          _data(nullptr), _size(0), _offset(0)
+{
+    // EMPTY.
+}
+
+MappedFile::MappedFile(std::string const & path, Mode mode) : MappedFile()
+{
+    auto const code = open(path, mode);
+    if (isFailure(code)) {
+        throw ErrException(code);
+    }
+}
+
+MappedFile::MappedFile(MappedFile && obj) TBAG_NOEXCEPT : MappedFile()
+{
+    swap(obj);
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile & MappedFile::operator =(MappedFile && obj) TBAG_NOEXCEPT
+{
+    if (this != &obj) {
+        close();
+        swap(obj);
+    }
+    return *this;
+}
+
+void MappedFile::swap(MappedFile & obj) TBAG_NOEXCEPT
+{
+    if (this != &obj) {
+        std::swap(_file, obj._file);
+        std::swap(_mode, obj._mode);
+        std::swap(_file_size, obj._file_size);
+        std::swap(_base, obj._base);
+        std::swap(_base_size, obj._base_size);
+        std::swap(_mapping, obj._mapping);
+        std::swap(_data, obj._data);
+        std::swap(_size, obj._size);
+        std::swap(_offset, obj._offset);
+    }
+}
+
+Err MappedFile::open(std::string const & path, Mode mode, uint64_t offset, std::size_t size)
+{
+    close();
+
+    auto const FLAGS = (mode == Mode::READ_WRITE ? details::FILE_OPEN_FLAG_READ_WRITE : details::FILE_OPEN_FLAG_READ_ONLY);
+    auto const file = details::open(path, static_cast<int>(FLAGS), 0);
+    if (file < 0) {
+        return libtbag::convertUvErrorToErr(file);
+    }
+
+    details::FileState state = {0};
+    if (!details::getStateWithFile(file, &state)) {
+        details::close(file);
+        return E_GET;
+    }
+
+    _file = file;
+    _mode = mode;
+    _file_size = state.size;
+
+    auto const code = map(offset, size);
+    if (isFailure(code)) {
+        close();
+    }
+    return code;
+}
+
+Err MappedFile::map(uint64_t offset, std::size_t size)
+{
+    if (!isOpen()) {
+        return E_ILLSTATE;
+    }
+    if (offset > _file_size) {
+        return E_OORANGE;
+    }
+    if (size == TO_END) {
+        auto const REST = _file_size - offset;
+        if (REST > static_cast<uint64_t>(SIZE_MAX)) {
+            return E_OORANGE; // Too large for the address space. Map the range instead.
+        }
+        size = static_cast<std::size_t>(REST);
+    } else if (size > _file_size - offset) {
+        return E_OORANGE;
+    }
+
+    unmap();
+    _offset = offset;
+    if (size == 0) {
+        return E_SUCCESS;
+    }
+
+    auto const GRANULARITY = getMapGranularity();
+    auto const ALIGNED_OFFSET = offset - (offset % GRANULARITY);
+    auto const PADDING = static_cast<std::size_t>(offset - ALIGNED_OFFSET);
+    auto const MAP_SIZE = size + PADDING;
+
+#if defined(TBAG_PLATFORM_WINDOWS)
+    auto const HANDLE_VALUE = (HANDLE)uv_get_osfhandle(_file);
+    DWORD protect;
+    DWORD access;
+    switch (_mode) {
+    case Mode::READ_WRITE:    protect = PAGE_READWRITE; access = FILE_MAP_WRITE; break;
+    case Mode::COPY_ON_WRITE: protect = PAGE_WRITECOPY; access = FILE_MAP_COPY;  break;
+    default:                  protect = PAGE_READONLY;  access = FILE_MAP_READ;  break;
+    }
+    auto const END = offset + size;
+    HANDLE mapping = CreateFileMappingA(HANDLE_VALUE, nullptr, protect,
+                                        static_cast<DWORD>(END >> 32),
+                                        static_cast<DWORD>(END & 0xFFFFFFFFu), nullptr);
+    if (mapping == nullptr) {
+        return E_CREATE;
+    }
+    void * base = MapViewOfFile(mapping, access,
+                                static_cast<DWORD>(ALIGNED_OFFSET >> 32),
+                                static_cast<DWORD>(ALIGNED_OFFSET & 0xFFFFFFFFu), MAP_SIZE);
+    if (base == nullptr) {
+        CloseHandle(mapping);
+        return E_CREATE;
+    }
+    _mapping = mapping;
+#elif defined(TBAG_MAPPED_FILE_POSIX)
+    int prot;
+    int flags;
+    switch (_mode) {
+    case Mode::READ_WRITE:    prot = PROT_READ | PROT_WRITE; flags = MAP_SHARED;  break;
+    case Mode::COPY_ON_WRITE: prot = PROT_READ | PROT_WRITE; flags = MAP_PRIVATE; break;
+    default:                  prot = PROT_READ;              flags = MAP_SHARED;  break;
+    }
+    void * base = ::mmap(nullptr, MAP_SIZE, prot, flags, _file, static_cast<off_t>(ALIGNED_OFFSET));
+    if (base == MAP_FAILED) {
+        return libtbag::getGlobalSystemError();
+    }
+#else
+    UNUSED_PARAM(MAP_SIZE);
+    return E_EOPNOTSUPP;
+#endif
+
+#if defined(TBAG_PLATFORM_WINDOWS) || defined(TBAG_MAPPED_FILE_POSIX)
+    _base = base;
+    _base_size = MAP_SIZE;
+    _data = static_cast<char*>(base) + PADDING;
+    _size = size;
+    return E_SUCCESS;
+#endif
+}
+
+void MappedFile::unmap()
+{
+    if (_base != nullptr) {
+#if defined(TBAG_PLATFORM_WINDOWS)
+        UnmapViewOfFile(_base);
+        CloseHandle((HANDLE)_mapping);
+#elif defined(TBAG_MAPPED_FILE_POSIX)
+        ::munmap(_base, _base_size);
+#endif
+    }
+    _base = nullptr;
+    _base_size = 0;
+    _mapping = nullptr;
+    _data = nullptr;
+    _size = 0;
+    _offset = 0;
+}
+
+void MappedFile::close()
+{
+    unmap();
+    if (_file != 0) {
+        details::close(_file);
+        _file = 0;
+    }
+    _file_size = 0;
+}
+
+Err MappedFile::advise(Advice advice)
+{
+    return advise(advice, 0, _size);
+}
+
+Err MappedFile::advise(Advice advice, std::size_t offset, std::size_t size)
+{
+    if (offset > _size || size > _size - offset) {
+        return E_OORANGE;
+    }
+    if (size == 0) {
+        return E_SUCCESS;
+    }
+
+#if defined(TBAG_MAPPED_FILE_POSIX)
+    int hint;
+    switch (advice) {
+    case Advice::NORMAL:     hint = MADV_NORMAL;     break;
+    case Advice::SEQUENTIAL: hint = MADV_SEQUENTIAL; break;
+    case Advice::RANDOM:     hint = MADV_RANDOM;     break;
+    case Advice::WILL_NEED:  hint = MADV_WILLNEED;   break;
+    case Advice::DONT_NEED:  hint = MADV_DONTNEED;   break;
+    case Advice::HUGE_PAGE:
+# if defined(MADV_HUGEPAGE)
+        hint = MADV_HUGEPAGE;
+        break;
+# else
+        return E_EOPNOTSUPP;
+# endif
+    default:
+        return E_ILLARGS;
+    }
+
+    // The address of the madvise() must be page aligned.
+    auto const PAGE = static_cast<std::size_t>(getMapGranularity());
+    auto * begin = _data + offset;
+    auto * aligned = static_cast<char*>(_base) + ((begin - static_cast<char*>(_base)) / PAGE * PAGE);
+    auto const LENGTH = static_cast<std::size_t>(begin - aligned) + size;
+    if (::madvise(aligned, LENGTH, hint) != 0) {
+        return libtbag::getGlobalSystemError();
+    }
+    return E_SUCCESS;
+#elif defined(TBAG_PLATFORM_WINDOWS)
+    // The Windows has no equivalent hints, except the prefetch of the Windows 8.
+# if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+    if (advice == Advice::WILL_NEED) {
+        WIN32_MEMORY_RANGE_ENTRY entry;
+        entry.VirtualAddress = _data + offset;
+        entry.NumberOfBytes = size;
+        if (!PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0)) {
+            return E_UNKNOWN;
+        }
+    }
+# endif
+    UNUSED_PARAM(advice);
+    return E_SUCCESS;
+#else
+    UNUSED_PARAM(advice);
+    return E_EOPNOTSUPP;
+#endif
+}
+
+Err MappedFile::flush(bool async)
+{
+    if (_base == nullptr || _mode != Mode::READ_WRITE) {
+        return E_SUCCESS;
+    }
+#if defined(TBAG_PLATFORM_WINDOWS)
+    if (!FlushViewOfFile(_base, _base_size)) {
+        return E_WRERR;
+    }
+    if (!async && !FlushFileBuffers((HANDLE)uv_get_osfhandle(_file))) {
+        return E_WRERR;
+    }
+    return E_SUCCESS;
+#elif defined(TBAG_MAPPED_FILE_POSIX)
+    if (::msync(_base, _base_size, async ? MS_ASYNC : MS_SYNC) != 0) {
+        return libtbag::getGlobalSystemError();
+    }
+    return E_SUCCESS;
+#else
+    UNUSED_PARAM(async);
+    return E_EOPNOTSUPP;
+#endif
+}
+
+Err readFile(std::string const & path, MappedFile & result)
+{
+    auto const code = result.open(path, MappedFile::Mode::READ_ONLY);
+    if (isFailure(code)) {
+        return code;
+    }
+    // The hint is optional, so the failure is ignored.
+    result.advise(MappedFile::Advice::SEQUENTIAL);
+    return E_SUCCESS;
+}
+
+} // namespace filesystem
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,205 @@
+/**
+ * @file   MappedFile.hpp
+ * @brief  MappedFile class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_MAPPEDFILE_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_MAPPEDFILE_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/filesystem/details/FsTypes.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <cstdint>
+#include <string>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace filesystem {
+
+/**
+ * MappedFile class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Map the file (or a range of the file) into the address space without copying. @n
+ *  - READ_ONLY: Shared read-only pages.
+ *  - READ_WRITE: Shared writable pages. The changes are written back to the file.
+ *  - COPY_ON_WRITE: Private writable pages. The changes are never written back.
+ *
+ * @warning
+ *  Writing to the READ_ONLY mapping raises the segmentation fault. @n
+ *  If the file is truncated by the other process, access beyond the new end raises the SIGBUS.
+ */
+class TBAG_API MappedFile : private Noncopyable
+{
+public:
+    using ufile = details::ufile;
+
+    enum class Mode
+    {
+        READ_ONLY,
+        READ_WRITE,
+        COPY_ON_WRITE,
+    };
+
+    /** The access pattern hints. (madvise) */
+    enum class Advice
+    {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILL_NEED,
+        DONT_NEED,
+        HUGE_PAGE,
+    };
+
+    /** Map the rest of the file from the offset. */
+    TBAG_CONSTEXPR static std::size_t const TO_END = 0;
+
+private:
+    ufile _file;
+    Mode _mode;
+    uint64_t _file_size;
+
+    /** Page (allocation granularity) aligned mapping. */
+    void * _base;
+    std::size_t _base_size;
+
+    /** File mapping object of the Windows. */
+    void * _mapping;
+
+    char * _data;
+    std::size_t _size;
+    uint64_t _offset;
+
+public:
+    MappedFile();
+    MappedFile(std::string const & path, Mode mode = Mode::READ_ONLY);
+    MappedFile(MappedFile && obj) TBAG_NOEXCEPT;
+    ~MappedFile();
+
+public:
+    MappedFile & operator =(MappedFile && obj) TBAG_NOEXCEPT;
+
+public:
+    void swap(MappedFile & obj) TBAG_NOEXCEPT;
+
+    inline friend void swap(MappedFile & lh, MappedFile & rh) TBAG_NOEXCEPT
+    { lh.swap(rh); }
+
+public:
+    inline bool isOpen() const TBAG_NOEXCEPT
+    { return _file != 0; }
+
+    /** An empty range is not mapped, but it is a valid state. */
+    inline bool isMapped() const TBAG_NOEXCEPT
+    { return _base != nullptr; }
+
+    inline Mode mode() const TBAG_NOEXCEPT
+    { return _mode; }
+
+    inline uint64_t getFileSize() const TBAG_NOEXCEPT
+    { return _file_size; }
+
+    /** Offset of the mapped range in the file. */
+    inline uint64_t offset() const TBAG_NOEXCEPT
+    { return _offset; }
+
+    inline std::size_t size() const TBAG_NOEXCEPT
+    { return _size; }
+
+    inline bool empty() const TBAG_NOEXCEPT
+    { return _size == 0; }
+
+    inline char * data() TBAG_NOEXCEPT
+    { return _data; }
+
+    inline char const * data() const TBAG_NOEXCEPT
+    { return _data; }
+
+    inline char const * begin() const TBAG_NOEXCEPT
+    { return _data; }
+
+    inline char const * end() const TBAG_NOEXCEPT
+    { return _data + _size; }
+
+    inline util::cbinf span() const TBAG_NOEXCEPT
+    { return util::cbinf(_data, _size); }
+
+    inline util::binf span() TBAG_NOEXCEPT
+    { return util::binf(_data, _size); }
+
+public:
+    /**
+     * Open the file and map the range.
+     *
+     * @param[in] path
+     *      File path.
+     * @param[in] mode
+     *      Mapping mode.
+     * @param[in] offset
+     *      Offset of the range. It does not need to be aligned.
+     * @param[in] size
+     *      Size of the range. If TO_END, the rest of the file is mapped.
+     */
+    Err open(std::string const & path, Mode mode = Mode::READ_ONLY,
+             uint64_t offset = 0, std::size_t size = TO_END);
+
+    /**
+     * Replace the mapping with the other range of the opened file.
+     *
+     * @remarks
+     *  Used to walk the large file by the windows of the reasonable size.
+     */
+    Err map(uint64_t offset, std::size_t size = TO_END);
+
+    void unmap();
+    void close();
+
+public:
+    /** Apply the hint to the mapped range. */
+    Err advise(Advice advice);
+
+    /**
+     * Apply the hint to the part of the mapped range.
+     *
+     * @param[in] offset
+     *      Offset from the data().
+     */
+    Err advise(Advice advice, std::size_t offset, std::size_t size);
+
+    /** Write back the changes of the READ_WRITE mapping. */
+    Err flush(bool async = false);
+};
+
+/**
+ * Zero-copy alternative of the readFile().
+ *
+ * @remarks
+ *  The whole file is mapped as READ_ONLY with the SEQUENTIAL hint.
+ */
+TBAG_API Err readFile(std::string const & path, MappedFile & result);
+
+} // namespace filesystem
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_MAPPEDFILE_HPP__
+
@@ -3,6 +3,8 @@
  * @brief  RotatePath class implementation.
  * @author zer0
  * @date   2017-07-31
+ * @date   2026-10-19 (Add the BackgroundArchiveCleaner)
+ * @date   2026-10-19 (Restrict the retention to the prefix of the rotated files)
  */
 
 #include <libtbag/filesystem/RotatePath.hpp>
@@ -10,9 +12,14 @@
 #include <libtbag/string/StringUtils.hpp>
 #include <libtbag/string/Arguments.hpp>
 #include <libtbag/util/ByteString.hpp>
+#include <libtbag/thread/ThreadPool.hpp>
+#include <libtbag/log/Log.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <ctime>
 #include <utility>
+#include <vector>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -20,6 +27,150 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace filesystem {
 
+// ---------------------------------------
+// BackgroundArchiveCleaner implementation
+// ---------------------------------------
+
+BackgroundArchiveCleaner::BackgroundArchiveCleaner()
+        : BackgroundArchiveCleaner(DEFAULT_ARCHIVE_SUFFIX)
+{
+    // EMPTY.
+}
+
+BackgroundArchiveCleaner::BackgroundArchiveCleaner(std::string const & suffix, bool remove,
+                                                   int level, std::size_t queue)
+        : ArchiveCleaner(suffix, remove, level), retention(), queue_size(queue),
+          worker(std::make_unique<ThreadPool>(1U, true, false)),
+          working(0), archived_count(0), skipped_count(0), removed_count(0)
+{
+    // EMPTY.
+}
+
+BackgroundArchiveCleaner::~BackgroundArchiveCleaner()
+{
+    // The queued paths are archived before the thread exits.
+    worker->exit();
+    worker->join(false);
+}
+
+void BackgroundArchiveCleaner::clean(Path const & path)
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (working >= queue_size) {
+            ++skipped_count;
+            tDLogW("BackgroundArchiveCleaner::clean() The queue is full, skip the archive: {}", path.toString());
+            return;
+        }
+        ++working;
+    }
+
+    bool const PUSHED = worker->push([this, path](){
+        auto const ARCHIVE_PATH = archive(path);
+        std::size_t removed = 0;
+        if (!ARCHIVE_PATH.empty()) {
+            removed = applyRetention(ARCHIVE_PATH.getParent());
+        } else {
+            tDLogE("BackgroundArchiveCleaner::clean() Archive error: {}", path.toString());
+        }
+
+        std::lock_guard<std::mutex> guard(mutex);
+        if (!ARCHIVE_PATH.empty()) {
+            ++archived_count;
+        }
+        removed_count += removed;
+        --working;
+        condition.notify_all();
+    });
+
+    if (!PUSHED) {
+        std::lock_guard<std::mutex> guard(mutex);
+        ++skipped_count;
+        --working;
+        condition.notify_all();
+    }
+}
+
+void BackgroundArchiveCleaner::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this](){ return working == 0; });
+}
+
+std::size_t BackgroundArchiveCleaner::applyRetention(Path const & dir) const
+{
+    if (retention.max_count == 0 && retention.max_age_seconds == 0 && retention.max_total_size == 0) {
+        return 0;
+    }
+    if (retention.prefix.empty()) {
+        // Do not remove the unrelated archives of the directory.
+        tDLogW("BackgroundArchiveCleaner::applyRetention() The prefix is empty, skip the retention: {}",
+               dir.toString());
+        return 0;
+    }
+
+    struct Archive
+    {
+        Path path;
+        std::string name;
+        uint64_t size;
+        int64_t mtime;
+        int64_t mtime_nsec;
+    };
+
+    std::vector<Archive> archives;
+    for (auto const & name : dir.scanNameOnly(Path::DIRENT_FILE)) {
+        if (name.size() < retention.prefix.size() + archive_suffix.size() ||
+            name.compare(0, retention.prefix.size(), retention.prefix) != 0 ||
+            name.compare(name.size() - archive_suffix.size(), archive_suffix.size(), archive_suffix) != 0) {
+            continue;
+        }
+        auto const PATH = dir / name;
+        auto const STATE = PATH.getState();
+        archives.push_back(Archive{PATH, name, STATE.size,
+                                   static_cast<int64_t>(STATE.mtim.sec),
+                                   static_cast<int64_t>(STATE.mtim.nsec)});
+    }
+
+    // Newest first. The rotations in the same second are ordered by the nanoseconds and the name.
+    std::stable_sort(archives.begin(), archives.end(), [](Archive const & a, Archive const & b){
+        if (a.mtime != b.mtime) {
+            return a.mtime > b.mtime;
+        }
+        if (a.mtime_nsec != b.mtime_nsec) {
+            return a.mtime_nsec > b.mtime_nsec;
+        }
+        return a.name > b.name;
+    });
+
+    auto const NOW = static_cast<int64_t>(std::time(nullptr));
+    uint64_t total_size = 0;
+    std::size_t removed = 0;
+    for (std::size_t i = 0; i < archives.size(); ++i) {
+        auto const & cursor = archives[i];
+        total_size += cursor.size;
+
+        bool expired = false;
+        if (retention.max_count != 0 && i >= retention.max_count) {
+            expired = true;
+        } else if (retention.max_age_seconds != 0 &&
+                   NOW - cursor.mtime > static_cast<int64_t>(retention.max_age_seconds)) {
+            expired = true;
+        } else if (retention.max_total_size != 0 && total_size > retention.max_total_size) {
+            expired = true;
+        }
+
+        if (expired && cursor.path.remove()) {
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+// -------------------------
+// RotatePath implementation
+// -------------------------
+
 RotatePath::RotatePath()
         : path(), writer(), updater(), cleaner()
 {
@@ -90,12 +241,24 @@ RotatePath::~RotatePath()
     updater.reset();
 }
 
+std::string RotatePath::getRotatedFilePrefix(std::string const & pattern)
+{
+    auto const NAME = Path(pattern).getName();
+    return NAME.substr(0, NAME.find('$'));
+}
+
 RotatePath::InitParams RotatePath::createParams(std::string const & arguments, Environments const & envs)
 {
     TBAG_CONSTEXPR static char const * const DELIMITER = " ";
     TBAG_CONSTEXPR static char const * const KEY_VAL_DELIMITER = "=";
 
     InitParams result;
+    std::shared_ptr<BackgroundArchiveCleaner> background;
+    BackgroundArchiveCleaner::Retention retention;
+    bool exists_retention = false;
+
+    // File name prefix of the rotated files. (The default prefix of the retention)
+    std::string updater_prefix;
 
     using namespace libtbag::string;
     for (auto const & token : splitTokens(envs.convert(arguments), DELIMITER)) {
@@ -125,8 +288,10 @@ RotatePath::InitParams RotatePath::createParams(std::string const & arguments, E
         } else if (command == UPDATER_KEY_TIME) {
             if (args.empty()) {
                 result.updater = std::make_shared<TimeFormatUpdater>();
+                updater_prefix = getRotatedFilePrefix(TimeFormatUpdater::DEFAULT_TIME_FORMAT_STRING);
             } else {
                 result.updater = std::make_shared<TimeFormatUpdater>(args.at(0));
+                updater_prefix = getRotatedFilePrefix(args.at(0));
             }
 
         } else if (command == UPDATER_KEY_COUNTER) {
@@ -142,18 +307,47 @@ RotatePath::InitParams RotatePath::createParams(std::string const & arguments, E
                 args.opt(2, &counter);
                 result.updater = std::make_shared<CounterUpdater>(args.at(0), args.at(1), counter);
             }
+            updater_prefix = getRotatedFilePrefix(ARGS_SIZE == 0U ? CounterUpdater::DEFAULT_PREFIX : args.at(0));
 
         } else if (command == CLEANER_KEY_ARCHIVE) {
-            auto const ARGS_SIZE = args.size();
-            if (ARGS_SIZE == 0U) {
-                result.cleaner = std::make_shared<ArchiveCleaner>();
-            } else if (ARGS_SIZE == 1U) {
-                result.cleaner = std::make_shared<ArchiveCleaner>(args.at(0));
-            } else {
-                bool remove = true;
-                args.opt(1, &remove);
-                result.cleaner = std::make_shared<ArchiveCleaner>(args.at(0), remove);
+            std::string suffix = ArchiveCleaner::DEFAULT_ARCHIVE_SUFFIX;
+            bool remove = true;
+            int level = ArchiveCleaner::DEFAULT_COMPRESSION_LEVEL;
+            unsigned long queue = BackgroundArchiveCleaner::DEFAULT_QUEUE_SIZE;
+            if (args.size() >= 1U) {
+                suffix = args.at(0);
             }
+            args.opt(1, &remove);
+            args.opt(2, &level);
+            args.opt(3, &queue);
+            background = std::make_shared<BackgroundArchiveCleaner>(suffix, remove, level, queue);
+            result.cleaner = background;
+
+        } else if (command == CLEANER_KEY_RETENTION) {
+            unsigned long count = 0;
+            unsigned long age = 0;
+            args.opt(0, &count);
+            args.opt(1, &age);
+            retention.max_count = count;
+            retention.max_age_seconds = age;
+            if (args.size() >= 3U) {
+                auto const byte_size_result = libtbag::util::parseByteSize(args.at(2));
+                if (byte_size_result) {
+                    retention.max_total_size = byte_size_result.val;
+                }
+            }
+            if (args.size() >= 4U) {
+                retention.prefix = args.at(3);
+            }
+            exists_retention = true;
+        }
+    }
+
+    // The retention is independent of the order of the keys.
+    if (exists_retention && background) {
+        background->retention = retention;
+        if (background->retention.prefix.empty()) {
+            background->retention.prefix = updater_prefix;
         }
     }
     return result;
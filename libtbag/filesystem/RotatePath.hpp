@@ -3,6 +3,8 @@
  * @brief  RotatePath class prototype.
  * @author zer0
  * @date   2017-07-31
+ * @date   2026-10-19 (Add the BackgroundArchiveCleaner)
+ * @date   2026-10-19 (Restrict the retention to the prefix of the rotated files)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_FILESYSTEM_ROTATEPATH_HPP__
@@ -27,13 +29,21 @@
 #include <libtbag/time/TimePoint.hpp>
 
 #include <cassert>
+#include <cstdint>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
 // -------------------
 
+namespace thread {
+// Forward declaration.
+class ThreadPool;
+} // namespace thread
+
 namespace filesystem {
 
 /**
@@ -294,31 +304,123 @@ struct CleanerInterface
 struct ArchiveCleaner : public CleanerInterface
 {
     TBAG_CONSTEXPR static char const * const DEFAULT_ARCHIVE_SUFFIX = ".zip";
+    TBAG_CONSTEXPR static int const DEFAULT_COMPRESSION_LEVEL = -1;
 
     std::string archive_suffix;
     bool remove_source_file;
 
-    ArchiveCleaner() : archive_suffix(DEFAULT_ARCHIVE_SUFFIX), remove_source_file(true)
+    /**
+     * Compression level of the format. (e.g. 0~9 of the zip and 7zip)
+     * If negative, the default level of the format is used.
+     */
+    int compression_level;
+
+    ArchiveCleaner() : archive_suffix(DEFAULT_ARCHIVE_SUFFIX), remove_source_file(true),
+                       compression_level(DEFAULT_COMPRESSION_LEVEL)
+    { /* EMPTY. */ }
+    ArchiveCleaner(std::string const & suffix) : archive_suffix(suffix), remove_source_file(true),
+                                                 compression_level(DEFAULT_COMPRESSION_LEVEL)
     { /* EMPTY. */ }
-    ArchiveCleaner(std::string const & suffix) : archive_suffix(suffix), remove_source_file(true)
+    ArchiveCleaner(std::string const & suffix, bool remove) : archive_suffix(suffix), remove_source_file(remove),
+                                                              compression_level(DEFAULT_COMPRESSION_LEVEL)
     { /* EMPTY. */ }
-    ArchiveCleaner(std::string const & suffix, bool remove) : archive_suffix(suffix), remove_source_file(remove)
+    ArchiveCleaner(std::string const & suffix, bool remove, int level)
+            : archive_suffix(suffix), remove_source_file(remove), compression_level(level)
     { /* EMPTY. */ }
     virtual ~ArchiveCleaner()
     { /* EMPTY. */ }
 
     void clean(Path const & path) override
+    {
+        archive(path);
+    }
+
+    /** @return Archive path, or empty if failed. */
+    Path archive(Path const & path) const
     {
         using namespace libtbag::archive;
-        compressArchive(path.toString() + archive_suffix,
-                        { path.toString() },
-                        getCompressFormatFromOutputFileName(archive_suffix));
-        if (remove_source_file) {
+        std::string options;
+        if (compression_level >= 0) {
+            options = "compression-level=" + std::to_string(compression_level);
+        }
+        auto const ARCHIVE_PATH = path.toString() + archive_suffix;
+        auto const COUNT = compressArchive(ARCHIVE_PATH, { path.toString() },
+                                           getCompressFormatFromOutputFileName(archive_suffix),
+                                           CompressType::CT_NONE, options);
+        if (remove_source_file && COUNT > 0) {
             path.remove();
         }
+        return COUNT > 0 ? Path(ARCHIVE_PATH) : Path();
     }
 };
 
+/**
+ * Archiving an expired path in the background thread.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The clean() only pushes the path to the queue, so the writer never waits for the archiver. @n
+ *  If the queue is full, the path is skipped and remains uncompressed. @n
+ *  After archiving, the old archives are removed by the retention. @n
+ *  The destructor waits for the queued paths.
+ */
+struct TBAG_API BackgroundArchiveCleaner : public ArchiveCleaner
+{
+    using ThreadPool = libtbag::thread::ThreadPool;
+    using UniqueThreadPool = std::unique_ptr<ThreadPool>;
+
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_QUEUE_SIZE = 8;
+
+    /**
+     * Retention of the archives.
+     *
+     * @remarks
+     *  The archives are the files in the directory of the archive
+     *  whose names start with the prefix and end with the archive suffix. @n
+     *  The newest archives are kept, and the others are removed. @n
+     *  The zero value of the limits means unlimited. @n
+     *  If the prefix is empty, the retention is not applied.
+     *  (The createParams() uses the file name prefix of the counter or the time by default)
+     */
+    struct Retention
+    {
+        std::size_t max_count = 0;
+        uint64_t max_age_seconds = 0;
+        uint64_t max_total_size = 0;
+        std::string prefix;
+    };
+
+    Retention retention;
+    std::size_t queue_size;
+
+    UniqueThreadPool worker;
+
+    mutable std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t working;
+
+    /** Statistics. */
+    std::size_t archived_count;
+    std::size_t skipped_count;
+    std::size_t removed_count;
+
+    BackgroundArchiveCleaner();
+    BackgroundArchiveCleaner(std::string const & suffix, bool remove = true,
+                             int level = DEFAULT_COMPRESSION_LEVEL,
+                             std::size_t queue = DEFAULT_QUEUE_SIZE);
+    virtual ~BackgroundArchiveCleaner();
+
+    void clean(Path const & path) override;
+
+    /** Wait until the queue is empty. */
+    void wait();
+
+    /** Remove the archives in the directory by the retention. */
+    std::size_t applyRetention(Path const & dir) const;
+};
+
 /**
  * RotatePath class prototype.
  *
@@ -348,16 +450,33 @@ struct TBAG_API RotatePath
     TBAG_CONSTEXPR static char const * const UPDATER_KEY_COUNTER = "counter";
     TBAG_CONSTEXPR static char const * const UPDATER_KEY_TIME = "time";
     TBAG_CONSTEXPR static char const * const CLEANER_KEY_ARCHIVE = "archive";
+    TBAG_CONSTEXPR static char const * const CLEANER_KEY_RETENTION = "retention";
 
     /**
      * @remarks
      *  Examples:
      *  - size and counter: <code>size=1024m counter=/prefix/path/log,.log,0</code>
      *  - size and time and archive: <code>size=1024m time=/prefix/path/file-$py$pm$pdT$ph$pi$ps.log archive=.zip</code>
+     *  - archive in the background: <code>archive={suffix},{remove},{level},{queue}</code>
+     *  - retention of the archives: <code>retention={count},{age seconds},{total size},{prefix}</code>
+     *
+     *  The archive creates the BackgroundArchiveCleaner, so the write() never waits for the archiver. @n
+     *  If the prefix of the retention is omitted, the file name prefix of the counter or the time is used.
      */
     static InitParams createParams(std::string const & arguments, Environments const & envs);
     static InitParams createParams(std::string const & arguments);
 
+    /**
+     * File name prefix of the rotated files.
+     *
+     * @remarks
+     *  <pre>
+     *   /prefix/path/log              -> log
+     *   /prefix/path/file-$py$pm.log  -> file-
+     *  </pre>
+     */
+    static std::string getRotatedFilePrefix(std::string const & pattern);
+
     Path path;
 
     SharedWriter writer;
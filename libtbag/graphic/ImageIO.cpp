@@ -4,14 +4,17 @@
  * @author zer0
  * @date   2017-06-10
  * @date   2019-02-20 (Rename: Image -> ImageIO)
+ * @date   2026-10-19 (Decode the image files from the memory mapping)
  */
 
 #include <libtbag/graphic/ImageIO.hpp>
 #include <libtbag/log/Log.hpp>
 #include <libtbag/filesystem/Path.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
 #include <libtbag/string/StringUtils.hpp>
 
 #include <cassert>
+#include <climits>
 #include <cstdlib>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -138,10 +141,13 @@ bool writeTga(int width, int height, int channels, char const * data, libtbag::u
 }
 
 template <typename Predicated>
-static Err __read_image_cb(std::string const & path, Predicated predicated)
+static Err __read_image_cb(char const * buffer, std::size_t size, Predicated predicated)
 {
-    if (!filesystem::Path(path).exists()) {
-        return E_EEXIST;
+    if (buffer == nullptr || size == 0) {
+        return E_RDERR;
+    }
+    if (size > static_cast<std::size_t>(INT_MAX)) {
+        return E_OORANGE;
     }
 
     int width = 0;
@@ -152,7 +158,8 @@ static Err __read_image_cb(std::string const & path, Predicated predicated)
     // x = width, y = height, n = # 8-bit components per pixel ...
     // replace '0' with '1'..'4' to force that many components per pixel
     // but 'n' will always be the number that it would have been if you said 0
-    unsigned char * data = ::stbi_load(path.c_str(), &width, &height, &channels, 0);
+    unsigned char * data = ::stbi_load_from_memory((stbi_uc const *)buffer, static_cast<int>(size),
+                                                   &width, &height, &channels, 0);
     if (data == nullptr) {
         return E_RDERR;
     }
@@ -171,55 +178,91 @@ static Err __read_image_cb(std::string const & path, Predicated predicated)
     return E_SUCCESS;
 }
 
+template <typename Predicated>
+static Err __read_image_file_cb(std::string const & path, Predicated predicated)
+{
+    if (!filesystem::Path(path).exists()) {
+        return E_EEXIST;
+    }
+
+    // The encoded image is decoded from the page cache without the copy.
+    filesystem::MappedFile file;
+    auto const code = filesystem::readFile(path, file);
+    if (isFailure(code)) {
+        return code;
+    }
+    return __read_image_cb(file.data(), file.size(), predicated);
+}
+
 Err readImage(std::string const & path, Box & image)
 {
-    return __read_image_cb(path, [&](int w, int h, int c, unsigned char * d){
+    return __read_image_file_cb(path, [&](int w, int h, int c, unsigned char * d){
         image.resize<uint8_t>(h, w, c);
         memcpy(image.data(), d, image.size());
     });
 }
 
-Err readRgbaImage(std::string const & path, Box & image)
+Err readImage(char const * buffer, std::size_t size, Box & image)
+{
+    return __read_image_cb(buffer, size, [&](int w, int h, int c, unsigned char * d){
+        image.resize<uint8_t>(h, w, c);
+        memcpy(image.data(), d, image.size());
+    });
+}
+
+static void __copy_to_rgba(int w, int h, int c, unsigned char * d, Box & image)
 {
-    return __read_image_cb(path, [&](int w, int h, int c, unsigned char * d){
-        image.resize<uint8_t>(h, w, 4);
-        auto * dest = image.data<uint8_t>();
-        auto const size = w*h;
-        switch (c) {
-        case 1:
-            for (auto i = 0; i < size; ++i) {
-                dest[0] = *d;
-                dest[1] = *d;
-                dest[2] = *d;
-                dest[3] = 0xFF;
-                dest += 4;
-                d += 1;
-            }
-            break;
-        case 2:
-            for (auto i = 0; i < size; ++i) {
-                dest[0] = d[0];
-                dest[1] = d[0];
-                dest[2] = d[0];
-                dest[3] = d[1];
-                dest += 4;
-                d += 2;
-            }
-            break;
-        case 3:
-            for (auto i = 0; i < size; ++i) {
-                dest[0] = d[0];
-                dest[1] = d[1];
-                dest[2] = d[2];
-                dest[3] = 0xFF;
-                dest += 4;
-                d += 3;
-            }
-            break;
-        case 4:
-            memcpy(image.data(), d, image.size());
-            break;
+    image.resize<uint8_t>(h, w, 4);
+    auto * dest = image.data<uint8_t>();
+    auto const size = w*h;
+    switch (c) {
+    case 1:
+        for (auto i = 0; i < size; ++i) {
+            dest[0] = *d;
+            dest[1] = *d;
+            dest[2] = *d;
+            dest[3] = 0xFF;
+            dest += 4;
+            d += 1;
         }
+        break;
+    case 2:
+        for (auto i = 0; i < size; ++i) {
+            dest[0] = d[0];
+            dest[1] = d[0];
+            dest[2] = d[0];
+            dest[3] = d[1];
+            dest += 4;
+            d += 2;
+        }
+        break;
+    case 3:
+        for (auto i = 0; i < size; ++i) {
+            dest[0] = d[0];
+            dest[1] = d[1];
+            dest[2] = d[2];
+            dest[3] = 0xFF;
+            dest += 4;
+            d += 3;
+        }
+        break;
+    case 4:
+        memcpy(image.data(), d, image.size());
+        break;
+    }
+}
+
+Err readRgbaImage(std::string const & path, Box & image)
+{
+    return __read_image_file_cb(path, [&](int w, int h, int c, unsigned char * d){
+        __copy_to_rgba(w, h, c, d, image);
+    });
+}
+
+Err readRgbaImage(char const * buffer, std::size_t size, Box & image)
+{
+    return __read_image_cb(buffer, size, [&](int w, int h, int c, unsigned char * d){
+        __copy_to_rgba(w, h, c, d, image);
     });
 }
 
@@ -4,6 +4,7 @@
  * @author zer0
  * @date   2017-06-10
  * @date   2019-02-20 (Rename: Image -> ImageIO)
+ * @date   2026-10-19 (Add the readers of the encoded buffer)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_GRAPHIC_IMAGEIO_HPP__
@@ -79,6 +80,10 @@ TBAG_API bool writeTga(int width, int height, int channels, char const * data,
 TBAG_API Err readImage(std::string const & path, Box & image);
 TBAG_API Err readRgbaImage(std::string const & path, Box & image);
 
+/** Read the encoded image buffer. (e.g. filesystem::MappedFile) */
+TBAG_API Err readImage(char const * buffer, std::size_t size, Box & image);
+TBAG_API Err readRgbaImage(char const * buffer, std::size_t size, Box & image);
+
 /** Write image file. */
 TBAG_API Err writeImage(std::string const & path, Box const & image);
 
@@ -21,6 +21,15 @@
 #include <cstring>
 #include <sstream>
 
+#if defined(__AVX2__)
+# include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+# include <arm_neon.h>
+#endif
+
 #include <http_parser.h>
 
 // -------------------
@@ -29,6 +38,9 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace http {
 
+/** Rotated mask repeated for the widest (32 bytes) vector. */
+TBAG_CONSTEXPR static std::size_t const TBAG_WS_MASK_BLOCK_SIZE = 32;
+
 #define _TBAG_XX(num, name, str) \
     static_assert(static_cast<int>(::http_method::HTTP_##name) == static_cast<int>(HttpMethod::M_##name), \
                   "Mismatch HTTP " #str " Method number.");
@@ -139,12 +151,37 @@ std::string getHeaderValue(HttpHeaders const & header, std::string const & key)
     return std::string();
 }
 
+/**
+ * Same as <code>lower(trim(text)) == lower_key</code> without the memory allocation.
+ */
+static bool equalsTrimIgnoreCase(std::string const & text, std::string const & lower_key)
+{
+    using namespace libtbag::string;
+    std::size_t begin = 0;
+    std::size_t end = text.size();
+    while (begin < end && isWhiteSpace(text[begin])) {
+        ++begin;
+    }
+    while (end > begin && isWhiteSpace(text[end - 1])) {
+        --end;
+    }
+    if (end - begin != lower_key.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < lower_key.size(); ++i) {
+        if (::tolower(text[begin + i]) != lower_key[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::string getIgnoreCase(HttpHeaders const & header, std::string const & key)
 {
     using namespace libtbag::string;
     auto const COMPARE_KEY = lower(trim(key));
     for (auto & item : header) {
-        if (lower(trim(item.first)) == COMPARE_KEY) {
+        if (equalsTrimIgnoreCase(item.first, COMPARE_KEY)) {
             return item.second;
         }
     }
@@ -844,9 +881,11 @@ uint32_t copyMaskingKeyFromBuffer(char const * data) TBAG_NOEXCEPT
 
 std::string getPayloadData(uint32_t mask, std::string const & data)
 {
-    HttpBuffer const INPUT(data.begin(), data.end());
-    HttpBuffer const OUTPUT = getPayloadData(mask, INPUT);
-    return std::string(OUTPUT.begin(), OUTPUT.end());
+    std::string result(data.size(), '\0');
+    if (!data.empty()) {
+        copyPayloadData(mask, data.data(), &result[0], data.size());
+    }
+    return result;
 }
 
 HttpBuffer getPayloadData(uint32_t mask, HttpBuffer const & data)
@@ -856,17 +895,70 @@ HttpBuffer getPayloadData(uint32_t mask, HttpBuffer const & data)
 
 HttpBuffer getPayloadData(uint32_t mask, char const * data, std::size_t size)
 {
-    HttpBuffer result(data, data + size);
-    updatePayloadData(mask, result.data(), result.size());
+    HttpBuffer result(size);
+    copyPayloadData(mask, data, result.data(), size);
     return result;
 }
 
 void updatePayloadData(uint32_t mask, char * result, std::size_t size)
+{
+    copyPayloadData(mask, result, result, size, 0);
+}
+
+void updatePayloadData(uint32_t mask, char * result, std::size_t size, std::size_t offset)
+{
+    copyPayloadData(mask, result, result, size, offset);
+}
+
+void copyPayloadData(uint32_t mask, char const * source, char * destination,
+                     std::size_t size, std::size_t offset) TBAG_NOEXCEPT
 {
     static_assert(sizeof(uint32_t) == 4, "Why not?");
+
+    // The mask is rotated by the offset, so every block of 4 bytes uses the same mask.
     uint8_t const * mask_ptr = reinterpret_cast<uint8_t const *>(&mask);
-    for (std::size_t i = 0; i < size; ++i) {
-        *(result + i) ^= mask_ptr[i % sizeof(uint32_t)];
+    uint8_t rotated[TBAG_WS_MASK_BLOCK_SIZE];
+    for (std::size_t i = 0; i < TBAG_WS_MASK_BLOCK_SIZE; ++i) {
+        rotated[i] = mask_ptr[(offset + i) % sizeof(uint32_t)];
+    }
+
+    auto const * src = reinterpret_cast<uint8_t const *>(source);
+    auto * dest = reinterpret_cast<uint8_t *>(destination);
+    std::size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i const MASK256 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(rotated));
+    for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i)) {
+        __m256i const DATA = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i), _mm256_xor_si256(DATA, MASK256));
+    }
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    __m128i const MASK128 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(rotated));
+    for (; i + sizeof(__m128i) <= size; i += sizeof(__m128i)) {
+        __m128i const DATA = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_xor_si128(DATA, MASK128));
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    uint8x16_t const MASK128 = vld1q_u8(rotated);
+    for (; i + sizeof(uint8x16_t) <= size; i += sizeof(uint8x16_t)) {
+        vst1q_u8(dest + i, veorq_u8(vld1q_u8(src + i), MASK128));
+    }
+#endif
+
+    uint64_t mask64;
+    ::memcpy(&mask64, rotated, sizeof(uint64_t));
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t data;
+        ::memcpy(&data, src + i, sizeof(uint64_t));
+        data ^= mask64;
+        ::memcpy(dest + i, &data, sizeof(uint64_t));
+    }
+
+    // The index is a multiple of 4 here.
+    for (; i < size; ++i) {
+        dest[i] = src[i] ^ rotated[i % sizeof(uint32_t)];
     }
 }
 
@@ -100,6 +100,7 @@ TBAG_CONSTEXPR char const * const HEADER_SEC_WEBSOCKET_KEY      = "Sec-WebSocket
 TBAG_CONSTEXPR char const * const HEADER_SEC_WEBSOCKET_ACCEPT   = "Sec-WebSocket-Accept";
 TBAG_CONSTEXPR char const * const HEADER_SEC_WEBSOCKET_PROTOCOL = "Sec-WebSocket-Protocol";
 TBAG_CONSTEXPR char const * const HEADER_SEC_WEBSOCKET_VERSION  = "Sec-WebSocket-Version";
+TBAG_CONSTEXPR char const * const HEADER_SEC_WEBSOCKET_EXTENSIONS = "Sec-WebSocket-Extensions";
 
 /**
  * @}
@@ -107,6 +108,7 @@ TBAG_CONSTEXPR char const * const HEADER_SEC_WEBSOCKET_VERSION  = "Sec-WebSocket
 
 TBAG_CONSTEXPR char const * const VALUE_WEBSOCKET        = "WebSocket";
 TBAG_CONSTEXPR char const * const VALUE_UPGRADE          = "Upgrade";
+TBAG_CONSTEXPR char const * const VALUE_PERMESSAGE_DEFLATE = "permessage-deflate";
 TBAG_CONSTEXPR char const * const VALUE_TBAG_PROTOCOL    = "Tbag";
 TBAG_CONSTEXPR char const * const VALUE_TBAG_SERVER_INFO = LIBTBAG_TITLE_STRING "/" LIBTBAG_VERSION_STRING;
 
@@ -816,6 +818,25 @@ TBAG_API HttpBuffer  getPayloadData   (uint32_t mask, HttpBuffer const & data);
 TBAG_API HttpBuffer  getPayloadData   (uint32_t mask, char const * data, std::size_t size);
 TBAG_API void        updatePayloadData(uint32_t mask, char * result, std::size_t size);
 
+/**
+ * Mask (or unmask) the payload in place.
+ *
+ * @param[in] offset
+ *  Position of the first byte in the whole payload. (The mask is rotated by this value)
+ */
+TBAG_API void updatePayloadData(uint32_t mask, char * result, std::size_t size, std::size_t offset);
+
+/**
+ * Mask (or unmask) the payload while copying it.
+ *
+ * @remarks
+ *  The mask is applied 32/16 bytes at a time with the AVX2/SSE2/NEON instructions @n
+ *  (if they are enabled at compile time) and 8 bytes at a time otherwise. @n
+ *  The source and destination may be the same buffer.
+ */
+TBAG_API void copyPayloadData(uint32_t mask, char const * source, char * destination,
+                              std::size_t size, std::size_t offset = 0) TBAG_NOEXCEPT;
+
 TBAG_API uint64_t getPayloadLength(char const * total_data);
 TBAG_API uint64_t getPayloadLength(char const * data, uint8_t payload_length_7bit, WsPayloadBit payload_bit);
 
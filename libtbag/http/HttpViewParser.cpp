@@ -0,0 +1,646 @@
+/**
+ * @file   HttpViewParser.cpp
+ * @brief  HttpViewParser class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Look up the known headers in the perfect hash table)
+ */
+
+#include <libtbag/http/HttpViewParser.hpp>
+#include <libtbag/log/Log.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+#include <http_parser.h>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+TBAG_CONSTEXPR static uint32_t const FNV1A_32_OFFSET_BASIS = 2166136261u;
+TBAG_CONSTEXPR static uint32_t const FNV1A_32_PRIME = 16777619u;
+
+static inline char toLowerAscii(char c) TBAG_NOEXCEPT
+{
+    return ('A' <= c && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+static bool equalsIgnoreCase(char const * lh, char const * rh, std::size_t size) TBAG_NOEXCEPT
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        if (toLowerAscii(lh[i]) != toLowerAscii(rh[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static char const * const KNOWN_HEADER_NAMES[KNOWN_HEADER_SIZE] = {
+        "",                         // KH_UNKNOWN
+        HEADER_HOST,                // KH_HOST
+        HEADER_UPGRADE,             // KH_UPGRADE
+        HEADER_SERVER,              // KH_SERVER
+        HEADER_USER_AGENT,          // KH_USER_AGENT
+        HEADER_ACCEPT,              // KH_ACCEPT
+        "Accept-Encoding",          // KH_ACCEPT_ENCODING
+        HEADER_TRANSFER_ENCODING,   // KH_TRANSFER_ENCODING
+        HEADER_CONTENT_TYPE,        // KH_CONTENT_TYPE
+        HEADER_CONTENT_LENGTH,      // KH_CONTENT_LENGTH
+        "Content-Encoding",         // KH_CONTENT_ENCODING
+        HEADER_ORIGIN,              // KH_ORIGIN
+        HEADER_CONNECTION,          // KH_CONNECTION
+        "Keep-Alive",               // KH_KEEP_ALIVE
+        "Expect",                   // KH_EXPECT
+        HEADER_SEC_WEBSOCKET_KEY,        // KH_SEC_WEBSOCKET_KEY
+        HEADER_SEC_WEBSOCKET_ACCEPT,     // KH_SEC_WEBSOCKET_ACCEPT
+        HEADER_SEC_WEBSOCKET_PROTOCOL,   // KH_SEC_WEBSOCKET_PROTOCOL
+        HEADER_SEC_WEBSOCKET_VERSION,    // KH_SEC_WEBSOCKET_VERSION
+        HEADER_SEC_WEBSOCKET_EXTENSIONS, // KH_SEC_WEBSOCKET_EXTENSIONS
+};
+
+/**
+ * Pre-computed hash table of the well-known headers.
+ *
+ * @remarks
+ *  The slot of the header is <code>(hash >> shift) & SLOT_MASK</code>. @n
+ *  The shift is chosen at the construction so that the known headers do not collide (perfect hash),
+ *  so the lookup reads one slot and compares the name only once.
+ */
+struct KnownHeaderTable
+{
+    TBAG_CONSTEXPR static std::size_t const SLOT_SIZE = 128;
+    TBAG_CONSTEXPR static std::size_t const SLOT_MASK = SLOT_SIZE - 1;
+
+    static_assert((SLOT_SIZE & SLOT_MASK) == 0, "The SLOT_SIZE must be a power of two.");
+    static_assert(KNOWN_HEADER_SIZE <= 0xFF, "The index of the slot is 8bit.");
+
+    uint32_t hashes[KNOWN_HEADER_SIZE];
+    std::size_t sizes[KNOWN_HEADER_SIZE];
+
+    /** Index of the known header, or 0. (KH_UNKNOWN) */
+    uint8_t slots[SLOT_SIZE];
+    unsigned shift;
+
+    KnownHeaderTable() : shift(0)
+    {
+        for (std::size_t i = 0; i < KNOWN_HEADER_SIZE; ++i) {
+            sizes[i] = strlen(KNOWN_HEADER_NAMES[i]);
+            hashes[i] = getHeaderNameHash(KNOWN_HEADER_NAMES[i], sizes[i]);
+        }
+        for (; shift < 32; ++shift) {
+            if (build()) {
+                return;
+            }
+        }
+        // The new header collides with the others. Increase the SLOT_SIZE.
+        assert(false);
+        shift = 0;
+        ::memset(slots, 0x00, sizeof(slots));
+    }
+
+    inline std::size_t getSlot(uint32_t hash) const TBAG_NOEXCEPT
+    {
+        return (hash >> shift) & SLOT_MASK;
+    }
+
+    bool build()
+    {
+        ::memset(slots, 0x00, sizeof(slots));
+        for (std::size_t i = 1; i < KNOWN_HEADER_SIZE; ++i) {
+            auto & slot = slots[getSlot(hashes[i])];
+            if (slot != 0) {
+                return false;
+            }
+            slot = static_cast<uint8_t>(i);
+        }
+        return true;
+    }
+};
+
+static KnownHeaderTable const & getKnownHeaderTable()
+{
+    static KnownHeaderTable const TABLE;
+    return TABLE;
+}
+
+char const * getKnownHeaderName(KnownHeader header) TBAG_NOEXCEPT
+{
+    auto const INDEX = static_cast<std::size_t>(header);
+    if (INDEX >= KNOWN_HEADER_SIZE) {
+        return KNOWN_HEADER_NAMES[0];
+    }
+    return KNOWN_HEADER_NAMES[INDEX];
+}
+
+uint32_t getHeaderNameHash(char const * name, std::size_t size) TBAG_NOEXCEPT
+{
+    uint32_t hash = FNV1A_32_OFFSET_BASIS;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<uint8_t>(toLowerAscii(name[i]));
+        hash *= FNV1A_32_PRIME;
+    }
+    return hash;
+}
+
+KnownHeader getKnownHeader(char const * name, std::size_t size) TBAG_NOEXCEPT
+{
+    return getKnownHeader(getHeaderNameHash(name, size), name, size);
+}
+
+KnownHeader getKnownHeader(uint32_t hash, char const * name, std::size_t size) TBAG_NOEXCEPT
+{
+    auto const & TABLE = getKnownHeaderTable();
+    auto const INDEX = TABLE.slots[TABLE.getSlot(hash)];
+    if (INDEX != 0 && TABLE.hashes[INDEX] == hash && TABLE.sizes[INDEX] == size &&
+        equalsIgnoreCase(KNOWN_HEADER_NAMES[INDEX], name, size)) {
+        return static_cast<KnownHeader>(INDEX);
+    }
+    return KnownHeader::KH_UNKNOWN;
+}
+
+// clang-format off
+static int __view_on_message_begin__   (http_parser * parser);
+static int __view_on_url__             (http_parser * parser, const char * at, std::size_t length);
+static int __view_on_status__          (http_parser * parser, const char * at, std::size_t length);
+static int __view_on_header_field__    (http_parser * parser, const char * at, std::size_t length);
+static int __view_on_header_value__    (http_parser * parser, const char * at, std::size_t length);
+static int __view_on_headers_complete__(http_parser * parser);
+static int __view_on_body__            (http_parser * parser, const char * at, std::size_t length);
+static int __view_on_message_complete__(http_parser * parser);
+// clang-format on
+
+/**
+ * HttpViewParser::Impl class implementation.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct HttpViewParser::Impl : private Noncopyable
+{
+    HttpViewParser * parent;
+
+    http_parser_type      type;
+    http_parser           parser;
+    http_parser_settings  settings;
+
+    /** The last callback was on_header_value. */
+    bool last_was_value;
+
+    /** The last header is not finished. */
+    bool header_pending;
+
+    Impl(HttpViewParser * p, ParserType parser_type) : parent(p), last_was_value(false), header_pending(false)
+    {
+        assert(p != nullptr);
+
+        if (parser_type == ParserType::REQUEST) {
+            type = HTTP_REQUEST;
+        } else if (parser_type == ParserType::RESPONSE) {
+            type = HTTP_RESPONSE;
+        } else {
+            type = HTTP_BOTH;
+        }
+        init();
+
+        ::http_parser_settings_init(&settings);
+        settings.on_message_begin    = __view_on_message_begin__   ;
+        settings.on_url              = __view_on_url__             ;
+        settings.on_status           = __view_on_status__          ;
+        settings.on_header_field     = __view_on_header_field__    ;
+        settings.on_header_value     = __view_on_header_value__    ;
+        settings.on_headers_complete = __view_on_headers_complete__;
+        settings.on_body             = __view_on_body__            ;
+        settings.on_message_complete = __view_on_message_complete__;
+    }
+
+    ~Impl()
+    {
+        // EMPTY.
+    }
+
+    void init()
+    {
+        ::http_parser_init(&parser, type);
+        parser.data = this;
+        last_was_value = false;
+        header_pending = false;
+    }
+
+    // clang-format off
+    inline HttpView    & url        () TBAG_NOEXCEPT { return parent->_url;       }
+    inline HttpView    & status     () TBAG_NOEXCEPT { return parent->_status;    }
+    inline HeaderViews & headers    () TBAG_NOEXCEPT { return parent->_headers;   }
+    inline BodyViews   & bodies     () TBAG_NOEXCEPT { return parent->_bodies;    }
+    inline std::size_t & body_size  () TBAG_NOEXCEPT { return parent->_body_size; }
+    // clang-format on
+
+    inline void setHeadersComplete() TBAG_NOEXCEPT
+    { parent->_headers_complete = true; }
+    inline void setMessageComplete() TBAG_NOEXCEPT
+    { parent->_message_complete = true; }
+
+    inline uint32_t offset(char const * at) const TBAG_NOEXCEPT
+    {
+        assert(parent->_buffer.data() <= at);
+        return static_cast<uint32_t>(at - parent->_buffer.data());
+    }
+
+    /** http-parser may call the data callback several times for each string. */
+    inline void update(HttpView & view, char const * at, std::size_t length) const TBAG_NOEXCEPT
+    {
+        if (view.empty()) {
+            view.offset = offset(at);
+            view.size = static_cast<uint32_t>(length);
+        } else {
+            assert(view.offset + view.size == offset(at));
+            view.size += static_cast<uint32_t>(length);
+        }
+    }
+
+    void finishHeader()
+    {
+        if (!header_pending) {
+            return;
+        }
+        assert(!parent->_headers.empty());
+
+        auto & header = parent->_headers.back();
+        auto const * base = parent->_buffer.data();
+
+        // Trailing whitespace is part of the value in http-parser.
+        while (header.value.size > 0) {
+            auto const LAST = base[header.value.offset + header.value.size - 1];
+            if (LAST != ' ' && LAST != '\t') {
+                break;
+            }
+            --header.value.size;
+        }
+
+        auto const * name = base + header.name.offset;
+        header.hash = getHeaderNameHash(name, header.name.size);
+        header.known = getKnownHeader(header.hash, name, header.name.size);
+
+        auto & index = parent->_known[static_cast<std::size_t>(header.known)];
+        if (header.known != KnownHeader::KH_UNKNOWN && index == NO_INDEX) {
+            index = static_cast<int16_t>(parent->_headers.size() - 1);
+        }
+        header_pending = false;
+    }
+};
+
+// ----------------------------
+// Global http-parser events.
+// ----------------------------
+
+static inline HttpViewParser::Impl * getViewParserImpl(http_parser * parser)
+{
+    assert(parser != nullptr);
+    auto * impl = static_cast<HttpViewParser::Impl*>(parser->data);
+    assert(impl != nullptr);
+    assert(impl->parent != nullptr);
+    return impl;
+}
+
+int __view_on_message_begin__(http_parser * parser)
+{
+    UNUSED_PARAM(getViewParserImpl(parser));
+    return 0;
+}
+
+int __view_on_url__(http_parser * parser, const char * at, std::size_t length)
+{
+    auto * impl = getViewParserImpl(parser);
+    impl->update(impl->url(), at, length);
+    return 0;
+}
+
+int __view_on_status__(http_parser * parser, const char * at, std::size_t length)
+{
+    auto * impl = getViewParserImpl(parser);
+    impl->update(impl->status(), at, length);
+    return 0;
+}
+
+int __view_on_header_field__(http_parser * parser, const char * at, std::size_t length)
+{
+    auto * impl = getViewParserImpl(parser);
+    auto & headers = impl->headers();
+
+    // The field is split only if the data is received in pieces.
+    bool const CONTINUED = impl->header_pending && !impl->last_was_value &&
+                           headers.back().name.offset + headers.back().name.size == impl->offset(at);
+    if (!CONTINUED) {
+        impl->finishHeader();
+        if (headers.size() >= static_cast<std::size_t>(INT16_MAX)) {
+            return 1;
+        }
+        headers.emplace_back();
+        impl->header_pending = true;
+    }
+    impl->update(headers.back().name, at, length);
+    impl->last_was_value = false;
+    return 0;
+}
+
+int __view_on_header_value__(http_parser * parser, const char * at, std::size_t length)
+{
+    auto * impl = getViewParserImpl(parser);
+    auto & headers = impl->headers();
+    if (!impl->header_pending) {
+        return 1;
+    }
+    impl->update(headers.back().value, at, length);
+    impl->last_was_value = true;
+    return 0;
+}
+
+int __view_on_headers_complete__(http_parser * parser)
+{
+    auto * impl = getViewParserImpl(parser);
+    impl->finishHeader();
+    impl->setHeadersComplete();
+    return 0;
+}
+
+int __view_on_body__(http_parser * parser, const char * at, std::size_t length)
+{
+    auto * impl = getViewParserImpl(parser);
+    auto & bodies = impl->bodies();
+    auto const OFFSET = impl->offset(at);
+
+    // The Content-Length body is merged into a single view.
+    if (!bodies.empty() && bodies.back().offset + bodies.back().size == OFFSET) {
+        bodies.back().size += static_cast<uint32_t>(length);
+    } else {
+        HttpView view;
+        view.offset = OFFSET;
+        view.size = static_cast<uint32_t>(length);
+        bodies.push_back(view);
+    }
+    impl->body_size() += length;
+    return 0;
+}
+
+int __view_on_message_complete__(http_parser * parser)
+{
+    auto * impl = getViewParserImpl(parser);
+    impl->finishHeader(); // Chunked trailer.
+    impl->setMessageComplete();
+
+    // [IMPORTANT] Stop at the end of the message for the pipelined requests.
+    ::http_parser_pause(parser, 1);
+    return 0;
+}
+
+// ------------------------------
+// HttpViewParser implementation.
+// ------------------------------
+
+HttpViewParser::HttpViewParser(ParserType type)
+        : _impl(std::make_unique<Impl>(this, type)), _parsed(0), _body_size(0),
+          _headers_complete(false), _message_complete(false)
+{
+    assert(static_cast<bool>(_impl));
+    _headers.reserve(DEFAULT_HEADER_CAPACITY);
+    clearMessage();
+}
+
+HttpViewParser::~HttpViewParser()
+{
+    // EMPTY.
+}
+
+void HttpViewParser::clearMessage()
+{
+    _url = HttpView();
+    _status = HttpView();
+    _headers.clear();
+    _bodies.clear();
+    _body_size = 0;
+    std::fill(_known, _known + KNOWN_HEADER_SIZE, static_cast<int16_t>(NO_INDEX));
+    _headers_complete = false;
+    _message_complete = false;
+    _impl->last_was_value = false;
+    _impl->header_pending = false;
+}
+
+Err HttpViewParser::run()
+{
+    if (_message_complete) {
+        return E_SUCCESS;
+    }
+    if (_parsed >= _buffer.size()) {
+        return E_CONTINUE;
+    }
+
+    auto const * begin = _buffer.data() + _parsed;
+    auto const SIZE = _buffer.size() - _parsed;
+    auto const EXEC_SIZE = ::http_parser_execute(&_impl->parser, &_impl->settings, begin, SIZE);
+    _parsed += EXEC_SIZE;
+
+    auto const ERRNO = HTTP_PARSER_ERRNO(&_impl->parser);
+    if (ERRNO != HPE_OK && ERRNO != HPE_PAUSED) {
+        tDLogE("HttpViewParser::run() Execute {} error", ::http_errno_name(ERRNO));
+        return E_PARSING;
+    }
+    return _message_complete ? E_SUCCESS : E_CONTINUE;
+}
+
+void HttpViewParser::clear()
+{
+    _buffer.clear();
+    _parsed = 0;
+    clearMessage();
+    _impl->init();
+}
+
+Err HttpViewParser::execute(char const * data, std::size_t size)
+{
+    if (data != nullptr && size > 0) {
+        if (_buffer.size() + size > UINT32_MAX) {
+            return E_ILLARGS;
+        }
+        _buffer.insert(_buffer.end(), data, data + size);
+    }
+    return run();
+}
+
+Err HttpViewParser::next()
+{
+    if (!_message_complete) {
+        return E_ILLSTATE;
+    }
+
+    // Only the pipelined bytes are moved.
+    _buffer.erase(_buffer.begin(), _buffer.begin() + _parsed);
+    _parsed = 0;
+
+    clearMessage();
+    ::http_parser_pause(&_impl->parser, 0);
+    return run();
+}
+
+HttpViewParser::cbinf HttpViewParser::getMessage() const TBAG_NOEXCEPT
+{
+    return cbinf(_buffer.data(), _parsed);
+}
+
+HttpViewParser::cbinf HttpViewParser::getRemaining() const TBAG_NOEXCEPT
+{
+    return cbinf(_buffer.data() + _parsed, _buffer.size() - _parsed);
+}
+
+HttpViewParser::cbinf HttpViewParser::view(HttpView const & v) const TBAG_NOEXCEPT
+{
+    assert(v.offset + v.size <= _buffer.size());
+    return cbinf(_buffer.data() + v.offset, v.size);
+}
+
+std::string HttpViewParser::toString(HttpView const & v) const
+{
+    auto const VIEW = view(v);
+    return std::string(VIEW.buffer, VIEW.buffer + VIEW.size);
+}
+
+HttpMethod HttpViewParser::getMethod() const TBAG_NOEXCEPT
+{
+    return static_cast<HttpMethod>(_impl->parser.method);
+}
+
+int HttpViewParser::getStatusCode() const TBAG_NOEXCEPT
+{
+    return static_cast<int>(_impl->parser.status_code);
+}
+
+int HttpViewParser::getHttpMajor() const TBAG_NOEXCEPT
+{
+    return static_cast<int>(_impl->parser.http_major);
+}
+
+int HttpViewParser::getHttpMinor() const TBAG_NOEXCEPT
+{
+    return static_cast<int>(_impl->parser.http_minor);
+}
+
+bool HttpViewParser::shouldKeepAlive() const TBAG_NOEXCEPT
+{
+    return ::http_should_keep_alive(&_impl->parser) != 0;
+}
+
+bool HttpViewParser::isUpgrade() const TBAG_NOEXCEPT
+{
+    return _impl->parser.upgrade == 1;
+}
+
+bool HttpViewParser::isChunked() const TBAG_NOEXCEPT
+{
+    return (_impl->parser.flags & F_CHUNKED) != 0;
+}
+
+HttpHeaderView const * HttpViewParser::findHeader(KnownHeader header) const TBAG_NOEXCEPT
+{
+    auto const INDEX = static_cast<std::size_t>(header);
+    if (INDEX == 0 || INDEX >= KNOWN_HEADER_SIZE || _known[INDEX] == NO_INDEX) {
+        return nullptr;
+    }
+    return &_headers[static_cast<std::size_t>(_known[INDEX])];
+}
+
+HttpHeaderView const * HttpViewParser::findHeader(char const * name, std::size_t size) const TBAG_NOEXCEPT
+{
+    auto const HASH = getHeaderNameHash(name, size);
+    auto const KNOWN = getKnownHeader(HASH, name, size);
+    if (KNOWN != KnownHeader::KH_UNKNOWN) {
+        return findHeader(KNOWN);
+    }
+    for (auto const & header : _headers) {
+        if (header.hash == HASH && header.name.size == size &&
+            equalsIgnoreCase(_buffer.data() + header.name.offset, name, size)) {
+            return &header;
+        }
+    }
+    return nullptr;
+}
+
+HttpHeaderView const * HttpViewParser::findHeader(std::string const & name) const TBAG_NOEXCEPT
+{
+    return findHeader(name.data(), name.size());
+}
+
+bool HttpViewParser::existsHeader(KnownHeader header) const TBAG_NOEXCEPT
+{
+    return findHeader(header) != nullptr;
+}
+
+HttpViewParser::cbinf HttpViewParser::getHeaderView(KnownHeader header) const TBAG_NOEXCEPT
+{
+    auto const * found = findHeader(header);
+    return found != nullptr ? view(found->value) : cbinf();
+}
+
+HttpViewParser::cbinf HttpViewParser::getHeaderView(std::string const & name) const TBAG_NOEXCEPT
+{
+    auto const * found = findHeader(name);
+    return found != nullptr ? view(found->value) : cbinf();
+}
+
+bool HttpViewParser::equalsHeaderValue(KnownHeader header, char const * value) const TBAG_NOEXCEPT
+{
+    assert(value != nullptr);
+    auto const VIEW = getHeaderView(header);
+    auto const SIZE = strlen(value);
+    return VIEW.size == SIZE && equalsIgnoreCase(VIEW.buffer, value, SIZE);
+}
+
+std::string HttpViewParser::getHeader(KnownHeader header) const
+{
+    auto const * found = findHeader(header);
+    return found != nullptr ? toString(found->value) : std::string();
+}
+
+std::string HttpViewParser::getHeader(std::string const & name) const
+{
+    auto const * found = findHeader(name);
+    return found != nullptr ? toString(found->value) : std::string();
+}
+
+std::size_t HttpViewParser::getBody(Buffer & body) const
+{
+    body.resize(_body_size);
+    std::size_t offset = 0;
+    for (auto const & cursor : _bodies) {
+        memcpy(body.data() + offset, _buffer.data() + cursor.offset, cursor.size);
+        offset += cursor.size;
+    }
+    assert(offset == _body_size);
+    return _body_size;
+}
+
+void HttpViewParser::toProperty(HttpProperty & property) const
+{
+    libtbag::http::clear(property);
+    property.http_major = getHttpMajor();
+    property.http_minor = getHttpMinor();
+    if (_impl->parser.type == HTTP_REQUEST || !_url.empty()) {
+        property.method = ::http_method_str(static_cast<http_method>(_impl->parser.method));
+        property.path = toString(_url);
+    } else {
+        property.code = getStatusCode();
+        property.reason = toString(_status);
+    }
+    for (auto const & header : _headers) {
+        libtbag::http::insert(property.header, toString(header.name), toString(header.value));
+    }
+    getBody(property.body);
+}
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,263 @@
+/**
+ * @file   HttpViewParser.hpp
+ * @brief  HttpViewParser class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_HTTP_HTTPVIEWPARSER_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_HTTP_HTTPVIEWPARSER_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/http/HttpCommon.hpp>
+#include <libtbag/http/HttpParser.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+/**
+ * Well-known http headers.
+ *
+ * @remarks
+ *  The hash values of these names are computed once, @n
+ *  so these headers can be found without string comparison.
+ */
+enum class KnownHeader : uint8_t
+{
+    KH_UNKNOWN = 0,
+    KH_HOST,
+    KH_UPGRADE,
+    KH_SERVER,
+    KH_USER_AGENT,
+    KH_ACCEPT,
+    KH_ACCEPT_ENCODING,
+    KH_TRANSFER_ENCODING,
+    KH_CONTENT_TYPE,
+    KH_CONTENT_LENGTH,
+    KH_CONTENT_ENCODING,
+    KH_ORIGIN,
+    KH_CONNECTION,
+    KH_KEEP_ALIVE,
+    KH_EXPECT,
+    KH_SEC_WEBSOCKET_KEY,
+    KH_SEC_WEBSOCKET_ACCEPT,
+    KH_SEC_WEBSOCKET_PROTOCOL,
+    KH_SEC_WEBSOCKET_VERSION,
+    KH_SEC_WEBSOCKET_EXTENSIONS,
+    KH_SIZE_,
+};
+
+TBAG_CONSTEXPR std::size_t const KNOWN_HEADER_SIZE = static_cast<std::size_t>(KnownHeader::KH_SIZE_);
+
+TBAG_API char const * getKnownHeaderName(KnownHeader header) TBAG_NOEXCEPT;
+
+/** Case-insensitive FNV-1a hash of the header name. */
+TBAG_API uint32_t getHeaderNameHash(char const * name, std::size_t size) TBAG_NOEXCEPT;
+
+/** Find the well-known header of the name. */
+TBAG_API KnownHeader getKnownHeader(char const * name, std::size_t size) TBAG_NOEXCEPT;
+TBAG_API KnownHeader getKnownHeader(uint32_t hash, char const * name, std::size_t size) TBAG_NOEXCEPT;
+
+/**
+ * Position of the string in the raw buffer.
+ *
+ * @remarks
+ *  The offset is used instead of the pointer, @n
+ *  so the view remains valid even if the raw buffer is reallocated.
+ */
+struct HttpView
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+
+    inline bool empty() const TBAG_NOEXCEPT
+    { return size == 0; }
+};
+
+/**
+ * Header field of the raw buffer.
+ */
+struct HttpHeaderView
+{
+    HttpView name;
+    HttpView value;
+    uint32_t hash = 0;
+    KnownHeader known = KnownHeader::KH_UNKNOWN;
+};
+
+/**
+ * HttpViewParser class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Unlike HttpParser, this parser keeps the raw buffer of the message @n
+ *  and exposes the url, headers and body as (offset, length) views. @n
+ *  The buffer and view containers are reused, @n
+ *  so no memory is allocated for each message after the warm-up. @n
+ *  Strings are materialized only on request (e.g. getHeader(), toProperty()). @n
+ *  Pipelined messages are parsed one by one with the next() method.
+ *
+ * @warning
+ *  All views are invalidated by the next() or clear() method.
+ */
+class TBAG_API HttpViewParser : private Noncopyable
+{
+public:
+    using ParserType = HttpParser::ParserType;
+    using Buffer = libtbag::util::Buffer;
+    using cbinf = libtbag::util::cbinf;
+    using HeaderViews = std::vector<HttpHeaderView>;
+    using BodyViews = std::vector<HttpView>;
+
+    TBAG_CONSTEXPR static int16_t const NO_INDEX = -1;
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_HEADER_CAPACITY = 32;
+
+public:
+    struct Impl;
+    friend struct Impl;
+
+public:
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+private:
+    UniqueImpl _impl;
+
+private:
+    Buffer _buffer;
+    std::size_t _parsed;
+
+private:
+    HttpView _url;
+    HttpView _status;
+    HeaderViews _headers;
+    BodyViews _bodies;
+    std::size_t _body_size;
+    int16_t _known[KNOWN_HEADER_SIZE];
+
+private:
+    bool _headers_complete;
+    bool _message_complete;
+
+public:
+    HttpViewParser(ParserType type = ParserType::REQUEST);
+    ~HttpViewParser();
+
+public:
+    inline bool isHeadersComplete() const TBAG_NOEXCEPT
+    { return _headers_complete; }
+    inline bool isMessageComplete() const TBAG_NOEXCEPT
+    { return _message_complete; }
+
+    inline HeaderViews const & headers() const TBAG_NOEXCEPT
+    { return _headers; }
+    inline BodyViews const & bodies() const TBAG_NOEXCEPT
+    { return _bodies; }
+    inline std::size_t getBodySize() const TBAG_NOEXCEPT
+    { return _body_size; }
+
+private:
+    void clearMessage();
+    Err run();
+
+public:
+    /** Clear all buffers and the parser state. */
+    void clear();
+
+    /**
+     * Append the data to the raw buffer and parse it.
+     *
+     * @retval E_SUCCESS
+     *  A message is complete. The pipelined data after the message is not parsed yet.
+     * @retval E_CONTINUE
+     *  Wait for more data.
+     * @retval E_PARSING
+     *  Parsing error.
+     */
+    Err execute(char const * data, std::size_t size);
+
+    /**
+     * Discard the current message and parse the pipelined data.
+     *
+     * @return
+     *  Same as execute().
+     */
+    Err next();
+
+public:
+    /** Raw bytes of the current message. */
+    cbinf getMessage() const TBAG_NOEXCEPT;
+
+    /** Bytes after the current message. (e.g. WebSocket frames after the upgrade) */
+    cbinf getRemaining() const TBAG_NOEXCEPT;
+
+public:
+    cbinf view(HttpView const & v) const TBAG_NOEXCEPT;
+    std::string toString(HttpView const & v) const;
+
+    inline cbinf getUrl() const TBAG_NOEXCEPT
+    { return view(_url); }
+    inline cbinf getReason() const TBAG_NOEXCEPT
+    { return view(_status); }
+
+public:
+    HttpMethod getMethod() const TBAG_NOEXCEPT;
+    int getStatusCode() const TBAG_NOEXCEPT;
+    int getHttpMajor() const TBAG_NOEXCEPT;
+    int getHttpMinor() const TBAG_NOEXCEPT;
+
+    bool shouldKeepAlive() const TBAG_NOEXCEPT;
+    bool isUpgrade() const TBAG_NOEXCEPT;
+    bool isChunked() const TBAG_NOEXCEPT;
+
+public:
+    /** Constant time lookup. */
+    HttpHeaderView const * findHeader(KnownHeader header) const TBAG_NOEXCEPT;
+
+    /** Case-insensitive lookup. */
+    HttpHeaderView const * findHeader(char const * name, std::size_t size) const TBAG_NOEXCEPT;
+    HttpHeaderView const * findHeader(std::string const & name) const TBAG_NOEXCEPT;
+
+    bool existsHeader(KnownHeader header) const TBAG_NOEXCEPT;
+    cbinf getHeaderView(KnownHeader header) const TBAG_NOEXCEPT;
+    cbinf getHeaderView(std::string const & name) const TBAG_NOEXCEPT;
+
+    /** Case-insensitive comparison of the header value. */
+    bool equalsHeaderValue(KnownHeader header, char const * value) const TBAG_NOEXCEPT;
+
+public:
+    std::string getHeader(KnownHeader header) const;
+    std::string getHeader(std::string const & name) const;
+
+    std::size_t getBody(Buffer & body) const;
+
+    /** Materialize all strings of the current message. */
+    void toProperty(HttpProperty & property) const;
+};
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_HTTP_HTTPVIEWPARSER_HPP__
+
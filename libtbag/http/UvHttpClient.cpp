@@ -0,0 +1,1297 @@
+/**
+ * @file   UvHttpClient.cpp
+ * @brief  UvHttpClient class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Resolve the host names asynchronously)
+ * @date   2026-10-19 (Verify the certificate & host name of the HTTPS server)
+ */
+
+#include <libtbag/http/UvHttpClient.hpp>
+#include <libtbag/crypto/Tls.hpp>
+#include <libtbag/net/Ip.hpp>
+#include <libtbag/net/SocketAddress.hpp>
+#include <libtbag/net/Uri.hpp>
+#include <libtbag/string/StringUtils.hpp>
+#include <libtbag/uvpp/Dns.hpp>
+#include <libtbag/uvpp/Tcp.hpp>
+#include <libtbag/uvpp/Timer.hpp>
+#include <libtbag/uvpp/Request.hpp>
+#include <libtbag/uvpp/ex/SafetyAsync.hpp>
+#include <libtbag/log/Log.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include <http_parser.h>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+TBAG_CONSTEXPR static std::size_t const MAX_RETRY_COUNT = 1;
+
+static inline void append(UvHttpClient::Buffer & buffer, char const * data, std::size_t size)
+{
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+static inline void append(UvHttpClient::Buffer & buffer, std::string const & text)
+{
+    append(buffer, text.data(), text.size());
+}
+
+static inline void appendHeader(UvHttpClient::Buffer & buffer, char const * name, std::string const & value)
+{
+    append(buffer, name, strlen(name));
+    append(buffer, ": ", 2);
+    append(buffer, value);
+    append(buffer, "\r\n", 2);
+}
+
+/**
+ * UvHttpClient::Impl structure.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct UvHttpClient::Impl : private Noncopyable
+{
+    using Tcp = libtbag::uvpp::Tcp;
+    using Timer = libtbag::uvpp::Timer;
+    using DnsAddrInfo = libtbag::uvpp::DnsAddrInfo;
+    using SafetyAsync = libtbag::uvpp::ex::SafetyAsync;
+    using ConnectRequest = libtbag::uvpp::ConnectRequest;
+    using WriteRequest = libtbag::uvpp::WriteRequest;
+    using SocketAddress = libtbag::net::SocketAddress;
+    using Tls = libtbag::crypto::Tls;
+    using binf = libtbag::util::binf;
+
+    /** A request and its response. */
+    struct Call
+    {
+        Request request;
+        HttpResponse response;
+
+        /** Serialized request. */
+        Buffer data;
+
+        uint64_t deadline = 0;
+        std::size_t retries = 0;
+
+        /** Idempotent method. (It can be retried) */
+        bool idempotent = false;
+
+        /** Safe method. (It can be pipelined) */
+        bool pipelinable = false;
+
+        bool head = false;
+
+        /** The response began. (It can't be retried) */
+        bool received = false;
+    };
+
+    using SharedCall = std::shared_ptr<Call>;
+    using Calls = std::deque<SharedCall>;
+
+    struct Pool;
+
+    /**
+     * A pooled connection.
+     *
+     * @remarks
+     *  Once detached, the connection doesn't refer to the Impl anymore.
+     */
+    struct Connection : public Tcp
+    {
+        Impl * impl;
+        Pool * pool;
+
+        ConnectRequest connect_req;
+        WriteRequest write_req;
+
+        Buffer output;
+        Buffer writing;
+        bool is_writing = false;
+
+        /** Requests in flight, in the order of the responses. */
+        Calls calls;
+
+        /** Number of the calls (from the front) whose request was queued to the output. */
+        std::size_t sent = 0;
+
+        /** Completed by the current read callback. */
+        Calls completed;
+
+        http_parser parser;
+        std::string field;
+        std::string value;
+        bool in_value = false;
+        Err parse_error = E_SUCCESS;
+
+        std::unique_ptr<Tls> tls;
+
+        bool ready = false;
+        bool keep_alive = true;
+        bool detached = false;
+        bool referenced = true;
+
+        /** Number of the responses received. */
+        std::size_t served = 0;
+        uint64_t idle_since = 0;
+
+        Connection(Loop & loop, Impl * i, Pool * p) : Tcp(loop), impl(i), pool(p)
+        {
+            ::http_parser_init(&parser, HTTP_RESPONSE);
+            parser.data = this;
+        }
+
+        virtual ~Connection()
+        { /* EMPTY. */ }
+
+        inline bool isUsable() const TBAG_NOEXCEPT
+        { return !detached && keep_alive; }
+
+        /** The idle connections don't keep the loop alive. */
+        void setReference(bool enable)
+        {
+            if (referenced != enable) {
+                if (enable) {
+                    ref();
+                } else {
+                    unref();
+                }
+                referenced = enable;
+            }
+        }
+
+        void assign(SharedCall const & call)
+        {
+            calls.push_back(call);
+            setReference(true);
+            impl->max_in_flight = (std::max)(impl->max_in_flight, calls.size());
+            if (ready) {
+                sendPending();
+            }
+        }
+
+        void sendPending()
+        {
+            for (; sent < calls.size(); ++sent) {
+                auto const & data = calls[sent]->data;
+                if (tls) {
+                    auto const CODE = tls->write(data.data(), data.size());
+                    if (isFailure(CODE)) {
+                        tDLogE("UvHttpClient::Impl::Connection::sendPending() Encrypt {} error", CODE);
+                        fail(CODE);
+                        return;
+                    }
+                } else {
+                    append(output, data.data(), data.size());
+                }
+            }
+            if (tls) {
+                tls->drain(output);
+            }
+            flush();
+        }
+
+        void flushTls()
+        {
+            assert(static_cast<bool>(tls));
+            tls->drain(output);
+            flush();
+        }
+
+        void flush()
+        {
+            if (is_writing || output.empty() || detached) {
+                return;
+            }
+            writing.swap(output);
+            output.clear();
+
+            auto const CODE = write(write_req, writing.data(), writing.size());
+            if (isFailure(CODE)) {
+                tDLogE("UvHttpClient::Impl::Connection::flush() Write {} error", CODE);
+                fail(CODE);
+                return;
+            }
+            is_writing = true;
+        }
+
+        /** Detach from the pool and close. The calls in flight are retried or failed. */
+        void fail(Err code)
+        {
+            if (detached) {
+                return;
+            }
+            detached = true;
+            if (!isClosing()) {
+                close();
+            }
+            impl->detach(this, code);
+        }
+
+        void onPlain(char const * data, std::size_t size)
+        {
+            parse_error = E_SUCCESS;
+            ::http_parser_execute(&parser, &impl->settings, data, size);
+            if (detached) {
+                // Closed by the streaming callbacks.
+                return;
+            }
+
+            auto const ERRNO = HTTP_PARSER_ERRNO(&parser);
+            Err code = E_SUCCESS;
+            if (ERRNO != HPE_OK && ERRNO != HPE_PAUSED) {
+                code = isFailure(parse_error) ? parse_error : E_PARSING;
+                tDLogE("UvHttpClient::Impl::Connection::onPlain() Parse error: {}",
+                       ::http_errno_name(ERRNO));
+            }
+
+            Calls done;
+            done.swap(completed);
+            for (auto & call : done) {
+                impl->finish(call, E_SUCCESS);
+            }
+            if (detached) {
+                return;
+            }
+
+            if (isFailure(code)) {
+                fail(code);
+            } else if (!keep_alive) {
+                fail(E_CLOSED);
+            } else if (!done.empty()) {
+                if (calls.empty()) {
+                    idle_since = impl->now();
+                    setReference(false);
+                }
+                impl->dispatch(*pool);
+                impl->trimIdle(*pool);
+            }
+        }
+
+        virtual void onConnect(ConnectRequest & request, Err code) override
+        {
+            if (detached) {
+                return;
+            }
+            if (isFailure(code)) {
+                tDLogW("UvHttpClient::Impl::Connection::onConnect() Connect {}:{} {} error",
+                       pool->host, pool->port, code);
+                // The address may be changed.
+                pool->invalidate();
+                fail(code);
+                return;
+            }
+            if (impl->options.tcp_nodelay) {
+                setNodelay(true);
+            }
+
+            auto const READ_CODE = startRead();
+            if (isFailure(READ_CODE)) {
+                fail(READ_CODE);
+                return;
+            }
+
+            if (tls) {
+                tls->connect();
+                auto const HANDSHAKE_CODE = tls->handshake();
+                if (HANDSHAKE_CODE != E_SSLWREAD) {
+                    fail(E_SSL);
+                    return;
+                }
+                flushTls();
+                return;
+            }
+
+            ready = true;
+            sendPending();
+        }
+
+        virtual binf onAlloc(std::size_t suggested_size) override
+        {
+            return libtbag::uvpp::defaultOnAlloc(impl->read_buffer, suggested_size);
+        }
+
+        void onTlsRead(char const * buffer, std::size_t size)
+        {
+            if (isFailure(tls->writeToReadBuffer(buffer, size))) {
+                fail(E_SSL);
+                return;
+            }
+
+            if (!ready) {
+                auto const HANDSHAKE_CODE = tls->handshake();
+                flushTls();
+                if (detached) {
+                    return;
+                }
+                if (!tls->isFinished()) {
+                    if (HANDSHAKE_CODE != E_SSLWREAD) {
+                        tDLogE("UvHttpClient::Impl::Connection::onTlsRead() Handshake {} error: {}",
+                               HANDSHAKE_CODE, tls->getVerifyError());
+                        fail(E_SSL);
+                    }
+                    return;
+                }
+                ready = true;
+                // The next connection to this host resumes the session.
+                pool->tls_session = tls->getSession();
+                sendPending();
+                if (detached) {
+                    return;
+                }
+            }
+
+            auto & plain = impl->plain_buffer;
+            if (plain.size() < Tls::MAX_RECORD_SIZE) {
+                plain.resize(Tls::MAX_RECORD_SIZE);
+            }
+            while (true) {
+                std::size_t read_size = 0;
+                auto const CODE = tls->read(plain.data(), plain.size(), &read_size);
+                if (CODE == E_SSLWREAD) {
+                    break; // Partial record.
+                }
+                if (isFailure(CODE)) {
+                    fail(CODE);
+                    return;
+                }
+                onPlain(plain.data(), read_size);
+                if (detached) {
+                    return;
+                }
+            }
+        }
+
+        virtual void onRead(Err code, char const * buffer, std::size_t size) override
+        {
+            if (detached) {
+                return;
+            }
+            if (isFailure(code)) {
+                if (code == E_EOF && ready && !calls.empty()) {
+                    // The body is delimited by the end of the connection.
+                    keep_alive = false;
+                    onPlain(nullptr, 0);
+                    if (detached) {
+                        return;
+                    }
+                }
+                fail(code);
+                return;
+            }
+            if (calls.empty() && !tls) {
+                // The server must not send anything to the idle connection.
+                fail(E_ILLSTATE);
+                return;
+            }
+
+            if (tls) {
+                onTlsRead(buffer, size);
+            } else {
+                onPlain(buffer, size);
+            }
+        }
+
+        virtual void onWrite(WriteRequest & request, Err code) override
+        {
+            is_writing = false;
+            if (detached) {
+                return;
+            }
+            if (isFailure(code)) {
+                tDLogE("UvHttpClient::Impl::Connection::onWrite() Write {} error", code);
+                fail(code);
+                return;
+            }
+            flush();
+        }
+
+        virtual void onClose() override
+        {
+            if (!detached) {
+                // Closed by the loop.
+                detached = true;
+                impl->detach(this, E_CLOSED);
+            }
+        }
+
+        // -----------------
+        // http_parser hooks
+        // -----------------
+
+        inline static Connection * cast(http_parser * p) TBAG_NOEXCEPT
+        { return static_cast<Connection*>(p->data); }
+
+        void commitHeader()
+        {
+            if (!field.empty() || in_value) {
+                calls.front()->response.header.emplace(field, value);
+            }
+            field.clear();
+            value.clear();
+            in_value = false;
+        }
+
+        static int onMessageBegin(http_parser * p)
+        {
+            auto * conn = cast(p);
+            if (conn->detached || conn->calls.empty()) {
+                conn->parse_error = E_ILLSTATE;
+                return -1;
+            }
+            auto & call = conn->calls.front();
+            call->received = true;
+            libtbag::http::clear(call->response);
+            conn->field.clear();
+            conn->value.clear();
+            conn->in_value = false;
+            return 0;
+        }
+
+        static int onStatus(http_parser * p, char const * at, std::size_t length)
+        {
+            cast(p)->calls.front()->response.reason.append(at, length);
+            return 0;
+        }
+
+        static int onHeaderField(http_parser * p, char const * at, std::size_t length)
+        {
+            auto * conn = cast(p);
+            if (conn->in_value) {
+                conn->commitHeader();
+            }
+            conn->field.append(at, length);
+            return 0;
+        }
+
+        static int onHeaderValue(http_parser * p, char const * at, std::size_t length)
+        {
+            auto * conn = cast(p);
+            conn->in_value = true;
+            conn->value.append(at, length);
+            return 0;
+        }
+
+        static int onHeadersComplete(http_parser * p)
+        {
+            auto * conn = cast(p);
+            conn->commitHeader();
+
+            auto & call = conn->calls.front();
+            call->response.code = p->status_code;
+            call->response.http_major = p->http_major;
+            call->response.http_minor = p->http_minor;
+
+            if (call->request.headers_cb && !isInformational(p->status_code)) {
+                call->request.headers_cb(call->response);
+                if (conn->detached) {
+                    return -1;
+                }
+            }
+            // Skip the body of the HEAD response.
+            return call->head ? 1 : 0;
+        }
+
+        static int onBody(http_parser * p, char const * at, std::size_t length)
+        {
+            auto * conn = cast(p);
+            auto & call = conn->calls.front();
+            if (call->request.body_cb) {
+                call->request.body_cb(at, length);
+                return conn->detached ? -1 : 0;
+            }
+
+            auto & body = call->response.body;
+            if (body.size() + length > conn->impl->options.max_response_size) {
+                conn->parse_error = E_DATA_TOO_LARGE;
+                return -1;
+            }
+            append(body, at, length);
+            return 0;
+        }
+
+        static int onMessageComplete(http_parser * p)
+        {
+            auto * conn = cast(p);
+            auto & call = conn->calls.front();
+            if (isInformational(p->status_code)) {
+                // Wait for the final response. (e.g. 100 Continue)
+                libtbag::http::clear(call->response);
+                return 0;
+            }
+
+            conn->keep_alive = (::http_should_keep_alive(p) != 0);
+            conn->completed.push_back(call);
+            conn->calls.pop_front();
+            if (conn->sent > 0) {
+                --(conn->sent);
+            }
+            ++(conn->served);
+
+            if (!conn->keep_alive) {
+                // Ignore the rest of the stream.
+                ::http_parser_pause(p, 1);
+            }
+            return 0;
+        }
+
+        inline static bool isInformational(unsigned code) TBAG_NOEXCEPT
+        { return 100 <= code && code < 200 && code != 101; }
+    };
+
+    using SharedConnection = std::shared_ptr<Connection>;
+    using Connections = std::vector<SharedConnection>;
+
+    struct Resolver;
+
+    /** Connections & waiting requests of a host:port:tls key. */
+    struct Pool
+    {
+        std::string host;
+        int port = 0;
+        bool tls = false;
+
+        SocketAddress address;
+
+        /** The host is the IP address, so it is not resolved. */
+        bool numeric = false;
+        bool resolved = false;
+        uint64_t resolved_time = 0;
+
+        /** The uv_getaddrinfo() in progress. */
+        Resolver * resolver = nullptr;
+
+        /** Session of the last TLS handshake. */
+        libtbag::crypto::TlsSession tls_session;
+
+        Connections connections;
+        Calls waiting;
+
+        inline void invalidate() TBAG_NOEXCEPT
+        {
+            if (!numeric) {
+                resolved = false;
+            }
+        }
+    };
+
+    /**
+     * The asynchronous getaddrinfo(3) of a pool.
+     *
+     * @remarks
+     *  The resolver is deleted by itself after the callback, @n
+     *  because the request can't be released while it runs in the thread pool.
+     */
+    struct Resolver : public DnsAddrInfo
+    {
+        Impl * impl;
+        Pool * pool;
+
+        Resolver(Impl * i, Pool * p) : impl(i), pool(p)
+        { /* EMPTY. */ }
+
+        virtual ~Resolver()
+        { /* EMPTY. */ }
+
+        virtual void onGetAddrInfo(Err code, struct addrinfo * res) override
+        {
+            std::unique_ptr<Resolver> self(this);
+            if (impl != nullptr) {
+                impl->onResolve(*pool, code, *this);
+            }
+        }
+    };
+
+    struct Ticker : public Timer
+    {
+        Impl * impl;
+
+        Ticker(Loop & loop, Impl * i) : Timer(loop), impl(i)
+        { /* EMPTY. */ }
+
+        virtual void onTimer() override
+        {
+            if (impl != nullptr) {
+                impl->onTick();
+            }
+        }
+    };
+
+    Loop & loop;
+    Options options;
+
+    std::unordered_map<std::string, Pool> pools;
+
+    http_parser_settings settings;
+
+    /** All connections are read in the loop thread, so the read buffer is shared. */
+    std::vector<char> read_buffer;
+
+    /** Decrypted bytes of the TLS connections. */
+    std::vector<char> plain_buffer;
+
+    /** SSL context shared by all TLS connections. */
+    std::unique_ptr<Tls> tls_context;
+
+    std::shared_ptr<Ticker> timer;
+    std::shared_ptr<SafetyAsync> async;
+
+    std::atomic_bool closed;
+
+    std::size_t connect_count = 0;
+    std::size_t resolve_count = 0;
+    std::size_t max_in_flight = 0;
+
+    Impl(Loop & l, Options const & o) : loop(l), options(o), closed(false)
+    {
+        if (options.max_connections_per_host == 0) {
+            options.max_connections_per_host = 1;
+        }
+        if (options.max_pipeline_depth == 0) {
+            options.max_pipeline_depth = 1;
+        }
+
+        ::http_parser_settings_init(&settings);
+        settings.on_message_begin    = &Connection::onMessageBegin;
+        settings.on_status           = &Connection::onStatus;
+        settings.on_header_field     = &Connection::onHeaderField;
+        settings.on_header_value     = &Connection::onHeaderValue;
+        settings.on_headers_complete = &Connection::onHeadersComplete;
+        settings.on_body             = &Connection::onBody;
+        settings.on_message_complete = &Connection::onMessageComplete;
+
+        timer = loop.newHandle<Ticker>(loop, this);
+        if (!timer) {
+            throw std::bad_alloc();
+        }
+        timer->start(TIMER_INTERVAL_MILLISEC, TIMER_INTERVAL_MILLISEC);
+        timer->unref();
+
+        async = loop.newHandle<SafetyAsync>(loop);
+        if (!async) {
+            throw std::bad_alloc();
+        }
+        async->unref();
+    }
+
+    ~Impl()
+    {
+        close();
+    }
+
+    inline uint64_t now() const
+    {
+        return loop.getNowMilliseconds();
+    }
+
+    void finish(SharedCall const & call, Err code)
+    {
+        auto callback = std::move(call->request.response_cb);
+        call->request.response_cb = OnResponse();
+        if (callback) {
+            callback(code, call->response);
+        }
+    }
+
+    Err post(SharedCall const & call)
+    {
+        if (closed) {
+            return E_CLOSED;
+        }
+        if (!loop.isRunning() || loop.isAliveAndThisThread()) {
+            enqueue(call);
+            return E_SUCCESS;
+        }
+        return async->sendFunc([this, call](){
+            enqueue(call);
+        });
+    }
+
+    void serialize(Call & call)
+    {
+        auto const & request = call.request;
+        auto const METHOD = getHttpMethod(request.method);
+        call.head = (METHOD == HttpMethod::M_HEAD);
+        call.pipelinable = (METHOD == HttpMethod::M_GET || METHOD == HttpMethod::M_HEAD);
+        call.idempotent = call.pipelinable ||
+                          METHOD == HttpMethod::M_PUT ||
+                          METHOD == HttpMethod::M_DELETE ||
+                          METHOD == HttpMethod::M_OPTIONS;
+
+        auto & data = call.data;
+        data.clear();
+        append(data, request.method);
+        append(data, " ", 1);
+        append(data, request.path.empty() ? std::string(ROOT_PATH) : request.path);
+        append(data, " HTTP/1.1\r\n", 11);
+
+        if (getIgnoreCase(request.header, HEADER_HOST).empty()) {
+            auto const DEFAULT_PORT = request.tls ? DEFAULT_HTTPS_PORT : DEFAULT_HTTP_PORT;
+            if (request.port == DEFAULT_PORT) {
+                appendHeader(data, HEADER_HOST, request.host);
+            } else {
+                appendHeader(data, HEADER_HOST, request.host + ":" + std::to_string(request.port));
+            }
+        }
+        if (!options.user_agent.empty() && getIgnoreCase(request.header, HEADER_USER_AGENT).empty()) {
+            appendHeader(data, HEADER_USER_AGENT, options.user_agent);
+        }
+        for (auto const & header : request.header) {
+            appendHeader(data, header.first.c_str(), header.second);
+        }
+
+        bool const HAS_BODY = !request.body.empty() ||
+                              METHOD == HttpMethod::M_POST ||
+                              METHOD == HttpMethod::M_PUT ||
+                              METHOD == HttpMethod::M_PATCH;
+        if (HAS_BODY &&
+            getIgnoreCase(request.header, HEADER_CONTENT_LENGTH).empty() &&
+            getIgnoreCase(request.header, HEADER_TRANSFER_ENCODING).empty()) {
+            appendHeader(data, HEADER_CONTENT_LENGTH, std::to_string(request.body.size()));
+        }
+        append(data, "\r\n", 2);
+        append(data, request.body.data(), request.body.size());
+    }
+
+    void enqueue(SharedCall const & call)
+    {
+        if (closed) {
+            finish(call, E_CLOSED);
+            return;
+        }
+
+        auto const & request = call->request;
+        std::string key = request.host;
+        key += ':';
+        key += std::to_string(request.port);
+        key += (request.tls ? ":tls" : ":tcp");
+
+        auto itr = pools.find(key);
+        if (itr == pools.end()) {
+            Pool pool;
+            pool.host = request.host;
+            pool.port = request.port;
+            pool.tls = request.tls;
+
+            libtbag::net::IpAddress ip;
+            if (libtbag::net::parseIp(request.host.c_str(), request.host.size(), ip)) {
+                auto const CODE = pool.address.init(request.host, request.port);
+                if (isFailure(CODE)) {
+                    tDLogE("UvHttpClient::Impl::enqueue() Address {} error: {}", key, CODE);
+                    finish(call, CODE);
+                    return;
+                }
+                pool.numeric = true;
+                pool.resolved = true;
+            }
+            itr = pools.emplace(key, std::move(pool)).first;
+        }
+
+        call->deadline = now() + (request.timeout != 0 ? request.timeout : options.timeout);
+        serialize(*call);
+
+        itr->second.waiting.push_back(call);
+        dispatch(itr->second);
+    }
+
+    inline bool isResolved(Pool const & pool) const
+    {
+        if (!pool.resolved) {
+            return false;
+        }
+        return pool.numeric || options.dns_ttl == 0 || now() - pool.resolved_time < options.dns_ttl;
+    }
+
+    /** Start the uv_getaddrinfo() if it is not in progress. */
+    Err resolve(Pool & pool)
+    {
+        if (pool.resolver != nullptr) {
+            return E_SUCCESS;
+        }
+
+        std::unique_ptr<Resolver> resolver;
+        try {
+            resolver.reset(new Resolver(this, &pool));
+        } catch (...) {
+            return E_BADALLOC;
+        }
+
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        auto const CODE = resolver->requestAddrInfo(loop, pool.host, std::to_string(pool.port), &hints);
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+        pool.resolver = resolver.release();
+        return E_SUCCESS;
+    }
+
+    void onResolve(Pool & pool, Err code, DnsAddrInfo const & dns)
+    {
+        assert(pool.resolver != nullptr);
+        pool.resolver = nullptr;
+
+        if (isSuccess(code)) {
+            // The IPv4 address is preferred. (The servers often listen only on the IPv4)
+            auto const * addr = dns.findSockAddr(DnsAddrInfo::FindFlag::MOST_IPV4);
+            if (addr == nullptr) {
+                addr = dns.findFirst();
+            }
+            code = (addr != nullptr ? pool.address.init(addr) : E_NFOUND);
+        }
+
+        if (isFailure(code)) {
+            tDLogE("UvHttpClient::Impl::onResolve() Resolve {} error: {}", pool.host, code);
+            if (pool.resolved) {
+                // Keep the expired address if the host is not resolved again.
+                pool.resolved_time = now();
+            } else {
+                Calls failed;
+                failed.swap(pool.waiting);
+                for (auto & call : failed) {
+                    finish(call, code);
+                }
+                return;
+            }
+        } else {
+            pool.resolved = true;
+            pool.resolved_time = now();
+            ++resolve_count;
+        }
+        dispatch(pool);
+    }
+
+    SharedConnection connect(Pool & pool, Err & code)
+    {
+        std::unique_ptr<Tls> tls;
+        if (pool.tls) {
+            if (!tls_context) {
+                std::unique_ptr<Tls> context(new Tls());
+                if (!context->setVerifyPeer(options.tls_ca_file)) {
+                    code = E_SSL;
+                    return SharedConnection();
+                }
+                tls_context = std::move(context);
+            }
+            tls.reset(new Tls(Tls::reference_ssl_context{}, *tls_context));
+            if (!tls->setHostName(pool.host)) {
+                tDLogE("UvHttpClient::Impl::connect() Host name {} error", pool.host);
+                code = E_SSL;
+                return SharedConnection();
+            }
+            if (pool.tls_session) {
+                tls->setSession(pool.tls_session);
+            }
+        }
+
+        auto conn = loop.newHandle<Connection>(loop, this, &pool);
+        if (!conn) {
+            code = E_BADALLOC;
+            return SharedConnection();
+        }
+        conn->tls = std::move(tls);
+
+        code = libtbag::uvpp::initCommonClientSock(*conn, conn->connect_req, pool.address.getCommon());
+        if (isFailure(code)) {
+            conn->detached = true;
+            conn->close();
+            return SharedConnection();
+        }
+
+        pool.connections.push_back(conn);
+        ++connect_count;
+        return conn;
+    }
+
+    /** Assign the waiting requests to the connections. */
+    void dispatch(Pool & pool)
+    {
+        while (!pool.waiting.empty() && !closed) {
+            auto call = pool.waiting.front();
+            SharedConnection target;
+
+            // [1] Reuse an idle connection.
+            for (auto & conn : pool.connections) {
+                if (conn->isUsable() && conn->calls.empty()) {
+                    target = conn;
+                    break;
+                }
+            }
+
+            // [2] Pipeline on the connections which already served a keep-alive response.
+            if (!target && options.max_pipeline_depth > 1 && call->pipelinable) {
+                for (auto & conn : pool.connections) {
+                    if (!conn->isUsable() || conn->served == 0) {
+                        continue;
+                    }
+                    if (conn->calls.size() >= options.max_pipeline_depth) {
+                        continue;
+                    }
+                    bool const PIPELINABLE = std::all_of(conn->calls.begin(), conn->calls.end(),
+                                                         [](SharedCall const & c){ return c->pipelinable; });
+                    if (!PIPELINABLE) {
+                        continue;
+                    }
+                    if (!target || conn->calls.size() < target->calls.size()) {
+                        target = conn;
+                    }
+                }
+            }
+
+            // [3] Open a new connection.
+            if (!target && pool.connections.size() < options.max_connections_per_host) {
+                if (!isResolved(pool)) {
+                    auto const CODE = resolve(pool);
+                    if (isSuccess(CODE)) {
+                        break; // Wait for the address.
+                    }
+                    if (!pool.resolved) {
+                        tDLogE("UvHttpClient::Impl::dispatch() Resolve {} error: {}", pool.host, CODE);
+                        pool.waiting.pop_front();
+                        finish(call, CODE);
+                        continue;
+                    }
+                    // Connect to the expired address.
+                }
+
+                Err code = E_UNKNOWN;
+                target = connect(pool, code);
+                if (!target) {
+                    tDLogE("UvHttpClient::Impl::dispatch() Connect {}:{} {} error", pool.host, pool.port, code);
+                    pool.waiting.pop_front();
+                    finish(call, code);
+                    continue;
+                }
+            }
+
+            if (!target) {
+                break; // Wait for a connection.
+            }
+            pool.waiting.pop_front();
+            target->assign(call);
+        }
+    }
+
+    /** Close the surplus idle connections. */
+    void trimIdle(Pool & pool)
+    {
+        std::size_t idle = 0;
+        auto connections = pool.connections;
+        for (auto & conn : connections) {
+            if (conn->isUsable() && conn->calls.empty() && conn->ready) {
+                if (++idle > options.max_idle_connections_per_host) {
+                    conn->fail(E_CLOSED);
+                }
+            }
+        }
+    }
+
+    void detach(Connection * conn, Err code)
+    {
+        auto & pool = *(conn->pool);
+        auto itr = std::find_if(pool.connections.begin(), pool.connections.end(),
+                                [conn](SharedConnection const & c){ return c.get() == conn; });
+        SharedConnection keep;
+        if (itr != pool.connections.end()) {
+            keep = *itr;
+            pool.connections.erase(itr);
+        }
+
+        Calls retry;
+        Calls failed;
+        for (auto & call : conn->calls) {
+            // The server may close a reused connection before it reads the request.
+            if (!call->received && call->idempotent && call->retries < MAX_RETRY_COUNT && conn->served > 0) {
+                ++(call->retries);
+                retry.push_back(call);
+            } else {
+                failed.push_back(call);
+            }
+        }
+        conn->calls.clear();
+        conn->sent = 0;
+
+        pool.waiting.insert(pool.waiting.begin(), retry.begin(), retry.end());
+        for (auto & call : failed) {
+            finish(call, code);
+        }
+        dispatch(pool);
+    }
+
+    void onTick()
+    {
+        auto const NOW = now();
+        Calls expired;
+        Connections timeouts;
+        Connections idles;
+
+        for (auto & cursor : pools) {
+            auto & pool = cursor.second;
+            for (auto itr = pool.waiting.begin(); itr != pool.waiting.end();) {
+                if ((*itr)->deadline <= NOW) {
+                    expired.push_back(*itr);
+                    itr = pool.waiting.erase(itr);
+                } else {
+                    ++itr;
+                }
+            }
+            for (auto & conn : pool.connections) {
+                if (conn->detached) {
+                    continue;
+                }
+                if (!conn->calls.empty()) {
+                    if (conn->calls.front()->deadline <= NOW) {
+                        timeouts.push_back(conn);
+                    }
+                } else if (NOW - conn->idle_since >= options.idle_timeout) {
+                    idles.push_back(conn);
+                }
+            }
+        }
+
+        for (auto & conn : timeouts) {
+            if (conn->detached || conn->calls.empty()) {
+                continue;
+            }
+            // The other requests of the connection may be retried.
+            auto call = conn->calls.front();
+            conn->calls.pop_front();
+            conn->fail(E_TIMEOUT);
+            expired.push_back(call);
+        }
+        for (auto & conn : idles) {
+            if (conn->calls.empty()) {
+                conn->fail(E_TIMEOUT);
+            }
+        }
+        for (auto & call : expired) {
+            finish(call, E_TIMEOUT);
+        }
+    }
+
+    void close()
+    {
+        if (closed) {
+            return;
+        }
+        closed = true;
+
+        Calls calls;
+        for (auto & cursor : pools) {
+            auto & pool = cursor.second;
+            if (pool.resolver != nullptr) {
+                // The resolver is deleted by its callback.
+                pool.resolver->impl = nullptr;
+                pool.resolver = nullptr;
+            }
+            calls.insert(calls.end(), pool.waiting.begin(), pool.waiting.end());
+            for (auto & conn : pool.connections) {
+                conn->detached = true;
+                calls.insert(calls.end(), conn->calls.begin(), conn->calls.end());
+                conn->calls.clear();
+                if (!conn->isClosing()) {
+                    conn->close();
+                }
+            }
+        }
+        pools.clear();
+
+        if (timer) {
+            timer->impl = nullptr;
+            if (!timer->isClosing()) {
+                timer->close();
+            }
+            timer.reset();
+        }
+        if (async) {
+            if (!async->isClosing()) {
+                async->close();
+            }
+            async.reset();
+        }
+
+        for (auto & call : calls) {
+            finish(call, E_CLOSED);
+        }
+    }
+
+    std::size_t getConnectionCount() const
+    {
+        std::size_t result = 0;
+        for (auto & cursor : pools) {
+            result += cursor.second.connections.size();
+        }
+        return result;
+    }
+
+    std::size_t getIdleConnectionCount() const
+    {
+        std::size_t result = 0;
+        for (auto & cursor : pools) {
+            for (auto & conn : cursor.second.connections) {
+                if (conn->calls.empty()) {
+                    ++result;
+                }
+            }
+        }
+        return result;
+    }
+
+    std::size_t getWaitingCount() const
+    {
+        std::size_t result = 0;
+        for (auto & cursor : pools) {
+            result += cursor.second.waiting.size();
+        }
+        return result;
+    }
+};
+
+// ----------------------------
+// UvHttpClient implementation.
+// ----------------------------
+
+UvHttpClient::UvHttpClient(Loop & loop) : UvHttpClient(loop, Options())
+{
+    // EMPTY.
+}
+
+UvHttpClient::UvHttpClient(Loop & loop, Options const & options)
+        : _impl(std::make_unique<Impl>(loop, options))
+{
+    assert(static_cast<bool>(_impl));
+}
+
+UvHttpClient::~UvHttpClient()
+{
+    _impl.reset();
+}
+
+Err UvHttpClient::request(Request const & request)
+{
+    assert(static_cast<bool>(_impl));
+    if (request.host.empty() || request.method.empty()) {
+        return E_ILLARGS;
+    }
+    auto call = std::make_shared<Impl::Call>();
+    if (!call) {
+        return E_BADALLOC;
+    }
+    call->request = request;
+    return _impl->post(call);
+}
+
+Err UvHttpClient::request(std::string const & method, std::string const & url,
+                          OnResponse const & cb, char const * body, std::size_t size)
+{
+    libtbag::net::Uri uri;
+    if (!uri.parse(url) || !uri.isHost()) {
+        return E_ILLARGS;
+    }
+
+    Request request;
+    auto const SCHEMA = libtbag::string::lower(uri.getSchema());
+    if (SCHEMA == HTTPS_SCHEMA_LOWER) {
+        request.tls = true;
+    } else if (SCHEMA != HTTP_SCHEMA_LOWER) {
+        return E_ILLARGS;
+    }
+
+    request.method = method;
+    request.host = uri.getHost();
+    if (uri.isPort()) {
+        request.port = uri.getPortNumber();
+    } else {
+        request.port = request.tls ? DEFAULT_HTTPS_PORT : DEFAULT_HTTP_PORT;
+    }
+
+    request.path = uri.getPath();
+    if (request.path.empty()) {
+        request.path = ROOT_PATH;
+    }
+    if (uri.isQuery()) {
+        request.path += '?';
+        request.path += uri.getQuery();
+    }
+
+    if (body != nullptr && size > 0) {
+        request.body.assign(body, body + size);
+    }
+    request.response_cb = cb;
+    return this->request(request);
+}
+
+Err UvHttpClient::get(std::string const & url, OnResponse const & cb)
+{
+    return request(getHttpMethodName(HttpMethod::M_GET), url, cb);
+}
+
+Err UvHttpClient::post(std::string const & url, std::string const & body, OnResponse const & cb)
+{
+    return request(getHttpMethodName(HttpMethod::M_POST), url, cb, body.data(), body.size());
+}
+
+void UvHttpClient::close()
+{
+    assert(static_cast<bool>(_impl));
+    _impl->close();
+}
+
+std::size_t UvHttpClient::getConnectionCount() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->getConnectionCount();
+}
+
+std::size_t UvHttpClient::getIdleConnectionCount() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->getIdleConnectionCount();
+}
+
+std::size_t UvHttpClient::getWaitingCount() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->getWaitingCount();
+}
+
+std::size_t UvHttpClient::getConnectCount() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->connect_count;
+}
+
+std::size_t UvHttpClient::getResolveCount() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->resolve_count;
+}
+
+std::size_t UvHttpClient::getMaxInFlight() const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->max_in_flight;
+}
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
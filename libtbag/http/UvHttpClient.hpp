@@ -0,0 +1,203 @@
+/**
+ * @file   UvHttpClient.hpp
+ * @brief  UvHttpClient class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Resolve the host names asynchronously)
+ * @date   2026-10-19 (Verify the certificate & host name of the HTTPS server)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_HTTP_UVHTTPCLIENT_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_HTTP_UVHTTPCLIENT_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/http/HttpCommon.hpp>
+#include <libtbag/uvpp/Loop.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+/**
+ * Connection-pooling HTTP/1.1 client on the uvpp::Loop.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Unlike the HttpClient (CivetWeb), one instance serves any number of requests: @n
+ *  - Connections are pooled by the host:port:tls key and reused while the server keeps them alive.
+ *  - The number of connections per host is bounded. The surplus requests wait in the pool.
+ *  - If max_pipeline_depth is greater than 1, idempotent requests (GET, HEAD) @n
+ *    are pipelined on the connections which already served a keep-alive response.
+ *  - The response body can be streamed by the body callback instead of being accumulated.
+ *  - An idempotent request which was not answered by a reused connection is retried once @n
+ *    on another connection. (The server may close the idle connection at any time)
+ *  - The host name is resolved by uv_getaddrinfo() in the thread pool. @n
+ *    The requests wait in the pool until it is resolved, @n
+ *    and it is resolved again after the dns_ttl or a connect failure.
+ *  - The certificate and the host name of the HTTPS server are verified, @n
+ *    and the host name is sent as the SNI. If the verification fails, the request fails with E_SSL.
+ *
+ *  The idle connections don't keep the loop alive, @n
+ *  so Loop::run() returns when all requests are completed.
+ *
+ * @warning
+ *  All callbacks are called in the loop thread. @n
+ *  request() can be called from another thread, but then the loop must be kept alive by other handles.
+ */
+class TBAG_API UvHttpClient : private Noncopyable
+{
+public:
+    struct Impl;
+    friend struct Impl;
+
+public:
+    using Loop = libtbag::uvpp::Loop;
+    using Buffer = libtbag::util::Buffer;
+
+public:
+    /** Status line and headers are received. (The body is empty) */
+    using OnHeaders  = std::function<void(HttpResponse const&)>;
+    using OnBody     = std::function<void(char const*, std::size_t)>;
+    using OnResponse = std::function<void(Err, HttpResponse&)>;
+
+    struct Request
+    {
+        std::string method = "GET";
+        std::string host;
+        int port = DEFAULT_HTTP_PORT;
+        bool tls = false;
+        std::string path = ROOT_PATH;
+
+        HttpHeaders header;
+        Buffer body;
+
+        /** If 0, Options::timeout is used. */
+        uint64_t timeout = 0;
+
+        OnHeaders  headers_cb;
+
+        /** If exists, the body is not accumulated in the response. */
+        OnBody     body_cb;
+
+        OnResponse response_cb;
+    };
+
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_MAX_CONNECTIONS_PER_HOST = 6;
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_MAX_RESPONSE_SIZE = 64 * 1024 * 1024;
+    TBAG_CONSTEXPR static uint64_t const DEFAULT_IDLE_TIMEOUT_MILLISEC = 30 * 1000;
+    TBAG_CONSTEXPR static uint64_t const DEFAULT_DNS_TTL_MILLISEC = 60 * 1000;
+    TBAG_CONSTEXPR static uint64_t const TIMER_INTERVAL_MILLISEC = 50;
+
+    struct Options
+    {
+        std::size_t max_connections_per_host = DEFAULT_MAX_CONNECTIONS_PER_HOST;
+
+        /** The surplus idle connections are closed. */
+        std::size_t max_idle_connections_per_host = DEFAULT_MAX_CONNECTIONS_PER_HOST;
+
+        /** Maximum number of the requests in flight on a connection. (1 is no pipelining) */
+        std::size_t max_pipeline_depth = 1;
+
+        /** The body is not accumulated beyond this size. (The request fails with E_DATA_TOO_LARGE) */
+        std::size_t max_response_size = DEFAULT_MAX_RESPONSE_SIZE;
+
+        /** Response timeout of a request, including the time spent waiting in the pool. */
+        uint64_t timeout = DEFAULT_HTTP_TIMEOUT_MILLISEC;
+
+        /** The idle connections are closed after this time. */
+        uint64_t idle_timeout = DEFAULT_IDLE_TIMEOUT_MILLISEC;
+
+        /** The resolved address is used for the new connections during this time. (If 0, forever) */
+        uint64_t dns_ttl = DEFAULT_DNS_TTL_MILLISEC;
+
+        bool tcp_nodelay = true;
+
+        /** PEM file of the trusted certificates, in addition to the CA bundle of the system. */
+        std::string tls_ca_file;
+
+        std::string user_agent = DEFAULT_VALUE_OF_USER_AGENT;
+    };
+
+public:
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+private:
+    UniqueImpl _impl;
+
+public:
+    UvHttpClient(Loop & loop);
+    UvHttpClient(Loop & loop, Options const & options);
+    virtual ~UvHttpClient();
+
+public:
+    /**
+     * Queue the request.
+     *
+     * @remarks
+     *  The response callback is always called once, with E_SUCCESS or the failure reason. @n
+     *  A non-2xx status code is not a failure.
+     */
+    Err request(Request const & request);
+
+    /** Request the absolute URL. (http or https) */
+    Err request(std::string const & method, std::string const & url,
+                OnResponse const & cb, char const * body = nullptr, std::size_t size = 0);
+
+    Err get(std::string const & url, OnResponse const & cb);
+    Err post(std::string const & url, std::string const & body, OnResponse const & cb);
+
+public:
+    /**
+     * Fail the pending requests with E_CLOSED and close all connections.
+     *
+     * @warning
+     *  Call it in the loop thread or while the loop is not running.
+     */
+    void close();
+
+public:
+    /** Number of the open (or connecting) connections of all hosts. */
+    std::size_t getConnectionCount() const;
+
+    /** Number of the connections without requests in flight. */
+    std::size_t getIdleConnectionCount() const;
+
+    /** Number of the requests waiting for a connection. */
+    std::size_t getWaitingCount() const;
+
+    /** Total number of the connections ever opened. */
+    std::size_t getConnectCount() const;
+
+    /** Total number of the host names ever resolved. (The IP addresses are not counted) */
+    std::size_t getResolveCount() const;
+
+    /** The largest number of requests in flight on a single connection. */
+    std::size_t getMaxInFlight() const;
+};
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_HTTP_UVHTTPCLIENT_HPP__
+
@@ -0,0 +1,1144 @@
+/**
+ * @file   UvHttpServer.cpp
+ * @brief  UvHttpServer class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Send the files in the thread pool)
+ */
+
+#include <libtbag/http/UvHttpServer.hpp>
+#include <libtbag/bitwise/BitFlags.hpp>
+#include <libtbag/filesystem/details/FsCommon.hpp>
+#include <libtbag/uvpp/Loop.hpp>
+#include <libtbag/uvpp/Poll.hpp>
+#include <libtbag/uvpp/ex/SafetyAsync.hpp>
+#include <libtbag/log/Log.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <uv.h>
+
+#if !defined(TBAG_PLATFORM_WINDOWS)
+# include <unistd.h>
+#endif
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+/**
+ * UvHttpServer::Impl structure.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct UvHttpServer::Impl : private Noncopyable
+{
+    using SafetyAsync = libtbag::uvpp::ex::SafetyAsync;
+
+    struct Listener : public Tcp
+    {
+        Impl * impl;
+
+        Listener(Loop & loop, Impl * i) : Tcp(loop), impl(i)
+        { /* EMPTY. */ }
+
+        virtual void onConnection(Err code) override
+        {
+            if (isFailure(code)) {
+                tDLogE("UvHttpServer::Impl::Listener::onConnection() Connection {} error", code);
+                return;
+            }
+
+            auto session = getLoop()->newHandle<Session>(*getLoop(), impl);
+            if (!session) {
+                tDLogE("UvHttpServer::Impl::Listener::onConnection() Bad allocation");
+                return;
+            }
+
+            auto const ACCEPT_CODE = accept(*session);
+            if (isFailure(ACCEPT_CODE)) {
+                tDLogE("UvHttpServer::Impl::Listener::onConnection() Accept {} error", ACCEPT_CODE);
+                session->close();
+                return;
+            }
+            if (impl->options.tcp_nodelay) {
+                session->setNodelay(true);
+            }
+
+            auto const READ_CODE = session->startRead();
+            if (isFailure(READ_CODE)) {
+                tDLogE("UvHttpServer::Impl::Listener::onConnection() Start read {} error", READ_CODE);
+                session->close();
+            }
+        }
+    };
+
+    Options options;
+    RequestMap requests;
+
+    /** All sessions are read in the loop thread, so the read buffer is shared. */
+    std::vector<char> read_buffer;
+
+    /** Reused lookup key of the request map. */
+    std::string path;
+
+    std::atomic_size_t sessions;
+
+    Loop loop;
+    std::shared_ptr<Listener> listener;
+    std::shared_ptr<SafetyAsync> async;
+    std::thread thread;
+    int port = 0;
+
+    Impl(Options const & o, RequestMap const & r) : options(o), requests(r), sessions(0)
+    { /* EMPTY. */ }
+
+    ~Impl()
+    { /* EMPTY. */ }
+
+    void closeAndRun()
+    {
+        if (loop.closeAllHandles() > 0) {
+            loop.run();
+        }
+    }
+
+    Err open()
+    {
+        listener = loop.newHandle<Listener>(loop, this);
+        if (!listener) {
+            return E_BADALLOC;
+        }
+
+        auto const CODE = libtbag::uvpp::initCommonServer(*listener, options.bind, options.port);
+        if (isFailure(CODE)) {
+            tDLogE("UvHttpServer::Impl::open() Server {}:{} initialize {} error",
+                   options.bind, options.port, CODE);
+            closeAndRun();
+            return CODE;
+        }
+        port = listener->getSockPort();
+
+        async = loop.newHandle<SafetyAsync>(loop);
+        if (!async) {
+            closeAndRun();
+            return E_BADALLOC;
+        }
+
+        thread = std::thread([this](){
+            auto const RUN_CODE = loop.run();
+            if (isFailure(RUN_CODE)) {
+                tDLogE("UvHttpServer::Impl::open() Loop {} error", RUN_CODE);
+            }
+        });
+        return E_SUCCESS;
+    }
+
+    void close()
+    {
+        if (async) {
+            async->sendFunc([this](){
+                loop.closeAllHandles();
+            });
+        }
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+};
+
+static unsigned getMethodFlag(HttpMethod method) TBAG_NOEXCEPT
+{
+    // clang-format off
+    switch (method) {
+    case HttpMethod::M_GET:     return UvHttpServer::METHOD_FLAG_GET;
+    case HttpMethod::M_POST:    return UvHttpServer::METHOD_FLAG_POST;
+    case HttpMethod::M_HEAD:    return UvHttpServer::METHOD_FLAG_HEAD;
+    case HttpMethod::M_PUT:     return UvHttpServer::METHOD_FLAG_PUT;
+    case HttpMethod::M_DELETE:  return UvHttpServer::METHOD_FLAG_DELETE;
+    case HttpMethod::M_OPTIONS: return UvHttpServer::METHOD_FLAG_OPTIONS;
+    case HttpMethod::M_PATCH:   return UvHttpServer::METHOD_FLAG_PATCH;
+    default:                    return 0;
+    }
+    // clang-format on
+}
+
+static char const * getContentType(std::string const & path) TBAG_NOEXCEPT
+{
+    struct ContentType { char const * extension; char const * type; };
+    static ContentType const CONTENT_TYPES[] = {
+            {".html", "text/html; charset=utf-8"},
+            {".htm" , "text/html; charset=utf-8"},
+            {".css" , "text/css; charset=utf-8"},
+            {".js"  , "application/javascript"},
+            {".json", "application/json"},
+            {".xml" , "application/xml"},
+            {".txt" , "text/plain; charset=utf-8"},
+            {".png" , "image/png"},
+            {".jpg" , "image/jpeg"},
+            {".jpeg", "image/jpeg"},
+            {".gif" , "image/gif"},
+            {".svg" , "image/svg+xml"},
+            {".ico" , "image/x-icon"},
+            {".wasm", "application/wasm"},
+    };
+
+    auto const DOT = path.find_last_of('.');
+    if (DOT != std::string::npos) {
+        auto const * extension = path.c_str() + DOT;
+        for (auto const & cursor : CONTENT_TYPES) {
+            if (strcmp(cursor.extension, extension) == 0) {
+                return cursor.type;
+            }
+        }
+    }
+    return "application/octet-stream";
+}
+
+static inline void append(UvHttpServer::Buffer & buffer, char const * data, std::size_t size)
+{
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+static inline void append(UvHttpServer::Buffer & buffer, char const * text)
+{
+    append(buffer, text, strlen(text));
+}
+
+static inline void append(UvHttpServer::Buffer & buffer, std::string const & text)
+{
+    append(buffer, text.data(), text.size());
+}
+
+static inline void appendNumber(UvHttpServer::Buffer & buffer, char const * format, unsigned long long value)
+{
+    char temp[32];
+    auto const SIZE = snprintf(temp, sizeof(temp), format, value);
+    if (SIZE > 0) {
+        append(buffer, temp, static_cast<std::size_t>(SIZE));
+    }
+}
+
+static inline void appendHeader(UvHttpServer::Buffer & buffer, char const * name, std::string const & value)
+{
+    append(buffer, name);
+    append(buffer, ": ", 2);
+    append(buffer, value);
+    append(buffer, "\r\n", 2);
+}
+
+/**
+ * The uv_fs_sendfile() or uv_fs_read() of the session in the thread pool.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct UvHttpServer::Session::FileRequest : private libtbag::Noncopyable
+{
+    uv_fs_t req;
+    uv_buf_t buf;
+    bool sendfile = false;
+
+    Session * session;
+
+    /** The session is not destroyed until the callback is called. */
+    std::shared_ptr<libtbag::uvpp::Handle> owner;
+
+    FileRequest(Session * s) : session(s)
+    {
+        memset(&req, 0, sizeof(req));
+        req.data = this;
+    }
+
+    static void onCallback(uv_fs_t * req)
+    {
+        auto * file_req = static_cast<FileRequest*>(req->data);
+        auto const RESULT = static_cast<int64_t>(req->result);
+        ::uv_fs_req_cleanup(req);
+
+        auto owner = std::move(file_req->owner);
+        file_req->session->onFile(RESULT);
+    }
+};
+
+/**
+ * Wait until the socket of the session is writable.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The poll handle of the same descriptor would replace the watcher of the Tcp handle, @n
+ *  so the duplicated descriptor of the socket is polled.
+ */
+struct UvHttpServer::Session::WritablePoll : public libtbag::uvpp::Poll
+{
+    Session * session;
+    int fd;
+
+    WritablePoll(Loop & loop, int f, Session * s) : Poll(loop, init_file(f)), session(s), fd(f)
+    { /* EMPTY. */ }
+
+    virtual void onPoll(Err status, EventType events) override
+    {
+        stop();
+        if (session != nullptr) {
+            session->onWritable(status);
+        }
+    }
+
+    virtual void onClose() override
+    {
+#if !defined(TBAG_PLATFORM_WINDOWS)
+        ::close(fd);
+#endif
+    }
+};
+
+// -------------------------------------
+// UvHttpServer::Session implementation.
+// -------------------------------------
+
+UvHttpServer::Session::Session(Loop & loop, Impl * server)
+        : Tcp(loop), _server(server), _ws_handler(nullptr),
+          _writing(false), _reading(false),
+          _use_sendfile(server->options.use_sendfile), _sending(false), _waiting(false),
+          _method(HttpMethod::M_UNKNOWN), _keep_alive(true), _close_after_flush(false), _chunked(false)
+{
+    assert(_server != nullptr);
+    ++(_server->sessions);
+}
+
+UvHttpServer::Session::~Session()
+{
+    closeOutputs();
+    --(_server->sessions);
+}
+
+UvHttpServer::Buffer & UvHttpServer::Session::appendOutput()
+{
+    // The buffer of the write request in progress must not be modified.
+    if (_outputs.empty() || _outputs.back().isFile() || (_writing && _outputs.size() == 1u)) {
+        _outputs.emplace_back();
+        _outputs.back().buffer.swap(_spare);
+    }
+    return _outputs.back().buffer;
+}
+
+void UvHttpServer::Session::recycle(Output & output)
+{
+    if (output.isFile()) {
+        libtbag::filesystem::details::close(output.file);
+        output.file = -1;
+    } else if (_spare.capacity() < output.buffer.capacity()) {
+        output.buffer.clear();
+        _spare.swap(output.buffer);
+    }
+}
+
+Err UvHttpServer::Session::submitFile(Output & output)
+{
+    if (!_file_req) {
+        try {
+            _file_req.reset(new FileRequest(this));
+        } catch (...) {
+            return E_BADALLOC;
+        }
+    }
+
+    auto owner = getLoop()->findChildHandle(*this).lock();
+    if (!owner) {
+        return E_EXPIRED;
+    }
+
+    auto * native_loop = getLoop()->cast<uv_loop_t>();
+    auto & req = _file_req->req;
+    int code = UV_ENOSYS;
+
+#if !defined(TBAG_PLATFORM_WINDOWS)
+    // The emulation of uv_fs_sendfile() on the Windows does not support the socket handle.
+    uv_os_fd_t fd;
+    if (_use_sendfile && uv_fileno(static_cast<uv_handle_t const *>(get()), &fd) == 0) {
+        // The socket is non-blocking, so it is written as much as possible without waiting.
+        _file_req->sendfile = true;
+        code = ::uv_fs_sendfile(native_loop, &req, fd, output.file, output.offset,
+                                static_cast<std::size_t>(output.remain), &FileRequest::onCallback);
+    }
+#endif
+
+    if (code != 0) {
+        auto const CHUNK_SIZE = static_cast<std::size_t>(
+                std::min<uint64_t>(output.remain, _server->options.file_chunk_size));
+        _file_buffer.resize(CHUNK_SIZE);
+        _file_req->buf = uv_buf_init(_file_buffer.data(), static_cast<unsigned>(CHUNK_SIZE));
+        _file_req->sendfile = false;
+        code = ::uv_fs_read(native_loop, &req, output.file, &_file_req->buf, 1,
+                            output.offset, &FileRequest::onCallback);
+    }
+
+    if (code != 0) {
+        ::uv_fs_req_cleanup(&req);
+        return convertUvErrorToErr(code);
+    }
+    _file_req->owner = std::move(owner);
+    _sending = true;
+    return E_SUCCESS;
+}
+
+bool UvHttpServer::Session::waitWritable()
+{
+#if defined(TBAG_PLATFORM_WINDOWS)
+    return false;
+#else
+    if (!_poll) {
+        uv_os_fd_t fd;
+        if (uv_fileno(static_cast<uv_handle_t const *>(get()), &fd) != 0) {
+            return false;
+        }
+        auto const DUPLICATED = ::dup(fd);
+        if (DUPLICATED < 0) {
+            return false;
+        }
+        try {
+            _poll = getLoop()->newHandle<WritablePoll>(*getLoop(), DUPLICATED, this);
+        } catch (...) {
+            ::close(DUPLICATED);
+            return false;
+        }
+        if (!_poll) {
+            return false;
+        }
+    }
+    if (isFailure(_poll->start(libtbag::uvpp::Poll::EVENT_WRITABLE))) {
+        return false;
+    }
+    _waiting = true;
+    return true;
+#endif
+}
+
+void UvHttpServer::Session::onFile(int64_t result)
+{
+    _sending = false;
+    if (!isInit() || isClosing()) {
+        closeOutputs();
+        return;
+    }
+
+    assert(!_outputs.empty() && _outputs.front().isFile());
+    auto & output = _outputs.front();
+
+    if (_file_req->sendfile) {
+        if (result == UV_EAGAIN) {
+            // The socket buffer is full.
+            if (waitWritable()) {
+                return;
+            }
+            _use_sendfile = false;
+        } else if (result > 0) {
+            output.offset += result;
+            output.remain -= static_cast<uint64_t>(result);
+        } else if (result == 0) {
+            tDLogE("UvHttpServer::Session::onFile() Unexpected end of file");
+            close();
+            return;
+        } else {
+            // The sendfile is not available, so the file is read and written.
+            tDLogW("UvHttpServer::Session::onFile() Sendfile {} error",
+                   convertUvErrorToErr(static_cast<int>(result)));
+            _use_sendfile = false;
+        }
+        flush();
+        return;
+    }
+
+    if (result <= 0) {
+        tDLogE("UvHttpServer::Session::onFile() Read file error ({})", result);
+        close();
+        return;
+    }
+    output.offset += result;
+    output.remain -= static_cast<uint64_t>(result);
+
+    auto const CODE = write(_write_req, _file_buffer.data(), static_cast<std::size_t>(result));
+    if (isFailure(CODE)) {
+        tDLogE("UvHttpServer::Session::onFile() Write {} error", CODE);
+        close();
+        return;
+    }
+    _writing = true;
+}
+
+void UvHttpServer::Session::onWritable(Err code)
+{
+    _waiting = false;
+    if (isFailure(code)) {
+        tDLogE("UvHttpServer::Session::onWritable() Poll {} error", code);
+        close();
+        return;
+    }
+    flush();
+}
+
+void UvHttpServer::Session::closePoll()
+{
+    if (_poll) {
+        _poll->session = nullptr;
+        if (!_poll->isClosing()) {
+            _poll->close();
+        }
+        _poll.reset();
+    }
+    _waiting = false;
+}
+
+void UvHttpServer::Session::flush()
+{
+    if (_writing || _sending || _waiting || !isInit() || isClosing()) {
+        return;
+    }
+
+    while (!_outputs.empty()) {
+        auto & output = _outputs.front();
+
+        if (!output.isFile()) {
+            if (output.buffer.empty()) {
+                recycle(output);
+                _outputs.pop_front();
+                continue;
+            }
+            auto const CODE = write(_write_req, output.buffer.data(), output.buffer.size());
+            if (isFailure(CODE)) {
+                tDLogE("UvHttpServer::Session::flush() Write {} error", CODE);
+                close();
+                return;
+            }
+            _writing = true;
+            return;
+        }
+
+        if (output.remain == 0) {
+            recycle(output);
+            _outputs.pop_front();
+            continue;
+        }
+
+        auto const CODE = submitFile(output);
+        if (isFailure(CODE)) {
+            tDLogE("UvHttpServer::Session::flush() File request {} error", CODE);
+            close();
+        }
+        return;
+    }
+
+    if (_close_after_flush) {
+        close();
+    }
+}
+
+void UvHttpServer::Session::requestFlush()
+{
+    // The outputs of the pipelined requests are written at once after the read callback.
+    if (!_reading) {
+        flush();
+    }
+}
+
+void UvHttpServer::Session::closeOutputs()
+{
+    // The file of the request in the thread pool is closed after the callback.
+    std::size_t const KEEP = (_sending && !_outputs.empty()) ? 1u : 0u;
+    for (auto i = KEEP; i < _outputs.size(); ++i) {
+        if (_outputs[i].isFile()) {
+            libtbag::filesystem::details::close(_outputs[i].file);
+            _outputs[i].file = -1;
+        }
+    }
+    _outputs.resize(KEEP);
+}
+
+void UvHttpServer::Session::appendStatusLine(Buffer & buffer, int code)
+{
+    append(buffer, "HTTP/1.1 ", 9);
+    appendNumber(buffer, "%llu", static_cast<unsigned long long>(code));
+    append(buffer, " ", 1);
+    append(buffer, getHttpStatusReason(getHttpStatus(code)));
+    append(buffer, "\r\n", 2);
+}
+
+void UvHttpServer::Session::appendCommonHeaders(Buffer & buffer)
+{
+    if (!_server->options.server_name.empty()) {
+        appendHeader(buffer, HEADER_SERVER, _server->options.server_name);
+    }
+    if (_keep_alive) {
+        append(buffer, "Connection: keep-alive\r\n");
+    } else {
+        append(buffer, "Connection: close\r\n");
+    }
+}
+
+void UvHttpServer::Session::onRequest()
+{
+    _method = _parser.getMethod();
+    _keep_alive = _parser.shouldKeepAlive();
+    _chunked = false;
+
+    auto const URL = _parser.getUrl();
+    auto const * path_end = std::find_if(URL.buffer, URL.buffer + URL.size, [](char c){
+        return c == '?' || c == '#';
+    });
+    auto & path = _server->path;
+    path.assign(URL.buffer, path_end);
+
+    auto const ITR = _server->requests.find(path);
+    if (ITR == _server->requests.end()) {
+        auto const & root = _server->options.document_root;
+        if (root.empty() || (_method != HttpMethod::M_GET && _method != HttpMethod::M_HEAD)) {
+            writeResponse(404, std::string());
+            return;
+        }
+        if (path.empty() || path[0] != '/' || path.find("..") != std::string::npos) {
+            writeResponse(400, std::string());
+            return;
+        }
+
+        std::string file_path = root + path;
+        if (file_path.back() == '/') {
+            file_path += "index.html";
+        }
+        if (isFailure(writeFile(file_path, getContentType(file_path)))) {
+            writeResponse(404, std::string());
+        }
+        return;
+    }
+
+    auto const & handler = ITR->second;
+    if (_parser.isUpgrade()) {
+        if (handler.ws_message_cb) {
+            if (!onUpgrade(handler)) {
+                onRequestError(400);
+            }
+            return;
+        }
+        // The upgrade is not supported, so the remaining bytes are not HTTP.
+        _keep_alive = false;
+    }
+
+    if (!handler.request_cb || !TBAG_CHECK_BIT_FLAG(handler.method_flags, getMethodFlag(_method))) {
+        writeResponse(405, std::string());
+        return;
+    }
+    handler.request_cb(*this, _parser);
+}
+
+bool UvHttpServer::Session::onUpgrade(Handler const & handler)
+{
+    if (!_parser.equalsHeaderValue(KnownHeader::KH_UPGRADE, "websocket")) {
+        return false;
+    }
+    if (!_parser.equalsHeaderValue(KnownHeader::KH_SEC_WEBSOCKET_VERSION, "13")) {
+        return false;
+    }
+    auto const KEY = _parser.getHeaderView(KnownHeader::KH_SEC_WEBSOCKET_KEY);
+    if (KEY.size == 0) {
+        return false;
+    }
+
+    auto const & options = _server->options;
+    WsDeflateParams deflate_params;
+    bool deflate = false;
+    if (options.ws_deflate && _parser.existsHeader(KnownHeader::KH_SEC_WEBSOCKET_EXTENSIONS)) {
+        auto const EXTENSIONS = _parser.getHeader(KnownHeader::KH_SEC_WEBSOCKET_EXTENSIONS);
+        if (negotiateWsDeflate(EXTENSIONS, options.ws_deflate_params, deflate_params)) {
+            auto const CODE = _deflate.init(deflate_params, true, options.ws_deflate_level);
+            if (isSuccess(CODE)) {
+                _ws.setDeflate(&_deflate, options.max_request_size);
+                deflate = true;
+            } else {
+                tDLogW("UvHttpServer::Session::onUpgrade() Deflate init error: {}", CODE);
+            }
+        }
+    }
+
+    auto & buffer = appendOutput();
+    appendStatusLine(buffer, 101);
+    append(buffer, "Upgrade: websocket\r\nConnection: Upgrade\r\n");
+    appendHeader(buffer, HEADER_SEC_WEBSOCKET_ACCEPT,
+                 getUpgradeWebSocketKey(std::string(KEY.buffer, KEY.buffer + KEY.size)));
+    if (deflate) {
+        appendHeader(buffer, HEADER_SEC_WEBSOCKET_EXTENSIONS, toWsDeflateResponse(deflate_params));
+    }
+    if (!_server->options.server_name.empty()) {
+        appendHeader(buffer, HEADER_SERVER, _server->options.server_name);
+    }
+    append(buffer, "\r\n", 2);
+
+    _ws_handler = &handler;
+    if (handler.ws_open_cb) {
+        handler.ws_open_cb(*this);
+    }
+    return true;
+}
+
+void UvHttpServer::Session::onWsRead(char const * buffer, std::size_t size)
+{
+    assert(_ws_handler != nullptr);
+    _ws.push(buffer, size);
+
+    while (!_close_after_flush && !isClosing()) {
+        Err code = E_UNKNOWN;
+        if (!_ws.next(&code)) {
+            if (code == E_CONTINUE) {
+                continue; // Non-final fragment.
+            }
+            if (code != E_SMALLBUF) {
+                tDLogE("UvHttpServer::Session::onWsRead() Frame {} error", code);
+                close();
+            }
+            return;
+        }
+
+        auto const OPCODE = _ws.getOpCode();
+        auto const & payload = _ws.atPayload();
+        switch (OPCODE) {
+        case WsOpCode::WSOC_DENOTES_PING:
+            writeWs(WsOpCode::WSOC_DENOTES_PONG, payload.data(), payload.size());
+            break;
+        case WsOpCode::WSOC_DENOTES_PONG:
+            break;
+        case WsOpCode::WSOC_CONNECTION_CLOSE:
+            // Echo the status code & reason.
+            writeWs(WsOpCode::WSOC_CONNECTION_CLOSE, payload.data(), payload.size());
+            closeAfterFlush();
+            break;
+        default:
+            if (_ws_handler->ws_message_cb) {
+                _ws_handler->ws_message_cb(*this, OPCODE, payload.data(), payload.size());
+            }
+            break;
+        }
+    }
+}
+
+void UvHttpServer::Session::onRequestError(int code)
+{
+    _keep_alive = false;
+    writeResponse(code, std::string());
+}
+
+UvHttpServer::binf UvHttpServer::Session::onAlloc(std::size_t suggested_size)
+{
+    return libtbag::uvpp::defaultOnAlloc(_server->read_buffer, suggested_size);
+}
+
+void UvHttpServer::Session::onRead(Err code, char const * buffer, std::size_t size)
+{
+    if (isFailure(code)) {
+        if (code != E_EOF) {
+            tDLogE("UvHttpServer::Session::onRead() Read {} error", code);
+        }
+        close();
+        return;
+    }
+    if (_close_after_flush || size == 0) {
+        return;
+    }
+
+    _reading = true;
+    if (isWebSocket()) {
+        onWsRead(buffer, size);
+    } else {
+        auto result = _parser.execute(buffer, size);
+        while (!_close_after_flush && !isClosing()) {
+            if (result == E_SUCCESS) {
+                onRequest();
+                if (isWebSocket()) {
+                    // The remaining bytes are the WebSocket frames.
+                    auto const REMAINING = _parser.getRemaining();
+                    if (REMAINING.size > 0) {
+                        onWsRead(REMAINING.buffer, REMAINING.size);
+                    }
+                    _parser.clear();
+                    break;
+                }
+                result = _parser.next();
+            } else if (result == E_CONTINUE) {
+                auto const PENDING_SIZE = _parser.getMessage().size + _parser.getRemaining().size;
+                if (PENDING_SIZE > _server->options.max_request_size) {
+                    onRequestError(413);
+                }
+                break;
+            } else {
+                onRequestError(400);
+                break;
+            }
+        }
+    }
+    _reading = false;
+
+    flush();
+}
+
+void UvHttpServer::Session::onWrite(WriteRequest & request, Err code)
+{
+    _writing = false;
+    if (isFailure(code)) {
+        tDLogE("UvHttpServer::Session::onWrite() Write {} error", code);
+        close();
+        return;
+    }
+
+    assert(!_outputs.empty());
+    auto & output = _outputs.front();
+    if (!output.isFile()) {
+        recycle(output);
+        _outputs.pop_front();
+    }
+    flush();
+}
+
+void UvHttpServer::Session::onClose()
+{
+    closePoll();
+    closeOutputs();
+    if (_ws_handler != nullptr && _ws_handler->ws_close_cb) {
+        _ws_handler->ws_close_cb(*this);
+    }
+}
+
+Err UvHttpServer::Session::writeRaw(char const * data, std::size_t size)
+{
+    if (isClosing()) {
+        return E_CLOSING;
+    }
+    append(appendOutput(), data, size);
+    requestFlush();
+    return E_SUCCESS;
+}
+
+Err UvHttpServer::Session::writeResponse(int code, HttpHeaders const & headers, char const * body, std::size_t size)
+{
+    if (isClosing() || _close_after_flush) {
+        return E_CLOSING;
+    }
+
+    auto & buffer = appendOutput();
+    appendStatusLine(buffer, code);
+    for (auto const & header : headers) {
+        appendHeader(buffer, header.first.c_str(), header.second);
+    }
+    append(buffer, "Content-Length: ");
+    appendNumber(buffer, "%llu\r\n", static_cast<unsigned long long>(size));
+    appendCommonHeaders(buffer);
+    append(buffer, "\r\n", 2);
+    if (_method != HttpMethod::M_HEAD && size > 0) {
+        append(buffer, body, size);
+    }
+
+    if (!_keep_alive) {
+        _close_after_flush = true;
+    }
+    requestFlush();
+    return E_SUCCESS;
+}
+
+Err UvHttpServer::Session::writeResponse(int code, std::string const & content_type, std::string const & body)
+{
+    HttpHeaders headers;
+    headers.emplace(HEADER_CONTENT_TYPE, content_type);
+    return writeResponse(code, headers, body.data(), body.size());
+}
+
+Err UvHttpServer::Session::writeResponse(int code, std::string const & body)
+{
+    return writeResponse(code, HttpHeaders(), body.data(), body.size());
+}
+
+Err UvHttpServer::Session::writeChunkedHeader(int code, HttpHeaders const & headers)
+{
+    if (isClosing() || _close_after_flush) {
+        return E_CLOSING;
+    }
+    if (_chunked) {
+        return E_ILLSTATE;
+    }
+
+    auto & buffer = appendOutput();
+    appendStatusLine(buffer, code);
+    for (auto const & header : headers) {
+        appendHeader(buffer, header.first.c_str(), header.second);
+    }
+    append(buffer, "Transfer-Encoding: chunked\r\n");
+    appendCommonHeaders(buffer);
+    append(buffer, "\r\n", 2);
+
+    _chunked = true;
+    requestFlush();
+    return E_SUCCESS;
+}
+
+Err UvHttpServer::Session::writeChunk(char const * data, std::size_t size)
+{
+    if (size == 0) {
+        return writeLastChunk();
+    }
+    if (!_chunked) {
+        return E_ILLSTATE;
+    }
+    if (isClosing()) {
+        return E_CLOSING;
+    }
+    if (_method == HttpMethod::M_HEAD) {
+        return E_SUCCESS;
+    }
+
+    auto & buffer = appendOutput();
+    appendNumber(buffer, "%llx\r\n", static_cast<unsigned long long>(size));
+    append(buffer, data, size);
+    append(buffer, "\r\n", 2);
+    requestFlush();
+    return E_SUCCESS;
+}
+
+Err UvHttpServer::Session::writeLastChunk()
+{
+    if (!_chunked) {
+        return E_ILLSTATE;
+    }
+    if (isClosing()) {
+        return E_CLOSING;
+    }
+
+    _chunked = false;
+    if (_method != HttpMethod::M_HEAD) {
+        append(appendOutput(), "0\r\n\r\n", 5);
+    }
+    if (!_keep_alive) {
+        _close_after_flush = true;
+    }
+    requestFlush();
+    return E_SUCCESS;
+}
+
+Err UvHttpServer::Session::writeFile(std::string const & path, std::string const & content_type)
+{
+    namespace fs = libtbag::filesystem::details;
+
+    if (isClosing() || _close_after_flush) {
+        return E_CLOSING;
+    }
+
+    auto const FILE = fs::open(path, fs::FILE_OPEN_FLAG_READ_ONLY, 0);
+    if (FILE < 0) {
+        return E_NFOUND;
+    }
+
+    fs::FileState state;
+    if (!fs::getStateWithFile(FILE, &state) || (state.mode & fs::FILE_TYPE_S_IFMT) != fs::FILE_TYPE_S_IFREG) {
+        fs::close(FILE);
+        return E_NFOUND;
+    }
+
+    auto & buffer = appendOutput();
+    appendStatusLine(buffer, 200);
+    appendHeader(buffer, HEADER_CONTENT_TYPE, content_type);
+    append(buffer, "Content-Length: ");
+    appendNumber(buffer, "%llu\r\n", static_cast<unsigned long long>(state.size));
+    appendCommonHeaders(buffer);
+    append(buffer, "\r\n", 2);
+
+    if (_method == HttpMethod::M_HEAD || state.size == 0) {
+        fs::close(FILE);
+    } else {
+        _outputs.emplace_back();
+        _outputs.back().file = FILE;
+        _outputs.back().remain = state.size;
+    }
+
+    if (!_keep_alive) {
+        _close_after_flush = true;
+    }
+    requestFlush();
+    return E_SUCCESS;
+}
+
+Err UvHttpServer::Session::writeWs(WsOpCode opcode, char const * data, std::size_t size, bool fin)
+{
+    if (!isWebSocket()) {
+        return E_ILLSTATE;
+    }
+    if (isClosing()) {
+        return E_CLOSING;
+    }
+
+    auto const IS_MESSAGE = (opcode == WsOpCode::WSOC_TEXT_FRAME || opcode == WsOpCode::WSOC_BINARY_FRAME);
+    if (_deflate.exists() && fin && IS_MESSAGE) {
+        auto const CODE = _deflate.compress(data, size, _deflate_buffer);
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+        return writeWsFrame(opcode, _deflate_buffer.data(), _deflate_buffer.size(), true, true);
+    }
+    return writeWsFrame(opcode, data, size, fin, false);
+}
+
+Err UvHttpServer::Session::writeWsFrame(WsOpCode opcode, char const * data, std::size_t size, bool fin, bool rsv1)
+{
+    uint8_t header[10];
+    std::size_t header_size = 2;
+    header[0] = static_cast<uint8_t>((fin ? 0x80 : 0x00) | (rsv1 ? 0x40 : 0x00) |
+                                     (static_cast<uint8_t>(opcode) & 0x0F));
+    if (size < 126) {
+        header[1] = static_cast<uint8_t>(size);
+    } else if (size <= UINT16_MAX) {
+        header[1] = 126;
+        header[2] = static_cast<uint8_t>((size >> 8) & 0xFF);
+        header[3] = static_cast<uint8_t>((size     ) & 0xFF);
+        header_size = 4;
+    } else {
+        header[1] = 127;
+        auto const SIZE64 = static_cast<uint64_t>(size);
+        for (int i = 0; i < 8; ++i) {
+            header[2 + i] = static_cast<uint8_t>((SIZE64 >> (8 * (7 - i))) & 0xFF);
+        }
+        header_size = 10;
+    }
+
+    auto & buffer = appendOutput();
+    append(buffer, reinterpret_cast<char const *>(header), header_size);
+    if (size > 0) {
+        append(buffer, data, size);
+    }
+    requestFlush();
+    return E_SUCCESS;
+}
+
+Err UvHttpServer::Session::writeWsText(std::string const & text)
+{
+    return writeWs(WsOpCode::WSOC_TEXT_FRAME, text.data(), text.size());
+}
+
+Err UvHttpServer::Session::writeWsBinary(char const * data, std::size_t size)
+{
+    return writeWs(WsOpCode::WSOC_BINARY_FRAME, data, size);
+}
+
+Err UvHttpServer::Session::writeWsClose(uint16_t code, std::string const & reason)
+{
+    std::string payload;
+    payload.reserve(2 + reason.size());
+    payload.push_back(static_cast<char>((code >> 8) & 0xFF));
+    payload.push_back(static_cast<char>((code     ) & 0xFF));
+    payload.append(reason);
+
+    auto const CODE = writeWs(WsOpCode::WSOC_CONNECTION_CLOSE, payload.data(), payload.size());
+    if (isSuccess(CODE)) {
+        closeAfterFlush();
+    }
+    return CODE;
+}
+
+void UvHttpServer::Session::closeAfterFlush()
+{
+    _close_after_flush = true;
+    requestFlush();
+}
+
+// ----------------------------
+// UvHttpServer implementation.
+// ----------------------------
+
+UvHttpServer::UvHttpServer()
+{
+    // EMPTY.
+}
+
+UvHttpServer::~UvHttpServer()
+{
+    close();
+}
+
+bool UvHttpServer::req(RequestMap & r, std::string const & path, OnRequest const & cb, unsigned method_flags)
+{
+    Handler handler;
+    handler.method_flags = method_flags;
+    handler.request_cb = cb;
+    return r.emplace(path, std::move(handler)).second;
+}
+
+bool UvHttpServer::ws(RequestMap & r, std::string const & path,
+                      OnWsMessage const & message_cb,
+                      OnWsOpen const & open_cb,
+                      OnWsClose const & close_cb)
+{
+    if (!message_cb) {
+        return false;
+    }
+    Handler handler;
+    handler.method_flags = METHOD_FLAG_GET;
+    handler.ws_open_cb = open_cb;
+    handler.ws_message_cb = message_cb;
+    handler.ws_close_cb = close_cb;
+    return r.emplace(path, std::move(handler)).second;
+}
+
+Err UvHttpServer::open(Options const & options, RequestMap const & requests)
+{
+    if (_impl) {
+        return E_ALREADY;
+    }
+
+    UniqueImpl impl;
+    try {
+        impl.reset(new Impl(options, requests));
+    } catch (...) {
+        return E_BADALLOC;
+    }
+
+    auto const CODE = impl->open();
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    _impl = std::move(impl);
+    return E_SUCCESS;
+}
+
+void UvHttpServer::close()
+{
+    if (_impl) {
+        _impl->close();
+        _impl.reset();
+    }
+}
+
+bool UvHttpServer::isOpen() const
+{
+    return static_cast<bool>(_impl);
+}
+
+int UvHttpServer::getPort() const
+{
+    return _impl ? _impl->port : 0;
+}
+
+std::size_t UvHttpServer::getSessionCount() const
+{
+    return _impl ? _impl->sessions.load() : 0u;
+}
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,355 @@
+/**
+ * @file   UvHttpServer.hpp
+ * @brief  UvHttpServer class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Send the files in the thread pool)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_HTTP_UVHTTPSERVER_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_HTTP_UVHTTPSERVER_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/http/HttpCommon.hpp>
+#include <libtbag/http/HttpViewParser.hpp>
+#include <libtbag/http/WsFrameBuffer.hpp>
+#include <libtbag/uvpp/Tcp.hpp>
+#include <libtbag/uvpp/Request.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+/**
+ * Event-driven HTTP/1.1 server on the uvpp::Tcp.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Unlike the HttpServer (CivetWeb), all connections are served by a single loop thread. @n
+ *  - Keep-alive & pipelined requests are parsed by the HttpViewParser without copying strings.
+ *  - Responses are queued per connection and written in the order of the requests.
+ *  - Static files are written with sendfile(2) if the platform supports it. @n
+ *    The file I/O runs in the thread pool of the libuv, so it does not block the loop thread.
+ *  - WebSocket upgrade is handled in the same connection.
+ *
+ * @warning
+ *  All callbacks are called in the loop thread. @n
+ *  A handler must write the response before it returns, @n
+ *  otherwise the response of the next pipelined request may be written first.
+ */
+class TBAG_API UvHttpServer : private Noncopyable
+{
+public:
+    struct Impl;
+    class Session;
+
+public:
+    using Loop = libtbag::uvpp::Loop;
+    using Tcp = libtbag::uvpp::Tcp;
+    using WriteRequest = libtbag::uvpp::WriteRequest;
+    using Buffer = libtbag::util::Buffer;
+    using binf = libtbag::util::binf;
+    using ufile = libtbag::uvpp::ufile;
+
+public:
+    using OnRequest   = std::function<void(Session&, HttpViewParser const&)>;
+    using OnWsOpen    = std::function<void(Session&)>;
+    using OnWsMessage = std::function<void(Session&, WsOpCode, char const*, std::size_t)>;
+    using OnWsClose   = std::function<void(Session&)>;
+
+    struct Handler
+    {
+        unsigned method_flags = 0;
+
+        OnRequest   request_cb;
+        OnWsOpen    ws_open_cb;
+        OnWsMessage ws_message_cb;
+        OnWsClose   ws_close_cb;
+    };
+
+    using RequestMap = std::unordered_map<std::string, Handler>;
+
+public:
+    TBAG_CONSTEXPR static unsigned const METHOD_FLAG_GET     = 0x01;
+    TBAG_CONSTEXPR static unsigned const METHOD_FLAG_POST    = 0x02;
+    TBAG_CONSTEXPR static unsigned const METHOD_FLAG_HEAD    = 0x04;
+    TBAG_CONSTEXPR static unsigned const METHOD_FLAG_PUT     = 0x08;
+    TBAG_CONSTEXPR static unsigned const METHOD_FLAG_DELETE  = 0x10;
+    TBAG_CONSTEXPR static unsigned const METHOD_FLAG_OPTIONS = 0x20;
+    TBAG_CONSTEXPR static unsigned const METHOD_FLAG_PATCH   = 0x40;
+
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_MAX_REQUEST_SIZE = 8 * 1024 * 1024;
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_FILE_CHUNK_SIZE = 64 * 1024;
+
+    struct Options
+    {
+        std::string bind = "0.0.0.0";
+
+        /** If 0, the port is assigned by the OS. (See getPort()) */
+        int port = 0;
+
+        /** Serve the static files of this directory if no handler matches the path. */
+        std::string document_root;
+
+        /** The connection is closed if a single request exceeds this size. */
+        std::size_t max_request_size = DEFAULT_MAX_REQUEST_SIZE;
+
+        /** Read buffer size of the fallback path (if sendfile(2) can't be used). */
+        std::size_t file_chunk_size = DEFAULT_FILE_CHUNK_SIZE;
+
+        bool use_sendfile = true;
+        bool tcp_nodelay = true;
+
+        /** Accept the permessage-deflate extension (RFC 7692) if the client offers it. */
+        bool ws_deflate = false;
+
+        /** Server preferences of the permessage-deflate. (See negotiateWsDeflate()) */
+        WsDeflateParams ws_deflate_params;
+        int ws_deflate_level = WS_DEFLATE_DEFAULT_LEVEL;
+
+        std::string server_name = LIBTBAG_TITLE_STRING;
+    };
+
+    /**
+     * Connection of the UvHttpServer.
+     *
+     * @author zer0
+     * @date   2026-10-19
+     */
+    class TBAG_API Session : public Tcp
+    {
+    private:
+        /** Bytes or a segment of the file. */
+        struct Output
+        {
+            Buffer buffer;
+
+            ufile file = -1;
+            int64_t offset = 0;
+            uint64_t remain = 0;
+
+            inline bool isFile() const TBAG_NOEXCEPT
+            { return file >= 0; }
+        };
+
+        using Outputs = std::deque<Output>;
+
+        struct FileRequest;
+        struct WritablePoll;
+
+        friend struct FileRequest;
+        friend struct WritablePoll;
+
+        using UniqueFileRequest = std::unique_ptr<FileRequest>;
+        using SharedWritablePoll = std::shared_ptr<WritablePoll>;
+
+    private:
+        Impl * _server;
+
+    private:
+        HttpViewParser _parser;
+        WsFrameBuffer _ws;
+        Handler const * _ws_handler;
+        WsDeflate _deflate;
+        Buffer _deflate_buffer;
+
+    private:
+        WriteRequest _write_req;
+        Outputs _outputs;
+        Buffer _spare;
+        Buffer _file_buffer;
+        bool _writing;
+        bool _reading;
+
+    private:
+        UniqueFileRequest _file_req;
+        SharedWritablePoll _poll;
+        bool _use_sendfile;
+        bool _sending; ///< The request of the file is in the thread pool.
+        bool _waiting; ///< Wait until the socket is writable.
+
+    private:
+        HttpMethod _method;
+        bool _keep_alive;
+        bool _close_after_flush;
+        bool _chunked;
+
+    public:
+        Session(Loop & loop, Impl * server);
+        virtual ~Session();
+
+    public:
+        inline bool isWebSocket() const TBAG_NOEXCEPT
+        { return _ws_handler != nullptr; }
+        inline bool isKeepAlive() const TBAG_NOEXCEPT
+        { return _keep_alive; }
+
+        /**
+         * The permessage-deflate is negotiated.
+         *
+         * @remarks
+         *  A frame compressed once by a WsDeflate with the server_no_context_takeover @n
+         *  (See WsDeflate::encodeFrame()) can be broadcast to these sessions with writeRaw().
+         */
+        inline bool isWsDeflate() const TBAG_NOEXCEPT
+        { return _deflate.exists(); }
+        inline WsDeflateParams getWsDeflateParams() const
+        { return _deflate.getParams(); }
+
+        /** Number of bytes (and files) waiting to be written. */
+        inline std::size_t getOutputSize() const TBAG_NOEXCEPT
+        { return _outputs.size(); }
+
+    private:
+        Buffer & appendOutput();
+        void recycle(Output & output);
+        Err submitFile(Output & output);
+        bool waitWritable();
+        void onFile(int64_t result);
+        void onWritable(Err code);
+        void closePoll();
+        void flush();
+        void requestFlush();
+        void closeOutputs();
+
+    private:
+        void appendStatusLine(Buffer & buffer, int code);
+        void appendCommonHeaders(Buffer & buffer);
+
+    private:
+        void onRequest();
+        bool onUpgrade(Handler const & handler);
+        void onWsRead(char const * buffer, std::size_t size);
+        Err writeWsFrame(WsOpCode opcode, char const * data, std::size_t size, bool fin, bool rsv1);
+        void onRequestError(int code);
+
+    public:
+        virtual binf onAlloc(std::size_t suggested_size) override;
+        virtual void onRead(Err code, char const * buffer, std::size_t size) override;
+        virtual void onWrite(WriteRequest & request, Err code) override;
+        virtual void onClose() override;
+
+    public:
+        /** Write the raw bytes to the connection. */
+        Err writeRaw(char const * data, std::size_t size);
+
+        /**
+         * Write the complete response.
+         *
+         * @remarks
+         *  The Content-Length, Connection and Server headers are added automatically. @n
+         *  The body is omitted for the HEAD request.
+         */
+        Err writeResponse(int code, HttpHeaders const & headers, char const * body, std::size_t size);
+        Err writeResponse(int code, std::string const & content_type, std::string const & body);
+        Err writeResponse(int code, std::string const & body);
+
+        /** Start the chunked response. */
+        Err writeChunkedHeader(int code, HttpHeaders const & headers);
+
+        /** Write a chunk of the chunked response. The empty chunk terminates the response. */
+        Err writeChunk(char const * data, std::size_t size);
+        Err writeLastChunk();
+
+        /**
+         * Write the file as the response body.
+         *
+         * @remarks
+         *  The file descriptor is queued instead of the file contents. @n
+         *  When the previous responses are written, the file is sent with sendfile(2) @n
+         *  (or read and written) in the thread pool of the libuv. @n
+         *  If the socket buffer is full, the sendfile(2) is retried when the socket is writable.
+         */
+        Err writeFile(std::string const & path, std::string const & content_type);
+
+        /**
+         * Write the WebSocket frame. (Unmasked, server to client)
+         *
+         * @remarks
+         *  If the permessage-deflate is negotiated, @n
+         *  the unfragmented text and binary messages are compressed.
+         */
+        Err writeWs(WsOpCode opcode, char const * data, std::size_t size, bool fin = true);
+        Err writeWsText(std::string const & text);
+        Err writeWsBinary(char const * data, std::size_t size);
+        Err writeWsClose(uint16_t code, std::string const & reason = std::string());
+
+        /** Close the connection after all outputs are written. */
+        void closeAfterFlush();
+    };
+
+public:
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+private:
+    UniqueImpl _impl;
+
+public:
+    UvHttpServer();
+    virtual ~UvHttpServer();
+
+public:
+    static bool req(RequestMap & r, std::string const & path, OnRequest const & cb,
+                    unsigned method_flags = METHOD_FLAG_GET|METHOD_FLAG_POST);
+
+    template <typename BaseT>
+    static bool req(RequestMap & r, std::string const & path, BaseT * base,
+                    void(BaseT::*method)(Session&, HttpViewParser const&),
+                    unsigned method_flags = METHOD_FLAG_GET|METHOD_FLAG_POST)
+    {
+        return req(r, path, [base, method](Session & session, HttpViewParser const & request){
+            (base->*method)(session, request);
+        }, method_flags);
+    }
+
+    /** Register the WebSocket endpoint. */
+    static bool ws(RequestMap & r, std::string const & path,
+                   OnWsMessage const & message_cb,
+                   OnWsOpen const & open_cb = OnWsOpen(),
+                   OnWsClose const & close_cb = OnWsClose());
+
+public:
+    /** Bind, listen and start the loop thread. */
+    Err open(Options const & options, RequestMap const & requests);
+
+    /** Close all connections and join the loop thread. */
+    void close();
+
+public:
+    bool isOpen() const;
+
+    /** Bound port number. */
+    int getPort() const;
+
+    /** Number of connected sessions. */
+    std::size_t getSessionCount() const;
+};
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_HTTP_UVHTTPSERVER_HPP__
+
@@ -0,0 +1,558 @@
+/**
+ * @file   WsDeflate.cpp
+ * @brief  WsDeflate class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/http/WsDeflate.hpp>
+#include <libtbag/http/WsFrame.hpp>
+#include <libtbag/string/StringUtils.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+#include <sstream>
+
+#include <zlib.h>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+TBAG_CONSTEXPR static char const * const SERVER_NO_CONTEXT_TAKEOVER = "server_no_context_takeover";
+TBAG_CONSTEXPR static char const * const CLIENT_NO_CONTEXT_TAKEOVER = "client_no_context_takeover";
+TBAG_CONSTEXPR static char const * const SERVER_MAX_WINDOW_BITS     = "server_max_window_bits";
+TBAG_CONSTEXPR static char const * const CLIENT_MAX_WINDOW_BITS     = "client_max_window_bits";
+
+/** Empty non-compressed block of the Z_SYNC_FLUSH. */
+TBAG_CONSTEXPR static std::size_t const DEFLATE_TAIL_SIZE = 4;
+static unsigned char const DEFLATE_TAIL[DEFLATE_TAIL_SIZE] = { 0x00, 0x00, 0xFF, 0xFF };
+
+TBAG_CONSTEXPR static int const DEFLATE_MEM_LEVEL = 8;
+TBAG_CONSTEXPR static std::size_t const MIN_CHUNK_SIZE = 1024;
+
+/**
+ * zlib does not support the window of 256 bytes for the raw deflate. @n
+ * (The 8 bits window is silently changed to 9 bits)
+ */
+TBAG_CONSTEXPR static int const DEFLATE_MIN_WINDOW_BITS = 9;
+
+static bool parseWindowBits(std::string const & value, int & result)
+{
+    auto const TEXT = libtbag::string::trim(libtbag::string::trim(value), '"');
+    if (TEXT.empty() || !libtbag::string::isDigit(TEXT) || TEXT.size() > 2) {
+        return false;
+    }
+    auto const BITS = libtbag::string::toValue<int>(TEXT);
+    if (BITS < WS_DEFLATE_MIN_WINDOW_BITS || BITS > WS_DEFLATE_MAX_WINDOW_BITS) {
+        return false;
+    }
+    result = BITS;
+    return true;
+}
+
+/**
+ * Parse an element of the extension list.
+ *
+ * @code
+ *  extension = extension-token *( ";" extension-param )
+ * @endcode
+ */
+static bool parseWsDeflateElement(std::string const & element, WsDeflateParams & params)
+{
+    auto const TOKENS = libtbag::string::splitTokens(element, ";", false);
+    if (TOKENS.empty()) {
+        return false;
+    }
+    if (libtbag::string::lower(libtbag::string::trim(TOKENS[0])) != VALUE_PERMESSAGE_DEFLATE) {
+        return false;
+    }
+
+    WsDeflateParams result;
+    bool smwb = false;
+    bool scnt = false;
+    bool ccnt = false;
+
+    for (std::size_t i = 1; i < TOKENS.size(); ++i) {
+        auto const PARAM = libtbag::string::trim(TOKENS[i]);
+        if (PARAM.empty()) {
+            continue;
+        }
+
+        auto const EQUAL_POS = PARAM.find('=');
+        auto const NAME = libtbag::string::lower(libtbag::string::trim(PARAM.substr(0, EQUAL_POS)));
+        auto const HAS_VALUE = (EQUAL_POS != std::string::npos);
+        auto const VALUE = HAS_VALUE ? PARAM.substr(EQUAL_POS + 1) : std::string();
+
+        // A parameter must not appear more than once.
+        if (NAME == SERVER_NO_CONTEXT_TAKEOVER) {
+            if (scnt || HAS_VALUE) {
+                return false;
+            }
+            scnt = true;
+            result.server_no_context_takeover = true;
+        } else if (NAME == CLIENT_NO_CONTEXT_TAKEOVER) {
+            if (ccnt || HAS_VALUE) {
+                return false;
+            }
+            ccnt = true;
+            result.client_no_context_takeover = true;
+        } else if (NAME == SERVER_MAX_WINDOW_BITS) {
+            if (smwb || !parseWindowBits(VALUE, result.server_max_window_bits)) {
+                return false;
+            }
+            smwb = true;
+        } else if (NAME == CLIENT_MAX_WINDOW_BITS) {
+            if (result.client_max_window_bits_offered) {
+                return false;
+            }
+            // The value is optional in the offer.
+            if (HAS_VALUE && !parseWindowBits(VALUE, result.client_max_window_bits)) {
+                return false;
+            }
+            result.client_max_window_bits_offered = true;
+        } else {
+            return false; // Unknown parameter.
+        }
+    }
+
+    params = result;
+    return true;
+}
+
+bool parseWsDeflateExtension(std::string const & value, WsDeflateParams & params)
+{
+    for (auto const & element : libtbag::string::splitTokens(value, VALUE_DELIMITER)) {
+        if (parseWsDeflateElement(element, params)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string toWsDeflateOffer(WsDeflateParams const & params)
+{
+    std::stringstream ss;
+    ss << VALUE_PERMESSAGE_DEFLATE;
+    if (params.server_no_context_takeover) {
+        ss << "; " << SERVER_NO_CONTEXT_TAKEOVER;
+    }
+    if (params.client_no_context_takeover) {
+        ss << "; " << CLIENT_NO_CONTEXT_TAKEOVER;
+    }
+    if (params.server_max_window_bits < WS_DEFLATE_MAX_WINDOW_BITS) {
+        ss << "; " << SERVER_MAX_WINDOW_BITS << '=' << params.server_max_window_bits;
+    }
+    if (params.client_max_window_bits < WS_DEFLATE_MAX_WINDOW_BITS) {
+        ss << "; " << CLIENT_MAX_WINDOW_BITS << '=' << params.client_max_window_bits;
+    } else {
+        // The client can always accept the smaller window.
+        ss << "; " << CLIENT_MAX_WINDOW_BITS;
+    }
+    return ss.str();
+}
+
+std::string toWsDeflateResponse(WsDeflateParams const & params)
+{
+    std::stringstream ss;
+    ss << VALUE_PERMESSAGE_DEFLATE;
+    if (params.server_no_context_takeover) {
+        ss << "; " << SERVER_NO_CONTEXT_TAKEOVER;
+    }
+    if (params.client_no_context_takeover) {
+        ss << "; " << CLIENT_NO_CONTEXT_TAKEOVER;
+    }
+    if (params.server_max_window_bits < WS_DEFLATE_MAX_WINDOW_BITS) {
+        ss << "; " << SERVER_MAX_WINDOW_BITS << '=' << params.server_max_window_bits;
+    }
+    if (params.client_max_window_bits_offered &&
+        params.client_max_window_bits < WS_DEFLATE_MAX_WINDOW_BITS) {
+        ss << "; " << CLIENT_MAX_WINDOW_BITS << '=' << params.client_max_window_bits;
+    }
+    return ss.str();
+}
+
+bool negotiateWsDeflate(std::string const & offers, WsDeflateParams const & config, WsDeflateParams & accepted)
+{
+    for (auto const & element : libtbag::string::splitTokens(offers, VALUE_DELIMITER)) {
+        WsDeflateParams offer;
+        if (!parseWsDeflateElement(element, offer)) {
+            continue;
+        }
+
+        WsDeflateParams result;
+        result.server_no_context_takeover = offer.server_no_context_takeover || config.server_no_context_takeover;
+        result.client_no_context_takeover = offer.client_no_context_takeover || config.client_no_context_takeover;
+        result.server_max_window_bits = std::min(offer.server_max_window_bits, config.server_max_window_bits);
+        if (result.server_max_window_bits < DEFLATE_MIN_WINDOW_BITS) {
+            continue; // The compressor can't honor the 8 bits window.
+        }
+
+        result.client_max_window_bits_offered = offer.client_max_window_bits_offered;
+        if (offer.client_max_window_bits_offered) {
+            result.client_max_window_bits = std::min(offer.client_max_window_bits, config.client_max_window_bits);
+        } else {
+            // The server can't limit the client window.
+            result.client_max_window_bits = WS_DEFLATE_MAX_WINDOW_BITS;
+        }
+
+        accepted = result;
+        return true;
+    }
+    return false;
+}
+
+/** Join all field values, because the header may appear more than once. */
+static std::string getExtensions(HttpHeaders const & header)
+{
+    std::string result;
+    auto const RANGE = header.equal_range(HEADER_SEC_WEBSOCKET_EXTENSIONS);
+    for (auto itr = RANGE.first; itr != RANGE.second; ++itr) {
+        if (!result.empty()) {
+            result += VALUE_DELIMITER;
+        }
+        result += itr->second;
+    }
+    return result;
+}
+
+bool negotiateWsDeflate(HttpHeaders const & request_header, WsDeflateParams const & config, WsDeflateParams & accepted)
+{
+    return negotiateWsDeflate(getExtensions(request_header), config, accepted);
+}
+
+void updateWsDeflateRequest(HttpHeaders & request_header, WsDeflateParams const & params)
+{
+    insert(request_header, HEADER_SEC_WEBSOCKET_EXTENSIONS, toWsDeflateOffer(params));
+}
+
+bool checkWsDeflateResponse(HttpHeaders const & response_header, WsDeflateParams & accepted)
+{
+    WsDeflateParams result;
+    if (!parseWsDeflateExtension(getExtensions(response_header), result)) {
+        return false;
+    }
+    result.client_max_window_bits_offered = true;
+    if (result.client_max_window_bits < DEFLATE_MIN_WINDOW_BITS) {
+        return false; // The compressor can't honor the 8 bits window.
+    }
+    accepted = result;
+    return true;
+}
+
+void updateWsDeflateResponse(HttpHeaders & response_header, WsDeflateParams const & accepted)
+{
+    insert(response_header, HEADER_SEC_WEBSOCKET_EXTENSIONS, toWsDeflateResponse(accepted));
+}
+
+/**
+ * WsDeflate::Impl class implementation.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct WsDeflate::Impl : private Noncopyable
+{
+    WsDeflateParams params;
+
+    z_stream deflater;
+    z_stream inflater;
+
+    bool deflater_ready = false;
+    bool inflater_ready = false;
+
+    bool deflate_reset = false; ///< Reset after each compressed message.
+    bool inflate_reset = false; ///< Reset after each decompressed message.
+
+    Buffer dictionary;
+
+    Impl()
+    {
+        ::memset(&deflater, 0x00, sizeof(deflater));
+        ::memset(&inflater, 0x00, sizeof(inflater));
+    }
+
+    ~Impl()
+    {
+        if (deflater_ready) {
+            ::deflateEnd(&deflater);
+        }
+        if (inflater_ready) {
+            ::inflateEnd(&inflater);
+        }
+    }
+
+    Err init(int level, int deflate_window_bits)
+    {
+        deflater.zalloc = Z_NULL;
+        deflater.zfree  = Z_NULL;
+        deflater.opaque = Z_NULL;
+        // Negative windowBits: the raw deflate data without the zlib header or trailer.
+        auto const DEFLATE_BITS = std::max(deflate_window_bits, DEFLATE_MIN_WINDOW_BITS);
+        if (::deflateInit2(&deflater, level, Z_DEFLATED, -DEFLATE_BITS,
+                           DEFLATE_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+            return E_INIT;
+        }
+        deflater_ready = true;
+
+        inflater.zalloc = Z_NULL;
+        inflater.zfree  = Z_NULL;
+        inflater.opaque = Z_NULL;
+        inflater.next_in = Z_NULL;
+        inflater.avail_in = 0;
+        // The largest window can decode all of the smaller windows.
+        if (::inflateInit2(&inflater, -WS_DEFLATE_MAX_WINDOW_BITS) != Z_OK) {
+            return E_INIT;
+        }
+        inflater_ready = true;
+        return E_SUCCESS;
+    }
+
+    Err applyDeflateDictionary()
+    {
+        if (dictionary.empty()) {
+            return E_SUCCESS;
+        }
+        auto const RESULT = ::deflateSetDictionary(&deflater,
+                                                   reinterpret_cast<Bytef const *>(dictionary.data()),
+                                                   static_cast<uInt>(dictionary.size()));
+        return RESULT == Z_OK ? E_SUCCESS : E_ENCODE;
+    }
+
+    Err applyInflateDictionary()
+    {
+        if (dictionary.empty()) {
+            return E_SUCCESS;
+        }
+        auto const RESULT = ::inflateSetDictionary(&inflater,
+                                                   reinterpret_cast<Bytef const *>(dictionary.data()),
+                                                   static_cast<uInt>(dictionary.size()));
+        return RESULT == Z_OK ? E_SUCCESS : E_DECODE;
+    }
+
+    Err compress(char const * data, std::size_t size, Buffer & output)
+    {
+        output.clear();
+        deflater.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+        deflater.avail_in = static_cast<uInt>(size);
+
+        // The compressed data is rarely bigger than the input.
+        auto const CHUNK_SIZE = std::max(MIN_CHUNK_SIZE, size / 2 + DEFLATE_TAIL_SIZE);
+        std::size_t written = 0;
+        int result = Z_OK;
+
+        do {
+            output.resize(written + CHUNK_SIZE);
+            deflater.next_out = reinterpret_cast<Bytef *>(output.data() + written);
+            deflater.avail_out = static_cast<uInt>(CHUNK_SIZE);
+            result = ::deflate(&deflater, Z_SYNC_FLUSH);
+            if (result != Z_OK && result != Z_BUF_ERROR) {
+                output.clear();
+                return E_ENCODE;
+            }
+            written += (CHUNK_SIZE - deflater.avail_out);
+        } while (deflater.avail_out == 0);
+        assert(deflater.avail_in == 0);
+
+        // Remove the empty block of the Z_SYNC_FLUSH.
+        if (written >= DEFLATE_TAIL_SIZE &&
+            ::memcmp(output.data() + written - DEFLATE_TAIL_SIZE, DEFLATE_TAIL, DEFLATE_TAIL_SIZE) == 0) {
+            written -= DEFLATE_TAIL_SIZE;
+        }
+        if (written == 0) {
+            // An empty message is a single empty block.
+            output.resize(1);
+            output[0] = 0x00;
+        } else {
+            output.resize(written);
+        }
+
+        if (deflate_reset) {
+            if (::deflateReset(&deflater) != Z_OK) {
+                return E_ENCODE;
+            }
+            return applyDeflateDictionary();
+        }
+        return E_SUCCESS;
+    }
+
+    int inflateInput(Bytef const * data, std::size_t size, Buffer & output,
+                     std::size_t & written, std::size_t max_size)
+    {
+        inflater.next_in = const_cast<Bytef *>(data);
+        inflater.avail_in = static_cast<uInt>(size);
+
+        int result = Z_OK;
+        do {
+            if (output.size() - written < MIN_CHUNK_SIZE) {
+                output.resize(std::max(output.size() * 2, written + MIN_CHUNK_SIZE));
+            }
+            auto const AVAILABLE_SIZE = output.size() - written;
+            inflater.next_out = reinterpret_cast<Bytef *>(output.data() + written);
+            inflater.avail_out = static_cast<uInt>(AVAILABLE_SIZE);
+            result = ::inflate(&inflater, Z_SYNC_FLUSH);
+            written += (AVAILABLE_SIZE - inflater.avail_out);
+            if (result != Z_OK && result != Z_BUF_ERROR && result != Z_STREAM_END) {
+                return result;
+            }
+            if (max_size != 0 && written > max_size) {
+                return Z_MEM_ERROR; // Stop the decompression bomb as soon as possible.
+            }
+        } while (inflater.avail_out == 0 && result != Z_STREAM_END);
+        return result;
+    }
+
+    Err decompress(char const * data, std::size_t size, Buffer & output, std::size_t max_size)
+    {
+        std::size_t written = 0;
+        output.resize(std::max(MIN_CHUNK_SIZE, size * 4));
+
+        auto result = inflateInput(reinterpret_cast<Bytef const *>(data), size, output, written, max_size);
+        if (result == Z_OK || result == Z_BUF_ERROR) {
+            result = inflateInput(DEFLATE_TAIL, DEFLATE_TAIL_SIZE, output, written, max_size);
+        }
+        output.resize(written);
+
+        if (result != Z_OK && result != Z_BUF_ERROR && result != Z_STREAM_END) {
+            // The context is broken, so the connection should be closed.
+            ::inflateReset(&inflater);
+            applyInflateDictionary();
+            output.clear();
+            return result == Z_MEM_ERROR ? E_DATA_TOO_LARGE : E_DECOMPRESSION_FAILED;
+        }
+
+        if (inflate_reset || result == Z_STREAM_END) {
+            if (::inflateReset(&inflater) != Z_OK) {
+                return E_DECODE;
+            }
+            return applyInflateDictionary();
+        }
+        return E_SUCCESS;
+    }
+};
+
+// ------------------------
+// WsDeflate implementation
+// ------------------------
+
+WsDeflate::WsDeflate()
+{
+    // EMPTY.
+}
+
+WsDeflate::~WsDeflate()
+{
+    // EMPTY.
+}
+
+Err WsDeflate::init(WsDeflateParams const & params, bool is_server, int level)
+{
+    if (level != WS_DEFLATE_DEFAULT_LEVEL && (level < Z_NO_COMPRESSION || level > Z_BEST_COMPRESSION)) {
+        return E_ILLARGS;
+    }
+
+    auto impl = std::make_unique<Impl>();
+    impl->params = params;
+    if (is_server) {
+        impl->deflate_reset = params.server_no_context_takeover;
+        impl->inflate_reset = params.client_no_context_takeover;
+    } else {
+        impl->deflate_reset = params.client_no_context_takeover;
+        impl->inflate_reset = params.server_no_context_takeover;
+    }
+
+    auto const CODE = impl->init(level, is_server ? params.server_max_window_bits : params.client_max_window_bits);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    _impl = std::move(impl);
+    return E_SUCCESS;
+}
+
+void WsDeflate::release()
+{
+    _impl.reset();
+}
+
+WsDeflateParams WsDeflate::getParams() const
+{
+    if (!_impl) {
+        return WsDeflateParams();
+    }
+    return _impl->params;
+}
+
+Err WsDeflate::setDictionary(char const * data, std::size_t size)
+{
+    if (!_impl) {
+        return E_NREADY;
+    }
+    if (data == nullptr || size == 0) {
+        return E_ILLARGS;
+    }
+    _impl->dictionary.assign(data, data + size);
+
+    // Only the beginning of the stream can use the dictionary.
+    if (::deflateReset(&_impl->deflater) != Z_OK || ::inflateReset(&_impl->inflater) != Z_OK) {
+        return E_ILLSTATE;
+    }
+    auto const CODE = _impl->applyDeflateDictionary();
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    return _impl->applyInflateDictionary();
+}
+
+Err WsDeflate::compress(char const * data, std::size_t size, Buffer & output)
+{
+    if (!_impl) {
+        return E_NREADY;
+    }
+    if (data == nullptr && size > 0) {
+        return E_ILLARGS;
+    }
+    return _impl->compress(data, size, output);
+}
+
+Err WsDeflate::decompress(char const * data, std::size_t size, Buffer & output, std::size_t max_size)
+{
+    if (!_impl) {
+        return E_NREADY;
+    }
+    if (data == nullptr && size > 0) {
+        return E_ILLARGS;
+    }
+    return _impl->decompress(data, size, output, max_size);
+}
+
+Err WsDeflate::encodeFrame(WsOpCode opcode, char const * data, std::size_t size, Buffer & frame, uint32_t key)
+{
+    if (!_impl) {
+        return E_NREADY;
+    }
+    if (static_cast<int>(opcode) & 0x08) {
+        return E_ILLARGS; // Control frames must not be compressed.
+    }
+
+    WsFrame result;
+    auto const CODE = compress(data, size, result.payload);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    result.setHeader(true, true, false, false, opcode, key);
+    result.payload_length = result.payload.size();
+    if (result.copyTo(frame) == 0) {
+        return E_ENCODE;
+    }
+    return E_SUCCESS;
+}
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
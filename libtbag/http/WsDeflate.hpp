@@ -0,0 +1,204 @@
+/**
+ * @file   WsDeflate.hpp
+ * @brief  WsDeflate class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_HTTP_WSDEFLATE_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_HTTP_WSDEFLATE_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/http/HttpCommon.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <memory>
+#include <string>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace http {
+
+TBAG_CONSTEXPR int const WS_DEFLATE_MIN_WINDOW_BITS = 8;
+TBAG_CONSTEXPR int const WS_DEFLATE_MAX_WINDOW_BITS = 15;
+
+TBAG_CONSTEXPR int const WS_DEFLATE_DEFAULT_LEVEL = -1;
+
+/**
+ * Extension parameters of the permessage-deflate.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @see <https://tools.ietf.org/html/rfc7692#section-7.1>
+ */
+struct WsDeflateParams
+{
+    bool server_no_context_takeover = false;
+    bool client_no_context_takeover = false;
+
+    int server_max_window_bits = WS_DEFLATE_MAX_WINDOW_BITS;
+    int client_max_window_bits = WS_DEFLATE_MAX_WINDOW_BITS;
+
+    /** The client_max_window_bits parameter appeared in the offer. (The client can limit the window) */
+    bool client_max_window_bits_offered = false;
+};
+
+/**
+ * Parse the first valid permessage-deflate offer (or response) of the Sec-WebSocket-Extensions value.
+ *
+ * @return
+ *  If there is no valid permessage-deflate element, return false.
+ */
+TBAG_API bool parseWsDeflateExtension(std::string const & value, WsDeflateParams & params);
+
+/** Sec-WebSocket-Extensions value of the client offer. */
+TBAG_API std::string toWsDeflateOffer(WsDeflateParams const & params);
+
+/** Sec-WebSocket-Extensions value of the server response. */
+TBAG_API std::string toWsDeflateResponse(WsDeflateParams const & params);
+
+/**
+ * Accept one of the client offers with the server configuration.
+ *
+ * @param[in] offers
+ *  Sec-WebSocket-Extensions value of the request.
+ * @param[in] config
+ *  Server preferences. The no_context_takeover flags are forced, @n
+ *  and the window bits are the maximum values.
+ * @param[out] accepted
+ *  Negotiated parameters.
+ *
+ * @return
+ *  If there is no acceptable offer, return false. (The extension must not be used)
+ */
+TBAG_API bool negotiateWsDeflate(std::string const & offers,
+                                 WsDeflateParams const & config,
+                                 WsDeflateParams & accepted);
+TBAG_API bool negotiateWsDeflate(HttpHeaders const & request_header,
+                                 WsDeflateParams const & config,
+                                 WsDeflateParams & accepted);
+
+/**
+ * Generally, Called from the client side.
+ */
+TBAG_API void updateWsDeflateRequest(HttpHeaders & request_header, WsDeflateParams const & params);
+TBAG_API bool checkWsDeflateResponse(HttpHeaders const & response_header, WsDeflateParams & accepted);
+
+/**
+ * Generally, Called from the server side.
+ */
+TBAG_API void updateWsDeflateResponse(HttpHeaders & response_header, WsDeflateParams const & accepted);
+
+/**
+ * Compression context of the permessage-deflate extension.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  One instance holds both directions of a connection: @n
+ *  the compressor of the local side and the decompressor of the peer side. @n
+ *  If the no_context_takeover parameter of a side is set, the sliding window of that side @n
+ *  is reset after each message.
+ *
+ *  Broadcasting: @n
+ *  A message compressed by a context that was initialized with server_no_context_takeover @n
+ *  does not refer to the previous messages, so the same frame (See encodeFrame()) @n
+ *  can be written to all clients which negotiated permessage-deflate @n
+ *  with a window that is not smaller than the one of the broadcasting context.
+ *
+ * @warning
+ *  The preset dictionary (See setDictionary()) is not a part of the RFC 7692. @n
+ *  Use it only if both peers are configured with the same dictionary.
+ */
+class TBAG_API WsDeflate : private Noncopyable
+{
+public:
+    struct Impl;
+    friend struct Impl;
+
+public:
+    using Buffer = libtbag::util::Buffer;
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+private:
+    UniqueImpl _impl;
+
+public:
+    WsDeflate();
+    ~WsDeflate();
+
+public:
+    inline bool exists() const TBAG_NOEXCEPT
+    { return static_cast<bool>(_impl); }
+
+    inline operator bool() const TBAG_NOEXCEPT
+    { return exists(); }
+
+public:
+    /**
+     * Initialize the contexts.
+     *
+     * @param[in] params
+     *  Negotiated parameters.
+     * @param[in] is_server
+     *  If true, the server parameters are used for the compression.
+     * @param[in] level
+     *  Compression level (0~9). -1 is the default level.
+     */
+    Err init(WsDeflateParams const & params, bool is_server, int level = WS_DEFLATE_DEFAULT_LEVEL);
+    void release();
+
+public:
+    WsDeflateParams getParams() const;
+
+    /** Preset dictionary of both directions. */
+    Err setDictionary(char const * data, std::size_t size);
+
+public:
+    /**
+     * Compress a message.
+     *
+     * @remarks
+     *  The trailing 0x00 0x00 0xFF 0xFF of the flushed block is removed. @n
+     *  The output buffer is overwritten.
+     */
+    Err compress(char const * data, std::size_t size, Buffer & output);
+
+    /**
+     * Decompress a message.
+     *
+     * @param[in] max_size
+     *  If the decompressed size exceeds this value, E_DATA_TOO_LARGE is returned. (0 is unlimited)
+     */
+    Err decompress(char const * data, std::size_t size, Buffer & output, std::size_t max_size = 0);
+
+public:
+    /**
+     * Compress a message and write the whole frame (RSV1 is set).
+     *
+     * @param[in] key
+     *  If not 0, the payload is masked. (Client to server)
+     */
+    Err encodeFrame(WsOpCode opcode, char const * data, std::size_t size, Buffer & frame, uint32_t key = 0);
+};
+
+} // namespace http
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_HTTP_WSDEFLATE_HPP__
+
@@ -57,7 +57,7 @@ void WsFrame::clear()
     payload.clear();
 }
 
-Err WsFrame::execute(char const * data, std::size_t size, std::size_t * read_size)
+Err WsFrame::executeHeader(char const * data, std::size_t size, std::size_t * data_index)
 {
     if (size < WsFrame::MINIMUM_BUFFER_SIZE) {
         return E_SMALLBUF; // Check minimum size.
@@ -75,7 +75,6 @@ Err WsFrame::execute(char const * data, std::size_t size, std::size_t * read_siz
     auto const PAYLOAD_BIT         = getWsPayloadBit(PAYLOAD_LENGTH_7BIT);
     auto const MASK_KEY_INDEX      = getMaskingKeyByteIndex(PAYLOAD_BIT);
     auto const DATA_INDEX          = getPayloadDataByteIndex(PAYLOAD_BIT, static_cast<bool>(temp_mask));
-    auto const PAYLOAD_LENGTH      = getPayloadLength(data);
 
     if (size < MASK_KEY_INDEX) {
         return E_SMALLBUF; // Check header data.
@@ -83,6 +82,8 @@ Err WsFrame::execute(char const * data, std::size_t size, std::size_t * read_siz
     if (temp_mask && size < DATA_INDEX) {
         return E_SMALLBUF; // Check masking key.
     }
+
+    auto const PAYLOAD_LENGTH = getPayloadLength(data);
     if (PAYLOAD_LENGTH > 0 && size < DATA_INDEX + PAYLOAD_LENGTH) {
         return E_SMALLBUF; // Check payload data.
     }
@@ -102,11 +103,26 @@ Err WsFrame::execute(char const * data, std::size_t size, std::size_t * read_siz
         masking_key = copyMaskingKeyFromBuffer(&data[MASK_KEY_INDEX]);
     }
 
+    assert(data_index != nullptr);
+    *data_index = DATA_INDEX;
+    return E_SUCCESS;
+}
+
+Err WsFrame::execute(char const * data, std::size_t size, std::size_t * read_size)
+{
+    std::size_t data_index = 0;
+    auto const CODE = executeHeader(data, size, &data_index);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+
     if (payload_length > 0) {
-        // Update payload data.
-        payload.assign(&data[DATA_INDEX], &data[DATA_INDEX] + payload_length);
+        // Update payload data. (Unmask while copying)
+        payload.resize(payload_length);
         if (mask) {
-            updatePayloadData(masking_key, payload.data(), payload_length);
+            copyPayloadData(masking_key, &data[data_index], payload.data(), payload_length);
+        } else {
+            ::memcpy(payload.data(), &data[data_index], payload_length);
         }
     }
 
@@ -116,6 +132,27 @@ Err WsFrame::execute(char const * data, std::size_t size, std::size_t * read_siz
     return E_SUCCESS;
 }
 
+Err WsFrame::executeInPlace(char * data, std::size_t size, util::binf * payload_view, std::size_t * read_size)
+{
+    std::size_t data_index = 0;
+    auto const CODE = executeHeader(data, size, &data_index);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+
+    if (mask && payload_length > 0) {
+        updatePayloadData(masking_key, &data[data_index], payload_length, 0);
+    }
+    if (payload_view != nullptr) {
+        payload_view->buffer = &data[data_index];
+        payload_view->size = static_cast<std::size_t>(payload_length);
+    }
+    if (read_size != nullptr) {
+        *read_size = calculateBufferSize(payload_length, mask);
+    }
+    return E_SUCCESS;
+}
+
 std::size_t WsFrame::copyTo(char * buffer, std::size_t size) const
 {
     if (size < calculateBufferSize(payload_length, mask)) {
@@ -172,9 +209,10 @@ std::size_t WsFrame::copyTo(char * buffer, std::size_t size) const
 
     // Update payload data.
     if (payload_length > 0) {
-        ::memcpy(buffer + index, payload.data(), payload_length);
         if (mask) {
-            updatePayloadData(masking_key, buffer + index, payload_length);
+            copyPayloadData(masking_key, payload.data(), buffer + index, payload_length);
+        } else {
+            ::memcpy(buffer + index, payload.data(), payload_length);
         }
         index += payload_length;
     }
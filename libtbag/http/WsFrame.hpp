@@ -114,9 +114,22 @@ public:
 public:
     void clear();
 
+private:
+    /** Parse the header fields and return the index of the payload data. */
+    Err executeHeader(char const * data, std::size_t size, std::size_t * data_index);
+
 public:
     Err execute(char const * data, std::size_t size, std::size_t * read_size = nullptr);
 
+    /**
+     * Parse the frame without copying the payload.
+     *
+     * @remarks
+     *  The masked payload is unmasked in the input buffer, @n
+     *  and the payload_view points to it. The payload member is not updated.
+     */
+    Err executeInPlace(char * data, std::size_t size, util::binf * payload_view, std::size_t * read_size = nullptr);
+
 public:
     std::size_t copyTo(char * buffer, std::size_t data_size) const;
     std::size_t copyTo(util::Buffer & buffer) const;
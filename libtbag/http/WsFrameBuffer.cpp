@@ -10,6 +10,8 @@
 #include <libtbag/log/Log.hpp>
 
 #include <algorithm>
+#include <cassert>
+#include <cstring>
 #include <utility>
 
 // -------------------
@@ -18,17 +20,20 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace http {
 
-WsFrameBuffer::WsFrameBuffer() : _buffer_size(0), _frames_size(0)
+WsFrameBuffer::WsFrameBuffer() : _buffer_size(0), _offset(0),
+                                 _fragment_opcode(WsOpCode::WSOC_CONTINUATION_FRAME),
+                                 _fragmenting(false), _fragment_compressed(false),
+                                 _deflate(nullptr), _max_message_size(0)
 {
-    // EMPTY.
+    __cache__.opcode = WsOpCode::WSOC_CONTINUATION_FRAME;
 }
 
-WsFrameBuffer::WsFrameBuffer(WsFrameBuffer const & obj)
+WsFrameBuffer::WsFrameBuffer(WsFrameBuffer const & obj) : WsFrameBuffer()
 {
     (*this) = obj;
 }
 
-WsFrameBuffer::WsFrameBuffer(WsFrameBuffer && obj)
+WsFrameBuffer::WsFrameBuffer(WsFrameBuffer && obj) : WsFrameBuffer()
 {
     (*this) = std::move(obj);
 }
@@ -41,10 +46,15 @@ WsFrameBuffer::~WsFrameBuffer()
 WsFrameBuffer & WsFrameBuffer::operator =(WsFrameBuffer const & obj)
 {
     if (this != &obj) {
-        _buffer      = obj._buffer;
-        _buffer_size = obj._buffer_size;
-        _frames      = obj._frames;
-        _frames_size = obj._frames_size;
+        _buffer              = obj._buffer;
+        _buffer_size         = obj._buffer_size;
+        _offset              = obj._offset;
+        _fragments           = obj._fragments;
+        _fragment_opcode     = obj._fragment_opcode;
+        _fragmenting         = obj._fragmenting;
+        _fragment_compressed = obj._fragment_compressed;
+        _deflate             = obj._deflate;
+        _max_message_size    = obj._max_message_size;
     }
     return *this;
 }
@@ -61,16 +71,24 @@ void WsFrameBuffer::swap(WsFrameBuffer & obj)
 {
     _buffer.swap(obj._buffer);
     std::swap(_buffer_size, obj._buffer_size);
-    _frames.swap(obj._frames);
-    std::swap(_frames_size, obj._frames_size);
+    std::swap(_offset, obj._offset);
+    _fragments.swap(obj._fragments);
+    std::swap(_fragment_opcode, obj._fragment_opcode);
+    std::swap(_fragmenting, obj._fragmenting);
+    std::swap(_fragment_compressed, obj._fragment_compressed);
+    std::swap(_deflate, obj._deflate);
+    std::swap(_max_message_size, obj._max_message_size);
 }
 
 void WsFrameBuffer::clear()
 {
     _buffer.clear();
     _buffer_size = 0;
-    _frames.clear();
-    _frames_size = 0;
+    _offset = 0;
+    _fragments.clear();
+    _fragment_opcode = WsOpCode::WSOC_CONTINUATION_FRAME;
+    _fragmenting = false;
+    _fragment_compressed = false;
 }
 
 void WsFrameBuffer::clearCache()
@@ -82,6 +100,17 @@ void WsFrameBuffer::clearCache()
 
 void WsFrameBuffer::push(char const * buffer, std::size_t size)
 {
+    if (_offset > 0) {
+        // Move the incomplete frame to the front only once per push.
+        assert(_offset <= _buffer_size);
+        auto const REMAIN_SIZE = _buffer_size - _offset;
+        if (REMAIN_SIZE > 0) {
+            ::memmove(&_buffer[0], &_buffer[_offset], REMAIN_SIZE);
+        }
+        _buffer_size = REMAIN_SIZE;
+        _offset = 0;
+    }
+
     if (_buffer.size() < _buffer_size + size) {
         _buffer.resize(_buffer_size + size);
     }
@@ -91,7 +120,8 @@ void WsFrameBuffer::push(char const * buffer, std::size_t size)
 
 bool WsFrameBuffer::next(Err * code, std::size_t * size)
 {
-    if (_buffer_size == 0) {
+    assert(_offset <= _buffer_size);
+    if (_buffer_size == _offset) {
         if (code != nullptr) { (*code) = E_SMALLBUF; }
         if (size != nullptr) { (*size) = 0; }
         return false;
@@ -101,45 +131,76 @@ bool WsFrameBuffer::next(Err * code, std::size_t * size)
     WsOpCode     & result_opcode  = __cache__.opcode;
     util::Buffer & result_payload = __cache__.payload;
 
+    util::binf view;
     std::size_t read_size = 0;
-    Err const CODE = current_buffer.execute(&_buffer[0], _buffer_size, &read_size);
+    Err const CODE = current_buffer.executeInPlace(&_buffer[_offset], _buffer_size - _offset, &view, &read_size);
     if (isFailure(CODE)) {
         if (code != nullptr) { (*code) = CODE; }
         if (size != nullptr) { (*size) = 0; }
         return false;
     }
 
-    if (read_size == _buffer_size) {
+    _offset += read_size;
+    if (_offset == _buffer_size) {
+        _offset = 0;
         _buffer_size = 0;
-    } else {
-        std::swap_ranges(_buffer.begin() + read_size, _buffer.begin() + _buffer_size, _buffer.begin());
-        _buffer_size -= read_size;
     }
+    // [WARNING] The view is valid until the next push().
 
-    if (current_buffer.fin == false) {
-        // It is temporarily stored in the buffer until 'Finish' is confirmed.
-        if (_frames.size() < _frames_size + 1) {
-            _frames.resize(_frames_size + 1);
+    auto const IS_CONTROL = (static_cast<int>(current_buffer.opcode) & 0x08) != 0;
+    bool compressed = false;
+
+    if (!IS_CONTROL && (!current_buffer.fin || _fragmenting)) {
+        if (!_fragmenting) {
+            _fragmenting = true;
+            _fragment_opcode = current_buffer.opcode;
+            _fragment_compressed = current_buffer.rsv1; // Only the first frame has the RSV1 bit.
+            _fragments.clear();
         }
-        _frames[_frames_size].swap(current_buffer);
-        ++_frames_size;
+        // It is temporarily stored in the buffer until 'Finish' is confirmed.
+        _fragments.insert(_fragments.end(), view.buffer, view.buffer + view.size);
 
-        if (code != nullptr) { (*code) = E_CONTINUE; }
-        if (size != nullptr) { (*size) = 0; }
-        return false;
-    }
+        if (!current_buffer.fin) {
+            if (code != nullptr) { (*code) = E_CONTINUE; }
+            if (size != nullptr) { (*size) = 0; }
+            return false;
+        }
 
-    result_payload.clear();
-    if (_frames_size > 0) {
-        result_opcode = _frames[0].opcode;
-        for (auto const & f : _frames) {
-            result_payload.insert(result_payload.end(), f.payload.begin(), f.payload.end());
+        result_opcode = _fragment_opcode;
+        compressed = _fragment_compressed;
+        _fragmenting = false;
+        _fragment_compressed = false;
+
+        if (compressed && _deflate != nullptr) {
+            auto const INFLATE_CODE = _deflate->decompress(_fragments.data(), _fragments.size(),
+                                                           result_payload, _max_message_size);
+            _fragments.clear();
+            if (isFailure(INFLATE_CODE)) {
+                if (code != nullptr) { (*code) = INFLATE_CODE; }
+                if (size != nullptr) { (*size) = 0; }
+                return false;
+            }
+        } else {
+            result_payload.swap(_fragments);
+            _fragments.clear();
         }
     } else {
+        // Control frames can be injected in the middle of a fragmented message.
         result_opcode = current_buffer.opcode;
+        compressed = !IS_CONTROL && current_buffer.rsv1;
+
+        if (compressed && _deflate != nullptr) {
+            auto const INFLATE_CODE = _deflate->decompress(view.buffer, view.size,
+                                                           result_payload, _max_message_size);
+            if (isFailure(INFLATE_CODE)) {
+                if (code != nullptr) { (*code) = INFLATE_CODE; }
+                if (size != nullptr) { (*size) = 0; }
+                return false;
+            }
+        } else {
+            result_payload.assign(view.buffer, view.buffer + view.size);
+        }
     }
-    result_payload.insert(result_payload.end(), current_buffer.payload.begin(), current_buffer.payload.end());
-    _frames_size = 0;
 
     if (code != nullptr) { (*code) = E_SUCCESS; }
     if (size != nullptr) { (*size) = read_size; }
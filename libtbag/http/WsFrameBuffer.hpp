@@ -19,6 +19,7 @@
 #include <libtbag/Err.hpp>
 
 #include <libtbag/http/WsFrame.hpp>
+#include <libtbag/http/WsDeflate.hpp>
 
 #include <vector>
 
@@ -35,18 +36,32 @@ namespace http {
  * @date   2017-08-07
  * @date   2017-10-01 (Change namespace: libtbag::network::http -> libtbag::network::http::ws)
  * @date   2018-12-25 (Change namespace: libtbag::network::http::ws -> libtbag::http)
+ * @date   2026-10-19 (Parse frames in place)
+ *
+ * @remarks
+ *  Frames are unmasked in the receive buffer, and the fragments are appended @n
+ *  to a single reassembly buffer. Control frames may be interleaved with the fragments. @n
+ *  If the permessage-deflate is negotiated (See setDeflate()), @n
+ *  the messages with the RSV1 bit are decompressed after reassembly.
  */
 class TBAG_API WsFrameBuffer
 {
-public:
-    using Frames = std::vector<WsFrame>;
-
 private:
     util::Buffer _buffer;
     std::size_t  _buffer_size;
 
-    Frames      _frames;
-    std::size_t _frames_size;
+    /** Read position of the _buffer. */
+    std::size_t _offset;
+
+    /** Payload of the fragmented message. */
+    util::Buffer _fragments;
+    WsOpCode     _fragment_opcode;
+    bool         _fragmenting;
+    bool         _fragment_compressed;
+
+    /** Decompressor of the permessage-deflate. (Not owned) */
+    WsDeflate * _deflate;
+    std::size_t _max_message_size;
 
 private:
     struct {
@@ -74,6 +89,21 @@ public:
     inline util::Buffer       & atPayload()       TBAG_NOEXCEPT { return __cache__.payload; }
     inline util::Buffer const & atPayload() const TBAG_NOEXCEPT { return __cache__.payload; }
 
+public:
+    /**
+     * Decompress the messages with the RSV1 bit.
+     *
+     * @param[in] deflate
+     *  The context must outlive this buffer. If nullptr, the payload is not decompressed.
+     * @param[in] max_message_size
+     *  Maximum size of the decompressed message. (0 is unlimited)
+     */
+    inline void setDeflate(WsDeflate * deflate, std::size_t max_message_size = 0) TBAG_NOEXCEPT
+    { _deflate = deflate; _max_message_size = max_message_size; }
+
+    inline WsDeflate * getDeflate() const TBAG_NOEXCEPT
+    { return _deflate; }
+
 public:
     void clear();
     void clearCache();
@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 #include <iterator>
 #include <type_traits>
 #include <exception>
@@ -64,6 +65,7 @@ public:
     TBAG_CONSTEXPR static uint8_t const HI_VERSION_03 = 0x30;
     TBAG_CONSTEXPR static uint8_t const HI_VERSION_04 = 0x40;
     TBAG_CONSTEXPR static uint8_t const HI_VERSION_05 = 0x50;
+    TBAG_CONSTEXPR static uint8_t const HI_VERSION_07 = 0x70;
 
     TBAG_CONSTEXPR static uint8_t const LOW_FULL = 0x0F;
 
@@ -87,6 +89,7 @@ public:
         UUID_VER_3, ///< Version 3 (namespace name-based; MD5 hash)
         UUID_VER_4, ///< Version 4 (random)
         UUID_VER_5, ///< Version 5 (namespace name-based; SHA-1 hash)
+        UUID_VER_7, ///< Version 7 (unix time in milliseconds and random)
     };
 
 public:
@@ -202,11 +205,26 @@ public:
     /** Algorithm for Creating a Name-Based UUID. */
     bool initVersion5();
 
+    /**
+     * Algorithm for Creating a Time-Ordered UUID from the Unix Epoch time in milliseconds.
+     *
+     * @remarks
+     *  The 12bit rand_a field is a counter started from a random value at every millisecond (Method 1),
+     *  so the UUIDs of a thread are strictly increasing. If the counter overflows,
+     *  the timestamp is advanced by 1ms instead of waiting for the clock.
+     *
+     * @see <https://www.rfc-editor.org/rfc/rfc9562#section-5.7>
+     */
+    bool initVersion7();
+
+private:
+    static void setVersion4Bits(Identifier & id) TBAG_NOEXCEPT;
+
 public:
     bool init(Version version = Version::UUID_VER_4);
 
 public:
-    std::string toString();
+    std::string toString() const;
     Err fromString(std::string const & str);
 
 public:
@@ -216,6 +234,23 @@ public:
      */
     static Uuid nil() TBAG_NOEXCEPT;
     static Uuid ver4() TBAG_NOEXCEPT;
+
+    /**
+     * Generate the version 4 UUIDs by a single batched request of the CSPRNG.
+     *
+     * @remarks
+     *  The random bytes come from the RAND_bytes() of the OpenSSL, not the fast engine of the libtbag::random,
+     *  because the UUIDs must be unpredictable.
+     */
+    static bool genVersion4(Uuid * uuids, std::size_t size);
+    static std::vector<Uuid> ver4(std::size_t size);
+
+    static Uuid ver7() TBAG_NOEXCEPT;
+    static bool genVersion7(Uuid * uuids, std::size_t size);
+    static std::vector<Uuid> ver7(std::size_t size);
+
+    /** Unix time of the version 7 UUID in milliseconds. */
+    uint64_t getVersion7Time() const TBAG_NOEXCEPT;
 };
 
 } // namespace id
@@ -0,0 +1,93 @@
+/**
+ * @file   SnowflakeId.cpp
+ * @brief  SnowflakeId class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Bound the lead of the timestamp over the clock)
+ */
+
+#include <libtbag/id/generator/SnowflakeId.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace id        {
+namespace generator {
+
+SnowflakeGenerator::SnowflakeGenerator(uint64_t node, uint64_t epoch)
+        : EPOCH(epoch), NODE(node & SNOWFLAKE_MAX_NODE), _tick(0)
+{
+    // EMPTY.
+}
+
+SnowflakeGenerator::~SnowflakeGenerator()
+{
+    // EMPTY.
+}
+
+uint64_t SnowflakeGenerator::getNowTick() const
+{
+    using namespace std::chrono;
+    auto const NOW = static_cast<uint64_t>(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+    return (NOW > EPOCH ? NOW - EPOCH : 0) << SNOWFLAKE_SEQUENCE_BITS;
+}
+
+uint64_t SnowflakeGenerator::reserve(uint64_t & count)
+{
+    TBAG_CONSTEXPR static uint64_t const MAX_LEAD_TICK = MAX_LEAD_MILLISEC << SNOWFLAKE_SEQUENCE_BITS;
+
+    auto now_tick = getNowTick();
+    auto last = _tick.load(std::memory_order_relaxed);
+    while (true) {
+        auto const FIRST = std::max(last, now_tick);
+        // The borrowed ticks are not kept in the blocks of the idle threads.
+        auto const SIZE = (last > now_tick ? 1 : count);
+        if (FIRST + SIZE > now_tick + MAX_LEAD_TICK) {
+            std::this_thread::yield();
+            now_tick = getNowTick();
+            last = _tick.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (_tick.compare_exchange_weak(last, FIRST + SIZE, std::memory_order_relaxed)) {
+            count = SIZE;
+            return FIRST;
+        }
+    }
+}
+
+SnowflakeId SnowflakeGenerator::gen()
+{
+    uint64_t count = 1;
+    return toId(reserve(count));
+}
+
+SnowflakeId SnowflakeGenerator::gen(Block & block)
+{
+    // Discard the rest of a stale block, so the timestamp follows the clock.
+    if (block.next == block.end || block.next < (getNowTick() & ~SNOWFLAKE_MAX_SEQUENCE)) {
+        uint64_t count = BLOCK_SIZE;
+        block.next = reserve(count);
+        block.end  = block.next + count;
+    }
+    return toId(block.next++);
+}
+
+SnowflakeId genSnowflakeId()
+{
+    static SnowflakeGenerator generator;
+    thread_local SnowflakeGenerator::Block block;
+    return generator.gen(block);
+}
+
+} // namespace generator
+} // namespace id
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,155 @@
+/**
+ * @file   SnowflakeId.hpp
+ * @brief  SnowflakeId class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Bound the lead of the timestamp over the clock)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_ID_GENERATOR_SNOWFLAKEID_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_ID_GENERATOR_SNOWFLAKEID_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/id/Id.hpp>
+
+#include <cstdint>
+#include <atomic>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace id        {
+namespace generator {
+
+/**
+ * 64bit Snowflake ID.
+ *
+ * @remarks
+ *  <pre>
+ *  |  1bit  |      41bit      |  10bit  |    12bit    |
+ *  | unused | timestamp (ms)  | node id |  sequence   |
+ *  </pre>
+ */
+using SnowflakeId = LargeId;
+
+TBAG_CONSTEXPR int const SNOWFLAKE_TIMESTAMP_BITS = 41;
+TBAG_CONSTEXPR int const SNOWFLAKE_NODE_BITS      = 10;
+TBAG_CONSTEXPR int const SNOWFLAKE_SEQUENCE_BITS  = 12;
+
+TBAG_CONSTEXPR uint64_t const SNOWFLAKE_MAX_NODE     = (1ull << SNOWFLAKE_NODE_BITS) - 1;
+TBAG_CONSTEXPR uint64_t const SNOWFLAKE_MAX_SEQUENCE = (1ull << SNOWFLAKE_SEQUENCE_BITS) - 1;
+
+/** 2020-01-01T00:00:00Z in milliseconds since the unix epoch. */
+TBAG_CONSTEXPR uint64_t const SNOWFLAKE_DEFAULT_EPOCH = 1577836800000ull;
+
+/**
+ * SnowflakeGenerator class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The timestamp and the sequence are allocated together from a single atomic counter of the "ticks"
+ *  (timestamp << 12 | sequence), so the generator never waits for the clock: @n
+ *  - Each thread reserves a block of ticks with a single CAS and hands them out without synchronization.
+ *  - If the 4096 sequences of a millisecond are exhausted, the counter borrows the next milliseconds
+ *    up to the MAX_LEAD_MILLISEC, and the timestamp catches up with the clock when the load is gone.
+ *    While the counter is ahead of the clock, a thread reserves only one tick at once.
+ *  - If the lead is exhausted (or the clock goes backwards), the generator yields until the clock catches up.
+ *
+ *  The IDs of a generator are unique, and the IDs of a block (thread) are strictly increasing.
+ */
+class TBAG_API SnowflakeGenerator : private Noncopyable
+{
+public:
+    /** Number of the ticks reserved at once by a thread. */
+    TBAG_CONSTEXPR static uint64_t const BLOCK_SIZE = 64;
+
+    /** Maximum lead of the timestamp over the clock. */
+    TBAG_CONSTEXPR static uint64_t const MAX_LEAD_MILLISEC = 4;
+
+    /** Ticks reserved by a thread. Each thread must use its own block. */
+    struct Block
+    {
+        uint64_t next = 0;
+        uint64_t end  = 0;
+    };
+
+private:
+    uint64_t const EPOCH;
+    uint64_t const NODE;
+
+private:
+    /** The next free tick. */
+    std::atomic<uint64_t> _tick;
+
+public:
+    SnowflakeGenerator(uint64_t node = 0, uint64_t epoch = SNOWFLAKE_DEFAULT_EPOCH);
+    ~SnowflakeGenerator();
+
+public:
+    inline uint64_t epoch() const TBAG_NOEXCEPT
+    { return EPOCH; }
+    inline uint64_t node() const TBAG_NOEXCEPT
+    { return NODE; }
+
+private:
+    uint64_t getNowTick() const;
+
+    /**
+     * @param[in,out] count
+     *      Number of the ticks to reserve. It is shrunk to 1 if the counter is ahead of the clock.
+     */
+    uint64_t reserve(uint64_t & count);
+
+    inline SnowflakeId toId(uint64_t tick) const TBAG_NOEXCEPT
+    {
+        return ((tick >> SNOWFLAKE_SEQUENCE_BITS) << (SNOWFLAKE_NODE_BITS + SNOWFLAKE_SEQUENCE_BITS))
+               | (NODE << SNOWFLAKE_SEQUENCE_BITS)
+               | (tick & SNOWFLAKE_MAX_SEQUENCE);
+    }
+
+public:
+    /** Generate an ID from the shared counter. (a CAS for each call) */
+    SnowflakeId gen();
+
+    /** Generate an ID from the block of the calling thread. */
+    SnowflakeId gen(Block & block);
+
+public:
+    /** Unix time of the ID in milliseconds. */
+    inline uint64_t getTime(SnowflakeId id) const TBAG_NOEXCEPT
+    { return (id >> (SNOWFLAKE_NODE_BITS + SNOWFLAKE_SEQUENCE_BITS)) + EPOCH; }
+
+    inline static uint64_t getNode(SnowflakeId id) TBAG_NOEXCEPT
+    { return (id >> SNOWFLAKE_SEQUENCE_BITS) & SNOWFLAKE_MAX_NODE; }
+
+    inline static uint64_t getSequence(SnowflakeId id) TBAG_NOEXCEPT
+    { return id & SNOWFLAKE_MAX_SEQUENCE; }
+};
+
+/**
+ * Generate an ID from the process-wide generator. (node 0)
+ *
+ * @remarks
+ *  Lock-free, each thread uses its own block.
+ */
+TBAG_API SnowflakeId genSnowflakeId();
+
+} // namespace generator
+} // namespace id
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_ID_GENERATOR_SNOWFLAKEID_HPP__
+
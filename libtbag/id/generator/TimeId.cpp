@@ -3,10 +3,12 @@
  * @brief  TimeId class implementation.
  * @author zer0
  * @date   2016-07-26
+ * @date   2026-10-19 (Remove the spin-wait)
  */
 
 #include <libtbag/id/generator/TimeId.hpp>
-#include <thread>
+#include <algorithm>
+#include <atomic>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -20,18 +22,18 @@ static Id getTimeSinceEpochCount()
     return static_cast<Id>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
 }
 
-Id genTimeId(bool sleep_wait)
+Id genTimeId(bool UNUSED_PARAM(sleep_wait))
 {
-    Id id = getTimeSinceEpochCount();
-
-    // Prevent the same ID.
-    while (getTimeSinceEpochCount() == id) {
-        if (sleep_wait) {
-            std::this_thread::sleep_for(std::chrono::high_resolution_clock::duration(1));
-        }
-    }
-
-    return id;
+    // Prevent the same ID without waiting for the next tick of the clock:
+    // if the clock has not advanced (or other threads got there first), take the next count.
+    static std::atomic<Id> last(0);
+    auto const NOW = getTimeSinceEpochCount();
+    auto prev = last.load(std::memory_order_relaxed);
+    Id next;
+    do {
+        next = std::max(NOW, prev + 1);
+    } while (!last.compare_exchange_weak(prev, next, std::memory_order_relaxed));
+    return next;
 }
 
 } // namespace generator
@@ -3,6 +3,7 @@
  * @brief  TimeId class prototype.
  * @author zer0
  * @date   2016-07-26
+ * @date   2026-10-19 (Remove the spin-wait)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_ID_GENERATOR_TIMEID_HPP__
@@ -25,6 +26,18 @@ NAMESPACE_LIBTBAG_OPEN
 namespace id        {
 namespace generator {
 
+/**
+ * Generate the unique ID from the time since epoch.
+ *
+ * @param[in] sleep_wait
+ *      Unused. The IDs are unique without waiting for the clock.
+ *
+ * @remarks
+ *  The IDs are strictly increasing in the process. @n
+ *  If the clock has not advanced since the last ID, the last ID + 1 is returned.
+ *
+ * @see SnowflakeGenerator
+ */
 TBAG_API Id genTimeId(bool sleep_wait = false);
 
 } // namespace generator
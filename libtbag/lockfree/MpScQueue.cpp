@@ -0,0 +1,80 @@
+/**
+ * @file   MpScQueue.cpp
+ * @brief  MpScQueue class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/lockfree/MpScQueue.hpp>
+#include <cassert>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace lockfree {
+
+MpScQueue::MpScQueue() : _head(&_stub), _tail(&_stub)
+{
+    // EMPTY.
+}
+
+MpScQueue::~MpScQueue()
+{
+    // EMPTY.
+}
+
+void MpScQueue::push(Node * node) TBAG_NOEXCEPT
+{
+    assert(node != nullptr);
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node * prev = _head.exchange(node, std::memory_order_acq_rel);
+    // [WARNING] The consumer can not see the node until this point (serialization point).
+    prev->next.store(node, std::memory_order_release);
+}
+
+MpScQueue::Node * MpScQueue::pop() TBAG_NOEXCEPT
+{
+    Node * tail = _tail;
+    Node * next = tail->next.load(std::memory_order_acquire);
+
+    if (tail == &_stub) {
+        if (next == nullptr) {
+            return nullptr; // Empty queue.
+        }
+        _tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next != nullptr) {
+        _tail = next;
+        return tail;
+    }
+
+    Node * head = _head.load(std::memory_order_acquire);
+    if (tail != head) {
+        return nullptr; // The producer is in the middle of the push operation.
+    }
+
+    push(&_stub);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next != nullptr) {
+        _tail = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+bool MpScQueue::empty() const TBAG_NOEXCEPT
+{
+    Node * tail = _tail;
+    return tail == &_stub && tail->next.load(std::memory_order_acquire) == nullptr;
+}
+
+} // namespace lockfree
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
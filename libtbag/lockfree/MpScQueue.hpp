@@ -0,0 +1,109 @@
+/**
+ * @file   MpScQueue.hpp
+ * @brief  MpScQueue class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Pad the members instead of the alignment)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_LOCKFREE_MPSCQUEUE_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_LOCKFREE_MPSCQUEUE_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+
+#include <cstddef>
+#include <atomic>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace lockfree {
+
+/**
+ * MpScQueue class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Unbounded, Intrusive, Many-Producer, Single-consumer Queue. @n
+ *  (Dmitry Vyukov's non-blocking MPSC node based queue)
+ *
+ * @warning
+ *  - The queue does not own the nodes. @n
+ *  - A node can not be pushed again until it is popped. @n
+ *  - Only one thread can call the pop() method.
+ *
+ * @remarks
+ *  The producers and the consumer are separated by the padding of the cache line size,
+ *  not by the alignment of the members. (The queue is allocated by the plain <code>new</code>)
+ */
+class TBAG_API MpScQueue : private Noncopyable
+{
+public:
+    /**
+     * Intrusive queue node.
+     */
+    struct Node
+    {
+        std::atomic<Node*> next;
+
+        Node() : next(nullptr)
+        { /* EMPTY. */ }
+    };
+
+public:
+    TBAG_CONSTEXPR static std::size_t const CACHE_LINE_SIZE = TBAG_ALIGNMENT_DEFAULT_CACHE_LINE_SIZE;
+
+private:
+    char _padding0[CACHE_LINE_SIZE];
+
+    /** Written by the producers. */
+    std::atomic<Node*> _head;
+    char _padding1[CACHE_LINE_SIZE - sizeof(std::atomic<Node*>)];
+
+    /** Written by the consumer. */
+    Node * _tail;
+    Node _stub;
+    char _padding2[CACHE_LINE_SIZE - sizeof(Node*) - sizeof(Node)];
+
+public:
+    MpScQueue();
+    ~MpScQueue();
+
+public:
+    /**
+     * Push the node. It's safe to call this method from any thread.
+     */
+    void push(Node * node) TBAG_NOEXCEPT;
+
+    /**
+     * Pop the node. Only the consumer thread can call this method.
+     *
+     * @return
+     *  If the queue is empty or the producer is in the middle of the push operation, it returns nullptr.
+     */
+    Node * pop() TBAG_NOEXCEPT;
+
+    /**
+     * Check the queue is empty. Only the consumer thread can call this method.
+     */
+    bool empty() const TBAG_NOEXCEPT;
+};
+
+} // namespace lockfree
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_LOCKFREE_MPSCQUEUE_HPP__
+
@@ -0,0 +1,653 @@
+/**
+ * @file   BoxPubSub.cpp
+ * @brief  BoxPubSub class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Flush the lingering batches in the background)
+ */
+
+#include <libtbag/mq/BoxPubSub.hpp>
+#include <libtbag/archive/Zip.hpp>
+#include <libtbag/bitwise/Endian.hpp>
+#include <libtbag/log/Log.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace mq {
+
+TBAG_CONSTEXPR static char const * const INPROC_PREFIX = "inproc://";
+
+static bool isInprocUrl(std::string const & url)
+{
+    return url.compare(0, strlen(INPROC_PREFIX), INPROC_PREFIX) == 0;
+}
+
+static void writeU32(uint8_t * dest, uint32_t value)
+{
+    auto const NETWORK = libtbag::bitwise::toNetwork(value);
+    memcpy(dest, &NETWORK, sizeof(NETWORK));
+}
+
+static uint32_t readU32(uint8_t const * src)
+{
+    uint32_t network;
+    memcpy(&network, src, sizeof(network));
+    return libtbag::bitwise::toHost(network);
+}
+
+// ------------------------
+// In-process subscriber hub
+// ------------------------
+
+/**
+ * Subscribers of the in-process fast path. (Key is the url)
+ *
+ * @remarks
+ *  Lock order: hub -> subscriber.
+ */
+struct InprocHub
+{
+    using Subscribers = std::multimap<std::string, BoxSubscriber*>;
+
+    std::mutex mutex;
+    Subscribers subscribers;
+};
+
+static InprocHub & getInprocHub()
+{
+    static InprocHub hub;
+    return hub;
+}
+
+// -----------------------
+// BoxBatch implementation
+// -----------------------
+
+void BoxBatch::clear()
+{
+    payload.clear();
+    sizes.clear();
+}
+
+Err BoxBatch::append(Builder & builder, Box const & box)
+{
+    auto const CODE = box.encode(builder);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    auto const * begin = builder.point();
+    auto const SIZE = builder.size();
+    if (empty()) {
+        first_time = std::chrono::steady_clock::now();
+    }
+    payload.insert(payload.end(), begin, begin + SIZE);
+    sizes.push_back(static_cast<uint32_t>(SIZE));
+    return E_SUCCESS;
+}
+
+Err BoxBatch::encode(std::string const & topic, NngMsg & msg, int compression_level,
+                     std::size_t compression_threshold) const
+{
+    libtbag::util::Buffer compressed;
+    uint8_t flags = 0;
+    if (compression_level > 0 && payload.size() > compression_threshold) {
+        auto const CODE = libtbag::archive::encode((char const *)payload.data(), payload.size(),
+                                                   compressed, compression_level);
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+        // Keep the raw payload if the compression does not help.
+        if (compressed.size() < payload.size()) {
+            flags |= BBF_COMPRESSED;
+        }
+    }
+
+    auto const * body_data = (flags & BBF_COMPRESSED)
+                             ? (uint8_t const *)compressed.data()
+                             : payload.data();
+    auto const BODY_SIZE = (flags & BBF_COMPRESSED) ? compressed.size() : payload.size();
+    auto const TOPIC_SIZE = topic.size() + 1; // Include the null terminator.
+    auto const TOTAL_SIZE = TOPIC_SIZE + HEADER_SIZE + (sizes.size() * sizeof(uint32_t)) + BODY_SIZE;
+
+    auto const CODE = msg.exists() ? msg.realloc(TOTAL_SIZE) : msg.alloc(TOTAL_SIZE);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+
+    auto * cursor = static_cast<uint8_t*>(msg.body());
+    memcpy(cursor, topic.c_str(), TOPIC_SIZE);
+    cursor += TOPIC_SIZE;
+
+    writeU32(cursor, MAGIC);
+    cursor[4] = VERSION;
+    cursor[5] = flags;
+    cursor[6] = 0;
+    cursor[7] = 0;
+    writeU32(cursor +  8, static_cast<uint32_t>(sizes.size()));
+    writeU32(cursor + 12, static_cast<uint32_t>(payload.size()));
+    cursor += HEADER_SIZE;
+
+    for (auto const & size : sizes) {
+        writeU32(cursor, size);
+        cursor += sizeof(uint32_t);
+    }
+    if (BODY_SIZE > 0) {
+        memcpy(cursor, body_data, BODY_SIZE);
+    }
+    return E_SUCCESS;
+}
+
+Err BoxBatch::decode(void const * data, std::size_t size, Parser const & parser,
+                     std::string & topic, Boxes & boxes)
+{
+    if (data == nullptr || size == 0) {
+        return E_ILLARGS;
+    }
+
+    auto const * begin = static_cast<uint8_t const *>(data);
+    auto const * end = begin + size;
+    auto const * terminator = static_cast<uint8_t const *>(memchr(begin, '\0', size));
+    if (terminator == nullptr) {
+        return E_PARSING;
+    }
+    topic.assign((char const *)begin, (char const *)terminator);
+
+    auto const * cursor = terminator + 1;
+    if (static_cast<std::size_t>(end - cursor) < HEADER_SIZE) {
+        return E_PARSING;
+    }
+    if (readU32(cursor) != MAGIC) {
+        return E_PARSING;
+    }
+    if (cursor[4] != VERSION) {
+        return E_VERSION;
+    }
+    auto const FLAGS = cursor[5];
+    auto const COUNT = readU32(cursor + 8);
+    auto const RAW_SIZE = readU32(cursor + 12);
+    cursor += HEADER_SIZE;
+
+    if (static_cast<std::size_t>(end - cursor) < COUNT * sizeof(uint32_t)) {
+        return E_PARSING;
+    }
+    auto const * size_cursor = cursor;
+    cursor += COUNT * sizeof(uint32_t);
+
+    libtbag::util::Buffer decompressed;
+    auto const * payload_cursor = cursor;
+    auto const * payload_end = end;
+    if (FLAGS & BBF_COMPRESSED) {
+        auto const COMPRESSED_SIZE = static_cast<std::size_t>(end - cursor);
+        if (RAW_SIZE > MAX_PAYLOAD_SIZE || RAW_SIZE > COMPRESSED_SIZE * MAX_COMPRESSION_RATIO) {
+            return E_PARSING;
+        }
+        decompressed.resize(RAW_SIZE);
+        std::size_t decompressed_size = 0;
+        auto const CODE = libtbag::archive::decode((char const *)cursor, COMPRESSED_SIZE,
+                                                   decompressed.data(), decompressed.size(),
+                                                   &decompressed_size);
+        if (CODE == E_SMALLBUF) {
+            return E_PARSING;
+        }
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+        payload_cursor = (uint8_t const *)decompressed.data();
+        payload_end = payload_cursor + decompressed_size;
+    }
+    if (static_cast<std::size_t>(payload_end - payload_cursor) != RAW_SIZE) {
+        return E_PARSING;
+    }
+
+    boxes.reserve(boxes.size() + COUNT);
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        auto const PACKET_SIZE = readU32(size_cursor + (i * sizeof(uint32_t)));
+        if (static_cast<std::size_t>(payload_end - payload_cursor) < PACKET_SIZE) {
+            return E_PARSING;
+        }
+        Box box;
+        auto const CODE = box.decode(payload_cursor, PACKET_SIZE, parser);
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+        boxes.push_back(std::move(box));
+        payload_cursor += PACKET_SIZE;
+    }
+    return E_SUCCESS;
+}
+
+// ---------------------------
+// BoxPublisher implementation
+// ---------------------------
+
+BoxPublisher::BoxPublisher() : _fast_path(false), _opened(false), _linger_exit(false)
+{
+    // EMPTY.
+}
+
+BoxPublisher::~BoxPublisher()
+{
+    close();
+}
+
+Err BoxPublisher::open(std::string const & url, Options const & options)
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (_opened) {
+        return E_ALREADY;
+    }
+
+    _options = options;
+    _url = url;
+    _fast_path = options.inproc_fast_path && isInprocUrl(url);
+    _batches.clear();
+
+    if (!_fast_path) {
+        auto const OPEN_CODE = _socket.open(NngSocket::SocketType::ST_PUB0);
+        if (isFailure(OPEN_CODE)) {
+            tDLogE("BoxPublisher::open() Socket open error: {}", OPEN_CODE);
+            return OPEN_CODE;
+        }
+        auto const LISTEN_CODE = _socket.listen(url);
+        if (isFailure(LISTEN_CODE)) {
+            tDLogE("BoxPublisher::open() Listen error: {}", LISTEN_CODE);
+            _socket.close();
+            return LISTEN_CODE;
+        }
+        if (options.linger_ms > 0) {
+            _linger_exit = false;
+            _linger_thread = std::thread([this](){ runLinger(); });
+        }
+    }
+
+    _opened = true;
+    return E_SUCCESS;
+}
+
+Err BoxPublisher::close()
+{
+    std::thread linger_thread;
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        if (!_opened) {
+            return E_ILLSTATE;
+        }
+        _opened = false;
+        _linger_exit = true;
+        linger_thread = std::move(_linger_thread);
+    }
+    _linger_signal.notify_all();
+    if (linger_thread.joinable()) {
+        linger_thread.join();
+    }
+
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_fast_path) {
+        for (auto & batch : _batches) {
+            flushBatch(batch.first, batch.second);
+        }
+        _socket.close();
+    }
+    _batches.clear();
+    return E_SUCCESS;
+}
+
+Err BoxPublisher::flushBatch(std::string const & topic, BoxBatch & batch)
+{
+    if (batch.empty()) {
+        return E_SUCCESS;
+    }
+
+    NngMsg msg;
+    auto const ENCODE_CODE = batch.encode(topic, msg, _options.compression_level,
+                                          _options.compression_threshold);
+    batch.clear();
+    if (isFailure(ENCODE_CODE)) {
+        tDLogE("BoxPublisher::flushBatch() Encode error: {}", ENCODE_CODE);
+        return ENCODE_CODE;
+    }
+    return _socket.send(msg);
+}
+
+std::chrono::steady_clock::time_point BoxPublisher::flushLingeringBatches(Err * result)
+{
+    auto const NOW = std::chrono::steady_clock::now();
+    auto const LINGER = std::chrono::milliseconds(_options.linger_ms);
+    auto next = std::chrono::steady_clock::time_point::max();
+    for (auto & batch : _batches) {
+        if (batch.second.empty()) {
+            continue;
+        }
+        auto const DEADLINE = batch.second.first_time + LINGER;
+        if (DEADLINE <= NOW) {
+            auto const CODE = flushBatch(batch.first, batch.second);
+            if (isFailure(CODE) && result != nullptr) {
+                *result = CODE;
+            }
+        } else {
+            next = std::min(next, DEADLINE);
+        }
+    }
+    return next;
+}
+
+void BoxPublisher::runLinger()
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+    while (!_linger_exit) {
+        Err code = E_SUCCESS;
+        auto const NEXT = flushLingeringBatches(&code);
+        if (isFailure(code)) {
+            tDLogE("BoxPublisher::runLinger() Flush error: {}", code);
+        }
+        if (NEXT == std::chrono::steady_clock::time_point::max()) {
+            _linger_signal.wait(guard);
+        } else {
+            _linger_signal.wait_until(guard, NEXT);
+        }
+    }
+}
+
+Err BoxPublisher::publish(std::string const & topic, Box const & box)
+{
+    if (_fast_path) {
+        if (!_opened) {
+            return E_ILLSTATE;
+        }
+        auto & hub = getInprocHub();
+        std::lock_guard<std::mutex> guard(hub.mutex);
+        auto const RANGE = hub.subscribers.equal_range(_url);
+        for (auto itr = RANGE.first; itr != RANGE.second; ++itr) {
+            assert(itr->second != nullptr);
+            if (itr->second->match(topic)) {
+                itr->second->push(topic, box);
+            }
+        }
+        return E_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_opened) {
+        return E_ILLSTATE;
+    }
+
+    auto & batch = _batches[topic];
+    auto const APPEND_CODE = batch.append(_builder, box);
+    if (isFailure(APPEND_CODE)) {
+        return APPEND_CODE;
+    }
+
+    if (_options.linger_ms <= 0 ||
+        batch.count() >= _options.max_batch_count ||
+        batch.bytes() >= _options.max_batch_bytes) {
+        return flushBatch(topic, batch);
+    }
+    if (batch.count() == 1) {
+        // The new deadline of the linger thread.
+        _linger_signal.notify_one();
+    }
+
+    Err result = E_SUCCESS;
+    flushLingeringBatches(&result);
+    return result;
+}
+
+Err BoxPublisher::flush(std::string const & topic)
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_opened) {
+        return E_ILLSTATE;
+    }
+    auto itr = _batches.find(topic);
+    if (itr == _batches.end()) {
+        return E_SUCCESS;
+    }
+    return flushBatch(itr->first, itr->second);
+}
+
+Err BoxPublisher::flush()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_opened) {
+        return E_ILLSTATE;
+    }
+    Err result = E_SUCCESS;
+    for (auto & batch : _batches) {
+        auto const CODE = flushBatch(batch.first, batch.second);
+        if (isFailure(CODE)) {
+            result = CODE;
+        }
+    }
+    return result;
+}
+
+// ----------------------------
+// BoxSubscriber implementation
+// ----------------------------
+
+BoxSubscriber::BoxSubscriber() : _fast_path(false), _opened(false),
+                                 _recv_timeout(NngSocket::DURATION_DEFAULT),
+                                 _default_recv_timeout(NngSocket::DURATION_INFINITE)
+{
+    // EMPTY.
+}
+
+BoxSubscriber::~BoxSubscriber()
+{
+    close();
+}
+
+nng_duration BoxSubscriber::getDefaultRecvTimeout() const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    return _default_recv_timeout;
+}
+
+void BoxSubscriber::setDefaultRecvTimeout(nng_duration timeout)
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    _default_recv_timeout = timeout;
+}
+
+Err BoxSubscriber::open(std::string const & url, bool inproc_fast_path)
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+    if (_opened) {
+        return E_ALREADY;
+    }
+
+    _url = url;
+    _fast_path = inproc_fast_path && isInprocUrl(url);
+    _recv_timeout = NngSocket::DURATION_DEFAULT;
+    _prefixes.clear();
+    _items.clear();
+
+    if (_fast_path) {
+        _opened = true;
+        guard.unlock();
+
+        auto & hub = getInprocHub();
+        std::lock_guard<std::mutex> hub_guard(hub.mutex);
+        hub.subscribers.emplace(url, this);
+        return E_SUCCESS;
+    }
+
+    auto const OPEN_CODE = _socket.open(NngSocket::SocketType::ST_SUB0);
+    if (isFailure(OPEN_CODE)) {
+        tDLogE("BoxSubscriber::open() Socket open error: {}", OPEN_CODE);
+        return OPEN_CODE;
+    }
+    auto const DIAL_CODE = _socket.dial(url);
+    if (isFailure(DIAL_CODE)) {
+        tDLogE("BoxSubscriber::open() Dial error: {}", DIAL_CODE);
+        _socket.close();
+        return DIAL_CODE;
+    }
+    _opened = true;
+    return E_SUCCESS;
+}
+
+Err BoxSubscriber::close()
+{
+    if (_fast_path) {
+        auto & hub = getInprocHub();
+        std::lock_guard<std::mutex> hub_guard(hub.mutex);
+        auto const RANGE = hub.subscribers.equal_range(_url);
+        for (auto itr = RANGE.first; itr != RANGE.second; ++itr) {
+            if (itr->second == this) {
+                hub.subscribers.erase(itr);
+                break;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_opened) {
+        return E_ILLSTATE;
+    }
+    if (!_fast_path) {
+        _socket.close();
+    }
+    _opened = false;
+    _signal.notify_all();
+    return E_SUCCESS;
+}
+
+Err BoxSubscriber::subscribe(std::string const & prefix)
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_opened) {
+        return E_ILLSTATE;
+    }
+    if (std::find(_prefixes.begin(), _prefixes.end(), prefix) != _prefixes.end()) {
+        return E_ALREADY;
+    }
+    if (!_fast_path) {
+        auto const CODE = nng_code_err(nng_setopt(_socket.getSocket(), NNG_OPT_SUB_SUBSCRIBE,
+                                                  prefix.data(), prefix.size()));
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+    }
+    _prefixes.push_back(prefix);
+    return E_SUCCESS;
+}
+
+Err BoxSubscriber::unsubscribe(std::string const & prefix)
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!_opened) {
+        return E_ILLSTATE;
+    }
+    auto itr = std::find(_prefixes.begin(), _prefixes.end(), prefix);
+    if (itr == _prefixes.end()) {
+        return E_NFOUND;
+    }
+    if (!_fast_path) {
+        auto const CODE = nng_code_err(nng_setopt(_socket.getSocket(), NNG_OPT_SUB_UNSUBSCRIBE,
+                                                  prefix.data(), prefix.size()));
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+    }
+    _prefixes.erase(itr);
+    return E_SUCCESS;
+}
+
+bool BoxSubscriber::match(std::string const & topic) const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    for (auto const & prefix : _prefixes) {
+        if (topic.compare(0, prefix.size(), prefix) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void BoxSubscriber::push(std::string const & topic, Box const & box)
+{
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        _items.push_back(Item{topic, box});
+    }
+    _signal.notify_one();
+}
+
+Err BoxSubscriber::recv(std::string & topic, Box & box, nng_duration timeout)
+{
+    std::unique_lock<std::mutex> guard(_mutex);
+    if (!_opened) {
+        return E_ILLSTATE;
+    }
+    if (timeout < 0 && timeout != NngSocket::DURATION_INFINITE) {
+        timeout = _default_recv_timeout;
+        if (timeout < 0) {
+            timeout = NngSocket::DURATION_INFINITE;
+        }
+    }
+
+    if (_items.empty()) {
+        if (_fast_path) {
+            auto const READY = [&]() -> bool { return !_items.empty() || !_opened; };
+            if (timeout == NngSocket::DURATION_INFINITE) {
+                _signal.wait(guard, READY);
+            } else if (!_signal.wait_for(guard, std::chrono::milliseconds(timeout), READY)) {
+                return E_TIMEOUT;
+            }
+            if (_items.empty()) {
+                return E_ECANCELED;
+            }
+        } else {
+            if (timeout != _recv_timeout) {
+                auto const CODE = _socket.setRecvTimeout(timeout);
+                if (isFailure(CODE)) {
+                    return CODE;
+                }
+                _recv_timeout = timeout;
+            }
+            guard.unlock();
+
+            NngMsg msg;
+            auto const RECV_CODE = _socket.recv(msg);
+            if (isFailure(RECV_CODE)) {
+                return RECV_CODE;
+            }
+
+            std::string msg_topic;
+            BoxBatch::Boxes boxes;
+            auto const DECODE_CODE = BoxBatch::decode(msg.body(), msg.size(), _parser, msg_topic, boxes);
+            if (isFailure(DECODE_CODE)) {
+                tDLogE("BoxSubscriber::recv() Decode error: {}", DECODE_CODE);
+                return DECODE_CODE;
+            }
+
+            guard.lock();
+            for (auto & cursor : boxes) {
+                _items.push_back(Item{msg_topic, std::move(cursor)});
+            }
+            if (_items.empty()) {
+                return E_NFOUND;
+            }
+        }
+    }
+
+    assert(!_items.empty());
+    topic = std::move(_items.front().topic);
+    box = std::move(_items.front().box);
+    _items.pop_front();
+    return E_SUCCESS;
+}
+
+} // namespace mq
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,327 @@
+/**
+ * @file   BoxPubSub.hpp
+ * @brief  BoxPubSub class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Flush the lingering batches in the background)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_MQ_BOXPUBSUB_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_MQ_BOXPUBSUB_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/mq/NngSocket.hpp>
+#include <libtbag/mq/NngMsg.hpp>
+#include <libtbag/box/Box.hpp>
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace mq {
+
+/**
+ * Box batch message format.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  All integers are stored in the network byte order.
+ *  <pre>
+ *   [topic ...][0x00]
+ *   [magic:u32][version:u8][flags:u8][reserved:u16]
+ *   [count:u32][raw payload size:u32]
+ *   [packet size:u32] x count
+ *   [payload ...] (Concatenated BoxPacket buffers; zlib encoded if BBF_COMPRESSED)
+ *  </pre>
+ *  The topic is placed at the beginning of the message, @n
+ *  so the nng SUB socket can filter the messages by the topic prefix.
+ */
+struct TBAG_API BoxBatch
+{
+    TBAG_CONSTEXPR static uint32_t const MAGIC = 0x54424258; // 'TBBX'
+    TBAG_CONSTEXPR static uint8_t const VERSION = 1;
+    TBAG_CONSTEXPR static uint8_t const BBF_COMPRESSED = 0x01;
+    TBAG_CONSTEXPR static std::size_t const HEADER_SIZE = 16;
+
+    /** Maximum raw payload size of the message. Larger messages are rejected before the decompression. */
+    TBAG_CONSTEXPR static std::size_t const MAX_PAYLOAD_SIZE = 256 * 1024 * 1024;
+
+    /** Maximum compression ratio of the zlib. */
+    TBAG_CONSTEXPR static std::size_t const MAX_COMPRESSION_RATIO = 1032;
+
+    using Box = libtbag::box::Box;
+    using Boxes = std::vector<Box>;
+    using Builder = libtbag::box::BoxPacketBuilder;
+    using Parser = libtbag::box::BoxPacketParser;
+    using Payload = std::vector<uint8_t>;
+    using Sizes = std::vector<uint32_t>;
+
+    Payload payload;
+    Sizes sizes;
+
+    std::chrono::steady_clock::time_point first_time;
+
+    inline bool empty() const TBAG_NOEXCEPT
+    { return sizes.empty(); }
+    inline std::size_t count() const TBAG_NOEXCEPT
+    { return sizes.size(); }
+    inline std::size_t bytes() const TBAG_NOEXCEPT
+    { return payload.size(); }
+
+    void clear();
+
+    /** Encode & append the box to the batch. */
+    Err append(Builder & builder, Box const & box);
+
+    /**
+     * Encode the batch to the nng message.
+     *
+     * @param[in] compression_level
+     *  If 0, the payload is not compressed.
+     */
+    Err encode(std::string const & topic, NngMsg & msg, int compression_level = 0,
+               std::size_t compression_threshold = 0) const;
+
+    /**
+     * Decode the nng message.
+     *
+     * @remarks
+     *  The compressed payload is inflated into the buffer of the raw payload size,
+     *  and the message is rejected as soon as the output exceeds it.
+     */
+    static Err decode(void const * data, std::size_t size, Parser const & parser,
+                      std::string & topic, Boxes & boxes);
+};
+
+/**
+ * BoxPublisher class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Publish the boxes with the topic routing. @n
+ *  Small boxes of the same topic are batched into one nng message. @n
+ *  If the url starts with 'inproc://', the box is handed over to the subscribers @n
+ *  of the same process by the reference count (without serialization).
+ *
+ * @warning
+ *  In the in-process fast path, publisher and subscribers share the same box memory.
+ */
+class TBAG_API BoxPublisher : private Noncopyable
+{
+public:
+    using Box = libtbag::box::Box;
+    using Builder = libtbag::box::BoxPacketBuilder;
+    using Batches = std::map<std::string, BoxBatch>;
+
+public:
+    struct Options
+    {
+        /** Flush the batch if the number of boxes reaches this value. */
+        std::size_t max_batch_count = 64;
+
+        /** Flush the batch if the encoded bytes reaches this value. */
+        std::size_t max_batch_bytes = 64 * 1024;
+
+        /**
+         * Flush the batch if the first box is older than this value. (milliseconds) @n
+         * The lingering batches are flushed by the background thread,
+         * so the idle topic does not hold the boxes. If 0 or less, the box is sent immediately.
+         */
+        int linger_ms = 1;
+
+        /** zlib level (1~9) of the batch. If 0, no compression. */
+        int compression_level = 0;
+
+        /** Compress only the batch larger than this value. */
+        std::size_t compression_threshold = 1024;
+
+        /** Use the in-process fast path for the 'inproc://' url. */
+        bool inproc_fast_path = true;
+
+        Options() { /* EMPTY. */ }
+        ~Options() { /* EMPTY. */ }
+    };
+
+private:
+    Options _options;
+    NngSocket _socket;
+    std::string _url;
+    bool _fast_path;
+    std::atomic_bool _opened;
+
+private:
+    mutable std::mutex _mutex;
+    Builder _builder;
+    Batches _batches;
+
+private:
+    std::condition_variable _linger_signal;
+    std::thread _linger_thread;
+    bool _linger_exit;
+
+public:
+    BoxPublisher();
+    ~BoxPublisher();
+
+public:
+    inline bool isOpened() const TBAG_NOEXCEPT
+    { return _opened; }
+    inline bool isFastPath() const TBAG_NOEXCEPT
+    { return _fast_path; }
+
+    /** The socket is not opened in the in-process fast path. */
+    inline NngSocket & socket() TBAG_NOEXCEPT
+    { return _socket; }
+
+public:
+    Err open(std::string const & url, Options const & options = Options());
+    Err close();
+
+private:
+    Err flushBatch(std::string const & topic, BoxBatch & batch);
+
+    /**
+     * Flush the batches which are older than the linger time.
+     *
+     * @return
+     *  The earliest deadline of the remaining batches.
+     */
+    std::chrono::steady_clock::time_point flushLingeringBatches(Err * result = nullptr);
+
+    void runLinger();
+
+public:
+    /**
+     * Publish the box.
+     *
+     * @remarks
+     *  The box may be sent later, within the linger time. @n
+     *  Call flush() to send the pending boxes immediately.
+     */
+    Err publish(std::string const & topic, Box const & box);
+
+    Err flush(std::string const & topic);
+    Err flush();
+};
+
+/**
+ * BoxSubscriber class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+class TBAG_API BoxSubscriber : private Noncopyable
+{
+public:
+    friend class BoxPublisher;
+
+public:
+    using Box = libtbag::box::Box;
+    using Parser = libtbag::box::BoxPacketParser;
+
+public:
+    struct Item
+    {
+        std::string topic;
+        Box box;
+    };
+
+    using Items = std::deque<Item>;
+    using Prefixes = std::vector<std::string>;
+
+private:
+    NngSocket _socket;
+    std::string _url;
+    bool _fast_path;
+    std::atomic_bool _opened;
+
+private:
+    mutable std::mutex _mutex;
+    std::condition_variable _signal;
+    Prefixes _prefixes;
+    Items _items;
+    Parser _parser;
+    nng_duration _recv_timeout;
+    nng_duration _default_recv_timeout;
+
+public:
+    BoxSubscriber();
+    ~BoxSubscriber();
+
+public:
+    inline bool isOpened() const TBAG_NOEXCEPT
+    { return _opened; }
+    inline bool isFastPath() const TBAG_NOEXCEPT
+    { return _fast_path; }
+
+    /** The socket is not opened in the in-process fast path. */
+    inline NngSocket & socket() TBAG_NOEXCEPT
+    { return _socket; }
+
+public:
+    /** Timeout of the recv() with the NngSocket::DURATION_DEFAULT. */
+    nng_duration getDefaultRecvTimeout() const;
+    void setDefaultRecvTimeout(nng_duration timeout);
+
+public:
+    Err open(std::string const & url, bool inproc_fast_path = true);
+    Err close();
+
+public:
+    /**
+     * Subscribe the topic prefix. The empty prefix matches all topics.
+     */
+    Err subscribe(std::string const & prefix);
+    Err unsubscribe(std::string const & prefix);
+
+private:
+    bool match(std::string const & topic) const;
+    void push(std::string const & topic, Box const & box);
+
+public:
+    /**
+     * Receive the box.
+     *
+     * @param[out] topic
+     *  Topic of the box.
+     * @param[out] box
+     *  Received box.
+     * @param[in] timeout
+     *  Milliseconds. If NngSocket::DURATION_INFINITE, it waits forever. @n
+     *  The other negative values (e.g. NngSocket::DURATION_DEFAULT) use the default timeout.
+     *  (See setDefaultRecvTimeout())
+     */
+    Err recv(std::string & topic, Box & box, nng_duration timeout = NngSocket::DURATION_INFINITE);
+};
+
+} // namespace mq
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_MQ_BOXPUBSUB_HPP__
+
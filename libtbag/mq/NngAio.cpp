@@ -0,0 +1,137 @@
+/**
+ * @file   NngAio.cpp
+ * @brief  NngAio class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/mq/NngAio.hpp>
+#include <libtbag/log/Log.hpp>
+
+#include <cassert>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace mq {
+
+NngAio::NngAio() : NngAio(OnComplete())
+{
+    // EMPTY.
+}
+
+NngAio::NngAio(OnComplete const & cb) : _aio(nullptr), _complete_cb(cb), _operation(Operation::OP_NONE)
+{
+    auto const CODE = nng_code_err(nng_aio_alloc(&_aio, &__aio_cb__, this));
+    if (isFailure(CODE)) {
+        tDLogE("NngAio::NngAio() nng_aio_alloc() error: {}", CODE);
+        _aio = nullptr;
+    }
+}
+
+NngAio::~NngAio()
+{
+    if (_aio != nullptr) {
+        nng_aio_stop(_aio);
+        NngMsg remain(nng_aio_get_msg(_aio));
+        nng_aio_set_msg(_aio, nullptr);
+        nng_aio_free(_aio);
+        _aio = nullptr;
+    }
+}
+
+void NngAio::__aio_cb__(void * arg)
+{
+    auto * aio = static_cast<NngAio*>(arg);
+    assert(aio != nullptr);
+    assert(aio->_aio != nullptr);
+
+    auto const CODE = nng_code_err(nng_aio_result(aio->_aio));
+    auto const OPERATION = aio->_operation.exchange(Operation::OP_NONE);
+    if (OPERATION == Operation::OP_SEND && isSuccess(CODE)) {
+        // On success, the message is owned by the socket.
+        nng_aio_set_msg(aio->_aio, nullptr);
+    }
+
+    // [WARNING] The operation flag is cleared before the callback,
+    // so the next operation can be started in the callback.
+    aio->onComplete(CODE);
+}
+
+Err NngAio::begin(Operation op)
+{
+    if (_aio == nullptr) {
+        return E_ILLSTATE;
+    }
+    auto expected = Operation::OP_NONE;
+    if (!_operation.compare_exchange_strong(expected, op)) {
+        return E_ALREADY;
+    }
+    return E_SUCCESS;
+}
+
+void NngAio::setTimeout(nng_duration ms)
+{
+    assert(exists());
+    nng_aio_set_timeout(_aio, ms);
+}
+
+void NngAio::wait()
+{
+    assert(exists());
+    nng_aio_wait(_aio);
+}
+
+void NngAio::cancel()
+{
+    assert(exists());
+    nng_aio_cancel(_aio);
+}
+
+void NngAio::stop()
+{
+    assert(exists());
+    nng_aio_stop(_aio);
+}
+
+Err NngAio::result() const
+{
+    assert(exists());
+    return nng_code_err(nng_aio_result(_aio));
+}
+
+std::size_t NngAio::count() const
+{
+    assert(exists());
+    return nng_aio_count(_aio);
+}
+
+void NngAio::setMsg(NngMsg && msg)
+{
+    assert(exists());
+    NngMsg remain(nng_aio_get_msg(_aio));
+    nng_aio_set_msg(_aio, msg.release());
+}
+
+NngMsg NngAio::takeMsg()
+{
+    assert(exists());
+    NngMsg result(nng_aio_get_msg(_aio));
+    nng_aio_set_msg(_aio, nullptr);
+    return result;
+}
+
+void NngAio::onComplete(Err code)
+{
+    if (_complete_cb) {
+        _complete_cb(code);
+    }
+}
+
+} // namespace mq
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
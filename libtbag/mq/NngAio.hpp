@@ -0,0 +1,138 @@
+/**
+ * @file   NngAio.hpp
+ * @brief  NngAio class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_MQ_NNGAIO_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_MQ_NNGAIO_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/mq/NngBypass.hpp>
+#include <libtbag/mq/NngMsg.hpp>
+
+#include <cstddef>
+#include <atomic>
+#include <functional>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace mq {
+
+/**
+ * NngAio class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Reusable asynchronous I/O handle of the nng. @n
+ *  The completion callback is called on the nng worker thread, @n
+ *  so one thread can drive many sockets without blocking.
+ *
+ * @warning
+ *  - Only one operation can be in progress at a time. @n
+ *  - Do not destroy this object in the completion callback.
+ */
+class TBAG_API NngAio : private Noncopyable
+{
+public:
+    enum class Operation
+    {
+        OP_NONE = 0,
+        OP_SEND,
+        OP_RECV,
+    };
+
+public:
+    using OnComplete = std::function<void(Err)>;
+
+private:
+    nng_aio * _aio;
+    OnComplete _complete_cb;
+    std::atomic<Operation> _operation;
+
+public:
+    NngAio();
+    explicit NngAio(OnComplete const & cb);
+    virtual ~NngAio();
+
+private:
+    static void __aio_cb__(void * arg);
+
+public:
+    inline bool exists() const TBAG_NOEXCEPT
+    { return _aio != nullptr; }
+
+    inline operator bool() const TBAG_NOEXCEPT
+    { return exists(); }
+
+    inline nng_aio * get() const TBAG_NOEXCEPT
+    { return _aio; }
+
+    inline Operation getOperation() const TBAG_NOEXCEPT
+    { return _operation.load(); }
+
+    inline bool isBusy() const TBAG_NOEXCEPT
+    { return _operation.load() != Operation::OP_NONE; }
+
+public:
+    /**
+     * Mark the operation before starting the asynchronous I/O.
+     *
+     * @return
+     *  If another operation is in progress, it returns E_ALREADY.
+     */
+    Err begin(Operation op);
+
+public:
+    void setTimeout(nng_duration ms);
+
+    /** Wait for the operation to complete. (like std::future::wait) */
+    void wait();
+
+    /** Cancel the operation. The completion callback is called with E_ECANCELED. */
+    void cancel();
+
+    /** Cancel the operation and wait for the completion callback. */
+    void stop();
+
+public:
+    Err result() const;
+    std::size_t count() const;
+
+public:
+    /** Transfer the ownership of the message to this aio. */
+    void setMsg(NngMsg && msg);
+
+    /**
+     * Take the ownership of the message from this aio.
+     *
+     * @remarks
+     *  Use it after the recv operation succeeds or the send operation fails.
+     */
+    NngMsg takeMsg();
+
+public:
+    virtual void onComplete(Err code);
+};
+
+} // namespace mq
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_MQ_NNGAIO_HPP__
+
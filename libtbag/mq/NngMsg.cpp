@@ -0,0 +1,278 @@
+/**
+ * @file   NngMsg.cpp
+ * @brief  NngMsg class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/mq/NngMsg.hpp>
+#include <libtbag/log/Log.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace mq {
+
+NngMsg::NngMsg() TBAG_NOEXCEPT : _msg(nullptr)
+{
+    // EMPTY.
+}
+
+NngMsg::NngMsg(nng_msg * msg) TBAG_NOEXCEPT : _msg(msg)
+{
+    // EMPTY.
+}
+
+NngMsg::NngMsg(std::size_t size) : _msg(nullptr)
+{
+    auto const CODE = alloc(size);
+    if (isFailure(CODE)) {
+        throw ErrException(CODE);
+    }
+}
+
+NngMsg::NngMsg(void const * data, std::size_t size) : _msg(nullptr)
+{
+    auto const CODE = assign(data, size);
+    if (isFailure(CODE)) {
+        throw ErrException(CODE);
+    }
+}
+
+NngMsg::NngMsg(NngMsg && obj) TBAG_NOEXCEPT : _msg(nullptr)
+{
+    swap(obj);
+}
+
+NngMsg::~NngMsg()
+{
+    reset();
+}
+
+NngMsg & NngMsg::operator =(NngMsg && obj) TBAG_NOEXCEPT
+{
+    swap(obj);
+    return *this;
+}
+
+void NngMsg::swap(NngMsg & obj) TBAG_NOEXCEPT
+{
+    if (this != &obj) {
+        std::swap(_msg, obj._msg);
+    }
+}
+
+void NngMsg::reset(nng_msg * msg) TBAG_NOEXCEPT
+{
+    if (_msg != nullptr && _msg != msg) {
+        nng_msg_free(_msg);
+    }
+    _msg = msg;
+}
+
+nng_msg * NngMsg::release() TBAG_NOEXCEPT
+{
+    nng_msg * result = _msg;
+    _msg = nullptr;
+    return result;
+}
+
+Err NngMsg::alloc(std::size_t size)
+{
+    nng_msg * msg = nullptr;
+    auto const CODE = nng_code_err(nng_msg_alloc(&msg, size));
+    if (isSuccess(CODE)) {
+        reset(msg);
+    }
+    return CODE;
+}
+
+Err NngMsg::realloc(std::size_t size)
+{
+    if (!exists()) {
+        return alloc(size);
+    }
+    return nng_code_err(nng_msg_realloc(_msg, size));
+}
+
+Err NngMsg::assign(void const * data, std::size_t size)
+{
+    auto const CODE = exists() ? realloc(size) : alloc(size);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    if (size > 0) {
+        assert(data != nullptr);
+        memcpy(nng_msg_body(_msg), data, size);
+    }
+    return E_SUCCESS;
+}
+
+Err NngMsg::clone(NngMsg & dest) const
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    nng_msg * msg = nullptr;
+    auto const CODE = nng_code_err(nng_msg_dup(&msg, _msg));
+    if (isSuccess(CODE)) {
+        dest.reset(msg);
+    }
+    return CODE;
+}
+
+void * NngMsg::body() TBAG_NOEXCEPT
+{
+    return exists() ? nng_msg_body(_msg) : nullptr;
+}
+
+void const * NngMsg::body() const TBAG_NOEXCEPT
+{
+    return exists() ? nng_msg_body(_msg) : nullptr;
+}
+
+std::size_t NngMsg::size() const TBAG_NOEXCEPT
+{
+    return exists() ? nng_msg_len(_msg) : 0u;
+}
+
+void * NngMsg::header() TBAG_NOEXCEPT
+{
+    return exists() ? nng_msg_header(_msg) : nullptr;
+}
+
+void const * NngMsg::header() const TBAG_NOEXCEPT
+{
+    return exists() ? nng_msg_header(_msg) : nullptr;
+}
+
+std::size_t NngMsg::headerSize() const TBAG_NOEXCEPT
+{
+    return exists() ? nng_msg_header_len(_msg) : 0u;
+}
+
+NngMsg::binf NngMsg::bodyView() TBAG_NOEXCEPT
+{
+    return binf(static_cast<char*>(body()), size());
+}
+
+NngMsg::cbinf NngMsg::bodyView() const TBAG_NOEXCEPT
+{
+    return cbinf(static_cast<char const *>(body()), size());
+}
+
+NngMsg::binf NngMsg::headerView() TBAG_NOEXCEPT
+{
+    return binf(static_cast<char*>(header()), headerSize());
+}
+
+NngMsg::cbinf NngMsg::headerView() const TBAG_NOEXCEPT
+{
+    return cbinf(static_cast<char const *>(header()), headerSize());
+}
+
+Err NngMsg::append(void const * data, std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_append(_msg, data, size));
+}
+
+Err NngMsg::insert(void const * data, std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_insert(_msg, data, size));
+}
+
+Err NngMsg::trim(std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_trim(_msg, size));
+}
+
+Err NngMsg::chop(std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_chop(_msg, size));
+}
+
+void NngMsg::clear()
+{
+    if (exists()) {
+        nng_msg_clear(_msg);
+    }
+}
+
+Err NngMsg::headerAppend(void const * data, std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_header_append(_msg, data, size));
+}
+
+Err NngMsg::headerInsert(void const * data, std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_header_insert(_msg, data, size));
+}
+
+Err NngMsg::headerTrim(std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_header_trim(_msg, size));
+}
+
+Err NngMsg::headerChop(std::size_t size)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_header_chop(_msg, size));
+}
+
+void NngMsg::headerClear()
+{
+    if (exists()) {
+        nng_msg_header_clear(_msg);
+    }
+}
+
+Err NngMsg::headerAppendU32(uint32_t value)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_header_append_u32(_msg, value));
+}
+
+Err NngMsg::headerTrimU32(uint32_t * value)
+{
+    if (!exists()) {
+        return E_ILLSTATE;
+    }
+    return nng_code_err(nng_msg_header_trim_u32(_msg, value));
+}
+
+} // namespace mq
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,144 @@
+/**
+ * @file   NngMsg.hpp
+ * @brief  NngMsg class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_MQ_NNGMSG_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_MQ_NNGMSG_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/mq/NngBypass.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <cstddef>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace mq {
+
+/**
+ * NngMsg class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  Owner of the nng_msg. @n
+ *  The ownership is transferred to the socket by the NngSocket::send(NngMsg&) method, @n
+ *  so the message body is not copied.
+ */
+class TBAG_API NngMsg : private Noncopyable
+{
+public:
+    using binf  = libtbag::util::binf;
+    using cbinf = libtbag::util::cbinf;
+
+private:
+    nng_msg * _msg;
+
+public:
+    NngMsg() TBAG_NOEXCEPT;
+    explicit NngMsg(nng_msg * msg) TBAG_NOEXCEPT;
+    explicit NngMsg(std::size_t size);
+    NngMsg(void const * data, std::size_t size);
+    NngMsg(NngMsg && obj) TBAG_NOEXCEPT;
+    ~NngMsg();
+
+public:
+    NngMsg & operator =(NngMsg && obj) TBAG_NOEXCEPT;
+
+public:
+    void swap(NngMsg & obj) TBAG_NOEXCEPT;
+
+    inline friend void swap(NngMsg & lh, NngMsg & rh) TBAG_NOEXCEPT
+    { lh.swap(rh); }
+
+public:
+    inline bool exists() const TBAG_NOEXCEPT
+    { return _msg != nullptr; }
+
+    inline operator bool() const TBAG_NOEXCEPT
+    { return exists(); }
+
+    inline nng_msg * get() const TBAG_NOEXCEPT
+    { return _msg; }
+
+public:
+    /** Free the current message and adopt the new message. */
+    void reset(nng_msg * msg = nullptr) TBAG_NOEXCEPT;
+
+    /** Give up the ownership. */
+    nng_msg * release() TBAG_NOEXCEPT;
+
+public:
+    Err alloc(std::size_t size);
+    Err realloc(std::size_t size);
+    Err assign(void const * data, std::size_t size);
+
+    /** Duplicate message. (Deep copy) */
+    Err clone(NngMsg & dest) const;
+
+public:
+    void * body() TBAG_NOEXCEPT;
+    void const * body() const TBAG_NOEXCEPT;
+    std::size_t size() const TBAG_NOEXCEPT;
+
+    void * header() TBAG_NOEXCEPT;
+    void const * header() const TBAG_NOEXCEPT;
+    std::size_t headerSize() const TBAG_NOEXCEPT;
+
+    inline bool empty() const TBAG_NOEXCEPT
+    { return size() == 0u; }
+
+public:
+    /**
+     * Body view. The view is valid until the message is modified, sent or destroyed.
+     */
+    binf bodyView() TBAG_NOEXCEPT;
+    cbinf bodyView() const TBAG_NOEXCEPT;
+
+    /**
+     * Header view. The view is valid until the message is modified, sent or destroyed.
+     */
+    binf headerView() TBAG_NOEXCEPT;
+    cbinf headerView() const TBAG_NOEXCEPT;
+
+public:
+    Err append(void const * data, std::size_t size);
+    Err insert(void const * data, std::size_t size);
+    Err trim(std::size_t size);
+    Err chop(std::size_t size);
+    void clear();
+
+public:
+    Err headerAppend(void const * data, std::size_t size);
+    Err headerInsert(void const * data, std::size_t size);
+    Err headerTrim(std::size_t size);
+    Err headerChop(std::size_t size);
+    void headerClear();
+
+public:
+    Err headerAppendU32(uint32_t value);
+    Err headerTrimU32(uint32_t * value);
+};
+
+} // namespace mq
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_MQ_NNGMSG_HPP__
+
@@ -263,6 +263,57 @@ Err NngSocket::recv(void * data, size_t * size, int flags)
     return nng_code_err(nng_recv(getSocket(), data, size, flags));
 }
 
+Err NngSocket::send(NngMsg & msg, int flags)
+{
+    assert(exists());
+    if (!msg.exists()) {
+        return E_ILLARGS;
+    }
+    auto const CODE = nng_code_err(nng_sendmsg(getSocket(), msg.get(), flags));
+    if (isSuccess(CODE)) {
+        msg.release();
+    }
+    return CODE;
+}
+
+Err NngSocket::recv(NngMsg & msg, int flags)
+{
+    assert(exists());
+    nng_msg * received = nullptr;
+    auto const CODE = nng_code_err(nng_recvmsg(getSocket(), &received, flags));
+    if (isSuccess(CODE)) {
+        msg.reset(received);
+    }
+    return CODE;
+}
+
+Err NngSocket::sendAsync(NngAio & aio, NngMsg && msg)
+{
+    assert(exists());
+    if (!msg.exists()) {
+        return E_ILLARGS;
+    }
+    auto const CODE = aio.begin(NngAio::Operation::OP_SEND);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    aio.setMsg(std::move(msg));
+    nng_send_aio(getSocket(), aio.get());
+    return E_SUCCESS;
+}
+
+Err NngSocket::recvAsync(NngAio & aio)
+{
+    assert(exists());
+    auto const CODE = aio.begin(NngAio::Operation::OP_RECV);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    aio.takeMsg(); // Release the message not taken by the previous operation.
+    nng_recv_aio(getSocket(), aio.get());
+    return E_SUCCESS;
+}
+
 Err NngSocket::setopt(std::string const & key, bool value)
 {
     assert(exists());
@@ -17,6 +17,8 @@
 #include <libtbag/predef.hpp>
 #include <libtbag/Err.hpp>
 #include <libtbag/mq/NngBypass.hpp>
+#include <libtbag/mq/NngMsg.hpp>
+#include <libtbag/mq/NngAio.hpp>
 
 #include <string>
 #include <vector>
@@ -133,6 +135,43 @@ public:
     Err send(void * data, size_t size, int flags = 0);
     Err recv(void * data, size_t * size, int flags = 0);
 
+public:
+    /**
+     * Send the message without copying.
+     *
+     * @remarks
+     *  On success, the ownership of the message is transferred to the socket. @n
+     *  On failure, the message remains owned by the caller.
+     */
+    Err send(NngMsg & msg, int flags = 0);
+
+    /**
+     * Receive the message without copying.
+     *
+     * @remarks
+     *  On success, the previous message is released and the received message is assigned.
+     */
+    Err recv(NngMsg & msg, int flags = 0);
+
+public:
+    /**
+     * Start the asynchronous send operation.
+     *
+     * @remarks
+     *  The result is notified through the NngAio::onComplete() method. @n
+     *  If the operation fails, the message can be taken back through the NngAio::takeMsg() method.
+     */
+    Err sendAsync(NngAio & aio, NngMsg && msg);
+
+    /**
+     * Start the asynchronous recv operation.
+     *
+     * @remarks
+     *  The result is notified through the NngAio::onComplete() method. @n
+     *  If the operation succeeds, the message can be taken through the NngAio::takeMsg() method.
+     */
+    Err recvAsync(NngAio & aio);
+
 public:
     Err setopt(std::string const & key, bool value);
     Err setopt(std::string const & key, int value);
@@ -3,11 +3,12 @@
  * @brief  Ip class implementation.
  * @author zer0
  * @date   2018-12-09
+ * @date   2026-10-19 (Replace the regex validation with the single-pass parser)
  */
 
 #include <libtbag/net/Ip.hpp>
-#include <libtbag/log/Log.hpp>
-#include <libtbag/string/StringUtils.hpp>
+
+#include <cstring>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -15,71 +16,229 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace net {
 
-#ifndef IPV4SEG
-#define IPV4SEG "(25[0-5]|(2[0-4]|1{0,1}[0-9]){0,1}[0-9])"
-#endif
+TBAG_CONSTEXPR static char const IPV6_ZONE_DELIMITER = '%';
 
-#ifndef IPV4REGEX
-#define IPV4REGEX "(" IPV4SEG "\\.){3,3}" IPV4SEG
-#endif
+static inline int getHexValue(char c) TBAG_NOEXCEPT
+{
+    if ('0' <= COMPARE_AND(c) <= '9') {
+        return c - '0';
+    } else if ('a' <= COMPARE_AND(c) <= 'f') {
+        return c - 'a' + 10;
+    } else if ('A' <= COMPARE_AND(c) <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
 
-#ifndef IPV6SEG
-#define IPV6SEG "[0-9a-fA-F]{1,4}"
-#endif
+/** The unreserved characters of the RFC 6874 (ZoneID). */
+static inline bool isZoneChar(char c) TBAG_NOEXCEPT
+{
+    return ('0' <= COMPARE_AND(c) <= '9') || ('a' <= COMPARE_AND(c) <= 'z') || ('A' <= COMPARE_AND(c) <= 'Z') ||
+           c == '-' || c == '.' || c == '_' || c == '~';
+}
 
-#define IPV6REGEX01 "(" IPV6SEG ":){7,7}" IPV6SEG
-#define IPV6REGEX02 "(" IPV6SEG ":){1,7}:"
-#define IPV6REGEX03 "(" IPV6SEG ":){1,6}(:" IPV6SEG "){1,1}"
-#define IPV6REGEX04 "(" IPV6SEG ":){1,5}(:" IPV6SEG "){1,2}"
-#define IPV6REGEX05 "(" IPV6SEG ":){1,4}(:" IPV6SEG "){1,3}"
-#define IPV6REGEX06 "(" IPV6SEG ":){1,3}(:" IPV6SEG "){1,4}"
-#define IPV6REGEX07 "(" IPV6SEG ":){1,2}(:" IPV6SEG "){1,5}"
-#define IPV6REGEX08 "(" IPV6SEG ":){1,1}(:" IPV6SEG "){1,6}"
-#define IPV6REGEX09 ":((:" IPV6SEG "){1,7}|:)"
+bool parseIpv4(char const * text, std::size_t size, uint8_t * result) TBAG_NOEXCEPT
+{
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < IPV4_BYTE_SIZE; ++i) {
+        if (i > 0) {
+            if (pos >= size || text[pos] != '.') {
+                return false;
+            }
+            ++pos;
+        }
 
-/**
- * @def IPV6REGEX10
- *
- * link-local IPv6 addresses with zone index.
- */
-#define IPV6REGEX10 "fe80:(:[0-9a-fA-F]{0,4}){0,4}%[0-9a-zA-Z]{1,}"
+        auto const BEGIN = pos;
+        unsigned value = 0;
+        while (pos < size && pos - BEGIN < 3 && '0' <= COMPARE_AND(text[pos]) <= '9') {
+            value = value * 10 + static_cast<unsigned>(text[pos] - '0');
+            ++pos;
+        }
 
-/**
- * @def IPV6REGEX11
- *
- * IPv4-mapped IPv6 addresses and IPv4-translated addresses.
- */
-#define IPV6REGEX11 "::(ffff(:0{1,4}){0,1}:){0,1}" IPV4REGEX
+        auto const DIGITS = pos - BEGIN;
+        if (DIGITS == 0 || value > 255) {
+            return false;
+        }
+        if (DIGITS == 3 && text[BEGIN] == '0') {
+            return false; // "0xx" is not allowed.
+        }
+        result[i] = static_cast<uint8_t>(value);
+    }
+    return pos == size;
+}
 
-/**
- * @def IPV6REGEX12
- *
- * IPv4-Embedded IPv6 Address.
- */
-#define IPV6REGEX12 "(" IPV6SEG ":){1,4}:" IPV4REGEX
+bool parseIpv6(char const * text, std::size_t size, uint8_t * result, std::size_t * zone_offset) TBAG_NOEXCEPT
+{
+    std::size_t address_size = size;
+    std::size_t zone = 0;
+
+    auto const * delimiter = static_cast<char const *>(::memchr(text, IPV6_ZONE_DELIMITER, size));
+    if (delimiter != nullptr) {
+        address_size = static_cast<std::size_t>(delimiter - text);
+        zone = address_size + 1;
+        if (zone == size) {
+            return false; // Empty zone id.
+        }
+        for (auto i = zone; i < size; ++i) {
+            if (!isZoneChar(text[i])) {
+                return false;
+            }
+        }
+    }
+
+    TBAG_CONSTEXPR static int const MAX_GROUPS = 8;
+    uint16_t groups[MAX_GROUPS];
+    int count = 0;
+    int gap = -1; // The group index of the "::".
+
+    std::size_t pos = 0;
+    if (address_size > 0 && text[0] == ':') {
+        if (address_size < 2 || text[1] != ':') {
+            return false;
+        }
+        gap = 0;
+        pos = 2;
+    } else if (address_size == 0) {
+        return false;
+    }
+
+    while (pos < address_size) {
+        if (count == MAX_GROUPS) {
+            return false;
+        }
+
+        auto const BEGIN = pos;
+        unsigned value = 0;
+        int hex;
+        while (pos < address_size && pos - BEGIN < 4 && (hex = getHexValue(text[pos])) >= 0) {
+            value = (value << 4) | static_cast<unsigned>(hex);
+            ++pos;
+        }
+
+        if (pos < address_size && text[pos] == '.') {
+            // The IPv4 address in the last 32 bits.
+            if (count > MAX_GROUPS - 2) {
+                return false;
+            }
+            uint8_t ipv4[IPV4_BYTE_SIZE];
+            if (!parseIpv4(text + BEGIN, address_size - BEGIN, ipv4)) {
+                return false;
+            }
+            groups[count++] = static_cast<uint16_t>((ipv4[0] << 8) | ipv4[1]);
+            groups[count++] = static_cast<uint16_t>((ipv4[2] << 8) | ipv4[3]);
+            pos = address_size;
+            break;
+        }
+
+        if (pos == BEGIN) {
+            return false;
+        }
+        groups[count++] = static_cast<uint16_t>(value);
+
+        if (pos == address_size) {
+            break;
+        }
+        if (text[pos] != ':') {
+            return false;
+        }
+        ++pos;
+
+        if (pos < address_size && text[pos] == ':') {
+            if (gap >= 0) {
+                return false; // "::" can be used only once.
+            }
+            gap = count;
+            ++pos;
+        } else if (pos == address_size) {
+            return false; // Trailing single ':'.
+        }
+    }
+
+    if (gap >= 0) {
+        if (count == MAX_GROUPS) {
+            return false; // "::" must represent at least one group.
+        }
+    } else if (count != MAX_GROUPS) {
+        return false;
+    }
+
+    // Expand the "::" with zeros.
+    int const ZEROS = MAX_GROUPS - count;
+    int index = 0;
+    for (int i = 0; i < count; ++i) {
+        if (i == gap) {
+            for (int z = 0; z < ZEROS; ++z, ++index) {
+                result[index * 2 + 0] = 0;
+                result[index * 2 + 1] = 0;
+            }
+        }
+        result[index * 2 + 0] = static_cast<uint8_t>(groups[i] >> 8);
+        result[index * 2 + 1] = static_cast<uint8_t>(groups[i]);
+        ++index;
+    }
+    for (; index < MAX_GROUPS; ++index) {
+        // The "::" at the end.
+        result[index * 2 + 0] = 0;
+        result[index * 2 + 1] = 0;
+    }
+
+    if (zone_offset != nullptr) {
+        *zone_offset = zone;
+    }
+    return true;
+}
+
+bool parseIp(char const * text, std::size_t size, IpAddress & result) TBAG_NOEXCEPT
+{
+    if (text == nullptr || size == 0) {
+        return false;
+    }
+
+    // An IPv6 address always has ':' in the first 5 characters, and an IPv4 address has never.
+    bool is_ipv6 = false;
+    for (std::size_t i = 0; i < size && i < 5; ++i) {
+        if (text[i] == ':') {
+            is_ipv6 = true;
+            break;
+        }
+    }
+
+    if (!is_ipv6) {
+        if (!parseIpv4(text, size, result.bytes)) {
+            return false;
+        }
+        ::memset(result.bytes + IPV4_BYTE_SIZE, 0x00, IPV6_BYTE_SIZE - IPV4_BYTE_SIZE);
+        result.family = IpAddress::Family::IPV4;
+        result.zone = nullptr;
+        result.zone_size = 0;
+        return true;
+    }
+
+    std::size_t zone = 0;
+    if (!parseIpv6(text, size, result.bytes, &zone)) {
+        return false;
+    }
+    result.family = IpAddress::Family::IPV6;
+    if (zone > 0) {
+        result.zone = text + zone;
+        result.zone_size = size - zone;
+    } else {
+        result.zone = nullptr;
+        result.zone_size = 0;
+    }
+    return true;
+}
 
 bool isIpv4(std::string const & ip)
 {
-    return string::isMatch(ip, IPV4REGEX);
+    uint8_t bytes[IPV4_BYTE_SIZE];
+    return parseIpv4(ip.data(), ip.size(), bytes);
 }
 
 bool isIpv6(std::string const & ip)
 {
-    // clang-format off
-    if (string::isMatch(ip, IPV6REGEX01)) { return true; } // 1:2:3:4:5:6:7:8
-    if (string::isMatch(ip, IPV6REGEX02)) { return true; } // 1::                                 1:2:3:4:5:6:7::
-    if (string::isMatch(ip, IPV6REGEX03)) { return true; } // 1::8               1:2:3:4:5:6::8   1:2:3:4:5:6::8
-    if (string::isMatch(ip, IPV6REGEX04)) { return true; } // 1::7:8             1:2:3:4:5::7:8   1:2:3:4:5::8
-    if (string::isMatch(ip, IPV6REGEX05)) { return true; } // 1::6:7:8           1:2:3:4::6:7:8   1:2:3:4::8
-    if (string::isMatch(ip, IPV6REGEX06)) { return true; } // 1::5:6:7:8         1:2:3::5:6:7:8   1:2:3::8
-    if (string::isMatch(ip, IPV6REGEX07)) { return true; } // 1::4:5:6:7:8       1:2::4:5:6:7:8   1:2::8
-    if (string::isMatch(ip, IPV6REGEX08)) { return true; } // 1::3:4:5:6:7:8     1::3:4:5:6:7:8   1::8
-    if (string::isMatch(ip, IPV6REGEX09)) { return true; } // ::2:3:4:5:6:7:8    ::2:3:4:5:6:7:8  ::8
-    if (string::isMatch(ip, IPV6REGEX10)) { return true; } // fe08::7:8%eth0     fe08::7:8%1
-    if (string::isMatch(ip, IPV6REGEX11)) { return true; } // ::255.255.255.255  ::ffff:0:255.255.255.255
-    if (string::isMatch(ip, IPV6REGEX12)) { return true; } // 2001:db8:3:4::192.0.2.33  64:ff9b::192.0.2.33
-    // clang-format on
-    return false;
+    uint8_t bytes[IPV6_BYTE_SIZE];
+    return parseIpv6(ip.data(), ip.size(), bytes);
 }
 
 } // namespace net
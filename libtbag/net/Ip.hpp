@@ -3,6 +3,7 @@
  * @brief  Ip class prototype.
  * @author zer0
  * @date   2018-12-09
+ * @date   2026-10-19 (Replace the regex validation with the single-pass parser)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_NET_IP_HPP__
@@ -16,6 +17,8 @@
 #include <libtbag/config.h>
 #include <libtbag/predef.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 // -------------------
@@ -33,12 +36,84 @@ TBAG_CONSTEXPR char const * const LOOPBACK_NAME = "localhost";
 TBAG_CONSTEXPR char const * const LOOPBACK_IPV4 = "127.0.0.1";
 TBAG_CONSTEXPR char const * const LOOPBACK_IPV6 = "::1";
 
+TBAG_CONSTEXPR std::size_t const IPV4_BYTE_SIZE = 4;
+TBAG_CONSTEXPR std::size_t const IPV6_BYTE_SIZE = 16;
+
+/**
+ * Binary IP address.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct IpAddress
+{
+    enum class Family
+    {
+        NONE, IPV4, IPV6,
+    };
+
+    Family family = Family::NONE;
+
+    /** Network byte order. The IPv4 address uses the first 4 bytes. */
+    uint8_t bytes[IPV6_BYTE_SIZE] = {0,};
+
+    /** Zone id of the IPv6 address. (e.g. "eth0" of "fe80::1%eth0") It points into the parsed text. */
+    char const * zone = nullptr;
+    std::size_t zone_size = 0;
+
+    inline bool isIpv4() const TBAG_NOEXCEPT { return family == Family::IPV4; }
+    inline bool isIpv6() const TBAG_NOEXCEPT { return family == Family::IPV6; }
+};
+
+/**
+ * Parse the dotted-decimal IPv4 address.
+ *
+ * @param[in] text
+ *      The address text. It does not have to be null-terminated.
+ * @param[in] size
+ *      Size of the text.
+ * @param[out] result
+ *      4 bytes of the address. (network byte order)
+ *
+ * @remarks
+ *  Each segment is a decimal number of 1~3 digits, not greater than 255.
+ *  The leading zeros are allowed for the segments of 1~2 digits. (e.g. "0.09.0.00")
+ */
+TBAG_API bool parseIpv4(char const * text, std::size_t size, uint8_t * result) TBAG_NOEXCEPT;
+
+/**
+ * Parse the IPv6 address. (RFC 4291, section 2.2)
+ *
+ * @param[in] text
+ *      The address text. It does not have to be null-terminated.
+ * @param[in] size
+ *      Size of the text.
+ * @param[out] result
+ *      16 bytes of the address. (network byte order)
+ * @param[out] zone_offset
+ *      Offset of the zone id in the text, or 0 if there is no zone id.
+ *
+ * @remarks
+ *  The compressed ("::"), IPv4-mapped/embedded ("::ffff:1.2.3.4") and zone id ("fe80::1%eth0") forms are accepted.
+ */
+TBAG_API bool parseIpv6(char const * text, std::size_t size, uint8_t * result,
+                        std::size_t * zone_offset = nullptr) TBAG_NOEXCEPT;
+
+/** Parse the IPv4 or IPv6 address without the memory allocation. */
+TBAG_API bool parseIp(char const * text, std::size_t size, IpAddress & result) TBAG_NOEXCEPT;
+
+inline bool parseIp(std::string const & ip, IpAddress & result) TBAG_NOEXCEPT
+{
+    return parseIp(ip.data(), ip.size(), result);
+}
+
 TBAG_API bool isIpv4(std::string const & ip);
 TBAG_API bool isIpv6(std::string const & ip);
 
 inline bool isIp(std::string const & ip)
 {
-    return isIpv4(ip) || isIpv6(ip);
+    IpAddress address;
+    return parseIp(ip, address);
 }
 
 // ------------------------
@@ -4,6 +4,7 @@
  * @author zer0
  * @date   2017-06-18
  * @date   2019-01-19 (Move: libtbag/network -> libtbag/net)
+ * @date   2026-10-19 (Fill the IP literals from the binary address)
  */
 
 #include <libtbag/net/SocketAddress.hpp>
@@ -151,12 +152,36 @@ Err SocketAddress::initName(std::string const & host, std::string const & servic
     return E_UNKNOWN;
 }
 
+Err SocketAddress::init(IpAddress const & ip, int port)
+{
+    ::memset(&_addr, 0x00, sizeof(_addr));
+    auto const NETWORK_PORT = bitwise::toNetwork(static_cast<uint16_t>(port));
+    if (ip.isIpv4()) {
+        _addr.ipv4.sin_family = AF_INET;
+        _addr.ipv4.sin_port = NETWORK_PORT;
+        ::memcpy(&_addr.ipv4.sin_addr, ip.bytes, IPV4_BYTE_SIZE);
+        return E_SUCCESS;
+    } else if (ip.isIpv6()) {
+        if (ip.zone_size > 0) {
+            // The zone id is resolved to the scope id by the libuv.
+            return E_ILLARGS;
+        }
+        _addr.ipv6.sin6_family = AF_INET6;
+        _addr.ipv6.sin6_port = NETWORK_PORT;
+        ::memcpy(&_addr.ipv6.sin6_addr, ip.bytes, IPV6_BYTE_SIZE);
+        return E_SUCCESS;
+    }
+    return E_ILLARGS;
+}
+
 Err SocketAddress::init(std::string const & host, int port)
 {
-    if (libtbag::net::isIpv4(host)) {
-        return initIpv4(host, port);
-    } else if (libtbag::net::isIpv6(host)) {
-        return initIpv6(host, port);
+    IpAddress ip;
+    if (parseIp(host, ip)) {
+        if (ip.isIpv6() && ip.zone_size > 0) {
+            return initIpv6(host, port);
+        }
+        return init(ip, port);
     }
     return initName(host, std::string(), port);
 }
@@ -4,6 +4,7 @@
  * @author zer0
  * @date   2017-06-18
  * @date   2019-01-19 (Move: libtbag/network -> libtbag/net)
+ * @date   2026-10-19 (Fill the IP literals from the binary address)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_NETWORK_SOCKETADDRESS_HPP__
@@ -18,6 +19,7 @@
 #include <libtbag/predef.hpp>
 #include <libtbag/Err.hpp>
 #include <libtbag/net/Uri.hpp>
+#include <libtbag/net/Ip.hpp>
 
 #include <string>
 
@@ -42,6 +44,7 @@ namespace net {
  * @author zer0
  * @date   2017-06-18
  * @date   2019-01-19 (Move: libtbag/network -> libtbag/net)
+ * @date   2026-10-19 (Fill the IP literals from the binary address)
  */
 class TBAG_API SocketAddress
 {
@@ -76,6 +79,10 @@ public:
     Err initName(std::string const & host, std::string const & service = "", int port = 0);
 
 public:
+    /** The IPv6 address with the zone id is not supported. (Use the initIpv6() method) */
+    Err init(IpAddress const & ip, int port);
+
+    /** The IP literal is parsed without the DNS request. */
     Err init(std::string const & host, int port);
     Err init(Uri const & uri);
 
@@ -84,8 +91,8 @@ public:
     inline struct sockaddr_in  const * getIpv4  () const TBAG_NOEXCEPT { return &_addr.ipv4; }
     inline struct sockaddr_in6 const * getIpv6  () const TBAG_NOEXCEPT { return &_addr.ipv6; }
 
-    inline bool isIpv4() const TBAG_NOEXCEPT { return _addr.ipv4.sin_port  == AF_INET;  }
-    inline bool isIpv6() const TBAG_NOEXCEPT { return _addr.ipv6.sin6_port == AF_INET6; }
+    inline bool isIpv4() const TBAG_NOEXCEPT { return _addr.common.sa_family == AF_INET;  }
+    inline bool isIpv6() const TBAG_NOEXCEPT { return _addr.common.sa_family == AF_INET6; }
 
 public:
     std::string getIpName() const;
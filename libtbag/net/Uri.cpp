@@ -4,6 +4,7 @@
  * @author zer0
  * @date   2017-05-19
  * @date   2019-01-19 (Move: libtbag/network -> libtbag/net)
+ * @date   2026-10-19 (Parse the IP literal of the host)
  */
 
 #include <libtbag/net/Uri.hpp>
@@ -274,6 +275,14 @@ static bool triple_slash_parse(std::string const & uri, bool is_connect, http_pa
 } // namespace __impl
 // ------------------
 
+bool Uri::parseHostIp(IpAddress & result) const
+{
+    if (!isHost() || _host.offset + _host.length > _uri.size()) {
+        return false;
+    }
+    return parseIp(_uri.data() + _host.offset, _host.length, result);
+}
+
 bool Uri::parse(std::string const & uri, bool is_connect)
 {
     _uri = uri;
@@ -345,6 +354,13 @@ Err Uri::requestAddrInfo(std::string & host, int & port, AddrFlags flags) const
 
     assert(!HOST.empty());
 
+    if (isPort() && isHostIp()) {
+        // The IP literal does not need the DNS request.
+        host = HOST;
+        port = getPortNumber();
+        return E_SUCCESS;
+    }
+
     libtbag::uvpp::Loop loop;
     libtbag::uvpp::DnsAddrInfo addr;
 
@@ -456,7 +472,7 @@ bool requestAddrInfo(Uri const & uri, std::string & address, int & port, AddrFla
     bool update_address = false;
     bool update_port = false;
 
-    if (libtbag::net::isIp(uri.getHost())) {
+    if (uri.isHostIp()) {
         address = uri.getHost();
         update_address = true;
     }
@@ -4,6 +4,7 @@
  * @author zer0
  * @date   2017-05-19
  * @date   2019-01-19 (Move: libtbag/network -> libtbag/net)
+ * @date   2026-10-19 (Parse the IP literal of the host)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_NETWORK_URI_HPP__
@@ -17,6 +18,7 @@
 #include <libtbag/config.h>
 #include <libtbag/predef.hpp>
 #include <libtbag/Err.hpp>
+#include <libtbag/net/Ip.hpp>
 
 #include <cstdint>
 #include <algorithm>
@@ -176,6 +178,21 @@ public:
     std::string decodeFragment() const { return decodePercent(getFragment()); }
     std::string decodeUserinfo() const { return decodePercent(getUserinfo()); }
 
+public:
+    /**
+     * Parse the host as the IP literal without the memory allocation.
+     *
+     * @remarks
+     *  The zone id of the result points into this object.
+     */
+    bool parseHostIp(IpAddress & result) const;
+
+    inline bool isHostIp() const
+    {
+        IpAddress ip;
+        return parseHostIp(ip);
+    }
+
 public:
     int getPortNumber() const;
     std::string getUrl() const;
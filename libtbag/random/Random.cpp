@@ -0,0 +1,192 @@
+/**
+ * @file   Random.cpp
+ * @brief  Random utilities implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/random/Random.hpp>
+
+#include <cstring>
+#include <atomic>
+#include <chrono>
+
+#if defined(__AVX2__)
+# include <immintrin.h>
+# define TBAG_RANDOM_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+# include <emmintrin.h>
+# define TBAG_RANDOM_SSE2
+#endif
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace random {
+
+/** Number of the interleaved engines of the bulk generator. */
+TBAG_CONSTEXPR static std::size_t const LANES = 4;
+
+/**
+ * The engines of a thread.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct ThreadRandom
+{
+    Engine engine;
+
+    /** States of the interleaved engines. ([word][lane]) */
+    uint64_t lanes[4][LANES];
+
+    bool seeded = false;
+
+    void seed(uint64_t value) TBAG_NOEXCEPT
+    {
+        engine.seed(value);
+
+        // Each lane is 2^128 steps ahead of the previous one, so the sequences never overlap.
+        Engine lane = engine;
+        for (std::size_t l = 0; l < LANES; ++l) {
+            lane.jump();
+            for (std::size_t w = 0; w < 4; ++w) {
+                lanes[w][l] = lane.state()[w];
+            }
+        }
+        seeded = true;
+    }
+};
+
+static uint64_t createThreadSeed()
+{
+    // The counter distinguishes the threads even if the std::random_device is deterministic.
+    static std::atomic<uint64_t> counter(0);
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+    seed ^= static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    uint64_t count = ++counter;
+    return seed ^ splitMix64(count);
+}
+
+static ThreadRandom & getThreadRandom()
+{
+    thread_local ThreadRandom random;
+    if (!random.seeded) {
+        random.seed(createThreadSeed());
+    }
+    return random;
+}
+
+Engine & getThreadEngine()
+{
+    return getThreadRandom().engine;
+}
+
+void seedThreadEngine(uint64_t seed)
+{
+    getThreadRandom().seed(seed);
+}
+
+/**
+ * Generate (steps * LANES) integers by the interleaved engines.
+ */
+static void generateLanes(uint64_t (&s)[4][LANES], uint64_t * output, std::size_t steps) TBAG_NOEXCEPT
+{
+#if defined(TBAG_RANDOM_AVX2)
+    __m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s[0]));
+    __m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s[1]));
+    __m256i s2 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s[2]));
+    __m256i s3 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s[3]));
+    for (std::size_t i = 0; i < steps; ++i) {
+        // rotl(s1 * 5, 7) * 9
+        __m256i x = _mm256_add_epi64(s1, _mm256_slli_epi64(s1, 2));
+        x = _mm256_or_si256(_mm256_slli_epi64(x, 7), _mm256_srli_epi64(x, 57));
+        x = _mm256_add_epi64(x, _mm256_slli_epi64(x, 3));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i * LANES), x);
+
+        __m256i const T = _mm256_slli_epi64(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, T);
+        s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(s[0]), s0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(s[1]), s1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(s[2]), s2);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(s[3]), s3);
+#elif defined(TBAG_RANDOM_SSE2)
+    for (std::size_t half = 0; half < LANES; half += 2) {
+        __m128i s0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s[0] + half));
+        __m128i s1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s[1] + half));
+        __m128i s2 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s[2] + half));
+        __m128i s3 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s[3] + half));
+        for (std::size_t i = 0; i < steps; ++i) {
+            __m128i x = _mm_add_epi64(s1, _mm_slli_epi64(s1, 2));
+            x = _mm_or_si128(_mm_slli_epi64(x, 7), _mm_srli_epi64(x, 57));
+            x = _mm_add_epi64(x, _mm_slli_epi64(x, 3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * LANES + half), x);
+
+            __m128i const T = _mm_slli_epi64(s1, 17);
+            s2 = _mm_xor_si128(s2, s0);
+            s3 = _mm_xor_si128(s3, s1);
+            s1 = _mm_xor_si128(s1, s2);
+            s0 = _mm_xor_si128(s0, s3);
+            s2 = _mm_xor_si128(s2, T);
+            s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(s[0] + half), s0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(s[1] + half), s1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(s[2] + half), s2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(s[3] + half), s3);
+    }
+#else
+    for (std::size_t i = 0; i < steps; ++i) {
+        for (std::size_t l = 0; l < LANES; ++l) {
+            output[i * LANES + l] = Engine::rotl(s[1][l] * 5, 7) * 9;
+            uint64_t const T = s[1][l] << 17;
+            s[2][l] ^= s[0][l];
+            s[3][l] ^= s[1][l];
+            s[1][l] ^= s[2][l];
+            s[0][l] ^= s[3][l];
+            s[2][l] ^= T;
+            s[3][l] = Engine::rotl(s[3][l], 45);
+        }
+    }
+#endif
+}
+
+void fillUint64(uint64_t * data, std::size_t size)
+{
+    auto & random = getThreadRandom();
+    auto const STEPS = size / LANES;
+    if (STEPS > 0) {
+        generateLanes(random.lanes, data, STEPS);
+    }
+    for (auto i = STEPS * LANES; i < size; ++i) {
+        data[i] = random.engine();
+    }
+}
+
+void fillBytes(void * data, std::size_t size)
+{
+    auto * output = static_cast<uint8_t*>(data);
+    uint64_t buffer[FILL_BATCH_SIZE];
+    while (size > 0) {
+        auto const COPY_SIZE = std::min(size, sizeof(buffer));
+        fillUint64(buffer, (COPY_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        ::memcpy(output, buffer, COPY_SIZE);
+        output += COPY_SIZE;
+        size -= COPY_SIZE;
+    }
+}
+
+} // namespace random
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
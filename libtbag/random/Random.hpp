@@ -4,6 +4,7 @@
  * @author zer0
  * @date   2016-04-07
  * @date   2016-12-10 (Move package: libtbag -> libtbag/random)
+ * @date   2026-10-19 (Use the per-thread xoshiro256** engine & add the bulk fill functions)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_RANDOM_RANDOM_HPP__
@@ -16,7 +17,11 @@
 
 #include <libtbag/config.h>
 #include <libtbag/predef.hpp>
+#include <libtbag/random/Xoshiro256.hpp>
 
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
 #include <random>
 #include <type_traits>
 
@@ -26,14 +31,150 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace random {
 
+using Engine = Xoshiro256;
+
+/** Number of the values generated at once by the fill functions. */
+TBAG_CONSTEXPR std::size_t const FILL_BATCH_SIZE = 256;
+
+/**
+ * The engine of the current thread.
+ *
+ * @remarks
+ *  Seeded by the std::random_device at the first call of each thread.
+ */
+TBAG_API Engine & getThreadEngine();
+
+/** Re-seed the engines of the current thread. (e.g. reproducible tests) */
+TBAG_API void seedThreadEngine(uint64_t seed);
+
+/**
+ * Fill the uniform 64bit integers.
+ *
+ * @remarks
+ *  The large buffer is filled by the 4 interleaved engines (SIMD) of the current thread.
+ */
+TBAG_API void fillUint64(uint64_t * data, std::size_t size);
+TBAG_API void fillBytes(void * data, std::size_t size);
+
 template <typename IntegerType>
 static IntegerType gen(IntegerType min, IntegerType max)
 {
     static_assert(std::is_integral<IntegerType>::value, "IntegerType is not an integer type.");
-    std::random_device device;
-    std::mt19937 engine(device());
     std::uniform_int_distribution<IntegerType> distribution(min, max);
-    return distribution(engine);
+    return distribution(getThreadEngine());
+}
+
+/**
+ * Map the uniform 64bit integer to [0, range] without the bias.
+ *
+ * @see <https://arxiv.org/abs/1805.10941> (Fast Random Integer Generation in an Interval)
+ */
+inline uint64_t mapUniform(uint64_t x, uint64_t range)
+{
+    if (range == UINT64_MAX) {
+        return x;
+    }
+    uint64_t const BOUND = range + 1;
+#if defined(__SIZEOF_INT128__)
+    auto m = static_cast<unsigned __int128>(x) * BOUND;
+    if (static_cast<uint64_t>(m) < BOUND) {
+        uint64_t const THRESHOLD = (0 - BOUND) % BOUND;
+        while (static_cast<uint64_t>(m) < THRESHOLD) {
+            m = static_cast<unsigned __int128>(getThreadEngine()()) * BOUND;
+        }
+    }
+    return static_cast<uint64_t>(m >> 64);
+#else
+    uint64_t const LIMIT = UINT64_MAX - (UINT64_MAX % BOUND + 1) % BOUND;
+    while (x > LIMIT) {
+        x = getThreadEngine()();
+    }
+    return x % BOUND;
+#endif
+}
+
+/** Fill the uniform integers of [min, max]. */
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+fillUniform(T * data, std::size_t size, T min, T max)
+{
+    using Unsigned = typename std::make_unsigned<T>::type;
+    auto const RANGE = static_cast<uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(max) - static_cast<Unsigned>(min)));
+    uint64_t buffer[FILL_BATCH_SIZE];
+    for (std::size_t i = 0; i < size; i += FILL_BATCH_SIZE) {
+        auto const COUNT = std::min(FILL_BATCH_SIZE, size - i);
+        fillUint64(buffer, COUNT);
+        for (std::size_t j = 0; j < COUNT; ++j) {
+            data[i + j] = static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(min) + mapUniform(buffer[j], RANGE)));
+        }
+    }
+}
+
+/** Convert the uniform 64bit integer to [0, 1). */
+inline double toUnitDouble(uint64_t x) TBAG_NOEXCEPT
+{
+    return static_cast<double>(x >> 11) * (1.0 / 9007199254740992.0/*2^53*/);
+}
+
+inline float toUnitFloat(uint64_t x) TBAG_NOEXCEPT
+{
+    return static_cast<float>(x >> 40) * (1.0f / 16777216.0f/*2^24*/);
+}
+
+template <typename T>
+inline T toUnit(uint64_t x) TBAG_NOEXCEPT
+{
+    return static_cast<T>(toUnitDouble(x));
+}
+
+template <>
+inline float toUnit<float>(uint64_t x) TBAG_NOEXCEPT
+{
+    return toUnitFloat(x);
+}
+
+/** Fill the uniform real numbers of [min, max). */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type
+fillUniform(T * data, std::size_t size, T min, T max)
+{
+    auto const SCALE = max - min;
+    uint64_t buffer[FILL_BATCH_SIZE];
+    for (std::size_t i = 0; i < size; i += FILL_BATCH_SIZE) {
+        auto const COUNT = std::min(FILL_BATCH_SIZE, size - i);
+        fillUint64(buffer, COUNT);
+        for (std::size_t j = 0; j < COUNT; ++j) {
+            data[i + j] = min + toUnit<T>(buffer[j]) * SCALE;
+        }
+    }
+}
+
+/**
+ * Fill the normal distribution. (Box-Muller transform)
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value>::type
+fillNormal(T * data, std::size_t size, T mean, T stddev)
+{
+    static_assert((FILL_BATCH_SIZE & 1) == 0, "The FILL_BATCH_SIZE must be even.");
+    T const TWO_PI = static_cast<T>(6.283185307179586476925286766559);
+    uint64_t buffer[FILL_BATCH_SIZE];
+    for (std::size_t i = 0; i < size; i += FILL_BATCH_SIZE) {
+        auto const COUNT = std::min(FILL_BATCH_SIZE, size - i);
+        // A pair of the words for each two values.
+        fillUint64(buffer, COUNT + (COUNT & 1));
+        for (std::size_t j = 0; j < COUNT; j += 2) {
+            // (0, 1] for the log().
+            auto const U1 = static_cast<T>(1) - toUnit<T>(buffer[j]);
+            auto const U2 = toUnit<T>(buffer[j + 1]);
+            auto const RADIUS = stddev * std::sqrt(static_cast<T>(-2) * std::log(U1));
+            auto const THETA = TWO_PI * U2;
+            data[i + j] = mean + RADIUS * std::cos(THETA);
+            if (j + 1 < COUNT) {
+                data[i + j + 1] = mean + RADIUS * std::sin(THETA);
+            }
+        }
+    }
 }
 
 } // namespace random
@@ -0,0 +1,143 @@
+/**
+ * @file   Xoshiro256.hpp
+ * @brief  Xoshiro256 class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_RANDOM_XOSHIRO256_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_RANDOM_XOSHIRO256_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+
+#include <cstdint>
+#include <limits>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace random {
+
+/**
+ * SplitMix64 step. Used to expand a seed into the engine state.
+ *
+ * @see <http://prng.di.unimi.it/splitmix64.c>
+ */
+inline uint64_t splitMix64(uint64_t & state) TBAG_NOEXCEPT
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Xoshiro256 class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  xoshiro256** 1.0, the all-purpose 64bit generator. (Not cryptographically secure) @n
+ *  It satisfies the UniformRandomBitGenerator, so it can be used with the distributions of the <random>.
+ *
+ * @see <http://prng.di.unimi.it/xoshiro256starstar.c>
+ */
+class Xoshiro256
+{
+public:
+    using result_type = uint64_t;
+
+public:
+    TBAG_CONSTEXPR static uint64_t const DEFAULT_SEED = 0x853C49E6748FEA9Bull;
+
+private:
+    uint64_t _s[4];
+
+public:
+    explicit Xoshiro256(uint64_t value = DEFAULT_SEED) TBAG_NOEXCEPT
+    {
+        seed(value);
+    }
+
+    ~Xoshiro256()
+    {
+        // EMPTY.
+    }
+
+public:
+    TBAG_CONSTEXPR static result_type min() TBAG_NOEXCEPT
+    { return std::numeric_limits<result_type>::min(); }
+
+    TBAG_CONSTEXPR static result_type max() TBAG_NOEXCEPT
+    { return std::numeric_limits<result_type>::max(); }
+
+    inline static uint64_t rotl(uint64_t x, int k) TBAG_NOEXCEPT
+    { return (x << k) | (x >> (64 - k)); }
+
+public:
+    inline void seed(uint64_t value) TBAG_NOEXCEPT
+    {
+        // The state must not be everywhere zero, which the SplitMix64 never outputs for 4 steps.
+        for (auto & s : _s) {
+            s = splitMix64(value);
+        }
+    }
+
+    inline result_type operator()() TBAG_NOEXCEPT
+    {
+        uint64_t const RESULT = rotl(_s[1] * 5, 7) * 9;
+        uint64_t const T = _s[1] << 17;
+        _s[2] ^= _s[0];
+        _s[3] ^= _s[1];
+        _s[1] ^= _s[2];
+        _s[0] ^= _s[3];
+        _s[2] ^= T;
+        _s[3] = rotl(_s[3], 45);
+        return RESULT;
+    }
+
+    /** Equivalent to 2^128 calls to operator(). Used to create the non-overlapping sequences. */
+    inline void jump() TBAG_NOEXCEPT
+    {
+        static uint64_t const JUMP[] = {
+                0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+                0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull,
+        };
+        uint64_t s[4] = {0, 0, 0, 0};
+        for (auto const & jump : JUMP) {
+            for (int b = 0; b < 64; ++b) {
+                if (jump & (1ull << b)) {
+                    s[0] ^= _s[0];
+                    s[1] ^= _s[1];
+                    s[2] ^= _s[2];
+                    s[3] ^= _s[3];
+                }
+                (*this)();
+            }
+        }
+        _s[0] = s[0];
+        _s[1] = s[1];
+        _s[2] = s[2];
+        _s[3] = s[3];
+    }
+
+    inline uint64_t const * state() const TBAG_NOEXCEPT
+    { return _s; }
+};
+
+} // namespace random
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_RANDOM_XOSHIRO256_HPP__
+
@@ -0,0 +1,1289 @@
+/**
+ * @file   Regex.cpp
+ * @brief  Regex class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <libtbag/string/Regex.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <list>
+#include <mutex>
+#include <regex>
+#include <unordered_map>
+#include <utility>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace string {
+
+// ------------------
+namespace __impl {
+// ------------------
+
+using ByteSet = std::bitset<256>;
+
+/** The program is limited to this size, the larger patterns fall back to the std::regex. */
+TBAG_CONSTEXPR static std::size_t const MAX_INSTRUCTIONS = 32 * 1024;
+TBAG_CONSTEXPR static int const MAX_REPEAT = 1000;
+TBAG_CONSTEXPR static std::size_t const NPOS = static_cast<std::size_t>(-1);
+
+enum class AssertType
+{
+    BEGIN_LINE,
+    END_LINE,
+    WORD_BOUNDARY,
+    NOT_WORD_BOUNDARY,
+};
+
+struct Node
+{
+    enum class Type
+    {
+        LITERAL, SET, CONCAT, ALTERNATE, REPEAT, CAPTURE, ASSERT,
+    };
+
+    Type type;
+
+    uint8_t literal = 0;
+    ByteSet set;
+    AssertType assert_type = AssertType::BEGIN_LINE;
+
+    int min = 0;
+    int max = 0; ///< Negative is infinite.
+    bool greedy = true;
+    int capture = 0;
+
+    std::vector<std::unique_ptr<Node>> children;
+
+    explicit Node(Type t) : type(t)
+    { /* EMPTY. */ }
+};
+
+using NodePtr = std::unique_ptr<Node>;
+
+static ByteSet createDigitSet()
+{
+    ByteSet result;
+    for (int c = '0'; c <= '9'; ++c) {
+        result.set(c);
+    }
+    return result;
+}
+
+static ByteSet createWordSet()
+{
+    ByteSet result = createDigitSet();
+    for (int c = 'a'; c <= 'z'; ++c) {
+        result.set(c);
+        result.set(c - 'a' + 'A');
+    }
+    result.set('_');
+    return result;
+}
+
+static ByteSet createSpaceSet()
+{
+    ByteSet result;
+    for (int c : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+        result.set(c);
+    }
+    return result;
+}
+
+static ByteSet const DIGIT_SET = createDigitSet();
+static ByteSet const WORD_SET  = createWordSet();
+static ByteSet const SPACE_SET = createSpaceSet();
+
+static inline int getHexValue(char c) TBAG_NOEXCEPT
+{
+    if ('0' <= COMPARE_AND(c) <= '9') {
+        return c - '0';
+    } else if ('a' <= COMPARE_AND(c) <= 'f') {
+        return c - 'a' + 10;
+    } else if ('A' <= COMPARE_AND(c) <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+static inline bool isAlnum(char c) TBAG_NOEXCEPT
+{
+    return WORD_SET.test(static_cast<uint8_t>(c)) && c != '_';
+}
+
+/**
+ * Recursive descent parser of the ECMAScript grammar.
+ *
+ * @remarks
+ *  If the pattern is out of the supported subset (or invalid), the nullptr is returned.
+ */
+class Parser
+{
+public:
+    enum class EscapeType
+    {
+        ERROR, BYTE, SET, ASSERT,
+    };
+
+private:
+    std::string const & _pattern;
+    std::size_t _pos;
+    int _captures;
+
+public:
+    explicit Parser(std::string const & pattern) : _pattern(pattern), _pos(0), _captures(0)
+    { /* EMPTY. */ }
+
+public:
+    inline int captures() const TBAG_NOEXCEPT
+    { return _captures; }
+
+    NodePtr parse()
+    {
+        auto node = parseAlternate();
+        if (!node || _pos != _pattern.size()) {
+            return nullptr;
+        }
+        return node;
+    }
+
+private:
+    inline bool eof() const TBAG_NOEXCEPT
+    { return _pos >= _pattern.size(); }
+
+    inline char peek() const TBAG_NOEXCEPT
+    { return _pattern[_pos]; }
+
+    inline bool isQuantifier() const TBAG_NOEXCEPT
+    {
+        if (eof()) {
+            return false;
+        }
+        auto const c = peek();
+        return c == '*' || c == '+' || c == '?' || c == '{';
+    }
+
+    NodePtr parseAlternate()
+    {
+        auto first = parseConcat();
+        if (!first) {
+            return nullptr;
+        }
+        if (eof() || peek() != '|') {
+            return first;
+        }
+        NodePtr result(new Node(Node::Type::ALTERNATE));
+        result->children.push_back(std::move(first));
+        while (!eof() && peek() == '|') {
+            ++_pos;
+            auto next = parseConcat();
+            if (!next) {
+                return nullptr;
+            }
+            result->children.push_back(std::move(next));
+        }
+        return result;
+    }
+
+    NodePtr parseConcat()
+    {
+        NodePtr result(new Node(Node::Type::CONCAT));
+        while (!eof() && peek() != '|' && peek() != ')') {
+            auto next = parseRepeat();
+            if (!next) {
+                return nullptr;
+            }
+            result->children.push_back(std::move(next));
+        }
+        return result;
+    }
+
+    bool parseNumber(int & result)
+    {
+        auto const BEGIN = _pos;
+        result = 0;
+        while (!eof() && '0' <= COMPARE_AND(peek()) <= '9') {
+            result = result * 10 + (peek() - '0');
+            if (result > MAX_REPEAT) {
+                return false;
+            }
+            ++_pos;
+        }
+        return _pos != BEGIN;
+    }
+
+    bool parseBraces(int & min, int & max)
+    {
+        ++_pos; // '{'
+        if (!parseNumber(min)) {
+            return false;
+        }
+        max = min;
+        if (!eof() && peek() == ',') {
+            ++_pos;
+            if (!eof() && peek() == '}') {
+                max = -1;
+            } else if (!parseNumber(max) || max < min) {
+                return false;
+            }
+        }
+        if (eof() || peek() != '}') {
+            return false;
+        }
+        ++_pos;
+        return true;
+    }
+
+    NodePtr parseRepeat()
+    {
+        auto atom = parseAtom();
+        if (!atom || !isQuantifier()) {
+            return atom;
+        }
+        if (atom->type == Node::Type::ASSERT) {
+            return nullptr;
+        }
+
+        int min = 0;
+        int max = -1;
+        switch (peek()) {
+        case '*': min = 0; max = -1; ++_pos; break;
+        case '+': min = 1; max = -1; ++_pos; break;
+        case '?': min = 0; max =  1; ++_pos; break;
+        default:
+            if (!parseBraces(min, max)) {
+                return nullptr;
+            }
+            break;
+        }
+
+        bool greedy = true;
+        if (!eof() && peek() == '?') {
+            greedy = false;
+            ++_pos;
+        }
+        if (isQuantifier()) {
+            return nullptr; // Nested quantifiers. (e.g. "a**")
+        }
+
+        NodePtr result(new Node(Node::Type::REPEAT));
+        result->min = min;
+        result->max = max;
+        result->greedy = greedy;
+        result->children.push_back(std::move(atom));
+        return result;
+    }
+
+    EscapeType parseEscape(bool in_class, uint8_t & byte, ByteSet & set, AssertType & assert_type)
+    {
+        if (eof()) {
+            return EscapeType::ERROR;
+        }
+        auto const c = _pattern[_pos++];
+        switch (c) {
+        // clang-format off
+        case 'd': set =  DIGIT_SET; return EscapeType::SET;
+        case 'D': set = ~DIGIT_SET; return EscapeType::SET;
+        case 'w': set =  WORD_SET;  return EscapeType::SET;
+        case 'W': set = ~WORD_SET;  return EscapeType::SET;
+        case 's': set =  SPACE_SET; return EscapeType::SET;
+        case 'S': set = ~SPACE_SET; return EscapeType::SET;
+        case 't': byte = '\t'; return EscapeType::BYTE;
+        case 'n': byte = '\n'; return EscapeType::BYTE;
+        case 'r': byte = '\r'; return EscapeType::BYTE;
+        case 'f': byte = '\f'; return EscapeType::BYTE;
+        case 'v': byte = '\v'; return EscapeType::BYTE;
+        // clang-format on
+
+        case 'b':
+            if (in_class) {
+                byte = '\b';
+                return EscapeType::BYTE;
+            }
+            assert_type = AssertType::WORD_BOUNDARY;
+            return EscapeType::ASSERT;
+
+        case 'B':
+            if (in_class) {
+                return EscapeType::ERROR;
+            }
+            assert_type = AssertType::NOT_WORD_BOUNDARY;
+            return EscapeType::ASSERT;
+
+        case '0':
+            if (!eof() && '0' <= COMPARE_AND(peek()) <= '9') {
+                return EscapeType::ERROR;
+            }
+            byte = 0;
+            return EscapeType::BYTE;
+
+        case 'x':
+        case 'u':
+        {
+            int const DIGITS = (c == 'x' ? 2 : 4);
+            int value = 0;
+            for (int i = 0; i < DIGITS; ++i) {
+                int const HEX = eof() ? -1 : getHexValue(peek());
+                if (HEX < 0) {
+                    return EscapeType::ERROR;
+                }
+                value = (value << 4) | HEX;
+                ++_pos;
+            }
+            if (value > 0xFF) {
+                return EscapeType::ERROR; // Not a single byte.
+            }
+            byte = static_cast<uint8_t>(value);
+            return EscapeType::BYTE;
+        }
+
+        default:
+            if (isAlnum(c)) {
+                return EscapeType::ERROR; // Backreferences, control letters and unknown escapes.
+            }
+            byte = static_cast<uint8_t>(c);
+            return EscapeType::BYTE;
+        }
+    }
+
+    /** Parse a byte (result is 0~255) or a set (result is -1) of the class. */
+    bool parseClassAtom(int & result, ByteSet & set)
+    {
+        auto const c = _pattern[_pos++];
+        if (c != '\\') {
+            result = static_cast<uint8_t>(c);
+            return true;
+        }
+        uint8_t byte = 0;
+        AssertType assert_type;
+        switch (parseEscape(true, byte, set, assert_type)) {
+        case EscapeType::BYTE:
+            result = byte;
+            return true;
+        case EscapeType::SET:
+            result = -1;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    NodePtr parseClass()
+    {
+        ByteSet set;
+        bool negate = false;
+        if (!eof() && peek() == '^') {
+            negate = true;
+            ++_pos;
+        }
+        if (!eof() && peek() == ']') {
+            return nullptr; // The empty class ("[]" or "[^]") differs by the implementations.
+        }
+
+        while (true) {
+            if (eof()) {
+                return nullptr;
+            }
+            if (peek() == ']') {
+                ++_pos;
+                break;
+            }
+            if (peek() == '[' && _pos + 1 < _pattern.size()) {
+                auto const NEXT = _pattern[_pos + 1];
+                if (NEXT == ':' || NEXT == '=' || NEXT == '.') {
+                    return nullptr; // POSIX classes.
+                }
+            }
+
+            int first;
+            ByteSet first_set;
+            if (!parseClassAtom(first, first_set)) {
+                return nullptr;
+            }
+
+            bool const IS_RANGE = first >= 0 && _pos + 1 < _pattern.size()
+                                  && peek() == '-' && _pattern[_pos + 1] != ']';
+            if (IS_RANGE) {
+                ++_pos; // '-'
+                int last;
+                ByteSet last_set;
+                if (!parseClassAtom(last, last_set) || last < first) {
+                    return nullptr;
+                }
+                for (int i = first; i <= last; ++i) {
+                    set.set(static_cast<std::size_t>(i));
+                }
+            } else if (first >= 0) {
+                set.set(static_cast<std::size_t>(first));
+            } else {
+                set |= first_set;
+            }
+        }
+
+        NodePtr result(new Node(Node::Type::SET));
+        result->set = negate ? ~set : set;
+        return result;
+    }
+
+    NodePtr parseAtom()
+    {
+        auto const c = _pattern[_pos++];
+        switch (c) {
+        case '(':
+        {
+            int capture = -1;
+            if (!eof() && peek() == '?') {
+                if (_pos + 1 < _pattern.size() && _pattern[_pos + 1] == ':') {
+                    _pos += 2;
+                } else {
+                    return nullptr; // Lookaheads.
+                }
+            } else {
+                capture = ++_captures;
+            }
+            auto inner = parseAlternate();
+            if (!inner || eof() || peek() != ')') {
+                return nullptr;
+            }
+            ++_pos;
+            if (capture < 0) {
+                return inner;
+            }
+            NodePtr result(new Node(Node::Type::CAPTURE));
+            result->capture = capture;
+            result->children.push_back(std::move(inner));
+            return result;
+        }
+
+        case '[':
+            return parseClass();
+
+        case '.':
+        {
+            NodePtr result(new Node(Node::Type::SET));
+            result->set.set();
+            result->set.reset('\n');
+            result->set.reset('\r');
+            return result;
+        }
+
+        case '^':
+        case '$':
+        {
+            NodePtr result(new Node(Node::Type::ASSERT));
+            result->assert_type = (c == '^' ? AssertType::BEGIN_LINE : AssertType::END_LINE);
+            return result;
+        }
+
+        case '\\':
+        {
+            uint8_t byte = 0;
+            ByteSet set;
+            AssertType assert_type;
+            switch (parseEscape(false, byte, set, assert_type)) {
+            case EscapeType::BYTE:
+            {
+                NodePtr result(new Node(Node::Type::LITERAL));
+                result->literal = byte;
+                return result;
+            }
+            case EscapeType::SET:
+            {
+                NodePtr result(new Node(Node::Type::SET));
+                result->set = set;
+                return result;
+            }
+            case EscapeType::ASSERT:
+            {
+                NodePtr result(new Node(Node::Type::ASSERT));
+                result->assert_type = assert_type;
+                return result;
+            }
+            default:
+                return nullptr;
+            }
+        }
+
+        case '*': case '+': case '?': case '{': case '}': case ']': case ')':
+            return nullptr;
+
+        default:
+        {
+            NodePtr result(new Node(Node::Type::LITERAL));
+            result->literal = static_cast<uint8_t>(c);
+            return result;
+        }
+        }
+    }
+};
+
+/**
+ * Instruction of the Pike VM.
+ *
+ * @see <https://swtch.com/~rsc/regexp/regexp2.html>
+ */
+struct Instruction
+{
+    enum class Op : uint8_t
+    {
+        BYTE,   ///< Consume the byte.
+        SET,    ///< Consume a byte of the set[x].
+        SPLIT,  ///< Fork to x (higher priority) and y.
+        JUMP,   ///< Jump to x.
+        SAVE,   ///< Save the position to the capture slot x.
+        ASSERT, ///< Zero-width assertion x.
+        MATCH,
+    };
+
+    Op op;
+    uint8_t byte;
+    int x;
+    int y;
+};
+
+struct Program
+{
+    std::vector<Instruction> instructions;
+    std::vector<ByteSet> sets;
+
+    /** Number of the groups, including the entire match. */
+    std::size_t groups = 1;
+
+    /** The pattern without the meta characters. */
+    bool is_literal = false;
+    std::string literal;
+};
+
+class Compiler
+{
+private:
+    Program & _program;
+
+public:
+    explicit Compiler(Program & program) : _program(program)
+    { /* EMPTY. */ }
+
+private:
+    inline int emit(Instruction::Op op, int x = 0, int y = 0, uint8_t byte = 0)
+    {
+        _program.instructions.push_back(Instruction{op, byte, x, y});
+        return static_cast<int>(_program.instructions.size() - 1);
+    }
+
+    inline int pc() const TBAG_NOEXCEPT
+    { return static_cast<int>(_program.instructions.size()); }
+
+public:
+    bool compile(Node const & node)
+    {
+        if (_program.instructions.size() > MAX_INSTRUCTIONS) {
+            return false;
+        }
+
+        using Op = Instruction::Op;
+        switch (node.type) {
+        case Node::Type::LITERAL:
+            emit(Op::BYTE, 0, 0, node.literal);
+            return true;
+
+        case Node::Type::SET:
+            _program.sets.push_back(node.set);
+            emit(Op::SET, static_cast<int>(_program.sets.size() - 1));
+            return true;
+
+        case Node::Type::ASSERT:
+            emit(Op::ASSERT, static_cast<int>(node.assert_type));
+            return true;
+
+        case Node::Type::CONCAT:
+            for (auto const & child : node.children) {
+                if (!compile(*child)) {
+                    return false;
+                }
+            }
+            return true;
+
+        case Node::Type::CAPTURE:
+            emit(Op::SAVE, node.capture * 2);
+            if (!compile(*node.children[0])) {
+                return false;
+            }
+            emit(Op::SAVE, node.capture * 2 + 1);
+            return true;
+
+        case Node::Type::ALTERNATE:
+        {
+            std::vector<int> jumps;
+            for (std::size_t i = 0; i + 1 < node.children.size(); ++i) {
+                auto const SPLIT = emit(Op::SPLIT);
+                _program.instructions[SPLIT].x = pc();
+                if (!compile(*node.children[i])) {
+                    return false;
+                }
+                jumps.push_back(emit(Op::JUMP));
+                _program.instructions[SPLIT].y = pc();
+            }
+            if (!compile(*node.children.back())) {
+                return false;
+            }
+            for (auto jump : jumps) {
+                _program.instructions[jump].x = pc();
+            }
+            return true;
+        }
+
+        case Node::Type::REPEAT:
+        {
+            auto const & child = *node.children[0];
+            for (int i = 0; i < node.min; ++i) {
+                if (!compile(child)) {
+                    return false;
+                }
+            }
+
+            if (node.max < 0) {
+                auto const SPLIT = emit(Op::SPLIT);
+                if (!compile(child)) {
+                    return false;
+                }
+                emit(Op::JUMP, SPLIT);
+                setSplit(SPLIT, SPLIT + 1, pc(), node.greedy);
+                return true;
+            }
+
+            std::vector<int> splits;
+            for (int i = node.min; i < node.max; ++i) {
+                splits.push_back(emit(Op::SPLIT));
+                if (!compile(child)) {
+                    return false;
+                }
+            }
+            for (auto split : splits) {
+                setSplit(split, split + 1, pc(), node.greedy);
+            }
+            return true;
+        }
+
+        default:
+            return false;
+        }
+    }
+
+private:
+    void setSplit(int split, int body, int out, bool greedy)
+    {
+        _program.instructions[split].x = greedy ? body : out;
+        _program.instructions[split].y = greedy ? out : body;
+    }
+};
+
+static bool isLiteral(Node const & node, std::string & literal)
+{
+    if (node.type == Node::Type::LITERAL) {
+        literal.push_back(static_cast<char>(node.literal));
+        return true;
+    }
+    if (node.type != Node::Type::CONCAT) {
+        return false;
+    }
+    for (auto const & child : node.children) {
+        if (child->type != Node::Type::LITERAL) {
+            return false;
+        }
+        literal.push_back(static_cast<char>(child->literal));
+    }
+    return true;
+}
+
+static bool compileProgram(std::string const & pattern, Program & program)
+{
+    Parser parser(pattern);
+    auto const ROOT = parser.parse();
+    if (!ROOT) {
+        return false;
+    }
+
+    program.groups = static_cast<std::size_t>(parser.captures()) + 1;
+
+    std::string literal;
+    if (isLiteral(*ROOT, literal) && !literal.empty()) {
+        program.is_literal = true;
+        program.literal = std::move(literal);
+    }
+
+    Compiler compiler(program);
+    program.instructions.push_back(Instruction{Instruction::Op::SAVE, 0, 0, 0});
+    if (!compiler.compile(*ROOT)) {
+        return false;
+    }
+    program.instructions.push_back(Instruction{Instruction::Op::SAVE, 0, 1, 0});
+    program.instructions.push_back(Instruction{Instruction::Op::MATCH, 0, 0, 0});
+    return program.instructions.size() <= MAX_INSTRUCTIONS;
+}
+
+// ----------
+// Executor.
+// ----------
+
+enum ExecuteFlags
+{
+    EXECUTE_NONE       = 0,
+    EXECUTE_ANCHORED   = 1 << 0, ///< The match must start at the start position. (match_continuous)
+    EXECUTE_NOT_NULL   = 1 << 1, ///< The empty match is not allowed. (match_not_null)
+    EXECUTE_FULL       = 1 << 2, ///< The match must end at the end of the text.
+};
+
+/** Sparse set of the threads. The insertion order is the priority. */
+struct ThreadList
+{
+    std::vector<int> sparse;
+    std::vector<int> dense;
+    std::size_t size = 0;
+
+    /** Capture slots of each instruction. */
+    std::vector<std::size_t> captures;
+    std::size_t slots = 0;
+
+    void reset(std::size_t instructions, std::size_t slot_count)
+    {
+        if (sparse.size() < instructions) {
+            sparse.resize(instructions);
+            dense.resize(instructions);
+        }
+        slots = slot_count;
+        if (captures.size() < instructions * slots) {
+            captures.resize(instructions * slots);
+        }
+        size = 0;
+    }
+
+    inline bool contains(int pc) const TBAG_NOEXCEPT
+    {
+        auto const INDEX = static_cast<std::size_t>(sparse[pc]);
+        return INDEX < size && dense[INDEX] == pc;
+    }
+
+    inline void insert(int pc) TBAG_NOEXCEPT
+    {
+        sparse[pc] = static_cast<int>(size);
+        dense[size++] = pc;
+    }
+
+    inline std::size_t * getCaptures(int pc) TBAG_NOEXCEPT
+    {
+        return captures.data() + static_cast<std::size_t>(pc) * slots;
+    }
+};
+
+struct Scratch
+{
+    struct StackEntry
+    {
+        int pc;
+        int slot; ///< If not negative, restore the capture slot.
+        std::size_t value;
+    };
+
+    ThreadList lists[2];
+    std::vector<StackEntry> stack;
+    std::vector<std::size_t> captures;
+};
+
+static Scratch & getScratch()
+{
+    thread_local Scratch scratch;
+    return scratch;
+}
+
+static inline bool isWordAt(char const * text, std::size_t size, std::size_t pos) TBAG_NOEXCEPT
+{
+    return pos < size && WORD_SET.test(static_cast<uint8_t>(text[pos]));
+}
+
+static bool checkAssert(AssertType type, char const * text, std::size_t size, std::size_t pos) TBAG_NOEXCEPT
+{
+    switch (type) {
+    case AssertType::BEGIN_LINE:
+        return pos == 0;
+    case AssertType::END_LINE:
+        return pos == size;
+    case AssertType::WORD_BOUNDARY:
+        return (pos > 0 && isWordAt(text, size, pos - 1)) != isWordAt(text, size, pos);
+    case AssertType::NOT_WORD_BOUNDARY:
+        return (pos > 0 && isWordAt(text, size, pos - 1)) == isWordAt(text, size, pos);
+    default:
+        return false;
+    }
+}
+
+/** Follow the empty transitions from the pc and add the threads in priority order. */
+static void addThread(Program const & program, Scratch & scratch, ThreadList & list, int pc,
+                      char const * text, std::size_t size, std::size_t pos, std::size_t * captures)
+{
+    using Op = Instruction::Op;
+    auto & stack = scratch.stack;
+    auto const SLOTS = list.slots;
+
+    stack.push_back(Scratch::StackEntry{pc, -1, 0});
+    while (!stack.empty()) {
+        auto const ENTRY = stack.back();
+        stack.pop_back();
+
+        if (ENTRY.slot >= 0) {
+            captures[ENTRY.slot] = ENTRY.value;
+            continue;
+        }
+        if (list.contains(ENTRY.pc)) {
+            continue;
+        }
+        list.insert(ENTRY.pc);
+
+        auto const & inst = program.instructions[ENTRY.pc];
+        switch (inst.op) {
+        case Op::JUMP:
+            stack.push_back(Scratch::StackEntry{inst.x, -1, 0});
+            break;
+
+        case Op::SPLIT:
+            stack.push_back(Scratch::StackEntry{inst.y, -1, 0});
+            stack.push_back(Scratch::StackEntry{inst.x, -1, 0});
+            break;
+
+        case Op::SAVE:
+            if (static_cast<std::size_t>(inst.x) < SLOTS) {
+                stack.push_back(Scratch::StackEntry{0, inst.x, captures[inst.x]});
+                captures[inst.x] = pos;
+            }
+            stack.push_back(Scratch::StackEntry{ENTRY.pc + 1, -1, 0});
+            break;
+
+        case Op::ASSERT:
+            if (checkAssert(static_cast<AssertType>(inst.x), text, size, pos)) {
+                stack.push_back(Scratch::StackEntry{ENTRY.pc + 1, -1, 0});
+            }
+            break;
+
+        default:
+            if (SLOTS > 0) {
+                std::copy(captures, captures + SLOTS, list.getCaptures(ENTRY.pc));
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Run the Pike VM from the start position.
+ *
+ * @param[out] result
+ *      Capture slots of the match. (slot_count)
+ */
+static bool execute(Program const & program, char const * text, std::size_t size, std::size_t start,
+                    int flags, std::size_t * result, std::size_t slot_count)
+{
+    using Op = Instruction::Op;
+
+    auto & scratch = getScratch();
+    auto const INSTRUCTIONS = program.instructions.size();
+    auto * clist = &scratch.lists[0];
+    auto * nlist = &scratch.lists[1];
+    clist->reset(INSTRUCTIONS, slot_count);
+    nlist->reset(INSTRUCTIONS, slot_count);
+    scratch.captures.resize(slot_count);
+    scratch.stack.clear();
+
+    bool matched = false;
+    for (std::size_t pos = start; ; ++pos) {
+        if (!matched && (pos == start || (flags & EXECUTE_ANCHORED) == 0)) {
+            std::fill(scratch.captures.begin(), scratch.captures.end(), NPOS);
+            addThread(program, scratch, *clist, 0, text, size, pos, scratch.captures.data());
+        }
+        if (clist->size == 0) {
+            break;
+        }
+
+        int const CURRENT = pos < size ? static_cast<uint8_t>(text[pos]) : -1;
+        nlist->size = 0;
+
+        for (std::size_t i = 0; i < clist->size; ++i) {
+            auto const PC = clist->dense[i];
+            auto const & inst = program.instructions[PC];
+
+            if (inst.op == Op::BYTE) {
+                if (CURRENT == inst.byte) {
+                    addThread(program, scratch, *nlist, PC + 1, text, size, pos + 1, clist->getCaptures(PC));
+                }
+            } else if (inst.op == Op::SET) {
+                if (CURRENT >= 0 && program.sets[inst.x].test(static_cast<std::size_t>(CURRENT))) {
+                    addThread(program, scratch, *nlist, PC + 1, text, size, pos + 1, clist->getCaptures(PC));
+                }
+            } else if (inst.op == Op::MATCH) {
+                if ((flags & EXECUTE_FULL) && pos != size) {
+                    continue;
+                }
+                if ((flags & EXECUTE_NOT_NULL) && pos == start) {
+                    continue;
+                }
+                matched = true;
+                if (slot_count > 0) {
+                    auto const * captures = clist->getCaptures(PC);
+                    std::copy(captures, captures + slot_count, result);
+                } else {
+                    return true;
+                }
+                // Cut off the threads of the lower priority.
+                break;
+            }
+        }
+
+        std::swap(clist, nlist);
+        if (pos >= size) {
+            break;
+        }
+    }
+    return matched;
+}
+
+// ---------------
+} // namespace __impl
+// ---------------
+
+/**
+ * The compiled pattern.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct Regex::Impl
+{
+    std::string pattern;
+    bool linear = false;
+
+    __impl::Program program;
+    std::regex fallback;
+
+    explicit Impl(std::string const & p) : pattern(p)
+    {
+        linear = __impl::compileProgram(pattern, program);
+        if (!linear) {
+            fallback = std::regex(pattern);
+        }
+    }
+
+    inline std::size_t slots() const TBAG_NOEXCEPT
+    { return program.groups * 2; }
+
+    /** Call the callback with the capture slots of each match, as the std::regex_iterator. */
+    template <typename Predicated>
+    void forEach(std::string const & text, Predicated predicated) const
+    {
+        using namespace __impl;
+        auto const * DATA = text.data();
+        auto const SIZE = text.size();
+
+        std::vector<std::size_t> captures(slots());
+        if (!execute(program, DATA, SIZE, 0, EXECUTE_NONE, captures.data(), captures.size())) {
+            return;
+        }
+
+        while (true) {
+            predicated(captures.data());
+
+            auto start = captures[1];
+            if (captures[0] == captures[1]) {
+                // After the empty match, try a non-empty match at the same position.
+                if (start == SIZE) {
+                    return;
+                }
+                if (execute(program, DATA, SIZE, start, EXECUTE_ANCHORED | EXECUTE_NOT_NULL,
+                            captures.data(), captures.size())) {
+                    continue;
+                }
+                ++start;
+            }
+            if (!execute(program, DATA, SIZE, start, EXECUTE_NONE, captures.data(), captures.size())) {
+                return;
+            }
+        }
+    }
+};
+
+Regex::Regex()
+{
+    // EMPTY.
+}
+
+Regex::Regex(std::string const & pattern) : _impl(std::make_shared<Impl>(pattern))
+{
+    // EMPTY.
+}
+
+Regex::Regex(Regex const & obj) : _impl(obj._impl)
+{
+    // EMPTY.
+}
+
+Regex::Regex(Regex && obj) TBAG_NOEXCEPT : _impl(std::move(obj._impl))
+{
+    // EMPTY.
+}
+
+Regex::~Regex()
+{
+    // EMPTY.
+}
+
+Regex & Regex::operator =(Regex const & obj)
+{
+    if (this != &obj) {
+        _impl = obj._impl;
+    }
+    return *this;
+}
+
+Regex & Regex::operator =(Regex && obj) TBAG_NOEXCEPT
+{
+    if (this != &obj) {
+        _impl.swap(obj._impl);
+    }
+    return *this;
+}
+
+std::string Regex::pattern() const
+{
+    return _impl ? _impl->pattern : std::string();
+}
+
+bool Regex::isLinear() const
+{
+    return _impl && _impl->linear;
+}
+
+bool Regex::match(std::string const & text) const
+{
+    if (!_impl) {
+        return false;
+    }
+    if (!_impl->linear) {
+        return std::regex_match(text, _impl->fallback);
+    }
+    auto const & program = _impl->program;
+    if (program.is_literal) {
+        return text == program.literal;
+    }
+    return __impl::execute(program, text.data(), text.size(), 0,
+                           __impl::EXECUTE_ANCHORED | __impl::EXECUTE_FULL, nullptr, 0);
+}
+
+bool Regex::search(std::string const & text) const
+{
+    if (!_impl) {
+        return false;
+    }
+    if (!_impl->linear) {
+        return std::regex_search(text, _impl->fallback);
+    }
+    auto const & program = _impl->program;
+    if (program.is_literal) {
+        return text.find(program.literal) != std::string::npos;
+    }
+    return __impl::execute(program, text.data(), text.size(), 0, __impl::EXECUTE_NONE, nullptr, 0);
+}
+
+std::vector<std::string> Regex::findAll(std::string const & text) const
+{
+    std::vector<std::string> result;
+    if (!_impl) {
+        return result;
+    }
+    if (!_impl->linear) {
+        using TokenIterator = std::regex_token_iterator<typename std::string::const_iterator>;
+        auto itr = TokenIterator(text.begin(), text.end(), _impl->fallback);
+        auto end = TokenIterator();
+        for (; itr != end; ++itr) {
+            result.push_back(itr->str());
+        }
+        return result;
+    }
+    _impl->forEach(text, [&](std::size_t const * captures){
+        result.push_back(text.substr(captures[0], captures[1] - captures[0]));
+    });
+    return result;
+}
+
+std::string Regex::replace(std::string const & text, std::string const & format) const
+{
+    if (!_impl) {
+        return text;
+    }
+    if (!_impl->linear) {
+        return std::regex_replace(text, _impl->fallback, format);
+    }
+
+    auto const GROUPS = _impl->program.groups;
+    std::string result;
+    std::size_t prefix_begin = 0;
+
+    _impl->forEach(text, [&](std::size_t const * captures){
+        auto const MATCH_BEGIN = captures[0];
+        auto const MATCH_END = captures[1];
+        result.append(text, prefix_begin, MATCH_BEGIN - prefix_begin);
+
+        auto appendGroup = [&](std::size_t group){
+            auto const BEGIN = captures[group * 2];
+            auto const END = captures[group * 2 + 1];
+            if (BEGIN != __impl::NPOS && END != __impl::NPOS) {
+                result.append(text, BEGIN, END - BEGIN);
+            }
+        };
+
+        // The ECMAScript rules of the format. (std::regex_constants::format_default)
+        auto const FORMAT_SIZE = format.size();
+        for (std::size_t i = 0; i < FORMAT_SIZE; ++i) {
+            auto const c = format[i];
+            if (c != '$' || i + 1 == FORMAT_SIZE) {
+                result.push_back(c);
+                continue;
+            }
+            auto const NEXT = format[i + 1];
+            if (NEXT == '$') {
+                result.push_back('$');
+                ++i;
+            } else if (NEXT == '&') {
+                appendGroup(0);
+                ++i;
+            } else if (NEXT == '`') {
+                result.append(text, prefix_begin, MATCH_BEGIN - prefix_begin);
+                ++i;
+            } else if (NEXT == '\'') {
+                result.append(text, MATCH_END, std::string::npos);
+                ++i;
+            } else if ('0' <= COMPARE_AND(NEXT) <= '9') {
+                std::size_t group = static_cast<std::size_t>(NEXT - '0');
+                ++i;
+                if (i + 1 < FORMAT_SIZE && '0' <= COMPARE_AND(format[i + 1]) <= '9') {
+                    group = group * 10 + static_cast<std::size_t>(format[i + 1] - '0');
+                    ++i;
+                }
+                if (group < GROUPS) {
+                    appendGroup(group);
+                }
+            } else {
+                result.push_back('$');
+            }
+        }
+        prefix_begin = MATCH_END;
+    });
+
+    result.append(text, prefix_begin, std::string::npos);
+    return result;
+}
+
+// -----------
+// LRU cache.
+// -----------
+
+/**
+ * The process-wide cache of the compiled patterns.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct RegexCache
+{
+    using Item = std::pair<std::string, Regex>;
+    using List = std::list<Item>;
+
+    std::mutex mutex;
+    std::size_t capacity = DEFAULT_REGEX_CACHE_CAPACITY;
+
+    /** The most recently used pattern is the front. */
+    List items;
+    std::unordered_map<std::string, List::iterator> index;
+
+    void shrink()
+    {
+        while (items.size() > capacity) {
+            index.erase(items.back().first);
+            items.pop_back();
+        }
+    }
+};
+
+static RegexCache & getRegexCache()
+{
+    static RegexCache cache;
+    return cache;
+}
+
+Regex getCachedRegex(std::string const & pattern)
+{
+    auto & cache = getRegexCache();
+    {
+        std::lock_guard<std::mutex> guard(cache.mutex);
+        auto itr = cache.index.find(pattern);
+        if (itr != cache.index.end()) {
+            cache.items.splice(cache.items.begin(), cache.items, itr->second);
+            return itr->second->second;
+        }
+    }
+
+    // Compile outside the lock. (It can throw the std::regex_error)
+    Regex regex(pattern);
+
+    std::lock_guard<std::mutex> guard(cache.mutex);
+    auto itr = cache.index.find(pattern);
+    if (itr != cache.index.end()) {
+        // Compiled by the other thread.
+        cache.items.splice(cache.items.begin(), cache.items, itr->second);
+        return itr->second->second;
+    }
+    if (cache.capacity > 0) {
+        cache.items.emplace_front(pattern, regex);
+        cache.index.emplace(pattern, cache.items.begin());
+        cache.shrink();
+    }
+    return regex;
+}
+
+void setRegexCacheCapacity(std::size_t capacity)
+{
+    auto & cache = getRegexCache();
+    std::lock_guard<std::mutex> guard(cache.mutex);
+    cache.capacity = capacity;
+    cache.shrink();
+}
+
+std::size_t getRegexCacheCapacity()
+{
+    auto & cache = getRegexCache();
+    std::lock_guard<std::mutex> guard(cache.mutex);
+    return cache.capacity;
+}
+
+std::size_t getRegexCacheSize()
+{
+    auto & cache = getRegexCache();
+    std::lock_guard<std::mutex> guard(cache.mutex);
+    return cache.items.size();
+}
+
+void clearRegexCache()
+{
+    auto & cache = getRegexCache();
+    std::lock_guard<std::mutex> guard(cache.mutex);
+    cache.items.clear();
+    cache.index.clear();
+}
+
+} // namespace string
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,121 @@
+/**
+ * @file   Regex.hpp
+ * @brief  Regex class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_STRING_REGEX_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_STRING_REGEX_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace string {
+
+/**
+ * Regex class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The compiled pattern of the ECMAScript grammar (same as the default of the std::regex). @n
+ *  The following subset is matched in linear time by the Thompson NFA (Pike VM):
+ *  - Literals, <code>.</code>, classes (<code>[a-z]</code>, <code>[^...]</code>), <code>\\d \\w \\s \\D \\W \\S</code>
+ *  - Groups (<code>(...)</code>, <code>(?:...)</code>) and alternation (<code>|</code>)
+ *  - Quantifiers (<code>* + ? {n} {n,} {n,m}</code>) and the lazy forms
+ *  - Assertions (<code>^ $ \\b \\B</code>)
+ *
+ *  The other patterns (e.g. backreferences, lookaheads, POSIX classes) fall back to the std::regex. @n
+ *  The compiled pattern is immutable, so a Regex can be shared between threads.
+ *
+ * @warning
+ *  If the pattern is invalid, the std::regex_error is thrown as the std::regex.
+ */
+class TBAG_API Regex
+{
+public:
+    struct Impl;
+    friend struct Impl;
+
+    using SharedImpl = std::shared_ptr<Impl const>;
+
+private:
+    SharedImpl _impl;
+
+public:
+    Regex();
+    explicit Regex(std::string const & pattern);
+    Regex(Regex const & obj);
+    Regex(Regex && obj) TBAG_NOEXCEPT;
+    ~Regex();
+
+public:
+    Regex & operator =(Regex const & obj);
+    Regex & operator =(Regex && obj) TBAG_NOEXCEPT;
+
+public:
+    inline bool exists() const TBAG_NOEXCEPT
+    { return static_cast<bool>(_impl); }
+
+    inline operator bool() const TBAG_NOEXCEPT
+    { return exists(); }
+
+public:
+    std::string pattern() const;
+
+    /** If false, the pattern is matched by the std::regex. */
+    bool isLinear() const;
+
+public:
+    /** The entire text matches the pattern. (std::regex_match) */
+    bool match(std::string const & text) const;
+
+    /** Some subsequence of the text matches the pattern. (std::regex_search) */
+    bool search(std::string const & text) const;
+
+    /** All the non-overlapping matches. (std::regex_token_iterator) */
+    std::vector<std::string> findAll(std::string const & text) const;
+
+    /** Replace all the matches by the ECMAScript format. (std::regex_replace) */
+    std::string replace(std::string const & text, std::string const & format) const;
+};
+
+TBAG_CONSTEXPR std::size_t const DEFAULT_REGEX_CACHE_CAPACITY = 1024;
+
+/**
+ * Obtain the compiled pattern from the process-wide LRU cache.
+ *
+ * @remarks
+ *  The least recently used pattern is removed if the cache is full.
+ */
+TBAG_API Regex getCachedRegex(std::string const & pattern);
+
+TBAG_API void setRegexCacheCapacity(std::size_t capacity);
+TBAG_API std::size_t getRegexCacheCapacity();
+TBAG_API std::size_t getRegexCacheSize();
+TBAG_API void clearRegexCache();
+
+} // namespace string
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_STRING_REGEX_HPP__
+
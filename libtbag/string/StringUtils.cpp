@@ -4,10 +4,14 @@
  * @author zer0
  * @date   2016-04-04
  * @date   2016-12-05 (Rename: Strings -> StringUtils)
+ * @date   2026-10-19 (Generate the random strings by the bulk generator)
+ * @date   2026-10-19 (Use the cached Regex for the string patterns)
  */
 
 #include <libtbag/string/StringUtils.hpp>
 #include <libtbag/Unit.hpp>
+#include <libtbag/random/Random.hpp>
+#include <libtbag/string/Regex.hpp>
 
 #include <cctype>
 #include <cassert>
@@ -22,6 +26,17 @@
 #include <unicode/regex.h>
 #include <libtbag/Err.hpp>
 
+#if defined(__AVX2__)
+# include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define TBAG_STRING_UTILS_SSE2
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+# include <arm_neon.h>
+# define TBAG_STRING_UTILS_NEON
+#endif
+
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
 // -------------------
@@ -328,16 +343,23 @@ std::string convertByteArrayToHexString(
         return std::string();
     }
 
-    std::string result;
-    std::size_t i = 0;
-    while (true) {
-        result += (prefix + convertByteToHexString(bytes[i]));
-        if ((++i) < size) {
-            result += separator;
-        } else {
-            break;
+    if (prefix.empty() && separator.empty()) {
+        std::string result(size * 2, '\0');
+        encodeHexString(bytes, size, &result[0]);
+        return result;
+    }
+
+    auto const STEP = prefix.size() + 2 + separator.size();
+    std::string result(STEP * size - separator.size(), '\0');
+    char * cursor = &result[0];
+    for (std::size_t i = 0; i < size; ++i) {
+        if (i > 0) {
+            cursor = std::copy(separator.begin(), separator.end(), cursor);
         }
+        cursor = std::copy(prefix.begin(), prefix.end(), cursor);
+        cursor += encodeHexString(bytes + i, 1, cursor);
     }
+    assert(cursor == result.data() + result.size());
     return result;
 }
 
@@ -420,17 +442,213 @@ Err convertHexStringToBuffer(char const * hex_string, std::size_t length, libtba
     assert(hex_string != nullptr);
     assert(length >= 1);
 
-    auto const BUFFER_SIZE = (length / 2);
-    buffer.resize(BUFFER_SIZE);
+    buffer.resize(length / 2);
+    return decodeHexString(hex_string, length, buffer.data());
+}
+
+TBAG_CONSTEXPR static uint8_t const HEX_INVALID_VALUE = 0xFF;
+
+struct HexTables
+{
+    /** Two characters of each byte. */
+    char upper[256][2];
+    char lower[256][2];
+
+    /** Value of each character. */
+    uint8_t values[256];
+
+    HexTables() TBAG_NOEXCEPT
+    {
+        char const * const UPPER_DIGITS = "0123456789ABCDEF";
+        char const * const LOWER_DIGITS = "0123456789abcdef";
+        for (int i = 0; i < 256; ++i) {
+            upper[i][0] = UPPER_DIGITS[i >> 4];
+            upper[i][1] = UPPER_DIGITS[i & 0xF];
+            lower[i][0] = LOWER_DIGITS[i >> 4];
+            lower[i][1] = LOWER_DIGITS[i & 0xF];
+            values[i] = HEX_INVALID_VALUE;
+        }
+        for (int i = 0; i < 16; ++i) {
+            values[static_cast<uint8_t>(UPPER_DIGITS[i])] = static_cast<uint8_t>(i);
+            values[static_cast<uint8_t>(LOWER_DIGITS[i])] = static_cast<uint8_t>(i);
+        }
+    }
+};
+
+static HexTables const & getHexTables() TBAG_NOEXCEPT
+{
+    static HexTables const TABLES;
+    return TABLES;
+}
+
+#if defined(TBAG_STRING_UTILS_SSE2)
+/** Half bytes -> characters. */
+static inline __m128i convertHalfBytesToHexChars128(__m128i half_bytes, bool upper) TBAG_NOEXCEPT
+{
+    __m128i const LETTER_OFFSET = _mm_set1_epi8(upper ? ('A' - '0' - 10) : ('a' - '0' - 10));
+    __m128i const IS_LETTER = _mm_cmpgt_epi8(half_bytes, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(half_bytes, _mm_set1_epi8('0')), _mm_and_si128(IS_LETTER, LETTER_OFFSET));
+}
+
+/**
+ * 16 characters -> 8 words of the bytes.
+ *
+ * @return
+ *  false if an invalid character is found.
+ */
+static inline bool convertHexCharsToWords128(__m128i chars, __m128i & words) TBAG_NOEXCEPT
+{
+    __m128i const DIGITS = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i const LETTERS = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i const IS_DIGIT = _mm_cmpeq_epi8(_mm_min_epu8(DIGITS, _mm_set1_epi8(9)), DIGITS);
+    __m128i const IS_LETTER = _mm_cmpeq_epi8(_mm_min_epu8(LETTERS, _mm_set1_epi8(5)), LETTERS);
+    if (_mm_movemask_epi8(_mm_or_si128(IS_DIGIT, IS_LETTER)) != 0xFFFF) {
+        return false;
+    }
+    __m128i const VALUES = _mm_or_si128(_mm_and_si128(IS_DIGIT, DIGITS),
+                                        _mm_andnot_si128(IS_DIGIT, _mm_add_epi8(LETTERS, _mm_set1_epi8(10))));
+    // The high half byte is the low byte of the word.
+    words = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(VALUES, 4), _mm_set1_epi16(0x00F0)),
+                         _mm_srli_epi16(VALUES, 8));
+    return true;
+}
+#endif
+
+#if defined(__AVX2__)
+static inline __m256i convertHalfBytesToHexChars256(__m256i half_bytes, bool upper) TBAG_NOEXCEPT
+{
+    __m256i const LETTER_OFFSET = _mm256_set1_epi8(upper ? ('A' - '0' - 10) : ('a' - '0' - 10));
+    __m256i const IS_LETTER = _mm256_cmpgt_epi8(half_bytes, _mm256_set1_epi8(9));
+    return _mm256_add_epi8(_mm256_add_epi8(half_bytes, _mm256_set1_epi8('0')),
+                           _mm256_and_si256(IS_LETTER, LETTER_OFFSET));
+}
+
+static inline bool convertHexCharsToWords256(__m256i chars, __m256i & words) TBAG_NOEXCEPT
+{
+    __m256i const DIGITS = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    __m256i const LETTERS = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i const IS_DIGIT = _mm256_cmpeq_epi8(_mm256_min_epu8(DIGITS, _mm256_set1_epi8(9)), DIGITS);
+    __m256i const IS_LETTER = _mm256_cmpeq_epi8(_mm256_min_epu8(LETTERS, _mm256_set1_epi8(5)), LETTERS);
+    if (_mm256_movemask_epi8(_mm256_or_si256(IS_DIGIT, IS_LETTER)) != -1) {
+        return false;
+    }
+    __m256i const VALUES = _mm256_blendv_epi8(_mm256_add_epi8(LETTERS, _mm256_set1_epi8(10)), DIGITS, IS_DIGIT);
+    words = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(VALUES, 4), _mm256_set1_epi16(0x00F0)),
+                            _mm256_srli_epi16(VALUES, 8));
+    return true;
+}
+#endif
+
+std::size_t encodeHexString(void const * input, std::size_t size, char * output, bool upper) TBAG_NOEXCEPT
+{
+    auto const * src = static_cast<uint8_t const *>(input);
+    auto * dest = reinterpret_cast<uint8_t *>(output);
+    std::size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i const MASK_0F_256 = _mm256_set1_epi8(0x0F);
+    for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i)) {
+        __m256i const DATA = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+        __m256i const HI = convertHalfBytesToHexChars256(_mm256_and_si256(_mm256_srli_epi16(DATA, 4), MASK_0F_256), upper);
+        __m256i const LO = convertHalfBytesToHexChars256(_mm256_and_si256(DATA, MASK_0F_256), upper);
+        // The unpack instructions work in each 128-bit lane.
+        __m256i const FIRST = _mm256_unpacklo_epi8(HI, LO);
+        __m256i const SECOND = _mm256_unpackhi_epi8(HI, LO);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i * 2), _mm256_permute2x128_si256(FIRST, SECOND, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i * 2 + 32), _mm256_permute2x128_si256(FIRST, SECOND, 0x31));
+    }
+#endif
+
+#if defined(TBAG_STRING_UTILS_SSE2)
+    __m128i const MASK_0F = _mm_set1_epi8(0x0F);
+    for (; i + sizeof(__m128i) <= size; i += sizeof(__m128i)) {
+        __m128i const DATA = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+        __m128i const HI = convertHalfBytesToHexChars128(_mm_and_si128(_mm_srli_epi16(DATA, 4), MASK_0F), upper);
+        __m128i const LO = convertHalfBytesToHexChars128(_mm_and_si128(DATA, MASK_0F), upper);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i * 2), _mm_unpacklo_epi8(HI, LO));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i * 2 + 16), _mm_unpackhi_epi8(HI, LO));
+    }
+#elif defined(TBAG_STRING_UTILS_NEON)
+    uint8x16_t const DIGITS = vld1q_u8(reinterpret_cast<uint8_t const *>(upper ? "0123456789ABCDEF" : "0123456789abcdef"));
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t const DATA = vld1q_u8(src + i);
+        uint8x16x2_t chars;
+        chars.val[0] = vqtbl1q_u8(DIGITS, vshrq_n_u8(DATA, 4));
+        chars.val[1] = vqtbl1q_u8(DIGITS, vandq_u8(DATA, vdupq_n_u8(0x0F)));
+        vst2q_u8(dest + i * 2, chars);
+    }
+#endif
+
+    auto const & tables = getHexTables();
+    auto const & table = upper ? tables.upper : tables.lower;
+    for (; i < size; ++i) {
+        dest[i * 2    ] = table[src[i]][0];
+        dest[i * 2 + 1] = table[src[i]][1];
+    }
+    return size * 2;
+}
 
-    Err code;
-    uint8_t byte;
-    for (std::size_t i = 0; i < length; i += 2) {
-        code = convertHexCharToByte(hex_string[i], hex_string[i+1], byte);
-        if (isFailure(code)) {
-            return code;
+Err decodeHexString(char const * input, std::size_t size, void * output) TBAG_NOEXCEPT
+{
+    if ((size & 0x1) != 0x0) {
+        return E_ILLARGS;
+    }
+
+    auto const * src = reinterpret_cast<uint8_t const *>(input);
+    auto * dest = static_cast<uint8_t *>(output);
+    std::size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + sizeof(__m256i) * 2 <= size; i += sizeof(__m256i) * 2) {
+        __m256i first, second;
+        if (!convertHexCharsToWords256(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i)), first) ||
+            !convertHexCharsToWords256(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i + 32)), second)) {
+            break;
+        }
+        // The pack instruction works in each 128-bit lane.
+        __m256i const PACKED = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i / 2), PACKED);
+    }
+#endif
+
+#if defined(TBAG_STRING_UTILS_SSE2)
+    for (; i + sizeof(__m128i) * 2 <= size; i += sizeof(__m128i) * 2) {
+        __m128i first, second;
+        if (!convertHexCharsToWords128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i)), first) ||
+            !convertHexCharsToWords128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i + 16)), second)) {
+            break;
         }
-        buffer[i/2] = (libtbag::util::Buffer::value_type)byte;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i / 2), _mm_packus_epi16(first, second));
+    }
+#elif defined(TBAG_STRING_UTILS_NEON)
+    for (; i + 32 <= size; i += 32) {
+        uint8x16x2_t const CHARS = vld2q_u8(src + i);
+        uint8x16_t values[2];
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        for (int h = 0; h < 2; ++h) {
+            uint8x16_t const DIGITS = vsubq_u8(CHARS.val[h], vdupq_n_u8('0'));
+            uint8x16_t const LETTERS = vsubq_u8(vorrq_u8(CHARS.val[h], vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+            uint8x16_t const IS_DIGIT = vcleq_u8(DIGITS, vdupq_n_u8(9));
+            uint8x16_t const IS_LETTER = vcleq_u8(LETTERS, vdupq_n_u8(5));
+            valid = vandq_u8(valid, vorrq_u8(IS_DIGIT, IS_LETTER));
+            values[h] = vbslq_u8(IS_DIGIT, DIGITS, vaddq_u8(LETTERS, vdupq_n_u8(10)));
+        }
+        if (vminvq_u8(valid) != 0xFF) {
+            break;
+        }
+        vst1q_u8(dest + i / 2, vorrq_u8(vshlq_n_u8(values[0], 4), values[1]));
+    }
+#endif
+
+    // The invalid block of the SIMD kernels is checked again.
+    uint8_t const * values = getHexTables().values;
+    for (; i < size; i += 2) {
+        auto const HIGH = values[src[i]];
+        auto const LOW = values[src[i+1]];
+        if ((HIGH | LOW) & 0xF0) {
+            return E_PARSING;
+        }
+        dest[i / 2] = static_cast<uint8_t>((HIGH << 4) | LOW);
     }
     return E_SUCCESS;
 }
@@ -553,12 +771,12 @@ std::vector<std::string> splitMatch(std::string const & source, std::regex const
 
 std::vector<std::string> splitMatch(std::string const & source, std::string const & match)
 {
-    return splitMatch(source, std::regex(match));
+    return getCachedRegex(match).findAll(source);
 }
 
 std::string replaceRegex(std::string const & source, std::string const & regex, std::string const & replace)
 {
-    return std::regex_replace(source, std::regex(regex), replace);
+    return getCachedRegex(regex).replace(source, replace);
 }
 
 std::string removeRegex(std::string const & source, std::string const & regex)
@@ -584,7 +802,7 @@ bool isMatch(std::string const & source, std::regex const & regex)
 
 bool isMatch(std::string const & source, std::string const & regex)
 {
-    return isMatch(source, std::regex(regex));
+    return getCachedRegex(regex).match(source);
 }
 
 bool isUtf8Match(std::string const & utf8_source, std::string const & regex)
@@ -791,11 +1009,14 @@ std::vector<std::string> trim(std::vector<std::string> const & strs, bool remove
 void createRandomString(char * buffer, std::size_t size, char const * table,
                         std::size_t min, std::size_t max)
 {
-    std::random_device device;
-    std::mt19937 engine(device());
-    std::uniform_int_distribution<std::size_t> distribution(min, max);
-    for (auto i = 0; i < size; ++i) {
-        buffer[i] = table[distribution(engine)];
+    // The engine of the thread is seeded once, instead of the std::random_device of each call.
+    std::size_t indices[random::FILL_BATCH_SIZE];
+    for (std::size_t i = 0; i < size; i += random::FILL_BATCH_SIZE) {
+        auto const COUNT = std::min(random::FILL_BATCH_SIZE, size - i);
+        random::fillUniform(indices, COUNT, min, max);
+        for (std::size_t j = 0; j < COUNT; ++j) {
+            buffer[i + j] = table[indices[j]];
+        }
     }
 }
 
@@ -809,7 +1030,7 @@ void createRandomString(char * buffer, std::size_t size)
 
 std::string createRandomString(std::size_t size)
 {
-    std::string result(CHAR_SPACE, size);
+    std::string result(size, CHAR_SPACE);
     createRandomString(&result[0], size);
     return result;
 }
@@ -269,6 +269,17 @@ TBAG_API Err convertHexCharToHalfByte(char hex_char, uint8_t & result);
 TBAG_API Err convertHexCharToByte(char high_char, char low_char, uint8_t & result);
 TBAG_API Err convertHexStringToBuffer(char const * hex_string, std::size_t length, libtbag::util::Buffer & buffer);
 
+/**
+ * Table-driven (and SIMD) HEX codec.
+ *
+ * @remarks
+ *  - encodeHexString() writes (size * 2) characters without the prefix and separator.
+ *  - decodeHexString() writes (size / 2) bytes and accepts both letter cases.
+ */
+TBAG_API std::size_t encodeHexString(void const * input, std::size_t size, char * output,
+                                     bool upper = true) TBAG_NOEXCEPT;
+TBAG_API Err decodeHexString(char const * input, std::size_t size, void * output) TBAG_NOEXCEPT;
+
 /**
  * Address to HEX string.
  */
@@ -315,6 +326,9 @@ std::string toPrettyHexBox(std::vector<T> const & bytes)
 
 /**
  * Regex based token.
+ *
+ * @remarks
+ *  The string patterns are compiled once by the getCachedRegex(). (libtbag/string/Regex.hpp)
  */
 TBAG_API std::vector<std::string> splitMatch(std::string const & source, std::regex const & match);
 TBAG_API std::vector<std::string> splitMatch(std::string const & source, std::string const & match);
@@ -0,0 +1,637 @@
+/**
+ * @file   TiledIndex.cpp
+ * @brief  TiledIndex class implementation.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Remove the shared stamp of the queries)
+ */
+
+#include <libtbag/tiled/TiledIndex.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace tiled {
+
+using Rect = TiledIndex::Rect;
+using Point = TiledIndex::Point;
+
+static int __floor_div(int value, int divisor) TBAG_NOEXCEPT
+{
+    assert(divisor > 0);
+    auto const quotient = value / divisor;
+    return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+}
+
+static std::int64_t __cell_key(int cx, int cy) TBAG_NOEXCEPT
+{
+    return static_cast<std::int64_t>(
+            (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32) |
+            static_cast<std::uint64_t>(static_cast<std::uint32_t>(cy)));
+}
+
+static int __cell_x(std::int64_t key) TBAG_NOEXCEPT
+{
+    return static_cast<int>(static_cast<std::int32_t>(static_cast<std::uint64_t>(key) >> 32));
+}
+
+static int __cell_y(std::int64_t key) TBAG_NOEXCEPT
+{
+    return static_cast<int>(static_cast<std::int32_t>(static_cast<std::uint32_t>(key)));
+}
+
+static bool __is_overlap(Rect const & a, Rect const & b) TBAG_NOEXCEPT
+{
+    return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+           a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+
+static std::int64_t __distance2(Point const & p, Rect const & r) TBAG_NOEXCEPT
+{
+    std::int64_t const dx = std::max(std::max(r.x - p.x, 0), p.x - (r.x + r.width));
+    std::int64_t const dy = std::max(std::max(r.y - p.y, 0), p.y - (r.y + r.height));
+    return dx * dx + dy * dy;
+}
+
+namespace {
+
+/**
+ * Uniform grid of the bounds.
+ *
+ * @remarks
+ *  The entry is registered to all cells which overlap its bounds. @n
+ *  The query reports the entry only in its first cell of the region,
+ *  so the results are not duplicated without the shared state,
+ *  and the queries can be called from the multiple threads.
+ */
+struct Grid
+{
+    struct Entry
+    {
+        void * item = nullptr;
+        TiledIndex::TmxLayer * layer = nullptr;
+
+        Rect bounds;
+        int offset_x = 0;
+        int offset_y = 0;
+
+        /** Range of the cells. (inclusive) */
+        int min_cx = 0, min_cy = 0;
+        int max_cx = 0, max_cy = 0;
+
+        bool alive = false;
+    };
+
+    using Indexes = std::vector<std::size_t>;
+
+    int cell_size = TiledIndex::DEFAULT_CELL_SIZE;
+
+    std::vector<Entry> entries;
+    Indexes free_entries;
+    std::unordered_map<std::int64_t, Indexes> cells;
+    std::unordered_map<void const *, std::size_t> lookup;
+
+    /** Range of the used cells. It is not shrunk by the removal. */
+    int min_cx = 0, min_cy = 0;
+    int max_cx = -1, max_cy = -1;
+
+    inline std::size_t size() const TBAG_NOEXCEPT
+    { return lookup.size(); }
+
+    void clear()
+    {
+        entries.clear();
+        free_entries.clear();
+        cells.clear();
+        lookup.clear();
+        min_cx = min_cy = 0;
+        max_cx = max_cy = -1;
+    }
+
+    void setCells(Entry & e)
+    {
+        e.min_cx = __floor_div(e.bounds.x, cell_size);
+        e.min_cy = __floor_div(e.bounds.y, cell_size);
+        e.max_cx = __floor_div(e.bounds.x + e.bounds.width, cell_size);
+        e.max_cy = __floor_div(e.bounds.y + e.bounds.height, cell_size);
+    }
+
+    void addToCells(std::size_t index)
+    {
+        auto const & e = entries[index];
+        for (auto cy = e.min_cy; cy <= e.max_cy; ++cy) {
+            for (auto cx = e.min_cx; cx <= e.max_cx; ++cx) {
+                cells[__cell_key(cx, cy)].push_back(index);
+            }
+        }
+        if (max_cx < min_cx) {
+            min_cx = e.min_cx;
+            min_cy = e.min_cy;
+            max_cx = e.max_cx;
+            max_cy = e.max_cy;
+        } else {
+            min_cx = std::min(min_cx, e.min_cx);
+            min_cy = std::min(min_cy, e.min_cy);
+            max_cx = std::max(max_cx, e.max_cx);
+            max_cy = std::max(max_cy, e.max_cy);
+        }
+    }
+
+    void removeFromCells(std::size_t index)
+    {
+        auto const & e = entries[index];
+        for (auto cy = e.min_cy; cy <= e.max_cy; ++cy) {
+            for (auto cx = e.min_cx; cx <= e.max_cx; ++cx) {
+                auto itr = cells.find(__cell_key(cx, cy));
+                assert(itr != cells.end());
+                auto & indexes = itr->second;
+                auto found = std::find(indexes.begin(), indexes.end(), index);
+                assert(found != indexes.end());
+                *found = indexes.back();
+                indexes.pop_back();
+                if (indexes.empty()) {
+                    cells.erase(itr);
+                }
+            }
+        }
+    }
+
+    Err insert(void * item, TiledIndex::TmxLayer * layer, Rect const & bounds, int offset_x, int offset_y)
+    {
+        if (lookup.find(item) != lookup.end()) {
+            return E_ALREADY;
+        }
+
+        std::size_t index;
+        if (free_entries.empty()) {
+            index = entries.size();
+            entries.emplace_back();
+        } else {
+            index = free_entries.back();
+            free_entries.pop_back();
+        }
+
+        auto & e = entries[index];
+        e.item = item;
+        e.layer = layer;
+        e.bounds = bounds;
+        e.offset_x = offset_x;
+        e.offset_y = offset_y;
+        e.alive = true;
+        setCells(e);
+        addToCells(index);
+        lookup.emplace(item, index);
+        return E_SUCCESS;
+    }
+
+    void move(std::size_t index, Rect const & bounds)
+    {
+        auto & e = entries[index];
+        auto const prev = e;
+        e.bounds = bounds;
+        setCells(e);
+        if (prev.min_cx == e.min_cx && prev.min_cy == e.min_cy &&
+            prev.max_cx == e.max_cx && prev.max_cy == e.max_cy) {
+            return;
+        }
+
+        auto const next = e;
+        e = prev;
+        removeFromCells(index);
+        e = next;
+        addToCells(index);
+    }
+
+    void erase(std::size_t index)
+    {
+        removeFromCells(index);
+        auto & e = entries[index];
+        lookup.erase(e.item);
+        e.item = nullptr;
+        e.layer = nullptr;
+        e.alive = false;
+        free_entries.push_back(index);
+    }
+
+    Entry const * find(void const * item) const
+    {
+        auto itr = lookup.find(item);
+        if (itr == lookup.end()) {
+            return nullptr;
+        }
+        return &entries[itr->second];
+    }
+
+    /** The entries of the cell may be visited again by the other cells. */
+    template <typename Predicate>
+    void visitCell(std::int64_t key, Predicate & predicate) const
+    {
+        auto itr = cells.find(key);
+        if (itr == cells.end()) {
+            return;
+        }
+        for (auto index : itr->second) {
+            predicate(entries[index]);
+        }
+    }
+
+    template <typename Predicate>
+    void query(Rect const & rect, Predicate predicate) const
+    {
+        if (cells.empty()) {
+            return;
+        }
+
+        auto const x1 = std::max(__floor_div(rect.x, cell_size), min_cx);
+        auto const y1 = std::max(__floor_div(rect.y, cell_size), min_cy);
+        auto const x2 = std::min(__floor_div(rect.x + rect.width, cell_size), max_cx);
+        auto const y2 = std::min(__floor_div(rect.y + rect.height, cell_size), max_cy);
+        if (x2 < x1 || y2 < y1) {
+            return;
+        }
+
+        // Report the entry only in the first cell of the overlapped cells.
+        auto filter = [&](int cx, int cy, Entry const & e){
+            if (cx == std::max(e.min_cx, x1) && cy == std::max(e.min_cy, y1) && __is_overlap(e.bounds, rect)) {
+                predicate(e);
+            }
+        };
+
+        auto const range_cells = static_cast<std::uint64_t>(x2 - x1 + 1) * static_cast<std::uint64_t>(y2 - y1 + 1);
+        if (range_cells <= cells.size()) {
+            for (auto cy = y1; cy <= y2; ++cy) {
+                for (auto cx = x1; cx <= x2; ++cx) {
+                    auto cell_filter = [&](Entry const & e){ filter(cx, cy, e); };
+                    visitCell(__cell_key(cx, cy), cell_filter);
+                }
+            }
+        } else {
+            // The region is larger than the used cells.
+            for (auto const & cell : cells) {
+                auto const cx = __cell_x(cell.first);
+                auto const cy = __cell_y(cell.first);
+                if (cx < x1 || x2 < cx || cy < y1 || y2 < cy) {
+                    continue;
+                }
+                for (auto index : cell.second) {
+                    filter(cx, cy, entries[index]);
+                }
+            }
+        }
+    }
+
+    Entry const * nearest(Point const & point, int max_distance) const
+    {
+        if (cells.empty()) {
+            return nullptr;
+        }
+
+        auto const pcx = __floor_div(point.x, cell_size);
+        auto const pcy = __floor_div(point.y, cell_size);
+        auto max_ring = std::max(std::max(pcx - min_cx, max_cx - pcx), std::max(pcy - min_cy, max_cy - pcy));
+        auto best_distance2 = std::numeric_limits<std::int64_t>::max();
+        if (max_distance >= 0) {
+            max_ring = std::min(max_ring, max_distance / cell_size + 1);
+            best_distance2 = static_cast<std::int64_t>(max_distance) * max_distance;
+        }
+
+        Entry const * best = nullptr;
+        auto update = [&](Entry const & e){
+            auto const distance2 = __distance2(point, e.bounds);
+            if (distance2 < best_distance2 || (best == nullptr && distance2 == best_distance2)) {
+                best = &e;
+                best_distance2 = distance2;
+            }
+        };
+
+        visitCell(__cell_key(pcx, pcy), update);
+        for (int ring = 1; ring <= max_ring; ++ring) {
+            // The point can be anywhere in its cell.
+            auto const min_distance = static_cast<std::int64_t>(ring - 1) * cell_size;
+            if (best != nullptr && min_distance * min_distance > best_distance2) {
+                break;
+            }
+            for (auto cx = pcx - ring; cx <= pcx + ring; ++cx) {
+                visitCell(__cell_key(cx, pcy - ring), update);
+                visitCell(__cell_key(cx, pcy + ring), update);
+            }
+            for (auto cy = pcy - ring + 1; cy <= pcy + ring - 1; ++cy) {
+                visitCell(__cell_key(pcx - ring, cy), update);
+                visitCell(__cell_key(pcx + ring, cy), update);
+            }
+        }
+        return best;
+    }
+};
+
+} // namespace
+
+/**
+ * TiledIndex::Impl class implementation.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ */
+struct TiledIndex::Impl : private Noncopyable
+{
+    int const PREFERRED_CELL_SIZE;
+
+    Grid objects;
+    Grid chunks;
+
+    Impl(int cell_size) : PREFERRED_CELL_SIZE(cell_size)
+    {
+        setCellSize(cell_size > 0 ? cell_size : DEFAULT_CELL_SIZE);
+    }
+
+    ~Impl()
+    { /* EMPTY. */ }
+
+    void setCellSize(int cell_size)
+    {
+        objects.cell_size = cell_size;
+        chunks.cell_size = cell_size;
+    }
+
+    void clear()
+    {
+        objects.clear();
+        chunks.clear();
+    }
+
+    static Rect moveRect(Rect const & rect, int x, int y)
+    {
+        return Rect(rect.x + x, rect.y + y, rect.width, rect.height);
+    }
+
+    void insertObjectGroup(TmxObjectGroup & group, int offset_x, int offset_y)
+    {
+        offset_x += group.offsetx;
+        offset_y += group.offsety;
+        for (auto & object : group.objects) {
+            objects.insert(&object, nullptr, moveRect(calcBounds(object), offset_x, offset_y), offset_x, offset_y);
+        }
+    }
+
+    void insertLayer(TmxLayer & layer, int offset_x, int offset_y, int tile_width, int tile_height)
+    {
+        offset_x += layer.offsetx;
+        offset_y += layer.offsety;
+        for (auto & chunk : layer.data.chunks) {
+            Rect const bounds(offset_x + chunk.x * tile_width,
+                              offset_y + chunk.y * tile_height,
+                              chunk.width * tile_width,
+                              chunk.height * tile_height);
+            chunks.insert(&chunk, &layer, bounds, offset_x, offset_y);
+        }
+    }
+
+    void insertGroup(TmxGroup & group, int offset_x, int offset_y, int tile_width, int tile_height)
+    {
+        offset_x += group.offsetx;
+        offset_y += group.offsety;
+        for (auto & object_group : group.object_groups) {
+            insertObjectGroup(object_group, offset_x, offset_y);
+        }
+        for (auto & layer : group.layers) {
+            insertLayer(layer, offset_x, offset_y, tile_width, tile_height);
+        }
+        for (auto & child : group.groups) {
+            insertGroup(child, offset_x, offset_y, tile_width, tile_height);
+        }
+    }
+};
+
+// -------------------------
+// TiledIndex implementation
+// -------------------------
+
+TiledIndex::TiledIndex(int cell_size) : _impl(std::make_unique<Impl>(cell_size))
+{
+    assert(static_cast<bool>(_impl));
+}
+
+TiledIndex::~TiledIndex()
+{
+    // EMPTY.
+}
+
+int TiledIndex::getCellSize() const TBAG_NOEXCEPT
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->objects.cell_size;
+}
+
+std::size_t TiledIndex::size() const TBAG_NOEXCEPT
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->objects.size();
+}
+
+bool TiledIndex::empty() const TBAG_NOEXCEPT
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->objects.size() == 0 && _impl->chunks.size() == 0;
+}
+
+std::size_t TiledIndex::getChunkCount() const TBAG_NOEXCEPT
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->chunks.size();
+}
+
+void TiledIndex::clear()
+{
+    assert(static_cast<bool>(_impl));
+    _impl->clear();
+}
+
+Err TiledIndex::build(TmxMap & map)
+{
+    assert(static_cast<bool>(_impl));
+    if (map.tile_width <= 0 || map.tile_height <= 0) {
+        return E_ILLARGS;
+    }
+
+    _impl->clear();
+    if (_impl->PREFERRED_CELL_SIZE > 0) {
+        _impl->setCellSize(_impl->PREFERRED_CELL_SIZE);
+    } else {
+        _impl->setCellSize(std::max(map.tile_width, map.tile_height) * TILES_PER_CELL);
+    }
+
+    for (auto & object_group : map.object_groups) {
+        _impl->insertObjectGroup(object_group, 0, 0);
+    }
+    for (auto & layer : map.layers) {
+        _impl->insertLayer(layer, 0, 0, map.tile_width, map.tile_height);
+    }
+    for (auto & group : map.groups) {
+        _impl->insertGroup(group, 0, 0, map.tile_width, map.tile_height);
+    }
+    return E_SUCCESS;
+}
+
+Err TiledIndex::insert(TmxObject & object, int offset_x, int offset_y)
+{
+    assert(static_cast<bool>(_impl));
+    auto const bounds = Impl::moveRect(calcBounds(object), offset_x, offset_y);
+    return _impl->objects.insert(&object, nullptr, bounds, offset_x, offset_y);
+}
+
+Err TiledIndex::insert(TmxObjectGroup const & group, TmxObject & object)
+{
+    return insert(object, group.offsetx, group.offsety);
+}
+
+Err TiledIndex::update(TmxObject const & object)
+{
+    assert(static_cast<bool>(_impl));
+    auto itr = _impl->objects.lookup.find(&object);
+    if (itr == _impl->objects.lookup.end()) {
+        return E_NFOUND;
+    }
+    auto const & e = _impl->objects.entries[itr->second];
+    _impl->objects.move(itr->second, Impl::moveRect(calcBounds(object), e.offset_x, e.offset_y));
+    return E_SUCCESS;
+}
+
+Err TiledIndex::remove(TmxObject const & object)
+{
+    assert(static_cast<bool>(_impl));
+    auto itr = _impl->objects.lookup.find(&object);
+    if (itr == _impl->objects.lookup.end()) {
+        return E_NFOUND;
+    }
+    _impl->objects.erase(itr->second);
+    return E_SUCCESS;
+}
+
+bool TiledIndex::exists(TmxObject const & object) const
+{
+    assert(static_cast<bool>(_impl));
+    return _impl->objects.find(&object) != nullptr;
+}
+
+Err TiledIndex::getBounds(TmxObject const & object, Rect & bounds) const
+{
+    assert(static_cast<bool>(_impl));
+    auto const * e = _impl->objects.find(&object);
+    if (e == nullptr) {
+        return E_NFOUND;
+    }
+    bounds = e->bounds;
+    return E_SUCCESS;
+}
+
+std::size_t TiledIndex::queryRect(Rect const & rect, Objects & result) const
+{
+    assert(static_cast<bool>(_impl));
+    Rect const normalized(rect.ltx(), rect.lty(), std::abs(rect.width), std::abs(rect.height));
+    auto const prev_size = result.size();
+    _impl->objects.query(normalized, [&](Grid::Entry const & e){
+        result.push_back(static_cast<TmxObject*>(e.item));
+    });
+    return result.size() - prev_size;
+}
+
+std::size_t TiledIndex::queryPoint(Point const & point, Objects & result) const
+{
+    return queryRect(Rect(point.x, point.y, 0, 0), result);
+}
+
+TiledIndex::TmxObject * TiledIndex::nearest(Point const & point, int max_distance) const
+{
+    assert(static_cast<bool>(_impl));
+    auto const * e = _impl->objects.nearest(point, max_distance);
+    return e ? static_cast<TmxObject*>(e->item) : nullptr;
+}
+
+std::size_t TiledIndex::queryChunks(Rect const & rect, ChunkRefs & result) const
+{
+    assert(static_cast<bool>(_impl));
+    Rect const normalized(rect.ltx(), rect.lty(), std::abs(rect.width), std::abs(rect.height));
+    auto const prev_size = result.size();
+    _impl->chunks.query(normalized, [&](Grid::Entry const & e){
+        ChunkRef ref;
+        ref.layer = e.layer;
+        ref.chunk = static_cast<TmxChunk*>(e.item);
+        ref.bounds = e.bounds;
+        result.push_back(ref);
+    });
+    return result.size() - prev_size;
+}
+
+TiledIndex::Rect TiledIndex::calcBounds(TmxObject const & object)
+{
+    int min_x = std::min(0, object.width);
+    int max_x = std::max(0, object.width);
+    int min_y;
+    int max_y;
+    if (object.gid != 0) {
+        // The tile objects are aligned to the bottom-left.
+        min_y = std::min(0, -object.height);
+        max_y = std::max(0, -object.height);
+    } else {
+        min_y = std::min(0, object.height);
+        max_y = std::max(0, object.height);
+    }
+
+    auto const extend = [&](Point const & p){
+        min_x = std::min(min_x, p.x);
+        min_y = std::min(min_y, p.y);
+        max_x = std::max(max_x, p.x);
+        max_y = std::max(max_y, p.y);
+    };
+    for (auto const & p : object.polygon) {
+        extend(p);
+    }
+    for (auto const & p : object.polyline) {
+        extend(p);
+    }
+
+    if (object.rotation % 360 != 0) {
+        // Rotated clockwise around the position of the object.
+        auto const radian = object.rotation * 3.14159265358979323846 / 180.0;
+        auto const c = std::cos(radian);
+        auto const s = std::sin(radian);
+        int const corners[4][2] = { {min_x, min_y}, {max_x, min_y}, {min_x, max_y}, {max_x, max_y} };
+
+        auto rx1 = std::numeric_limits<double>::max();
+        auto ry1 = std::numeric_limits<double>::max();
+        auto rx2 = std::numeric_limits<double>::lowest();
+        auto ry2 = std::numeric_limits<double>::lowest();
+        for (auto const & corner : corners) {
+            auto const x = corner[0] * c - corner[1] * s;
+            auto const y = corner[0] * s + corner[1] * c;
+            rx1 = std::min(rx1, x);
+            ry1 = std::min(ry1, y);
+            rx2 = std::max(rx2, x);
+            ry2 = std::max(ry2, y);
+        }
+
+        // Ignore the rounding error of the trigonometric functions.
+        double const EPSILON = 1.0e-6;
+        min_x = static_cast<int>(std::floor(rx1 + EPSILON));
+        min_y = static_cast<int>(std::floor(ry1 + EPSILON));
+        max_x = static_cast<int>(std::ceil(rx2 - EPSILON));
+        max_y = static_cast<int>(std::ceil(ry2 - EPSILON));
+    }
+
+    return Rect(object.x + min_x, object.y + min_y, max_x - min_x, max_y - min_y);
+}
+
+} // namespace tiled
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
@@ -0,0 +1,201 @@
+/**
+ * @file   TiledIndex.hpp
+ * @brief  TiledIndex class prototype.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Document the thread safety of the queries)
+ */
+
+#ifndef __INCLUDE_LIBTBAG__LIBTBAG_TILED_TILEDINDEX_HPP__
+#define __INCLUDE_LIBTBAG__LIBTBAG_TILED_TILEDINDEX_HPP__
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <libtbag/config.h>
+#include <libtbag/predef.hpp>
+#include <libtbag/Noncopyable.hpp>
+#include <libtbag/Err.hpp>
+#include <libtbag/geometry/Point2.hpp>
+#include <libtbag/geometry/Rect2.hpp>
+#include <libtbag/tiled/details/TmxMap.hpp>
+
+#include <memory>
+#include <vector>
+
+// -------------------
+NAMESPACE_LIBTBAG_OPEN
+// -------------------
+
+namespace tiled {
+
+/**
+ * TiledIndex class prototype.
+ *
+ * @author zer0
+ * @date   2026-10-19
+ *
+ * @remarks
+ *  The spatial index of the objects and the chunks of the TmxMap. @n
+ *  The bounds are registered to the cells of the uniform grid,
+ *  so the queries visit only the cells which overlap the region. @n
+ *  All coordinates are in pixels, and the offsets of the groups and the layers are applied.
+ *
+ * @warning
+ *  The index keeps the pointers of the objects and the chunks. @n
+ *  If the vectors of the map are resized, the index must be built again. @n
+ *  The const queries can be called from the multiple threads at the same time,
+ *  but the build, the insert, the update, the remove and the clear must not be
+ *  called concurrently with any other method.
+ */
+class TBAG_API TiledIndex : private Noncopyable
+{
+public:
+    using TmxMap = libtbag::tiled::details::TmxMap;
+    using TmxGroup = libtbag::tiled::details::TmxGroup;
+    using TmxLayer = libtbag::tiled::details::TmxLayer;
+    using TmxChunk = libtbag::tiled::details::TmxChunk;
+    using TmxObject = libtbag::tiled::details::TmxObject;
+    using TmxObjectGroup = libtbag::tiled::details::TmxObjectGroup;
+
+    using Point = libtbag::geometry::Point2i;
+    using Rect = libtbag::geometry::Rect2i;
+
+    using Objects = std::vector<TmxObject*>;
+
+    struct ChunkRef
+    {
+        TmxLayer * layer = nullptr;
+        TmxChunk * chunk = nullptr;
+
+        /** Extent of the chunk in pixels. */
+        Rect bounds;
+    };
+
+    using ChunkRefs = std::vector<ChunkRef>;
+
+    TBAG_CONSTEXPR static int const DEFAULT_CELL_SIZE = 256;
+
+    /** The cell size is the tile size multiplied by this value, if not specified. */
+    TBAG_CONSTEXPR static int const TILES_PER_CELL = 8;
+
+public:
+    struct Impl;
+    friend struct Impl;
+
+    using UniqueImpl = std::unique_ptr<Impl>;
+
+private:
+    UniqueImpl _impl;
+
+public:
+    /**
+     * @param[in] cell_size
+     *  Size of the cell in pixels. If it is 0, it is decided by the tile size of the map.
+     */
+    TiledIndex(int cell_size = 0);
+    ~TiledIndex();
+
+public:
+    int getCellSize() const TBAG_NOEXCEPT;
+
+    /** Number of the objects. */
+    std::size_t size() const TBAG_NOEXCEPT;
+    bool empty() const TBAG_NOEXCEPT;
+
+    /** Number of the chunks. */
+    std::size_t getChunkCount() const TBAG_NOEXCEPT;
+
+    void clear();
+
+public:
+    /**
+     * Register the objects of all object groups and the chunks of all layers.
+     * The nested groups are included.
+     */
+    Err build(TmxMap & map);
+
+public:
+    /**
+     * Register the object.
+     *
+     * @param[in] offset_x, offset_y
+     *  Offset of the object group and its parent groups in pixels.
+     *
+     * @return
+     *  E_ALREADY if the object is already registered.
+     */
+    Err insert(TmxObject & object, int offset_x = 0, int offset_y = 0);
+
+    /** Register the object with the offset of the object group. */
+    Err insert(TmxObjectGroup const & group, TmxObject & object);
+
+    /**
+     * Update the bounds of the moved or resized object.
+     * The cells are changed only if the object leaves its cells.
+     *
+     * @return
+     *  E_NFOUND if the object is not registered.
+     */
+    Err update(TmxObject const & object);
+
+    /**
+     * @return
+     *  E_NFOUND if the object is not registered.
+     */
+    Err remove(TmxObject const & object);
+
+    bool exists(TmxObject const & object) const;
+
+    /** Bounds of the registered object in pixels. */
+    Err getBounds(TmxObject const & object, Rect & bounds) const;
+
+public:
+    /**
+     * Find the objects which overlap the region.
+     * The edges are included, and the result is not cleared.
+     *
+     * @return
+     *  Number of the found objects.
+     */
+    std::size_t queryRect(Rect const & rect, Objects & result) const;
+
+    /** Find the objects whose bounds contain the point. */
+    std::size_t queryPoint(Point const & point, Objects & result) const;
+
+    /**
+     * Find the object whose bounds are the nearest to the point.
+     *
+     * @param[in] max_distance
+     *  Objects farther than this value are ignored. If it is negative, there is no limit.
+     *
+     * @return
+     *  nullptr if there is no object.
+     */
+    TmxObject * nearest(Point const & point, int max_distance = -1) const;
+
+    /** Find the chunks which overlap the region. */
+    std::size_t queryChunks(Rect const & rect, ChunkRefs & result) const;
+
+public:
+    /**
+     * Bounds of the object in pixels. (without the offsets)
+     *
+     * @remarks
+     *  The points of the polygon and the polyline are included,
+     *  the tile objects are aligned to the bottom-left,
+     *  and the rotated objects use the bounding box of the rotated corners.
+     */
+    static Rect calcBounds(TmxObject const & object);
+};
+
+} // namespace tiled
+
+// --------------------
+NAMESPACE_LIBTBAG_CLOSE
+// --------------------
+
+#endif // __INCLUDE_LIBTBAG__LIBTBAG_TILED_TILEDINDEX_HPP__
+
@@ -3,10 +3,14 @@
  * @brief  TiledMap class implementation.
  * @author zer0
  * @date   2020-01-07
+ * @date   2026-10-19 (Read the file from the memory mapping)
+ * @date   2026-10-19 (Add the decoding modes)
+ * @date   2026-10-19 (Add the spatial index)
  */
 
 #include <libtbag/tiled/TiledMap.hpp>
 #include <libtbag/filesystem/File.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -14,7 +18,8 @@ NAMESPACE_LIBTBAG_OPEN
 
 namespace tiled {
 
-TiledMap::TiledMap(Callbacks * cb) : _cb(cb)
+TiledMap::TiledMap(Callbacks * cb)
+        : _cb(cb), _decode_mode(DecodeMode::IMMEDIATE), _decode_threads(0), _indexing(false)
 {
     // EMPTY.
 }
@@ -26,23 +31,53 @@ TiledMap::~TiledMap()
 
 Err TiledMap::readFromFile(std::string const & path, bool auto_init)
 {
-    std::string content;
-    auto const read_code = libtbag::filesystem::readFile(path, content);
+    libtbag::filesystem::MappedFile file;
+    auto const read_code = libtbag::filesystem::readFile(path, file);
     if (isFailure(read_code)) {
         return read_code;
     }
-    return readFromXmlText(content, auto_init);
+    return readFromXmlText(file.data(), file.size(), auto_init);
 }
 
 Err TiledMap::readFromXmlText(std::string const & xml, bool auto_init)
 {
-    auto const code = _map.read(xml);
+    return readFromXmlText(xml.data(), xml.size(), auto_init);
+}
+
+Err TiledMap::readFromXmlText(char const * xml, std::size_t size, bool auto_init)
+{
+    auto code = _map.read(xml, size, _decode_mode != DecodeMode::IMMEDIATE);
+    if (isSuccess(code) && _decode_mode == DecodeMode::PARALLEL) {
+        code = _map.decode(_decode_threads);
+    }
+
+    // The pointers of the previous map are invalid.
+    _index.clear();
+    if (isSuccess(code) && _indexing) {
+        code = _index.build(_map);
+    }
+
     if (isSuccess(code) && auto_init) {
         init();
     }
     return code;
 }
 
+Err TiledMap::buildIndex()
+{
+    return _index.build(_map);
+}
+
+Err TiledMap::decodeRegion(int x, int y, int width, int height)
+{
+    return _map.decode(_decode_context, x, y, width, height);
+}
+
+Err TiledMap::decodeAll()
+{
+    return _map.decode(_decode_threads);
+}
+
 Err TiledMap::writeToFile(std::string const & path) const
 {
     std::string content;
@@ -3,6 +3,9 @@
  * @brief  TiledMap class prototype.
  * @author zer0
  * @date   2020-01-07
+ * @date   2026-10-19 (Read the file from the memory mapping)
+ * @date   2026-10-19 (Add the decoding modes)
+ * @date   2026-10-19 (Add the spatial index)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_TILED_TILEDMAP_HPP__
@@ -18,6 +21,7 @@
 #include <libtbag/Noncopyable.hpp>
 #include <libtbag/Err.hpp>
 #include <libtbag/tiled/details/TmxMap.hpp>
+#include <libtbag/tiled/TiledIndex.hpp>
 
 #include <string>
 
@@ -38,6 +42,22 @@ class TBAG_API TiledMap : private Noncopyable
 public:
     using TmxMap = libtbag::tiled::details::TmxMap;
     using TmxTileSet = libtbag::tiled::details::TmxTileSet;
+    using DecodeContext = libtbag::tiled::details::TmxDataCommon::DecodeContext;
+
+    /**
+     * How the gids of the layers are decoded by the readers.
+     */
+    enum class DecodeMode
+    {
+        /** Decode while the XML is read. */
+        IMMEDIATE,
+
+        /** Decode the layers and the chunks on the threads after the XML is read. */
+        PARALLEL,
+
+        /** Decode the chunks when the region is requested. (See decodeRegion()) */
+        LAZY,
+    };
 
 public:
     struct Callbacks
@@ -54,6 +74,17 @@ private:
 private:
     TmxMap _map;
 
+private:
+    DecodeMode _decode_mode;
+    std::size_t _decode_threads;
+
+    /** Used by the LAZY mode. */
+    DecodeContext _decode_context;
+
+private:
+    bool _indexing;
+    TiledIndex _index;
+
 public:
     TiledMap(Callbacks * cb = nullptr);
     virtual ~TiledMap();
@@ -62,13 +93,49 @@ public:
     inline Callbacks * getCallbacks() const TBAG_NOEXCEPT { return _cb; }
     inline void setCallbacks(Callbacks * cb) TBAG_NOEXCEPT { _cb = cb; }
 
+public:
+    inline DecodeMode getDecodeMode() const TBAG_NOEXCEPT { return _decode_mode; }
+    inline std::size_t getDecodeThreads() const TBAG_NOEXCEPT { return _decode_threads; }
+
+    /**
+     * @param[in] thread_count
+     *  Number of the threads of the PARALLEL mode. If it is 0, the number of the cores is used.
+     */
+    inline void setDecodeMode(DecodeMode mode, std::size_t thread_count = 0) TBAG_NOEXCEPT
+    { _decode_mode = mode; _decode_threads = thread_count; }
+
 public:
     inline TmxMap       & map()       TBAG_NOEXCEPT { return _map; }
     inline TmxMap const & map() const TBAG_NOEXCEPT { return _map; }
 
+public:
+    inline bool isIndexing() const TBAG_NOEXCEPT { return _indexing; }
+
+    /** If enabled, the readers build the spatial index of the objects and the chunks. */
+    inline void setIndexing(bool enable = true) TBAG_NOEXCEPT { _indexing = enable; }
+
+    inline TiledIndex       & index()       TBAG_NOEXCEPT { return _index; }
+    inline TiledIndex const & index() const TBAG_NOEXCEPT { return _index; }
+
+    /** Build the spatial index again. (e.g. after the objects are added to the map) */
+    Err buildIndex();
+
 public:
     Err readFromFile(std::string const & path, bool auto_init = true);
     Err readFromXmlText(std::string const & xml, bool auto_init = true);
+    Err readFromXmlText(char const * xml, std::size_t size, bool auto_init = true);
+
+public:
+    /**
+     * Decode the deferred chunks which overlap the region. (in tiles)
+     *
+     * @warning
+     *  This method is not thread-safe.
+     */
+    Err decodeRegion(int x, int y, int width, int height);
+
+    /** Decode all deferred gids and chunks with the threads of the PARALLEL mode. */
+    Err decodeAll();
 
 public:
     Err writeToFile(std::string const & path) const;
@@ -3,6 +3,7 @@
  * @brief  TmxChunk class implementation.
  * @author zer0
  * @date   2019-07-10
+ * @date   2026-10-19 (Deferred decoding)
  */
 
 #include <libtbag/tiled/details/TmxChunk.hpp>
@@ -44,6 +45,25 @@ std::size_t TmxChunk::size() const
     return gids.size();
 }
 
+bool TmxChunk::intersects(int rx, int ry, int rw, int rh) const TBAG_NOEXCEPT
+{
+    return x < rx + rw && rx < x + width && y < ry + rh && ry < y + height;
+}
+
+Err TmxChunk::decode(DecodeContext & context, TileLayerFormat f)
+{
+    if (encoded.empty()) {
+        return E_SUCCESS;
+    }
+    std::size_t expected_size = 0;
+    if (width > 0 && height > 0) {
+        expected_size = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    }
+    auto const code = readGids(context, encoded.data(), encoded.size(), gids, f, expected_size);
+    std::string().swap(encoded);
+    return code;
+}
+
 Err TmxChunk::read(Element const & elem, TileLayerFormat f)
 {
     if (strncmp(elem.Name(), TAG_NAME, libtbag::string::string_length(TAG_NAME)) != 0) {
@@ -79,6 +99,59 @@ Err TmxChunk::read(std::string const & xml, Encoding e, Compression c)
     return read(xml, getTileLayerFormat(e, c));
 }
 
+Err TmxChunk::read(XmlReader & reader, TileLayerFormat f, bool defer)
+{
+    if (reader.token() != XmlReader::Token::START_ELEMENT || reader.name() != TAG_NAME) {
+        return E_ILLARGS;
+    }
+
+    reader.optAttr(ATT_X, x);
+    reader.optAttr(ATT_Y, y);
+    reader.optAttr(ATT_WIDTH, width);
+    reader.optAttr(ATT_HEIGHT, height);
+
+    std::size_t expected_size = 0;
+    if (width > 0 && height > 0) {
+        expected_size = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    }
+
+    gids.clear();
+    encoded.clear();
+    if (f == TileLayerFormat::XML) {
+        gids.reserve(expected_size);
+    }
+
+    ElementText text;
+    auto const chunk_depth = reader.depth();
+    while (true) {
+        auto const token = reader.next();
+        if (token == XmlReader::Token::FAILURE) {
+            return reader.getError();
+        }
+        if (token == XmlReader::Token::END_ELEMENT && reader.depth() == chunk_depth - 1) {
+            break;
+        }
+        if (token == XmlReader::Token::START_ELEMENT && reader.depth() == chunk_depth + 1) {
+            if (reader.name() == TAG_TILE && f == TileLayerFormat::XML) {
+                GlobalTileId gid;
+                reader.optAttr(ATT_GID, gid);
+                gids.push_back(gid);
+            }
+        } else if (token == XmlReader::Token::TEXT && reader.depth() == chunk_depth) {
+            text.append(reader);
+        }
+    }
+
+    if (f != TileLayerFormat::XML) {
+        if (defer) {
+            encoded.assign(text.data(), text.size());
+        } else {
+            readGids(text.data(), text.size(), gids, f, expected_size);
+        }
+    }
+    return E_SUCCESS;
+}
+
 Err TmxChunk::write(Element & elem, TileLayerFormat f) const
 {
     if (strncmp(elem.Name(), TAG_NAME, libtbag::string::string_length(TAG_NAME)) != 0) {
@@ -88,7 +161,11 @@ Err TmxChunk::write(Element & elem, TileLayerFormat f) const
     setAttr(elem, ATT_Y, y);
     setAttr(elem, ATT_WIDTH, width);
     setAttr(elem, ATT_HEIGHT, height);
-    writeGids(elem, gids, f);
+    if (!encoded.empty()) {
+        text(elem, encoded); // The deferred text is written as it is.
+    } else {
+        writeGids(elem, gids, f);
+    }
     return E_SUCCESS;
 }
 
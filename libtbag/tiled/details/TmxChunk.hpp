@@ -3,6 +3,7 @@
  * @brief  TmxChunk class prototype.
  * @author zer0
  * @date   2019-07-10
+ * @date   2026-10-19 (Deferred decoding)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_TILED_DETAILS_TMXCHUNK_HPP__
@@ -62,6 +63,9 @@ struct TBAG_API TmxChunk : public TmxDataCommon
 
     GlobalTileIds gids;
 
+    /** The text of the gids which is not decoded yet. */
+    std::string encoded;
+
     TmxChunk();
     TmxChunk(int x_, int y_, int w_, int h_);
     ~TmxChunk();
@@ -69,11 +73,28 @@ struct TBAG_API TmxChunk : public TmxDataCommon
     bool empty() const;
     std::size_t size() const;
 
+    inline bool isDeferred() const TBAG_NOEXCEPT
+    { return !encoded.empty(); }
+
+    /** Whether the chunk overlaps the region. (in tiles) */
+    bool intersects(int rx, int ry, int rw, int rh) const TBAG_NOEXCEPT;
+
+    /** Decode the deferred text into the gids. */
+    Err decode(DecodeContext & context, TileLayerFormat f);
+
     Err read(Element const & elem, TileLayerFormat f = TileLayerFormat::XML);
     Err read(Element const & elem, Encoding e, Compression c);
     Err read(std::string const & xml, TileLayerFormat f = TileLayerFormat::XML);
     Err read(std::string const & xml, Encoding e, Compression c);
 
+    /**
+     * Read the current start element of the pull reader.
+     *
+     * @param[in] defer
+     *  Keep the encoded text without the decoding. (See decode())
+     */
+    Err read(XmlReader & reader, TileLayerFormat f, bool defer = false);
+
     Err write(Element & elem, TileLayerFormat f = TileLayerFormat::XML) const;
     Err write(Element & elem, Encoding e, Compression c) const;
     Err write(std::string & xml, TileLayerFormat f = TileLayerFormat::XML) const;
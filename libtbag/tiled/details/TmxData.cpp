@@ -3,6 +3,8 @@
  * @brief  TmxData class implementation.
  * @author zer0
  * @date   2019-07-09
+ * @date   2026-10-19 (Read with the pull XML reader)
+ * @date   2026-10-19 (Deferred decoding)
  */
 
 #include <libtbag/tiled/details/TmxData.hpp>
@@ -73,6 +75,29 @@ void TmxData::clear()
     }
 }
 
+bool TmxData::isDeferred() const
+{
+    if (!encoded.empty()) {
+        return true;
+    }
+    for (auto const & chunk : chunks) {
+        if (chunk.isDeferred()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Err TmxData::decode(DecodeContext & context, std::size_t expected_size)
+{
+    if (encoded.empty()) {
+        return E_SUCCESS;
+    }
+    auto const code = readGids(context, encoded.data(), encoded.size(), gids, getTileLayerFormat(), expected_size);
+    std::string().swap(encoded);
+    return code;
+}
+
 Err TmxData::read(Element const & elem)
 {
     if (strncmp(elem.Name(), TAG_NAME, libtbag::string::string_length(TAG_NAME)) != 0) {
@@ -116,6 +141,71 @@ Err TmxData::read(std::string const & xml)
     return read(*elem);
 }
 
+Err TmxData::read(XmlReader & reader, std::size_t expected_size, bool defer)
+{
+    if (reader.token() != XmlReader::Token::START_ELEMENT || reader.name() != TAG_NAME) {
+        return E_ILLARGS;
+    }
+
+    std::string encoding_text;
+    reader.optAttr(ATT_ENCODING, encoding_text);
+    encoding = getEncoding(encoding_text);
+
+    std::string compression_text;
+    reader.optAttr(ATT_COMPRESSION, compression_text);
+    compression = getCompression(compression_text);
+
+    auto const format = getTileLayerFormat();
+    data_type = DataType::GIDS;
+    gids.clear();
+    chunks.clear();
+    encoded.clear();
+    if (format == TileLayerFormat::XML) {
+        gids.reserve(expected_size);
+    }
+
+    ElementText text;
+    auto const data_depth = reader.depth();
+    while (true) {
+        auto const token = reader.next();
+        if (token == XmlReader::Token::FAILURE) {
+            return reader.getError();
+        }
+        if (token == XmlReader::Token::END_ELEMENT && reader.depth() == data_depth - 1) {
+            break;
+        }
+
+        if (token == XmlReader::Token::START_ELEMENT && reader.depth() == data_depth + 1) {
+            if (reader.name() == TmxChunk::TAG_NAME) {
+                data_type = DataType::CHUNK;
+                TmxChunk chunk;
+                auto const code = chunk.read(reader, format, defer);
+                if (isFailure(code)) {
+                    return code;
+                }
+                chunks.push_back(std::move(chunk));
+            } else if (reader.name() == TAG_TILE && format == TileLayerFormat::XML) {
+                GlobalTileId gid;
+                reader.optAttr(ATT_GID, gid);
+                gids.push_back(gid);
+            }
+        } else if (token == XmlReader::Token::TEXT && reader.depth() == data_depth) {
+            text.append(reader);
+        }
+    }
+
+    if (data_type == DataType::CHUNK) {
+        gids.clear();
+    } else if (format != TileLayerFormat::XML) {
+        if (defer) {
+            encoded.assign(text.data(), text.size());
+        } else {
+            readGids(text.data(), text.size(), gids, format, expected_size);
+        }
+    }
+    return E_SUCCESS;
+}
+
 Err TmxData::write(Element & elem) const
 {
     if (strncmp(elem.Name(), TAG_NAME, libtbag::string::string_length(TAG_NAME)) != 0) {
@@ -126,7 +216,9 @@ Err TmxData::write(Element & elem) const
     setAttr(elem, ATT_COMPRESSION, getCompressionName(compression));
 
     if (data_type == DataType::GIDS) {
-        if (!gids.empty()) {
+        if (!encoded.empty()) {
+            text(elem, encoded); // The deferred text is written as it is.
+        } else if (!gids.empty()) {
             writeGids(elem, gids, encoding, compression);
         }
     } else {
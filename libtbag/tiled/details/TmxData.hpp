@@ -3,6 +3,8 @@
  * @brief  TmxData class prototype.
  * @author zer0
  * @date   2019-07-09
+ * @date   2026-10-19 (Read with the pull XML reader)
+ * @date   2026-10-19 (Deferred decoding)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_TILED_DETAILS_TMXDATA_HPP__
@@ -73,6 +75,9 @@ struct TBAG_API TmxData : public TmxDataCommon
     /** Only for infinite maps. */
     std::vector<TmxChunk> chunks;
 
+    /** The text of the gids which is not decoded yet. */
+    std::string encoded;
+
     TmxData();
     TmxData(Encoding e, Compression c, DataType d);
     ~TmxData();
@@ -86,9 +91,29 @@ struct TBAG_API TmxData : public TmxDataCommon
     std::size_t size() const;
     void clear();
 
+    /** Whether the gids or the chunks are not decoded yet. */
+    bool isDeferred() const;
+
+    /**
+     * Decode the deferred text into the gids. The chunks are not decoded.
+     *
+     * @see TmxChunk::decode()
+     */
+    Err decode(DecodeContext & context, std::size_t expected_size = 0);
+
     Err read(Element const & elem);
     Err read(std::string const & xml);
 
+    /**
+     * Read the current start element of the pull reader.
+     *
+     * @param[in] expected_size
+     *  Number of the gids. If it is not 0, the gids are decoded into the pre-sized array.
+     * @param[in] defer
+     *  Keep the encoded texts of the gids and the chunks without the decoding.
+     */
+    Err read(XmlReader & reader, std::size_t expected_size = 0, bool defer = false);
+
     Err write(Element & elem) const;
     Err write(std::string & xml) const;
 };
@@ -3,16 +3,20 @@
  * @brief  TmxDataCommon class implementation.
  * @author zer0
  * @date   2019-07-10
+ * @date   2026-10-19 (Read the gids from the text without the copy)
+ * @date   2026-10-19 (Add the reusable decoding context)
  */
 
 #include <libtbag/tiled/details/TmxDataCommon.hpp>
 #include <libtbag/bitwise/Endian.hpp>
 #include <libtbag/crypto/Base64.hpp>
 #include <libtbag/util/BufferInfo.hpp>
+#include <libtbag/archive/Zip.hpp>
 #include <libtbag/archive/ex/ZipBase64.hpp>
 #include <libtbag/string/StringUtils.hpp>
 
 #include <cassert>
+#include <cctype>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -230,8 +234,9 @@ TmxDataCommon::GlobalTileIds TmxDataCommon::readFromBase64(std::string const & t
     if (text.empty()) {
         return {};
     }
+    // The decoder skips the whitespaces.
     Buffer buffer;
-    if (!libtbag::crypto::decodeBase64(libtbag::string::trim(text), buffer)) {
+    if (!libtbag::crypto::decodeBase64(text, buffer)) {
         return {};
     }
     return convertGlobalTileIds(buffer);
@@ -244,7 +249,7 @@ TmxDataCommon::GlobalTileIds TmxDataCommon::readFromCompressedBase64(std::string
         return {};
     }
     Buffer buffer;
-    if (isFailure(decodeZipBase64(libtbag::string::trim(text), buffer))) {
+    if (isFailure(decodeZipBase64(text, buffer))) {
         return {};
     }
     return convertGlobalTileIds(buffer);
@@ -302,6 +307,161 @@ Err TmxDataCommon::readGids(Element const & elem, GlobalTileIds & gids, Encoding
     return readGids(elem, gids, getTileLayerFormat(e, c));
 }
 
+static void __gids_to_host(TmxDataCommon::GlobalTileIds & gids)
+{
+    if (libtbag::bitwise::isLittleEndianSystem()) {
+        return;
+    }
+    assert(libtbag::bitwise::isBigEndianSystem());
+    for (auto & gid : gids) {
+        gid = libtbag::bitwise::toHost(gid);
+    }
+}
+
+static Err __read_gids_from_base64(char const * input, std::size_t size, TmxDataCommon::GlobalTileIds & gids)
+{
+    using GlobalTileId = TmxDataCommon::GlobalTileId;
+    auto const max_bytes = libtbag::crypto::getDecodeLength(input, size);
+    gids.resize(max_bytes/sizeof(GlobalTileId) + 1);
+
+    std::size_t bytes = 0;
+    if (isFailure(libtbag::crypto::decodeBase64(input, size, (char*)gids.data(), &bytes))) {
+        return E_DECODE;
+    }
+    if ((bytes % sizeof(GlobalTileId)) != 0) {
+        return E_DECODE;
+    }
+    gids.resize(bytes/sizeof(GlobalTileId));
+    __gids_to_host(gids);
+    return E_SUCCESS;
+}
+
+static Err __read_gids_from_compressed_base64(TmxDataCommon::DecodeContext & context,
+                                              char const * input, std::size_t size,
+                                              TmxDataCommon::GlobalTileIds & gids,
+                                              std::size_t expected_size)
+{
+    using GlobalTileId = TmxDataCommon::GlobalTileId;
+    auto & compressed = context.buffer;
+    compressed.resize(libtbag::crypto::getDecodeLength(input, size) + 1);
+
+    std::size_t compressed_size = 0;
+    if (isFailure(libtbag::crypto::decodeBase64(input, size, compressed.data(), &compressed_size))) {
+        return E_DECODE;
+    }
+
+    if (expected_size >= 1) {
+        gids.resize(expected_size);
+        std::size_t bytes = 0;
+        auto const code = context.inflater.decode(compressed.data(), compressed_size, (char*)gids.data(),
+                                                  expected_size*sizeof(GlobalTileId), &bytes);
+        if (isSuccess(code)) {
+            if ((bytes % sizeof(GlobalTileId)) != 0) {
+                return E_DECODE;
+            }
+            gids.resize(bytes/sizeof(GlobalTileId));
+            __gids_to_host(gids);
+            return E_SUCCESS;
+        } else if (code != E_SMALLBUF) {
+            return E_DECODE;
+        }
+        // The data is larger than the expected size. Use the growing buffer.
+    }
+
+    libtbag::util::Buffer buffer;
+    if (isFailure(libtbag::archive::decode(compressed.data(), compressed_size, buffer))) {
+        return E_DECODE;
+    }
+    gids = TmxDataCommon::convertGlobalTileIds(buffer);
+    return E_SUCCESS;
+}
+
+static Err __read_gids_from_csv(char const * input, std::size_t size, TmxDataCommon::GlobalTileIds & gids,
+                                std::size_t expected_size)
+{
+    gids.clear();
+    gids.reserve(expected_size);
+
+    auto const * cursor = input;
+    auto const * end = input + size;
+    while (cursor < end) {
+        while (cursor < end && std::isspace(static_cast<unsigned char>(*cursor))) {
+            ++cursor;
+        }
+        if (cursor == end) {
+            break;
+        }
+
+        TmxDataCommon::GlobalTileId gid = 0;
+        while (cursor < end && '0' <= COMPARE_AND(*cursor) <= '9') {
+            gid = gid * 10 + static_cast<TmxDataCommon::GlobalTileId>(*cursor - '0');
+            ++cursor;
+        }
+        while (cursor < end && std::isspace(static_cast<unsigned char>(*cursor))) {
+            ++cursor;
+        }
+        if (cursor < end && *cursor != ',') {
+            return E_DECODE;
+        }
+        gids.push_back(gid);
+        if (cursor < end) {
+            ++cursor; // Skip the delimiter.
+        }
+    }
+    return E_SUCCESS;
+}
+
+void TmxDataCommon::ElementText::append(XmlReader const & reader)
+{
+    auto const text = reader.text();
+    if (!split && view.empty() && !reader.isTextEscaped()) {
+        view = text;
+        return;
+    }
+    if (!split) {
+        buffer.assign(view.data, view.size);
+        split = true;
+    }
+    if (reader.isTextEscaped()) {
+        XmlReader::decodeText(text, buffer);
+    } else {
+        buffer.append(text.data, text.size);
+    }
+}
+
+Err TmxDataCommon::readGids(char const * input, std::size_t size, GlobalTileIds & gids,
+                            TileLayerFormat f, std::size_t expected_size)
+{
+    DecodeContext context;
+    return readGids(context, input, size, gids, f, expected_size);
+}
+
+Err TmxDataCommon::readGids(DecodeContext & context, char const * input, std::size_t size, GlobalTileIds & gids,
+                            TileLayerFormat f, std::size_t expected_size)
+{
+    if (input == nullptr || size == 0) {
+        gids.clear();
+        return E_DECODE;
+    }
+
+    Err code;
+    if (f == TileLayerFormat::BASE64) {
+        code = __read_gids_from_base64(input, size, gids);
+    } else if (f == TileLayerFormat::GZIP_BASE64 || f == TileLayerFormat::ZLIB_BASE64) {
+        code = __read_gids_from_compressed_base64(context, input, size, gids, expected_size);
+    } else if (f == TileLayerFormat::CSV) {
+        code = __read_gids_from_csv(input, size, gids, expected_size);
+    } else {
+        return E_ILLARGS;
+    }
+
+    if (isFailure(code)) {
+        gids.clear();
+        return code;
+    }
+    return gids.empty() ? E_DECODE : E_SUCCESS;
+}
+
 Err TmxDataCommon::writeGids(Element & elem, GlobalTileId const * gids, std::size_t size, TileLayerFormat f)
 {
     assert(gids != nullptr);
@@ -3,6 +3,8 @@
  * @brief  TmxDataCommon class prototype.
  * @author zer0
  * @date   2019-07-10
+ * @date   2026-10-19 (Read the gids from the text without the copy)
+ * @date   2026-10-19 (Add the reusable decoding context)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_TILED_DETAILS_TMXDATACOMMON_HPP__
@@ -17,6 +19,8 @@
 #include <libtbag/predef.hpp>
 #include <libtbag/Err.hpp>
 #include <libtbag/dom/xml/XmlHelper.hpp>
+#include <libtbag/dom/xml/XmlReader.hpp>
+#include <libtbag/archive/Zip.hpp>
 #include <libtbag/util/BufferInfo.hpp>
 
 #include <cstdint>
@@ -62,6 +66,7 @@ struct TBAG_API TmxDataCommon : protected libtbag::dom::xml::XmlHelper
     TBAG_CONSTEXPR static char const * const VAL_ZLIB = "zlib";
 
     using Buffer = libtbag::util::Buffer;
+    using XmlReader = libtbag::dom::xml::XmlReader;
 
     /** Array of unsigned 32-bit integers using little-endian byte ordering. */
     using GlobalTileId  = std::uint32_t;
@@ -82,6 +87,38 @@ struct TBAG_API TmxDataCommon : protected libtbag::dom::xml::XmlHelper
         NONE, XML, BASE64, GZIP_BASE64, ZLIB_BASE64, CSV
     };
 
+    /**
+     * The reusable states of the decoder.
+     *
+     * @warning
+     *  This class is not thread-safe. Use one per thread.
+     */
+    struct DecodeContext
+    {
+        libtbag::archive::Inflater inflater;
+
+        /** The result of the base64 decoder. */
+        Buffer buffer;
+    };
+
+    /**
+     * The text of the element from the pull reader.
+     * The text is copied only if it is split. (e.g. by the comments)
+     */
+    struct ElementText
+    {
+        XmlReader::View view;
+        std::string buffer;
+        bool split = false;
+
+        void append(XmlReader const & reader);
+
+        inline char const * data() const TBAG_NOEXCEPT
+        { return split ? buffer.data() : view.data; }
+        inline std::size_t size() const TBAG_NOEXCEPT
+        { return split ? buffer.size() : view.size; }
+    };
+
     TmxDataCommon();
     ~TmxDataCommon();
 
@@ -112,6 +149,18 @@ struct TBAG_API TmxDataCommon : protected libtbag::dom::xml::XmlHelper
     static Err readGids(Element const & elem, GlobalTileIds & gids, TileLayerFormat f);
     static Err readGids(Element const & elem, GlobalTileIds & gids, Encoding e, Compression c);
 
+    /**
+     * Read the gids from the text of the data element.
+     *
+     * @param[in] expected_size
+     *  Number of the gids. (e.g. width * height of the layer)
+     *  If it is not 0, the compressed data is inflated into the gids directly.
+     */
+    static Err readGids(char const * input, std::size_t size, GlobalTileIds & gids,
+                        TileLayerFormat f, std::size_t expected_size = 0);
+    static Err readGids(DecodeContext & context, char const * input, std::size_t size, GlobalTileIds & gids,
+                        TileLayerFormat f, std::size_t expected_size = 0);
+
     static Err writeGids(Element & elem, GlobalTileId const * gids, std::size_t size, TileLayerFormat f);
     static Err writeGids(Element & elem, GlobalTileId const * gids, std::size_t size, Encoding e, Compression c);
     static Err writeGids(Element & elem, GlobalTileIds const & gids, TileLayerFormat f);
@@ -3,6 +3,8 @@
  * @brief  TmxLayer class implementation.
  * @author zer0
  * @date   2019-07-14
+ * @date   2026-10-19 (Read with the pull XML reader)
+ * @date   2026-10-19 (Deferred decoding)
  */
 
 #include <libtbag/tiled/details/TmxLayer.hpp>
@@ -85,6 +87,108 @@ Err TmxLayer::read(std::string const & xml)
     return read(*elem);
 }
 
+Err TmxLayer::read(XmlReader & reader, bool defer)
+{
+    if (reader.token() != XmlReader::Token::START_ELEMENT || reader.name() != TAG_NAME) {
+        return E_ILLARGS;
+    }
+
+    auto const code1 = reader.optAttr(ATT_NAME, name);
+    auto const code2 = reader.optAttr(ATT_WIDTH, width);
+    auto const code3 = reader.optAttr(ATT_HEIGHT, height);
+    if (isFailure(code1) || isFailure(code2) || isFailure(code3)) {
+        auto const skip_code = reader.skipElement();
+        if (isFailure(skip_code)) {
+            return skip_code;
+        }
+        return isFailure(code1) ? code1 : (isFailure(code2) ? code2 : code3);
+    }
+
+    reader.optAttr(ATT_ID, id);
+    reader.optAttr(ATT_X, x, VAL_DEFAULT_X);
+    reader.optAttr(ATT_Y, y, VAL_DEFAULT_Y);
+    reader.optAttr(ATT_OPACITY, opacity, VAL_DEFAULT_OPACITY);
+    reader.optAttr(ATT_VISIBLE, visible, VAL_DEFAULT_VISIBLE);
+    reader.optAttr(ATT_OFFSETX, offsetx, VAL_DEFAULT_OFFSETX);
+    reader.optAttr(ATT_OFFSETY, offsety, VAL_DEFAULT_OFFSETY);
+
+    auto const expected_size = getTileCount();
+    bool properties_found = false;
+    bool data_found = false;
+
+    auto const layer_depth = reader.depth();
+    while (true) {
+        auto const token = reader.next();
+        if (token == XmlReader::Token::FAILURE) {
+            return reader.getError();
+        }
+        if (token == XmlReader::Token::END_ELEMENT && reader.depth() == layer_depth - 1) {
+            break;
+        }
+        if (token != XmlReader::Token::START_ELEMENT || reader.depth() != layer_depth + 1) {
+            continue;
+        }
+
+        Err code;
+        if (!properties_found && reader.name() == TmxProperties::TAG_NAME) {
+            properties_found = true;
+            XmlReader::View source;
+            code = reader.skipElement(&source);
+            if (isSuccess(code)) {
+                properties.read(source.toString());
+            }
+        } else if (!data_found && reader.name() == TmxData::TAG_NAME) {
+            data_found = true;
+            code = data.read(reader, expected_size, defer);
+        } else {
+            code = reader.skipElement();
+        }
+
+        if (isFailure(code)) {
+            return code;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+std::size_t TmxLayer::getTileCount() const TBAG_NOEXCEPT
+{
+    if (width > 0 && height > 0) {
+        return static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    }
+    return 0;
+}
+
+Err TmxLayer::decode(DecodeContext & context)
+{
+    auto result = data.decode(context, getTileCount());
+    auto const format = data.getTileLayerFormat();
+    for (auto & chunk : data.chunks) {
+        auto const code = chunk.decode(context, format);
+        if (isSuccess(result)) {
+            result = code;
+        }
+    }
+    return result;
+}
+
+Err TmxLayer::decode(DecodeContext & context, int rx, int ry, int rw, int rh)
+{
+    auto result = data.decode(context, getTileCount());
+    auto const format = data.getTileLayerFormat();
+    for (auto & chunk : data.chunks) {
+        if (!chunk.isDeferred() || !chunk.intersects(rx, ry, rw, rh)) {
+            continue;
+        }
+        auto const code = chunk.decode(context, format);
+        if (isSuccess(result)) {
+            result = code;
+        }
+    }
+    return result;
+}
+
 Err TmxLayer::write(Element & elem) const
 {
     if (strncmp(elem.Name(), TAG_NAME, libtbag::string::string_length(TAG_NAME)) != 0) {
@@ -3,6 +3,8 @@
  * @brief  TmxLayer class prototype.
  * @author zer0
  * @date   2019-07-14
+ * @date   2026-10-19 (Read with the pull XML reader)
+ * @date   2026-10-19 (Deferred decoding)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_TILED_DETAILS_TMXLAYER_HPP__
@@ -17,6 +19,7 @@
 #include <libtbag/predef.hpp>
 #include <libtbag/Err.hpp>
 #include <libtbag/dom/xml/XmlHelper.hpp>
+#include <libtbag/dom/xml/XmlReader.hpp>
 #include <libtbag/tiled/details/TmxProperties.hpp>
 #include <libtbag/tiled/details/TmxData.hpp>
 
@@ -56,6 +59,9 @@ namespace details {
  */
 struct TBAG_API TmxLayer : protected libtbag::dom::xml::XmlHelper
 {
+    using XmlReader = libtbag::dom::xml::XmlReader;
+    using DecodeContext = TmxDataCommon::DecodeContext;
+
     TBAG_CONSTEXPR static char const * const TAG_NAME = "layer";
 
     /**
@@ -145,6 +151,26 @@ struct TBAG_API TmxLayer : protected libtbag::dom::xml::XmlHelper
     Err read(Element const & elem);
     Err read(std::string const & xml);
 
+    /**
+     * Read the current start element of the pull reader.
+     *
+     * @param[in] defer
+     *  Keep the encoded texts of the data without the decoding. (See decode())
+     */
+    Err read(XmlReader & reader, bool defer = false);
+
+    /** Number of the gids. (width * height) */
+    std::size_t getTileCount() const TBAG_NOEXCEPT;
+
+    /** Decode the deferred gids and chunks. */
+    Err decode(DecodeContext & context);
+
+    /**
+     * Decode the deferred gids and the deferred chunks which overlap the region. (in tiles)
+     * The gids of the finite layer are decoded at once.
+     */
+    Err decode(DecodeContext & context, int rx, int ry, int rw, int rh);
+
     Err write(Element & elem) const;
     Err write(std::string & xml) const;
 };
@@ -3,13 +3,21 @@
  * @brief  TmxMap class implementation.
  * @author zer0
  * @date   2019-08-15
+ * @date   2026-10-19 (Read the XML buffer without the copy)
+ * @date   2026-10-19 (Read with the pull XML reader)
+ * @date   2026-10-19 (Deferred and parallel decoding)
  */
 
 #include <libtbag/tiled/details/TmxMap.hpp>
 #include <libtbag/string/StringUtils.hpp>
+#include <libtbag/thread/ThreadPool.hpp>
 
 #include <cstring>
 #include <cassert>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -224,14 +232,231 @@ Err TmxMap::read(Element const & elem)
 
 Err TmxMap::read(std::string const & xml)
 {
-    Document doc;
-    auto const CODE = readFromXmlText(doc, xml);
+    return read(xml.data(), xml.size());
+}
+
+Err TmxMap::read(char const * xml, std::size_t size, bool defer)
+{
+    XmlReader reader(xml, size);
+    if (reader.next() != XmlReader::Token::START_ELEMENT) {
+        return E_PARSING;
+    }
+    if (reader.name() != TAG_NAME) {
+        return E_ILLARGS;
+    }
+    auto const CODE = read(reader, defer);
     if (isFailure(CODE)) {
         return CODE;
     }
-    auto const * elem = doc.FirstChildElement(TAG_NAME);
-    assert(elem != nullptr);
-    return read(*elem);
+    if (reader.next() != XmlReader::Token::END_DOCUMENT) {
+        return E_PARSING;
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * The small elements are read by the DOM reader with the text of the element.
+ */
+template <typename T, typename Container>
+static Err __read_child_element(TmxMap::XmlReader & reader, Container & container)
+{
+    TmxMap::XmlReader::View source;
+    auto const CODE = reader.skipElement(&source);
+    if (isFailure(CODE)) {
+        return CODE;
+    }
+    T child;
+    if (isSuccess(child.read(source.toString()))) {
+        container.push_back(std::move(child));
+    }
+    return E_SUCCESS;
+}
+
+Err TmxMap::read(XmlReader & reader, bool defer)
+{
+    if (reader.token() != XmlReader::Token::START_ELEMENT || reader.name() != TAG_NAME) {
+        return E_ILLARGS;
+    }
+
+    reader.optAttr(ATT_VERSION, version);
+    reader.optAttr(ATT_TILEDVERSION, tiled_version);
+
+    std::string orientation_text;
+    reader.optAttr(ATT_ORIENTATION, orientation_text);
+    orientation = getOrientation(orientation_text);
+
+    std::string render_order_text;
+    reader.optAttr(ATT_RENDERORDER, render_order_text);
+    render_order = getRenderOrder(render_order_text);
+
+    reader.optAttr(ATT_WIDTH, width);
+    reader.optAttr(ATT_HEIGHT, height);
+    reader.optAttr(ATT_TILEWIDTH, tile_width);
+    reader.optAttr(ATT_TILEHEIGHT, tile_height);
+    reader.optAttr(ATT_HEXSIDELENGTH, hex_side_length);
+
+    std::string stagger_axis_text;
+    reader.optAttr(ATT_STAGGERAXIS, stagger_axis_text);
+    stagger_axis = getStaggerAxis(stagger_axis_text);
+
+    std::string stagger_index_text;
+    reader.optAttr(ATT_STAGGERINDEX, stagger_index_text);
+    stagger_index = getStaggerIndex(stagger_index_text);
+
+    std::string background_color_text;
+    reader.optAttr(ATT_BACKGROUNDCOLOR, background_color_text);
+    background_color.fromArgbString(background_color_text);
+
+    reader.optAttr(ATT_NEXTLAYERID, next_layer_id);
+    reader.optAttr(ATT_NEXTOBJECTID, next_object_id);
+    reader.optAttr(ATT_INFINITE, infinite);
+
+    bool properties_found = false;
+
+    auto const map_depth = reader.depth();
+    while (true) {
+        auto const token = reader.next();
+        if (token == XmlReader::Token::FAILURE) {
+            return reader.getError();
+        }
+        if (token == XmlReader::Token::END_ELEMENT && reader.depth() == map_depth - 1) {
+            break;
+        }
+        if (token != XmlReader::Token::START_ELEMENT || reader.depth() != map_depth + 1) {
+            continue;
+        }
+
+        auto const child_name = reader.name();
+        Err code;
+        if (child_name == TmxLayer::TAG_NAME) {
+            // The layers are the largest elements, and the gids are decoded without the DOM.
+            TmxLayer layer;
+            code = layer.read(reader, defer);
+            if (isSuccess(code)) {
+                layers.push_back(std::move(layer));
+            } else if (reader.token() != XmlReader::Token::FAILURE) {
+                code = E_SUCCESS; // Skip the invalid layer.
+            }
+        } else if (child_name == TmxTileSet::TAG_NAME) {
+            code = __read_child_element<TmxTileSet>(reader, tilesets);
+        } else if (child_name == TmxObjectGroup::TAG_NAME) {
+            code = __read_child_element<TmxObjectGroup>(reader, object_groups);
+        } else if (child_name == TmxImageLayer::TAG_NAME) {
+            code = __read_child_element<TmxImageLayer>(reader, image_layers);
+        } else if (child_name == TmxGroup::TAG_NAME) {
+            code = __read_child_element<TmxGroup>(reader, groups);
+        } else if (!properties_found && child_name == TmxProperties::TAG_NAME) {
+            properties_found = true;
+            XmlReader::View source;
+            code = reader.skipElement(&source);
+            if (isSuccess(code)) {
+                properties.read(source.toString());
+            }
+        } else {
+            code = reader.skipElement();
+        }
+
+        if (isFailure(code)) {
+            return code;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+bool TmxMap::isDeferred() const
+{
+    for (auto const & layer : layers) {
+        if (layer.data.isDeferred()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Err TmxMap::decode(std::size_t thread_count)
+{
+    struct Job
+    {
+        TmxLayer * layer;
+        TmxChunk * chunk;
+    };
+
+    // The gids of the layers are larger than the chunks, so they are decoded first.
+    std::vector<Job> jobs;
+    for (auto & layer : layers) {
+        if (!layer.data.encoded.empty()) {
+            jobs.push_back(Job{&layer, nullptr});
+        }
+    }
+    for (auto & layer : layers) {
+        for (auto & chunk : layer.data.chunks) {
+            if (chunk.isDeferred()) {
+                jobs.push_back(Job{&layer, &chunk});
+            }
+        }
+    }
+    if (jobs.empty()) {
+        return E_SUCCESS;
+    }
+
+    std::atomic<std::size_t> next_job(0);
+    std::mutex error_mutex;
+    Err first_error = E_SUCCESS;
+
+    auto const worker = [&](){
+        DecodeContext context;
+        while (true) {
+            auto const index = next_job.fetch_add(1);
+            if (index >= jobs.size()) {
+                break;
+            }
+            auto & job = jobs[index];
+            Err code;
+            if (job.chunk != nullptr) {
+                code = job.chunk->decode(context, job.layer->data.getTileLayerFormat());
+            } else {
+                code = job.layer->data.decode(context, job.layer->getTileCount());
+            }
+            if (isFailure(code)) {
+                std::lock_guard<std::mutex> guard(error_mutex);
+                if (isSuccess(first_error)) {
+                    first_error = code;
+                }
+            }
+        }
+    };
+
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    thread_count = std::min(thread_count, jobs.size());
+
+    if (thread_count <= 1) {
+        worker();
+    } else {
+        // The current thread is also one of the workers.
+        libtbag::thread::ThreadPool pool(thread_count - 1, true, false);
+        for (std::size_t i = 0; i < thread_count - 1; ++i) {
+            pool.push(worker);
+        }
+        worker();
+        pool.exit();
+        pool.join(false);
+    }
+    return first_error;
+}
+
+Err TmxMap::decode(DecodeContext & context, int rx, int ry, int rw, int rh)
+{
+    Err result = E_SUCCESS;
+    for (auto & layer : layers) {
+        auto const code = layer.decode(context, rx, ry, rw, rh);
+        if (isSuccess(result)) {
+            result = code;
+        }
+    }
+    return result;
 }
 
 Err TmxMap::write(Element & elem) const
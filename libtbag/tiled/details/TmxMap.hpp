@@ -19,6 +19,7 @@
 #include <libtbag/predef.hpp>
 #include <libtbag/Err.hpp>
 #include <libtbag/dom/xml/XmlHelper.hpp>
+#include <libtbag/dom/xml/XmlReader.hpp>
 #include <libtbag/graphic/Color.hpp>
 #include <libtbag/tiled/details/TmxProperties.hpp>
 #include <libtbag/tiled/details/TmxTileSet.hpp>
@@ -51,9 +52,14 @@ namespace details {
  *
  * @author zer0
  * @date   2019-08-15
+ * @date   2026-10-19 (Read the XML buffer without the copy)
+ * @date   2026-10-19 (Read with the pull XML reader)
+ * @date   2026-10-19 (Deferred and parallel decoding)
  */
 struct TBAG_API TmxMap : protected libtbag::dom::xml::XmlHelper
 {
+    using XmlReader = libtbag::dom::xml::XmlReader;
+    using DecodeContext = TmxDataCommon::DecodeContext;
     using Color = libtbag::graphic::Color;
     using TileSets = std::vector<TmxTileSet>;
     using Layers = std::vector<TmxLayer>;
@@ -230,6 +236,37 @@ struct TBAG_API TmxMap : protected libtbag::dom::xml::XmlHelper
 
     Err read(Element const & elem);
     Err read(std::string const & xml);
+    Err read(char const * xml, std::size_t size, bool defer = false);
+
+    /**
+     * Read the current start element of the pull reader.
+     *
+     * @param[in] defer
+     *  Keep the encoded texts of the layers without the decoding. (See decode())
+     */
+    Err read(XmlReader & reader, bool defer = false);
+
+    /** Whether the gids or the chunks of the layers are not decoded yet. */
+    bool isDeferred() const;
+
+    /**
+     * Decode the deferred gids and chunks of all layers.
+     * The layers and the chunks are shared by the threads, and each thread has its own DecodeContext.
+     *
+     * @param[in] thread_count
+     *  Number of the threads. If it is 0, the number of the cores is used.
+     *
+     * @return
+     *  The first error of the decoding. The other gids and chunks are decoded anyway.
+     */
+    Err decode(std::size_t thread_count = 1);
+
+    /**
+     * Decode the deferred gids and the deferred chunks which overlap the region. (in tiles)
+     *
+     * @see TmxLayer::decode()
+     */
+    Err decode(DecodeContext & context, int rx, int ry, int rw, int rh);
 
     Err write(Element & elem) const;
     Err write(std::string & xml) const;
@@ -10,6 +10,7 @@
 #include <libtbag/log/Log.hpp>
 
 #include <cassert>
+#include <atomic>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -18,156 +19,155 @@ NAMESPACE_LIBTBAG_OPEN
 namespace uvpp {
 namespace ex   {
 
-// --------------------------------
-// MistakeInspector implementation.
-// --------------------------------
+// ------------------------------------
+// SafetyAsync::InlineJob implementation.
+// ------------------------------------
 
-SafetyAsync::MistakeInspector::MistakeInspector(Loop & loop, SafetyAsync & async)
-        : Idle(loop), _async(async)
+void SafetyAsync::InlineJob::run()
 {
-    // EMPTY.
-}
+    assert(invoke_cb != nullptr);
+    assert(destroy_cb != nullptr);
+    invoke_cb(&storage);
+    destroy_cb(&storage);
 
-SafetyAsync::MistakeInspector::~MistakeInspector()
-{
-    // EMPTY.
+    assert(owner != nullptr);
+    owner->releaseInlineJob(this);
 }
 
-void SafetyAsync::MistakeInspector::onIdle()
+void SafetyAsync::InlineJob::cancel()
 {
-    if (_async.isClosing()) {
-        // [WARNING] Don't use the inspector assertion of closing!
-        // e.g. assert(_async._inspector->isClosing());
-        tDLogD("SafetyAsync::MistakeInspector::onIdle() async is closing ...");
-        return; // async is closing ...
-    }
-
-    _async._jobs.safeRun([&](JobQueue::Queue & queue){
-        if (queue.empty()) {
-            _async.stopInspector();
-        } else {
-            if (_async.send() != E_SUCCESS) {
-                tDLogE("SafetyAsync::MistakeInspector::onIdle() send error.");
-            }
-        }
-    });
-}
+    assert(destroy_cb != nullptr);
+    destroy_cb(&storage);
 
-void SafetyAsync::MistakeInspector::onClose()
-{
-    // EMPTY.
+    assert(owner != nullptr);
+    owner->releaseInlineJob(this);
 }
 
 // ---------------------------
 // SafetyAsync implementation.
 // ---------------------------
 
-SafetyAsync::SafetyAsync(Loop & loop) : Async(loop), _inspector(nullptr)
+SafetyAsync::SafetyAsync(Loop & loop, std::size_t inline_job_size, std::size_t batch_size)
+        : Async(loop), _size(0), _pending(false),
+          BATCH_SIZE(batch_size == 0 ? 1 : batch_size),
+          INLINE_JOB_SIZE(FreeJobs::calcMinimumQueueSize(inline_job_size)),
+          _inline_jobs(new InlineJob[INLINE_JOB_SIZE]),
+          _free_jobs(INLINE_JOB_SIZE)
 {
-    _inspector = loop.newInternalHandle<MistakeInspector>(true, loop, *this);
-    assert(_inspector->isActive() == false);
-    _inspector->start();
+    for (std::size_t i = 0; i < INLINE_JOB_SIZE; ++i) {
+        _inline_jobs[i].owner = this;
+        _free_jobs.enqueue(&(_inline_jobs[i]));
+    }
 }
 
 SafetyAsync::~SafetyAsync()
 {
-    // EMPTY.
+    // [WARNING] The inline jobs in the queue must be destroyed before the slots.
+    clearJob();
 }
 
-void SafetyAsync::closeInspector()
+SafetyAsync::InlineJob * SafetyAsync::obtainInlineJob()
 {
-    if (static_cast<bool>(_inspector) == false) {
-        return;
-    }
-
-    if (_inspector->isActive()) {
-        _inspector->stop();
-    }
-    if (_inspector->isClosing() == false) {
-        _inspector->close();
+    void * job = nullptr;
+    if (_free_jobs.dequeue(&job)) {
+        assert(job != nullptr);
+        return static_cast<InlineJob*>(job);
     }
+    return nullptr;
 }
 
-Err SafetyAsync::startInspector()
+void SafetyAsync::releaseInlineJob(InlineJob * job)
 {
-    if (static_cast<bool>(_inspector) == false) {
-        return E_EXPIRED;
-    }
-
-    if (_inspector->isClosing()) {
-        return E_CLOSING;
-    }
-
-    if (_inspector->isActive()) {
-        return E_ALREADY;
-    }
-
-    Err const CODE = _inspector->start();
-    if (CODE != E_SUCCESS) {
-        return CODE;
-    }
-
-    tDLogD("SafetyAsync::startInspector()");
-    return CODE;
+    assert(job != nullptr);
+    job->invoke_cb = nullptr;
+    job->destroy_cb = nullptr;
+    bool const ENQUEUE_RESULT = _free_jobs.enqueue(job);
+    assert(ENQUEUE_RESULT);
+    UNUSED_PARAM(ENQUEUE_RESULT);
 }
 
-Err SafetyAsync::stopInspector()
+Err SafetyAsync::pushJob(JobInterface * job)
 {
-    if (static_cast<bool>(_inspector) == false) {
-        return E_EXPIRED;
-    }
-
-    if (_inspector->isClosing()) {
-        return E_CLOSING;
-    }
-
-    if (_inspector->isActive() == false) {
-        return E_ALREADY;
+    assert(job != nullptr);
+    _size.fetch_add(1u);
+    _jobs.push(job);
+
+    // [IMPORTANT] The push must be visible before checking the pending flag.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_pending.exchange(true)) {
+        return E_SUCCESS; // Coalesced with the previous wake-up.
     }
+    return send();
+}
 
-    Err const CODE = _inspector->stop();
-    if (CODE != E_SUCCESS) {
-        return CODE;
-    }
+void SafetyAsync::runJob(JobInterface * job)
+{
+    assert(job != nullptr);
+    SharedJob keep;
+    keep.swap(job->__self__);
+    job->__queued__.store(false);
+    job->run();
+}
 
-    tDLogD("SafetyAsync::stopInspector()");
-    return CODE;
+void SafetyAsync::cancelJob(JobInterface * job)
+{
+    assert(job != nullptr);
+    SharedJob keep;
+    keep.swap(job->__self__);
+    job->__queued__.store(false);
+    job->cancel();
 }
 
 void SafetyAsync::clearJob()
 {
-    _jobs.clear();
+    JobQueue::Node * node;
+    while ((node = _jobs.pop()) != nullptr) {
+        _size.fetch_sub(1u);
+        cancelJob(static_cast<JobInterface*>(node));
+    }
 }
 
 Err SafetyAsync::sendJob(SharedJob job)
 {
-    _jobs.safeRun([&](JobQueue::Queue & queue){
-        queue.push(job);
-        startInspector();
-    });
-    return send();
+    if (static_cast<bool>(job) == false) {
+        return E_ILLARGS;
+    }
+    if (job->__queued__.exchange(true)) {
+        return E_ALREADY;
+    }
+    job->__self__ = job;
+    return pushJob(job.get());
 }
 
 Err SafetyAsync::sendClose()
 {
-    auto job = SharedJob(new (std::nothrow) FunctionalJob([&](){
+    return sendFunc([this](){
         this->close();
-    }));
-
-    if (static_cast<bool>(job) == false) {
-        return E_BADALLOC;
-    }
-    return sendJob(job);
+    });
 }
 
 void SafetyAsync::onAsync()
 {
-    SharedJob job;
-    if (_jobs.frontAndPop(job) == E_SUCCESS) {
-        if (static_cast<bool>(job)) {
-            job->run();
+    // [IMPORTANT] Clear the pending flag before draining the queue.
+    // A producer that pushes after this point will wake the loop again.
+    _pending.store(false);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::size_t count = 0;
+    JobQueue::Node * node;
+    while (count < BATCH_SIZE && (node = _jobs.pop()) != nullptr) {
+        _size.fetch_sub(1u);
+        runJob(static_cast<JobInterface*>(node));
+        ++count;
+
+        if (isClosing()) {
+            return; // The remaining jobs will be discarded by onClose().
         }
-        job.reset();
+    }
+
+    if (count == BATCH_SIZE && _pending.exchange(true) == false) {
+        // There may be more jobs; yield to other handles and continue on the next iteration.
+        send();
     }
 }
 
@@ -175,7 +175,6 @@ void SafetyAsync::onClose()
 {
     tDLogD("SafetyAsync::onClose()");
     clearJob();
-    closeInspector();
 }
 
 } // namespace ex
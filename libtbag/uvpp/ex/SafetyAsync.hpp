@@ -16,11 +16,16 @@
 #include <libtbag/config.h>
 #include <libtbag/predef.hpp>
 #include <libtbag/uvpp/Async.hpp>
-#include <libtbag/uvpp/Idle.hpp>
-#include <libtbag/container/SafetyQueue.hpp>
+#include <libtbag/lockfree/MpScQueue.hpp>
+#include <libtbag/lockfree/BoundedMpMcQueue.hpp>
 
+#include <cstddef>
+#include <atomic>
 #include <memory>
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include <new>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -38,9 +43,12 @@ namespace ex {
  *
  * @author zer0
  * @date   2017-05-01
+ * @date   2026-10-19 (Lock-free job queue & wake-up coalescing)
  *
  * @remarks
- *  An Async handle that guarantees a call.
+ *  An Async handle that guarantees a call. @n
+ *  Jobs are pushed to the intrusive lock-free MPSC queue, @n
+ *  and one wake-up drains all pending jobs in a bounded batch.
  */
 class TBAG_API SafetyAsync : public Async
 {
@@ -49,17 +57,33 @@ public:
 
 public:
     using Parent = Async;
+    using Node = libtbag::lockfree::MpScQueue::Node;
+
+public:
+    struct JobInterface;
+    using SharedJob = std::shared_ptr<JobInterface>;
 
 public:
     /**
      * Job runner.
      */
-    struct JobInterface
+    struct JobInterface : public Node
     {
-        JobInterface() { /* EMPTY. */ }
+        friend class SafetyAsync;
+
+    private:
+        /** Keep-alive reference while the job is in the queue. */
+        SharedJob __self__;
+        std::atomic_bool __queued__;
+
+    public:
+        JobInterface() : __queued__(false) { /* EMPTY. */ }
         virtual ~JobInterface() { /* EMPTY. */ }
 
         virtual void run() = 0;
+
+        /** Called instead of run() if the job was discarded. */
+        virtual void cancel() { /* EMPTY. */ }
     };
 
 public:
@@ -84,55 +108,96 @@ public:
     };
 
 public:
+    TBAG_CONSTEXPR static std::size_t const INLINE_STORAGE_SIZE = 64;
+    TBAG_CONSTEXPR static std::size_t const INLINE_STORAGE_ALIGN = alignof(std::max_align_t);
+
     /**
-     * Check the missing jobs.
+     * Small-callable job stored in the pre-allocated slot of the SafetyAsync.
+     *
+     * @remarks
+     *  No heap allocation occurs when pushing this job.
      */
-    struct TBAG_API MistakeInspector : public uvpp::Idle
+    struct TBAG_API InlineJob : public JobInterface
     {
-    public:
-        using Parent = Idle;
+        using Storage = typename std::aligned_storage<INLINE_STORAGE_SIZE, INLINE_STORAGE_ALIGN>::type;
+        using Invoker = void(*)(void*);
 
-    private:
-        SafetyAsync & _async;
+        SafetyAsync * owner;
+        Invoker invoke_cb;
+        Invoker destroy_cb;
+        Storage storage;
 
-    public:
-        MistakeInspector(Loop & loop, SafetyAsync & async);
-        virtual ~MistakeInspector();
+        InlineJob() : owner(nullptr), invoke_cb(nullptr), destroy_cb(nullptr)
+        { /* EMPTY. */ }
+        virtual ~InlineJob()
+        { /* EMPTY. */ }
 
-    public:
-        virtual void onIdle() override;
-        virtual void onClose() override;
+        virtual void run() override;
+        virtual void cancel() override;
     };
 
 public:
-    using SharedInspector = std::shared_ptr<MistakeInspector>;
+    using InlineJobs = std::unique_ptr<InlineJob[]>;
+    using FreeJobs   = libtbag::lockfree::BoundedMpMcQueue;
+    using JobQueue   = libtbag::lockfree::MpScQueue;
 
-    using SharedJob = std::shared_ptr<JobInterface>;
-    using JobQueue  = container::SafetyQueue<SharedJob>;
+public:
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_INLINE_JOB_SIZE = 1024;
+    TBAG_CONSTEXPR static std::size_t const DEFAULT_BATCH_SIZE = 256;
 
 private:
-    SharedInspector _inspector;
     JobQueue _jobs;
+    std::atomic_size_t _size;
+
+    /** Coalescing flag of uv_async_send(). */
+    std::atomic_bool _pending;
+
+    /** Maximum number of jobs to run per wake-up. */
+    std::size_t const BATCH_SIZE;
+
+private:
+    std::size_t const INLINE_JOB_SIZE;
+    InlineJobs _inline_jobs;
+    FreeJobs _free_jobs;
 
 protected:
-    SafetyAsync(Loop & loop);
+    SafetyAsync(Loop & loop,
+                std::size_t inline_job_size = DEFAULT_INLINE_JOB_SIZE,
+                std::size_t batch_size = DEFAULT_BATCH_SIZE);
 
 public:
     virtual ~SafetyAsync();
 
+public:
+    inline bool empty() const TBAG_NOEXCEPT
+    { return _size.load() == 0u; }
+    inline std::size_t size() const TBAG_NOEXCEPT
+    { return _size.load(); }
+
+    inline std::size_t getBatchSize() const TBAG_NOEXCEPT
+    { return BATCH_SIZE; }
+    inline std::size_t getInlineJobSize() const TBAG_NOEXCEPT
+    { return INLINE_JOB_SIZE; }
+
 private:
-    void closeInspector();
-    Err startInspector();
-    Err stopInspector();
+    InlineJob * obtainInlineJob();
+    void releaseInlineJob(InlineJob * job);
 
-public:
-    inline bool empty() const TBAG_NOEXCEPT_SP_OP(_jobs.empty())
-    { return _jobs.empty(); }
-    inline std::size_t size() const TBAG_NOEXCEPT_SP_OP(_jobs.size())
-    { return _jobs.size(); }
+private:
+    Err pushJob(JobInterface * job);
+
+    static void runJob(JobInterface * job);
+    static void cancelJob(JobInterface * job);
 
 public:
+    /**
+     * Discard all pending jobs.
+     *
+     * @warning
+     *  Only the loop thread can call this method.
+     */
     void clearJob();
+
     Err sendJob(SharedJob job);
     Err sendClose();
 
@@ -161,6 +226,60 @@ public:
     {
         return newSendJob<FunctionalJob, Args ...>(std::forward<Args>(args) ...);
     }
+
+private:
+    template <typename Functor>
+    Err sendHeapFunc(Functor && func)
+    {
+        FunctionalJob::OnJob const CALLBACK(std::forward<Functor>(func));
+        auto shared = SharedJob(new (std::nothrow) FunctionalJob(CALLBACK));
+        if (static_cast<bool>(shared) == false) {
+            return E_BADALLOC;
+        }
+        return sendJob(shared);
+    }
+
+    template <typename Functor>
+    Err sendInlineFunc(Functor && func, std::false_type)
+    {
+        return sendHeapFunc(std::forward<Functor>(func));
+    }
+
+    template <typename Functor>
+    Err sendInlineFunc(Functor && func, std::true_type)
+    {
+        using FunctorType = typename std::decay<Functor>::type;
+        InlineJob * job = obtainInlineJob();
+        if (job == nullptr) {
+            return sendHeapFunc(std::forward<Functor>(func));
+        }
+
+        new (&job->storage) FunctorType(std::forward<Functor>(func));
+        job->invoke_cb = [](void * storage){
+            (*static_cast<FunctorType*>(storage))();
+        };
+        job->destroy_cb = [](void * storage){
+            static_cast<FunctorType*>(storage)->~FunctorType();
+        };
+        return pushJob(job);
+    }
+
+public:
+    /**
+     * Push & send the callable object.
+     *
+     * @remarks
+     *  If the callable object fits into the InlineJob storage and a free slot exists, @n
+     *  no heap allocation occurs. Otherwise, it falls back to the FunctionalJob.
+     */
+    template <typename Functor>
+    Err sendFunc(Functor && func)
+    {
+        using FunctorType = typename std::decay<Functor>::type;
+        using IsInline = std::integral_constant<bool, sizeof(FunctorType) <= INLINE_STORAGE_SIZE &&
+                                                      alignof(FunctorType) <= INLINE_STORAGE_ALIGN>;
+        return sendInlineFunc(std::forward<Functor>(func), IsInline());
+    }
 };
 
 } // namespace ex
@@ -3,13 +3,13 @@
  * @brief  TlsTcp class implementation.
  * @author zer0
  * @date   2019-01-26
+ * @date   2026-10-19 (Implement the TLS stream with the span I/O, batched records and session resumption)
  */
 
 #include <libtbag/uvpp/ex/TlsTcp.hpp>
 #include <libtbag/log/Log.hpp>
-#include <libtbag/uvpp/Request.hpp>
 
-#include <uv.h>
+#include <cassert>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -18,83 +18,21 @@ NAMESPACE_LIBTBAG_OPEN
 namespace uvpp {
 namespace ex   {
 
-// --------------------
-// Global libuv events.
-// --------------------
+TlsTcp::TlsTcp() : Tcp(), _tls(new Tls()), _finished(false),
+                   _write_active(false), _reading(false), _corked(false)
+{
+    // EMPTY.
+}
 
-static void __global_uv_tcp_connect_tls_cb__(uv_connect_t * request, int status)
-{
-//    ConnectRequest * req = static_cast<ConnectRequest*>(request->data);
-//    if (req == nullptr) {
-//        tDLogE("__global_uv_tcp_connect_cb__() request.data is nullptr.");
-//    } else if (isDeletedAddress(req)) {
-//        tDLogE("__global_uv_tcp_connect_cb__() request.data is deleted.");
-//    } else {
-//        Tcp * s = static_cast<Tcp*>(req->getOwner());
-//        if (s == nullptr) {
-//            tDLogE("__global_uv_tcp_connect_cb__() request.data.owner is nullptr.");
-//        } else if (isDeletedAddress(s)) {
-//            tDLogE("__global_uv_tcp_connect_cb__() request.data.owner is deleted.");
-//        } else {
-//            s->onConnect(*req, convertUvErrorToErr(status));
-//        }
-//    }
-}
-
-static void __global_uv_connection_tls_cb__(uv_stream_t * server, int status)
-{
-//    Stream * s = static_cast<Stream*>(server->data);
-//    if (s == nullptr) {
-//        tDLogE("__global_uv_connection_cb__() server.data is nullptr.");
-//    } else if (isDeletedAddress(s)) {
-//        tDLogE("__global_uv_connection_cb__() server.data is deleted.");
-//    } else {
-//        s->onConnection(convertUvErrorToErr(status));
-//    }
-}
-
-static void __global_uv_stream_alloc_tls_cb__(uv_handle_t * handle, size_t suggested_size, uv_buf_t * buf)
-{
-//    Stream * s = static_cast<Stream*>(handle->data);
-//    if (s == nullptr) {
-//        tDLogE("__global_uv_stream_alloc_cb__() handle.data is nullptr.");
-//    } else if (isDeletedAddress(s)) {
-//        tDLogE("__global_uv_stream_alloc_cb__() handle.data is deleted.");
-//    } else {
-//        auto result_buffer = s->onAlloc(suggested_size);
-//        buf->base = result_buffer.buffer;
-//        buf->len  = result_buffer.size;
-//    }
-}
-
-static void __global_uv_read_tls_cb__(uv_stream_t * stream, ssize_t nread, uv_buf_t const * buf)
-{
-//    Stream * s = static_cast<Stream*>(stream->data);
-//    if (s == nullptr) {
-//        tDLogE("__global_uv_read_cb__() stream.data is nullptr.");
-//    } else if (isDeletedAddress(s)) {
-//        tDLogE("__global_uv_read_cb__() stream.data is deleted.");
-//    } else {
-//        Err code;
-//        if (nread >= 0){
-//            code = E_SUCCESS;
-//        } else {
-//            code = convertUvErrorToErr(static_cast<int>(nread));
-//        }
-//        s->onRead(code, buf->base, static_cast<std::size_t>(nread));
-//    }
-}
-
-// ----------------------
-// TlsTcp implementation.
-// ----------------------
-
-TlsTcp::TlsTcp() : Tcp()
+TlsTcp::TlsTcp(Loop & loop) : Tcp(loop), _tls(new Tls()), _finished(false),
+                              _write_active(false), _reading(false), _corked(false)
 {
     // EMPTY.
 }
 
-TlsTcp::TlsTcp(Loop & loop) : Tcp(loop)
+TlsTcp::TlsTcp(Loop & loop, Tls const & context)
+        : Tcp(loop), _tls(new Tls(Tls::reference_ssl_context{}, context)), _finished(false),
+          _write_active(false), _reading(false), _corked(false)
 {
     // EMPTY.
 }
@@ -104,48 +42,244 @@ TlsTcp::~TlsTcp()
     // EMPTY.
 }
 
+TlsTcp::TlsSession TlsTcp::getSession() const
+{
+    return _tls->getSession();
+}
+
+bool TlsTcp::setSession(TlsSession const & session)
+{
+    return _tls->setSession(session);
+}
+
+bool TlsTcp::isSessionReused() const
+{
+    return _tls->isSessionReused();
+}
+
 Err TlsTcp::connectTls(ConnectRequest & request, sockaddr const * address)
 {
-    request.setOwner(this); // IMPORTANT!!
-    int const CODE = ::uv_tcp_connect(request.cast<uv_connect_t>(),
-                                      Parent::cast<uv_tcp_t>(),
-                                      address,
-                                      __global_uv_tcp_connect_tls_cb__);
-    return convertUvErrorToErrWithLogging("TlsTcp::connectTls()", CODE);
+    return connect(request, address);
 }
 
 Err TlsTcp::listenTls(int backlog)
 {
-    int const CODE = ::uv_listen(Parent::cast<uv_stream_t>(), backlog, __global_uv_connection_tls_cb__);
-    return convertUvErrorToErrWithLogging("TlsTcp::listenTls()", CODE);
+    return listen(backlog);
+}
+
+Err TlsTcp::acceptTls(TlsTcp & client)
+{
+    auto const ACCEPT_CODE = accept(client);
+    if (isFailure(ACCEPT_CODE)) {
+        return ACCEPT_CODE;
+    }
+    client._tls->accept();
+    return client.startReadTls();
 }
 
 Err TlsTcp::startReadTls()
 {
-    int const CODE = ::uv_read_start(Parent::cast<uv_stream_t>(),
-                                     __global_uv_stream_alloc_tls_cb__,
-                                     __global_uv_read_tls_cb__);
-    return convertUvErrorToErrWithLogging("TlsTcp::startReadTls()", CODE);
+    return startRead();
+}
+
+Err TlsTcp::writeTls(binf const * infos, std::size_t infos_size)
+{
+    if (!isInit() || isClosing()) {
+        return E_CLOSED;
+    }
+
+    if (_finished && !_write_active && !_reading && !_corked && _plain.empty()) {
+        // Encrypt from the caller's buffers.
+        auto const CODE = _tls->write(infos, infos_size);
+        if (isFailure(CODE)) {
+            return CODE;
+        }
+        flush();
+        return E_SUCCESS;
+    }
+
+    // Coalesce until the stream becomes writable.
+    for (std::size_t i = 0; i < infos_size; ++i) {
+        _plain.insert(_plain.end(), infos[i].buffer, infos[i].buffer + infos[i].size);
+    }
+    if (!_reading) {
+        flush();
+    }
+    return E_SUCCESS;
+}
+
+Err TlsTcp::writeTls(char const * buffer, std::size_t size)
+{
+    binf const INFO(const_cast<char*>(buffer), size);
+    return writeTls(&INFO, 1);
+}
+
+void TlsTcp::cork()
+{
+    _corked = true;
+}
+
+void TlsTcp::uncork()
+{
+    _corked = false;
+    if (!_reading) {
+        flush();
+    }
+}
+
+void TlsTcp::flush()
+{
+    if (_write_active || !isInit() || isClosing()) {
+        return;
+    }
+
+    if (_finished && !_corked && !_plain.empty()) {
+        binf const INFO(_plain.data(), _plain.size());
+        auto const ENCRYPT_CODE = _tls->write(&INFO, 1);
+        _plain.clear();
+        if (isFailure(ENCRYPT_CODE)) {
+            onTlsWrite(ENCRYPT_CODE);
+            return;
+        }
+    }
+
+    _tls->drain(_pending);
+    if (_pending.empty()) {
+        return;
+    }
+
+    // The buffers are swapped, so the capacity is reused by the next write.
+    _writing.swap(_pending);
+    _pending.clear();
+
+    auto const CODE = write(_write_req, _writing.data(), _writing.size());
+    if (isFailure(CODE)) {
+        tDLogE("TlsTcp::flush() Write {} error", CODE);
+        _writing.clear();
+        onTlsWrite(CODE);
+        return;
+    }
+    _write_active = true;
+}
+
+void TlsTcp::onConnect(ConnectRequest & request, Err code)
+{
+    if (isFailure(code)) {
+        onTlsHandshake(code);
+        return;
+    }
+
+    auto const READ_CODE = startReadTls();
+    if (isFailure(READ_CODE)) {
+        onTlsHandshake(READ_CODE);
+        return;
+    }
+
+    // [CLIENT HELLO]
+    _tls->connect();
+    auto const HANDSHAKE_CODE = _tls->handshake();
+    if (HANDSHAKE_CODE != E_SSLWREAD) {
+        tDLogE("TlsTcp::onConnect() Handshake {} error", HANDSHAKE_CODE);
+        onTlsHandshake(E_SSL);
+        return;
+    }
+    flush();
+}
+
+binf TlsTcp::onAlloc(std::size_t suggested_size)
+{
+    return defaultOnAlloc(_read_buffer, suggested_size);
+}
+
+void TlsTcp::onRead(Err code, char const * buffer, std::size_t size)
+{
+    if (isFailure(code)) {
+        if (_finished) {
+            onTlsRead(code, nullptr, 0);
+        } else {
+            onTlsHandshake(code);
+        }
+        return;
+    }
+
+    if (isFailure(_tls->writeToReadBuffer(buffer, size))) {
+        onTlsRead(E_SSL, nullptr, 0);
+        return;
+    }
+
+    // The writes of the callbacks are coalesced and flushed at once.
+    _reading = true;
+
+    if (!_finished) {
+        auto const HANDSHAKE_CODE = _tls->handshake();
+        if (_tls->isFinished()) {
+            _finished = true;
+            onTlsHandshake(E_SUCCESS);
+        } else if (HANDSHAKE_CODE != E_SSLWREAD) {
+            tDLogE("TlsTcp::onRead() Handshake {} error", HANDSHAKE_CODE);
+            _reading = false;
+            flush();
+            onTlsHandshake(E_SSL);
+            return;
+        }
+    }
+
+    while (_finished && isInit() && !isClosing()) {
+        auto span = onTlsAlloc(PLAIN_BUFFER_SIZE);
+        if (span.buffer == nullptr || span.size == 0) {
+            break;
+        }
+
+        std::size_t read_size = 0;
+        auto const READ_CODE = _tls->read(span.buffer, span.size, &read_size);
+        if (READ_CODE == E_SSLWREAD) {
+            break; // Partial record.
+        }
+        if (isFailure(READ_CODE)) {
+            onTlsRead(READ_CODE, nullptr, 0);
+            break;
+        }
+        onTlsRead(E_SUCCESS, span.buffer, read_size);
+    }
+
+    _reading = false;
+    flush();
+}
+
+void TlsTcp::onWrite(WriteRequest & request, Err code)
+{
+    _write_active = false;
+    _writing.clear();
+
+    if (isFailure(code)) {
+        onTlsWrite(code);
+        return;
+    }
+
+    flush();
+    if (!_write_active && _plain.empty()) {
+        onTlsWrite(E_SUCCESS);
+    }
 }
 
-Err TlsTcp::writeTls(WriteRequest & request, binf const * infos, std::size_t infos_size)
+void TlsTcp::onTlsHandshake(Err code)
 {
-    return write(request, infos, infos_size);
+    tDLogD("TlsTcp::onTlsHandshake({}) called.", code);
 }
 
-Err TlsTcp::writeTls(WriteRequest & request, char const * buffer, std::size_t size)
+binf TlsTcp::onTlsAlloc(std::size_t suggested_size)
 {
-    return write(request, buffer, size);
+    return defaultOnAlloc(_plain_buffer, suggested_size);
 }
 
-std::size_t TlsTcp::tryWriteTls(binf * infos, std::size_t infos_size, Err * result)
+void TlsTcp::onTlsRead(Err code, char const * buffer, std::size_t size)
 {
-    return tryWrite(infos, infos_size, result);
+    tDLogD("TlsTcp::onTlsRead({}) called.", code);
 }
 
-std::size_t TlsTcp::tryWriteTls(char const * buffer, std::size_t size, Err * result)
+void TlsTcp::onTlsWrite(Err code)
 {
-    return tryWrite(buffer, size, result);
+    tDLogD("TlsTcp::onTlsWrite({}) called.", code);
 }
 
 } // namespace ex
@@ -3,6 +3,7 @@
  * @brief  TlsTcp class prototype.
  * @author zer0
  * @date   2019-01-26
+ * @date   2026-10-19 (Implement the TLS stream with the span I/O, batched records and session resumption)
  */
 
 #ifndef __INCLUDE_LIBTBAG__LIBTBAG_UVPP_EX_TLSTCP_HPP__
@@ -17,6 +18,11 @@
 #include <libtbag/predef.hpp>
 #include <libtbag/crypto/Tls.hpp>
 #include <libtbag/uvpp/Tcp.hpp>
+#include <libtbag/uvpp/Request.hpp>
+#include <libtbag/util/BufferInfo.hpp>
+
+#include <memory>
+#include <vector>
 
 // -------------------
 NAMESPACE_LIBTBAG_OPEN
@@ -30,16 +36,89 @@ namespace ex   {
  *
  * @author zer0
  * @date   2019-01-26
+ * @date   2026-10-19 (Implement the TLS stream)
+ *
+ * @remarks
+ *  The TLS layer of the Tcp stream: @n
+ *  - Records are decrypted from the read buffer into the span of onTlsAlloc().
+ *  - Plain bytes are encrypted into the write buffers, which are reused for the lifetime of the stream.
+ *  - While a write is in flight (or the stream is corked), the plain bytes are coalesced, @n
+ *    so the small writes are sent as full-size records with a single write request.
+ *  - The nodes of a shared context (See TlsTcp(Loop&, Tls const&)) share the session cache, @n
+ *    and a client can resume the session of the previous connection. (See setSession())
+ *
+ * @warning
+ *  Use the onTls* events instead of the Tcp events.
  */
 class TBAG_API TlsTcp : public Tcp
 {
+public:
+    using Tls = libtbag::crypto::Tls;
+    using TlsSession = libtbag::crypto::TlsSession;
+    using Buffer = libtbag::util::Buffer;
+
+public:
+    TBAG_CONSTEXPR static std::size_t const PLAIN_BUFFER_SIZE = Tls::MAX_RECORD_SIZE;
+
+private:
+    std::unique_ptr<Tls> _tls;
+    bool _finished;
+
+private:
+    WriteRequest _write_req;
+
+    /** Plain bytes waiting for the current write. */
+    Buffer _plain;
+
+    /** Encrypted bytes waiting for the current write. */
+    Buffer _pending;
+
+    /** Encrypted bytes of the current write. */
+    Buffer _writing;
+
+    bool _write_active;
+    bool _reading;
+    bool _corked;
+
 private:
+    std::vector<char> _read_buffer;
+    std::vector<char> _plain_buffer;
 
 public:
     TlsTcp();
     TlsTcp(Loop & loop);
+
+    /**
+     * Node of the shared SSL context.
+     *
+     * @param[in] context
+     *  Server context with the certificate, or client context of the session cache.
+     */
+    TlsTcp(Loop & loop, Tls const & context);
+
     virtual ~TlsTcp();
 
+public:
+    inline bool isTlsFinished() const TBAG_NOEXCEPT
+    { return _finished; }
+
+    inline Tls & tls() TBAG_NOEXCEPT
+    { return *_tls; }
+    inline Tls const & tls() const TBAG_NOEXCEPT
+    { return *_tls; }
+
+    /** Number of the bytes waiting to be written. (Plain & encrypted) */
+    inline std::size_t getPendingWriteSize() const TBAG_NOEXCEPT
+    { return _plain.size() + _pending.size() + _writing.size(); }
+
+public:
+    TlsSession getSession() const;
+
+    /** Resume the session. Call it before connectTls(). */
+    bool setSession(TlsSession const & session);
+
+    bool isSessionReused() const;
+
 public:
     /** Establish an IPv4 or IPv6 TCP/TLS connection. */
     Err connectTls(ConnectRequest & request, sockaddr const * address);
@@ -47,15 +126,52 @@ public:
     /** Start TLS listening for incoming connections. */
     Err listenTls(int backlog = BACKLOG_LIMIT);
 
+    /** Accept the incoming connection and start the server-side handshake. */
+    Err acceptTls(TlsTcp & client);
+
     /** Read TLS data from an incoming stream. */
     Err startReadTls();
 
-    /** Write TLS data to stream. Buffers are written in order. */
-    Err writeTls(WriteRequest & request, binf const * infos, std::size_t infos_size);
-    Err writeTls(WriteRequest & request, char const * buffer, std::size_t size);
+    /**
+     * Write TLS data to stream. Buffers are written in order.
+     *
+     * @remarks
+     *  The data is copied (or encrypted) before returning, @n
+     *  so the buffers can be reused immediately.
+     */
+    Err writeTls(binf const * infos, std::size_t infos_size);
+    Err writeTls(char const * buffer, std::size_t size);
+
+    /** Coalesce the following writes until uncork(). */
+    void cork();
+    void uncork();
+
+private:
+    void flush();
+
+public:
+    virtual void onConnect(ConnectRequest & request, Err code) override;
+    virtual binf onAlloc(std::size_t suggested_size) override;
+    virtual void onRead(Err code, char const * buffer, std::size_t size) override;
+    virtual void onWrite(WriteRequest & request, Err code) override;
 
-    std::size_t tryWriteTls(binf * infos, std::size_t infos_size, Err * result = nullptr);
-    std::size_t tryWriteTls(char const * buffer, std::size_t size, Err * result = nullptr);
+public:
+    /** The handshake is finished (or failed). */
+    virtual void onTlsHandshake(Err code);
+
+    /** Span of the decrypted bytes. */
+    virtual binf onTlsAlloc(std::size_t suggested_size);
+
+    /**
+     * Decrypted bytes.
+     *
+     * @remarks
+     *  E_EOF is passed if the peer closed the TLS session or the stream.
+     */
+    virtual void onTlsRead(Err code, char const * buffer, std::size_t size);
+
+    /** All written bytes are sent. */
+    virtual void onTlsWrite(Err code);
 };
 
 } // namespace ex
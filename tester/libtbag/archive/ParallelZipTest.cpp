@@ -0,0 +1,168 @@
+/**
+ * @file   ParallelZipTest.cpp
+ * @brief  ParallelZip class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
+#include <libtbag/archive/ParallelZip.hpp>
+#include <libtbag/archive/Archive.hpp>
+#include <libtbag/filesystem/File.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+
+using namespace libtbag;
+using namespace libtbag::archive;
+
+/** Compressible text of the random words. */
+static std::string createText(std::size_t size, unsigned seed)
+{
+    static char const * const WORDS[] = {"alpha ", "beta ", "gamma ", "delta ", "epsilon ",
+                                         "zeta ", "eta ", "theta ", "iota ", "kappa\n"};
+    std::string result;
+    result.reserve(size + 16);
+    while (result.size() < size) {
+        seed = seed * 1103515245u + 12345u;
+        result += WORDS[(seed >> 16) % 10];
+    }
+    result.resize(size);
+    return result;
+}
+
+static std::map<std::string, std::string> readEntries(std::string const & path)
+{
+    std::map<std::string, std::string> result;
+    for (auto const & entry : decompressArchive(path)) {
+        result[entry.path_name] = std::string(entry.data.begin(), entry.data.end());
+    }
+    return result;
+}
+
+TEST(ParallelZipTest, Default)
+{
+    ParallelZipWriter writer;
+    ASSERT_FALSE(writer.isOpen());
+    ASSERT_EQ(E_ILLSTATE, writer.close());
+    ASSERT_EQ(E_ILLSTATE, writer.addMemory("a", "A", 1));
+}
+
+TEST(ParallelZipTest, Memory)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "memory.zip";
+
+    ParallelZipWriter::Params params;
+    params.thread_count = 4;
+    params.block_size = 4096;
+    params.max_blocks = 3;
+
+    std::map<std::string, std::string> contents;
+    contents["empty"] = std::string();
+    contents["small"] = createText(100, 1);
+    contents["aligned"] = createText(4096 * 3, 2);
+    contents["large"] = createText(100000, 3);
+
+    ParallelZipWriter writer(params);
+    ASSERT_EQ(E_SUCCESS, writer.open(PATH));
+    ASSERT_EQ(E_ALREADY, writer.open(PATH));
+    ASSERT_EQ(E_ILLARGS, writer.addMemory(std::string(), "A", 1));
+    for (auto const & content : contents) {
+        ASSERT_EQ(E_SUCCESS, writer.addMemory(content.first, content.second.data(), content.second.size()));
+    }
+
+    // Streaming input with the short reads.
+    auto const STREAM = createText(50000, 4);
+    std::size_t offset = 0;
+    ASSERT_EQ(E_SUCCESS, writer.addStream("stream", [&](char * buffer, std::size_t size) -> int64_t {
+        auto const READ = std::min<std::size_t>(std::min<std::size_t>(size, 1000), STREAM.size() - offset);
+        std::copy(STREAM.begin() + offset, STREAM.begin() + offset + READ, buffer);
+        offset += READ;
+        return static_cast<int64_t>(READ);
+    }));
+    contents["stream"] = STREAM;
+
+    ASSERT_EQ(5u, writer.getEntryCount());
+    ASSERT_EQ(E_SUCCESS, writer.close());
+    ASSERT_FALSE(writer.isOpen());
+
+    ASSERT_EQ(contents, readEntries(PATH));
+}
+
+TEST(ParallelZipTest, StreamError)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "error.zip";
+
+    ParallelZipWriter writer;
+    ASSERT_EQ(E_SUCCESS, writer.open(PATH));
+    ASSERT_EQ(E_RDERR, writer.addStream("error", [](char *, std::size_t) -> int64_t { return -1; }));
+    ASSERT_EQ(E_SUCCESS, writer.addMemory("next", "NEXT", 4));
+    ASSERT_EQ(E_RDERR, writer.close());
+}
+
+TEST(ParallelZipTest, Files)
+{
+    tttDir_Automatic();
+    auto const DIR = tttDir_Get();
+    auto const PATH = DIR / "files.zip";
+
+    std::vector<std::string> files;
+    std::map<std::string, std::string> contents;
+    for (int i = 0; i < 5; ++i) {
+        auto const NAME = "file" + std::to_string(i) + ".txt";
+        auto const CONTENT = createText(i * 70000, static_cast<unsigned>(i));
+        ASSERT_EQ(E_SUCCESS, filesystem::writeFile(DIR / NAME, CONTENT));
+        files.push_back((DIR / NAME).toString());
+        contents[NAME] = CONTENT;
+    }
+    contents["renamed"] = contents["file0.txt"];
+    contents.erase("file0.txt");
+
+    ParallelZipWriter::Params params;
+    params.block_size = 16 * 1024;
+    ASSERT_EQ(E_SUCCESS, compressZipParallel(PATH, files, {"renamed"}, params));
+    ASSERT_EQ(contents, readEntries(PATH));
+
+    ASSERT_EQ(E_ENOENT, compressZipParallel(DIR / "missing.zip", {(DIR / "__not_exists__").toString()}));
+}
+
+TEST(ParallelZipTest, BenchmarkOfCompress)
+{
+    tttDir_Automatic();
+    auto const DIR = tttDir_Get();
+    std::size_t const FILE_COUNT = 8;
+    std::size_t const FILE_SIZE = 4 * 1024 * 1024;
+
+    std::vector<std::string> files;
+    for (std::size_t i = 0; i < FILE_COUNT; ++i) {
+        auto const PATH = DIR / ("input" + std::to_string(i));
+        ASSERT_EQ(E_SUCCESS, filesystem::writeFile(PATH, createText(FILE_SIZE, static_cast<unsigned>(i))));
+        files.push_back(PATH.toString());
+    }
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    ASSERT_EQ(FILE_COUNT, compressArchive(DIR / "archive.zip", files, COMPRESS_FORMAT_ZIP));
+    auto const ARCHIVE = duration_cast<milliseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    ASSERT_EQ(E_SUCCESS, compressZipParallel(DIR / "parallel.zip", files));
+    auto const PARALLEL = duration_cast<milliseconds>(system_clock::now() - begin).count();
+
+    auto const ARCHIVE_SIZE = (DIR / "archive.zip").getState().size;
+    auto const PARALLEL_SIZE = (DIR / "parallel.zip").getState().size;
+    ASSERT_EQ(FILE_COUNT, readEntries(DIR / "parallel.zip").size());
+
+    auto const TOTAL_MB = static_cast<double>(FILE_COUNT * FILE_SIZE) / (1024 * 1024);
+    std::cout << "compressArchive: " << ARCHIVE << "ms (" << (TOTAL_MB * 1000 / std::max<long>(ARCHIVE, 1))
+              << "MB/s, " << ARCHIVE_SIZE << "bytes), compressZipParallel: " << PARALLEL << "ms ("
+              << (TOTAL_MB * 1000 / std::max<long>(PARALLEL, 1)) << "MB/s, " << PARALLEL_SIZE << "bytes)"
+              << std::endl;
+}
+
@@ -0,0 +1,258 @@
+/**
+ * @file   ZipIndexReaderTest.cpp
+ * @brief  ZipIndexReader class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the ForgedSize test)
+ */
+
+#include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
+#include <libtbag/archive/ZipIndexReader.hpp>
+#include <libtbag/archive/ParallelZip.hpp>
+#include <libtbag/archive/Archive.hpp>
+#include <libtbag/filesystem/File.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::archive;
+
+static std::string createContent(std::size_t size, unsigned seed)
+{
+    std::string result(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        result[i] = static_cast<char>('a' + ((seed >> 16) % 8));
+    }
+    return result;
+}
+
+static std::string getName(std::size_t index)
+{
+    return "dir/entry" + std::to_string(index) + ".bin";
+}
+
+static std::vector<std::string> writeZip(std::string const & path, std::size_t count, std::size_t size)
+{
+    std::vector<std::string> contents;
+    ParallelZipWriter::Params params;
+    params.block_size = 16 * 1024;
+    ParallelZipWriter writer(params);
+    EXPECT_EQ(E_SUCCESS, writer.open(path));
+    for (std::size_t i = 0; i < count; ++i) {
+        contents.push_back(createContent(size + i, static_cast<unsigned>(i)));
+        EXPECT_EQ(E_SUCCESS, writer.addMemory(getName(i), contents.back().data(), contents.back().size()));
+    }
+    EXPECT_EQ(E_SUCCESS, writer.close());
+    return contents;
+}
+
+TEST(ZipIndexReaderTest, Default)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "not_zip";
+    ASSERT_EQ(E_SUCCESS, filesystem::writeFile(PATH, createContent(1000, 0)));
+
+    ZipIndexReader reader;
+    ASSERT_FALSE(reader.isOpen());
+    util::Buffer buffer;
+    ASSERT_EQ(E_ILLSTATE, reader.extract(0, buffer));
+    ASSERT_NE(E_SUCCESS, reader.open(tttDir_Get() / "__not_exists__"));
+    ASSERT_EQ(E_PARSING, reader.open(PATH));
+    ASSERT_FALSE(reader.isOpen());
+}
+
+TEST(ZipIndexReaderTest, Extract)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "extract.zip";
+    auto const CONTENTS = writeZip(PATH, 20, 50000);
+
+    ZipIndexReader reader(PATH);
+    ASSERT_TRUE(reader.isOpen());
+    ASSERT_EQ(CONTENTS.size(), reader.size());
+    ASSERT_EQ(-1, reader.find("__not_exists__"));
+
+    util::Buffer buffer;
+    ASSERT_EQ(E_NFOUND, reader.extract("__not_exists__", buffer));
+    ASSERT_EQ(E_OORANGE, reader.extract(CONTENTS.size(), buffer));
+
+    for (std::size_t i = 0; i < CONTENTS.size(); ++i) {
+        auto const INDEX = reader.find(getName(i));
+        ASSERT_EQ(static_cast<int64_t>(i), INDEX);
+        ASSERT_TRUE(reader.at(i).method == ZipIndexReader::METHOD_DEFLATE);
+        ASSERT_EQ(CONTENTS[i].size(), reader.at(i).size);
+        ASSERT_FALSE(reader.at(i).isDirectory());
+
+        ASSERT_EQ(E_SUCCESS, reader.extract(getName(i), buffer));
+        ASSERT_EQ(CONTENTS[i], std::string(buffer.begin(), buffer.end()));
+
+        std::string streamed;
+        std::size_t calls = 0;
+        ASSERT_EQ(E_SUCCESS, reader.extract(i, [&](char const * data, std::size_t size) -> bool {
+            streamed.append(data, size);
+            ++calls;
+            return true;
+        }, 4096));
+        ASSERT_EQ(CONTENTS[i], streamed);
+        ASSERT_LT(1u, calls);
+    }
+
+    // The buffer of the caller.
+    std::string small(CONTENTS[0].size() - 1, '\0');
+    ASSERT_EQ(E_SMALLBUF, reader.extract(0, &small[0], small.size()));
+    std::string large(CONTENTS[0].size() + 10, '\0');
+    ASSERT_EQ(E_SUCCESS, reader.extract(0, &large[0], large.size()));
+    ASSERT_EQ(CONTENTS[0], large.substr(0, CONTENTS[0].size()));
+
+    ASSERT_EQ(E_ECANCELED, reader.extract(0, [](char const *, std::size_t) -> bool { return false; }));
+
+    auto const OUTPUT = tttDir_Get() / "output.bin";
+    ASSERT_EQ(E_SUCCESS, reader.extractToFile(3, OUTPUT));
+    std::string file_content;
+    ASSERT_EQ(E_SUCCESS, filesystem::readFile(OUTPUT, file_content));
+    ASSERT_EQ(CONTENTS[3], file_content);
+}
+
+TEST(ZipIndexReaderTest, StoreAndArchive)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "store.zip";
+    auto const CONTENT = createContent(10000, 7);
+
+    // The libarchive writes the data descriptor after the data.
+    {
+        FileArchiveWriter writer(COMPRESS_FORMAT_ZIP, CompressType::CT_NONE);
+        ASSERT_EQ(E_SUCCESS, writer.setOptions("zip:compression=store"));
+        ASSERT_EQ(E_SUCCESS, writer.openFile(PATH));
+        ArchiveEntry entry;
+        entry.path_name = "stored";
+        entry.size = CONTENT.size();
+        ASSERT_EQ(E_SUCCESS, writer.writeFromMemory(entry, CONTENT.data(), CONTENT.size()));
+        ASSERT_EQ(E_SUCCESS, writer.close());
+    }
+
+    ZipIndexReader reader;
+    ASSERT_EQ(E_SUCCESS, reader.open(PATH));
+    ASSERT_EQ(1u, reader.size());
+    ASSERT_TRUE(reader.at(0).method == ZipIndexReader::METHOD_STORE);
+
+    util::Buffer buffer;
+    ASSERT_EQ(E_SUCCESS, reader.extract("stored", buffer));
+    ASSERT_EQ(CONTENT, std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(ZipIndexReaderTest, Broken)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "broken.zip";
+    auto const CONTENTS = writeZip(PATH, 2, 10000);
+
+    std::string archive;
+    ASSERT_EQ(E_SUCCESS, filesystem::readFile(PATH, archive));
+    // Flip the bits of the middle of the first compressed entry.
+    archive[100] = static_cast<char>(archive[100] ^ 0xFF);
+    ASSERT_EQ(E_SUCCESS, filesystem::writeFile(PATH, archive));
+
+    ZipIndexReader reader(PATH);
+    util::Buffer buffer;
+    ASSERT_EQ(E_DECODE, reader.extract(0, buffer));
+    ASSERT_EQ(E_SUCCESS, reader.extract(1, buffer));
+    ASSERT_EQ(CONTENTS[1], std::string(buffer.begin(), buffer.end()));
+}
+
+TEST(ZipIndexReaderTest, ForgedSize)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "forged.zip";
+    auto const CONTENTS = writeZip(PATH, 2, 10000);
+
+    std::string archive;
+    ASSERT_EQ(E_SUCCESS, filesystem::readFile(PATH, archive));
+    // The uncompressed size of the first central directory header.
+    auto const CENTRAL = archive.find(std::string("PK\x01\x02", 4));
+    ASSERT_NE(std::string::npos, CENTRAL);
+    archive.replace(CENTRAL + 24, 4, std::string("\xF0\xFF\xFF\xFF", 4));
+    ASSERT_EQ(E_SUCCESS, filesystem::writeFile(PATH, archive));
+
+    ZipIndexReader reader(PATH);
+    ASSERT_EQ(0xFFFFFFF0ull, reader.at(0).size);
+
+    // Rejected before the buffer is allocated.
+    util::Buffer buffer;
+    ASSERT_EQ(E_DECODE, reader.extract(0, buffer));
+    ASSERT_TRUE(buffer.empty());
+
+    ASSERT_EQ(E_SUCCESS, reader.extract(1, buffer));
+    ASSERT_EQ(CONTENTS[1], std::string(buffer.begin(), buffer.end()));
+
+    // The size limit of the caller.
+    reader.setMaxExtractSize(CONTENTS[1].size() - 1);
+    ASSERT_EQ(E_OORANGE, reader.extract(1, buffer));
+    reader.setMaxExtractSize(CONTENTS[1].size());
+    ASSERT_EQ(E_SUCCESS, reader.extract(1, buffer));
+}
+
+TEST(ZipIndexReaderTest, MultiThread)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "thread.zip";
+    auto const CONTENTS = writeZip(PATH, 50, 20000);
+
+    ZipIndexReader reader(PATH);
+    std::size_t const THREAD_COUNT = 4;
+    std::atomic<std::size_t> success(0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&, t](){
+            util::Buffer buffer;
+            for (std::size_t i = 0; i < CONTENTS.size(); ++i) {
+                auto const INDEX = (i + t * 7) % CONTENTS.size();
+                if (reader.extract(INDEX, buffer) == E_SUCCESS &&
+                    std::string(buffer.begin(), buffer.end()) == CONTENTS[INDEX]) {
+                    ++success;
+                }
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(THREAD_COUNT * CONTENTS.size(), success.load());
+}
+
+TEST(ZipIndexReaderTest, BenchmarkOfSingleEntry)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "benchmark.zip";
+    std::size_t const COUNT = 300;
+    auto const CONTENTS = writeZip(PATH, COUNT, 64 * 1024);
+    auto const TARGET = getName(COUNT / 2);
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    std::size_t archive_size = 0;
+    for (auto const & entry : decompressArchive(PATH)) {
+        if (entry.path_name == TARGET) {
+            archive_size = entry.data.size();
+        }
+    }
+    auto const ARCHIVE = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    ZipIndexReader reader(PATH);
+    util::Buffer buffer;
+    ASSERT_EQ(E_SUCCESS, reader.extract(TARGET, buffer));
+    auto const INDEXED = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(CONTENTS[COUNT / 2].size(), archive_size);
+    ASSERT_EQ(CONTENTS[COUNT / 2].size(), buffer.size());
+    std::cout << "decompressArchive: " << ARCHIVE << "us, ZipIndexReader: " << INDEXED << "us" << std::endl;
+}
+
@@ -3,6 +3,7 @@
  * @brief  Zip class tester.
  * @author zer0
  * @date   2016-11-17
+ * @date   2026-10-19 (Add the test of the Inflater)
  */
 
 #include <gtest/gtest.h>
@@ -44,6 +45,32 @@ TEST(ZipTest, Default)
     ASSERT_EQ(TEST_BODY, result);
 }
 
+TEST(ZipTest, Inflater)
+{
+    std::string const BODY1(1000, 'a');
+    std::string const BODY2 = "__tester_archive_ziptest_inflater__";
+
+    util::Buffer zlib;
+    util::Buffer gzip;
+    ASSERT_EQ(E_SUCCESS, encode(BODY1.data(), BODY1.size(), zlib, CompressionMethod::CM_ZLIB));
+    ASSERT_EQ(E_SUCCESS, encode(BODY2.data(), BODY2.size(), gzip, CompressionMethod::CM_GZIP));
+
+    Inflater inflater;
+    std::string output(BODY1.size(), '\0');
+    std::size_t output_size = 0;
+    ASSERT_EQ(E_SUCCESS, inflater.decode(zlib.data(), zlib.size(), &output[0], output.size(), &output_size));
+    ASSERT_EQ(BODY1, output.substr(0, output_size));
+
+    // Reuse the stream with the other format.
+    ASSERT_EQ(E_SUCCESS, inflater.decode(gzip.data(), gzip.size(), &output[0], output.size(), &output_size));
+    ASSERT_EQ(BODY2, output.substr(0, output_size));
+
+    ASSERT_EQ(E_SMALLBUF, inflater.decode(zlib.data(), zlib.size(), &output[0], 10));
+    ASSERT_NE(E_SUCCESS, inflater.decode(BODY2.data(), BODY2.size(), &output[0], output.size()));
+    ASSERT_EQ(E_SUCCESS, inflater.decode(gzip.data(), gzip.size(), &output[0], output.size(), &output_size));
+    ASSERT_EQ(BODY2, output.substr(0, output_size));
+}
+
 TEST(ZipTest, ImageTest)
 {
     int width    = 300;
@@ -8,6 +8,9 @@
 #include <gtest/gtest.h>
 #include <libtbag/bitwise/Checksum.hpp>
 
+#include <algorithm>
+#include <iostream>
+#include <string>
 #include <vector>
 
 using namespace libtbag;
@@ -35,3 +38,50 @@ TEST(ChecksumTest, CalcXorChecksum2)
     ASSERT_EQ(0xFF, calcXorChecksum(data.data(), data.size()));
 }
 
+
+TEST(ChecksumTest, CalcCrc32c)
+{
+    std::string const TEST_STRING = "123456789";
+    ASSERT_EQ(0xE3069283u, calcCrc32c(TEST_STRING.data(), TEST_STRING.size()));
+    ASSERT_EQ(0u, calcCrc32c(nullptr, 0));
+
+    // RFC 3720 (iSCSI), B.4. CRC Examples
+    std::vector<uint8_t> data(32, 0x00);
+    ASSERT_EQ(0x8A9136AAu, calcCrc32c(data.data(), data.size()));
+    std::fill(data.begin(), data.end(), 0xFF);
+    ASSERT_EQ(0x62A8AB43u, calcCrc32c(data.data(), data.size()));
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    ASSERT_EQ(0x46DD794Eu, calcCrc32c(data.data(), data.size()));
+}
+
+static uint32_t naiveCrc32c(uint8_t const * data, std::size_t size)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+TEST(ChecksumTest, CalcCrc32cIncremental)
+{
+    std::vector<uint8_t> data(10000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    auto const EXPECTED = naiveCrc32c(data.data(), data.size());
+    ASSERT_EQ(EXPECTED, calcCrc32c(data.data(), data.size()));
+
+    // Unaligned heads and tails of the hardware path.
+    for (std::size_t split = 0; split < 64; ++split) {
+        auto crc = calcCrc32c(data.data(), split);
+        crc = calcCrc32c(data.data() + split, data.size() - split, crc);
+        ASSERT_EQ(EXPECTED, crc) << "Split: " << split;
+    }
+    std::cout << "Hardware CRC32C: " << isHardwareCrc32c() << std::endl;
+}
@@ -3,10 +3,13 @@
  * @brief  Box class tester.
  * @author zer0
  * @date   2019-12-24
+ * @date   2026-10-19 (Add the test of the packet file)
  */
 
 #include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
 #include <libtbag/box/Box.hpp>
+#include <libtbag/filesystem/File.hpp>
 
 using namespace libtbag;
 using namespace libtbag::box;
@@ -50,6 +53,28 @@ TEST(Box_Encode_Test, Default)
     ASSERT_EQ(INFO, box2.getInfoString());
 }
 
+TEST(Box_Encode_Test, DecodeFile)
+{
+    Box box = {{11, 22}, {33, 44}};
+    Box::Buffer buffer;
+    ASSERT_EQ(E_SUCCESS, box.encode(buffer));
+
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "box.packet";
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::writeFile(PATH, (char const *)buffer.data(), buffer.size()));
+
+    Box box2;
+    std::size_t computed_size = 0;
+    ASSERT_EQ(E_SUCCESS, box2.decodeFile(PATH, &computed_size));
+    ASSERT_EQ(buffer.size(), computed_size);
+    ASSERT_TRUE(box2.is_si32());
+    ASSERT_EQ(2, box2.dim(0));
+    ASSERT_EQ(2, box2.dim(1));
+    ASSERT_EQ(44, box2.offset<si32>(3));
+
+    ASSERT_NE(E_SUCCESS, box2.decodeFile(tttDir_Get() / "not_exists"));
+}
+
 TEST(Box_Encode_Test, InfoOnly)
 {
     std::string const INFO = "{TEMP STRING}";
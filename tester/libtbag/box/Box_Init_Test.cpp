@@ -3,6 +3,7 @@
  * @brief  Box class tester.
  * @author zer0
  * @date   2020-01-02
+ * @date   2026-10-19 (Add the tests of the bulk random generator)
  */
 
 #include <gtest/gtest.h>
@@ -120,3 +121,40 @@ TEST(Box_Init_Test, Rand)
     }
 }
 
+
+TEST(Box_Init_Test, Rand_Converted)
+{
+    // The type of the range differs from the box, so the values are converted per element.
+    auto box = Box::array<int>(200);
+    ASSERT_EQ(E_SUCCESS, box.rand(10.0, 20.0));
+    ASSERT_TRUE(box.is_si32());
+    ASSERT_EQ(200, box.size());
+    for (auto i = 0; i < 200; ++i) {
+        ASSERT_LE(10, box.at<int>(i));
+        ASSERT_GE(20, box.at<int>(i));
+    }
+}
+
+TEST(Box_Init_Test, Rand_Real)
+{
+    auto box = Box::rand<float>(-1.0f, 1.0f, 10, 20);
+    ASSERT_TRUE(box.is_fp32());
+    ASSERT_EQ(200, box.size());
+    for (auto i = 0; i < 200; ++i) {
+        ASSERT_LE(-1.0f, box.offset<float>(i));
+        ASSERT_GT(1.0f, box.offset<float>(i));
+    }
+}
+
+TEST(Box_Init_Test, Randn)
+{
+    auto box = Box::randn<double>(5.0, 0.5, 100, 100);
+    ASSERT_TRUE(box.is_fp64());
+    ASSERT_EQ(10000, box.size());
+
+    double sum = 0;
+    for (auto i = 0; i < 10000; ++i) {
+        sum += box.offset<double>(i);
+    }
+    ASSERT_NEAR(5.0, sum / 10000, 0.05);
+}
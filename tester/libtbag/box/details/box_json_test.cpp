@@ -0,0 +1,225 @@
+/**
+ * @file   box_json_test.cpp
+ * @brief  box json tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the NonFinite test)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/box/details/box_json.hpp>
+#include <libtbag/box/BoxPacket.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+
+using namespace libtbag;
+using namespace libtbag::box;
+using namespace libtbag::box::details;
+
+static void __box_json_test_fill(box_data & box)
+{
+    ASSERT_EQ(E_SUCCESS, box.resize_args(BT_FLOAT64, BD_CPU, nullptr, 2, 3, 2));
+    auto * data = (fp64*)box.data;
+    for (ui32 i = 0; i < box.size; ++i) {
+        data[i] = i * 0.5 - 1.0;
+    }
+    box.ext[0] = 7;
+    box.ext[3] = static_cast<ui64>(-3);
+    std::string const INFO = "info";
+    box.checked_assign_info_buffer((ui8 const *)INFO.data(), static_cast<ui32>(INFO.size()));
+}
+
+static void __box_json_test_equals(box_data const & lh, box_data const & rh)
+{
+    ASSERT_EQ(lh.type, rh.type);
+    ASSERT_EQ(lh.device, rh.device);
+    ASSERT_TRUE(box_ext_is_equals(lh.ext, rh.ext));
+    ASSERT_TRUE(box_dim_is_equals(lh.dims, lh.rank, rh.dims, rh.rank));
+    ASSERT_EQ(lh.size, rh.size);
+    ASSERT_EQ(0, memcmp(lh.data, rh.data, lh.size * box_get_type_byte(lh.type)));
+    ASSERT_EQ(lh.info_size, rh.info_size);
+    ASSERT_EQ(0, memcmp(lh.info, rh.info, lh.info_size));
+}
+
+TEST(box_json_test, Default)
+{
+    box_data box;
+    __box_json_test_fill(box);
+
+    std::string json;
+    ASSERT_EQ(E_SUCCESS, box_encode_json(&box, json));
+    ASSERT_STREQ(R"({"ext0":7,"ext3":-3,"dims":[3,2],"data_type":"DoubleArr","data":{"arr":)"
+                 R"([-1.0,-0.5,0.0,0.5,1.0,1.5]},)"
+                 R"("info":[105,110,102,111]})", json.c_str());
+
+    box_data box2;
+    ASSERT_EQ(E_SUCCESS, box_decode_json(json.data(), json.size(), &box2));
+    __box_json_test_equals(box, box2);
+}
+
+TEST(box_json_test, Compatibility)
+{
+    box_data box;
+    __box_json_test_fill(box);
+
+    // flatbuffers -> box_decode_json
+    BoxPacketBuilder builder;
+    ASSERT_EQ(E_SUCCESS, builder.build(&box));
+    auto const FLATBUFFERS_JSON = builder.toJsonString();
+    box_data box2;
+    ASSERT_EQ(E_SUCCESS, box_decode_json(FLATBUFFERS_JSON.data(), FLATBUFFERS_JSON.size(), &box2));
+    ASSERT_TRUE(box_dim_is_equals(box.dims, box.rank, box2.dims, box2.rank));
+    ASSERT_TRUE(box_ext_is_equals(box.ext, box2.ext));
+    ASSERT_EQ(box.info_size, box2.info_size);
+
+    // box_encode_json -> flatbuffers
+    std::string json;
+    ASSERT_EQ(E_SUCCESS, box_encode_json(&box, json));
+    box_data box3;
+    BoxPacketParser parser;
+    ASSERT_EQ(E_SUCCESS, parser.parseJson(json, &box3));
+    __box_json_test_equals(box, box3);
+}
+
+TEST(box_json_test, Types)
+{
+    box_data b;
+    ASSERT_EQ(E_SUCCESS, b.resize_args(BT_BOOL, BD_CPU, nullptr, 1, 3));
+    ((bool*)b.data)[0] = true;
+    ((bool*)b.data)[1] = false;
+    ((bool*)b.data)[2] = true;
+
+    box_data c;
+    ASSERT_EQ(E_SUCCESS, c.resize_args(BT_COMPLEX64, BD_CPU, nullptr, 1, 2));
+    ((c64*)c.data)[0] = c64(1.5f, -2.0f);
+    ((c64*)c.data)[1] = c64(0.1f, 3.0f);
+
+    box_data u;
+    ASSERT_EQ(E_SUCCESS, u.resize_args(BT_UINT64, BD_CPU, nullptr, 1, 2));
+    ((ui64*)u.data)[0] = 18446744073709551615ULL;
+    ((ui64*)u.data)[1] = 1;
+
+    for (auto const * box : {&b, &c, &u}) {
+        std::string json;
+        ASSERT_EQ(E_SUCCESS, box_encode_json(box, json));
+        box_data result;
+        ASSERT_EQ(E_SUCCESS, box_decode_json(json.data(), json.size(), &result));
+        __box_json_test_equals(*box, result);
+    }
+}
+
+TEST(box_json_test, NonFinite)
+{
+    box_data f;
+    ASSERT_EQ(E_SUCCESS, f.resize_args(BT_FLOAT32, BD_CPU, nullptr, 1, 4));
+    ((fp32*)f.data)[0] = std::numeric_limits<fp32>::quiet_NaN();
+    ((fp32*)f.data)[1] = std::numeric_limits<fp32>::infinity();
+    ((fp32*)f.data)[2] = -std::numeric_limits<fp32>::infinity();
+    ((fp32*)f.data)[3] = 1.5f;
+
+    std::string json;
+    ASSERT_EQ(E_SUCCESS, box_encode_json(&f, json));
+    ASSERT_STREQ(R"({"dims":[4],"data_type":"FloatArr","data":{"arr":[nan,inf,-inf,1.5]}})", json.c_str());
+
+    box_data result;
+    ASSERT_EQ(E_SUCCESS, box_decode_json(json.data(), json.size(), &result));
+    ASSERT_EQ(BT_FLOAT32, result.type);
+    ASSERT_EQ(4, result.size);
+    ASSERT_TRUE(std::isnan(((fp32*)result.data)[0]));
+    ASSERT_EQ(std::numeric_limits<fp32>::infinity(), ((fp32*)result.data)[1]);
+    ASSERT_EQ(-std::numeric_limits<fp32>::infinity(), ((fp32*)result.data)[2]);
+    ASSERT_EQ(1.5f, ((fp32*)result.data)[3]);
+
+    box_data c;
+    ASSERT_EQ(E_SUCCESS, c.resize_args(BT_COMPLEX128, BD_CPU, nullptr, 1, 1));
+    ((c128*)c.data)[0] = c128(-std::numeric_limits<fp64>::infinity(), std::numeric_limits<fp64>::quiet_NaN());
+    ASSERT_EQ(E_SUCCESS, box_encode_json(&c, json));
+    ASSERT_EQ(E_SUCCESS, box_decode_json(json.data(), json.size(), &result));
+    ASSERT_EQ(BT_COMPLEX128, result.type);
+    ASSERT_EQ(-std::numeric_limits<fp64>::infinity(), ((c128*)result.data)[0].real());
+    ASSERT_TRUE(std::isnan(((c128*)result.data)[0].imag()));
+
+    // flatbuffers -> box_decode_json
+    BoxPacketBuilder builder;
+    ASSERT_EQ(E_SUCCESS, builder.build(&f));
+    auto const FLATBUFFERS_JSON = builder.toJsonString();
+    box_data flatbuffers_result;
+    ASSERT_EQ(E_SUCCESS, box_decode_json(FLATBUFFERS_JSON.data(), FLATBUFFERS_JSON.size(), &flatbuffers_result));
+    ASSERT_TRUE(std::isnan(((fp32*)flatbuffers_result.data)[0]));
+    ASSERT_EQ(std::numeric_limits<fp32>::infinity(), ((fp32*)flatbuffers_result.data)[1]);
+    ASSERT_EQ(-std::numeric_limits<fp32>::infinity(), ((fp32*)flatbuffers_result.data)[2]);
+
+    // The integer types have no non-finite values.
+    char const * const INT_JSON = R"({"dims": [1], "data_type": "IntArr", "data": {"arr": [nan]}})";
+    ASSERT_EQ(E_PARSING, box_decode_json(INT_JSON, strlen(INT_JSON), &result));
+    char const * const PENDING_JSON = R"({"data": {"arr": [inf]}, "dims": [1], "data_type": "LongArr"})";
+    ASSERT_EQ(E_PARSING, box_decode_json(PENDING_JSON, strlen(PENDING_JSON), &result));
+}
+
+TEST(box_json_test, AnyOrder)
+{
+    char const * const JSON = R"({"dims": [2], "data": {"arr": [{"imag": 2, "real": 1}, {"real": 3, "imag": 4}]},)"
+                              R"( "data_type": "Complex128Arr", "ext1": 5})";
+    box_data box;
+    ASSERT_EQ(E_SUCCESS, box_decode_json(JSON, strlen(JSON), &box));
+    ASSERT_EQ(BT_COMPLEX128, box.type);
+    ASSERT_EQ(2, box.size);
+    ASSERT_EQ(5, box.ext[1]);
+    ASSERT_EQ(c128(1, 2), ((c128*)box.data)[0]);
+    ASSERT_EQ(c128(3, 4), ((c128*)box.data)[1]);
+}
+
+TEST(box_json_test, Error)
+{
+    char const * const INVALID_JSONS[] = {
+        R"({"data_type": "IntArr", "data": {"arr": [1, 2]}, "dims": [2])",
+        R"({"unknown": 1})",
+        R"({"data": {"arr": [1, 2]}, "dims": [2]})",
+        R"({"data_type": "IntArr", "dims": [-1]})",
+        R"([1, 2])",
+    };
+    for (auto const * json : INVALID_JSONS) {
+        box_data box;
+        ASSERT_EQ(E_PARSING, box_decode_json(json, strlen(json), &box)) << json;
+    }
+
+    char const * const UNKNOWN_TYPE = R"({"data_type": "StringArr"})";
+    box_data box;
+    ASSERT_EQ(E_ENOMSG, box_decode_json(UNKNOWN_TYPE, strlen(UNKNOWN_TYPE), &box));
+}
+
+TEST(box_json_test, Benchmark)
+{
+    box_data box;
+    ASSERT_EQ(E_SUCCESS, box.resize_args(BT_FLOAT32, BD_CPU, nullptr, 2, 512, 512));
+    auto * data = (fp32*)box.data;
+    for (ui32 i = 0; i < box.size; ++i) {
+        data[i] = i * 0.5f;
+    }
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    BoxPacketBuilder builder;
+    ASSERT_EQ(E_SUCCESS, builder.build(&box));
+    auto const FLATBUFFERS_JSON = builder.toJsonString();
+    box_data flatbuffers_result;
+    BoxPacketParser parser;
+    ASSERT_EQ(E_SUCCESS, parser.parseJson(FLATBUFFERS_JSON, &flatbuffers_result));
+    auto const FLATBUFFERS = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    std::string json;
+    ASSERT_EQ(E_SUCCESS, box_encode_json(&box, json));
+    box_data result;
+    ASSERT_EQ(E_SUCCESS, box_decode_json(json.data(), json.size(), &result));
+    auto const BOX_JSON = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    __box_json_test_equals(box, result);
+    std::cout << "flatbuffers: " << FLATBUFFERS << "us, box_json: " << BOX_JSON << "us" << std::endl;
+}
+
@@ -8,6 +8,13 @@
 #include <gtest/gtest.h>
 #include <libtbag/crypto/Base64.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
 using namespace libtbag;
 using namespace libtbag::crypto;
 
@@ -39,3 +46,195 @@ TEST(Base64Test, Default2)
     ASSERT_EQ(ORIGINAL, decode);
 }
 
+static std::string naiveEncodeBase64(std::string const & input, bool url_safe, bool padding)
+{
+    char const * alphabet = url_safe ?
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_" :
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string result;
+    std::size_t bits = 0;
+    uint32_t value = 0;
+    for (auto c : input) {
+        value = (value << 8) | static_cast<uint8_t>(c);
+        bits += 8;
+        while (bits >= 6) {
+            bits -= 6;
+            result.push_back(alphabet[(value >> bits) & 0x3F]);
+        }
+    }
+    if (bits > 0) {
+        result.push_back(alphabet[(value << (6 - bits)) & 0x3F]);
+    }
+    while (padding && (result.size() % 4) != 0) {
+        result.push_back('=');
+    }
+    return result;
+}
+
+static std::string createRandomBytes(std::size_t size, unsigned seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::string result(size, '\0');
+    for (auto & c : result) {
+        c = static_cast<char>(dist(engine));
+    }
+    return result;
+}
+
+TEST(Base64Test, Rfc4648)
+{
+    char const * const TESTS[][2] = {
+            {"", ""}, {"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"},
+            {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"},
+    };
+    for (auto const & test : TESTS) {
+        std::string encode;
+        ASSERT_TRUE(encodeBase64(std::string(test[0]), encode));
+        ASSERT_EQ(std::string(test[1]), encode);
+        ASSERT_EQ(strlen(test[1]), getEncodeLength(strlen(test[0])));
+        ASSERT_EQ(strlen(test[0]), getDecodeLength(std::string(test[1])));
+
+        std::string decode;
+        ASSERT_TRUE(decodeBase64(encode, decode));
+        ASSERT_EQ(std::string(test[0]), decode);
+    }
+}
+
+TEST(Base64Test, AllLengths)
+{
+    // The lengths cover the SIMD blocks and all the tails.
+    for (std::size_t size = 0; size < 300; ++size) {
+        auto const INPUT = createRandomBytes(size, static_cast<unsigned>(size));
+        for (int url_safe = 0; url_safe < 2; ++url_safe) {
+            for (int padding = 0; padding < 2; ++padding) {
+                auto const EXPECTED = naiveEncodeBase64(INPUT, url_safe, padding);
+                ASSERT_EQ(EXPECTED.size(), getEncodeLength(size, padding));
+
+                std::string encode(EXPECTED.size(), '\0');
+                ASSERT_EQ(EXPECTED.size(), encodeBase64(INPUT.data(), size, &encode[0], url_safe, padding));
+                ASSERT_EQ(EXPECTED, encode);
+
+                std::string decode(getDecodeLength(encode.data(), encode.size()), '\0');
+                std::size_t decode_size = 0;
+                ASSERT_EQ(E_SUCCESS, decodeBase64(encode.data(), encode.size(), &decode[0], &decode_size, url_safe));
+                ASSERT_EQ(size, decode_size);
+                ASSERT_EQ(INPUT, decode.substr(0, decode_size));
+            }
+        }
+    }
+}
+
+TEST(Base64Test, UrlSafe)
+{
+    std::string const INPUT = "\xFB\xFF\xBF\xFB\xFF";
+
+    std::string encode;
+    ASSERT_TRUE(encodeBase64(INPUT, encode));
+    ASSERT_EQ("+/+/+/8=", encode);
+    ASSERT_TRUE(encodeBase64Url(INPUT.data(), INPUT.size(), encode));
+    ASSERT_EQ("-_-_-_8", encode);
+
+    util::Buffer decode;
+    ASSERT_TRUE(decodeBase64Url(encode, decode));
+    ASSERT_EQ(INPUT, std::string(decode.begin(), decode.end()));
+
+    // The alphabets are not mixed.
+    ASSERT_FALSE(decodeBase64Url(std::string("+/+/+/8="), decode));
+    ASSERT_FALSE(decodeBase64(std::string("-_-_-_8="), decode));
+}
+
+TEST(Base64Test, WhitespaceAndInvalid)
+{
+    auto const INPUT = createRandomBytes(200, 0);
+    auto const ENCODE = naiveEncodeBase64(INPUT, false, true);
+
+    // Line breaks of MIME.
+    std::string lines;
+    for (std::size_t i = 0; i < ENCODE.size(); i += 76) {
+        lines += ENCODE.substr(i, 76) + "\r\n";
+    }
+    util::Buffer decode;
+    ASSERT_TRUE(decodeBase64(lines, decode));
+    ASSERT_EQ(INPUT, std::string(decode.begin(), decode.end()));
+
+    // Invalid characters in the SIMD blocks and the tail.
+    for (std::size_t i = 0; i < ENCODE.size(); i += 7) {
+        auto invalid = ENCODE;
+        invalid[i] = '*';
+        ASSERT_FALSE(decodeBase64(invalid, decode)) << "Index: " << i;
+    }
+
+    ASSERT_FALSE(decodeBase64(std::string("Q"), decode));
+    ASSERT_FALSE(decodeBase64(std::string("Q==="), decode));
+    ASSERT_FALSE(decodeBase64(std::string("QQ==QQ=="), decode));
+    ASSERT_TRUE(decodeBase64(std::string("QQ"), decode));
+    ASSERT_EQ("A", std::string(decode.begin(), decode.end()));
+}
+
+TEST(Base64Test, Stream)
+{
+    auto const INPUT = createRandomBytes(1000, 1);
+    for (int url_safe = 0; url_safe < 2; ++url_safe) {
+        auto const EXPECTED = naiveEncodeBase64(INPUT, url_safe, true);
+        std::mt19937 engine(static_cast<unsigned>(url_safe));
+        std::uniform_int_distribution<std::size_t> dist(0, 70);
+
+        Base64Encoder encoder(url_safe);
+        std::string encode;
+        for (std::size_t i = 0; i < INPUT.size();) {
+            auto const CHUNK = std::min(dist(engine), INPUT.size() - i);
+            encoder.update(INPUT.data() + i, CHUNK, encode);
+            i += CHUNK;
+        }
+        encoder.finish(encode);
+        ASSERT_EQ(EXPECTED, encode);
+
+        Base64Decoder decoder(url_safe);
+        util::Buffer decode;
+        for (std::size_t i = 0; i < encode.size();) {
+            auto const CHUNK = std::min(dist(engine), encode.size() - i);
+            ASSERT_EQ(E_SUCCESS, decoder.update(encode.data() + i, CHUNK, decode));
+            i += CHUNK;
+        }
+        ASSERT_EQ(E_SUCCESS, decoder.finish(decode));
+        ASSERT_EQ(INPUT, std::string(decode.begin(), decode.end()));
+    }
+}
+
+TEST(Base64Test, BenchmarkOfCodec)
+{
+    std::size_t const TEST_SIZE = 1024 * 1024;
+    int const TEST_COUNT = 16;
+
+    using namespace std::chrono;
+    auto const INPUT = createRandomBytes(TEST_SIZE, 2);
+
+    auto const BEGIN1 = system_clock::now();
+    std::string naive;
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        naive = naiveEncodeBase64(INPUT, false, true);
+    }
+    auto const DURATION1 = duration_cast<microseconds>(system_clock::now() - BEGIN1).count();
+
+    auto const BEGIN2 = system_clock::now();
+    std::string encode;
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        encodeBase64(INPUT, encode);
+    }
+    auto const DURATION2 = duration_cast<microseconds>(system_clock::now() - BEGIN2).count();
+
+    auto const BEGIN3 = system_clock::now();
+    std::string decode;
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        decodeBase64(encode, decode);
+    }
+    auto const DURATION3 = duration_cast<microseconds>(system_clock::now() - BEGIN3).count();
+
+    ASSERT_EQ(naive, encode);
+    ASSERT_EQ(INPUT, decode);
+    std::cout << "Naive encode: " << DURATION1 << "us, "
+              << "Encode: " << DURATION2 << "us, "
+              << "Decode: " << DURATION3 << "us" << std::endl;
+}
+
@@ -0,0 +1,228 @@
+/**
+ * @file   HasherTest.cpp
+ * @brief  Hasher class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
+#include <libtbag/crypto/Hasher.hpp>
+#include <libtbag/crypto/Blake3.hpp>
+#include <libtbag/crypto/XxHash3.hpp>
+#include <libtbag/crypto/Md5.hpp>
+#include <libtbag/filesystem/File.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::crypto;
+
+static std::vector<uint8_t> createPatternBytes(std::size_t size)
+{
+    std::vector<uint8_t> result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<uint8_t>(i % 251);
+    }
+    return result;
+}
+
+TEST(HasherTest, HashName)
+{
+    ASSERT_EQ(HashType::HT_SHA256, getHashType("SHA256"));
+    ASSERT_EQ(HashType::HT_BLAKE3, getHashType(getHashName(HashType::HT_BLAKE3)));
+    ASSERT_EQ(HashType::HT_NONE, getHashType("unknown"));
+    ASSERT_EQ(32, getDigestSize(HashType::HT_SHA256));
+    ASSERT_EQ(8, getDigestSize(HashType::HT_XXH3_64));
+
+    Hasher hasher(HashType::HT_NONE);
+    ASSERT_FALSE(hasher.isReady());
+    ASSERT_EQ(E_NREADY, hasher.update("abc"));
+}
+
+TEST(HasherTest, KnownVectors)
+{
+    std::string const INPUT = "abc";
+    ASSERT_EQ("900150983cd24fb0d6963f7d28e17f72", getHashHex(HashType::HT_MD5, INPUT));
+    ASSERT_EQ("a9993e364706816aba3e25717850c26c9cd0d89d", getHashHex(HashType::HT_SHA1, INPUT));
+    ASSERT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+              getHashHex(HashType::HT_SHA256, INPUT));
+    ASSERT_EQ("ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+              "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f",
+              getHashHex(HashType::HT_SHA512, INPUT));
+    ASSERT_EQ("6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85",
+              getHashHex(HashType::HT_BLAKE3, INPUT));
+    ASSERT_EQ("af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262",
+              getHashHex(HashType::HT_BLAKE3, std::string()));
+    ASSERT_EQ("2d06800538d394c2", getHashHex(HashType::HT_XXH3_64, std::string()));
+    ASSERT_EQ("e3069283", getHashHex(HashType::HT_CRC32C, std::string("123456789")));
+}
+
+TEST(HasherTest, Blake3)
+{
+    struct Vector { std::size_t size; char const * hex; };
+    Vector const VECTORS[] = {
+            {0, "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262"},
+            {1, "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213"},
+            {63, "e9bc37a594daad83be9470df7f7b3798297c3d834ce80ba85d6e207627b7db7b"},
+            {64, "4eed7141ea4a5cd4b788606bd23f46e212af9cacebacdc7d1f4c6dc7f2511b98"},
+            {65, "de1e5fa0be70df6d2be8fffd0e99ceaa8eb6e8c93a63f2d8d1c30ecb6b263dee"},
+            {1023, "10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11"},
+            {1024, "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7"},
+            {1025, "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444"},
+            {2048, "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a"},
+            {2049, "5f4d72f40d7a5f82b15ca2b2e44b1de3c2ef86c426c95c1af0b6879522563030"},
+            {3072, "b98cb0ff3623be03326b373de6b9095218513e64f1ee2edd2525c7ad1e5cffd2"},
+            {3073, "7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd3"},
+            {4096, "015094013f57a5277b59d8475c0501042c0b642e531b0a1c8f58d2163229e969"},
+            {4097, "9b4052b38f1c5fc8b1f9ff7ac7b27cd242487b3d890d15c96a1c25b8aa0fb995"},
+            {5120, "9cadc15fed8b5d854562b26a9536d9707cadeda9b143978f319ab34230535833"},
+            {8193, "bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b"},
+            {31744, "62b6960e1a44bcc1eb1a611a8d6235b6b4b78f32e7abc4fb4c6cdcce94895c47"},
+            {102400, "bc3e3d41a1146b069abffad3c0d44860cf664390afce4d9661f7902e7943e085"},
+            {200000, "55409142cced2ec79897459f170b6d22565daf883710b4ad7aeeddaef54244b4"},
+    };
+
+    auto const INPUT = createPatternBytes(200000);
+    for (auto const & v : VECTORS) {
+        ASSERT_EQ(v.hex, getHashHex(HashType::HT_BLAKE3, INPUT.data(), v.size)) << "Size: " << v.size;
+    }
+}
+
+TEST(HasherTest, Blake3Subtrees)
+{
+    // 4 subtrees of 2 chunks and the last partial subtree.
+    std::size_t const SUBTREE_CHUNKS = 2;
+    std::size_t const SUBTREE_SIZE = SUBTREE_CHUNKS * Blake3::CHUNK_LEN;
+    std::size_t const SIZE = 4 * SUBTREE_SIZE + 100;
+    auto const INPUT = createPatternBytes(SIZE);
+
+    std::vector<Blake3::ChainingValue> cvs;
+    for (std::size_t i = 0; i < 4; ++i) {
+        Blake3 subtree(i * SUBTREE_CHUNKS);
+        subtree.update(INPUT.data() + i * SUBTREE_SIZE, SUBTREE_SIZE);
+        cvs.push_back(subtree.getOutput().getChainingValue());
+    }
+    Blake3 last(4 * SUBTREE_CHUNKS);
+    last.update(INPUT.data() + 4 * SUBTREE_SIZE, 100);
+
+    Hasher::Digest merged(Blake3::OUT_LEN);
+    Blake3::mergeSubtrees(cvs.data(), cvs.size(), last.getOutput(), merged.data());
+
+    Hasher::Digest expected;
+    ASSERT_EQ(E_SUCCESS, getHash(HashType::HT_BLAKE3, INPUT.data(), INPUT.size(), expected));
+    ASSERT_EQ(expected, merged);
+}
+
+TEST(HasherTest, XxHash3)
+{
+    struct Vector { std::size_t size; uint64_t hash; uint64_t seed_hash; };
+    Vector const VECTORS[] = {
+            {0, 0x2D06800538D394C2ull, 0x602B0E2CD6662C8Bull},
+            {1, 0xC44BDFF4074EECDBull, 0x062B185E4E01441Aull},
+            {3, 0x5F4299FC161C9CBBull, 0xBE1FD1F503B5D59Eull},
+            {4, 0x60DAB036A58211F2ull, 0x89878861FCE0DA55ull},
+            {8, 0x3A1C2D7C85AF88F8ull, 0xB82D9EF5FD6B3172ull},
+            {9, 0xE9612598145BB9DCull, 0xFE11EEFF350B91EFull},
+            {16, 0x8355E3A6F61770DBull, 0x3D392960BFD9DF8Aull},
+            {17, 0x9EF341A99DE37328ull, 0x89E5F063C641DE9Full},
+            {128, 0x85C6174C7FF4C46Bull, 0x77BF966868F4B200ull},
+            {129, 0xEC7642B431BA3E5Aull, 0x747F159FDD2D2177ull},
+            {240, 0x375A384D957FE865ull, 0xE6E766DB0868C372ull},
+            {241, 0x02E8CD95421C6D02ull, 0x172114DE208C5A80ull},
+            {1023, 0xD3D91D80AC495685ull, 0x229C828671F63F2Eull},
+            {1024, 0xE5D78BAFA45B2AA5ull, 0x19244DD37041BE92ull},
+            {1025, 0xE95C42288F28186Eull, 0xC52F40C41D849838ull},
+            {2048, 0x25339063DB861586ull, 0x9918A28F01FEA319ull},
+            {4096, 0x7135FFA504F1BC71ull, 0xB4BAE170D699109Cull},
+            {8193, 0xD6735A2B792CF505ull, 0xE2239A17505E81F5ull},
+            {102400, 0x1428E17F1CAC2837ull, 0x9996766CF7510F48ull},
+            {200000, 0xF0543157A23A8634ull, 0x7D8196A3D22BBF4Cull},
+    };
+
+    uint64_t const SEED = 0x9E3779B97F4A7C15ull;
+    auto const INPUT = createPatternBytes(200000);
+    for (auto const & v : VECTORS) {
+        ASSERT_EQ(v.hash, XxHash3::hash(INPUT.data(), v.size)) << "Size: " << v.size;
+        ASSERT_EQ(v.seed_hash, XxHash3::hash(INPUT.data(), v.size, SEED)) << "Size: " << v.size;
+
+        XxHash3 stream(SEED);
+        for (std::size_t i = 0; i < v.size;) {
+            auto const CHUNK = std::min<std::size_t>(i % 300 + 1, v.size - i);
+            stream.update(INPUT.data() + i, CHUNK);
+            i += CHUNK;
+        }
+        ASSERT_EQ(v.seed_hash, stream.digest()) << "Size: " << v.size;
+    }
+}
+
+TEST(HasherTest, Incremental)
+{
+    HashType const TYPES[] = {
+            HashType::HT_MD5, HashType::HT_SHA1, HashType::HT_SHA256, HashType::HT_SHA512,
+            HashType::HT_BLAKE3, HashType::HT_XXH3_64, HashType::HT_CRC32C,
+    };
+
+    std::mt19937 engine(36);
+    std::uniform_int_distribution<std::size_t> dist(0, 5000);
+    auto const INPUT = createPatternBytes(100000);
+
+    for (auto type : TYPES) {
+        auto const EXPECTED = getHashHex(type, INPUT.data(), INPUT.size());
+        ASSERT_EQ(getDigestSize(type) * 2, EXPECTED.size());
+
+        Hasher hasher(type);
+        for (int repeat = 0; repeat < 2; ++repeat) {
+            for (std::size_t i = 0; i < INPUT.size();) {
+                auto const CHUNK = std::min(dist(engine), INPUT.size() - i);
+                ASSERT_EQ(E_SUCCESS, hasher.update(INPUT.data() + i, CHUNK));
+                i += CHUNK;
+            }
+            ASSERT_EQ(EXPECTED, hasher.finalHex()) << getHashName(type);
+            ASSERT_EQ(E_SUCCESS, hasher.reset());
+        }
+    }
+}
+
+TEST(HasherTest, FileHash)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "hash.bin";
+
+    // 3 subtrees and the partial subtree.
+    auto const INPUT = createPatternBytes(3 * 4 * 1024 * 1024 + 12345);
+    ASSERT_EQ(E_SUCCESS, filesystem::writeFile(PATH, reinterpret_cast<char const *>(INPUT.data()), INPUT.size()));
+
+    auto const EXPECTED = getHashHex(HashType::HT_BLAKE3, INPUT.data(), INPUT.size());
+    ASSERT_EQ(EXPECTED, getFileHashHex(HashType::HT_BLAKE3, PATH, 1));
+    ASSERT_EQ(EXPECTED, getFileHashHex(HashType::HT_BLAKE3, PATH, 2));
+    ASSERT_EQ(EXPECTED, getFileHashHex(HashType::HT_BLAKE3, PATH, 8));
+
+    ASSERT_EQ(getHashHex(HashType::HT_SHA256, INPUT.data(), INPUT.size()),
+              getFileHashHex(HashType::HT_SHA256, PATH));
+    ASSERT_EQ(getHashHex(HashType::HT_MD5, INPUT.data(), INPUT.size()), getMd5FromFile(PATH));
+    ASSERT_TRUE(getFileHashHex(HashType::HT_SHA256, PATH.getString() + ".none").empty());
+}
+
+TEST(HasherTest, BenchmarkOfHashes)
+{
+    std::size_t const TEST_SIZE = 16 * 1024 * 1024;
+    HashType const TYPES[] = {
+            HashType::HT_MD5, HashType::HT_SHA256, HashType::HT_SHA512,
+            HashType::HT_BLAKE3, HashType::HT_XXH3_64, HashType::HT_CRC32C,
+    };
+
+    using namespace std::chrono;
+    auto const INPUT = createPatternBytes(TEST_SIZE);
+    for (auto type : TYPES) {
+        auto const BEGIN = system_clock::now();
+        ASSERT_FALSE(getHashHex(type, INPUT.data(), INPUT.size()).empty());
+        auto const DURATION = duration_cast<microseconds>(system_clock::now() - BEGIN).count();
+        std::cout << getHashName(type) << ": " << DURATION << "us" << std::endl;
+    }
+}
+
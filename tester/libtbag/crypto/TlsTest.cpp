@@ -10,6 +10,11 @@
 #include <libtbag/crypto/Rsa.hpp>
 #include <libtbag/crypto/X509.hpp>
 
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
 using namespace libtbag;
 using namespace libtbag::crypto;
 
@@ -94,3 +99,149 @@ TEST(TlsTest, Default)
     }
 }
 
+
+/** Run the in-memory handshake until both sides are finished. */
+static bool runHandshake(Tls & client, Tls & server)
+{
+    std::vector<char> buffer;
+    client.connect();
+    server.accept();
+    client.handshake();
+
+    for (int i = 0; i < 8 && !(client.isFinished() && server.isFinished()); ++i) {
+        buffer.clear();
+        client.drain(buffer);
+        if (!buffer.empty()) {
+            server.writeToReadBuffer(buffer.data(), buffer.size());
+        }
+        server.handshake();
+
+        buffer.clear();
+        server.drain(buffer);
+        if (!buffer.empty()) {
+            client.writeToReadBuffer(buffer.data(), buffer.size());
+        }
+        client.handshake();
+    }
+
+    // The last flight of the client. (e.g. Finished of the abbreviated handshake)
+    buffer.clear();
+    client.drain(buffer);
+    if (!buffer.empty()) {
+        server.writeToReadBuffer(buffer.data(), buffer.size());
+        server.handshake();
+    }
+    return client.isFinished() && server.isFinished();
+}
+
+TEST(TlsTest, Span)
+{
+    Tls context(Tls::create_memory_cert{});
+    Tls server(Tls::reference_ssl_context{}, context);
+    Tls client;
+    ASSERT_TRUE(runHandshake(client, server));
+
+    // Small buffers are coalesced to a record.
+    std::string const PART1 = "Hello, ";
+    std::string const PART2 = "World!";
+    std::string const LARGE(Tls::MAX_RECORD_SIZE * 2 + 100, 'x');
+
+    libtbag::util::binf const INFOS[] = {
+            libtbag::util::binf(const_cast<char*>(PART1.data()), PART1.size()),
+            libtbag::util::binf(const_cast<char*>(PART2.data()), PART2.size()),
+            libtbag::util::binf(const_cast<char*>(LARGE.data()), LARGE.size()),
+    };
+    ASSERT_EQ(E_SUCCESS, client.write(INFOS, 3));
+
+    std::vector<char> records;
+    auto const DRAIN_SIZE = client.drain(records);
+    ASSERT_LT(PART1.size() + PART2.size() + LARGE.size(), DRAIN_SIZE);
+    ASSERT_EQ(0, client.pendingOfEncodeBufferSize());
+    ASSERT_EQ(E_SUCCESS, server.writeToReadBuffer(records.data(), records.size()));
+
+    std::string received;
+    char span[1024];
+    std::size_t read_size = 0;
+    Err code;
+    while ((code = server.read(span, sizeof(span), &read_size)) == E_SUCCESS) {
+        received.append(span, span + read_size);
+    }
+    ASSERT_EQ(E_SSLWREAD, code);
+    ASSERT_EQ(PART1 + PART2 + LARGE, received);
+
+    // Partial record.
+    ASSERT_EQ(E_SUCCESS, server.write(PART1.data(), PART1.size()));
+    char partial[256];
+    auto const PARTIAL_SIZE = server.drain(partial, sizeof(partial));
+    ASSERT_LT(5U, PARTIAL_SIZE);
+    ASSERT_EQ(E_SUCCESS, client.writeToReadBuffer(partial, 5));
+    ASSERT_EQ(E_SSLWREAD, client.read(span, sizeof(span), &read_size));
+    ASSERT_EQ(E_SUCCESS, client.writeToReadBuffer(partial + 5, PARTIAL_SIZE - 5));
+    ASSERT_EQ(E_SUCCESS, client.read(span, sizeof(span), &read_size));
+    ASSERT_EQ(PART1, std::string(span, span + read_size));
+}
+
+TEST(TlsTest, SessionResumption)
+{
+    Tls server_context(Tls::create_memory_cert{});
+    ASSERT_TRUE(server_context.enableSessionCache());
+    Tls client_context;
+
+    TlsSession session;
+    ASSERT_FALSE(session.exists());
+
+    COMMENT("Full handshake") {
+        Tls server(Tls::reference_ssl_context{}, server_context);
+        Tls client(Tls::reference_ssl_context{}, client_context);
+        ASSERT_TRUE(runHandshake(client, server));
+        ASSERT_FALSE(client.isSessionReused());
+        session = client.getSession();
+        ASSERT_TRUE(session.exists());
+    }
+
+    COMMENT("Abbreviated handshake") {
+        Tls server(Tls::reference_ssl_context{}, server_context);
+        Tls client(Tls::reference_ssl_context{}, client_context);
+        ASSERT_TRUE(client.setSession(session));
+        ASSERT_TRUE(runHandshake(client, server));
+        ASSERT_TRUE(client.isSessionReused());
+        ASSERT_TRUE(server.isSessionReused());
+    }
+}
+
+TEST(TlsTest, BenchmarkOfHandshake)
+{
+    int const COUNT = 50;
+    Tls server_context(Tls::create_memory_cert{});
+    ASSERT_TRUE(server_context.enableSessionCache());
+    Tls client_context;
+    TlsSession session;
+
+    auto const FULL_BEGIN = std::chrono::steady_clock::now();
+    for (int i = 0; i < COUNT; ++i) {
+        Tls server(Tls::reference_ssl_context{}, server_context);
+        Tls client(Tls::reference_ssl_context{}, client_context);
+        ASSERT_TRUE(runHandshake(client, server));
+        session = client.getSession();
+    }
+    auto const FULL_DURATION = std::chrono::steady_clock::now() - FULL_BEGIN;
+
+    int reused = 0;
+    auto const RESUME_BEGIN = std::chrono::steady_clock::now();
+    for (int i = 0; i < COUNT; ++i) {
+        Tls server(Tls::reference_ssl_context{}, server_context);
+        Tls client(Tls::reference_ssl_context{}, client_context);
+        client.setSession(session);
+        ASSERT_TRUE(runHandshake(client, server));
+        if (client.isSessionReused()) {
+            ++reused;
+        }
+    }
+    auto const RESUME_DURATION = std::chrono::steady_clock::now() - RESUME_BEGIN;
+    ASSERT_EQ(COUNT, reused);
+
+    using namespace std::chrono;
+    std::cout << "Full handshake: " << duration_cast<microseconds>(FULL_DURATION).count() / COUNT << "us, "
+              << "Resumed handshake: " << duration_cast<microseconds>(RESUME_DURATION).count() / COUNT << "us"
+              << std::endl;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file   JsonDocumentTest.cpp
+ * @brief  JsonDocument class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/dom/json/JsonDocument.hpp>
+#include <libtbag/dom/json/JsonUtils.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace libtbag;
+using namespace libtbag::dom;
+using namespace libtbag::dom::json;
+
+TEST(JsonDocumentTest, Default)
+{
+    char const * const TEST_JSON = R"({
+    "name": "tbag",
+    "version": 3,
+    "ratio": -0.5,
+    "big": 18446744073709551615,
+    "enable": true,
+    "none": null,
+    "list": [1, [2, 3], {"x": 4}, "five"],
+    "esc\ta": "line\nnext"
+})";
+
+    JsonDocument doc;
+    ASSERT_EQ(E_SUCCESS, doc.parse(TEST_JSON));
+    auto const root = doc.root();
+    ASSERT_TRUE(root.isObject());
+    ASSERT_EQ(8, root.size());
+
+    ASSERT_STREQ("tbag", root["name"].asString().c_str());
+    ASSERT_TRUE(root["version"].isIntegral());
+    ASSERT_EQ(3, root["version"].asInt());
+    ASSERT_FALSE(root["ratio"].isIntegral());
+    ASSERT_DOUBLE_EQ(-0.5, root["ratio"].asDouble());
+    ASSERT_EQ(18446744073709551615ULL, root["big"].asUInt64());
+    ASSERT_TRUE(root["enable"].asBool());
+    ASSERT_TRUE(root["none"].isNull());
+    ASSERT_STREQ("line\nnext", root["esc\ta"].asString().c_str());
+    ASSERT_FALSE(root.has("unknown"));
+    ASSERT_FALSE(root["unknown"].valid());
+    ASSERT_EQ(7, root["unknown"].asInt(7));
+
+    auto const list = root["list"];
+    ASSERT_TRUE(list.isArray());
+    ASSERT_EQ(4, list.size());
+    ASSERT_EQ(1, list[0].asInt());
+    ASSERT_EQ(2, list[1].size());
+    ASSERT_EQ(3, list[1][1].asInt());
+    ASSERT_EQ(4, list[2]["x"].asInt());
+    ASSERT_STREQ("five", list[3].asString().c_str());
+    ASSERT_FALSE(list[4].valid());
+
+    std::vector<std::string> keys;
+    for (auto member = root.first(); member; member = member.next()) {
+        keys.push_back(member.key());
+    }
+    std::vector<std::string> const EXPECTED_KEYS = {
+        "name", "version", "ratio", "big", "enable", "none", "list", "esc\ta"
+    };
+    ASSERT_EQ(EXPECTED_KEYS, keys);
+
+    char const * raw = nullptr;
+    std::size_t raw_size = 0;
+    ASSERT_TRUE(root["ratio"].getRaw(&raw, &raw_size));
+    ASSERT_EQ(std::string("-0.5"), std::string(raw, raw_size));
+}
+
+TEST(JsonDocumentTest, Reuse)
+{
+    JsonDocument doc;
+    ASSERT_EQ(E_SUCCESS, doc.parse("[1, 2, 3]"));
+    ASSERT_EQ(4, doc.getNodeCount());
+    ASSERT_EQ(3, doc.root().size());
+
+    std::size_t error_offset = 0;
+    ASSERT_EQ(E_PARSING, doc.parse(std::string("[1, 2"), true, &error_offset));
+    ASSERT_TRUE(doc.empty());
+    ASSERT_FALSE(doc.root().valid());
+    ASSERT_EQ(5, error_offset);
+
+    std::string const TEXT = R"({"a": "b"})";
+    ASSERT_EQ(E_SUCCESS, doc.parse(TEXT, false));
+    ASSERT_EQ(TEXT.data(), doc.getText());
+    ASSERT_STREQ("b", doc.root()["a"].asString().c_str());
+}
+
+TEST(JsonDocumentTest, Scalar)
+{
+    JsonDocument doc;
+    ASSERT_EQ(E_SUCCESS, doc.parse(" \"text\" "));
+    ASSERT_TRUE(doc.root().isString());
+    ASSERT_STREQ("text", doc.root().asString().c_str());
+    ASSERT_EQ(0, doc.root().size());
+    ASSERT_FALSE(doc.root().first().valid());
+}
+
+TEST(JsonDocumentTest, Benchmark)
+{
+    std::stringstream ss;
+    ss << "{\"values\":[";
+    for (int i = 0; i < 200000; ++i) {
+        if (i != 0) {
+            ss << ',';
+        }
+        ss << "{\"id\":" << i << ",\"value\":" << (i * 0.25) << ",\"tag\":\"item" << i << "\"}";
+    }
+    ss << "],\"last\":1}";
+    auto const TEXT = ss.str();
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    Json::Value root;
+    ASSERT_TRUE(libtbag::dom::json::parse(TEXT, root));
+    auto const JSONCPP_LAST = root["last"].asInt();
+    auto const JSONCPP = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    JsonDocument doc;
+    ASSERT_EQ(E_SUCCESS, doc.parse(TEXT, false));
+    auto const DOCUMENT_LAST = doc.root()["last"].asInt();
+    auto const DOCUMENT = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(1, JSONCPP_LAST);
+    ASSERT_EQ(1, DOCUMENT_LAST);
+    std::cout << "jsoncpp: " << JSONCPP << "us, JsonDocument: " << DOCUMENT << "us" << std::endl;
+}
+
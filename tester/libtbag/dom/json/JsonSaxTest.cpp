@@ -0,0 +1,170 @@
+/**
+ * @file   JsonSaxTest.cpp
+ * @brief  JsonSax class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/dom/json/JsonSax.hpp>
+#include <libtbag/dom/json/JsonUtils.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::dom;
+using namespace libtbag::dom::json;
+
+struct JsonSaxTestRecorder : public JsonSaxHandler
+{
+    std::vector<std::string> events;
+    std::size_t stop_after = 0;
+
+    bool push(std::string const & event)
+    {
+        events.push_back(event);
+        return stop_after == 0 || events.size() < stop_after;
+    }
+
+    bool onNull() override
+    { return push("null"); }
+    bool onBool(bool value) override
+    { return push(value ? "true" : "false"); }
+    bool onInt64(int64_t value) override
+    { return push("i:" + std::to_string(value)); }
+    bool onUInt64(uint64_t value) override
+    { return push("u:" + std::to_string(value)); }
+    bool onDouble(double value) override
+    {
+        std::stringstream ss;
+        ss << "d:" << value;
+        return push(ss.str());
+    }
+    bool onString(char const * text, std::size_t size) override
+    { return push("s:" + std::string(text, size)); }
+    bool onKey(char const * text, std::size_t size) override
+    { return push("k:" + std::string(text, size)); }
+    bool onStartObject() override
+    { return push("{"); }
+    bool onEndObject(std::size_t member_count) override
+    { return push("}" + std::to_string(member_count)); }
+    bool onStartArray() override
+    { return push("["); }
+    bool onEndArray(std::size_t element_count) override
+    { return push("]" + std::to_string(element_count)); }
+};
+
+TEST(JsonSaxTest, Events)
+{
+    char const * const TEST_JSON = R"( {"a": [1, -2, 18446744073709551615, 1.5, true, false, null], "b": {}, "c": "x"} )";
+    JsonSaxTestRecorder recorder;
+    ASSERT_EQ(E_SUCCESS, parseJsonSax(TEST_JSON, recorder));
+
+    std::vector<std::string> const EXPECTED = {
+        "{", "k:a", "[", "i:1", "i:-2", "u:18446744073709551615", "d:1.5",
+        "true", "false", "null", "]7", "k:b", "{", "}0", "k:c", "s:x", "}3"
+    };
+    ASSERT_EQ(EXPECTED, recorder.events);
+}
+
+TEST(JsonSaxTest, Escape)
+{
+    char const * const TEST_JSON = R"(["a\"b\\c\/d\n", "\u0041\u00e9\uac00", "\ud83d\ude00"])";
+    JsonSaxTestRecorder recorder;
+    ASSERT_EQ(E_SUCCESS, parseJsonSax(TEST_JSON, recorder));
+    ASSERT_EQ(5, recorder.events.size());
+    ASSERT_STREQ("s:a\"b\\c/d\n", recorder.events[1].c_str());
+    ASSERT_STREQ("s:A\xC3\xA9\xEA\xB0\x80", recorder.events[2].c_str());
+    ASSERT_STREQ("s:\xF0\x9F\x98\x80", recorder.events[3].c_str());
+
+    // Lone surrogate.
+    JsonSaxTestRecorder broken;
+    ASSERT_EQ(E_PARSING, parseJsonSax(R"(["\ud83d"])", broken));
+}
+
+TEST(JsonSaxTest, Numbers)
+{
+    JsonSaxTestRecorder recorder;
+    ASSERT_EQ(E_SUCCESS, parseJsonSax("[0, -0.0, 1e3, 2.5E-3, 9223372036854775807, -9223372036854775808]", recorder));
+    std::vector<std::string> const EXPECTED = {
+        "[", "i:0", "d:-0", "d:1000", "d:0.0025", "i:9223372036854775807", "i:-9223372036854775808", "]6"
+    };
+    ASSERT_EQ(EXPECTED, recorder.events);
+}
+
+TEST(JsonSaxTest, Invalid)
+{
+    char const * const INVALID_TEXTS[] = {
+        "", " ", "{", "[1,]", "{\"a\":}", "{\"a\" 1}", "{1:2}", "[01]", "[1.]", "[.5]", "[-]",
+        "[1e]", "tru", "nul", "\"abc", "\"\\x\"", "\"\\u12\"", "\"a\nb\"", "[1] 2", "[1}", "{\"a\":1,}",
+    };
+    for (auto const * text : INVALID_TEXTS) {
+        JsonSaxTestRecorder recorder;
+        ASSERT_EQ(E_PARSING, parseJsonSax(text, recorder)) << "Text: " << text;
+    }
+
+    std::size_t error_offset = 0;
+    JsonSaxHandler handler;
+    ASSERT_EQ(E_PARSING, parseJsonSax("[1, 2, x]", handler, &error_offset));
+    ASSERT_EQ(7, error_offset);
+}
+
+TEST(JsonSaxTest, Depth)
+{
+    JsonSaxHandler handler;
+    std::string const NESTED = std::string(100, '[') + std::string(100, ']');
+    ASSERT_EQ(E_SUCCESS, parseJsonSax(NESTED.data(), NESTED.size(), handler, nullptr, 100));
+    ASSERT_EQ(E_OORANGE, parseJsonSax(NESTED.data(), NESTED.size(), handler, nullptr, 99));
+}
+
+TEST(JsonSaxTest, Cancel)
+{
+    JsonSaxTestRecorder recorder;
+    recorder.stop_after = 3;
+    ASSERT_EQ(E_ECANCELED, parseJsonSax("[1, 2, 3, 4]", recorder));
+    ASSERT_EQ(3, recorder.events.size());
+}
+
+struct JsonSaxTestSum : public JsonSaxHandler
+{
+    double sum = 0;
+
+    bool onInt64(int64_t value) override
+    { sum += value; return true; }
+    bool onDouble(double value) override
+    { sum += value; return true; }
+};
+
+TEST(JsonSaxTest, Benchmark)
+{
+    std::stringstream ss;
+    ss << "{\"name\":\"benchmark\",\"values\":[";
+    for (int i = 0; i < 200000; ++i) {
+        if (i != 0) {
+            ss << ',';
+        }
+        ss << "{\"id\":" << i << ",\"value\":" << (i * 0.25) << ",\"tag\":\"item" << i << "\"}";
+    }
+    ss << "]}";
+    auto const TEXT = ss.str();
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    Json::Value root;
+    ASSERT_TRUE(libtbag::dom::json::parse(TEXT, root));
+    auto const JSONCPP = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    JsonSaxTestSum handler;
+    ASSERT_EQ(E_SUCCESS, parseJsonSax(TEXT, handler));
+    auto const SAX = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_LT(0, handler.sum);
+    std::cout << "Text: " << TEXT.size() << " bytes, "
+              << "jsoncpp: " << JSONCPP << "us, SAX: " << SAX << "us" << std::endl;
+}
+
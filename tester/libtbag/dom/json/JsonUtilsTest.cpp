@@ -3,10 +3,13 @@
  * @brief  JsonUtils class tester.
  * @author zer0
  * @date   2019-06-16
+ * @date   2026-10-19 (Add the test of the mapped file)
  */
 
 #include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
 #include <libtbag/dom/json/JsonUtils.hpp>
+#include <libtbag/filesystem/File.hpp>
 
 using namespace libtbag;
 using namespace libtbag::dom;
@@ -156,3 +159,18 @@ TEST(JsonUtilsTest, getStringMap)
     ASSERT_STREQ("temp3", result["key3"].c_str());
 }
 
+TEST(JsonUtilsTest, ParseFile)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "test.json";
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::writeFile(PATH, std::string(R"({"key": [1, 2, 3]})")));
+
+    Json::Value json;
+    ASSERT_TRUE(parseFile(PATH, json));
+    ASSERT_EQ(3, json["key"].size());
+    ASSERT_EQ(3, json["key"][2].asInt());
+
+    std::string error;
+    ASSERT_FALSE(parseFile(tttDir_Get() / "not_exists.json", json, &error));
+    ASSERT_FALSE(error.empty());
+}
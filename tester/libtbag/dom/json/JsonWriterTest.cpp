@@ -0,0 +1,183 @@
+/**
+ * @file   JsonWriterTest.cpp
+ * @brief  JsonWriter class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the test of the comma-decimal locale)
+ * @date   2026-10-19 (Add the NonFinite test)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/dom/json/JsonWriter.hpp>
+#include <libtbag/dom/json/JsonDocument.hpp>
+#include <libtbag/dom/json/JsonUtils.hpp>
+
+#include <chrono>
+#include <clocale>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::dom;
+using namespace libtbag::dom::json;
+
+TEST(JsonWriterTest, Default)
+{
+    JsonWriter writer;
+    writer.startObject();
+    writer.key("name").value("tbag");
+    writer.key("list").startArray().value(1).value(-2).value(true).null().endArray();
+    writer.key("empty").startObject().endObject();
+    writer.key("min").value(std::numeric_limits<int64_t>::min());
+    writer.key("max").value(std::numeric_limits<uint64_t>::max());
+    writer.endObject();
+    ASSERT_EQ(0, writer.depth());
+    ASSERT_STREQ(R"({"name":"tbag","list":[1,-2,true,null],"empty":{},)"
+                 R"("min":-9223372036854775808,"max":18446744073709551615})",
+                 writer.str().c_str());
+
+    writer.clear();
+    std::vector<int> const VALUES = {1, 2, 3};
+    writer.array(VALUES.begin(), VALUES.end());
+    ASSERT_STREQ("[1,2,3]", writer.release().c_str());
+    ASSERT_EQ(0, writer.size());
+}
+
+TEST(JsonWriterTest, Escape)
+{
+    JsonWriter writer;
+    std::string const TEXT = std::string("a\"b\\c\n\t\x01/") + std::string(40, 'x') + "\x1f\xEA\xB0\x80";
+    writer.value(TEXT);
+    ASSERT_EQ("\"a\\\"b\\\\c\\n\\t\\u0001/" + std::string(40, 'x') + "\\u001f\xEA\xB0\x80\"", writer.str());
+
+    JsonDocument doc;
+    ASSERT_EQ(E_SUCCESS, doc.parse(writer.str()));
+    ASSERT_EQ(TEXT, doc.root().asString());
+}
+
+TEST(JsonWriterTest, Double)
+{
+    double const VALUES[] = {0.0, 1.0, -2.5, 0.1, 1.0/3.0, 1e300, -4.9e-324, 123456789.123456789};
+    for (auto const VALUE : VALUES) {
+        JsonWriter writer;
+        writer.value(VALUE);
+        ASSERT_EQ(VALUE, std::strtod(writer.data(), nullptr)) << writer.str();
+
+        JsonDocument doc;
+        ASSERT_EQ(E_SUCCESS, doc.parse(writer.str()));
+        ASSERT_FALSE(doc.root().isIntegral());
+        ASSERT_EQ(VALUE, doc.root().asDouble());
+    }
+
+    JsonWriter writer;
+    writer.startArray().value(0.1f).value(1.0).value(std::numeric_limits<double>::infinity()).endArray();
+    ASSERT_STREQ("[0.1,1.0,null]", writer.str().c_str());
+}
+
+TEST(JsonWriterTest, NonFinite)
+{
+    JsonWriter writer;
+    writer.setNonFinite();
+    writer.startArray();
+    writer.value(std::numeric_limits<double>::quiet_NaN());
+    writer.value(std::numeric_limits<float>::infinity());
+    writer.value(-std::numeric_limits<double>::infinity());
+    writer.endArray();
+    ASSERT_STREQ("[nan,inf,-inf]", writer.str().c_str());
+
+    // It is not the standard JSON.
+    JsonDocument doc;
+    ASSERT_EQ(E_PARSING, doc.parse(writer.str()));
+}
+
+TEST(JsonWriterTest, NumericLocale)
+{
+    char const * const COMMA_LOCALES[] = {
+        "de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR", "German_Germany.1252",
+    };
+
+    std::string const PREV_LOCALE = ::setlocale(LC_NUMERIC, nullptr);
+    char const * current = nullptr;
+    for (auto const * name : COMMA_LOCALES) {
+        current = ::setlocale(LC_NUMERIC, name);
+        if (current != nullptr) {
+            break;
+        }
+    }
+    if (current == nullptr) {
+        std::cout << "Not found the comma-decimal locale, skip the test." << std::endl;
+        return;
+    }
+
+    double const VALUES[] = {1.5, -0.25, 1.0/3.0, 3.14159265358979323846, 1e300, 6.02214076e23};
+    std::vector<double> results;
+    std::vector<std::string> texts;
+    for (auto const VALUE : VALUES) {
+        JsonWriter writer;
+        writer.value(VALUE);
+        texts.push_back(writer.str());
+
+        JsonDocument doc;
+        doc.parse(writer.str());
+        results.push_back(doc.root().asDouble());
+    }
+
+    JsonDocument doc;
+    doc.parse("[1.5, 2.25e2, 0.1234567890123456789012345]");
+    auto const ARRAY = doc.root();
+    auto const FIRST = ARRAY[0].asDouble();
+    auto const SECOND = ARRAY[1].asDouble();
+    auto const THIRD = ARRAY[2].asDouble();
+
+    ::setlocale(LC_NUMERIC, PREV_LOCALE.c_str());
+
+    ASSERT_STREQ("1.5", texts[0].c_str());
+    for (std::size_t i = 0; i < texts.size(); ++i) {
+        ASSERT_EQ(std::string::npos, texts[i].find(',')) << texts[i];
+        ASSERT_EQ(VALUES[i], results[i]) << texts[i];
+    }
+    ASSERT_EQ(1.5, FIRST);
+    ASSERT_EQ(225.0, SECOND);
+    ASSERT_EQ(0.1234567890123456789012345, THIRD);
+}
+
+TEST(JsonWriterTest, Benchmark)
+{
+    std::size_t const COUNT = 200000;
+    Json::Value root(Json::arrayValue);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        Json::Value item;
+        item["id"] = static_cast<Json::UInt64>(i);
+        item["value"] = i * 0.25;
+        item["tag"] = "item" + std::to_string(i);
+        root.append(item);
+    }
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    auto const JSONCPP_TEXT = libtbag::dom::json::writeFast(root);
+    auto const JSONCPP = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    JsonWriter writer;
+    writer.startArray();
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        writer.startObject();
+        writer.key("id").value(static_cast<uint64_t>(i));
+        writer.key("value").value(i * 0.25);
+        writer.key("tag").value("item" + std::to_string(i));
+        writer.endObject();
+    }
+    writer.endArray();
+    auto const WRITER = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_FALSE(JSONCPP_TEXT.empty());
+    JsonDocument doc;
+    ASSERT_EQ(E_SUCCESS, doc.parse(writer.str(), false));
+    ASSERT_EQ(COUNT, doc.root().size());
+    std::cout << "jsoncpp writeFast: " << JSONCPP << "us, JsonWriter: " << WRITER << "us" << std::endl;
+}
+
@@ -0,0 +1,160 @@
+/**
+ * @file   XmlReaderTest.cpp
+ * @brief  XmlReader class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/dom/xml/XmlReader.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::dom;
+using namespace libtbag::dom::xml;
+
+using Token = XmlReader::Token;
+
+TEST(XmlReaderTest, Default)
+{
+    char const * const TEST_XML = R"(
+<?xml version="1.0" encoding="UTF-8"?>
+<!DOCTYPE root [ <!ELEMENT root ANY> ]>
+<!-- comment -->
+<root version='1.2' name="a &amp; b">
+  <item id="10" ratio="0.5" enable="true"/>
+  <text>Hello <b>World</b> &lt;tbag&gt;</text>
+  <![CDATA[<raw & data>]]>
+</root>
+)";
+
+    XmlReader reader(TEST_XML, strlen(TEST_XML));
+    ASSERT_EQ(Token::START_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "root");
+    ASSERT_EQ(1, reader.depth());
+    ASSERT_EQ(2, reader.attributes().size());
+
+    std::string version;
+    ASSERT_EQ(E_SUCCESS, reader.optAttr("version", version));
+    ASSERT_STREQ("1.2", version.c_str());
+    std::string name;
+    ASSERT_EQ(E_SUCCESS, reader.optAttr("name", name));
+    ASSERT_STREQ("a & b", name.c_str());
+    std::string unknown;
+    ASSERT_EQ(E_QUERY, reader.optAttr("unknown", unknown, "default"));
+    ASSERT_STREQ("default", unknown.c_str());
+
+    ASSERT_EQ(Token::START_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "item");
+    ASSERT_TRUE(reader.isEmptyElement());
+    ASSERT_EQ(2, reader.depth());
+
+    int id = 0;
+    double ratio = 0;
+    bool enable = false;
+    int invalid = 0;
+    ASSERT_EQ(E_SUCCESS, reader.optAttr("id", id));
+    ASSERT_EQ(E_SUCCESS, reader.optAttr("ratio", ratio));
+    ASSERT_EQ(E_SUCCESS, reader.optAttr("enable", enable));
+    ASSERT_EQ(E_QUERY, reader.optAttr("enable", invalid, 7));
+    ASSERT_EQ(10, id);
+    ASSERT_DOUBLE_EQ(0.5, ratio);
+    ASSERT_TRUE(enable);
+    ASSERT_EQ(7, invalid);
+
+    ASSERT_EQ(Token::END_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "item");
+    ASSERT_EQ(1, reader.depth());
+
+    ASSERT_EQ(Token::START_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "text");
+    std::string text;
+    ASSERT_EQ(E_SUCCESS, reader.readElementText(text));
+    ASSERT_STREQ("Hello  <tbag>", text.c_str());
+    ASSERT_EQ(Token::END_ELEMENT, reader.token());
+    ASSERT_TRUE(reader.name() == "text");
+
+    ASSERT_EQ(Token::TEXT, reader.next());
+    ASSERT_FALSE(reader.isTextEscaped());
+    ASSERT_EQ(std::string("<raw & data>"), reader.text().toString());
+
+    ASSERT_EQ(Token::END_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "root");
+    ASSERT_EQ(0, reader.depth());
+    ASSERT_EQ(Token::END_DOCUMENT, reader.next());
+    ASSERT_EQ(Token::END_DOCUMENT, reader.next());
+}
+
+TEST(XmlReaderTest, SkipElement)
+{
+    std::string const TEST_XML = R"(<a><b x="1"><c/><d>text</d></b><e/></a>)";
+    XmlReader reader(TEST_XML);
+    ASSERT_EQ(Token::START_ELEMENT, reader.next());
+    ASSERT_EQ(Token::START_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "b");
+
+    XmlReader::View source;
+    ASSERT_EQ(E_SUCCESS, reader.skipElement(&source));
+    ASSERT_EQ(std::string(R"(<b x="1"><c/><d>text</d></b>)"), source.toString());
+    ASSERT_EQ(Token::END_ELEMENT, reader.token());
+    ASSERT_EQ(1, reader.depth());
+
+    ASSERT_EQ(Token::START_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "e");
+    ASSERT_EQ(E_SUCCESS, reader.skipElement(&source));
+    ASSERT_EQ(std::string("<e/>"), source.toString());
+    ASSERT_EQ(E_ILLSTATE, reader.skipElement());
+
+    ASSERT_EQ(Token::END_ELEMENT, reader.next());
+    ASSERT_EQ(Token::END_DOCUMENT, reader.next());
+}
+
+TEST(XmlReaderTest, DecodeText)
+{
+    std::string output;
+    ASSERT_TRUE(XmlReader::decodeText(XmlReader::View("&quot;&apos;&#65;&#x42;&#xAC00;", 31), output));
+    ASSERT_STREQ("\"'AB\xEA\xB0\x80", output.c_str());
+
+    output.clear();
+    ASSERT_FALSE(XmlReader::decodeText(XmlReader::View("&unknown;", 9), output));
+    output.clear();
+    ASSERT_FALSE(XmlReader::decodeText(XmlReader::View("&amp", 4), output));
+}
+
+TEST(XmlReaderTest, Reuse)
+{
+    XmlReader reader;
+    std::string const XML1 = "<a><b/><c/></a>";
+    std::string const XML2 = "<x>y</x>";
+
+    reader.reset(XML1.data(), XML1.size());
+    while (reader.next() != Token::END_DOCUMENT) {
+        ASSERT_NE(Token::FAILURE, reader.token());
+    }
+
+    reader.reset(XML2.data(), XML2.size());
+    ASSERT_EQ(Token::START_ELEMENT, reader.next());
+    ASSERT_TRUE(reader.name() == "x");
+    ASSERT_EQ(Token::TEXT, reader.next());
+    ASSERT_TRUE(reader.text() == "y");
+    ASSERT_EQ(Token::END_ELEMENT, reader.next());
+    ASSERT_EQ(Token::END_DOCUMENT, reader.next());
+}
+
+TEST(XmlReaderTest, Invalid)
+{
+    char const * const INVALID_XMLS[] = {
+        "", "   ", "text", "<a>", "<a></b>", "<a/><b/>", "<a/>text", "<a x=1/>", "<a x=\"1/>",
+        "<a x=\"1\"y=\"2\"/>", "<a><!-- comment</a>", "<a><![CDATA[data</a>", "</a>", "<>",
+    };
+    for (auto const * xml : INVALID_XMLS) {
+        XmlReader reader(xml, strlen(xml));
+        while (reader.next() != Token::FAILURE) {
+            ASSERT_NE(Token::END_DOCUMENT, reader.token()) << "XML: " << xml;
+        }
+        ASSERT_EQ(E_PARSING, reader.getError()) << "XML: " << xml;
+    }
+}
+
@@ -3,10 +3,15 @@
  * @brief  XmlUtils class tester.
  * @author zer0
  * @date   2019-10-31
+ * @date   2026-10-19 (Add the test of the mapped file)
  */
 
 #include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
 #include <libtbag/dom/xml/XmlUtils.hpp>
+#include <libtbag/filesystem/File.hpp>
+
+#include <cstring>
 
 using namespace libtbag;
 using namespace libtbag::dom;
@@ -51,3 +56,22 @@ TEST(XmlUtilsTest, WriteElementToXmlText)
     ASSERT_STREQ("sub2", libtbag::dom::xml::name(*doc2_sub2->ToElement()).c_str());
 }
 
+TEST(XmlUtilsTest, ReadDocumentFromXmlFile)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "test.xml";
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::writeFile(PATH, std::string(TEST_XML)));
+
+    Document doc;
+    ASSERT_EQ(E_SUCCESS, readDocumentFromXmlFile(doc, PATH));
+    auto const * sub2 = doc.FirstChildElement("root")->FirstChildElement("sub1")->FirstChildElement("sub2");
+    ASSERT_NE(nullptr, sub2);
+    ASSERT_STREQ("text", sub2->GetText());
+
+    // The buffer does not need the null terminator.
+    Document partial;
+    ASSERT_EQ(E_SUCCESS, readDocumentFromXmlText(partial, "<a>b</a><c>", 8));
+    ASSERT_STREQ("b", partial.FirstChildElement("a")->GetText());
+
+    ASSERT_NE(E_SUCCESS, readDocumentFromXmlFile(doc, tttDir_Get() / "not_exists.xml"));
+}
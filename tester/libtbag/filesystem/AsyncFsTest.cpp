@@ -0,0 +1,350 @@
+/**
+ * @file   AsyncFsTest.cpp
+ * @brief  AsyncFs class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Test the max_in_flight of the io_uring)
+ */
+
+#include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
+#include <libtbag/filesystem/AsyncFs.hpp>
+#include <libtbag/filesystem/File.hpp>
+#include <libtbag/filesystem/Path.hpp>
+#include <libtbag/filesystem/details/FsCommon.hpp>
+#include <libtbag/uvpp/Loop.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::filesystem;
+
+static std::string createAsyncContent(std::size_t size)
+{
+    std::string result(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<char>('a' + (i % 26));
+    }
+    return result;
+}
+
+static void runReadWrite(AsyncFs::Backend backend, std::string const & PATH)
+{
+    std::string const CONTENT = createAsyncContent(10000);
+
+    uvpp::Loop loop;
+    AsyncFs::Params params;
+    params.backend = backend;
+    AsyncFs fs(loop, params);
+
+    AsyncFs::ufile file = 0;
+    Err open_code = E_UNKNOWN;
+    auto const FLAGS = File::Flags().clear().creat().trunc().rdwr().flags;
+    ASSERT_EQ(E_SUCCESS, fs.open(PATH, FLAGS, 0644, [&](Err code, int64_t result){
+        open_code = code;
+        file = static_cast<AsyncFs::ufile>(result);
+    }));
+    ASSERT_EQ(1u, fs.getInFlight());
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(E_SUCCESS, open_code);
+    ASSERT_LT(0, file);
+    ASSERT_EQ(0u, fs.getInFlight());
+
+    // Vectored write.
+    std::vector<AsyncFs::binf> infos = {
+            AsyncFs::binf(const_cast<char*>(CONTENT.data()), 4000),
+            AsyncFs::binf(const_cast<char*>(CONTENT.data() + 4000), CONTENT.size() - 4000),
+    };
+    int64_t written = 0;
+    ASSERT_EQ(E_SUCCESS, fs.write(file, infos.data(), infos.size(), 0, [&](Err code, int64_t result){
+        ASSERT_EQ(E_SUCCESS, code);
+        written = result;
+        ASSERT_EQ(E_SUCCESS, fs.fdatasync(file, [&](Err code, int64_t){
+            ASSERT_EQ(E_SUCCESS, code);
+        }));
+    }));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(static_cast<int64_t>(CONTENT.size()), written);
+
+    // Vectored read.
+    std::string head(100, '\0');
+    std::string tail(200, '\0');
+    std::vector<AsyncFs::binf> read_infos = {
+            AsyncFs::binf(&head[0], head.size()),
+            AsyncFs::binf(&tail[0], tail.size()),
+    };
+    int64_t read_size = 0;
+    ASSERT_EQ(E_SUCCESS, fs.read(file, read_infos.data(), read_infos.size(), 5000, [&](Err code, int64_t result){
+        ASSERT_EQ(E_SUCCESS, code);
+        read_size = result;
+    }));
+
+    AsyncFs::FileState state = {0};
+    ASSERT_EQ(E_SUCCESS, fs.fstat(file, [&](Err code, AsyncFs::FileState const & s){
+        ASSERT_EQ(E_SUCCESS, code);
+        state = s;
+    }));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(300, read_size);
+    ASSERT_EQ(CONTENT.substr(5000, 100), head);
+    ASSERT_EQ(CONTENT.substr(5100, 200), tail);
+    ASSERT_EQ(CONTENT.size(), state.size);
+
+    Err close_code = E_UNKNOWN;
+    ASSERT_EQ(E_SUCCESS, fs.fsync(file, [&](Err code, int64_t){
+        ASSERT_EQ(E_SUCCESS, code);
+        ASSERT_EQ(E_SUCCESS, fs.close(file, [&](Err code, int64_t){
+            close_code = code;
+        }));
+    }));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(E_SUCCESS, close_code);
+
+    std::string result;
+    ASSERT_EQ(E_SUCCESS, readFile(PATH, result));
+    ASSERT_EQ(CONTENT, result);
+}
+
+TEST(AsyncFsTest, ThreadPool)
+{
+    AsyncFs::Params params;
+    uvpp::Loop loop;
+    AsyncFs fs(loop, params);
+    ASSERT_EQ(AsyncFs::Backend::THREAD_POOL, fs.getBackend());
+    ASSERT_EQ(0u, fs.getBufferCount());
+    ASSERT_EQ(nullptr, fs.getBuffer(0));
+    ASSERT_EQ(E_OORANGE, fs.readBuffer(0, 0, 1, 0, nullptr));
+
+    tttDir_Automatic();
+    runReadWrite(AsyncFs::Backend::THREAD_POOL, tttDir_Get() / "read_write");
+}
+
+TEST(AsyncFsTest, IoUring)
+{
+    tttDir_Automatic();
+    runReadWrite(AsyncFs::Backend::IO_URING, tttDir_Get() / "read_write");
+}
+
+TEST(AsyncFsTest, MaxInFlight)
+{
+    AsyncFs::Params params;
+    params.backend = AsyncFs::Backend::IO_URING;
+    params.max_in_flight = 1000000;
+    uvpp::Loop loop;
+    AsyncFs fs(loop, params);
+    if (fs.getBackend() == AsyncFs::Backend::IO_URING) {
+        // Clamped to the completion queue of the ring.
+        ASSERT_LT(fs.getMaxInFlight(), params.max_in_flight);
+    } else {
+        ASSERT_EQ(params.max_in_flight, fs.getMaxInFlight());
+    }
+}
+
+TEST(AsyncFsTest, StateAndScan)
+{
+    tttDir_Automatic();
+    auto const DIR = tttDir_Get();
+    ASSERT_EQ(E_SUCCESS, writeFile(DIR / "a", std::string("12345")));
+    ASSERT_EQ(E_SUCCESS, writeFile(DIR / "b", std::string("1")));
+
+    uvpp::Loop loop;
+    AsyncFs fs(loop);
+
+    AsyncFs::FileState state = {0};
+    ASSERT_EQ(E_SUCCESS, fs.stat(DIR / "a", [&](Err code, AsyncFs::FileState const & s){
+        ASSERT_EQ(E_SUCCESS, code);
+        state = s;
+    }));
+    Err not_exists_code = E_SUCCESS;
+    ASSERT_EQ(E_SUCCESS, fs.stat(DIR / "not_exists", [&](Err code, AsyncFs::FileState const &){
+        not_exists_code = code;
+    }));
+    std::vector<std::string> names;
+    ASSERT_EQ(E_SUCCESS, fs.scandir(DIR, [&](Err code, std::vector<std::string> const & n){
+        ASSERT_EQ(E_SUCCESS, code);
+        names = n;
+    }));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+
+    ASSERT_EQ(5u, state.size);
+    ASSERT_EQ(E_ENOENT, not_exists_code);
+    std::sort(names.begin(), names.end());
+    ASSERT_EQ(2u, names.size());
+    ASSERT_EQ(std::string("a"), names[0]);
+    ASSERT_EQ(std::string("b"), names[1]);
+}
+
+TEST(AsyncFsTest, BoundedQueue)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "bounded";
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, createAsyncContent(100)));
+
+    uvpp::Loop loop;
+    AsyncFs::Params params;
+    params.max_in_flight = 2;
+    params.max_pending = 3;
+    AsyncFs fs(loop, params);
+
+    std::vector<Err> codes;
+    auto const CALLBACK = [&](Err code, AsyncFs::FileState const &){
+        codes.push_back(code);
+    };
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(E_SUCCESS, fs.stat(PATH, CALLBACK));
+    }
+    ASSERT_EQ(2u, fs.getInFlight());
+    ASSERT_EQ(3u, fs.getPending());
+    ASSERT_EQ(E_EBUSY, fs.stat(PATH, CALLBACK));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(5u, codes.size());
+    ASSERT_EQ(5, std::count(codes.begin(), codes.end(), E_SUCCESS));
+
+    codes.clear();
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(E_SUCCESS, fs.stat(PATH, CALLBACK));
+    }
+    ASSERT_EQ(3u, fs.cancelPending());
+    ASSERT_EQ(3, std::count(codes.begin(), codes.end(), E_ECANCELED));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(5u, codes.size());
+    ASSERT_EQ(0u, fs.getPending());
+}
+
+TEST(AsyncFsTest, RegisteredBuffer)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "registered";
+    auto const CONTENT = createAsyncContent(8192);
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, CONTENT));
+
+    for (auto backend : {AsyncFs::Backend::THREAD_POOL, AsyncFs::Backend::IO_URING}) {
+        uvpp::Loop loop;
+        AsyncFs::Params params;
+        params.backend = backend;
+        params.buffer_count = 2;
+        params.buffer_size = 4096;
+        AsyncFs fs(loop, params);
+        ASSERT_EQ(2u, fs.getBufferCount());
+        ASSERT_EQ(4096u, fs.getBufferSize());
+        ASSERT_NE(nullptr, fs.getBuffer(1));
+        ASSERT_EQ(nullptr, fs.getBuffer(2));
+        ASSERT_EQ(E_OORANGE, fs.readBuffer(0, 2, 4096, 0, nullptr));
+        ASSERT_EQ(E_OORANGE, fs.readBuffer(0, 0, 4097, 0, nullptr));
+
+        auto const FILE = details::open(PATH, File::Flags().clear().rdwr().flags, 0);
+        ASSERT_LT(0, FILE);
+
+        int64_t read_sizes[2] = {0,};
+        for (std::size_t i = 0; i < 2; ++i) {
+            ASSERT_EQ(E_SUCCESS, fs.readBuffer(FILE, i, 4096, i * 4096, [&, i](Err code, int64_t result){
+                ASSERT_EQ(E_SUCCESS, code);
+                read_sizes[i] = result;
+            }));
+        }
+        ASSERT_EQ(E_SUCCESS, loop.run());
+        ASSERT_EQ(4096, read_sizes[0]);
+        ASSERT_EQ(4096, read_sizes[1]);
+        ASSERT_EQ(CONTENT.substr(0, 4096), std::string(fs.getBuffer(0), 4096));
+        ASSERT_EQ(CONTENT.substr(4096, 4096), std::string(fs.getBuffer(1), 4096));
+
+        // Swap the halves.
+        for (std::size_t i = 0; i < 2; ++i) {
+            ASSERT_EQ(E_SUCCESS, fs.writeBuffer(FILE, i, 4096, (1 - i) * 4096, [&](Err code, int64_t result){
+                ASSERT_EQ(E_SUCCESS, code);
+                ASSERT_EQ(4096, result);
+            }));
+        }
+        ASSERT_EQ(E_SUCCESS, loop.run());
+        ASSERT_TRUE(details::close(FILE));
+
+        std::string result;
+        ASSERT_EQ(E_SUCCESS, readFile(PATH, result));
+        ASSERT_EQ(CONTENT.substr(4096, 4096) + CONTENT.substr(0, 4096), result);
+        ASSERT_EQ(E_SUCCESS, writeFile(PATH, CONTENT));
+    }
+}
+
+TEST(AsyncFsTest, BenchmarkOfRandomRead)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "benchmark";
+    std::size_t const FILE_SIZE = 64 * 1024 * 1024;
+    std::size_t const BLOCK_SIZE = 4096;
+    std::size_t const QUEUE_DEPTH = 64;
+    std::size_t const READ_COUNT = 20000;
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, createAsyncContent(FILE_SIZE)));
+
+    std::mt19937 engine(20261019);
+    std::uniform_int_distribution<std::size_t> block(0, FILE_SIZE / BLOCK_SIZE - 1);
+    std::vector<int64_t> offsets(READ_COUNT);
+    for (auto & offset : offsets) {
+        offset = static_cast<int64_t>(block(engine) * BLOCK_SIZE);
+    }
+
+    auto const FILE = details::open(PATH, File::Flags().clear().rdonly().flags, 0);
+    ASSERT_LT(0, FILE);
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    std::vector<char> buffer(BLOCK_SIZE);
+    for (auto offset : offsets) {
+        ASSERT_EQ(static_cast<int>(BLOCK_SIZE), details::read(FILE, buffer.data(), BLOCK_SIZE, offset));
+    }
+    auto const SYNC = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    auto const run = [&](AsyncFs::Backend backend, AsyncFs::Backend * used) -> long long {
+        uvpp::Loop loop;
+        AsyncFs::Params params;
+        params.backend = backend;
+        params.max_in_flight = QUEUE_DEPTH;
+        params.buffer_count = QUEUE_DEPTH;
+        params.buffer_size = BLOCK_SIZE;
+        AsyncFs fs(loop, params);
+        *used = fs.getBackend();
+
+        std::size_t next = 0;
+        std::size_t completed = 0;
+        std::function<void(std::size_t)> submit;
+        submit = [&](std::size_t slot){
+            if (next >= READ_COUNT) {
+                return;
+            }
+            auto const OFFSET = offsets[next++];
+            fs.readBuffer(FILE, slot, BLOCK_SIZE, OFFSET, [&, slot](Err code, int64_t result){
+                if (code == E_SUCCESS && result == static_cast<int64_t>(BLOCK_SIZE)) {
+                    ++completed;
+                }
+                submit(slot);
+            });
+        };
+
+        auto const BEGIN = system_clock::now();
+        for (std::size_t slot = 0; slot < QUEUE_DEPTH; ++slot) {
+            submit(slot);
+        }
+        loop.run();
+        auto const DURATION = duration_cast<microseconds>(system_clock::now() - BEGIN).count();
+        return (completed == READ_COUNT ? DURATION : -1);
+    };
+
+    AsyncFs::Backend pool_backend;
+    AsyncFs::Backend ring_backend;
+    auto const POOL = run(AsyncFs::Backend::THREAD_POOL, &pool_backend);
+    auto const RING = run(AsyncFs::Backend::IO_URING, &ring_backend);
+    ASSERT_TRUE(details::close(FILE));
+    ASSERT_LE(0, POOL);
+    ASSERT_LE(0, RING);
+
+    std::cout << "Random 4KiB reads (" << READ_COUNT << ", QD" << QUEUE_DEPTH << ") - "
+              << "Sync: " << SYNC << "us, "
+              << "ThreadPool: " << POOL << "us, "
+              << (ring_backend == AsyncFs::Backend::IO_URING ? "io_uring: " : "io_uring(unavailable): ")
+              << RING << "us" << std::endl;
+}
+
@@ -10,6 +10,9 @@
 #include <libtbag/filesystem/File.hpp>
 #include <libtbag/filesystem/Path.hpp>
 
+#include <chrono>
+#include <iostream>
+
 using namespace libtbag;
 using namespace libtbag::filesystem;
 
@@ -28,3 +31,135 @@ TEST(FileTest, Default)
     ASSERT_EQ(WRITE_CONTENT, read_buffer);
 }
 
+
+static std::string createCopyContent(std::size_t size, char seed)
+{
+    std::string result(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<char>(seed + (i % 13));
+    }
+    return result;
+}
+
+TEST(FileTest, CopyFile)
+{
+    tttDir_Automatic();
+    auto const SOURCE = tttDir_Get() / "source";
+    auto const DESTINATION = tttDir_Get() / "destination";
+    auto const CONTENT = createCopyContent(3 * 1024 * 1024 + 7, 'a');
+    ASSERT_EQ(E_SUCCESS, writeFile(SOURCE, CONTENT));
+
+    // The existing content must be truncated.
+    ASSERT_EQ(E_SUCCESS, writeFile(DESTINATION, createCopyContent(5 * 1024 * 1024, 'A')));
+
+    std::vector<CopyProgress> progresses;
+    ASSERT_EQ(E_SUCCESS, copyFile(SOURCE, DESTINATION, [&](CopyProgress const & progress){
+        progresses.push_back(progress);
+    }));
+
+    std::string result;
+    ASSERT_EQ(E_SUCCESS, readFile(DESTINATION, result));
+    ASSERT_EQ(CONTENT, result);
+
+    ASSERT_FALSE(progresses.empty());
+    auto const & LAST = progresses.back();
+    ASSERT_EQ(std::string(SOURCE), LAST.path);
+    ASSERT_EQ(CONTENT.size(), LAST.file_copied);
+    ASSERT_EQ(CONTENT.size(), LAST.file_size);
+    ASSERT_EQ(CONTENT.size(), LAST.total_copied);
+    ASSERT_EQ(CONTENT.size(), LAST.total_size);
+    ASSERT_EQ(1u, LAST.copied_files);
+    ASSERT_EQ(1u, LAST.total_files);
+
+    // Copy to itself.
+    ASSERT_EQ(E_SUCCESS, copyFile(SOURCE, SOURCE));
+    ASSERT_EQ(E_SUCCESS, readFile(SOURCE, result));
+    ASSERT_EQ(CONTENT, result);
+
+    auto const EMPTY_SOURCE = tttDir_Get() / "empty_source";
+    auto const EMPTY_DESTINATION = tttDir_Get() / "empty_destination";
+    ASSERT_EQ(E_SUCCESS, writeFile(EMPTY_SOURCE, std::string()));
+    progresses.clear();
+    ASSERT_EQ(E_SUCCESS, copyFile(EMPTY_SOURCE, EMPTY_DESTINATION, [&](CopyProgress const & progress){
+        progresses.push_back(progress);
+    }));
+    ASSERT_TRUE(EMPTY_DESTINATION.isRegularFile());
+    ASSERT_EQ(0u, EMPTY_DESTINATION.getState().size);
+    ASSERT_EQ(1u, progresses.size());
+    ASSERT_EQ(1u, progresses.back().copied_files);
+
+    ASSERT_NE(E_SUCCESS, copyFile(tttDir_Get() / "not_exists", DESTINATION));
+}
+
+TEST(FileTest, CopyTree)
+{
+    tttDir_Automatic();
+    auto const SOURCE = tttDir_Get() / "source";
+    auto const DESTINATION = tttDir_Get() / "destination";
+
+    std::vector<std::string> const NAMES = {"a", "b", "x/c", "x/y/d", "x/y/z/e", "w/f"};
+    ASSERT_TRUE((SOURCE / "x" / "y" / "z").createDir());
+    ASSERT_TRUE((SOURCE / "x" / "empty").createDir());
+    ASSERT_TRUE((SOURCE / "w").createDir());
+
+    uint64_t total_size = 0;
+    for (std::size_t i = 0; i < NAMES.size(); ++i) {
+        auto const CONTENT = createCopyContent(i * 512 * 1024 + i, static_cast<char>('a' + i));
+        ASSERT_EQ(E_SUCCESS, writeFile(SOURCE / NAMES[i], CONTENT));
+        total_size += CONTENT.size();
+    }
+
+    std::vector<CopyProgress> progresses;
+    ASSERT_EQ(E_SUCCESS, copyTree(SOURCE, DESTINATION, 3, [&](CopyProgress const & progress){
+        progresses.push_back(progress);
+    }));
+
+    for (auto const & name : NAMES) {
+        std::string source;
+        std::string destination;
+        ASSERT_EQ(E_SUCCESS, readFile(SOURCE / name, source));
+        ASSERT_EQ(E_SUCCESS, readFile(DESTINATION / name, destination));
+        ASSERT_EQ(source, destination);
+    }
+    ASSERT_TRUE((DESTINATION / "x" / "empty").isDirectory());
+
+    ASSERT_FALSE(progresses.empty());
+    uint64_t last_copied = 0;
+    for (auto const & progress : progresses) {
+        ASSERT_LE(last_copied, progress.total_copied);
+        last_copied = progress.total_copied;
+        ASSERT_EQ(total_size, progress.total_size);
+        ASSERT_EQ(NAMES.size(), progress.total_files);
+    }
+    ASSERT_EQ(total_size, progresses.back().total_copied);
+    ASSERT_EQ(NAMES.size(), progresses.back().copied_files);
+
+    ASSERT_EQ(E_ILLARGS, copyTree(tttDir_Get() / "not_exists", DESTINATION));
+}
+
+TEST(FileTest, BenchmarkOfCopyFile)
+{
+    tttDir_Automatic();
+    auto const SOURCE = tttDir_Get() / "source";
+    auto const DESTINATION = tttDir_Get() / "destination";
+    ASSERT_EQ(E_SUCCESS, writeFile(SOURCE, createCopyContent(64 * 1024 * 1024, 'a')));
+    int const LOOP = 5;
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    for (int i = 0; i < LOOP; ++i) {
+        util::Buffer buffer;
+        ASSERT_EQ(E_SUCCESS, readFile(SOURCE, buffer));
+        ASSERT_EQ(E_SUCCESS, writeFile(DESTINATION, buffer));
+    }
+    auto const BUFFER = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    for (int i = 0; i < LOOP; ++i) {
+        ASSERT_EQ(E_SUCCESS, copyFile(SOURCE, DESTINATION));
+    }
+    auto const KERNEL = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(SOURCE.getState().size, DESTINATION.getState().size);
+    std::cout << "Buffer copy: " << BUFFER << "us, copyFile(): " << KERNEL << "us" << std::endl;
+}
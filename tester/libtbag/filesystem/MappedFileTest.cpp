@@ -0,0 +1,185 @@
+/**
+ * @file   MappedFileTest.cpp
+ * @brief  MappedFile class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <tester/DemoAsset.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
+#include <libtbag/filesystem/File.hpp>
+#include <libtbag/filesystem/Path.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+
+using namespace libtbag;
+using namespace libtbag::filesystem;
+
+static std::string createContent(std::size_t size)
+{
+    std::string result(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<char>('a' + (i % 26));
+    }
+    return result;
+}
+
+TEST(MappedFileTest, Default)
+{
+    MappedFile file;
+    ASSERT_FALSE(file.isOpen());
+    ASSERT_FALSE(file.isMapped());
+    ASSERT_TRUE(file.empty());
+    ASSERT_EQ(E_ILLSTATE, file.map(0));
+    ASSERT_EQ(E_SUCCESS, file.flush());
+    ASSERT_NE(E_SUCCESS, file.open("__not_exists_file__"));
+    ASSERT_FALSE(file.isOpen());
+}
+
+TEST(MappedFileTest, ReadOnly)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "read_only";
+    auto const CONTENT = createContent(100000);
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, CONTENT));
+
+    MappedFile file;
+    ASSERT_EQ(E_SUCCESS, readFile(PATH, file));
+    ASSERT_TRUE(file.isOpen());
+    ASSERT_TRUE(file.isMapped());
+    ASSERT_EQ(MappedFile::Mode::READ_ONLY, file.mode());
+    ASSERT_EQ(CONTENT.size(), file.getFileSize());
+    ASSERT_EQ(CONTENT.size(), file.size());
+    ASSERT_EQ(0u, file.offset());
+    ASSERT_EQ(CONTENT, std::string(file.begin(), file.end()));
+
+    auto const SPAN = static_cast<MappedFile const &>(file).span();
+    ASSERT_EQ(file.data(), SPAN.buffer);
+    ASSERT_EQ(file.size(), SPAN.size);
+
+    ASSERT_EQ(E_SUCCESS, file.advise(MappedFile::Advice::SEQUENTIAL));
+    ASSERT_EQ(E_SUCCESS, file.advise(MappedFile::Advice::WILL_NEED, 5000, 1000));
+    ASSERT_EQ(E_SUCCESS, file.advise(MappedFile::Advice::RANDOM));
+    ASSERT_EQ(E_OORANGE, file.advise(MappedFile::Advice::NORMAL, 99999, 2));
+
+    MappedFile moved = std::move(file);
+    ASSERT_FALSE(file.isOpen());
+    ASSERT_TRUE(moved.isMapped());
+    ASSERT_EQ(CONTENT, std::string(moved.begin(), moved.end()));
+}
+
+TEST(MappedFileTest, Range)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "range";
+    auto const CONTENT = createContent(3 * 65536 + 123);
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, CONTENT));
+
+    // The unaligned offset.
+    MappedFile file;
+    ASSERT_EQ(E_SUCCESS, file.open(PATH, MappedFile::Mode::READ_ONLY, 70001, 1000));
+    ASSERT_EQ(70001u, file.offset());
+    ASSERT_EQ(1000u, file.size());
+    ASSERT_EQ(CONTENT.substr(70001, 1000), std::string(file.begin(), file.end()));
+
+    // Walk the file by the windows.
+    std::size_t const WINDOW = 50000;
+    std::string walked;
+    for (uint64_t offset = 0; offset < file.getFileSize(); offset += WINDOW) {
+        auto const SIZE = std::min<uint64_t>(WINDOW, file.getFileSize() - offset);
+        ASSERT_EQ(E_SUCCESS, file.map(offset, static_cast<std::size_t>(SIZE)));
+        walked.append(file.begin(), file.end());
+    }
+    ASSERT_EQ(CONTENT, walked);
+
+    ASSERT_EQ(E_SUCCESS, file.map(CONTENT.size() - 10));
+    ASSERT_EQ(CONTENT.substr(CONTENT.size() - 10), std::string(file.begin(), file.end()));
+
+    ASSERT_EQ(E_SUCCESS, file.map(CONTENT.size()));
+    ASSERT_TRUE(file.empty());
+    ASSERT_FALSE(file.isMapped());
+
+    ASSERT_EQ(E_OORANGE, file.map(CONTENT.size() + 1));
+    ASSERT_EQ(E_OORANGE, file.map(10, CONTENT.size()));
+}
+
+TEST(MappedFileTest, Empty)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "empty";
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, std::string()));
+
+    MappedFile file;
+    ASSERT_EQ(E_SUCCESS, file.open(PATH));
+    ASSERT_TRUE(file.isOpen());
+    ASSERT_FALSE(file.isMapped());
+    ASSERT_TRUE(file.empty());
+    ASSERT_EQ(E_SUCCESS, file.advise(MappedFile::Advice::WILL_NEED));
+}
+
+TEST(MappedFileTest, ReadWrite)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "read_write";
+    auto const CONTENT = createContent(10000);
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, CONTENT));
+
+    {
+        MappedFile file;
+        ASSERT_EQ(E_SUCCESS, file.open(PATH, MappedFile::Mode::COPY_ON_WRITE));
+        ::memcpy(file.data(), "PRIVATE", 7);
+        ASSERT_EQ(0, ::memcmp(file.data(), "PRIVATE", 7));
+    }
+    std::string result;
+    ASSERT_EQ(E_SUCCESS, readFile(PATH, result));
+    ASSERT_EQ(CONTENT, result);
+
+    {
+        MappedFile file;
+        ASSERT_EQ(E_SUCCESS, file.open(PATH, MappedFile::Mode::READ_WRITE, 5000, 100));
+        auto span = file.span();
+        ::memcpy(span.buffer, "SHARED", 6);
+        ASSERT_EQ(E_SUCCESS, file.flush());
+    }
+    ASSERT_EQ(E_SUCCESS, readFile(PATH, result));
+    ASSERT_EQ(std::string("SHARED"), result.substr(5000, 6));
+    ASSERT_EQ(CONTENT.substr(0, 5000), result.substr(0, 5000));
+    ASSERT_EQ(CONTENT.substr(5006), result.substr(5006));
+}
+
+TEST(MappedFileTest, BenchmarkOfRead)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "benchmark";
+    std::size_t const SIZE = 64 * 1024 * 1024;
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, createContent(SIZE)));
+    int const LOOP = 5;
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    std::size_t copy_sum = 0;
+    for (int i = 0; i < LOOP; ++i) {
+        std::string content;
+        ASSERT_EQ(E_SUCCESS, readFile(PATH, content));
+        copy_sum += static_cast<uint8_t>(content[SIZE / 2]);
+    }
+    auto const COPY = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    std::size_t mapped_sum = 0;
+    for (int i = 0; i < LOOP; ++i) {
+        MappedFile file;
+        ASSERT_EQ(E_SUCCESS, readFile(PATH, file));
+        mapped_sum += static_cast<uint8_t>(file.data()[SIZE / 2]);
+    }
+    auto const MAPPED = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(copy_sum, mapped_sum);
+    std::cout << "readFile(std::string): " << COPY << "us, readFile(MappedFile): " << MAPPED << "us" << std::endl;
+}
+
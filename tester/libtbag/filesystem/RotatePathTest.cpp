@@ -3,6 +3,7 @@
  * @brief  RotatePath class tester.
  * @author zer0
  * @date   2017-07-31
+ * @date   2026-10-19 (Add the tests of the retention prefix)
  */
 
 #include <gtest/gtest.h>
@@ -80,3 +81,107 @@ TEST(RotatePathTest, CreateParams_02)
     ASSERT_FALSE(((ArchiveCleaner*)params.cleaner.get())->remove_source_file);
 }
 
+
+TEST(RotatePathTest, CreateParams_03)
+{
+    auto params = RotatePath::createParams("retention=3,3600,10m,log size=1k counter=/prefix/log archive=.7zip,true,9,4");
+    ASSERT_TRUE((bool)params.cleaner);
+
+    auto * cleaner = (BackgroundArchiveCleaner*)params.cleaner.get();
+    ASSERT_STREQ(".7zip", cleaner->archive_suffix.c_str());
+    ASSERT_TRUE(cleaner->remove_source_file);
+    ASSERT_EQ(9, cleaner->compression_level);
+    ASSERT_EQ(4, cleaner->queue_size);
+    ASSERT_EQ(3, cleaner->retention.max_count);
+    ASSERT_EQ(3600, cleaner->retention.max_age_seconds);
+    ASSERT_EQ(10*1024*1024, cleaner->retention.max_total_size);
+    ASSERT_STREQ("log", cleaner->retention.prefix.c_str());
+}
+
+TEST(RotatePathTest, CreateParams_DefaultRetentionPrefix)
+{
+    auto params = RotatePath::createParams("retention=3 counter=/prefix/app,.log archive=.zip");
+    auto * cleaner = (BackgroundArchiveCleaner*)params.cleaner.get();
+    ASSERT_STREQ("app", cleaner->retention.prefix.c_str());
+
+    params = RotatePath::createParams("time=/prefix/server-$py$pm$pd.log archive=.zip retention=3");
+    cleaner = (BackgroundArchiveCleaner*)params.cleaner.get();
+    ASSERT_STREQ("server-", cleaner->retention.prefix.c_str());
+
+    ASSERT_STREQ("", RotatePath::getRotatedFilePrefix("$py$pm$pd.log").c_str());
+}
+
+TEST(RotatePathTest, RetentionWithoutPrefix)
+{
+    tttDir_Automatic();
+    auto const DIR = tttDir_Get();
+    auto const OTHER = DIR / "other.zip";
+    ASSERT_EQ(E_SUCCESS, writeFile(OTHER, std::string("OTHER")));
+
+    BackgroundArchiveCleaner cleaner(".zip");
+    cleaner.retention.max_count = 1;
+    ASSERT_EQ(0u, cleaner.applyRetention(DIR));
+    ASSERT_TRUE(OTHER.exists());
+}
+
+TEST(RotatePathTest, BackgroundArchive)
+{
+    tttDir_Automatic();
+    auto const DIR = tttDir_Get();
+    std::size_t const MAX_SIZE = 1024;
+
+    auto cleaner = std::make_shared<BackgroundArchiveCleaner>(".zip", true, 9);
+    cleaner->retention.max_count = 2;
+    cleaner->retention.prefix = "log";
+
+    {
+        auto rotate = RotatePath(std::make_shared<MaxSizeWriter>(MAX_SIZE),
+                                 std::make_shared<CounterUpdater>(DIR / "log", ".log"),
+                                 cleaner);
+        libtbag::util::Buffer const BUFFER(MAX_SIZE * 5, 'A');
+        ASSERT_EQ(E_SUCCESS, rotate.write(BUFFER.data(), BUFFER.size()));
+        cleaner->wait();
+
+        ASSERT_EQ(5u, cleaner->archived_count);
+        ASSERT_EQ(0u, cleaner->skipped_count);
+        ASSERT_EQ(3u, cleaner->removed_count);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_FALSE((DIR / ("log" + std::to_string(i) + ".log")).exists());
+        }
+        ASSERT_TRUE((DIR / "log5.log").exists());
+
+        // The newest archives are kept, even if they are rotated in the same second.
+        ASSERT_TRUE((DIR / "log3.log.zip").exists());
+        ASSERT_TRUE((DIR / "log4.log.zip").exists());
+
+        std::size_t archives = 0;
+        for (auto const & name : DIR.scanNameOnly(Path::DIRENT_FILE)) {
+            if (Path(name).testSuffix(".zip")) {
+                auto const ENTRIES = libtbag::archive::decompressArchive(DIR / name);
+                ASSERT_EQ(1u, ENTRIES.size());
+                ASSERT_EQ(MAX_SIZE, ENTRIES[0].data.size());
+                ++archives;
+            }
+        }
+        ASSERT_EQ(2u, archives);
+    }
+
+    // The last file is archived when the RotatePath is destroyed.
+    cleaner->wait();
+    ASSERT_EQ(6u, cleaner->archived_count);
+    ASSERT_FALSE((DIR / "log5.log").exists());
+}
+
+TEST(RotatePathTest, BackgroundArchiveQueueFull)
+{
+    tttDir_Automatic();
+    auto const PATH = tttDir_Get() / "full.log";
+    ASSERT_EQ(E_SUCCESS, writeFile(PATH, std::string("LOG")));
+
+    BackgroundArchiveCleaner cleaner(".zip", true, ArchiveCleaner::DEFAULT_COMPRESSION_LEVEL, 0);
+    cleaner.clean(PATH);
+    cleaner.wait();
+    ASSERT_EQ(0u, cleaner.archived_count);
+    ASSERT_EQ(1u, cleaner.skipped_count);
+    ASSERT_TRUE(PATH.exists());
+}
@@ -4,6 +4,7 @@
  * @author zer0
  * @date   2017-06-10
  * @date   2019-02-20 (Rename: Image -> ImageIO)
+ * @date   2026-10-19 (Add the test of the encoded buffer)
  */
 
 #include <gtest/gtest.h>
@@ -11,6 +12,7 @@
 #include <libtbag/graphic/ImageIO.hpp>
 #include <libtbag/filesystem/Path.hpp>
 #include <libtbag/filesystem/File.hpp>
+#include <libtbag/filesystem/MappedFile.hpp>
 
 using namespace libtbag;
 using namespace libtbag::graphic;
@@ -64,6 +66,30 @@ TEST(ImageIOTest, ReadImage)
     ASSERT_EQ( 81, reload.offset<uint8_t>(reload.size() - 1)); // b
 }
 
+TEST(ImageIOTest, ReadImageBuffer)
+{
+    auto path = DemoAsset::get_tester_dir_image() / "lena.png";
+
+    libtbag::filesystem::MappedFile file;
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::readFile(path.getString(), file));
+
+    Box image;
+    ASSERT_EQ(E_SUCCESS, readImage(file.data(), file.size(), image));
+    ASSERT_EQ(3, image.dim(2));
+    ASSERT_EQ(512, image.dim(1));
+    ASSERT_EQ(512, image.dim(0));
+    ASSERT_EQ(226, image.offset<uint8_t>(0));
+
+    Box rgba;
+    ASSERT_EQ(E_SUCCESS, readRgbaImage(file.data(), file.size(), rgba));
+    ASSERT_EQ(4, rgba.dim(2));
+    ASSERT_EQ(226, rgba.offset<uint8_t>(0));
+    ASSERT_EQ(0xFF, rgba.offset<uint8_t>(3));
+
+    ASSERT_EQ(E_RDERR, readImage(file.data(), 10, image));
+    ASSERT_EQ(E_RDERR, readImage(nullptr, 0, image));
+}
+
 TEST(ImageIOTest, ReadRgbaImage)
 {
     auto path = DemoAsset::get_tester_dir_image() / "lena.png";
@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 #include <libtbag/http/HttpCommon.hpp>
+#include <algorithm>
 #include <iterator>
+#include <chrono>
+#include <iostream>
+#include <vector>
 
 using namespace libtbag;
 using namespace libtbag::http;
@@ -137,6 +141,76 @@ TEST(HttpCommonTest, GetMaskData)
     ASSERT_EQ( INPUT, getPayloadData(copyMaskingKeyFromBuffer((char const *)MASKING_KEY), OUTPUT));
 }
 
+static void naiveMasking(uint32_t mask, char * data, std::size_t size, std::size_t offset)
+{
+    auto const * mask_ptr = reinterpret_cast<char const *>(&mask);
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] ^= mask_ptr[(offset + i) % 4];
+    }
+}
+
+TEST(HttpCommonTest, CopyPayloadData)
+{
+    uint32_t const MASK = 0xa7f0adb0;
+    std::size_t const MAX_SIZE = 100;
+
+    std::vector<char> source(MAX_SIZE + 1);
+    for (std::size_t i = 0; i < source.size(); ++i) {
+        source[i] = static_cast<char>(i * 7 + 3);
+    }
+
+    for (std::size_t size = 0; size <= MAX_SIZE; ++size) {
+        for (std::size_t offset = 0; offset < 4; ++offset) {
+            // Unaligned source & destination.
+            std::vector<char> expected(source.begin() + 1, source.begin() + 1 + size);
+            naiveMasking(MASK, expected.data(), size, offset);
+
+            std::vector<char> copied(size + 1);
+            copyPayloadData(MASK, source.data() + 1, copied.data() + 1, size, offset);
+            ASSERT_TRUE(std::equal(expected.begin(), expected.end(), copied.begin() + 1));
+
+            std::vector<char> inplace(source.begin() + 1, source.begin() + 1 + size);
+            updatePayloadData(MASK, inplace.data(), size, offset);
+            ASSERT_EQ(expected, inplace);
+        }
+    }
+
+    // Split the payload at the unaligned position.
+    std::vector<char> whole(source);
+    naiveMasking(MASK, whole.data(), whole.size(), 0);
+    std::vector<char> split(source);
+    updatePayloadData(MASK, split.data(), 37);
+    updatePayloadData(MASK, split.data() + 37, split.size() - 37, 37);
+    ASSERT_EQ(whole, split);
+}
+
+TEST(HttpCommonTest, BenchmarkOfMasking)
+{
+    std::size_t const TEST_SIZE = 1024 * 1024;
+    int const TEST_COUNT = 32;
+    uint32_t const MASK = 0x12345678;
+
+    using namespace std::chrono;
+
+    std::vector<char> data1(TEST_SIZE, 'a');
+    auto const BEGIN1 = system_clock::now();
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        naiveMasking(MASK, data1.data(), data1.size(), 0);
+    }
+    auto const DURATION1 = duration_cast<microseconds>(system_clock::now() - BEGIN1).count();
+
+    std::vector<char> data2(TEST_SIZE, 'a');
+    auto const BEGIN2 = system_clock::now();
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        updatePayloadData(MASK, data2.data(), data2.size());
+    }
+    auto const DURATION2 = duration_cast<microseconds>(system_clock::now() - BEGIN2).count();
+
+    ASSERT_EQ(data1, data2);
+    std::cout << "Naive: " << DURATION1 << "us, "
+              << "Vectorized: " << DURATION2 << "us" << std::endl;
+}
+
 TEST(HttpCommonTest, UpgradeWebsocketKey)
 {
     std::string const TEST_ORIGINAL = "dGhlIHNhbXBsZSBub25jZQ==";
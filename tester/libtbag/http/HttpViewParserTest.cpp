@@ -0,0 +1,207 @@
+/**
+ * @file   HttpViewParserTest.cpp
+ * @brief  HttpViewParser class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Test all the known headers)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/http/HttpViewParser.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace libtbag;
+using namespace libtbag::http;
+
+static std::string toStdString(HttpViewParser::cbinf const & view)
+{
+    return std::string(view.buffer, view.buffer + view.size);
+}
+
+TEST(HttpViewParserTest, KnownHeader)
+{
+    ASSERT_EQ(KnownHeader::KH_CONTENT_LENGTH, getKnownHeader("content-length", 14));
+    ASSERT_EQ(KnownHeader::KH_CONTENT_LENGTH, getKnownHeader("CONTENT-LENGTH", 14));
+    ASSERT_EQ(KnownHeader::KH_UNKNOWN, getKnownHeader("Content-Lengths", 15));
+    ASSERT_EQ(getHeaderNameHash("Upgrade", 7), getHeaderNameHash("uPgRaDe", 7));
+    ASSERT_STREQ("Sec-WebSocket-Key", getKnownHeaderName(KnownHeader::KH_SEC_WEBSOCKET_KEY));
+    ASSERT_EQ(KnownHeader::KH_UNKNOWN, getKnownHeader("", 0));
+
+    // Each known header has its own slot.
+    for (std::size_t i = 1; i < KNOWN_HEADER_SIZE; ++i) {
+        auto const HEADER = static_cast<KnownHeader>(i);
+        auto const * name = getKnownHeaderName(HEADER);
+        ASSERT_EQ(HEADER, getKnownHeader(name, strlen(name))) << name;
+    }
+}
+
+TEST(HttpViewParserTest, Request)
+{
+    char const TEST_DATA[] = "POST /joyent/http-parser HTTP/1.1\r\n"
+            "Host: github.com\r\n"
+            "DNT: 1\r\n"
+            "X-Empty:\r\n"
+            "Content-Length:  11  \r\n"
+            "Connection: keep-alive\r\n\r\n"
+            "hello world";
+    std::size_t const TEST_DATA_LENGTH = sizeof(TEST_DATA) - 1;
+
+    HttpViewParser parser;
+    // Feed the data byte by byte.
+    for (std::size_t i = 0; i < TEST_DATA_LENGTH - 1; ++i) {
+        ASSERT_EQ(E_CONTINUE, parser.execute(TEST_DATA + i, 1));
+    }
+    ASSERT_EQ(E_SUCCESS, parser.execute(TEST_DATA + TEST_DATA_LENGTH - 1, 1));
+    ASSERT_TRUE(parser.isMessageComplete());
+
+    ASSERT_EQ(HttpMethod::M_POST, parser.getMethod());
+    ASSERT_EQ(1, parser.getHttpMajor());
+    ASSERT_EQ(1, parser.getHttpMinor());
+    ASSERT_EQ(std::string("/joyent/http-parser"), toStdString(parser.getUrl()));
+    ASSERT_EQ(5U, parser.headers().size());
+    ASSERT_EQ(std::string("github.com"), parser.getHeader(KnownHeader::KH_HOST));
+    ASSERT_EQ(std::string("1"), parser.getHeader("dnt"));
+    ASSERT_EQ(std::string(), parser.getHeader("X-Empty"));
+    ASSERT_NE(nullptr, parser.findHeader("x-empty"));
+    ASSERT_EQ(nullptr, parser.findHeader("X-Unknown"));
+    ASSERT_EQ(std::string("11"), parser.getHeader(KnownHeader::KH_CONTENT_LENGTH));
+    ASSERT_TRUE(parser.equalsHeaderValue(KnownHeader::KH_CONNECTION, "Keep-Alive"));
+    ASSERT_TRUE(parser.shouldKeepAlive());
+    ASSERT_FALSE(parser.isUpgrade());
+
+    ASSERT_EQ(1U, parser.bodies().size());
+    ASSERT_EQ(11U, parser.getBodySize());
+    ASSERT_EQ(std::string("hello world"), toStdString(parser.view(parser.bodies()[0])));
+    ASSERT_EQ(TEST_DATA_LENGTH, parser.getMessage().size);
+    ASSERT_EQ(0U, parser.getRemaining().size);
+
+    HttpProperty property;
+    parser.toProperty(property);
+    ASSERT_STREQ("POST", property.method.c_str());
+    ASSERT_STREQ("/joyent/http-parser", property.path.c_str());
+    ASSERT_EQ(5U, property.header.size());
+    ASSERT_STREQ("github.com", getHeaderValue(property.header, "Host").c_str());
+    ASSERT_EQ(std::string("hello world"), std::string(property.body.begin(), property.body.end()));
+}
+
+TEST(HttpViewParserTest, Pipelining)
+{
+    char const TEST_DATA[] = "GET /first HTTP/1.1\r\nHost: a\r\n\r\n"
+            "POST /second HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+            "5\r\nhello\r\n6\r\n world\r\n0\r\n\r\n"
+            "GET /third HTTP/1.1\r\nHo";
+    std::size_t const TEST_DATA_LENGTH = sizeof(TEST_DATA) - 1;
+
+    HttpViewParser parser;
+    ASSERT_EQ(E_SUCCESS, parser.execute(TEST_DATA, TEST_DATA_LENGTH));
+    ASSERT_EQ(HttpMethod::M_GET, parser.getMethod());
+    ASSERT_EQ(std::string("/first"), toStdString(parser.getUrl()));
+    ASSERT_EQ(std::string("a"), parser.getHeader(KnownHeader::KH_HOST));
+    ASSERT_EQ(0U, parser.getBodySize());
+    ASSERT_LT(0U, parser.getRemaining().size);
+
+    ASSERT_EQ(E_SUCCESS, parser.next());
+    ASSERT_EQ(HttpMethod::M_POST, parser.getMethod());
+    ASSERT_EQ(std::string("/second"), toStdString(parser.getUrl()));
+    ASSERT_TRUE(parser.isChunked());
+    ASSERT_EQ(2U, parser.bodies().size());
+    HttpViewParser::Buffer body;
+    ASSERT_EQ(11U, parser.getBody(body));
+    ASSERT_EQ(std::string("hello world"), std::string(body.begin(), body.end()));
+    ASSERT_EQ(nullptr, parser.findHeader(KnownHeader::KH_HOST));
+
+    ASSERT_EQ(E_CONTINUE, parser.next());
+    ASSERT_EQ(E_ILLSTATE, parser.next());
+    ASSERT_EQ(E_SUCCESS, parser.execute("st: c\r\n\r\n", 9));
+    ASSERT_EQ(std::string("/third"), toStdString(parser.getUrl()));
+    ASSERT_EQ(std::string("c"), parser.getHeader(KnownHeader::KH_HOST));
+    ASSERT_EQ(E_CONTINUE, parser.next());
+}
+
+TEST(HttpViewParserTest, Upgrade)
+{
+    char const TEST_DATA[] = "GET /chat HTTP/1.1\r\n"
+            "Host: server.example.com\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+            "Sec-WebSocket-Version: 13\r\n\r\n"
+            "\x81\x00";
+    std::size_t const TEST_DATA_LENGTH = sizeof(TEST_DATA) - 1;
+
+    HttpViewParser parser;
+    ASSERT_EQ(E_SUCCESS, parser.execute(TEST_DATA, TEST_DATA_LENGTH));
+    ASSERT_TRUE(parser.isUpgrade());
+    ASSERT_TRUE(parser.equalsHeaderValue(KnownHeader::KH_UPGRADE, "WebSocket"));
+    ASSERT_EQ(std::string("dGhlIHNhbXBsZSBub25jZQ=="), parser.getHeader(KnownHeader::KH_SEC_WEBSOCKET_KEY));
+    ASSERT_EQ(2U, parser.getRemaining().size);
+    ASSERT_EQ('\x81', parser.getRemaining().buffer[0]);
+}
+
+TEST(HttpViewParserTest, Response)
+{
+    char const TEST_DATA[] = "HTTP/1.1 301 Moved Permanently\r\n"
+            "Location: http://www.google.com/\r\n"
+            "Content-Length: 0\r\n\r\n";
+    std::size_t const TEST_DATA_LENGTH = sizeof(TEST_DATA) - 1;
+
+    HttpViewParser parser(HttpViewParser::ParserType::RESPONSE);
+    ASSERT_EQ(E_SUCCESS, parser.execute(TEST_DATA, TEST_DATA_LENGTH));
+    ASSERT_EQ(301, parser.getStatusCode());
+    ASSERT_EQ(std::string("Moved Permanently"), toStdString(parser.getReason()));
+    ASSERT_EQ(std::string("http://www.google.com/"), parser.getHeader("location"));
+
+    HttpProperty property;
+    parser.toProperty(property);
+    ASSERT_EQ(301, property.code);
+    ASSERT_STREQ("Moved Permanently", property.reason.c_str());
+}
+
+TEST(HttpViewParserTest, Error)
+{
+    HttpViewParser parser;
+    ASSERT_EQ(E_PARSING, parser.execute("GET / HTTP/1.1\r\nHo st: a\r\n\r\n", 28));
+}
+
+TEST(HttpViewParserTest, BenchmarkOfHeaderParsing)
+{
+    char const TEST_DATA[] = "GET /index.html HTTP/1.1\r\n"
+            "Host: github.com\r\n"
+            "Accept-Encoding: gzip, deflate, sdch\r\n"
+            "Accept-Language: ru-RU,ru;q=0.8,en-US;q=0.6,en;q=0.4\r\n"
+            "User-Agent: Mozilla/5.0 (Macintosh; Intel Mac OS X 10_10_1)\r\n"
+            "Accept: text/html,application/xhtml+xml,application/xml;q=0.9\r\n"
+            "Referer: https://github.com/joyent/http-parser\r\n"
+            "Connection: keep-alive\r\n"
+            "Cache-Control: max-age=0\r\n\r\n";
+    std::size_t const TEST_DATA_LENGTH = sizeof(TEST_DATA) - 1;
+    int const TEST_COUNT = 10000;
+
+    using namespace std::chrono;
+
+    HttpParser http;
+    auto const BEGIN1 = system_clock::now();
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        http.clear();
+        ASSERT_EQ(E_SUCCESS, http.execute(TEST_DATA, TEST_DATA_LENGTH));
+        ASSERT_FALSE(http.property().getIgnoreCase(HEADER_CONNECTION).empty());
+    }
+    auto const DURATION1 = duration_cast<microseconds>(system_clock::now() - BEGIN1).count();
+
+    HttpViewParser view;
+    auto const BEGIN2 = system_clock::now();
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, view.execute(TEST_DATA, TEST_DATA_LENGTH));
+        ASSERT_TRUE(view.existsHeader(KnownHeader::KH_CONNECTION));
+        ASSERT_EQ(E_CONTINUE, view.next());
+    }
+    auto const DURATION2 = duration_cast<microseconds>(system_clock::now() - BEGIN2).count();
+
+    std::cout << "HttpParser: " << DURATION1 << "us, "
+              << "HttpViewParser: " << DURATION2 << "us" << std::endl;
+}
+
@@ -0,0 +1,552 @@
+/**
+ * @file   UvHttpClientTest.cpp
+ * @brief  UvHttpClient class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the Resolve test)
+ * @date   2026-10-19 (Add the TlsVerify test)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/http/UvHttpClient.hpp>
+#include <libtbag/http/UvHttpServer.hpp>
+#include <libtbag/crypto/Rsa.hpp>
+#include <libtbag/crypto/Tls.hpp>
+#include <libtbag/crypto/X509.hpp>
+#include <libtbag/filesystem/File.hpp>
+#include <libtbag/uvpp/Loop.hpp>
+#include <libtbag/uvpp/Tcp.hpp>
+#include <libtbag/uvpp/Request.hpp>
+#include <libtbag/util/TestUtils.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::http;
+using namespace libtbag::uvpp;
+
+static std::string toString(HttpResponse const & response)
+{
+    return std::string(response.body.begin(), response.body.end());
+}
+
+static bool openTestServer(UvHttpServer & server)
+{
+    UvHttpServer::RequestMap reqs;
+    UvHttpServer::req(reqs, "/echo", [](UvHttpServer::Session & session, HttpViewParser const & request){
+        UvHttpServer::Buffer body;
+        request.getBody(body);
+        auto const URL = request.getUrl();
+        std::string result(URL.buffer, URL.buffer + URL.size);
+        result.append(body.begin(), body.end());
+        session.writeResponse(200, "text/plain", result);
+    });
+    UvHttpServer::req(reqs, "/stream", [](UvHttpServer::Session & session, HttpViewParser const & request){
+        std::string const CHUNK(1024, 'x');
+        session.writeChunkedHeader(200, HttpHeaders());
+        for (int i = 0; i < 100; ++i) {
+            session.writeChunk(CHUNK.data(), CHUNK.size());
+        }
+        session.writeLastChunk();
+    });
+    UvHttpServer::req(reqs, "/bye", [](UvHttpServer::Session & session, HttpViewParser const & request){
+        // The connection looks reusable, but it is closed.
+        session.writeResponse(200, "bye");
+        session.closeAfterFlush();
+    });
+
+    UvHttpServer::Options options;
+    options.bind = "127.0.0.1";
+    return isSuccess(server.open(options, reqs));
+}
+
+static std::string getEchoUrl(UvHttpServer const & server, int index)
+{
+    return "http://127.0.0.1:" + std::to_string(server.getPort()) + "/echo?" + std::to_string(index);
+}
+
+TEST(UvHttpClientTest, KeepAlive)
+{
+    UvHttpServer server;
+    ASSERT_TRUE(openTestServer(server));
+
+    int const COUNT = 16;
+    std::vector<std::string> results(COUNT);
+    int success = 0;
+
+    Loop loop;
+    UvHttpClient::Options options;
+    options.max_connections_per_host = 1;
+    UvHttpClient client(loop, options);
+
+    for (int i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, client.get(getEchoUrl(server, i), [&, i](Err code, HttpResponse & response){
+            if (isSuccess(code) && response.code == 200) {
+                results[i] = toString(response);
+                ++success;
+            }
+        }));
+    }
+    ASSERT_EQ(E_SUCCESS, client.post(getEchoUrl(server, COUNT), "body", [&](Err code, HttpResponse & response){
+        if (isSuccess(code) && response.code == 200 && toString(response) == "/echo?16body") {
+            ++success;
+        }
+    }));
+
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(COUNT + 1, success);
+    for (int i = 0; i < COUNT; ++i) {
+        ASSERT_EQ("/echo?" + std::to_string(i), results[i]);
+    }
+    ASSERT_EQ(1U, client.getConnectCount());
+    ASSERT_EQ(1U, client.getMaxInFlight());
+    ASSERT_EQ(1U, client.getIdleConnectionCount());
+
+    client.close();
+    ASSERT_EQ(0U, client.getConnectionCount());
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(E_CLOSED, client.get(getEchoUrl(server, 0), UvHttpClient::OnResponse()));
+    server.close();
+}
+
+TEST(UvHttpClientTest, Pipelining)
+{
+    UvHttpServer server;
+    ASSERT_TRUE(openTestServer(server));
+
+    int const COUNT = 32;
+    std::vector<std::string> results;
+
+    Loop loop;
+    UvHttpClient::Options options;
+    options.max_connections_per_host = 1;
+    options.max_pipeline_depth = 8;
+    UvHttpClient client(loop, options);
+
+    for (int i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, client.get(getEchoUrl(server, i), [&](Err code, HttpResponse & response){
+            if (isSuccess(code) && response.code == 200) {
+                results.push_back(toString(response));
+            }
+        }));
+    }
+
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(COUNT, results.size());
+    for (int i = 0; i < COUNT; ++i) {
+        ASSERT_EQ("/echo?" + std::to_string(i), results[i]);
+    }
+    ASSERT_EQ(1U, client.getConnectCount());
+    ASSERT_LT(1U, client.getMaxInFlight());
+    ASSERT_GE(8U, client.getMaxInFlight());
+
+    client.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    server.close();
+}
+
+TEST(UvHttpClientTest, ConnectionLimit)
+{
+    UvHttpServer server;
+    ASSERT_TRUE(openTestServer(server));
+
+    int const COUNT = 20;
+    int success = 0;
+    std::size_t max_waiting = 0;
+
+    Loop loop;
+    UvHttpClient::Options options;
+    options.max_connections_per_host = 3;
+    options.max_idle_connections_per_host = 2;
+    UvHttpClient client(loop, options);
+
+    for (int i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, client.get(getEchoUrl(server, i), [&](Err code, HttpResponse & response){
+            max_waiting = std::max(max_waiting, client.getWaitingCount());
+            if (isSuccess(code) && response.code == 200) {
+                ++success;
+            }
+        }));
+    }
+    ASSERT_EQ(3U, client.getConnectionCount());
+    ASSERT_EQ(COUNT - 3, client.getWaitingCount());
+
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(COUNT, success);
+    ASSERT_EQ(3U, client.getConnectCount());
+    ASSERT_EQ(1U, client.getMaxInFlight());
+    ASSERT_LT(0U, max_waiting);
+    ASSERT_EQ(2U, client.getIdleConnectionCount());
+
+    client.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    server.close();
+}
+
+TEST(UvHttpClientTest, StreamingBody)
+{
+    UvHttpServer server;
+    ASSERT_TRUE(openTestServer(server));
+
+    Loop loop;
+    UvHttpClient client(loop);
+
+    int headers = 0;
+    std::size_t streamed = 0;
+    Err result = E_UNKNOWN;
+    std::size_t body_size = 1;
+
+    UvHttpClient::Request request;
+    request.host = "127.0.0.1";
+    request.port = server.getPort();
+    request.path = "/stream";
+    request.headers_cb = [&](HttpResponse const & response){
+        if (response.code == 200 && response.body.empty()) {
+            ++headers;
+        }
+    };
+    request.body_cb = [&](char const * data, std::size_t size){
+        streamed += size;
+    };
+    request.response_cb = [&](Err code, HttpResponse & response){
+        result = code;
+        body_size = response.body.size();
+    };
+    ASSERT_EQ(E_SUCCESS, client.request(request));
+
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(E_SUCCESS, result);
+    ASSERT_EQ(1, headers);
+    ASSERT_EQ(100 * 1024, streamed);
+    ASSERT_EQ(0U, body_size);
+
+    // Limit of the accumulated body.
+    client.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+
+    UvHttpClient::Options options;
+    options.max_response_size = 1024;
+    UvHttpClient limited(loop, options);
+    request.body_cb = UvHttpClient::OnBody();
+    ASSERT_EQ(E_SUCCESS, limited.request(request));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(E_DATA_TOO_LARGE, result);
+
+    limited.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    server.close();
+}
+
+TEST(UvHttpClientTest, RetryClosedConnection)
+{
+    UvHttpServer server;
+    ASSERT_TRUE(openTestServer(server));
+
+    Loop loop;
+    UvHttpClient::Options options;
+    options.max_connections_per_host = 1;
+    UvHttpClient client(loop, options);
+
+    std::string const URL = "http://127.0.0.1:" + std::to_string(server.getPort()) + "/bye";
+    int success = 0;
+    std::function<void(Err, HttpResponse&)> on_response;
+    on_response = [&](Err code, HttpResponse & response){
+        if (isSuccess(code) && toString(response) == "bye") {
+            if (++success < 4) {
+                client.get(URL, on_response);
+            }
+        }
+    };
+    ASSERT_EQ(E_SUCCESS, client.get(URL, on_response));
+
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(4, success);
+    ASSERT_LE(2U, client.getConnectCount());
+
+    client.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    server.close();
+}
+
+TEST(UvHttpClientTest, Resolve)
+{
+    UvHttpServer server;
+    ASSERT_TRUE(openTestServer(server));
+
+    Loop loop;
+    UvHttpClient::Options options;
+    options.max_connections_per_host = 1;
+    UvHttpClient client(loop, options);
+
+    // The requests wait in the pool until the host is resolved.
+    int const COUNT = 4;
+    int success = 0;
+    for (int i = 0; i < COUNT; ++i) {
+        auto const URL = "http://localhost:" + std::to_string(server.getPort()) + "/echo?" + std::to_string(i);
+        ASSERT_EQ(E_SUCCESS, client.get(URL, [&, i](Err code, HttpResponse & response){
+            if (isSuccess(code) && toString(response) == "/echo?" + std::to_string(i)) {
+                ++success;
+            }
+        }));
+    }
+    ASSERT_EQ(0U, client.getResolveCount());
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(COUNT, success);
+    ASSERT_EQ(1U, client.getResolveCount());
+    ASSERT_EQ(1U, client.getConnectCount());
+
+    // The IP address is not resolved.
+    ASSERT_EQ(E_SUCCESS, client.get(getEchoUrl(server, 0), UvHttpClient::OnResponse()));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(1U, client.getResolveCount());
+
+    // The host is resolved again after the connect failure.
+    auto listener = loop.newHandle<Tcp>(loop);
+    ASSERT_EQ(E_SUCCESS, initCommonServer(*listener, "127.0.0.1", 0));
+    auto const CLOSED_URL = "http://localhost:" + std::to_string(listener->getSockPort()) + "/";
+    listener->close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+
+    std::vector<Err> results;
+    ASSERT_EQ(E_SUCCESS, client.get(CLOSED_URL, [&](Err code, HttpResponse & response){
+        results.push_back(code);
+        client.get(CLOSED_URL, [&](Err code, HttpResponse & response){
+            results.push_back(code);
+        });
+    }));
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(2U, results.size());
+    ASSERT_TRUE(isFailure(results[0]));
+    ASSERT_TRUE(isFailure(results[1]));
+    ASSERT_EQ(3U, client.getResolveCount());
+
+    client.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    server.close();
+}
+
+TEST(UvHttpClientTest, Timeout)
+{
+    Loop loop;
+
+    // Connections remain in the backlog and no response is written.
+    auto listener = loop.newHandle<Tcp>(loop);
+    ASSERT_EQ(E_SUCCESS, initCommonServer(*listener, "127.0.0.1", 0));
+    auto const PORT = listener->getSockPort();
+
+    UvHttpClient client(loop);
+    Err result = E_UNKNOWN;
+
+    UvHttpClient::Request request;
+    request.host = "127.0.0.1";
+    request.port = PORT;
+    request.timeout = 100;
+    request.response_cb = [&](Err code, HttpResponse & response){
+        result = code;
+        listener->close();
+    };
+    ASSERT_EQ(E_SUCCESS, client.request(request));
+
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(E_TIMEOUT, result);
+    ASSERT_EQ(0U, client.getConnectionCount());
+
+    client.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+}
+
+/**
+ * Minimal HTTPS server of the test.
+ */
+struct UvHttpClientTlsSession : public Tcp
+{
+    using Tls = libtbag::crypto::Tls;
+
+    Tls tls;
+    WriteRequest write_req;
+    std::vector<char> buffer;
+    std::vector<char> output;
+    std::vector<char> writing;
+    std::string request;
+    bool is_writing = false;
+
+    UvHttpClientTlsSession(Loop & loop, Tls const & context)
+            : Tcp(loop), tls(Tls::reference_ssl_context{}, context)
+    { tls.accept(); }
+
+    void flush()
+    {
+        if (tls.pendingOfEncodeBufferSize() > 0) {
+            std::vector<char> encoded;
+            tls.readFromWriteBuffer(encoded);
+            output.insert(output.end(), encoded.begin(), encoded.end());
+        }
+        if (is_writing || output.empty()) {
+            return;
+        }
+        writing.swap(output);
+        output.clear();
+        is_writing = isSuccess(write(write_req, writing.data(), writing.size()));
+    }
+
+    binf onAlloc(std::size_t suggested_size) override
+    {
+        return defaultOnAlloc(buffer, suggested_size);
+    }
+
+    void onRead(Err code, char const * data, std::size_t size) override
+    {
+        if (isFailure(code) || isFailure(tls.writeToReadBuffer(data, size))) {
+            close();
+            return;
+        }
+        if (!tls.isFinished()) {
+            tls.handshake();
+            flush();
+            if (!tls.isFinished()) {
+                return;
+            }
+        }
+        while (tls.pendingOfDecodeBufferSize() > 0 || tls.pendingOfDecodedSize() > 0) {
+            Err decode_code = E_UNKNOWN;
+            auto const PLAIN = tls.decode(&decode_code);
+            if (isFailure(decode_code)) {
+                break;
+            }
+            request.append(PLAIN.begin(), PLAIN.end());
+        }
+
+        std::string const RESPONSE = "HTTP/1.1 200 OK\r\nContent-Length: 6\r\n\r\nsecure";
+        for (auto end = request.find("\r\n\r\n"); end != std::string::npos; end = request.find("\r\n\r\n")) {
+            request.erase(0, end + 4);
+            Err encode_code = E_UNKNOWN;
+            auto const ENCODED = tls.encode(RESPONSE.data(), RESPONSE.size(), &encode_code);
+            output.insert(output.end(), ENCODED.begin(), ENCODED.end());
+        }
+        flush();
+    }
+
+    void onWrite(WriteRequest & request, Err code) override
+    {
+        is_writing = false;
+        flush();
+    }
+};
+
+struct UvHttpClientTlsServer : public Tcp
+{
+    libtbag::crypto::Tls context;
+    std::vector<std::shared_ptr<UvHttpClientTlsSession>> sessions;
+
+    UvHttpClientTlsServer(Loop & loop, libtbag::crypto::X509Pem const & pem)
+            : Tcp(loop), context(pem)
+    { /* EMPTY. */ }
+
+    void onConnection(Err code) override
+    {
+        auto session = getLoop()->newHandle<UvHttpClientTlsSession>(*getLoop(), context);
+        if (isSuccess(accept(*session)) && isSuccess(session->startRead())) {
+            sessions.push_back(session);
+        } else {
+            session->close();
+        }
+    }
+
+    void closeAll()
+    {
+        for (auto & session : sessions) {
+            if (!session->isClosing()) {
+                session->close();
+            }
+        }
+        close();
+    }
+};
+
+/** Self-signed certificate of the host. */
+static libtbag::crypto::X509Pem genTestCertificate(std::string const & host)
+{
+    using namespace libtbag::crypto;
+    X509Pem pem;
+    pem.private_key = Rsa::generatePemPrivateKey();
+    auto const ENTRIES = getDefaultX509NameEntry("KR", "Seoul", "Seoul", "tbag", "test", host, "tbag@" + host);
+    pem.certificate = generateSelfSignedCertificate(pem.private_key, generateCsrVersion1(ENTRIES, pem.private_key));
+    return pem;
+}
+
+TEST(UvHttpClientTest, Tls)
+{
+    tttDir_Automatic();
+    auto const PEM = genTestCertificate("localhost");
+    auto const CA_FILE = (tttDir_Get() / "ca.pem").toString();
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::writeFile(CA_FILE, PEM.certificate));
+
+    Loop loop;
+    auto server = loop.newHandle<UvHttpClientTlsServer>(loop, PEM);
+    ASSERT_EQ(E_SUCCESS, initCommonServer(*server, "127.0.0.1", 0));
+
+    UvHttpClient::Options options;
+    options.max_connections_per_host = 2;
+    options.tls_ca_file = CA_FILE;
+    UvHttpClient client(loop, options);
+
+    std::string const URL = "https://localhost:" + std::to_string(server->getSockPort()) + "/";
+    int const COUNT = 8;
+    int success = 0;
+    int completed = 0;
+    for (int i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, client.get(URL, [&](Err code, HttpResponse & response){
+            if (isSuccess(code) && response.code == 200 && toString(response) == "secure") {
+                ++success;
+            }
+            if (++completed == COUNT) {
+                server->closeAll();
+            }
+        }));
+    }
+
+    ASSERT_EQ(E_SUCCESS, loop.run());
+    ASSERT_EQ(COUNT, success);
+    ASSERT_EQ(2U, client.getConnectCount());
+
+    client.close();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+}
+
+
+TEST(UvHttpClientTest, TlsVerify)
+{
+    tttDir_Automatic();
+    auto const PEM = genTestCertificate("example.com");
+    auto const CA_FILE = (tttDir_Get() / "ca.pem").toString();
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::writeFile(CA_FILE, PEM.certificate));
+
+    Loop loop;
+    auto server = loop.newHandle<UvHttpClientTlsServer>(loop, PEM);
+    ASSERT_EQ(E_SUCCESS, initCommonServer(*server, "127.0.0.1", 0));
+    server->unref();
+    std::string const URL = "https://localhost:" + std::to_string(server->getSockPort()) + "/";
+
+    // [1] The certificate is not trusted.
+    // [2] The certificate is trusted, but it does not match the host.
+    for (auto const & ca_file : {std::string(), CA_FILE}) {
+        UvHttpClient::Options options;
+        options.tls_ca_file = ca_file;
+        UvHttpClient client(loop, options);
+
+        Err result = E_UNKNOWN;
+        ASSERT_EQ(E_SUCCESS, client.get(URL, [&](Err code, HttpResponse & response){
+            result = code;
+        }));
+        ASSERT_EQ(E_SUCCESS, loop.run());
+        ASSERT_EQ(E_SSL, result);
+
+        client.close();
+        ASSERT_EQ(E_SUCCESS, loop.run());
+    }
+
+    server->closeAll();
+    ASSERT_EQ(E_SUCCESS, loop.run());
+}
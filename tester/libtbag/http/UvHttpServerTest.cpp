@@ -0,0 +1,557 @@
+/**
+ * @file   UvHttpServerTest.cpp
+ * @brief  UvHttpServer class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the StaticFileOfSlowClient test)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/http/UvHttpServer.hpp>
+#include <libtbag/http/HttpServer.hpp>
+#include <libtbag/http/WsFrame.hpp>
+#include <libtbag/uvpp/Loop.hpp>
+#include <libtbag/filesystem/File.hpp>
+#include <libtbag/string/StringUtils.hpp>
+#include <libtbag/util/TestUtils.hpp>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::http;
+using namespace libtbag::uvpp;
+
+/**
+ * Send the request and receive the response until the predicate is satisfied.
+ */
+struct UvHttpRawClient : public Tcp
+{
+    using Predicate = std::function<bool(std::string const &)>;
+
+    ConnectRequest connect_req;
+    WriteRequest write_req;
+    std::vector<char> buffer;
+
+    std::string request;
+    std::string response;
+    Predicate predicate;
+
+    UvHttpRawClient(Loop & loop) : Tcp(loop)
+    { /* EMPTY. */ }
+
+    void onConnect(ConnectRequest & request, Err code) override
+    {
+        if (isFailure(code) || isFailure(startRead())) {
+            close();
+            return;
+        }
+        if (isFailure(write(write_req, this->request.data(), this->request.size()))) {
+            close();
+        }
+    }
+
+    binf onAlloc(std::size_t suggested_size) override
+    {
+        return defaultOnAlloc(buffer, suggested_size);
+    }
+
+    void onRead(Err code, char const * buffer, std::size_t size) override
+    {
+        if (isFailure(code)) {
+            close();
+            return;
+        }
+        response.append(buffer, buffer + size);
+        if (predicate && predicate(response)) {
+            close();
+        }
+    }
+};
+
+static std::string requestRaw(int port, std::string const & request,
+                              UvHttpRawClient::Predicate const & predicate = UvHttpRawClient::Predicate())
+{
+    Loop loop;
+    auto client = loop.newHandle<UvHttpRawClient>(loop);
+    client->request = request;
+    client->predicate = predicate;
+    if (isFailure(initCommonClient(*client, client->connect_req, "127.0.0.1", port))) {
+        return std::string();
+    }
+    loop.run();
+    return client->response;
+}
+
+static std::vector<HttpProperty> parseResponses(std::string const & data)
+{
+    std::vector<HttpProperty> result;
+    HttpViewParser parser(HttpViewParser::ParserType::RESPONSE);
+    auto code = parser.execute(data.data(), data.size());
+    while (code == E_SUCCESS) {
+        result.emplace_back();
+        parser.toProperty(result.back());
+        code = parser.next();
+    }
+    return result;
+}
+
+/**
+ * Load generator of the keep-alive & pipelined requests.
+ */
+struct UvHttpLoadClient : public Tcp
+{
+    ConnectRequest connect_req;
+    WriteRequest write_req;
+    std::vector<char> buffer;
+    HttpViewParser parser;
+
+    std::string batch;
+    int depth;
+    int total;
+    int sent = 0;
+    int received = 0;
+    int errors = 0;
+
+    UvHttpLoadClient(Loop & loop, std::string const & request, int d, int t)
+            : Tcp(loop), parser(HttpViewParser::ParserType::RESPONSE), depth(d), total(t)
+    {
+        for (int i = 0; i < depth; ++i) {
+            batch += request;
+        }
+    }
+
+    void sendBatch()
+    {
+        if (isFailure(write(write_req, batch.data(), batch.size()))) {
+            close();
+            return;
+        }
+        sent += depth;
+    }
+
+    void onConnect(ConnectRequest & request, Err code) override
+    {
+        if (isFailure(code) || isFailure(startRead())) {
+            close();
+            return;
+        }
+        setNodelay(true);
+        sendBatch();
+    }
+
+    binf onAlloc(std::size_t suggested_size) override
+    {
+        return defaultOnAlloc(buffer, suggested_size);
+    }
+
+    void onRead(Err code, char const * buffer, std::size_t size) override
+    {
+        if (isFailure(code)) {
+            close();
+            return;
+        }
+        auto result = parser.execute(buffer, size);
+        while (result == E_SUCCESS) {
+            if (parser.getStatusCode() != 200) {
+                ++errors;
+            }
+            ++received;
+            result = parser.next();
+
+            if (received == total) {
+                close();
+                return;
+            }
+            if (received == sent) {
+                sendBatch();
+            }
+        }
+        if (result != E_CONTINUE) {
+            ++errors;
+            close();
+        }
+    }
+};
+
+static int runLoad(int port, std::string const & request, int connections, int depth, int total)
+{
+    Loop loop;
+    std::vector<std::shared_ptr<UvHttpLoadClient>> clients;
+    for (int i = 0; i < connections; ++i) {
+        auto client = loop.newHandle<UvHttpLoadClient>(loop, request, depth, total);
+        if (isFailure(initCommonClient(*client, client->connect_req, "127.0.0.1", port))) {
+            return 0;
+        }
+        clients.push_back(client);
+    }
+    loop.run();
+
+    int received = 0;
+    for (auto & client : clients) {
+        if (client->errors == 0) {
+            received += client->received;
+        }
+    }
+    return received;
+}
+
+TEST(UvHttpServerTest, Pipelining)
+{
+    UvHttpServer::RequestMap reqs;
+    ASSERT_TRUE(UvHttpServer::req(reqs, "/hello", [](UvHttpServer::Session & session, HttpViewParser const & request){
+        session.writeResponse(200, "text/plain", "hello");
+    }));
+    ASSERT_TRUE(UvHttpServer::req(reqs, "/echo", [](UvHttpServer::Session & session, HttpViewParser const & request){
+        UvHttpServer::Buffer body;
+        request.getBody(body);
+        HttpHeaders headers;
+        session.writeResponse(200, headers, body.data(), body.size());
+    }, UvHttpServer::METHOD_FLAG_POST));
+    ASSERT_TRUE(UvHttpServer::req(reqs, "/stream", [](UvHttpServer::Session & session, HttpViewParser const & request){
+        session.writeChunkedHeader(200, HttpHeaders());
+        session.writeChunk("abc", 3);
+        session.writeChunk("defg", 4);
+        session.writeLastChunk();
+    }));
+    ASSERT_FALSE(UvHttpServer::req(reqs, "/hello", UvHttpServer::OnRequest()));
+
+    UvHttpServer server;
+    UvHttpServer::Options options;
+    options.bind = "127.0.0.1";
+    ASSERT_EQ(E_SUCCESS, server.open(options, reqs));
+    ASSERT_TRUE(server.isOpen());
+    ASSERT_LT(0, server.getPort());
+
+    std::string const REQUEST = "GET /hello?query=1 HTTP/1.1\r\nHost: a\r\n\r\n"
+            "POST /echo HTTP/1.1\r\nHost: a\r\nTransfer-Encoding: chunked\r\n\r\n"
+            "5\r\nhello\r\n6\r\n world\r\n0\r\n\r\n"
+            "GET /echo HTTP/1.1\r\nHost: a\r\n\r\n"
+            "GET /stream HTTP/1.1\r\nHost: a\r\n\r\n"
+            "GET /unknown HTTP/1.1\r\nHost: a\r\nConnection: close\r\n\r\n";
+    auto const RESPONSE = requestRaw(server.getPort(), REQUEST);
+    auto const PROPERTIES = parseResponses(RESPONSE);
+    ASSERT_EQ(5U, PROPERTIES.size());
+
+    ASSERT_EQ(200, PROPERTIES[0].code);
+    ASSERT_EQ(std::string("hello"), std::string(PROPERTIES[0].body.begin(), PROPERTIES[0].body.end()));
+    ASSERT_EQ(std::string("text/plain"), getHeaderValue(PROPERTIES[0].header, HEADER_CONTENT_TYPE));
+    ASSERT_EQ(std::string("keep-alive"), getHeaderValue(PROPERTIES[0].header, HEADER_CONNECTION));
+
+    ASSERT_EQ(200, PROPERTIES[1].code);
+    ASSERT_EQ(std::string("hello world"), std::string(PROPERTIES[1].body.begin(), PROPERTIES[1].body.end()));
+
+    ASSERT_EQ(405, PROPERTIES[2].code);
+
+    ASSERT_EQ(200, PROPERTIES[3].code);
+    ASSERT_EQ(std::string("abcdefg"), std::string(PROPERTIES[3].body.begin(), PROPERTIES[3].body.end()));
+
+    ASSERT_EQ(404, PROPERTIES[4].code);
+    ASSERT_EQ(std::string("close"), getHeaderValue(PROPERTIES[4].header, HEADER_CONNECTION));
+
+    // Malformed request.
+    auto const BAD_RESPONSE = requestRaw(server.getPort(), "GET / HTTP/1.1\r\nHo st: a\r\n\r\n");
+    auto const BAD_PROPERTIES = parseResponses(BAD_RESPONSE);
+    ASSERT_EQ(1U, BAD_PROPERTIES.size());
+    ASSERT_EQ(400, BAD_PROPERTIES[0].code);
+
+    server.close();
+    ASSERT_FALSE(server.isOpen());
+}
+
+TEST(UvHttpServerTest, StaticFile)
+{
+    tttDir_Automatic();
+    std::string const CONTENT(4 * 1024 * 1024, 'x');
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::writeFile((tttDir_Get() / "test.txt").toString(), CONTENT));
+
+    UvHttpServer server;
+    UvHttpServer::Options options;
+    options.bind = "127.0.0.1";
+    options.document_root = tttDir_Get().toString();
+    ASSERT_EQ(E_SUCCESS, server.open(options, UvHttpServer::RequestMap()));
+
+    std::string const REQUEST = "GET /test.txt HTTP/1.1\r\nHost: a\r\n\r\n"
+            "HEAD /test.txt HTTP/1.1\r\nHost: a\r\n\r\n"
+            "GET /test.txt HTTP/1.1\r\nHost: a\r\n\r\n"
+            "GET /not_found.txt HTTP/1.1\r\nHost: a\r\n\r\n"
+            "GET /../test.txt HTTP/1.1\r\nHost: a\r\nConnection: close\r\n\r\n";
+    auto const RESPONSE = requestRaw(server.getPort(), REQUEST);
+
+    // The response of the HEAD request has no body.
+    HttpViewParser parser(HttpViewParser::ParserType::RESPONSE);
+    ASSERT_EQ(E_SUCCESS, parser.execute(RESPONSE.data(), RESPONSE.size()));
+    ASSERT_EQ(200, parser.getStatusCode());
+    ASSERT_EQ(std::string("text/plain; charset=utf-8"), parser.getHeader(KnownHeader::KH_CONTENT_TYPE));
+    ASSERT_EQ(CONTENT.size(), parser.getBodySize());
+    auto const REMAINING = parser.getRemaining();
+    std::string const HEAD_AND_OTHERS(REMAINING.buffer, REMAINING.buffer + REMAINING.size);
+    ASSERT_EQ(0U, HEAD_AND_OTHERS.find("HTTP/1.1 200 OK\r\n"));
+    auto const NEXT = HEAD_AND_OTHERS.find("\r\n\r\n") + 4;
+
+    auto const PROPERTIES = parseResponses(HEAD_AND_OTHERS.substr(NEXT));
+    ASSERT_EQ(3U, PROPERTIES.size());
+    ASSERT_EQ(200, PROPERTIES[0].code);
+    ASSERT_EQ(CONTENT, std::string(PROPERTIES[0].body.begin(), PROPERTIES[0].body.end()));
+    ASSERT_EQ(404, PROPERTIES[1].code);
+    ASSERT_EQ(400, PROPERTIES[2].code);
+
+    server.close();
+}
+
+/**
+ * Stop reading after the first response bytes, so the socket buffer of the server is filled.
+ */
+struct UvHttpSlowClient : public UvHttpRawClient
+{
+    std::function<void()> pause_cb;
+    bool paused = false;
+
+    UvHttpSlowClient(Loop & loop) : UvHttpRawClient(loop)
+    { /* EMPTY. */ }
+
+    void onRead(Err code, char const * buffer, std::size_t size) override
+    {
+        UvHttpRawClient::onRead(code, buffer, size);
+        if (!paused && !isClosing()) {
+            paused = true;
+            stopRead();
+            pause_cb();
+            startRead();
+        }
+    }
+};
+
+TEST(UvHttpServerTest, StaticFileOfSlowClient)
+{
+    tttDir_Automatic();
+    std::string content(16 * 1024 * 1024, '\0');
+    for (std::size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>('a' + (i % 251) % 26);
+    }
+    ASSERT_EQ(E_SUCCESS, libtbag::filesystem::writeFile((tttDir_Get() / "test.txt").toString(), content));
+
+    UvHttpServer::RequestMap requests;
+    UvHttpServer::req(requests, "/ping", [](UvHttpServer::Session & session, HttpViewParser const & request){
+        session.writeResponse(200, "pong");
+    });
+
+    for (auto const USE_SENDFILE : {true, false}) {
+        UvHttpServer server;
+        UvHttpServer::Options options;
+        options.bind = "127.0.0.1";
+        options.document_root = tttDir_Get().toString();
+        options.use_sendfile = USE_SENDFILE;
+        ASSERT_EQ(E_SUCCESS, server.open(options, requests));
+
+        // The loop thread of the server is not blocked while the client is not reading.
+        std::string ping;
+        Loop loop;
+        auto client = loop.newHandle<UvHttpSlowClient>(loop);
+        client->request = "GET /test.txt HTTP/1.1\r\nHost: a\r\nConnection: close\r\n\r\n";
+        client->pause_cb = [&](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            ping = requestRaw(server.getPort(), "GET /ping HTTP/1.1\r\nHost: a\r\nConnection: close\r\n\r\n");
+        };
+        ASSERT_EQ(E_SUCCESS, initCommonClient(*client, client->connect_req, "127.0.0.1", server.getPort()));
+        ASSERT_EQ(E_SUCCESS, loop.run());
+
+        auto const PING = parseResponses(ping);
+        ASSERT_EQ(1U, PING.size());
+        ASSERT_EQ(std::string("pong"), std::string(PING[0].body.begin(), PING[0].body.end()));
+
+        auto const PROPERTIES = parseResponses(client->response);
+        ASSERT_EQ(1U, PROPERTIES.size());
+        ASSERT_EQ(200, PROPERTIES[0].code);
+        ASSERT_TRUE(content == std::string(PROPERTIES[0].body.begin(), PROPERTIES[0].body.end()));
+        server.close();
+    }
+}
+
+TEST(UvHttpServerTest, WebSocket)
+{
+    int open_count = 0;
+    int close_count = 0;
+
+    UvHttpServer::RequestMap reqs;
+    ASSERT_TRUE(UvHttpServer::ws(reqs, "/chat", [](UvHttpServer::Session & session, WsOpCode opcode,
+                                                   char const * data, std::size_t size){
+        session.writeWs(opcode, data, size);
+    }, [&](UvHttpServer::Session & session){
+        ++open_count;
+    }, [&](UvHttpServer::Session & session){
+        ++close_count;
+    }));
+
+    UvHttpServer server;
+    UvHttpServer::Options options;
+    options.bind = "127.0.0.1";
+    ASSERT_EQ(E_SUCCESS, server.open(options, reqs));
+
+    std::string const KEY = "dGhlIHNhbXBsZSBub25jZQ==";
+    std::string request = "GET /chat HTTP/1.1\r\n"
+            "Host: server.example.com\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Key: " + KEY + "\r\n"
+            "Sec-WebSocket-Version: 13\r\n\r\n";
+
+    util::Buffer frame_buffer;
+    WsFrame frame;
+    frame.text(std::string("Hello, WebSocket!"), static_cast<uint32_t>(0x12345678));
+    frame.copyTo(frame_buffer);
+    request.append(frame_buffer.begin(), frame_buffer.end());
+    frame.close(1000, "bye");
+    frame.copyTo(frame_buffer);
+    request.append(frame_buffer.begin(), frame_buffer.end());
+
+    auto const RESPONSE = requestRaw(server.getPort(), request);
+
+    HttpViewParser parser(HttpViewParser::ParserType::RESPONSE);
+    ASSERT_EQ(E_SUCCESS, parser.execute(RESPONSE.data(), RESPONSE.size()));
+    ASSERT_EQ(101, parser.getStatusCode());
+    ASSERT_EQ(getUpgradeWebSocketKey(KEY), parser.getHeader(KnownHeader::KH_SEC_WEBSOCKET_ACCEPT));
+
+    auto const REMAINING = parser.getRemaining();
+    WsFrame echo;
+    std::size_t read_size = 0;
+    ASSERT_EQ(E_SUCCESS, echo.execute(REMAINING.buffer, REMAINING.size, &read_size));
+    ASSERT_EQ(WsOpCode::WSOC_TEXT_FRAME, echo.opcode);
+    ASSERT_FALSE(echo.mask);
+    ASSERT_EQ(std::string("Hello, WebSocket!"), echo.toPayloadString());
+
+    WsFrame close_frame;
+    ASSERT_EQ(E_SUCCESS, close_frame.execute(REMAINING.buffer + read_size, REMAINING.size - read_size));
+    ASSERT_EQ(WsOpCode::WSOC_CONNECTION_CLOSE, close_frame.opcode);
+    ASSERT_EQ(1000, close_frame.getWsStatus().code);
+
+    server.close();
+    ASSERT_EQ(1, open_count);
+    ASSERT_EQ(1, close_count);
+}
+
+TEST(UvHttpServerTest, WebSocketDeflate)
+{
+    UvHttpServer::RequestMap reqs;
+    ASSERT_TRUE(UvHttpServer::ws(reqs, "/chat", [](UvHttpServer::Session & session, WsOpCode opcode,
+                                                   char const * data, std::size_t size){
+        ASSERT_TRUE(session.isWsDeflate());
+        session.writeWs(opcode, data, size);
+    }));
+
+    UvHttpServer server;
+    UvHttpServer::Options options;
+    options.bind = "127.0.0.1";
+    options.ws_deflate = true;
+    ASSERT_EQ(E_SUCCESS, server.open(options, reqs));
+
+    std::string const MESSAGE = "Hello, Deflate! Hello, Deflate! Hello, Deflate!";
+    std::string request = "GET /chat HTTP/1.1\r\n"
+            "Host: server.example.com\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+            "Sec-WebSocket-Extensions: permessage-deflate; client_max_window_bits\r\n"
+            "Sec-WebSocket-Version: 13\r\n\r\n";
+
+    WsDeflate client;
+    ASSERT_EQ(E_SUCCESS, client.init(WsDeflateParams(), false));
+    util::Buffer frame_buffer;
+    ASSERT_EQ(E_SUCCESS, client.encodeFrame(WsOpCode::WSOC_TEXT_FRAME, MESSAGE.data(), MESSAGE.size(),
+                                            frame_buffer, 0x12345678));
+    request.append(frame_buffer.begin(), frame_buffer.end());
+    WsFrame frame;
+    frame.close(1000, "bye");
+    frame.copyTo(frame_buffer);
+    request.append(frame_buffer.begin(), frame_buffer.end());
+
+    auto const RESPONSE = requestRaw(server.getPort(), request);
+    server.close();
+
+    HttpViewParser parser(HttpViewParser::ParserType::RESPONSE);
+    ASSERT_EQ(E_SUCCESS, parser.execute(RESPONSE.data(), RESPONSE.size()));
+    ASSERT_EQ(101, parser.getStatusCode());
+    WsDeflateParams accepted;
+    ASSERT_TRUE(parseWsDeflateExtension(parser.getHeader(KnownHeader::KH_SEC_WEBSOCKET_EXTENSIONS), accepted));
+
+    auto const REMAINING = parser.getRemaining();
+    WsFrameBuffer wsbuf;
+    wsbuf.setDeflate(&client);
+    wsbuf.push(REMAINING.buffer, REMAINING.size);
+    ASSERT_TRUE(wsbuf.next());
+    ASSERT_EQ(WsOpCode::WSOC_TEXT_FRAME, wsbuf.getOpCode());
+    ASSERT_EQ(MESSAGE, std::string(wsbuf.atPayload().begin(), wsbuf.atPayload().end()));
+    ASSERT_TRUE(wsbuf.next());
+    ASSERT_EQ(WsOpCode::WSOC_CONNECTION_CLOSE, wsbuf.getOpCode());
+}
+
+TEST(UvHttpServerTest, BenchmarkOfPipelining)
+{
+    int const CONNECTIONS = 4;
+    int const DEPTH = 16;
+    int const TOTAL = 2048;
+    std::string const BODY = "__bench__";
+    std::string const REQUEST = "GET /bench HTTP/1.1\r\nHost: 127.0.0.1\r\nUser-Agent: tester\r\n\r\n";
+
+    using namespace std::chrono;
+
+    // uvpp-native server.
+    UvHttpServer::RequestMap uv_reqs;
+    UvHttpServer::req(uv_reqs, "/bench", [&](UvHttpServer::Session & session, HttpViewParser const & request){
+        session.writeResponse(200, "text/plain", BODY);
+    });
+    UvHttpServer uv_server;
+    UvHttpServer::Options uv_options;
+    uv_options.bind = "127.0.0.1";
+    ASSERT_EQ(E_SUCCESS, uv_server.open(uv_options, uv_reqs));
+
+    auto const UV_BEGIN = steady_clock::now();
+    auto const UV_RECEIVED = runLoad(uv_server.getPort(), REQUEST, CONNECTIONS, DEPTH, TOTAL);
+    auto const UV_DURATION = duration_cast<milliseconds>(steady_clock::now() - UV_BEGIN).count();
+    uv_server.close();
+    ASSERT_EQ(CONNECTIONS * TOTAL, UV_RECEIVED);
+
+    // CivetWeb server.
+#if defined(DEMO_TCP_PORT)
+    auto const CIVET_PORT = DEMO_TCP_PORT;
+#else
+    auto const CIVET_PORT = 8080;
+#endif
+    std::stringstream res_ss;
+    res_ss << "HTTP/1.1 200 OK\r\n"
+           << "Content-Type: text/plain\r\n"
+           << "Content-Length: " << BODY.size() << "\r\n"
+           << "\r\n"
+           << BODY;
+    auto const CIVET_RESPONSE = res_ss.str();
+
+    HttpServer::EventFunctional events;
+    events.get_cb = [&](HttpServer::EventFunctional::CallbackArg0 server,
+                        HttpServer::EventFunctional::CallbackArg1 conn) -> HttpServer::EventFunctional::CallbackReturn {
+        return isSuccess(HttpServer::write(conn, CIVET_RESPONSE));
+    };
+    HttpServer::Options civet_options;
+    HttpServer::opt(civet_options, HttpServer::OPT_LISTENING_PORTS,
+                    "127.0.0.1:" + libtbag::string::toString(CIVET_PORT));
+    HttpServer::opt(civet_options, HttpServer::OPT_NUM_THREADS, CONNECTIONS);
+    HttpServer::opt(civet_options, HttpServer::OPT_ENABLE_KEEP_ALIVE, true);
+    HttpServer::RequestMap civet_reqs;
+    ASSERT_TRUE(HttpServer::req(civet_reqs, "/bench", events));
+    HttpServer civet_server;
+    ASSERT_EQ(E_SUCCESS, civet_server.open(civet_options, civet_reqs));
+
+    auto const CIVET_BEGIN = steady_clock::now();
+    auto const CIVET_RECEIVED = runLoad(CIVET_PORT, REQUEST, CONNECTIONS, DEPTH, TOTAL);
+    auto const CIVET_DURATION = duration_cast<milliseconds>(steady_clock::now() - CIVET_BEGIN).count();
+    civet_server.close();
+
+    std::cout << "UvHttpServer: " << UV_RECEIVED << " responses, " << UV_DURATION << "ms / "
+              << "HttpServer(CivetWeb): " << CIVET_RECEIVED << " responses, " << CIVET_DURATION << "ms"
+              << std::endl;
+}
+
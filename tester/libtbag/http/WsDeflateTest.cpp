@@ -0,0 +1,256 @@
+/**
+ * @file   WsDeflateTest.cpp
+ * @brief  WsDeflate class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/http/WsDeflate.hpp>
+#include <libtbag/http/WsFrameBuffer.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::http;
+
+static std::string toString(util::Buffer const & buffer)
+{
+    return std::string(buffer.begin(), buffer.end());
+}
+
+TEST(WsDeflateTest, Negotiate)
+{
+    WsDeflateParams params;
+    ASSERT_FALSE(parseWsDeflateExtension("x-webkit-deflate-frame", params));
+    ASSERT_FALSE(parseWsDeflateExtension("permessage-deflate; unknown_param", params));
+    ASSERT_FALSE(parseWsDeflateExtension("permessage-deflate; server_max_window_bits=16", params));
+    ASSERT_FALSE(parseWsDeflateExtension("permessage-deflate; server_no_context_takeover; server_no_context_takeover", params));
+
+    ASSERT_TRUE(parseWsDeflateExtension("permessage-deflate; client_max_window_bits; server_max_window_bits=\"10\"", params));
+    ASSERT_TRUE(params.client_max_window_bits_offered);
+    ASSERT_EQ(15, params.client_max_window_bits);
+    ASSERT_EQ(10, params.server_max_window_bits);
+    ASSERT_FALSE(params.server_no_context_takeover);
+
+    // The first acceptable offer is selected.
+    WsDeflateParams config;
+    config.client_no_context_takeover = true;
+    config.client_max_window_bits = 12;
+    WsDeflateParams accepted;
+    ASSERT_TRUE(negotiateWsDeflate("permessage-deflate; server_max_window_bits=8, "
+                                   "permessage-deflate; client_max_window_bits; server_no_context_takeover",
+                                   config, accepted));
+    ASSERT_TRUE(accepted.server_no_context_takeover);
+    ASSERT_TRUE(accepted.client_no_context_takeover);
+    ASSERT_EQ(15, accepted.server_max_window_bits);
+    ASSERT_EQ(12, accepted.client_max_window_bits);
+    ASSERT_EQ(std::string("permessage-deflate; server_no_context_takeover; client_no_context_takeover; "
+                          "client_max_window_bits=12"), toWsDeflateResponse(accepted));
+
+    ASSERT_FALSE(negotiateWsDeflate("permessage-deflate; server_max_window_bits=8", config, accepted));
+
+    // Client side.
+    HttpHeaders request;
+    updateWsDeflateRequest(request, WsDeflateParams());
+    ASSERT_EQ(std::string("permessage-deflate; client_max_window_bits"),
+              getHeaderValue(request, HEADER_SEC_WEBSOCKET_EXTENSIONS));
+    ASSERT_TRUE(negotiateWsDeflate(request, config, accepted));
+
+    HttpHeaders response;
+    updateWsDeflateResponse(response, accepted);
+    WsDeflateParams client_accepted;
+    ASSERT_TRUE(checkWsDeflateResponse(response, client_accepted));
+    ASSERT_TRUE(client_accepted.client_no_context_takeover);
+    ASSERT_EQ(12, client_accepted.client_max_window_bits);
+}
+
+TEST(WsDeflateTest, Rfc7692Example)
+{
+    // RFC 7692, 7.2.3.1. A Message Compressed Using One Compressed Deflate Block
+    char const COMPRESSED[] = { '\xf2', '\x48', '\xcd', '\xc9', '\xc9', '\x07', '\x00' };
+
+    WsDeflate client;
+    ASSERT_EQ(E_SUCCESS, client.init(WsDeflateParams(), false));
+
+    util::Buffer output;
+    ASSERT_EQ(E_SUCCESS, client.decompress(COMPRESSED, sizeof(COMPRESSED), output));
+    ASSERT_EQ(std::string("Hello"), toString(output));
+
+    // The same message again with the context takeover. (7.2.3.2)
+    char const COMPRESSED2[] = { '\xf2', '\x00', '\x11', '\x00', '\x00' };
+    ASSERT_EQ(E_SUCCESS, client.decompress(COMPRESSED2, sizeof(COMPRESSED2), output));
+    ASSERT_EQ(std::string("Hello"), toString(output));
+}
+
+TEST(WsDeflateTest, ContextTakeover)
+{
+    std::string const MESSAGE = "{\"symbol\":\"AAPL\",\"bid\":189.91,\"ask\":189.93,\"volume\":1200}";
+
+    WsDeflateParams params;
+    WsDeflate server;
+    WsDeflate client;
+    ASSERT_EQ(E_SUCCESS, server.init(params, true));
+    ASSERT_EQ(E_SUCCESS, client.init(params, false));
+
+    util::Buffer compressed;
+    util::Buffer decompressed;
+    ASSERT_EQ(E_SUCCESS, server.compress(MESSAGE.data(), MESSAGE.size(), compressed));
+    auto const FIRST_SIZE = compressed.size();
+    ASSERT_EQ(E_SUCCESS, client.decompress(compressed.data(), compressed.size(), decompressed));
+    ASSERT_EQ(MESSAGE, toString(decompressed));
+
+    // The second message refers to the first one.
+    ASSERT_EQ(E_SUCCESS, server.compress(MESSAGE.data(), MESSAGE.size(), compressed));
+    ASSERT_GT(FIRST_SIZE, compressed.size());
+    ASSERT_EQ(E_SUCCESS, client.decompress(compressed.data(), compressed.size(), decompressed));
+    ASSERT_EQ(MESSAGE, toString(decompressed));
+
+    // No context takeover.
+    params.server_no_context_takeover = true;
+    WsDeflate server2;
+    ASSERT_EQ(E_SUCCESS, server2.init(params, true));
+    ASSERT_EQ(E_SUCCESS, server2.compress(MESSAGE.data(), MESSAGE.size(), compressed));
+    ASSERT_EQ(FIRST_SIZE, compressed.size());
+    ASSERT_EQ(E_SUCCESS, server2.compress(MESSAGE.data(), MESSAGE.size(), compressed));
+    ASSERT_EQ(FIRST_SIZE, compressed.size());
+
+    // Empty message.
+    ASSERT_EQ(E_SUCCESS, server.compress(nullptr, 0, compressed));
+    ASSERT_EQ(1U, compressed.size());
+    ASSERT_EQ(E_SUCCESS, client.decompress(compressed.data(), compressed.size(), decompressed));
+    ASSERT_TRUE(decompressed.empty());
+
+    // Broken data.
+    char const BROKEN[] = { '\xff', '\xff', '\xff', '\xff' };
+    ASSERT_EQ(E_DECOMPRESSION_FAILED, client.decompress(BROKEN, sizeof(BROKEN), decompressed));
+}
+
+TEST(WsDeflateTest, MaxMessageSize)
+{
+    std::string const MESSAGE(1024 * 1024, 'a');
+
+    WsDeflate server;
+    WsDeflate client;
+    ASSERT_EQ(E_SUCCESS, server.init(WsDeflateParams(), true));
+    ASSERT_EQ(E_SUCCESS, client.init(WsDeflateParams(), false));
+
+    util::Buffer compressed;
+    util::Buffer decompressed;
+    ASSERT_EQ(E_SUCCESS, server.compress(MESSAGE.data(), MESSAGE.size(), compressed));
+    ASSERT_GT(MESSAGE.size() / 100, compressed.size());
+    ASSERT_EQ(E_DATA_TOO_LARGE, client.decompress(compressed.data(), compressed.size(), decompressed, 1024));
+}
+
+TEST(WsDeflateTest, Broadcast)
+{
+    std::string const MESSAGE1 = "broadcast message: tick 1";
+    std::string const MESSAGE2 = "broadcast message: tick 2";
+
+    WsDeflateParams broadcast_params;
+    broadcast_params.server_no_context_takeover = true;
+    WsDeflate broadcaster;
+    ASSERT_EQ(E_SUCCESS, broadcaster.init(broadcast_params, true));
+
+    // The clients negotiated the context takeover.
+    WsDeflate client1_inflater;
+    WsDeflate client2_inflater;
+    ASSERT_EQ(E_SUCCESS, client1_inflater.init(WsDeflateParams(), false));
+    ASSERT_EQ(E_SUCCESS, client2_inflater.init(WsDeflateParams(), false));
+    WsFrameBuffer client1;
+    WsFrameBuffer client2;
+    client1.setDeflate(&client1_inflater);
+    client2.setDeflate(&client2_inflater);
+
+    util::Buffer frame;
+    ASSERT_EQ(E_SUCCESS, broadcaster.encodeFrame(WsOpCode::WSOC_TEXT_FRAME, MESSAGE1.data(), MESSAGE1.size(), frame));
+    ASSERT_EQ(0x40, frame[0] & 0x40); // RSV1
+    client1.push(frame.data(), frame.size());
+    ASSERT_TRUE(client1.next());
+    ASSERT_EQ(MESSAGE1, toString(client1.atPayload()));
+
+    // The client2 joins late, but the same frame is decoded.
+    ASSERT_EQ(E_SUCCESS, broadcaster.encodeFrame(WsOpCode::WSOC_TEXT_FRAME, MESSAGE2.data(), MESSAGE2.size(), frame));
+    client1.push(frame.data(), frame.size());
+    client2.push(frame.data(), frame.size());
+    ASSERT_TRUE(client1.next());
+    ASSERT_TRUE(client2.next());
+    ASSERT_EQ(MESSAGE2, toString(client1.atPayload()));
+    ASSERT_EQ(MESSAGE2, toString(client2.atPayload()));
+
+    ASSERT_EQ(E_ILLARGS, broadcaster.encodeFrame(WsOpCode::WSOC_DENOTES_PING, nullptr, 0, frame));
+}
+
+TEST(WsDeflateTest, Dictionary)
+{
+    std::string const DICTIONARY = "\"symbol\":\"\",\"bid\":,\"ask\":,\"volume\":";
+    std::string const MESSAGE = "{\"symbol\":\"MSFT\",\"bid\":410.1,\"ask\":410.2,\"volume\":10}";
+
+    WsDeflateParams params;
+    params.server_no_context_takeover = true;
+    params.client_no_context_takeover = true;
+
+    WsDeflate plain;
+    WsDeflate server;
+    WsDeflate client;
+    ASSERT_EQ(E_SUCCESS, plain.init(params, true));
+    ASSERT_EQ(E_SUCCESS, server.init(params, true));
+    ASSERT_EQ(E_SUCCESS, client.init(params, false));
+    ASSERT_EQ(E_SUCCESS, server.setDictionary(DICTIONARY.data(), DICTIONARY.size()));
+    ASSERT_EQ(E_SUCCESS, client.setDictionary(DICTIONARY.data(), DICTIONARY.size()));
+
+    util::Buffer plain_compressed;
+    util::Buffer compressed;
+    util::Buffer decompressed;
+    ASSERT_EQ(E_SUCCESS, plain.compress(MESSAGE.data(), MESSAGE.size(), plain_compressed));
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(E_SUCCESS, server.compress(MESSAGE.data(), MESSAGE.size(), compressed));
+        ASSERT_GT(plain_compressed.size(), compressed.size());
+        ASSERT_EQ(E_SUCCESS, client.decompress(compressed.data(), compressed.size(), decompressed));
+        ASSERT_EQ(MESSAGE, toString(decompressed));
+    }
+}
+
+TEST(WsDeflateTest, FragmentedMessage)
+{
+    std::string const MESSAGE = "Fragmented and compressed message. Fragmented and compressed message.";
+
+    WsDeflate client;
+    WsDeflate server;
+    ASSERT_EQ(E_SUCCESS, client.init(WsDeflateParams(), false));
+    ASSERT_EQ(E_SUCCESS, server.init(WsDeflateParams(), true));
+
+    util::Buffer compressed;
+    ASSERT_EQ(E_SUCCESS, client.compress(MESSAGE.data(), MESSAGE.size(), compressed));
+    ASSERT_LT(4U, compressed.size());
+    auto const HALF = compressed.size() / 2;
+
+    util::Buffer stream;
+    util::Buffer temp;
+    WsFrame frame;
+    frame.set(false, true, false, false, WsOpCode::WSOC_TEXT_FRAME, compressed.data(), HALF, 0x01020304);
+    frame.copyTo(temp);
+    stream.insert(stream.end(), temp.begin(), temp.end());
+    frame.ping(std::string("PING"), 0x05060708);
+    frame.copyTo(temp);
+    stream.insert(stream.end(), temp.begin(), temp.end());
+    frame.set(true, false, false, false, WsOpCode::WSOC_CONTINUATION_FRAME,
+              compressed.data() + HALF, compressed.size() - HALF, 0x090A0B0C);
+    frame.copyTo(temp);
+    stream.insert(stream.end(), temp.begin(), temp.end());
+
+    WsFrameBuffer wsbuf;
+    wsbuf.setDeflate(&server);
+    wsbuf.push(stream.data(), stream.size());
+
+    Err code = E_UNKNOWN;
+    ASSERT_FALSE(wsbuf.next(&code));
+    ASSERT_EQ(E_CONTINUE, code);
+    ASSERT_TRUE(wsbuf.next(&code));
+    ASSERT_EQ(WsOpCode::WSOC_DENOTES_PING, wsbuf.getOpCode());
+    ASSERT_EQ(std::string("PING"), toString(wsbuf.atPayload()));
+    ASSERT_TRUE(wsbuf.next(&code));
+    ASSERT_EQ(WsOpCode::WSOC_TEXT_FRAME, wsbuf.getOpCode());
+    ASSERT_EQ(MESSAGE, toString(wsbuf.atPayload()));
+}
@@ -83,3 +83,68 @@ TEST(WsFrameBufferTest, SplitPayload)
     ASSERT_EQ(WsOpCode::WSOC_TEXT_FRAME, opcode_result);
 }
 
+
+TEST(WsFrameBufferTest, ControlFrameBetweenFragments)
+{
+    WsFrame frame;
+    util::Buffer stream;
+    util::Buffer temp;
+
+    frame.text(std::string("Hello, "), static_cast<uint32_t>(0x11223344), false);
+    frame.copyTo(temp);
+    stream.insert(stream.end(), temp.begin(), temp.end());
+
+    frame.ping(std::string("PING"), 0x55667788);
+    frame.copyTo(temp);
+    stream.insert(stream.end(), temp.begin(), temp.end());
+
+    frame.set(true, false, false, false, WsOpCode::WSOC_CONTINUATION_FRAME, "World", 5, 0x99AABBCC);
+    frame.copyTo(temp);
+    stream.insert(stream.end(), temp.begin(), temp.end());
+
+    WsFrameBuffer wsbuf;
+    std::vector<WsOpCode> opcodes;
+    std::vector<std::string> payloads;
+
+    // Feed the data byte by byte.
+    for (auto c : stream) {
+        wsbuf.push(&c, 1);
+        while (wsbuf.next()) {
+            opcodes.push_back(wsbuf.getOpCode());
+            payloads.emplace_back(wsbuf.atPayload().begin(), wsbuf.atPayload().end());
+        }
+    }
+
+    ASSERT_EQ(2U, opcodes.size());
+    ASSERT_EQ(WsOpCode::WSOC_DENOTES_PING, opcodes[0]);
+    ASSERT_EQ(std::string("PING"), payloads[0]);
+    ASSERT_EQ(WsOpCode::WSOC_TEXT_FRAME, opcodes[1]);
+    ASSERT_EQ(std::string("Hello, World"), payloads[1]);
+}
+
+TEST(WsFrameBufferTest, ManyFrames)
+{
+    std::size_t const FRAME_COUNT = 1000;
+
+    WsFrame frame;
+    util::Buffer stream;
+    util::Buffer temp;
+    for (std::size_t i = 0; i < FRAME_COUNT; ++i) {
+        frame.text(std::to_string(i), static_cast<uint32_t>(i + 1));
+        frame.copyTo(temp);
+        stream.insert(stream.end(), temp.begin(), temp.end());
+    }
+
+    WsFrameBuffer wsbuf;
+    wsbuf.push(stream.data(), stream.size());
+
+    std::size_t hit_count = 0;
+    Err code = E_UNKNOWN;
+    while (wsbuf.next(&code)) {
+        ASSERT_EQ(WsOpCode::WSOC_TEXT_FRAME, wsbuf.getOpCode());
+        ASSERT_EQ(std::to_string(hit_count), std::string(wsbuf.atPayload().begin(), wsbuf.atPayload().end()));
+        ++hit_count;
+    }
+    ASSERT_EQ(E_SMALLBUF, code);
+    ASSERT_EQ(FRAME_COUNT, hit_count);
+}
@@ -141,6 +141,33 @@ TEST(WsFrameTest, TextRequest)
     ASSERT_EQ(TEST_TEXT, receiver.toPayloadString());
 }
 
+TEST(WsFrameTest, ExecuteInPlace)
+{
+    uint8_t const REQUEST_FRAME[] = {0x81, 0x9c, 0x6c, 0x11, 0xe8, 0xe3, 0x3e, 0x7e,
+                                     0x8b, 0x88, 0x4c, 0x78, 0x9c, 0xc3, 0x1b, 0x78,
+                                     0x9c, 0x8b, 0x4c, 0x59, 0xbc, 0xae, 0x20, 0x24,
+                                     0xc8, 0xb4, 0x09, 0x73, 0xbb, 0x8c, 0x0f, 0x7a,
+                                     0x8d, 0x97};
+    std::string const RESULT_STRING = "Rock it with HTML5 WebSocket";
+    std::vector<char> buffer(REQUEST_FRAME, REQUEST_FRAME + sizeof(REQUEST_FRAME));
+
+    WsFrame frame;
+    util::binf view;
+    std::size_t read_size = 0;
+    ASSERT_EQ(E_SMALLBUF, frame.executeInPlace(buffer.data(), buffer.size() - 1, &view, &read_size));
+    ASSERT_EQ(E_SUCCESS, frame.executeInPlace(buffer.data(), buffer.size(), &view, &read_size));
+    ASSERT_EQ(sizeof(REQUEST_FRAME), read_size);
+    ASSERT_EQ(WsOpCode::WSOC_TEXT_FRAME, frame.opcode);
+    ASSERT_TRUE(frame.fin);
+    ASSERT_TRUE(frame.mask);
+    ASSERT_EQ(RESULT_STRING.size(), frame.getPayloadSize());
+    ASSERT_TRUE(frame.payload.empty());
+
+    // The view points to the unmasked input buffer.
+    ASSERT_EQ(buffer.data() + 6, view.buffer);
+    ASSERT_EQ(RESULT_STRING, std::string(view.buffer, view.buffer + view.size));
+}
+
 TEST(WsFrameTest, TextResponse)
 {
     WsFrame sender;
@@ -3,11 +3,14 @@
  * @brief  Uuid class tester.
  * @author zer0
  * @date   2017-07-01
+ * @date   2026-10-19 (Add the tests of the version 4 batch & version 7)
  */
 
 #include <gtest/gtest.h>
 #include <libtbag/id/Uuid.hpp>
 #include <libtbag/string/StringUtils.hpp>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
 using namespace libtbag;
@@ -38,3 +41,45 @@ TEST(UuidTest, Default)
     std::cout << "UUID Version4 [2]: " << uuid5.toString() << std::endl;
 }
 
+
+TEST(UuidTest, Version4Batch)
+{
+    auto const UUIDS = Uuid::ver4(1000);
+    ASSERT_EQ(1000u, UUIDS.size());
+    for (auto const & uuid : UUIDS) {
+        ASSERT_EQ(0x40, uuid.id.data[6] & 0xF0);
+        ASSERT_EQ(0x80, uuid.id.clock_seq_hi_and_reserved & 0xC0);
+    }
+    ASSERT_NE(UUIDS[0], UUIDS[1]);
+    ASSERT_NE(UUIDS[0], UUIDS[999]);
+
+    auto copy = UUIDS[0];
+    Uuid parsed;
+    ASSERT_EQ(E_SUCCESS, parsed.fromString(copy.toString()));
+    ASSERT_EQ(UUIDS[0], parsed);
+}
+
+TEST(UuidTest, Version7)
+{
+    using namespace std::chrono;
+    auto const NOW = static_cast<uint64_t>(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+
+    auto const UUIDS = Uuid::ver7(10000);
+    ASSERT_EQ(10000u, UUIDS.size());
+    for (std::size_t i = 0; i < UUIDS.size(); ++i) {
+        ASSERT_EQ(0x70, UUIDS[i].id.data[6] & 0xF0);
+        ASSERT_EQ(0x80, UUIDS[i].id.clock_seq_hi_and_reserved & 0xC0);
+        if (i > 0) {
+            // Lexicographically sortable.
+            ASSERT_LT(::memcmp(UUIDS[i - 1].id.data, UUIDS[i].id.data, Uuid::BYTE_SIZE), 0);
+        }
+    }
+    ASSERT_LE(NOW, UUIDS[0].getVersion7Time());
+    ASSERT_GE(NOW + 1000, UUIDS[0].getVersion7Time());
+
+    auto const UUID1 = Uuid::ver7();
+    auto const UUID2 = Uuid::ver7();
+    ASSERT_LT(::memcmp(UUIDS.back().id.data, UUID1.id.data, Uuid::BYTE_SIZE), 0);
+    ASSERT_LT(::memcmp(UUID1.id.data, UUID2.id.data, Uuid::BYTE_SIZE), 0);
+    std::cout << "UUID Version7: " << UUID1.toString() << std::endl;
+}
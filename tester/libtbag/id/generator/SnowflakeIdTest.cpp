@@ -0,0 +1,148 @@
+/**
+ * @file   SnowflakeIdTest.cpp
+ * @brief  SnowflakeId class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the MaxLead test)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/id/generator/SnowflakeId.hpp>
+#include <libtbag/id/generator/TimeId.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::id;
+using namespace libtbag::id::generator;
+
+TEST(SnowflakeIdTest, Default)
+{
+    using namespace std::chrono;
+    auto const NOW = static_cast<uint64_t>(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+
+    SnowflakeGenerator generator(123);
+    auto const ID1 = generator.gen();
+    auto const ID2 = generator.gen();
+    ASSERT_LT(ID1, ID2);
+    ASSERT_EQ(123u, SnowflakeGenerator::getNode(ID1));
+    ASSERT_EQ(123u, SnowflakeGenerator::getNode(ID2));
+    ASSERT_LE(NOW, generator.getTime(ID1));
+    ASSERT_GE(NOW + 1000, generator.getTime(ID1));
+
+    SnowflakeGenerator::Block block;
+    auto prev = generator.gen(block);
+    ASSERT_LT(ID2, prev);
+    for (int i = 0; i < 10000; ++i) {
+        auto const ID = generator.gen(block);
+        ASSERT_LT(prev, ID);
+        prev = ID;
+    }
+}
+
+TEST(SnowflakeIdTest, Borrow)
+{
+    // More than 4096 IDs in a millisecond borrow the next milliseconds.
+    SnowflakeGenerator generator;
+    std::vector<SnowflakeId> ids(100000);
+    for (auto & id : ids) {
+        id = generator.gen();
+    }
+    for (std::size_t i = 1; i < ids.size(); ++i) {
+        ASSERT_LT(ids[i - 1], ids[i]);
+    }
+}
+
+TEST(SnowflakeIdTest, MaxLead)
+{
+    using namespace std::chrono;
+    auto const now = [](){
+        return static_cast<uint64_t>(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+    };
+
+    std::size_t const THREAD_COUNT = 4;
+    std::size_t const ID_COUNT = 200000;
+
+    SnowflakeGenerator generator;
+    std::atomic<uint64_t> max_lead(0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&, t](){
+            SnowflakeGenerator::Block block;
+            uint64_t lead = 0;
+            for (std::size_t i = 0; i < ID_COUNT; ++i) {
+                auto const ID = (t % 2 == 0) ? generator.gen(block) : generator.gen();
+                auto const TIME = generator.getTime(ID);
+                auto const NOW = now();
+                if (TIME > NOW) {
+                    lead = std::max(lead, TIME - NOW);
+                }
+            }
+            auto current = max_lead.load();
+            while (current < lead && !max_lead.compare_exchange_weak(current, lead)) {
+                // EMPTY.
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    std::cout << "Max lead: " << max_lead.load() << "ms" << std::endl;
+    ASSERT_TRUE(max_lead.load() <= SnowflakeGenerator::MAX_LEAD_MILLISEC);
+}
+
+TEST(SnowflakeIdTest, GenTimeId)
+{
+    // Strictly increasing without the spin-wait.
+    auto prev = genTimeId();
+    for (int i = 0; i < 10000; ++i) {
+        auto const ID = genTimeId();
+        ASSERT_LT(prev, ID);
+        prev = ID;
+    }
+}
+
+TEST(SnowflakeIdTest, StressOfThreads)
+{
+    std::size_t const THREAD_COUNT = 8;
+    std::size_t const ID_COUNT = 1000000;
+
+    std::vector<std::vector<SnowflakeId>> ids(THREAD_COUNT);
+    for (auto & v : ids) {
+        v.resize(ID_COUNT);
+    }
+
+    using namespace std::chrono;
+    auto const BEGIN = system_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&ids, t](){
+            for (auto & id : ids[t]) {
+                id = genSnowflakeId();
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    auto const DURATION = duration_cast<milliseconds>(system_clock::now() - BEGIN).count();
+    std::cout << "Generate " << (THREAD_COUNT * ID_COUNT) << " IDs with " << THREAD_COUNT
+              << " threads: " << DURATION << "ms" << std::endl;
+
+    std::vector<SnowflakeId> all;
+    all.reserve(THREAD_COUNT * ID_COUNT);
+    for (auto const & v : ids) {
+        for (std::size_t i = 1; i < v.size(); ++i) {
+            ASSERT_LT(v[i - 1], v[i]);
+        }
+        all.insert(all.end(), v.begin(), v.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
@@ -0,0 +1,103 @@
+/**
+ * @file   MpScQueueTest.cpp
+ * @brief  MpScQueue class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/lockfree/MpScQueue.hpp>
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::lockfree;
+
+namespace __impl {
+
+struct TestNode : public MpScQueue::Node
+{
+    int producer = 0;
+    int value = 0;
+};
+
+} // namespace __impl
+
+TEST(MpScQueueTest, Default)
+{
+    using namespace __impl;
+    MpScQueue queue;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(nullptr, queue.pop());
+
+    TestNode nodes[3];
+    for (int i = 0; i < 3; ++i) {
+        nodes[i].value = i;
+        queue.push(&nodes[i]);
+    }
+    ASSERT_FALSE(queue.empty());
+
+    for (int i = 0; i < 3; ++i) {
+        auto * node = static_cast<TestNode*>(queue.pop());
+        ASSERT_NE(nullptr, node);
+        ASSERT_EQ(i, node->value);
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(nullptr, queue.pop());
+
+    // Reuse the popped node.
+    queue.push(&nodes[0]);
+    ASSERT_EQ(&nodes[0], queue.pop());
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(MpScQueueTest, MultiProducer)
+{
+    using namespace __impl;
+    int const PRODUCER_COUNT = 8;
+    int const NODE_COUNT = 10000;
+
+    std::vector<TestNode> nodes(PRODUCER_COUNT * NODE_COUNT);
+    MpScQueue queue;
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < PRODUCER_COUNT; ++i) {
+        producers.emplace_back([&, i](){
+            for (int j = 0; j < NODE_COUNT; ++j) {
+                auto & node = nodes[i * NODE_COUNT + j];
+                node.producer = i;
+                node.value = j;
+                queue.push(&node);
+            }
+        });
+    }
+
+    // The order of each producer must be preserved.
+    std::vector<int> next_values(PRODUCER_COUNT, 0);
+    int total = 0;
+    while (total < PRODUCER_COUNT * NODE_COUNT) {
+        auto * node = static_cast<TestNode*>(queue.pop());
+        if (node == nullptr) {
+            continue;
+        }
+        ASSERT_EQ(next_values[node->producer], node->value);
+        ++next_values[node->producer];
+        ++total;
+    }
+
+    for (auto & producer : producers) {
+        producer.join();
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(nullptr, queue.pop());
+}
+
+TEST(MpScQueueTest, Layout)
+{
+    // The plain new operator must be able to allocate the queue.
+    ASSERT_TRUE(alignof(MpScQueue) <= alignof(std::max_align_t));
+    ASSERT_TRUE(sizeof(MpScQueue) >= 2 * MpScQueue::CACHE_LINE_SIZE);
+}
+
@@ -0,0 +1,265 @@
+/**
+ * @file   BoxPubSubTest.cpp
+ * @brief  BoxPubSub class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the tests of the linger thread and the bounded decompression)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/mq/BoxPubSub.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace libtbag;
+using namespace libtbag::mq;
+using namespace libtbag::box;
+
+TEST(BoxPubSubTest, BatchEncodeAndDecode)
+{
+    BoxBatch::Builder builder;
+    BoxBatch batch;
+    ASSERT_TRUE(batch.empty());
+
+    Box box1 = {{11, 22}};
+    Box box2 = {{33, 44, 55}};
+    box2.setInfo("INFO");
+    ASSERT_EQ(E_SUCCESS, batch.append(builder, box1));
+    ASSERT_EQ(E_SUCCESS, batch.append(builder, box2));
+    ASSERT_EQ(2, batch.count());
+
+    NngMsg msg;
+    ASSERT_EQ(E_SUCCESS, batch.encode("topic/a", msg));
+
+    std::string topic;
+    BoxBatch::Boxes boxes;
+    BoxBatch::Parser parser;
+    ASSERT_EQ(E_SUCCESS, BoxBatch::decode(msg.body(), msg.size(), parser, topic, boxes));
+    ASSERT_EQ(std::string("topic/a"), topic);
+    ASSERT_EQ(2, boxes.size());
+    ASSERT_EQ(2, boxes[0].size());
+    ASSERT_EQ(11, boxes[0].offset<si32>(0));
+    ASSERT_EQ(22, boxes[0].offset<si32>(1));
+    ASSERT_EQ(3, boxes[1].size());
+    ASSERT_EQ(55, boxes[1].offset<si32>(2));
+    ASSERT_EQ(std::string("INFO"), boxes[1].getInfoString());
+
+    // Broken magic number.
+    static_cast<char*>(msg.body())[topic.size() + 1] ^= 0xFF;
+    boxes.clear();
+    ASSERT_EQ(E_PARSING, BoxBatch::decode(msg.body(), msg.size(), parser, topic, boxes));
+}
+
+TEST(BoxPubSubTest, BatchCompression)
+{
+    BoxBatch::Builder builder;
+    BoxBatch batch;
+
+    Box box;
+    ASSERT_EQ(E_SUCCESS, box.resize<si32>(1024));
+    box.fill<si32>(7);
+    ASSERT_EQ(E_SUCCESS, batch.append(builder, box));
+    ASSERT_EQ(E_SUCCESS, batch.append(builder, box));
+
+    NngMsg raw_msg;
+    ASSERT_EQ(E_SUCCESS, batch.encode("z", raw_msg));
+    NngMsg compressed_msg;
+    ASSERT_EQ(E_SUCCESS, batch.encode("z", compressed_msg, 6, 0));
+    ASSERT_LT(compressed_msg.size(), raw_msg.size());
+
+    std::string topic;
+    BoxBatch::Boxes boxes;
+    ASSERT_EQ(E_SUCCESS, BoxBatch::decode(compressed_msg.body(), compressed_msg.size(),
+                                          BoxBatch::Parser(), topic, boxes));
+    ASSERT_EQ(2, boxes.size());
+    ASSERT_EQ(1024, boxes[1].size());
+    ASSERT_EQ(7, boxes[1].offset<si32>(1023));
+}
+
+TEST(BoxPubSubTest, BatchDecompressionLimit)
+{
+    BoxBatch::Builder builder;
+    BoxBatch batch;
+
+    Box box;
+    ASSERT_EQ(E_SUCCESS, box.resize<si32>(64 * 1024));
+    box.fill<si32>(0);
+    ASSERT_EQ(E_SUCCESS, batch.append(builder, box));
+
+    NngMsg msg;
+    ASSERT_EQ(E_SUCCESS, batch.encode("z", msg, 9, 0));
+    auto * raw_size = static_cast<uint8_t*>(msg.body()) + 2 + 12;
+
+    // The payload inflates beyond the raw payload size.
+    uint8_t const SMALL_SIZE[] = {0x00, 0x00, 0x01, 0x00};
+    memcpy(raw_size, SMALL_SIZE, sizeof(SMALL_SIZE));
+    std::string topic;
+    BoxBatch::Boxes boxes;
+    ASSERT_EQ(E_PARSING, BoxBatch::decode(msg.body(), msg.size(), BoxBatch::Parser(), topic, boxes));
+
+    // The raw payload size exceeds the limit.
+    uint8_t const LARGE_SIZE[] = {0x7F, 0xFF, 0xFF, 0xFF};
+    memcpy(raw_size, LARGE_SIZE, sizeof(LARGE_SIZE));
+    ASSERT_EQ(E_PARSING, BoxBatch::decode(msg.body(), msg.size(), BoxBatch::Parser(), topic, boxes));
+    ASSERT_TRUE(boxes.empty());
+}
+
+TEST(BoxPubSubTest, InprocFastPath)
+{
+    std::string const URL = "inproc://box_pub_sub_fast_path";
+
+    BoxPublisher pub;
+    ASSERT_EQ(E_SUCCESS, pub.open(URL));
+    ASSERT_TRUE(pub.isFastPath());
+
+    BoxSubscriber sub1;
+    BoxSubscriber sub2;
+    ASSERT_EQ(E_SUCCESS, sub1.open(URL));
+    ASSERT_EQ(E_SUCCESS, sub2.open(URL));
+    ASSERT_TRUE(sub1.isFastPath());
+    ASSERT_EQ(E_SUCCESS, sub1.subscribe("sensor/"));
+    ASSERT_EQ(E_SUCCESS, sub2.subscribe("log/"));
+
+    Box box = {{1, 2, 3}};
+    ASSERT_EQ(E_SUCCESS, pub.publish("sensor/temperature", box));
+
+    std::string topic;
+    Box result;
+    ASSERT_EQ(E_SUCCESS, sub1.recv(topic, result, 1000));
+    ASSERT_EQ(std::string("sensor/temperature"), topic);
+    ASSERT_EQ(box.data(), result.data()); // Same memory.
+    ASSERT_EQ(E_TIMEOUT, sub2.recv(topic, result, 10));
+
+    // The default timeout is used for the DURATION_DEFAULT.
+    sub1.setDefaultRecvTimeout(1000);
+    std::thread publish_thread([&](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        pub.publish("sensor/humidity", box);
+    });
+    ASSERT_EQ(E_SUCCESS, sub1.recv(topic, result, NngSocket::DURATION_DEFAULT));
+    ASSERT_EQ(std::string("sensor/humidity"), topic);
+    publish_thread.join();
+
+    ASSERT_EQ(E_SUCCESS, sub1.close());
+    ASSERT_EQ(E_SUCCESS, sub2.close());
+    ASSERT_EQ(E_SUCCESS, pub.close());
+}
+
+TEST(BoxPubSubTest, NngTransport)
+{
+    std::string const URL = "inproc://box_pub_sub_nng";
+
+    BoxPublisher::Options options;
+    options.inproc_fast_path = false;
+    options.max_batch_count = 4;
+    options.linger_ms = 1000;
+
+    BoxPublisher pub;
+    ASSERT_EQ(E_SUCCESS, pub.open(URL, options));
+    ASSERT_FALSE(pub.isFastPath());
+
+    BoxSubscriber sub;
+    ASSERT_EQ(E_SUCCESS, sub.open(URL, false));
+    ASSERT_FALSE(sub.isFastPath());
+    ASSERT_EQ(E_SUCCESS, sub.subscribe("a/"));
+
+    // Wait for the subscription to reach the publisher.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    int const TEST_COUNT = 10;
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        Box box = {{i}};
+        ASSERT_EQ(E_SUCCESS, pub.publish("a/value", box));
+        ASSERT_EQ(E_SUCCESS, pub.publish("b/value", box));
+    }
+    ASSERT_EQ(E_SUCCESS, pub.flush());
+
+    std::string topic;
+    Box result;
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, sub.recv(topic, result, 1000));
+        ASSERT_EQ(std::string("a/value"), topic);
+        ASSERT_EQ(i, result.offset<si32>(0));
+    }
+    ASSERT_EQ(E_TIMEOUT, sub.recv(topic, result, 10));
+
+    ASSERT_EQ(E_SUCCESS, sub.close());
+    ASSERT_EQ(E_SUCCESS, pub.close());
+}
+
+TEST(BoxPubSubTest, LingerWithoutFlush)
+{
+    std::string const URL = "inproc://box_pub_sub_linger";
+
+    BoxPublisher::Options options;
+    options.inproc_fast_path = false;
+    options.linger_ms = 10;
+
+    BoxPublisher pub;
+    ASSERT_EQ(E_SUCCESS, pub.open(URL, options));
+    BoxSubscriber sub;
+    ASSERT_EQ(E_SUCCESS, sub.open(URL, false));
+    ASSERT_EQ(E_SUCCESS, sub.subscribe("idle/"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // The topic goes quiet after one box.
+    Box box = {{7}};
+    ASSERT_EQ(E_SUCCESS, pub.publish("idle/value", box));
+
+    std::string topic;
+    Box result;
+    ASSERT_EQ(E_SUCCESS, sub.recv(topic, result, 1000));
+    ASSERT_EQ(std::string("idle/value"), topic);
+    ASSERT_EQ(7, result.offset<si32>(0));
+
+    ASSERT_EQ(E_SUCCESS, sub.close());
+    ASSERT_EQ(E_SUCCESS, pub.close());
+}
+
+TEST(BoxPubSubTest, BenchmarkOfSmallBoxes)
+{
+    std::string const URL = "inproc://box_pub_sub_benchmark";
+
+    BoxPublisher::Options options;
+    options.inproc_fast_path = false;
+    options.linger_ms = 1000;
+
+    BoxPublisher pub;
+    ASSERT_EQ(E_SUCCESS, pub.open(URL, options));
+    BoxSubscriber sub;
+    ASSERT_EQ(E_SUCCESS, sub.open(URL, false));
+    ASSERT_EQ(E_SUCCESS, sub.subscribe(std::string()));
+    ASSERT_EQ(E_SUCCESS, pub.socket().setSendNumberOfMessages(1024));
+    ASSERT_EQ(E_SUCCESS, sub.socket().setRecvNumberOfMessages(1024));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    int const TEST_COUNT = 10000;
+    int recv_count = 0;
+    std::thread recv_thread([&](){
+        std::string topic;
+        Box result;
+        for (; recv_count < TEST_COUNT; ++recv_count) {
+            if (isFailure(sub.recv(topic, result, 1000))) {
+                break;
+            }
+        }
+    });
+
+    Box box = {{1, 2, 3, 4}};
+    auto const BEGIN = std::chrono::steady_clock::now();
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, pub.publish("bench", box));
+    }
+    ASSERT_EQ(E_SUCCESS, pub.flush());
+    recv_thread.join();
+    auto const DURATION = std::chrono::steady_clock::now() - BEGIN;
+
+    std::cout << recv_count << "/" << TEST_COUNT << " boxes: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(DURATION).count()
+              << "ms" << std::endl;
+}
+
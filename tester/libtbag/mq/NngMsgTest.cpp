@@ -0,0 +1,56 @@
+/**
+ * @file   NngMsgTest.cpp
+ * @brief  NngMsg class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/mq/NngMsg.hpp>
+
+#include <cstring>
+#include <string>
+
+using namespace libtbag;
+using namespace libtbag::mq;
+
+TEST(NngMsgTest, Default)
+{
+    NngMsg msg;
+    ASSERT_FALSE(msg.exists());
+    ASSERT_EQ(0, msg.size());
+    ASSERT_EQ(nullptr, msg.body());
+    ASSERT_EQ(E_ILLSTATE, msg.append("a", 1));
+
+    std::string const TEST_TEXT = "Hello";
+    ASSERT_EQ(E_SUCCESS, msg.assign(TEST_TEXT.data(), TEST_TEXT.size()));
+    ASSERT_TRUE(msg.exists());
+    ASSERT_EQ(TEST_TEXT.size(), msg.size());
+    ASSERT_EQ(0, memcmp(TEST_TEXT.data(), msg.body(), TEST_TEXT.size()));
+
+    ASSERT_EQ(E_SUCCESS, msg.append(", World", 7));
+    auto const view = msg.bodyView();
+    ASSERT_EQ(std::string("Hello, World"), std::string(view.buffer, view.buffer + view.size));
+
+    ASSERT_EQ(E_SUCCESS, msg.headerAppendU32(100));
+    ASSERT_EQ(4, msg.headerSize());
+    uint32_t header_value = 0;
+    ASSERT_EQ(E_SUCCESS, msg.headerTrimU32(&header_value));
+    ASSERT_EQ(100, header_value);
+    ASSERT_EQ(0, msg.headerSize());
+
+    NngMsg copy;
+    ASSERT_EQ(E_SUCCESS, msg.clone(copy));
+    ASSERT_NE(msg.body(), copy.body());
+    ASSERT_EQ(msg.size(), copy.size());
+
+    NngMsg moved(std::move(msg));
+    ASSERT_FALSE(msg.exists());
+    ASSERT_TRUE(moved.exists());
+
+    nng_msg * raw = moved.release();
+    ASSERT_FALSE(moved.exists());
+    NngMsg adopted(raw);
+    ASSERT_EQ(copy.size(), adopted.size());
+}
+
@@ -157,3 +157,88 @@ TEST(NngSocketTest, RecvBufferSizeIsSmall)
     ASSERT_EQ(E_SUCCESS, sock_client.close());
 }
 
+
+TEST(NngSocketTest, SendAndRecvMsg)
+{
+    NngSocket sock_server;
+    NngSocket sock_client;
+
+    ASSERT_EQ(E_SUCCESS, sock_server.open(NngSocket::SocketType::ST_PAIR1));
+    ASSERT_EQ(E_SUCCESS, sock_client.open(NngSocket::SocketType::ST_PAIR1));
+
+    auto const socket_url = std::string("inproc://") + test_info_->test_case_name() + test_info_->name();
+    ASSERT_EQ(E_SUCCESS, sock_server.listen(socket_url));
+    ASSERT_EQ(E_SUCCESS, sock_client.dial(socket_url));
+
+    std::string const send_data = "test";
+    NngMsg send_msg(send_data.data(), send_data.size());
+    ASSERT_TRUE(send_msg.exists());
+    ASSERT_EQ(E_SUCCESS, sock_client.send(send_msg));
+    ASSERT_FALSE(send_msg.exists()); // Ownership transferred.
+
+    NngMsg recv_msg;
+    ASSERT_EQ(E_SUCCESS, sock_server.recv(recv_msg));
+    ASSERT_TRUE(recv_msg.exists());
+
+    auto const view = recv_msg.bodyView();
+    ASSERT_EQ(send_data, std::string(view.buffer, view.buffer + view.size));
+
+    ASSERT_EQ(E_SUCCESS, sock_server.close());
+    ASSERT_EQ(E_SUCCESS, sock_client.close());
+}
+
+TEST(NngSocketTest, SendAndRecvAsync)
+{
+    NngSocket sock_server;
+    NngSocket sock_client;
+
+    ASSERT_EQ(E_SUCCESS, sock_server.open(NngSocket::SocketType::ST_PAIR1));
+    ASSERT_EQ(E_SUCCESS, sock_client.open(NngSocket::SocketType::ST_PAIR1));
+
+    auto const socket_url = std::string("inproc://") + test_info_->test_case_name() + test_info_->name();
+    ASSERT_EQ(E_SUCCESS, sock_server.listen(socket_url));
+    ASSERT_EQ(E_SUCCESS, sock_client.dial(socket_url));
+
+    std::promise<Err> send_promise;
+    std::promise<std::string> recv_promise;
+
+    NngAio send_aio([&](Err code){
+        send_promise.set_value(code);
+    });
+    NngAio recv_aio_with_cb([&](Err code){
+        if (isSuccess(code)) {
+            auto msg = recv_aio_with_cb.takeMsg();
+            auto const view = msg.bodyView();
+            recv_promise.set_value(std::string(view.buffer, view.buffer + view.size));
+        } else {
+            recv_promise.set_value(std::string());
+        }
+    });
+    ASSERT_TRUE(send_aio.exists());
+    ASSERT_TRUE(recv_aio_with_cb.exists());
+
+    auto send_future = send_promise.get_future();
+    auto recv_future = recv_promise.get_future();
+
+    ASSERT_EQ(E_SUCCESS, sock_server.recvAsync(recv_aio_with_cb));
+    ASSERT_EQ(E_ALREADY, sock_server.recvAsync(recv_aio_with_cb));
+
+    std::string const send_data = "async";
+    ASSERT_EQ(E_SUCCESS, sock_client.sendAsync(send_aio, NngMsg(send_data.data(), send_data.size())));
+
+    ASSERT_EQ(E_SUCCESS, send_future.get());
+    ASSERT_EQ(send_data, recv_future.get());
+    ASSERT_FALSE(send_aio.isBusy());
+
+    // Wait like the future.
+    NngAio recv_aio;
+    recv_aio.setTimeout(1);
+    ASSERT_EQ(E_SUCCESS, sock_server.recvAsync(recv_aio));
+    recv_aio.wait();
+    ASSERT_EQ(E_ETIMEDOUT, recv_aio.result());
+    ASSERT_FALSE(recv_aio.takeMsg().exists());
+
+    ASSERT_EQ(E_SUCCESS, sock_server.close());
+    ASSERT_EQ(E_SUCCESS, sock_client.close());
+}
+
@@ -3,10 +3,20 @@
  * @brief  Ip class tester.
  * @author zer0
  * @date   2018-12-09
+ * @date   2026-10-19 (Add the tests of the parser)
  */
 
 #include <gtest/gtest.h>
 #include <libtbag/net/Ip.hpp>
+#include <libtbag/string/StringUtils.hpp>
+#include <libtbag/uvpp/UvCommon.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <vector>
 
 using namespace libtbag;
 using namespace libtbag::net;
@@ -70,5 +80,208 @@ TEST(IpTest, Ipv6)
 
     ASSERT_TRUE(isIpv6("2001:db8:3:4::192.0.2.33"));
     ASSERT_TRUE(isIpv6("64:ff9b::192.0.2.33"));
+
+    ASSERT_FALSE(isIpv6(""));
+    ASSERT_FALSE(isIpv6(":"));
+    ASSERT_FALSE(isIpv6(":::"));
+    ASSERT_FALSE(isIpv6("1:2:3:4:5:6:7:8:9"));
+    ASSERT_FALSE(isIpv6("1:2:3:4:5:6:7"));
+    ASSERT_FALSE(isIpv6("1::2::3"));
+    ASSERT_FALSE(isIpv6("1:2:3:4:5:6:7:8::"));
+    ASSERT_FALSE(isIpv6(":1::"));
+    ASSERT_FALSE(isIpv6("1:"));
+    ASSERT_FALSE(isIpv6("12345::"));
+    ASSERT_FALSE(isIpv6("g::"));
+    ASSERT_FALSE(isIpv6("fe80::1%"));
+    ASSERT_FALSE(isIpv6("fe80::1%eth 0"));
+    ASSERT_FALSE(isIpv6("::1.2.3.256"));
+    ASSERT_FALSE(isIpv6("1:2:3:4:5:6:7:1.2.3.4"));
+    ASSERT_FALSE(isIpv6("1.2.3.4"));
+}
+
+TEST(IpTest, Parse)
+{
+    IpAddress ip;
+    ASSERT_TRUE(parseIp("192.168.0.255", ip));
+    ASSERT_TRUE(ip.isIpv4());
+    uint8_t const IPV4[] = {192, 168, 0, 255};
+    ASSERT_EQ(0, ::memcmp(IPV4, ip.bytes, sizeof(IPV4)));
+
+    ASSERT_TRUE(parseIp("2001:db8::ff00:42:8329", ip));
+    ASSERT_TRUE(ip.isIpv6());
+    uint8_t const IPV6[] = {0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0xFF, 0x00, 0x00, 0x42, 0x83, 0x29};
+    ASSERT_EQ(0, ::memcmp(IPV6, ip.bytes, sizeof(IPV6)));
+    ASSERT_EQ(nullptr, ip.zone);
+
+    std::string const LINK_LOCAL = "fe80::1%eth0";
+    ASSERT_TRUE(parseIp(LINK_LOCAL, ip));
+    ASSERT_TRUE(ip.isIpv6());
+    ASSERT_EQ(std::string("eth0"), std::string(ip.zone, ip.zone_size));
+    ASSERT_EQ(0xFE, ip.bytes[0]);
+    ASSERT_EQ(0x80, ip.bytes[1]);
+    ASSERT_EQ(0x01, ip.bytes[15]);
+
+    ASSERT_TRUE(parseIp("::ffff:10.0.0.1", ip));
+    uint8_t const MAPPED[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 10, 0, 0, 1};
+    ASSERT_EQ(0, ::memcmp(MAPPED, ip.bytes, sizeof(MAPPED)));
+
+    ASSERT_TRUE(parseIp("::", ip));
+    uint8_t const ANY[16] = {0,};
+    ASSERT_EQ(0, ::memcmp(ANY, ip.bytes, sizeof(ANY)));
+
+    // Not null-terminated.
+    char const TEXT[] = {'1', '.', '2', '.', '3', '.', '4', '5'};
+    ASSERT_TRUE(parseIp(TEXT, 7, ip));
+    ASSERT_EQ(4, ip.bytes[3]);
+
+    ASSERT_FALSE(parseIp("localhost", ip));
+    ASSERT_FALSE(parseIp("", ip));
+    ASSERT_FALSE(parseIp(nullptr, 0, ip));
+}
+
+/** The regular expressions of the previous implementation. */
+static bool isIpv4ByRegex(std::string const & ip)
+{
+#define IPV4SEG "(25[0-5]|(2[0-4]|1{0,1}[0-9]){0,1}[0-9])"
+#define IPV4REGEX "(" IPV4SEG "\\.){3,3}" IPV4SEG
+    return string::isMatch(ip, IPV4REGEX);
+}
+
+static bool isIpv6ByRegex(std::string const & ip)
+{
+#define IPV6SEG "[0-9a-fA-F]{1,4}"
+    // clang-format off
+    if (string::isMatch(ip, "(" IPV6SEG ":){7,7}" IPV6SEG)) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,7}:")) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,6}(:" IPV6SEG "){1,1}")) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,5}(:" IPV6SEG "){1,2}")) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,4}(:" IPV6SEG "){1,3}")) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,3}(:" IPV6SEG "){1,4}")) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,2}(:" IPV6SEG "){1,5}")) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,1}(:" IPV6SEG "){1,6}")) { return true; }
+    if (string::isMatch(ip, ":((:" IPV6SEG "){1,7}|:)")) { return true; }
+    if (string::isMatch(ip, "fe80:(:[0-9a-fA-F]{0,4}){0,4}%[0-9a-zA-Z]{1,}")) { return true; }
+    if (string::isMatch(ip, "::(ffff(:0{1,4}){0,1}:){0,1}" IPV4REGEX)) { return true; }
+    if (string::isMatch(ip, "(" IPV6SEG ":){1,4}:" IPV4REGEX)) { return true; }
+    // clang-format on
+    return false;
+#undef IPV6SEG
+#undef IPV4REGEX
+#undef IPV4SEG
+}
+
+/** A segment of the dotted-decimal part with the leading zero. (Allowed by the parser, not by the inet_pton) */
+static bool hasLeadingZeroDecimal(std::string const & ip)
+{
+    auto const COLON = ip.rfind(':');
+    auto const TAIL = (COLON == std::string::npos) ? ip : ip.substr(COLON + 1);
+    if (TAIL.find('.') == std::string::npos) {
+        return false;
+    }
+    for (auto const & segment : string::splitTokens(TAIL, ".", false)) {
+        if (segment.size() > 1 && segment[0] == '0') {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST(IpTest, EquivalenceOfRegex)
+{
+    char const * const SAMPLES[] = {
+            "0.0.0.0", "255.255.255.255", "0.09.0.00", "127.0.0.1", "1.2.3", "1.2.3.4.5", "256.0.0.0", "01.2.3.4",
+            "001.2.3.4", "100.200.249.250", "1..2.3", "a.b.c.d", " 1.2.3.4", "1.2.3.4 ",
+            "1:2:3:4:5:6:7:8", "1::", "::", "::1", "1:2:3:4:5:6:7::", "1::8", "1:2:3:4:5::8", "::2:3:4:5:6:7:8",
+            "2001:cdba:0000:0000:0000:0000:3257:9652", "2001:cdba::3257:9652", "fe80::7:8%eth0", "fe80::7:8%1",
+            "::255.255.255.255", "::ffff:255.255.255.255", "::ffff:0:255.255.255.255", "64:ff9b::192.0.2.33",
+            "1:2:3:4:5:6:7:8:9", "1::2::3", ":1::", "1:", "12345::", "g::", "1:2:3:4:5:6:7", "::ffff:1.2.3.256",
+    };
+    for (auto const * sample : SAMPLES) {
+        ASSERT_EQ(isIpv4ByRegex(sample), isIpv4(sample)) << sample;
+        ASSERT_EQ(isIpv6ByRegex(sample), isIpv6(sample)) << sample;
+    }
+}
+
+TEST(IpTest, EquivalenceOfInetPton)
+{
+    char const * const SEEDS[] = {
+            "192.168.10.1", "8.8.4.4", "0.0.0.0", "255.255.255.255",
+            "2001:db8::ff00:42:8329", "1:2:3:4:5:6:7:8", "::1", "::", "fe80::", "::ffff:10.0.0.1",
+            "64:ff9b::192.0.2.33", "1:2:3:4:5:6:1.2.3.4", "abcd:ef01::2345:6789",
+    };
+    char const ALPHABET[] = "0123456789abcdefABCDEFg:.";
+
+    std::mt19937 engine(20261019);
+    auto random = [&](std::size_t n) -> std::size_t {
+        return std::uniform_int_distribution<std::size_t>(0, n - 1)(engine);
+    };
+
+    std::size_t accepted = 0;
+    for (int i = 0; i < 200000; ++i) {
+        std::string text = SEEDS[random(sizeof(SEEDS) / sizeof(SEEDS[0]))];
+        auto const MUTATIONS = random(4);
+        for (std::size_t m = 0; m < MUTATIONS; ++m) {
+            auto const POS = text.empty() ? 0 : random(text.size() + 1);
+            switch (random(4)) {
+            case 0: text.insert(POS, 1, ALPHABET[random(sizeof(ALPHABET) - 1)]); break;
+            case 1: if (POS < text.size()) { text.erase(POS, 1); } break;
+            case 2: if (POS < text.size()) { text[POS] = ALPHABET[random(sizeof(ALPHABET) - 1)]; } break;
+            default: text.insert(POS, text.substr(POS, random(5))); break;
+            }
+        }
+        if (hasLeadingZeroDecimal(text)) {
+            continue;
+        }
+
+        uint8_t expected[IPV6_BYTE_SIZE] = {0,};
+        uint8_t result[IPV6_BYTE_SIZE] = {0,};
+
+        bool const IPV4_EXPECTED = isSuccess(uvpp::convertInetPton(AF_INET, text, expected));
+        bool const IPV4_RESULT = parseIpv4(text.data(), text.size(), result);
+        ASSERT_EQ(IPV4_EXPECTED, IPV4_RESULT) << text;
+        if (IPV4_RESULT) {
+            ASSERT_EQ(0, ::memcmp(expected, result, IPV4_BYTE_SIZE)) << text;
+            ++accepted;
+        }
+
+        bool const IPV6_EXPECTED = isSuccess(uvpp::convertInetPton(AF_INET6, text, expected));
+        bool const IPV6_RESULT = parseIpv6(text.data(), text.size(), result);
+        ASSERT_EQ(IPV6_EXPECTED, IPV6_RESULT) << text;
+        if (IPV6_RESULT) {
+            ASSERT_EQ(0, ::memcmp(expected, result, IPV6_BYTE_SIZE)) << text;
+            ++accepted;
+        }
+    }
+    std::cout << "Accepted addresses: " << accepted << std::endl;
+}
+
+TEST(IpTest, BenchmarkOfParse)
+{
+    std::vector<std::string> const SAMPLES = {
+            "192.168.0.1", "2001:cdba::3257:9652", "fe80::7:8%eth0", "::ffff:255.255.255.255", "localhost",
+    };
+    int const LOOP = 20;
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    std::size_t regex_count = 0;
+    for (int i = 0; i < LOOP; ++i) {
+        for (auto const & sample : SAMPLES) {
+            regex_count += (isIpv4ByRegex(sample) || isIpv6ByRegex(sample)) ? 1 : 0;
+        }
+    }
+    auto const REGEX = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    std::size_t parse_count = 0;
+    for (int i = 0; i < LOOP; ++i) {
+        for (auto const & sample : SAMPLES) {
+            parse_count += isIp(sample) ? 1 : 0;
+        }
+    }
+    auto const PARSE = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(regex_count, parse_count);
+    std::cout << "Regex: " << REGEX << "us, Parser: " << PARSE << "us" << std::endl;
 }
 
@@ -3,6 +3,7 @@
  * @brief  SocketAddress class tester.
  * @author zer0
  * @date   2019-09-10
+ * @date   2026-10-19 (Add the test of the IP literals)
  */
 
 #include <gtest/gtest.h>
@@ -18,6 +19,27 @@ TEST(SocketAddressTest, Default)
     TEST_DEFAULT_ASSIGNMENT(SocketAddress, obj2);
 }
 
+TEST(SocketAddressTest, IpLiteral)
+{
+    SocketAddress ipv4;
+    ASSERT_EQ(E_SUCCESS, ipv4.init("127.0.0.1", 8080));
+    ASSERT_TRUE(ipv4.isIpv4());
+    ASSERT_FALSE(ipv4.isIpv6());
+    ASSERT_EQ("127.0.0.1", ipv4.getIpName());
+    ASSERT_EQ(8080, ipv4.getPortNumber());
+
+    SocketAddress ipv6;
+    ASSERT_EQ(E_SUCCESS, ipv6.init("2001:db8::1", 443));
+    ASSERT_TRUE(ipv6.isIpv6());
+    ASSERT_EQ("2001:db8::1", ipv6.getIpName());
+    ASSERT_EQ(443, ipv6.getPortNumber());
+
+    SocketAddress ipv6_zone;
+    ASSERT_EQ(E_SUCCESS, ipv6_zone.init("fe80::1%lo", 80));
+    ASSERT_TRUE(ipv6_zone.isIpv6());
+    ASSERT_EQ(80, ipv6_zone.getPortNumber());
+}
+
 TEST(SocketAddressTest, FindHostNameOfConnectedInterfaceByIpAddress)
 {
     auto const name = findHostNameOfConnectedInterfaceByIpAddress("127.0.0.1");
@@ -4,11 +4,17 @@
  * @author zer0
  * @date   2016-04-07
  * @date   2016-12-10 (Move package: libtbag -> libtbag/random)
+ * @date   2026-10-19 (Add the tests of the bulk fill functions)
  */
 
 #include <gtest/gtest.h>
 #include <libtbag/random/Random.hpp>
 
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
 using namespace libtbag;
 using namespace libtbag::random;
 
@@ -26,3 +32,151 @@ TEST(RandomTest, Gen)
     }
 }
 
+
+TEST(RandomTest, Xoshiro256)
+{
+    Xoshiro256 engine(12345);
+    ASSERT_EQ(0xBE6A36374160D49Bull, engine());
+    ASSERT_EQ(0x214AAA0637A688C6ull, engine());
+    ASSERT_EQ(0xF69D16DE9954D388ull, engine());
+    ASSERT_EQ(0x0C60048C4E96E033ull, engine());
+}
+
+TEST(RandomTest, FillUint64)
+{
+    // The interleaved engines must produce the same sequences as the scalar engines.
+    Engine lanes[4] = {Engine(100), Engine(100), Engine(100), Engine(100)};
+    for (int l = 0; l < 4; ++l) {
+        for (int j = 0; j <= l; ++j) {
+            lanes[l].jump();
+        }
+    }
+
+    seedThreadEngine(100);
+    std::size_t const SIZE = 4 * 50 + 3;
+    std::vector<uint64_t> values(SIZE);
+    fillUint64(values.data(), values.size());
+
+    for (std::size_t i = 0; i < 4 * 50; ++i) {
+        ASSERT_EQ(lanes[i % 4](), values[i]);
+    }
+
+    Engine tail(100);
+    for (std::size_t i = 4 * 50; i < SIZE; ++i) {
+        ASSERT_EQ(tail(), values[i]);
+    }
+
+    seedThreadEngine(100);
+    std::vector<uint64_t> values2(SIZE);
+    fillUint64(values2.data(), values2.size());
+    ASSERT_EQ(values, values2);
+}
+
+TEST(RandomTest, FillBytes)
+{
+    std::vector<uint8_t> bytes(10000 + 7);
+    fillBytes(bytes.data(), bytes.size());
+
+    std::size_t histogram[256] = {0,};
+    for (auto b : bytes) {
+        ++histogram[b];
+    }
+    for (auto count : histogram) {
+        ASSERT_LT(0u, count);
+    }
+}
+
+TEST(RandomTest, FillUniform)
+{
+    std::vector<int> integers(10000);
+    fillUniform(integers.data(), integers.size(), -3, 3);
+    bool found[7] = {false,};
+    for (auto i : integers) {
+        ASSERT_LE(-3, i);
+        ASSERT_GE(3, i);
+        found[i + 3] = true;
+    }
+    for (auto f : found) {
+        ASSERT_TRUE(f);
+    }
+
+    std::vector<uint8_t> bytes(1000);
+    fillUniform<uint8_t>(bytes.data(), bytes.size(), 0, 255);
+
+    std::vector<double> reals(10000);
+    fillUniform(reals.data(), reals.size(), 1.0, 2.0);
+    double sum = 0;
+    for (auto r : reals) {
+        ASSERT_LE(1.0, r);
+        ASSERT_GT(2.0, r);
+        sum += r;
+    }
+    ASSERT_NEAR(1.5, sum / reals.size(), 0.05);
+
+    std::vector<float> floats(1001);
+    fillUniform(floats.data(), floats.size(), -1.0f, 1.0f);
+    for (auto f : floats) {
+        ASSERT_LE(-1.0f, f);
+        ASSERT_GT(1.0f, f);
+    }
+}
+
+TEST(RandomTest, FillNormal)
+{
+    std::vector<double> values(100001);
+    fillNormal(values.data(), values.size(), 10.0, 2.0);
+
+    double sum = 0;
+    for (auto v : values) {
+        sum += v;
+    }
+    double const MEAN = sum / values.size();
+
+    double variance = 0;
+    for (auto v : values) {
+        variance += (v - MEAN) * (v - MEAN);
+    }
+    variance /= values.size();
+
+    ASSERT_NEAR(10.0, MEAN, 0.05);
+    ASSERT_NEAR(2.0, std::sqrt(variance), 0.05);
+}
+
+TEST(RandomTest, Threads)
+{
+    uint64_t values[2] = {0,};
+    std::thread t0([&](){ values[0] = getThreadEngine()(); });
+    std::thread t1([&](){ values[1] = getThreadEngine()(); });
+    t0.join();
+    t1.join();
+    ASSERT_NE(values[0], values[1]);
+}
+
+TEST(RandomTest, BenchmarkOfFill)
+{
+    std::size_t const SIZE = 100000;
+    std::vector<int> values(SIZE);
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        std::random_device device;
+        std::mt19937 engine(device());
+        values[i] = std::uniform_int_distribution<int>(0, 100)(engine);
+    }
+    auto const NAIVE = duration_cast<milliseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        values[i] = gen(0, 100);
+    }
+    auto const GEN = duration_cast<milliseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    fillUniform(values.data(), values.size(), 0, 100);
+    auto const FILL = duration_cast<milliseconds>(system_clock::now() - begin).count();
+
+    std::cout << "Naive (random_device+mt19937 per call): " << NAIVE << "ms" << std::endl;
+    std::cout << "gen(): " << GEN << "ms" << std::endl;
+    std::cout << "fillUniform(): " << FILL << "ms" << std::endl;
+}
@@ -0,0 +1,236 @@
+/**
+ * @file   RegexTest.cpp
+ * @brief  Regex class tester.
+ * @author zer0
+ * @date   2026-10-19
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/string/Regex.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace libtbag;
+using namespace libtbag::string;
+
+static std::vector<std::string> findAllByStd(std::string const & text, std::regex const & regex)
+{
+    using TokenIterator = std::regex_token_iterator<typename std::string::const_iterator>;
+    std::vector<std::string> result;
+    for (auto itr = TokenIterator(text.begin(), text.end(), regex); itr != TokenIterator(); ++itr) {
+        result.push_back(itr->str());
+    }
+    return result;
+}
+
+static void testEquivalence(std::string const & pattern, std::vector<std::string> const & texts,
+                            bool test_groups = true)
+{
+    std::regex const STD_REGEX(pattern);
+    Regex const REGEX(pattern);
+    ASSERT_TRUE(REGEX.exists());
+
+    for (auto const & text : texts) {
+        SCOPED_TRACE("Pattern: " + pattern + ", Text: " + text);
+        ASSERT_EQ(std::regex_match(text, STD_REGEX), REGEX.match(text));
+        ASSERT_EQ(std::regex_search(text, STD_REGEX), REGEX.search(text));
+        ASSERT_EQ(findAllByStd(text, STD_REGEX), REGEX.findAll(text));
+        ASSERT_EQ(std::regex_replace(text, STD_REGEX, "<$&>"), REGEX.replace(text, "<$&>"));
+        if (test_groups) {
+            ASSERT_EQ(std::regex_replace(text, STD_REGEX, "[$1|$2|$`|$'|$$|$9|$x]"),
+                      REGEX.replace(text, "[$1|$2|$`|$'|$$|$9|$x]"));
+        }
+    }
+}
+
+TEST(RegexTest, Default)
+{
+    Regex regex;
+    ASSERT_FALSE(regex.exists());
+    ASSERT_FALSE(regex.match(""));
+    ASSERT_FALSE(regex.search("abc"));
+    ASSERT_TRUE(regex.findAll("abc").empty());
+    ASSERT_EQ(std::string("abc"), regex.replace("abc", "-"));
+
+    regex = Regex("a+");
+    ASSERT_TRUE(regex.exists());
+    ASSERT_EQ(std::string("a+"), regex.pattern());
+    ASSERT_TRUE(regex.isLinear());
+    ASSERT_TRUE(regex.match("aaa"));
+    ASSERT_FALSE(regex.match("aab"));
+    ASSERT_TRUE(regex.search("baab"));
+
+    Regex copy = regex;
+    ASSERT_TRUE(copy.match("a"));
+    Regex move = std::move(copy);
+    ASSERT_TRUE(move.match("a"));
+}
+
+TEST(RegexTest, Replace)
+{
+    ASSERT_EQ(std::string("-a-b-c-"), Regex("x*").replace("abc", "-"));
+    ASSERT_EQ(std::string("<><a><><a><><a><>"), Regex("a*?").replace("aaa", "<$&>"));
+    ASSERT_EQ(std::string("a[cbbc$aabc$x$]a[cbbc$a$x$]"),
+              Regex("(b)(c)").replace("abcabc", "[$2$1$&$$$`$'$9$x$]"));
+    ASSERT_EQ(std::string("|ab|"), Regex("\\b").replace("ab", "|"));
+    ASSERT_EQ(std::string("|ab"), Regex("^").replace("ab", "|"));
+}
+
+TEST(RegexTest, Equivalence)
+{
+    std::vector<std::string> const TEXTS = {
+            "", "a", "ab", "abc", "aaa", "abcabc", "a1b2c3", "hello world", "foo_bar baz", " \t\r\n",
+            "0x1F 0xff", "192.168.0.1", "2001:db8::1", "ab\nab", "aaaaaaaa!",
+            "The quick brown fox.", "--a--", "[x]{y}(z)", std::string("\0\x01\xff", 3),
+    };
+    std::vector<std::string> const PATTERNS = {
+            "", "a", "abc", "a*", "a+", "a?", "a*?", "a+?", "a??", "a{2}", "a{2,}", "a{1,3}", "a{0,2}?",
+            ".", ".*", ".+?", "^", "$", "^a", "a$", "^$", "^.*$", "\\b", "\\B", "\\bab\\b", "\\w+", "\\W",
+            "\\d+", "\\D+", "\\s+", "\\S+", "[abc]", "[^abc]", "[a-z]+", "[A-Za-z_][A-Za-z0-9_]*",
+            "[\\d.]+", "[-a]", "[a-]", "[\\b]", "[\\]]", "[.]", "a|b", "ab|a", "a|ab", "(a|b)*c", "(a)(b)?",
+            "(?:ab)+", "((a)|(b))+", "()", "(|a)", "x*", "\\x41|\\u0061",
+            "\\t|\\n|\\r", "\\.", "\\$\\^", "0x[0-9a-fA-F]+", "(\\d+)\\.(\\d+)", "[ \\t]*$", "(o)(\\w)",
+            "(a+)+$", "(a|aa)+!", "[^\\s]+", "\\0", "(?:)", "a{0}", "(ab){1,2}?", "[\\x00-\\x1f]",
+    };
+    for (auto const & pattern : PATTERNS) {
+        ASSERT_TRUE(Regex(pattern).isLinear()) << pattern;
+        testEquivalence(pattern, TEXTS);
+    }
+
+    // The empty iteration of a loop is rejected as the ECMAScript specification,
+    // so the groups keep the last non-empty iteration. (The libstdc++ keeps the empty one)
+    for (auto const & pattern : {"(a*)*", "(a*)+b", "(a|)+"}) {
+        testEquivalence(pattern, TEXTS, false);
+    }
+    ASSERT_EQ(std::string("[a][]"), Regex("(a*)*").replace("a", "[$1]"));
+}
+
+TEST(RegexTest, EquivalenceOfRandomPatterns)
+{
+    std::vector<std::string> const TOKENS = {
+            "a", "b", "c", ".", "\\w", "\\d", "[ab]", "[^a]", "*", "+", "?", "*?", "{1,2}", "|", "(", ")",
+            "(?:", "^", "$", "\\b",
+    };
+    std::mt19937 engine(20261019);
+    std::uniform_int_distribution<std::size_t> token(0, TOKENS.size() - 1);
+    std::uniform_int_distribution<int> length(1, 8);
+    std::uniform_int_distribution<int> letter(0, 4);
+
+    std::size_t tested = 0;
+    for (int i = 0; i < 3000; ++i) {
+        std::string pattern;
+        for (int j = length(engine); j > 0; --j) {
+            pattern += TOKENS[token(engine)];
+        }
+        try {
+            std::regex const STD_REGEX(pattern);
+        } catch (std::regex_error &) {
+            continue;
+        }
+
+        std::vector<std::string> texts;
+        for (int t = 0; t < 4; ++t) {
+            std::string text;
+            for (int j = length(engine); j > 0; --j) {
+                text += "abc1 "[letter(engine)];
+            }
+            texts.push_back(text);
+        }
+        testEquivalence(pattern, texts);
+        ++tested;
+    }
+    ASSERT_LT(0u, tested);
+}
+
+TEST(RegexTest, Fallback)
+{
+    std::vector<std::string> const FALLBACKS = {"(a)\\1", "a(?=b)", "a(?!b)", "[[:digit:]]+", "\\cJ", "a**"};
+    std::vector<std::string> const TEXTS = {"", "aa", "ab", "ac", "123", "\n", "a"};
+    for (auto const & pattern : FALLBACKS) {
+        ASSERT_FALSE(Regex(pattern).isLinear()) << pattern;
+        testEquivalence(pattern, TEXTS);
+    }
+
+    ASSERT_THROW(Regex("a{"), std::regex_error);
+    ASSERT_THROW(Regex("a{2,1}"), std::regex_error);
+    ASSERT_THROW(Regex("[z-a]"), std::regex_error);
+    ASSERT_THROW(Regex("(a"), std::regex_error);
+    ASSERT_THROW(Regex("a)"), std::regex_error);
+}
+
+TEST(RegexTest, Linear)
+{
+    // The backtracking matcher is exponential for this pattern.
+    std::string const TEXT = std::string(64, 'a') + "!";
+    Regex const REGEX("(a|aa)+$");
+    ASSERT_TRUE(REGEX.isLinear());
+    ASSERT_FALSE(REGEX.match(TEXT));
+    ASSERT_FALSE(REGEX.search(TEXT));
+    ASSERT_TRUE(REGEX.match(std::string(64, 'a')));
+}
+
+TEST(RegexTest, Cache)
+{
+    auto const CAPACITY = getRegexCacheCapacity();
+    ASSERT_EQ(1024u, CAPACITY);
+
+    clearRegexCache();
+    ASSERT_EQ(0u, getRegexCacheSize());
+
+    setRegexCacheCapacity(2);
+    auto first = getCachedRegex("a+");
+    ASSERT_TRUE(first.match("aa"));
+    ASSERT_EQ(1u, getRegexCacheSize());
+    getCachedRegex("b+");
+    getCachedRegex("a+"); // The "b+" is the least recently used.
+    ASSERT_EQ(2u, getRegexCacheSize());
+    getCachedRegex("c+");
+    ASSERT_EQ(2u, getRegexCacheSize());
+    ASSERT_TRUE(getCachedRegex("a+").match("a"));
+
+    ASSERT_THROW(getCachedRegex("a{"), std::regex_error);
+    ASSERT_EQ(2u, getRegexCacheSize());
+
+    setRegexCacheCapacity(0);
+    ASSERT_EQ(0u, getRegexCacheSize());
+    ASSERT_TRUE(getCachedRegex("a+").match("a"));
+    ASSERT_EQ(0u, getRegexCacheSize());
+
+    setRegexCacheCapacity(CAPACITY);
+    clearRegexCache();
+}
+
+TEST(RegexTest, BenchmarkOfMatch)
+{
+    std::string const PATTERN = "[A-Za-z_][A-Za-z0-9_]*(\\.[A-Za-z_][A-Za-z0-9_]*)*";
+    std::vector<std::string> const SAMPLES = {"libtbag.string.Regex", "a.b.c", "1abc", "abc.", "__init__"};
+    int const LOOP = 200;
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    std::size_t std_count = 0;
+    for (int i = 0; i < LOOP; ++i) {
+        for (auto const & sample : SAMPLES) {
+            std_count += std::regex_match(sample, std::regex(PATTERN)) ? 1 : 0;
+        }
+    }
+    auto const STD_REGEX = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    std::size_t cached_count = 0;
+    for (int i = 0; i < LOOP; ++i) {
+        for (auto const & sample : SAMPLES) {
+            cached_count += getCachedRegex(PATTERN).match(sample) ? 1 : 0;
+        }
+    }
+    auto const CACHED = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(std_count, cached_count);
+    std::cout << "std::regex: " << STD_REGEX << "us, Cached Regex: " << CACHED << "us" << std::endl;
+}
+
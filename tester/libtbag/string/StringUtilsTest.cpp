@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 using namespace libtbag;
 using namespace libtbag::string;
@@ -198,6 +199,48 @@ TEST(StringUtilsTest, ConvertByteVectorToHexStringBox)
     ASSERT_EQ(RESULT5, convertByteVectorToHexStringBox(DATA5, WIDTH, PREFIX, SEPARATOR, NEW_LINE));
 }
 
+TEST(StringUtilsTest, EncodeAndDecodeHexString)
+{
+    // The lengths cover the SIMD blocks and the tails.
+    for (std::size_t size = 0; size < 100; ++size) {
+        std::vector<uint8_t> bytes(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<uint8_t>(i * 37 + size);
+        }
+
+        std::string naive_upper;
+        std::string naive_lower;
+        for (auto byte : bytes) {
+            naive_upper += toHexString(byte, true).insert(0, (byte < 0x10 ? "0" : ""));
+            naive_lower += toHexString(byte, false).insert(0, (byte < 0x10 ? "0" : ""));
+        }
+
+        std::string upper(size * 2, '\0');
+        std::string lower(size * 2, '\0');
+        ASSERT_EQ(size * 2, encodeHexString(bytes.data(), size, &upper[0]));
+        ASSERT_EQ(size * 2, encodeHexString(bytes.data(), size, &lower[0], false));
+        ASSERT_EQ(naive_upper, upper);
+        ASSERT_EQ(naive_lower, lower);
+        ASSERT_EQ(naive_upper, convertByteVectorToHexString(bytes, STRING_EMPTY));
+
+        std::vector<uint8_t> decode(size);
+        ASSERT_EQ(E_SUCCESS, decodeHexString(upper.data(), upper.size(), decode.data()));
+        ASSERT_EQ(bytes, decode);
+        ASSERT_EQ(E_SUCCESS, decodeHexString(lower.data(), lower.size(), decode.data()));
+        ASSERT_EQ(bytes, decode);
+
+        if (size > 0) {
+            auto invalid = upper;
+            invalid[size] = 'G';
+            ASSERT_EQ(E_PARSING, decodeHexString(invalid.data(), invalid.size(), decode.data()));
+        }
+    }
+
+    uint8_t byte;
+    ASSERT_EQ(E_ILLARGS, decodeHexString("ABC", 3, &byte));
+    ASSERT_EQ("0x01, 0xAB", convertByteVectorToHexString(std::vector<uint8_t>{0x01, 0xAB}, "0x", ", "));
+}
+
 TEST(StringUtilsTest, ConvertByteVectorToPrettyHexStringBox)
 {
     int const width = 16;
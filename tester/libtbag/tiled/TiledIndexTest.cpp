@@ -0,0 +1,376 @@
+/**
+ * @file   TiledIndexTest.cpp
+ * @brief  TiledIndex class tester.
+ * @author zer0
+ * @date   2026-10-19
+ * @date   2026-10-19 (Add the ConcurrentQuery test)
+ */
+
+#include <gtest/gtest.h>
+#include <libtbag/tiled/TiledIndex.hpp>
+#include <libtbag/tiled/TiledMap.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace libtbag;
+using namespace libtbag::tiled;
+
+using TmxMap = TiledIndex::TmxMap;
+using TmxGroup = TiledIndex::TmxGroup;
+using TmxLayer = TiledIndex::TmxLayer;
+using TmxChunk = TiledIndex::TmxChunk;
+using TmxObject = TiledIndex::TmxObject;
+using TmxObjectGroup = TiledIndex::TmxObjectGroup;
+using Point = TiledIndex::Point;
+using Rect = TiledIndex::Rect;
+
+static TmxObject __make_object(int id, int x, int y, int w, int h)
+{
+    TmxObject object;
+    object.id = id;
+    object.x = x;
+    object.y = y;
+    object.width = w;
+    object.height = h;
+    return object;
+}
+
+static std::vector<int> __get_ids(TiledIndex::Objects const & objects)
+{
+    std::vector<int> ids;
+    for (auto const * object : objects) {
+        ids.push_back(object->id);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+TEST(TiledIndexTest, CalcBounds)
+{
+    auto object = __make_object(1, 10, 20, 30, 40);
+    auto bounds = TiledIndex::calcBounds(object);
+    ASSERT_EQ(Rect(10, 20, 30, 40), bounds);
+
+    // Tile object.
+    object.gid = 1;
+    bounds = TiledIndex::calcBounds(object);
+    ASSERT_EQ(Rect(10, -20, 30, 40), bounds);
+
+    auto polygon = __make_object(2, 100, 100, 0, 0);
+    polygon.polygon.points = { {0, 0}, {-10, 5}, {20, -30} };
+    bounds = TiledIndex::calcBounds(polygon);
+    ASSERT_EQ(Rect(90, 70, 30, 35), bounds);
+
+    auto rotated = __make_object(3, 0, 0, 10, 20);
+    rotated.rotation = 90;
+    bounds = TiledIndex::calcBounds(rotated);
+    ASSERT_EQ(Rect(-20, 0, 20, 10), bounds);
+}
+
+TEST(TiledIndexTest, Build)
+{
+    TmxMap map;
+    map.tile_width = 16;
+    map.tile_height = 16;
+
+    TmxObjectGroup group1;
+    group1.objects.push_back(__make_object(1, 0, 0, 10, 10));
+    group1.objects.push_back(__make_object(2, 100, 100, 10, 10));
+    group1.objects.push_back(__make_object(3, 1000, 1000, 0, 0));
+    map.object_groups.push_back(group1);
+
+    TmxObjectGroup group2;
+    group2.offsetx = 5;
+    group2.objects.push_back(__make_object(4, 0, 0, 10, 10));
+    TmxGroup group;
+    group.offsety = 500;
+    group.object_groups.push_back(group2);
+    map.groups.push_back(group);
+
+    TmxLayer layer;
+    layer.offsetx = 0;
+    layer.offsety = 0;
+    layer.data.chunks.emplace_back(0, 0, 16, 16);
+    layer.data.chunks.emplace_back(16, 0, 16, 16);
+    layer.data.chunks.emplace_back(-16, -16, 16, 16);
+    map.layers.push_back(layer);
+
+    TiledIndex index;
+    ASSERT_EQ(E_SUCCESS, index.build(map));
+    ASSERT_EQ(16 * TiledIndex::TILES_PER_CELL, index.getCellSize());
+    ASSERT_EQ(4, index.size());
+    ASSERT_EQ(3, index.getChunkCount());
+
+    Rect bounds;
+    ASSERT_EQ(E_SUCCESS, index.getBounds(map.groups[0].object_groups[0].objects[0], bounds));
+    ASSERT_EQ(Rect(5, 500, 10, 10), bounds);
+
+    TiledIndex::Objects result;
+    ASSERT_EQ(2, index.queryRect(Rect(0, 0, 100, 100), result));
+    ASSERT_EQ(std::vector<int>({1, 2}), __get_ids(result));
+
+    result.clear();
+    ASSERT_EQ(1, index.queryPoint(Point(10, 505), result));
+    ASSERT_EQ(4, result[0]->id);
+    ASSERT_EQ(&map.groups[0].object_groups[0].objects[0], result[0]);
+
+    result.clear();
+    ASSERT_EQ(1, index.queryPoint(Point(1000, 1000), result));
+    ASSERT_EQ(3, result[0]->id);
+
+    result.clear();
+    ASSERT_EQ(0, index.queryPoint(Point(50, 50), result));
+    ASSERT_EQ(0, index.queryRect(Rect(-100000, -100000, 10, 10), result));
+    ASSERT_EQ(4, index.queryRect(Rect(-100000, -100000, 200000, 200000), result));
+
+    TiledIndex::ChunkRefs chunks;
+    ASSERT_EQ(2, index.queryChunks(Rect(1, 1, 300, 10), chunks));
+    for (auto const & ref : chunks) {
+        ASSERT_EQ(&map.layers[0], ref.layer);
+        ASSERT_EQ(0, ref.chunk->y);
+    }
+    chunks.clear();
+    ASSERT_EQ(1, index.queryChunks(Rect(-10, -10, 5, 5), chunks));
+    ASSERT_EQ(Rect(-256, -256, 256, 256), chunks[0].bounds);
+}
+
+TEST(TiledIndexTest, Update)
+{
+    TmxObjectGroup group;
+    group.offsetx = 10;
+    for (int i = 0; i < 10; ++i) {
+        group.objects.push_back(__make_object(i, i * 100, 0, 10, 10));
+    }
+
+    TiledIndex index(64);
+    for (auto & object : group.objects) {
+        ASSERT_EQ(E_SUCCESS, index.insert(group, object));
+    }
+    ASSERT_EQ(E_ALREADY, index.insert(group.objects[0]));
+    ASSERT_EQ(10, index.size());
+
+    auto & object = group.objects[3];
+    TiledIndex::Objects result;
+    ASSERT_EQ(1, index.queryPoint(Point(315, 5), result));
+    ASSERT_EQ(&object, result[0]);
+
+    // Move in the same cell.
+    object.x = 302;
+    ASSERT_EQ(E_SUCCESS, index.update(object));
+    result.clear();
+    ASSERT_EQ(1, index.queryPoint(Point(321, 5), result));
+
+    // Move to the other cell.
+    object.x = -500;
+    object.y = -500;
+    ASSERT_EQ(E_SUCCESS, index.update(object));
+    result.clear();
+    ASSERT_EQ(0, index.queryPoint(Point(321, 5), result));
+    ASSERT_EQ(1, index.queryPoint(Point(-485, -495), result));
+    ASSERT_EQ(&object, result[0]);
+
+    ASSERT_EQ(E_SUCCESS, index.remove(object));
+    ASSERT_EQ(E_NFOUND, index.remove(object));
+    ASSERT_EQ(E_NFOUND, index.update(object));
+    ASSERT_FALSE(index.exists(object));
+    ASSERT_EQ(9, index.size());
+    result.clear();
+    ASSERT_EQ(0, index.queryPoint(Point(-485, -495), result));
+
+    // Reuse the removed entry.
+    ASSERT_EQ(E_SUCCESS, index.insert(object));
+    ASSERT_TRUE(index.exists(object));
+    result.clear();
+    ASSERT_EQ(1, index.queryPoint(Point(-495, -495), result));
+}
+
+TEST(TiledIndexTest, Nearest)
+{
+    TmxObjectGroup group;
+    group.objects.push_back(__make_object(1, 0, 0, 10, 10));
+    group.objects.push_back(__make_object(2, 1000, 0, 10, 10));
+    group.objects.push_back(__make_object(3, 0, 2000, 10, 10));
+
+    TiledIndex index(32);
+    ASSERT_EQ(nullptr, index.nearest(Point(0, 0)));
+    for (auto & object : group.objects) {
+        ASSERT_EQ(E_SUCCESS, index.insert(object));
+    }
+
+    ASSERT_EQ(1, index.nearest(Point(5, 5))->id);
+    ASSERT_EQ(1, index.nearest(Point(400, 0))->id);
+    ASSERT_EQ(2, index.nearest(Point(700, 0))->id);
+    ASSERT_EQ(2, index.nearest(Point(5000, -3000))->id);
+    ASSERT_EQ(3, index.nearest(Point(0, 1500))->id);
+    ASSERT_EQ(3, index.nearest(Point(-9000, 9000))->id);
+    ASSERT_EQ(nullptr, index.nearest(Point(500, 1000), 100));
+    ASSERT_EQ(2, index.nearest(Point(1100, 0), 100)->id);
+    ASSERT_EQ(nullptr, index.nearest(Point(1111, 0), 100));
+}
+
+TEST(TiledIndexTest, TiledMap)
+{
+    char const * const TEST_XML = R"(<?xml version="1.0" encoding="UTF-8"?>
+<map version="1.2" orientation="orthogonal" renderorder="right-down" width="10" height="10" tilewidth="32" tileheight="32" infinite="0" nextlayerid="2" nextobjectid="3">
+ <objectgroup id="1" name="objects">
+  <object id="1" x="64" y="64" width="32" height="32"/>
+  <object id="2" x="200" y="200"/>
+ </objectgroup>
+</map>
+)";
+
+    TiledMap tiled;
+    tiled.setIndexing();
+    ASSERT_EQ(E_SUCCESS, tiled.readFromXmlText(TEST_XML, strlen(TEST_XML)));
+    ASSERT_EQ(2, tiled.index().size());
+
+    TiledIndex::Objects result;
+    ASSERT_EQ(1, tiled.index().queryPoint(Point(80, 80), result));
+    ASSERT_EQ(&tiled.map().object_groups[0].objects[0], result[0]);
+    ASSERT_EQ(2, tiled.index().nearest(Point(190, 210))->id);
+
+    TiledMap tiled2;
+    ASSERT_FALSE(tiled2.isIndexing());
+    ASSERT_EQ(E_SUCCESS, tiled2.readFromXmlText(TEST_XML, strlen(TEST_XML)));
+    ASSERT_TRUE(tiled2.index().empty());
+    ASSERT_EQ(E_SUCCESS, tiled2.buildIndex());
+    ASSERT_EQ(2, tiled2.index().size());
+}
+
+TEST(TiledIndexTest, ConcurrentQuery)
+{
+    int const OBJECTS = 2000;
+    int const MAP_SIZE = 4096;
+    int const QUERIES = 200;
+    int const THREADS = 4;
+
+    std::mt19937 random(0);
+    std::uniform_int_distribution<int> position(-MAP_SIZE, MAP_SIZE);
+    std::uniform_int_distribution<int> size(0, 1024);
+
+    TmxObjectGroup group;
+    for (int i = 0; i < OBJECTS; ++i) {
+        group.objects.push_back(__make_object(i, position(random), position(random), size(random), size(random)));
+    }
+
+    TiledIndex index(64);
+    for (auto & object : group.objects) {
+        ASSERT_EQ(E_SUCCESS, index.insert(object));
+    }
+
+    std::vector<Rect> views;
+    std::vector<std::vector<int>> expected;
+    for (int i = 0; i < QUERIES; ++i) {
+        Rect const view(position(random), position(random), size(random), size(random));
+        std::vector<int> ids;
+        for (auto const & object : group.objects) {
+            auto const bounds = TiledIndex::calcBounds(object);
+            if (bounds.x <= view.x + view.width && view.x <= bounds.x + bounds.width &&
+                bounds.y <= view.y + view.height && view.y <= bounds.y + bounds.height) {
+                ids.push_back(object.id);
+            }
+        }
+        std::sort(ids.begin(), ids.end());
+        views.push_back(view);
+        expected.push_back(ids);
+    }
+    // The region larger than the used cells.
+    views.emplace_back(-MAP_SIZE * 4, -MAP_SIZE * 4, MAP_SIZE * 8, MAP_SIZE * 8);
+    std::vector<int> all_ids;
+    for (int i = 0; i < OBJECTS; ++i) {
+        all_ids.push_back(i);
+    }
+    expected.push_back(all_ids);
+
+    std::vector<std::size_t> failures(THREADS, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t](){
+            TiledIndex::Objects result;
+            for (std::size_t i = 0; i < views.size(); ++i) {
+                result.clear();
+                index.queryRect(views[i], result);
+                if (__get_ids(result) != expected[i]) {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    for (auto failure : failures) {
+        ASSERT_EQ(0, failure);
+    }
+}
+
+TEST(TiledIndexTest, Benchmark)
+{
+    int const OBJECTS = 20000;
+    int const MAP_SIZE = 16384;
+    int const FRAMES = 100;
+    int const VIEW_WIDTH = 640;
+    int const VIEW_HEIGHT = 480;
+
+    std::mt19937 random(0);
+    std::uniform_int_distribution<int> position(0, MAP_SIZE);
+    std::uniform_int_distribution<int> size(0, 64);
+
+    TmxObjectGroup group;
+    group.objects.reserve(OBJECTS);
+    for (int i = 0; i < OBJECTS; ++i) {
+        group.objects.push_back(__make_object(i, position(random), position(random), size(random), size(random)));
+    }
+
+    TiledIndex index;
+    for (auto & object : group.objects) {
+        ASSERT_EQ(E_SUCCESS, index.insert(object));
+    }
+
+    std::vector<Rect> views;
+    for (int i = 0; i < FRAMES; ++i) {
+        views.emplace_back(position(random), position(random), VIEW_WIDTH, VIEW_HEIGHT);
+    }
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    std::size_t linear_count = 0;
+    for (auto const & view : views) {
+        for (auto const & object : group.objects) {
+            auto const bounds = TiledIndex::calcBounds(object);
+            if (bounds.x <= view.x + view.width && view.x <= bounds.x + bounds.width &&
+                bounds.y <= view.y + view.height && view.y <= bounds.y + bounds.height) {
+                ++linear_count;
+            }
+        }
+    }
+    auto const LINEAR = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    std::size_t index_count = 0;
+    TiledIndex::Objects result;
+    for (auto const & view : views) {
+        result.clear();
+        index_count += index.queryRect(view, result);
+    }
+    auto const INDEX = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    for (auto & object : group.objects) {
+        object.x += 3;
+        object.y += 3;
+        ASSERT_EQ(E_SUCCESS, index.update(object));
+    }
+    auto const UPDATE = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(linear_count, index_count);
+    std::cout << "Linear scan: " << LINEAR << "us, TiledIndex: " << INDEX << "us ("
+              << FRAMES << " frames), Update: " << UPDATE << "us (" << OBJECTS << " objects)" << std::endl;
+}
+
@@ -3,10 +3,19 @@
  * @brief  TiledMap class tester.
  * @author zer0
  * @date   2020-01-07
+ * @date   2026-10-19 (Add the benchmark of the pull reader)
+ * @date   2026-10-19 (Add the tests of the decoding modes)
  */
 
 #include <gtest/gtest.h>
 #include <libtbag/tiled/TiledMap.hpp>
+#include <libtbag/dom/xml/XmlUtils.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
 
 using namespace libtbag;
 using namespace libtbag::tiled;
@@ -17,3 +26,182 @@ TEST(TiledMapTest, Default)
     ASSERT_TRUE(true);
 }
 
+TEST(TiledMapTest, Benchmark)
+{
+    using TmxMap = TiledMap::TmxMap;
+    using TmxDataCommon = libtbag::tiled::details::TmxDataCommon;
+
+    int const WIDTH = 512;
+    int const HEIGHT = 512;
+    int const LAYERS = 4;
+
+    TmxDataCommon::GlobalTileIds gids(WIDTH * HEIGHT);
+    for (std::size_t i = 0; i < gids.size(); ++i) {
+        gids[i] = static_cast<TmxDataCommon::GlobalTileId>(i % 97);
+    }
+    auto const ZLIB_TEXT = TmxDataCommon::writeToZlibBase64(gids.data(), gids.size());
+    auto const CSV_TEXT = TmxDataCommon::writeToCsv(gids.data(), gids.size());
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<map version=\"1.2\" orientation=\"orthogonal\" renderorder=\"right-down\" width=\"" << WIDTH
+       << "\" height=\"" << HEIGHT << "\" tilewidth=\"16\" tileheight=\"16\" nextlayerid=\"5\">\n"
+       << " <tileset firstgid=\"1\" name=\"tiles\" tilewidth=\"16\" tileheight=\"16\" tilecount=\"97\" columns=\"10\"/>\n";
+    for (int i = 0; i < LAYERS; ++i) {
+        ss << " <layer id=\"" << (i + 1) << "\" name=\"layer" << i << "\" width=\"" << WIDTH
+           << "\" height=\"" << HEIGHT << "\">\n";
+        if (i % 2 == 0) {
+            ss << "  <data encoding=\"base64\" compression=\"zlib\">\n   " << ZLIB_TEXT << "\n  </data>\n";
+        } else {
+            ss << "  <data encoding=\"csv\">\n" << CSV_TEXT << "\n  </data>\n";
+        }
+        ss << " </layer>\n";
+    }
+    ss << "</map>\n";
+    auto const XML = ss.str();
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    libtbag::dom::xml::Document doc;
+    ASSERT_EQ(E_SUCCESS, libtbag::dom::xml::readDocumentFromXmlText(doc, XML));
+    auto const * elem = doc.FirstChildElement(TmxMap::TAG_NAME);
+    ASSERT_NE(nullptr, elem);
+    TmxMap dom_map;
+    ASSERT_EQ(E_SUCCESS, dom_map.read(*elem));
+    auto const DOM = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    TiledMap object;
+    ASSERT_EQ(E_SUCCESS, object.readFromXmlText(XML.data(), XML.size(), false));
+    auto const PULL = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    auto const & map = object.map();
+    ASSERT_EQ(1, map.tilesets.size());
+    ASSERT_EQ(LAYERS, map.layers.size());
+    ASSERT_EQ(LAYERS, dom_map.layers.size());
+    for (int i = 0; i < LAYERS; ++i) {
+        ASSERT_EQ(gids, map.layers[i].data.gids);
+        ASSERT_EQ(gids, dom_map.layers[i].data.gids);
+    }
+    std::cout << "XML: " << XML.size() << " bytes, "
+              << "DOM: " << DOM << "us, Pull: " << PULL << "us" << std::endl;
+}
+
+static std::string __make_infinite_map_xml(int layers, int chunks_per_axis, int chunk_size)
+{
+    using TmxDataCommon = libtbag::tiled::details::TmxDataCommon;
+
+    std::stringstream ss;
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << "<map version=\"1.2\" orientation=\"orthogonal\" renderorder=\"right-down\" width=\"" << chunk_size
+       << "\" height=\"" << chunk_size << "\" tilewidth=\"16\" tileheight=\"16\" infinite=\"1\">\n";
+    for (int l = 0; l < layers; ++l) {
+        ss << " <layer id=\"" << (l + 1) << "\" name=\"layer" << l << "\" width=\"" << chunk_size
+           << "\" height=\"" << chunk_size << "\">\n"
+           << "  <data encoding=\"base64\" compression=\"" << (l % 2 == 0 ? "zlib" : "gzip") << "\">\n";
+        for (int cy = 0; cy < chunks_per_axis; ++cy) {
+            for (int cx = 0; cx < chunks_per_axis; ++cx) {
+                TmxDataCommon::GlobalTileIds gids(chunk_size * chunk_size);
+                for (std::size_t i = 0; i < gids.size(); ++i) {
+                    gids[i] = static_cast<TmxDataCommon::GlobalTileId>(cx + cy + l + i % 7);
+                }
+                ss << "   <chunk x=\"" << (cx * chunk_size) << "\" y=\"" << (cy * chunk_size)
+                   << "\" width=\"" << chunk_size << "\" height=\"" << chunk_size << "\">"
+                   << TmxDataCommon::writeToCompressedBase64(gids.data(), gids.size(),
+                                                             l % 2 == 0 ? TmxDataCommon::Compression::ZLIB
+                                                                        : TmxDataCommon::Compression::GZIP)
+                   << "</chunk>\n";
+            }
+        }
+        ss << "  </data>\n </layer>\n";
+    }
+    ss << "</map>\n";
+    return ss.str();
+}
+
+TEST(TiledMapTest, DecodeMode)
+{
+    auto const XML = __make_infinite_map_xml(2, 4, 16);
+
+    TiledMap immediate;
+    ASSERT_EQ(E_SUCCESS, immediate.readFromXmlText(XML, false));
+    ASSERT_FALSE(immediate.map().isDeferred());
+    ASSERT_EQ(2, immediate.map().layers.size());
+    ASSERT_EQ(16, immediate.map().layers[0].data.chunks.size());
+    ASSERT_EQ(256, immediate.map().layers[1].data.chunks[15].gids.size());
+
+    TiledMap parallel;
+    parallel.setDecodeMode(TiledMap::DecodeMode::PARALLEL, 4);
+    ASSERT_EQ(E_SUCCESS, parallel.readFromXmlText(XML, false));
+    ASSERT_FALSE(parallel.map().isDeferred());
+
+    TiledMap lazy;
+    lazy.setDecodeMode(TiledMap::DecodeMode::LAZY);
+    ASSERT_EQ(E_SUCCESS, lazy.readFromXmlText(XML, false));
+    ASSERT_TRUE(lazy.map().isDeferred());
+
+    // The chunks of (0, 0) and (16, 0) are decoded.
+    ASSERT_EQ(E_SUCCESS, lazy.decodeRegion(10, 0, 10, 5));
+    for (auto const & layer : lazy.map().layers) {
+        auto const & chunks = layer.data.chunks;
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            ASSERT_EQ(i >= 2, chunks[i].isDeferred());
+        }
+    }
+    ASSERT_TRUE(lazy.map().isDeferred());
+
+    std::string written;
+    ASSERT_EQ(E_SUCCESS, lazy.writeToXmlText(written));
+
+    ASSERT_EQ(E_SUCCESS, lazy.decodeAll());
+    ASSERT_FALSE(lazy.map().isDeferred());
+
+    for (std::size_t l = 0; l < immediate.map().layers.size(); ++l) {
+        auto const & expected = immediate.map().layers[l].data.chunks;
+        auto const & result1 = parallel.map().layers[l].data.chunks;
+        auto const & result2 = lazy.map().layers[l].data.chunks;
+        ASSERT_EQ(expected.size(), result1.size());
+        ASSERT_EQ(expected.size(), result2.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(expected[i].gids, result1[i].gids);
+            ASSERT_EQ(expected[i].gids, result2[i].gids);
+        }
+    }
+
+    // The deferred texts are written as they are.
+    TiledMap reread;
+    ASSERT_EQ(E_SUCCESS, reread.readFromXmlText(written, false));
+    ASSERT_EQ(2, reread.map().layers.size());
+    ASSERT_EQ(16, reread.map().layers[0].data.chunks.size());
+}
+
+TEST(TiledMapTest, BenchmarkOfDecodeMode)
+{
+    auto const XML = __make_infinite_map_xml(4, 16, 32);
+
+    using namespace std::chrono;
+    auto begin = system_clock::now();
+    TiledMap immediate;
+    ASSERT_EQ(E_SUCCESS, immediate.readFromXmlText(XML, false));
+    auto const IMMEDIATE = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    TiledMap parallel;
+    parallel.setDecodeMode(TiledMap::DecodeMode::PARALLEL);
+    ASSERT_EQ(E_SUCCESS, parallel.readFromXmlText(XML, false));
+    auto const PARALLEL = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    begin = system_clock::now();
+    TiledMap lazy;
+    lazy.setDecodeMode(TiledMap::DecodeMode::LAZY);
+    ASSERT_EQ(E_SUCCESS, lazy.readFromXmlText(XML, false));
+    ASSERT_EQ(E_SUCCESS, lazy.decodeRegion(0, 0, 64, 64));
+    auto const LAZY = duration_cast<microseconds>(system_clock::now() - begin).count();
+
+    ASSERT_EQ(256, parallel.map().layers[3].data.chunks.size());
+    ASSERT_EQ(immediate.map().layers[3].data.chunks[255].gids, parallel.map().layers[3].data.chunks[255].gids);
+    std::cout << "Chunks: " << (4 * 256) << ", Threads: " << std::thread::hardware_concurrency() << ", "
+              << "Immediate: " << IMMEDIATE << "us, Parallel: " << PARALLEL << "us, "
+              << "Lazy(4 chunks): " << LAZY << "us" << std::endl;
+}
+
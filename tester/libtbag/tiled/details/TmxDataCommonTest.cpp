@@ -3,6 +3,7 @@
  * @brief  TmxDataCommon class tester.
  * @author zer0
  * @date   2019-07-10
+ * @date   2026-10-19 (Add the test of the text reader)
  */
 
 #include <gtest/gtest.h>
@@ -68,3 +69,33 @@ TEST(TmxDataCommonTest, CSV)
     ASSERT_EQ(GLOBAL_TILE_IDS[3], IDS[3]);
 }
 
+TEST(TmxDataCommonTest, ReadGidsFromText)
+{
+    using TileLayerFormat = TmxDataCommon::TileLayerFormat;
+    TmxDataCommon::GlobalTileIds const IDS = { 1, 2, 3, 4, 5, 6 };
+
+    auto const BASE64_TEXT = "\n  " + TmxDataCommon::writeToBase64(IDS.data(), IDS.size()) + "\n";
+    auto const ZLIB_TEXT = TmxDataCommon::writeToZlibBase64(IDS.data(), IDS.size());
+    auto const GZIP_TEXT = TmxDataCommon::writeToGzipBase64(IDS.data(), IDS.size());
+    std::string const CSV_TEXT = "\n1,2,3,\n4,5,6\n";
+
+    TmxDataCommon::GlobalTileIds gids;
+    ASSERT_EQ(E_SUCCESS, TmxDataCommon::readGids(BASE64_TEXT.data(), BASE64_TEXT.size(), gids, TileLayerFormat::BASE64));
+    ASSERT_EQ(IDS, gids);
+    ASSERT_EQ(E_SUCCESS, TmxDataCommon::readGids(ZLIB_TEXT.data(), ZLIB_TEXT.size(), gids, TileLayerFormat::ZLIB_BASE64, IDS.size()));
+    ASSERT_EQ(IDS, gids);
+    ASSERT_EQ(E_SUCCESS, TmxDataCommon::readGids(GZIP_TEXT.data(), GZIP_TEXT.size(), gids, TileLayerFormat::GZIP_BASE64));
+    ASSERT_EQ(IDS, gids);
+    ASSERT_EQ(E_SUCCESS, TmxDataCommon::readGids(CSV_TEXT.data(), CSV_TEXT.size(), gids, TileLayerFormat::CSV, IDS.size()));
+    ASSERT_EQ(IDS, gids);
+
+    // The expected size is too small.
+    ASSERT_EQ(E_SUCCESS, TmxDataCommon::readGids(ZLIB_TEXT.data(), ZLIB_TEXT.size(), gids, TileLayerFormat::ZLIB_BASE64, 2));
+    ASSERT_EQ(IDS, gids);
+
+    std::string const INVALID_CSV = "1,x,3";
+    ASSERT_EQ(E_DECODE, TmxDataCommon::readGids(INVALID_CSV.data(), INVALID_CSV.size(), gids, TileLayerFormat::CSV));
+    ASSERT_EQ(E_DECODE, TmxDataCommon::readGids("", 0, gids, TileLayerFormat::BASE64));
+    ASSERT_EQ(E_ILLARGS, TmxDataCommon::readGids(CSV_TEXT.data(), CSV_TEXT.size(), gids, TileLayerFormat::XML));
+}
+
@@ -10,6 +10,10 @@
 #include <libtbag/uvpp/Loop.hpp>
 
 #include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <iostream>
 
 using namespace libtbag;
 using namespace libtbag::uvpp;
@@ -20,7 +24,7 @@ TEST(SafetyAsyncTest, Default)
     Loop loop;
     auto async = loop.newHandle<SafetyAsync>(loop);
 
-    ASSERT_EQ(2/* Async & Idle */, loop.size());
+    ASSERT_EQ(1/* Async */, loop.size());
     ASSERT_TRUE(static_cast<bool>(async));
 
     std::atomic_bool is_end;
@@ -60,3 +64,82 @@ TEST(SafetyAsyncTest, Default)
     ASSERT_TRUE(async->isClosing());
 }
 
+
+TEST(SafetyAsyncTest, InlineJob)
+{
+    Loop loop;
+    auto async = loop.newHandle<SafetyAsync>(loop, 4/* inline jobs */, 2/* batch size */);
+    ASSERT_TRUE(static_cast<bool>(async));
+    ASSERT_EQ(4, async->getInlineJobSize());
+    ASSERT_EQ(2, async->getBatchSize());
+
+    int counter = 0;
+    int const TEST_COUNT = 10; // More than the inline job slots.
+    for (int i = 0; i < TEST_COUNT; ++i) {
+        ASSERT_EQ(E_SUCCESS, async->sendFunc([&counter](){ ++counter; }));
+    }
+    ASSERT_EQ(TEST_COUNT, async->size());
+
+    // Large callable object falls back to the FunctionalJob.
+    char large[SafetyAsync::INLINE_STORAGE_SIZE * 2] = {0,};
+    ASSERT_EQ(E_SUCCESS, async->sendFunc([&counter, large](){ counter += 1 + large[0]; }));
+
+    auto job = std::make_shared<SafetyAsync::FunctionalJob>([&counter](){ ++counter; });
+    ASSERT_EQ(E_SUCCESS, async->sendJob(job));
+    ASSERT_EQ(E_ALREADY, async->sendJob(job));
+
+    ASSERT_EQ(E_SUCCESS, async->sendClose());
+    ASSERT_EQ(E_SUCCESS, loop.run());
+
+    ASSERT_EQ(TEST_COUNT + 2, counter);
+    ASSERT_TRUE(async->empty());
+    ASSERT_EQ(0, loop.size());
+}
+
+TEST(SafetyAsyncTest, BenchmarkOfMultiThreadPosting)
+{
+    int const THREAD_COUNT = 16;
+    int const JOB_COUNT_PER_THREAD = 10000;
+    int const TOTAL_JOB_COUNT = THREAD_COUNT * JOB_COUNT_PER_THREAD;
+
+    Loop loop;
+    auto async = loop.newHandle<SafetyAsync>(loop);
+    ASSERT_TRUE(static_cast<bool>(async));
+
+    std::size_t async_counter = 0; // Only the loop thread accesses it.
+    std::atomic_bool is_end(false);
+
+    Err loop_result = E_UNKNOWN;
+    std::thread loop_thread([&](){
+        loop_result = loop.run();
+        is_end = true;
+    });
+
+    auto const BEGIN = std::chrono::system_clock::now();
+    std::vector<std::thread> producers;
+    for (int i = 0; i < THREAD_COUNT; ++i) {
+        producers.emplace_back([&](){
+            for (int j = 0; j < JOB_COUNT_PER_THREAD; ++j) {
+                async->sendFunc([&async_counter](){ ++async_counter; });
+            }
+        });
+    }
+    for (auto & producer : producers) {
+        producer.join();
+    }
+    auto const POSTED = std::chrono::system_clock::now();
+
+    async->sendClose();
+    loop_thread.join();
+    auto const END = std::chrono::system_clock::now();
+
+    using namespace std::chrono;
+    std::cout << "Posting " << TOTAL_JOB_COUNT << " jobs from " << THREAD_COUNT << " threads: "
+              << duration_cast<milliseconds>(POSTED - BEGIN).count() << "ms (posting), "
+              << duration_cast<milliseconds>(END - BEGIN).count() << "ms (total)" << std::endl;
+
+    ASSERT_TRUE(is_end.load());
+    ASSERT_EQ(E_SUCCESS, loop_result);
+    ASSERT_EQ(TOTAL_JOB_COUNT, async_counter);
+    ASSERT_EQ(0, loop.size());
+}
@@ -3,10 +3,19 @@
  * @brief  TlsTcp class tester.
  * @author zer0
  * @date   2019-01-26
+ * @date   2026-10-19 (Add the tests of the TLS stream)
  */
 
 #include <gtest/gtest.h>
 #include <libtbag/uvpp/ex/TlsTcp.hpp>
+#include <libtbag/uvpp/Loop.hpp>
+#include <libtbag/uvpp/Idle.hpp>
+#include <libtbag/net/SocketAddress.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 using namespace libtbag;
 using namespace libtbag::uvpp;
@@ -18,3 +27,164 @@ TEST(TlsTcpTest, Default)
     ASSERT_TRUE(true);
 }
 
+struct TlsTcpTestEcho : public TlsTcp
+{
+    TlsTcpTestEcho(Loop & loop, Tls const & context) : TlsTcp(loop, context)
+    { /* EMPTY. */ }
+
+    void onTlsRead(Err code, char const * buffer, std::size_t size) override
+    {
+        if (isFailure(code)) {
+            close();
+            return;
+        }
+        writeTls(buffer, size);
+    }
+};
+
+struct TlsTcpTestServer : public TlsTcp
+{
+    Tls context;
+    std::vector<std::shared_ptr<TlsTcpTestEcho>> sessions;
+
+    TlsTcpTestServer(Loop & loop) : TlsTcp(loop), context(Tls::create_memory_cert{})
+    {
+        context.enableSessionCache();
+    }
+
+    void onConnection(Err code) override
+    {
+        auto session = getLoop()->newHandle<TlsTcpTestEcho>(*getLoop(), context);
+        if (isSuccess(acceptTls(*session))) {
+            sessions.push_back(session);
+        } else {
+            session->close();
+        }
+    }
+
+    void closeAll()
+    {
+        for (auto & session : sessions) {
+            if (!session->isClosing()) {
+                session->close();
+            }
+        }
+        close();
+    }
+};
+
+struct TlsTcpTestClient : public TlsTcp
+{
+    ConnectRequest connect_req;
+    std::vector<std::string> messages;
+    std::string expected;
+    std::string received;
+    Err handshake = E_UNKNOWN;
+    bool reused = false;
+    TlsSession session;
+
+    TlsTcpTestClient(Loop & loop, Tls const & context) : TlsTcp(loop, context)
+    { /* EMPTY. */ }
+
+    void onTlsHandshake(Err code) override
+    {
+        handshake = code;
+        if (isFailure(code)) {
+            close();
+            return;
+        }
+        reused = isSessionReused();
+        session = getSession();
+
+        // Small writes are coalesced into a record.
+        cork();
+        for (auto & message : messages) {
+            writeTls(message.data(), message.size());
+            expected += message;
+        }
+        uncork();
+    }
+
+    void onTlsRead(Err code, char const * buffer, std::size_t size) override
+    {
+        if (isFailure(code)) {
+            close();
+            return;
+        }
+        received.append(buffer, buffer + size);
+        if (received.size() >= expected.size()) {
+            close();
+        }
+    }
+};
+
+static std::shared_ptr<TlsTcpTestClient> runTlsClient(Loop & loop, TlsTcp::Tls const & context, int port,
+                                                      TlsTcp::TlsSession const & session = TlsTcp::TlsSession())
+{
+    auto client = loop.newHandle<TlsTcpTestClient>(loop, context);
+    for (int i = 0; i < 100; ++i) {
+        client->messages.push_back("message" + std::to_string(i) + ";");
+    }
+    client->messages.push_back(std::string(TlsTcp::Tls::MAX_RECORD_SIZE * 3, 'z'));
+    if (session) {
+        client->setSession(session);
+    }
+
+    libtbag::net::SocketAddress address;
+    if (isFailure(address.init("127.0.0.1", port))) {
+        return nullptr;
+    }
+    if (isFailure(client->connectTls(client->connect_req, address.getCommon()))) {
+        return nullptr;
+    }
+    return client;
+}
+
+TEST(TlsTcpTest, EchoAndResumption)
+{
+    Loop loop;
+    auto server = loop.newHandle<TlsTcpTestServer>(loop);
+    ASSERT_EQ(E_SUCCESS, initCommonServer(*server, "127.0.0.1", 0));
+    auto const PORT = server->getSockPort();
+
+    TlsTcp::Tls client_context;
+
+    auto first = runTlsClient(loop, client_context, PORT);
+    ASSERT_TRUE(static_cast<bool>(first));
+    auto second = std::shared_ptr<TlsTcpTestClient>();
+
+    // Reconnect with the session of the first connection.
+    struct Watcher : public Idle {
+        std::function<bool(void)> cb;
+        Watcher(Loop & l) : Idle(l) { /* EMPTY. */ }
+        void onIdle() override { if (cb()) { close(); } }
+    };
+    auto watcher = loop.newHandle<Watcher>(loop);
+    watcher->cb = [&]() -> bool {
+        if (!second) {
+            if (!first->isClosing()) {
+                return false;
+            }
+            second = runTlsClient(loop, client_context, PORT, first->session);
+            return !second;
+        }
+        if (!second->isClosing()) {
+            return false;
+        }
+        server->closeAll();
+        return true;
+    };
+    ASSERT_EQ(E_SUCCESS, watcher->start());
+    ASSERT_EQ(E_SUCCESS, loop.run());
+
+    ASSERT_EQ(E_SUCCESS, first->handshake);
+    ASSERT_FALSE(first->reused);
+    ASSERT_TRUE(first->session.exists());
+    ASSERT_EQ(first->expected, first->received);
+
+    ASSERT_TRUE(static_cast<bool>(second));
+    ASSERT_EQ(E_SUCCESS, second->handshake);
+    ASSERT_TRUE(second->reused);
+    ASSERT_EQ(second->expected, second->received);
+}
+